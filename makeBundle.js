@@ -0,0 +1,69 @@
+//
+// Packs the js output of an app into one bundle for BGJSBundle, which require() reads modules from
+// usage: node makeBundle.js <js root> <output, e.g. src/main/assets/bgjs.bundle> [code cache dir]
+// The code cache dir may contain a <module path>.v8cache for any module, made by the v8 the app ships with.
+// Keep the bundle uncompressed in the apk: aaptOptions { noCompress 'bundle' }
+//
+"use strict";
+const fs = require("fs");
+const path = require("path");
+
+const MAGIC = "BGJSBNDL";
+const VERSION = 1;
+const ENTRY_SIZE = 24;
+
+if (process.argv.length < 4) {
+    console.error("usage: node makeBundle.js <js root> <output> [code cache dir]");
+    process.exit(1);
+}
+const root = process.argv[2];
+const output = process.argv[3];
+const codeCacheDir = process.argv[4];
+
+// everything require() can resolve to; paths are relative to the assets, with forward slashes
+const collect = function(dir, prefix, modules) {
+    for (const name of fs.readdirSync(dir).sort()) {
+        const file = path.join(dir, name);
+        const modulePath = prefix ? prefix + "/" + name : name;
+        if (fs.statSync(file).isDirectory()) {
+            collect(file, modulePath, modules);
+        } else if (/\.(js|json)$/.test(name)) {
+            modules.push({ path: modulePath, file: file });
+        }
+    }
+    return modules;
+};
+
+const modules = collect(root, "", []);
+const chunks = [];
+let offset = MAGIC.length + 8 + modules.length * ENTRY_SIZE;
+const add = function(buffer) {
+    const range = [offset, buffer.length];
+    chunks.push(buffer);
+    offset += buffer.length;
+    return range;
+};
+
+const index = Buffer.alloc(MAGIC.length + 8 + modules.length * ENTRY_SIZE);
+index.write(MAGIC, 0, "ascii");
+index.writeUInt32LE(VERSION, MAGIC.length);
+index.writeUInt32LE(modules.length, MAGIC.length + 4);
+
+let cached = 0;
+modules.forEach((module, i) => {
+    const ranges = [add(Buffer.from(module.path, "utf8")), add(fs.readFileSync(module.file)), [0, 0]];
+    if (codeCacheDir) {
+        const cacheFile = path.join(codeCacheDir, module.path + ".v8cache");
+        if (fs.existsSync(cacheFile)) {
+            ranges[2] = add(fs.readFileSync(cacheFile));
+            cached++;
+        }
+    }
+    ranges.forEach((range, j) => {
+        index.writeUInt32LE(range[0], MAGIC.length + 8 + i * ENTRY_SIZE + j * 8);
+        index.writeUInt32LE(range[1], MAGIC.length + 8 + i * ENTRY_SIZE + j * 8 + 4);
+    });
+});
+
+fs.writeFileSync(output, Buffer.concat([index].concat(chunks)));
+console.log(`Bundled ${modules.length} modules (${cached} with code cache) into ${output}, ${offset} bytes`);
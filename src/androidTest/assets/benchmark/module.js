@@ -0,0 +1,32 @@
+// required by BridgeBenchmark to time require; a module of typical size and shape
+var cache = {};
+
+function format(value, digits) {
+    var key = value + ":" + digits;
+    if (!(key in cache)) {
+        cache[key] = value.toFixed(digits);
+    }
+    return cache[key];
+}
+
+function Series(name) {
+    this.name = name;
+    this.values = [];
+}
+
+Series.prototype.push = function (value) {
+    this.values.push(value);
+    return this;
+};
+
+Series.prototype.range = function () {
+    var min = Infinity, max = -Infinity;
+    for (var i = 0; i < this.values.length; i++) {
+        min = Math.min(min, this.values[i]);
+        max = Math.max(max, this.values[i]);
+    }
+    return { min: min, max: max };
+};
+
+exports.format = format;
+exports.Series = Series;
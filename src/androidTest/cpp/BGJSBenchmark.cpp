@@ -0,0 +1,179 @@
+/**
+ * BGJSBenchmark
+ * Runner of the native benchmarks of the bridge
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSBenchmark.h"
+#include "bgjs/BGJSV8Engine.h"
+#include "jni/JNIWrapper.h"
+
+#include <algorithm>
+#include <math.h>
+#include <sstream>
+#include <time.h>
+#include <unistd.h>
+
+// iterations of a single run are capped, so benchmarks of a few ns do not overflow anything
+#define BGJS_BENCHMARK_MAX_ITERATIONS ((int64_t)1000000000)
+
+static double clockNs(clockid_t clock) {
+	struct timespec ts;
+	clock_gettime(clock, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+BGJSBenchmarkState::BGJSBenchmarkState(BGJSV8Engine *engine, JNIEnv *env, int64_t range, int64_t iterations) {
+	_engine = engine;
+	_env = env;
+	_range = range;
+	_iterations = _left = iterations;
+	_running = false;
+	_realStart = _cpuStart = 0;
+	_realTime = _cpuTime = 0;
+}
+
+void BGJSBenchmarkState::start() {
+	_running = true;
+	_realStart = clockNs(CLOCK_MONOTONIC);
+	_cpuStart = clockNs(CLOCK_THREAD_CPUTIME_ID);
+}
+
+void BGJSBenchmarkState::stop() {
+	_realTime += clockNs(CLOCK_MONOTONIC) - _realStart;
+	_cpuTime += clockNs(CLOCK_THREAD_CPUTIME_ID) - _cpuStart;
+	_running = false;
+}
+
+void BGJSBenchmarkState::pauseTiming() {
+	if (_running) {
+		stop();
+	}
+}
+
+void BGJSBenchmarkState::resumeTiming() {
+	if (!_running) {
+		start();
+	}
+}
+
+std::vector<BGJSBenchmark::Entry> &BGJSBenchmark::entries() {
+	// registrations run from static initializers of other translation units, so this must not be a global itself
+	static std::vector<Entry> entries;
+	return entries;
+}
+
+int BGJSBenchmark::add(const char *name, BGJSBenchmarkFunction fn, std::initializer_list<int64_t> ranges) {
+	if (ranges.size() == 0) {
+		entries().push_back({ name, fn, 0 });
+		return 0;
+	}
+	for (int64_t range : ranges) {
+		entries().push_back({ std::string(name) + "/" + std::to_string(range), fn, range });
+	}
+	return 0;
+}
+
+static double median(std::vector<double> values) {
+	std::sort(values.begin(), values.end());
+	const size_t n = values.size();
+	return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+static void writeRun(std::stringstream &json, bool &first, const std::string &name, const char *runType,
+					 int64_t iterations, double realTime, double cpuTime) {
+	json << (first ? "\n" : ",\n")
+		 << "    {\"name\": \"" << name << "\", \"run_type\": \"" << runType << "\", \"iterations\": " << iterations
+		 << ", \"real_time\": " << realTime << ", \"cpu_time\": " << cpuTime << ", \"time_unit\": \"ns\"}";
+	first = false;
+}
+
+std::string BGJSBenchmark::run(BGJSV8Engine *engine, JNIEnv *env, const std::string &filter, double minTimeMs,
+							   int repetitions) {
+	const double minTime = minTimeMs * 1e6;
+	repetitions = std::max(repetitions, 1);
+
+	char date[32];
+	const time_t now = time(nullptr);
+	strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", localtime(&now));
+
+	std::stringstream json;
+	json.precision(6);
+	json << "{\n  \"context\": {\"date\": \"" << date << "\", \"executable\": \"libbgjs-benchmark.so\", \"num_cpus\": "
+		 << sysconf(_SC_NPROCESSORS_ONLN) << ", \"library_build_type\": \""
+#ifdef ENABLE_JNI_ASSERT
+		 << "debug"
+#else
+		 << "release"
+#endif
+		 << "\"},\n  \"benchmarks\": [";
+
+	bool first = true;
+	for (const Entry &entry : entries()) {
+		if (!filter.empty() && entry.name.find(filter) == std::string::npos) {
+			continue;
+		}
+
+		// the calibration runs double as warm up
+		int64_t iterations = 1;
+		while (true) {
+			BGJSBenchmarkState state(engine, env, entry.range, iterations);
+			entry.fn(state);
+			const double time = state.realTime();
+			if (time >= minTime || iterations >= BGJS_BENCHMARK_MAX_ITERATIONS) {
+				break;
+			}
+			// aim a little past the minimum, and grow at most 10x per step, like Google Benchmark does
+			const double factor = time > 0 ? minTime * 1.4 / time : 10;
+			iterations = std::min(BGJS_BENCHMARK_MAX_ITERATIONS,
+								  std::max(iterations + 1, (int64_t)(iterations * std::min(factor, 10.0))));
+		}
+
+		std::vector<double> realTimes, cpuTimes;
+		for (int i = 0; i < repetitions; i++) {
+			BGJSBenchmarkState state(engine, env, entry.range, iterations);
+			entry.fn(state);
+			realTimes.push_back(state.realTime() / iterations);
+			cpuTimes.push_back(state.cpuTime() / iterations);
+			writeRun(json, first, entry.name, "iteration", iterations, realTimes.back(), cpuTimes.back());
+		}
+		writeRun(json, first, entry.name + "_median", "aggregate", iterations, median(realTimes), median(cpuTimes));
+	}
+	json << "\n  ]\n}\n";
+	return json.str();
+}
+
+extern "C" {
+
+/**
+ * runs the native benchmarks in engine; called by NativeBenchmarks.run of the benchmark apk
+ */
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_benchmark_NativeBenchmarks_run(JNIEnv *env, jclass clazz, jobject engineObj, jstring filter,
+													 jdouble minTimeMs, jint repetitions) {
+	// not JNIWrapper::wrapObject: its templates would look for the type ids of this library, which are never registered
+	jclass objectClass = env->FindClass("ag/boersego/bgjs/JNIObject");
+	jfieldID handleField = env->GetFieldID(objectClass, "nativeHandle", "J");
+	env->DeleteLocalRef(objectClass);
+	BGJSV8Engine *engine = static_cast<BGJSV8Engine*>(
+			reinterpret_cast<JNIObject*>(env->GetLongField(engineObj, handleField)));
+
+	v8::Isolate *isolate = engine->getIsolate();
+	v8::Locker l(isolate);
+	v8::Isolate::Scope isolateScope(isolate);
+	v8::HandleScope scope(isolate);
+	v8::Context::Scope ctxScope(engine->getContext());
+
+	// std::strings are not handed across libraries, each of them links its own static libc++
+	std::string filterStr;
+	if (filter) {
+		const char *chars = env->GetStringUTFChars(filter, nullptr);
+		filterStr = chars;
+		env->ReleaseStringUTFChars(filter, chars);
+	}
+	const std::string results = BGJSBenchmark::run(engine, env, filterStr, minTimeMs, repetitions);
+	return env->NewStringUTF(results.c_str());
+}
+
+}
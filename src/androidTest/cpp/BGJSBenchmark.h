@@ -0,0 +1,95 @@
+#ifndef __BGJSBENCHMARK_H
+#define __BGJSBENCHMARK_H	1
+
+#include <jni.h>
+#include <stdint.h>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+class BGJSV8Engine;
+
+/**
+ * BGJSBenchmark
+ * Runner of the native benchmarks of the bridge, built into libbgjs-benchmark with -DBGJS_BENCHMARKS=ON
+ *
+ * A benchmark loops while state.keepRunning(); only the loop is timed. The runner grows the iterations until a run
+ * takes at least the minimum time, repeats that run and reports every repetition and their median, in the JSON format
+ * of Google Benchmark, so results of native and java benchmarks can be compared by the same tools.
+ * Benchmarks run on the calling thread, with the isolate of the engine locked and its context entered.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSBenchmarkState {
+public:
+	BGJSBenchmarkState(BGJSV8Engine *engine, JNIEnv *env, int64_t range, int64_t iterations);
+
+	bool keepRunning() {
+		if (_left > 0) {
+			if (!_running) {
+				start();
+			}
+			_left--;
+			return true;
+		}
+		if (_running) {
+			stop();
+		}
+		return false;
+	}
+
+	// excludes setup done inside of the loop from the time
+	void pauseTiming();
+	void resumeTiming();
+
+	BGJSV8Engine* engine() const { return _engine; }
+	JNIEnv* env() const { return _env; }
+	int64_t range() const { return _range; }
+	int64_t iterations() const { return _iterations; }
+
+	// in ns
+	double realTime() const { return _realTime; }
+	double cpuTime() const { return _cpuTime; }
+
+private:
+	void start();
+	void stop();
+
+	BGJSV8Engine *_engine;
+	JNIEnv *_env;
+	int64_t _range, _iterations, _left;
+	bool _running;
+	double _realStart, _cpuStart;
+	double _realTime, _cpuTime;
+};
+
+typedef void (*BGJSBenchmarkFunction)(BGJSBenchmarkState &state);
+
+class BGJSBenchmark {
+public:
+	/**
+	 * registers fn as name, once for each of ranges, or once with a range of 0 if there are none
+	 * returns a dummy value, so registrations can initialize statics, see BGJS_BENCHMARK
+	 */
+	static int add(const char *name, BGJSBenchmarkFunction fn, std::initializer_list<int64_t> ranges);
+
+	/**
+	 * runs the benchmarks whose name contains filter, all of them if it is empty; returns the results as JSON
+	 */
+	static std::string run(BGJSV8Engine *engine, JNIEnv *env, const std::string &filter, double minTimeMs,
+						   int repetitions);
+
+private:
+	struct Entry {
+		std::string name;
+		BGJSBenchmarkFunction fn;
+		int64_t range;
+	};
+	static std::vector<Entry> &entries();
+};
+
+#define BGJS_BENCHMARK(fn, ...) \
+	static const int fn##_registration = BGJSBenchmark::add(#fn, fn, {__VA_ARGS__});
+
+#endif
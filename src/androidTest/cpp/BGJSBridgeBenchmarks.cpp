@@ -0,0 +1,147 @@
+/**
+ * BGJSBridgeBenchmarks
+ * Native benchmarks of the conversions and bookkeeping the calls between java and js go through
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSBenchmark.h"
+#include "bgjs/BGJSV8Engine.h"
+#include "bgjs/BGJSTimerWheel.h"
+#include "jni/JNIWrapper.h"
+#include "v8/JNIV8Marshalling.h"
+
+using namespace v8;
+
+// ascii with every 16th character outside of latin-1, so the two byte paths of the conversions are taken as well
+static std::string makeText(int64_t length, bool ascii) {
+	std::string text;
+	for (int64_t i = 0; i < length; i++) {
+		if (!ascii && i % 16 == 15) {
+			text += "\xe2\x82\xac";	// euro sign
+		} else {
+			text += (char)('a' + i % 26);
+		}
+	}
+	return text;
+}
+
+static void BM_V8StringToJava(BGJSBenchmarkState &state) {
+	Isolate *isolate = state.engine()->getIsolate();
+	HandleScope scope(isolate);
+	Local<String> string = String::NewFromUtf8(isolate, makeText(state.range(), true).c_str());
+	while (state.keepRunning()) {
+		jstring result = JNIV8Marshalling::v8string2jstring(state.env(), string);
+		state.env()->DeleteLocalRef(result);
+	}
+}
+BGJS_BENCHMARK(BM_V8StringToJava, 8, 64, 1024, 16384)
+
+static void BM_V8TwoByteStringToJava(BGJSBenchmarkState &state) {
+	Isolate *isolate = state.engine()->getIsolate();
+	HandleScope scope(isolate);
+	Local<String> string = String::NewFromUtf8(isolate, makeText(state.range(), false).c_str());
+	while (state.keepRunning()) {
+		jstring result = JNIV8Marshalling::v8string2jstring(state.env(), string);
+		state.env()->DeleteLocalRef(result);
+	}
+}
+BGJS_BENCHMARK(BM_V8TwoByteStringToJava, 8, 64, 1024, 16384)
+
+static void BM_JavaStringToV8(BGJSBenchmarkState &state) {
+	Isolate *isolate = state.engine()->getIsolate();
+	jstring string = state.env()->NewStringUTF(makeText(state.range(), true).c_str());
+	while (state.keepRunning()) {
+		HandleScope scope(isolate);
+		JNIV8Marshalling::jstring2v8string(state.env(), string);
+	}
+	state.env()->DeleteLocalRef(string);
+}
+BGJS_BENCHMARK(BM_JavaStringToV8, 8, 64, 1024, 16384)
+
+static void BM_Utf8ToJava(BGJSBenchmarkState &state) {
+	const std::string text = makeText(state.range(), false);
+	while (state.keepRunning()) {
+		jstring result = JNIWrapper::utf82jstring(state.env(), text.data(), text.size());
+		state.env()->DeleteLocalRef(result);
+	}
+}
+BGJS_BENCHMARK(BM_Utf8ToJava, 8, 64, 1024, 16384)
+
+static void BM_NumberToJava(BGJSBenchmarkState &state) {
+	Isolate *isolate = state.engine()->getIsolate();
+	HandleScope scope(isolate);
+	Local<Value> number = Number::New(isolate, 4711.5);
+	while (state.keepRunning()) {
+		jobject result = JNIV8Marshalling::v8value2jobject(state.env(), number);
+		state.env()->DeleteLocalRef(result);
+	}
+}
+BGJS_BENCHMARK(BM_NumberToJava)
+
+// a js object seen by java for the first time: wrapper, java object and the private that caches them
+static void BM_WrapNewObject(BGJSBenchmarkState &state) {
+	Isolate *isolate = state.engine()->getIsolate();
+	while (state.keepRunning()) {
+		HandleScope scope(isolate);
+		jobject result = JNIV8Marshalling::v8value2jobject(state.env(), Object::New(isolate));
+		state.env()->DeleteLocalRef(result);
+	}
+}
+BGJS_BENCHMARK(BM_WrapNewObject)
+
+// the same js object again, which finds the cached wrapper
+static void BM_WrapCachedObject(BGJSBenchmarkState &state) {
+	Isolate *isolate = state.engine()->getIsolate();
+	HandleScope scope(isolate);
+	Local<Object> object = Object::New(isolate);
+	jobject wrapper = JNIV8Marshalling::v8value2jobject(state.env(), object);
+	while (state.keepRunning()) {
+		jobject result = JNIV8Marshalling::v8value2jobject(state.env(), object);
+		state.env()->DeleteLocalRef(result);
+	}
+	state.env()->DeleteLocalRef(wrapper);
+}
+BGJS_BENCHMARK(BM_WrapCachedObject)
+
+// what setTimeout and clearTimeout do on the wheel, with range other timers pending
+static void BM_TimerWheelSchedule(BGJSBenchmarkState &state) {
+	BGJSTimerWheel wheel;
+	std::vector<BGJSTimer*> pending;
+	for (int64_t i = 0; i < state.range(); i++) {
+		BGJSTimer *timer = wheel.allocate();
+		wheel.schedule(timer, 0, (uint32_t)(1 + i * 7919 % 600000));
+		pending.push_back(timer);
+	}
+	uint32_t delay = 0;
+	while (state.keepRunning()) {
+		BGJSTimer *timer = wheel.allocate();
+		wheel.schedule(timer, 0, 1 + (delay = (delay + 7919) % 600000));
+		wheel.unschedule(timer);
+		wheel.release(timer);
+	}
+	for (BGJSTimer *timer : pending) {
+		wheel.unschedule(timer);
+		wheel.release(timer);
+	}
+}
+BGJS_BENCHMARK(BM_TimerWheelSchedule, 0, 1000, 100000)
+
+// baseline for callV8Method: the same call without java around it
+static void BM_CallJSFunction(BGJSBenchmarkState &state) {
+	Isolate *isolate = state.engine()->getIsolate();
+	HandleScope scope(isolate);
+	Local<Context> context = isolate->GetCurrentContext();
+	Local<Function> fn = Local<Function>::Cast(
+			Script::Compile(context, String::NewFromUtf8(isolate, "(function (a, b) { return a + b; })"))
+					.ToLocalChecked()->Run(context).ToLocalChecked());
+	Local<Value> args[] = { Number::New(isolate, 1), Number::New(isolate, 2) };
+	while (state.keepRunning()) {
+		HandleScope innerScope(isolate);
+		Local<Value> result;
+		if (!fn->Call(context, context->Global(), 2, args).ToLocal(&result)) {
+			return;
+		}
+	}
+}
+BGJS_BENCHMARK(BM_CallJSFunction)
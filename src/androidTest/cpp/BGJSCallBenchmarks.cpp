@@ -0,0 +1,49 @@
+/**
+ * BGJSCallBenchmarks
+ * Natives of NativeBenchmarks that do nothing, to time the regular, @FastNative and @CriticalNative calling conventions
+ *
+ * Licensed under the MIT license.
+ */
+
+#include <jni.h>
+#include <stdlib.h>
+#include <sys/system_properties.h>
+
+static jlong regularCall(JNIEnv *env, jclass clazz, jlong value) {
+	return value + 1;
+}
+
+// @FastNative keeps the regular signature
+static jlong fastCall(JNIEnv *env, jclass clazz, jlong value) {
+	return value + 1;
+}
+
+static jlong criticalCall(jlong value) {
+	return value + 1;
+}
+
+// like JNIClassInfo::registerCriticalNativeMethod: before API 26 the annotation is ignored
+static bool supportsCriticalNatives() {
+	char sdk[PROP_VALUE_MAX] = {0};
+	__system_property_get("ro.build.version.sdk", sdk);
+	return atoi(sdk) >= 26;
+}
+
+jint JNI_OnLoad(JavaVM *vm, void *reserved) {
+	JNIEnv *env;
+	if (vm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) != JNI_OK) {
+		return -1;
+	}
+	jclass clazz = env->FindClass("ag/boersego/bgjs/benchmark/NativeBenchmarks");
+	if (!clazz) {
+		return -1;
+	}
+	const JNINativeMethod methods[] = {
+		{ "regularCall", "(J)J", (void*)regularCall },
+		{ "fastCall", "(J)J", (void*)fastCall },
+		{ "criticalCall", "(J)J", supportsCriticalNatives() ? (void*)criticalCall : (void*)regularCall },
+	};
+	const jint result = env->RegisterNatives(clazz, methods, sizeof(methods) / sizeof(methods[0]));
+	env->DeleteLocalRef(clazz);
+	return result == JNI_OK ? JNI_VERSION_1_6 : -1;
+}
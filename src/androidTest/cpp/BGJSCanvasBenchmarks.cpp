@@ -0,0 +1,321 @@
+/**
+ * BGJSCanvasBenchmarks
+ * Replays traces recorded with context.startRecording() and stopRecording() against a canvas context that draws into
+ * an offscreen EGL pbuffer, without a view, a window or js, and draws text there, which traces do not record
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "bgjs/BGJSCanvasContext.h"
+#include "bgjs/BGJSCanvasCommands.h"
+#include "GLcompat.h"
+#include "EJGLState.h"
+#include "EJTessellator.h"
+
+#include <EGL/egl.h>
+#include <jni.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include <string>
+#include <vector>
+
+#include "bgjs/os-android.h"
+
+#define LOG_TAG "BGJSCanvasBenchmarks"
+
+// indices into the results of NativeBenchmarks.replayCanvas and drawText
+enum {
+	kReplayFrames,
+	kReplayRealTime,
+	kReplayCpuTime,
+	kReplayDrawCalls,
+	kReplayVertices,
+	kReplayTextureBinds,
+	kReplayStencilPasses,
+	kReplayFlushes,
+	kReplayFills,
+	kReplayStrokes,
+	kReplayChecksum,
+	kReplayResultCount
+};
+
+static int64_t clockNs(clockid_t clock) {
+	struct timespec ts;
+	clock_gettime(clock, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * a gles2 context current on a pbuffer of its own, like the window surface of a view: rgba8888 with a stencil buffer
+ * the context that was current before is current again after it is gone
+ */
+class BGJSPbuffer {
+public:
+	BGJSPbuffer(int width, int height) {
+		_previousDisplay = eglGetCurrentDisplay();
+		_previousContext = eglGetCurrentContext();
+		_previousDraw = eglGetCurrentSurface(EGL_DRAW);
+		_previousRead = eglGetCurrentSurface(EGL_READ);
+		_context = EGL_NO_CONTEXT;
+		_surface = EGL_NO_SURFACE;
+
+		_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		if (_display == EGL_NO_DISPLAY || !eglInitialize(_display, nullptr, nullptr)) {
+			LOGE("cannot initialize egl - 0x%x", eglGetError());
+			return;
+		}
+		const EGLint configAttribs[] = {
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT, EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+			EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8, EGL_STENCIL_SIZE, 8,
+			EGL_NONE
+		};
+		EGLConfig config;
+		EGLint count = 0;
+		if (!eglChooseConfig(_display, configAttribs, &config, 1, &count) || count < 1) {
+			LOGE("no egl config for a pbuffer - 0x%x", eglGetError());
+			return;
+		}
+		const EGLint contextAttribs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+		_context = eglCreateContext(_display, config, EGL_NO_CONTEXT, contextAttribs);
+		const EGLint surfaceAttribs[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+		_surface = eglCreatePbufferSurface(_display, config, surfaceAttribs);
+		if (_context == EGL_NO_CONTEXT || _surface == EGL_NO_SURFACE ||
+				!eglMakeCurrent(_display, _surface, _surface, _context)) {
+			LOGE("cannot make a pbuffer current - 0x%x", eglGetError());
+			release();
+		}
+	}
+
+	~BGJSPbuffer() {
+		release();
+	}
+
+	bool isCurrent() const { return _surface != EGL_NO_SURFACE; }
+
+private:
+	void release() {
+		if (_previousContext != EGL_NO_CONTEXT) {
+			eglMakeCurrent(_previousDisplay, _previousDraw, _previousRead, _previousContext);
+		} else if (_display != EGL_NO_DISPLAY) {
+			eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		}
+		if (_surface != EGL_NO_SURFACE) {
+			eglDestroySurface(_display, _surface);
+			_surface = EGL_NO_SURFACE;
+		}
+		if (_context != EGL_NO_CONTEXT) {
+			eglDestroyContext(_display, _context);
+			_context = EGL_NO_CONTEXT;
+		}
+	}
+
+	EGLDisplay _display, _previousDisplay;
+	EGLContext _context, _previousContext;
+	EGLSurface _surface, _previousDraw, _previousRead;
+};
+
+// fill and stroke commands of a frame of the trace; text has no commands and is never recorded
+static void countPaints(const float *trace, size_t count, jlong *fills, jlong *strokes) {
+	*fills = *strokes = 0;
+	for (size_t i = 0; i < count; ) {
+		const int opcode = (int)trace[i];
+		switch (opcode) {
+			case kBGJSCommandFill:
+			case kBGJSCommandFillRect:
+				(*fills)++;
+				break;
+			case kBGJSCommandFillRects:
+				*fills += (jlong)trace[i + 1];
+				break;
+			case kBGJSCommandStroke:
+			case kBGJSCommandStrokeRect:
+				(*strokes)++;
+				break;
+		}
+		i += 1 + kBGJSCanvasCommands[opcode].operands;
+		if (opcode == kBGJSCommandFillRects) {
+			i += 4 * (size_t)trace[i - 1];
+		}
+	}
+}
+
+// FNV-1a of the pixels, which only match on gpus that rasterize alike
+static jlong checksum(const std::vector<GLubyte> &pixels) {
+	uint64_t hash = 14695981039346656037ULL;
+	for (GLubyte byte : pixels) {
+		hash = (hash ^ byte) * 1099511628211ULL;
+	}
+	return (jlong)hash;
+}
+
+// every frame starts from a cleared surface; gl was changed behind the back of the context, so its state is restored
+static void clearFrame(BGJSCanvasContext *context) {
+	EJGLState::invalidate();
+	glDisable(GL_SCISSOR_TEST);
+	glStencilMask(0xff);
+	glClearColor(0, 0, 0, 0);
+	glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+	EJGLState::invalidate();
+	context->activate();
+}
+
+template <typename Draw>
+static void drawFrame(BGJSCanvasContext *context, const Draw &draw, EJFrameStats *stats) {
+	memset(stats, 0, sizeof(*stats));
+	context->frameStats = stats;
+	context->startRendering();
+	draw(context);
+	context->endRendering();
+	context->frameStats = nullptr;
+}
+
+/**
+ * draws frames + 1 frames of width x height with draw into a pbuffer; the first one is drawn into the fresh context
+ * for the checksum of its pixels and is not timed, the others are
+ * returns the GL_RENDERER the frames were drawn with, or null if there is no pbuffer
+ */
+template <typename Draw>
+static jstring timeFrames(JNIEnv *env, jint width, jint height, jint frames, const Draw &draw,
+						  jlong values[kReplayResultCount]) {
+	BGJSPbuffer pbuffer(width, height);
+	if (!pbuffer.isCurrent()) {
+		return nullptr;
+	}
+	const char *renderer = (const char*)glGetString(GL_RENDERER);
+	jstring rendererStr = env->NewStringUTF(renderer ? renderer : "unknown");
+
+	EJGLState::invalidate();
+	BGJSCanvasContext *context = new BGJSCanvasContext(width, height);
+	context->backingStoreRatio = 1;
+	context->create();
+	context->resize(width, height);
+
+	EJFrameStats stats;
+	drawFrame(context, draw, &stats);
+	std::vector<GLubyte> pixels((size_t)width * height * 4);
+	context->readPixels(0, 0, width, height, pixels.data());
+	values[kReplayChecksum] = checksum(pixels);
+
+	// glFinish makes the time of a frame include the gpu, like the swap of a view that waits for its frames does
+	const int64_t realStart = clockNs(CLOCK_MONOTONIC), cpuStart = clockNs(CLOCK_THREAD_CPUTIME_ID);
+	int64_t clearTime = 0;
+	for (int frame = 0; frame < frames; frame++) {
+		const int64_t clearStart = clockNs(CLOCK_MONOTONIC);
+		clearFrame(context);
+		clearTime += clockNs(CLOCK_MONOTONIC) - clearStart;
+
+		drawFrame(context, draw, &stats);
+		glFinish();
+		values[kReplayDrawCalls] += stats.drawCalls;
+		values[kReplayVertices] += stats.vertices;
+		values[kReplayTextureBinds] += stats.textureBinds;
+		values[kReplayStencilPasses] += stats.stencilPasses;
+		values[kReplayFlushes] += stats.flushes;
+	}
+	values[kReplayRealTime] = clockNs(CLOCK_MONOTONIC) - realStart - clearTime;
+	values[kReplayCpuTime] = clockNs(CLOCK_THREAD_CPUTIME_ID) - cpuStart;
+	values[kReplayFrames] = frames;
+
+	delete context;
+	EJGLState::invalidate();
+	return rendererStr;
+}
+
+extern "C" {
+
+/**
+ * replays trace as frames frames of width x height on the calling thread, see timeFrames; called by
+ * NativeBenchmarks.replayCanvas
+ */
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_benchmark_NativeBenchmarks_replayCanvas(JNIEnv *env, jclass clazz, jfloatArray traceArray,
+															  jint width, jint height, jint frames, jlongArray results) {
+	if (env->GetArrayLength(results) < kReplayResultCount || width <= 0 || height <= 0 || frames <= 0) {
+		env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "replayCanvas: invalid arguments");
+		return nullptr;
+	}
+	std::vector<float> trace((size_t)env->GetArrayLength(traceArray));
+	env->GetFloatArrayRegion(traceArray, 0, (jsize)trace.size(), trace.data());
+
+	// the trace is checked before anything is drawn, so a broken one fails instead of being timed in parts
+	const char *error;
+	if (BGJSRunCanvasCommands(nullptr, trace.data(), trace.size(), &error) < trace.size()) {
+		env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), error);
+		return nullptr;
+	}
+
+	jlong values[kReplayResultCount] = {0};
+	jstring rendererStr = timeFrames(env, width, height, frames, [&trace](BGJSCanvasContext *context) {
+		const char *error;
+		BGJSRunCanvasCommands(context, trace.data(), trace.size(), &error);
+	}, values);
+	if (!rendererStr) {
+		return nullptr;
+	}
+	countPaints(trace.data(), trace.size(), &values[kReplayFills], &values[kReplayStrokes]);
+
+	env->SetLongArrayRegion(results, 0, kReplayResultCount, values);
+	return rendererStr;
+}
+
+/**
+ * tessellates the closed path through points, x and y interleaved, and returns the area of the triangles
+ * called by NativeBenchmarks.tessellatedArea
+ */
+JNIEXPORT jdouble JNICALL
+Java_ag_boersego_bgjs_benchmark_NativeBenchmarks_tessellatedArea(JNIEnv *env, jclass clazz, jfloatArray pointsArray,
+																 jboolean evenOdd) {
+	std::vector<EJVector2> points((size_t)env->GetArrayLength(pointsArray) / 2);
+	env->GetFloatArrayRegion(pointsArray, 0, (jsize)points.size() * 2, (jfloat*)points.data());
+	const uint32_t start = 0;
+	const EJSubPaths paths = { points.data(), &start, 1, (uint32_t)points.size() };
+
+	std::vector<EJVector2> triangles;
+	EJTessellator::tessellate(paths, evenOdd ? kEJFillRuleEvenOdd : kEJFillRuleNonZero, triangles);
+	double area = 0;
+	for (size_t i = 0; i + 2 < triangles.size(); i += 3) {
+		const EJVector2 &a = triangles[i], &b = triangles[i + 1], &c = triangles[i + 2];
+		area += fabs(((double)b.x - a.x) * ((double)c.y - a.y) - ((double)c.x - a.x) * ((double)b.y - a.y)) / 2;
+	}
+	return area;
+}
+
+/**
+ * draws text in font wrapped at width into frames frames of width x height on the calling thread,
+ * see timeFrames; called by NativeBenchmarks.drawText
+ * the glyphs of a frame are returned at kReplayFills
+ */
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_benchmark_NativeBenchmarks_drawText(JNIEnv *env, jclass clazz, jstring textStr, jstring fontStr,
+														  jboolean distanceFields, jint width, jint height,
+														  jint frames, jlongArray results) {
+	if (env->GetArrayLength(results) < kReplayResultCount || width <= 0 || height <= 0 || frames <= 0) {
+		env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "drawText: invalid arguments");
+		return nullptr;
+	}
+	const char *chars = env->GetStringUTFChars(textStr, nullptr);
+	const std::string text(chars);
+	env->ReleaseStringUTFChars(textStr, chars);
+	chars = env->GetStringUTFChars(fontStr, nullptr);
+	std::string font(chars);
+	env->ReleaseStringUTFChars(fontStr, chars);
+
+	jlong values[kReplayResultCount] = {0};
+	jlong glyphs = 0;
+	jstring rendererStr = timeFrames(env, width, height, frames, [&](BGJSCanvasContext *context) {
+		context->distanceFieldText = distanceFields;
+		context->setFont(&font[0]);
+		const EJFontLayout *layout = context->fillTextBox(text.c_str(), 0, 0, width, 0, 0);
+		glyphs = (jlong)layout->glyphs.size();
+	}, values);
+	if (!rendererStr) {
+		return nullptr;
+	}
+	values[kReplayFills] = glyphs;
+
+	env->SetLongArrayRegion(results, 0, kReplayResultCount, values);
+	return rendererStr;
+}
+
+}
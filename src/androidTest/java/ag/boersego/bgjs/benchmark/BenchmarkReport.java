@@ -0,0 +1,191 @@
+package ag.boersego.bgjs.benchmark;
+
+import ag.boersego.bgjs.BuildConfig;
+import android.content.Context;
+import android.os.Build;
+import android.os.Debug;
+import android.support.annotation.NonNull;
+import android.support.annotation.Nullable;
+import android.util.Log;
+
+import org.json.JSONArray;
+import org.json.JSONException;
+import org.json.JSONObject;
+
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.OutputStreamWriter;
+import java.io.Writer;
+import java.text.SimpleDateFormat;
+import java.util.Arrays;
+import java.util.Date;
+import java.util.Iterator;
+import java.util.Locale;
+import java.util.Map;
+
+/**
+ * Times benchmarks of the bridge and collects their results in the JSON format of Google Benchmark
+ *
+ * Jetpack Microbenchmark needs androidx, which this library does not use, so this does what its BenchmarkState does in
+ * a simpler way: the body runs for a warm up period, then the iterations of a run are grown until one takes at least
+ * MIN_TIME_NS, and REPETITIONS of those runs are reported along with their median. Native benchmarks report in the
+ * same format, see NativeBenchmarks, so one report covers both and can be compared across releases.
+ */
+final class BenchmarkReport {
+    private static final String TAG = "BenchmarkReport";
+
+    private static final long WARMUP_NS = 250_000_000L;
+    private static final long MIN_TIME_NS = 50_000_000L;
+    private static final int REPETITIONS = 5;
+    private static final long MAX_ITERATIONS = 1_000_000_000L;
+
+    private final String mFileName;
+    private final JSONArray mBenchmarks = new JSONArray();
+    private final JSONObject mContext = new JSONObject();
+    private JSONObject mNativeContext;
+
+    BenchmarkReport(@NonNull final String fileName) {
+        mFileName = fileName;
+    }
+
+    /**
+     * Times body and adds the result as name
+     *
+     * @param opsPerRun operations a single call of body does, e.g. the number of calls a js loop makes; times are
+     *                  reported per operation
+     */
+    void measure(@NonNull final String name, final int opsPerRun, @NonNull final Runnable body) {
+        final long warmupEnd = System.nanoTime() + WARMUP_NS;
+        long iterations = 1;
+        while (true) {
+            final long start = System.nanoTime();
+            for (long i = 0; i < iterations; i++) {
+                body.run();
+            }
+            final long end = System.nanoTime();
+            final long time = end - start;
+            if ((time >= MIN_TIME_NS && end >= warmupEnd) || iterations >= MAX_ITERATIONS) {
+                break;
+            }
+            // aim a little past the minimum, and grow at most 10x per step
+            final double factor = time > 0 ? Math.min(MIN_TIME_NS * 1.4 / time, 10) : 10;
+            iterations = Math.min(MAX_ITERATIONS, Math.max(iterations + 1, (long) (iterations * factor)));
+        }
+
+        final double[] realTimes = new double[REPETITIONS];
+        final double[] cpuTimes = new double[REPETITIONS];
+        final double ops = (double) iterations * opsPerRun;
+        for (int r = 0; r < REPETITIONS; r++) {
+            final long cpuStart = Debug.threadCpuTimeNanos();
+            final long start = System.nanoTime();
+            for (long i = 0; i < iterations; i++) {
+                body.run();
+            }
+            realTimes[r] = (System.nanoTime() - start) / ops;
+            cpuTimes[r] = (Debug.threadCpuTimeNanos() - cpuStart) / ops;
+        }
+        addRuns(name, iterations * opsPerRun, realTimes, cpuTimes, null);
+    }
+
+    /**
+     * Adds repetitions of a run that was timed elsewhere, e.g. by NativeBenchmarks.replayCanvas, and their median
+     *
+     * @param realTimes ns per iteration of every repetition
+     * @param counters  added to every repetition next to its times, like the user counters of Google Benchmark
+     */
+    void addRuns(@NonNull final String name, final long iterations, @NonNull final double[] realTimes,
+                 @NonNull final double[] cpuTimes, @Nullable final Map<String, Double> counters) {
+        for (int r = 0; r < realTimes.length; r++) {
+            add(name, "iteration", iterations, realTimes[r], cpuTimes[r], counters);
+        }
+        add(name + "_median", "aggregate", iterations, median(realTimes), median(cpuTimes), counters);
+        Log.i(TAG, String.format(Locale.US, "%s: %.1f ns", name, median(realTimes)));
+    }
+
+    /**
+     * Adds value to the context of the report, e.g. what the results depend on
+     */
+    void putContext(@NonNull final String key, @NonNull final Object value) throws JSONException {
+        mContext.put(key, value);
+    }
+
+    /**
+     * Adds the benchmarks of a report of NativeBenchmarks
+     */
+    void addNative(@NonNull final String json) throws JSONException {
+        final JSONObject report = new JSONObject(json);
+        mNativeContext = report.optJSONObject("context");
+        final JSONArray benchmarks = report.getJSONArray("benchmarks");
+        for (int i = 0; i < benchmarks.length(); i++) {
+            mBenchmarks.put(benchmarks.getJSONObject(i));
+        }
+    }
+
+    /**
+     * Writes the report to the file it was made for in the external files dir of context, or its files dir if there is
+     * none
+     *
+     * @return the file written
+     */
+    @NonNull
+    File write(@NonNull final Context context) throws JSONException, IOException {
+        final JSONObject device = new JSONObject()
+                .put("date", new SimpleDateFormat("yyyy-MM-dd'T'HH:mm:ssZ", Locale.US).format(new Date()))
+                .put("host_name", Build.MANUFACTURER + " " + Build.MODEL)
+                .put("sdk_int", Build.VERSION.SDK_INT)
+                .put("abi", Build.VERSION.SDK_INT >= 21 ? Build.SUPPORTED_ABIS[0] : Build.CPU_ABI)
+                .put("num_cpus", Runtime.getRuntime().availableProcessors())
+                .put("library_build_type", BuildConfig.DEBUG ? "debug" : "release");
+        if (mNativeContext != null) {
+            device.put("native", mNativeContext);
+        }
+        for (final Iterator<String> keys = mContext.keys(); keys.hasNext(); ) {
+            final String key = keys.next();
+            device.put(key, mContext.get(key));
+        }
+        final JSONObject report = new JSONObject()
+                .put("context", device)
+                .put("benchmarks", mBenchmarks);
+
+        File dir = context.getExternalFilesDir(null);
+        if (dir == null) {
+            dir = context.getFilesDir();
+        }
+        final File file = new File(dir, mFileName);
+        try (Writer writer = new OutputStreamWriter(new FileOutputStream(file), "UTF-8")) {
+            writer.write(report.toString(2));
+        }
+        Log.i(TAG, "Wrote " + mBenchmarks.length() + " results to " + file);
+        return file;
+    }
+
+    private void add(final String name, final String runType, final long iterations, final double realTime,
+                     final double cpuTime, @Nullable final Map<String, Double> counters) {
+        try {
+            final JSONObject run = new JSONObject()
+                    .put("name", name)
+                    .put("run_type", runType)
+                    .put("iterations", iterations)
+                    .put("real_time", realTime)
+                    .put("cpu_time", cpuTime)
+                    .put("time_unit", "ns");
+            if (counters != null) {
+                for (final Map.Entry<String, Double> counter : counters.entrySet()) {
+                    run.put(counter.getKey(), counter.getValue());
+                }
+            }
+            mBenchmarks.put(run);
+        } catch (final JSONException e) {
+            // only thrown for NaN and infinite numbers, which an empty run could produce
+            Log.w(TAG, "Cannot report " + name, e);
+        }
+    }
+
+    static double median(@NonNull final double[] values) {
+        final double[] sorted = values.clone();
+        Arrays.sort(sorted);
+        final int n = sorted.length;
+        return n % 2 == 1 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+    }
+}
@@ -0,0 +1,169 @@
+package ag.boersego.bgjs.benchmark;
+
+import ag.boersego.bgjs.JNIV8Array;
+import ag.boersego.bgjs.JNIV8Function;
+import ag.boersego.bgjs.JNIV8GenericObject;
+import ag.boersego.bgjs.JNIV8Object;
+import ag.boersego.bgjs.V8Engine;
+import android.app.Application;
+import android.support.test.InstrumentationRegistry;
+import android.support.test.runner.AndroidJUnit4;
+import android.util.Log;
+
+import org.junit.AfterClass;
+import org.junit.BeforeClass;
+import org.junit.Test;
+import org.junit.runner.RunWith;
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+
+import static org.junit.Assert.assertTrue;
+
+/**
+ * Benchmarks of the calls between java and js, see BenchmarkReport
+ *
+ * Run with ./gradlew connectedAndroidTest -PbgjsBenchmarks on a release build; the results of all of them, including
+ * the native benchmarks of libbgjs-benchmark, end up in one report pulled from the device.
+ */
+@RunWith(AndroidJUnit4.class)
+public class BridgeBenchmark {
+    private static final String TAG = "BridgeBenchmark";
+
+    // calls made by a single run of the js loops, to keep the overhead of calling into js out of the result
+    private static final int JS_LOOP = 1000;
+    private static final double NATIVE_MIN_TIME_MS = 50;
+    private static final int NATIVE_REPETITIONS = 5;
+
+    private static V8Engine sEngine;
+    private static BenchmarkReport sReport;
+
+    @BeforeClass
+    public static void setUp() throws InterruptedException {
+        final Application app = (Application) InstrumentationRegistry.getTargetContext().getApplicationContext();
+        sEngine = V8Engine.getInstance(app, false);
+        final CountDownLatch ready = new CountDownLatch(1);
+        sEngine.addStatusHandler(ready::countDown);
+        assertTrue("V8Engine did not start", ready.await(30, TimeUnit.SECONDS));
+        sReport = new BenchmarkReport("ejecta-v8-benchmark.json");
+    }
+
+    @AfterClass
+    public static void tearDown() throws Exception {
+        sReport.write(InstrumentationRegistry.getTargetContext());
+    }
+
+    private static Object run(final String script) {
+        return sEngine.runScript(script, "benchmark");
+    }
+
+    @Test
+    public void callV8Method() {
+        final JNIV8Object object = (JNIV8Object) run("({ nop: function () {}, "
+                + "add: function (a, b) { return a + b; } })");
+        sReport.measure("callV8Method/0", 1, () -> object.callV8Method("nop"));
+        sReport.measure("callV8Method/2", 1, () -> object.callV8Method("add", 1, 2));
+        sReport.measure("callV8MethodDouble/2", 1, () -> object.callV8MethodDouble("add", 1, 2));
+    }
+
+    @Test
+    public void getV8Field() {
+        final JNIV8Object object = (JNIV8Object) run("({ value: 4711.5, name: 'benchmark' })");
+        sReport.measure("getV8Field/number", 1, () -> object.getV8Field("value"));
+        sReport.measure("getV8Field/string", 1, () -> object.getV8Field("name"));
+        sReport.measure("getV8FieldDouble", 1, () -> object.getV8FieldDouble("value"));
+    }
+
+    @Test
+    public void arrayReads() {
+        final JNIV8Array array = (JNIV8Array) run("Array.from({ length: 1000 }, function (v, i) { return i * 0.5; })");
+        final int length = array.getV8Length();
+        sReport.measure("JNIV8Array.getV8ElementsAsDoubles/1000", length, array::getV8ElementsAsDoubles);
+        sReport.measure("JNIV8Array.getV8Elements/1000", length, array::getV8Elements);
+        sReport.measure("JNIV8Array.getV8Element/1000", length, () -> {
+            for (int i = 0; i < length; i++) {
+                array.getV8Element(i);
+            }
+        });
+    }
+
+    @Test
+    public void callsIntoJava() {
+        final JNIV8Function.Handler handler = (receiver, arguments) -> null;
+        final JNIV8Function fn = JNIV8Function.Create(sEngine, handler);
+        final String[] calls = {"f()", "f(1)", "f(1, 'b')", "f(1, 'b', o)"};
+        for (int arity = 0; arity < calls.length; arity++) {
+            final JNIV8Function loop = (JNIV8Function) run("(function (f, n) { var o = {}; for (var i = 0; i < n; i++) "
+                    + calls[arity] + "; })");
+            sReport.measure("callIntoJava/" + arity, JS_LOOP, () -> loop.callAsV8Function(fn, JS_LOOP));
+        }
+    }
+
+    @Test
+    public void strings() {
+        final JNIV8Function make = (JNIV8Function) run("(function (n) { return 'abcdefghijklmnopqrstuvwxyz'"
+                + ".repeat(Math.ceil(n / 26)).substring(0, n); })");
+        final JNIV8Object holder = (JNIV8Object) run("({})");
+        for (final int length : new int[]{8, 64, 1024, 16384}) {
+            final String text = (String) make.callAsV8Function(length);
+            holder.setV8Field("text", text);
+            sReport.measure("stringToJava/" + length, 1, () -> holder.getV8Field("text"));
+            sReport.measure("stringToJS/" + length, 1, () -> holder.setV8Field("text", text));
+        }
+    }
+
+    @Test
+    public void wrappers() {
+        final JNIV8Function make = (JNIV8Function) run("(function () { return {}; })");
+        sReport.measure("JNIV8GenericObject.Create", 1, () -> JNIV8GenericObject.Create(sEngine));
+        sReport.measure("wrapObjectFromJS", 1, make::callAsV8Function);
+    }
+
+    @Test
+    public void timers() {
+        final JNIV8Function loop = (JNIV8Function) run("(function (n) { var f = function () {}; "
+                + "for (var i = 0; i < n; i++) clearTimeout(setTimeout(f, 1000)); })");
+        sReport.measure("setTimeout+clearTimeout", JS_LOOP, () -> loop.callAsV8Function(JS_LOOP));
+    }
+
+    @Test
+    public void require() {
+        sEngine.require("benchmark/module");
+        sReport.measure("require/warm", 1, () -> sEngine.require("benchmark/module"));
+        // a new context has an empty module cache; creating it alone is the baseline to subtract
+        sReport.measure("createIsolatedContext", 1,
+                () -> sEngine.disposeIsolatedContext(sEngine.createIsolatedContext()));
+        sReport.measure("require/cold", 1, () -> {
+            final int context = sEngine.createIsolatedContext();
+            sEngine.require(context, "benchmark/module");
+            sEngine.disposeIsolatedContext(context);
+        });
+    }
+
+    /**
+     * What @FastNative and @CriticalNative save on a call, e.g. of V8Engine.unlock and BGJSGLView.getFrameStats;
+     * before Android O all three take the regular path
+     */
+    @Test
+    public void callingConventions() {
+        if (!NativeBenchmarks.isAvailable()) {
+            Log.w(TAG, "libbgjs-benchmark is missing, build with -PbgjsBenchmarks to compare the calling conventions");
+            return;
+        }
+        final long[] value = {0};
+        sReport.measure("jniCall/regular", 1, () -> value[0] = NativeBenchmarks.regularCall(value[0]));
+        sReport.measure("jniCall/fastNative", 1, () -> value[0] = NativeBenchmarks.fastCall(value[0]));
+        sReport.measure("jniCall/criticalNative", 1, () -> value[0] = NativeBenchmarks.criticalCall(value[0]));
+        // lock is a regular native, unlock a critical one
+        sReport.measure("V8Engine.runLocked", 1, () -> sEngine.runLocked(() -> value[0]++));
+    }
+
+    @Test
+    public void nativeBenchmarks() throws Exception {
+        if (!NativeBenchmarks.isAvailable()) {
+            Log.w(TAG, "libbgjs-benchmark is missing, build with -PbgjsBenchmarks to run the native benchmarks");
+            return;
+        }
+        sReport.addNative(NativeBenchmarks.run(sEngine, null, NATIVE_MIN_TIME_MS, NATIVE_REPETITIONS));
+    }
+}
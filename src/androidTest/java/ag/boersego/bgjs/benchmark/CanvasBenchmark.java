@@ -0,0 +1,255 @@
+package ag.boersego.bgjs.benchmark;
+
+import android.content.Context;
+import android.content.res.AssetManager;
+import android.support.test.InstrumentationRegistry;
+import android.support.test.runner.AndroidJUnit4;
+import android.util.Log;
+
+import org.json.JSONException;
+import org.json.JSONObject;
+import org.junit.AfterClass;
+import org.junit.BeforeClass;
+import org.junit.Test;
+import org.junit.runner.RunWith;
+
+import java.io.ByteArrayOutputStream;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.HashMap;
+import java.util.Locale;
+import java.util.Map;
+import java.util.Random;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+/**
+ * Replays traces of canvas commands headless and reports their throughput, see NativeBenchmarks.replayCanvas
+ *
+ * A trace is what context.stopRecording() returns, written out as its raw little endian floats to a file named
+ * name.WIDTHxHEIGHT.trace. Traces come from TRACE_ASSETS and from TRACE_DIR in the external files dir of the test app,
+ * where device farms push the traces of real screens. The first frame of every trace has to match the checksum in
+ * GOLDEN_ASSET for the GL_RENDERER it is drawn with; for renderers without a checksum there it is only reported, to be
+ * added once it was checked by eye. Text is not recorded, so it is drawn by drawText instead.
+ */
+@RunWith(AndroidJUnit4.class)
+public class CanvasBenchmark {
+    private static final String TAG = "CanvasBenchmark";
+
+    private static final String TRACE_ASSETS = "benchmark/canvas";
+    private static final String TRACE_DIR = "canvas-traces";
+    private static final String GOLDEN_ASSET = "benchmark/canvas/golden.json";
+    private static final Pattern TRACE_NAME = Pattern.compile("(.+)\\.(\\d+)x(\\d+)\\.trace");
+
+    private static final int FRAMES = 60;
+    private static final int REPETITIONS = 5;
+
+    private static final int TEXT_WIDTH = 800;
+    private static final int TEXT_HEIGHT = 480;
+    private static final String TEXT_FONT = "14px sans-serif";
+    private static final String TEXT_LINE = "The quick brown fox jumps over the lazy dog 0123456789 +-,.; ";
+
+    private static BenchmarkReport sReport;
+    private static JSONObject sChecksums;
+
+    @BeforeClass
+    public static void setUp() {
+        sReport = new BenchmarkReport("ejecta-v8-canvas-benchmark.json");
+        sChecksums = new JSONObject();
+    }
+
+    @AfterClass
+    public static void tearDown() throws Exception {
+        sReport.putContext("checksums", sChecksums);
+        sReport.write(InstrumentationRegistry.getTargetContext());
+    }
+
+    @Test
+    public void replayTraces() throws Exception {
+        if (!NativeBenchmarks.isAvailable()) {
+            Log.w(TAG, "libbgjs-benchmark is missing, build with -PbgjsBenchmarks to replay canvas traces");
+            return;
+        }
+        final Context context = InstrumentationRegistry.getContext();
+        final AssetManager assets = context.getAssets();
+        final JSONObject golden = new JSONObject(new String(readFully(assets.open(GOLDEN_ASSET)), "UTF-8"));
+
+        int replayed = 0;
+        for (final String file : assets.list(TRACE_ASSETS)) {
+            if (TRACE_NAME.matcher(file).matches()) {
+                replay(file, assets.open(TRACE_ASSETS + "/" + file), golden);
+                replayed++;
+            }
+        }
+        final File dir = InstrumentationRegistry.getTargetContext().getExternalFilesDir(TRACE_DIR);
+        final File[] files = dir != null ? dir.listFiles() : null;
+        if (files != null) {
+            for (final File file : files) {
+                if (TRACE_NAME.matcher(file.getName()).matches()) {
+                    replay(file.getName(), new FileInputStream(file), golden);
+                    replayed++;
+                }
+            }
+        }
+        assertTrue("no traces to replay", replayed > 0);
+    }
+
+    /**
+     * A screen full of short lines of text, like the labels of a chart, in bitmap and distance field glyphs; the
+     * checksum depends on the fonts of the device and is only reported
+     */
+    @Test
+    public void drawText() throws Exception {
+        if (!NativeBenchmarks.isAvailable()) {
+            Log.w(TAG, "libbgjs-benchmark is missing, build with -PbgjsBenchmarks to draw text");
+            return;
+        }
+        final StringBuilder text = new StringBuilder();
+        for (int line = 0; line < 30; line++) {
+            text.append(TEXT_LINE).append('\n');
+        }
+        for (final boolean distanceFields : new boolean[]{false, true}) {
+            final String name = "text/" + (distanceFields ? "distanceFields" : "bitmaps");
+            final long[] results = new long[NativeBenchmarks.REPLAY_RESULT_COUNT];
+            final double[] realTimes = new double[REPETITIONS];
+            final double[] cpuTimes = new double[REPETITIONS];
+            String renderer = null;
+            for (int r = 0; r < REPETITIONS; r++) {
+                renderer = NativeBenchmarks.drawText(text.toString(), TEXT_FONT, distanceFields, TEXT_WIDTH,
+                        TEXT_HEIGHT, FRAMES, results);
+                if (renderer == null) {
+                    Log.w(TAG, "There is no EGL pbuffer to draw text into");
+                    return;
+                }
+                realTimes[r] = (double) results[NativeBenchmarks.REPLAY_REAL_TIME] / FRAMES;
+                cpuTimes[r] = (double) results[NativeBenchmarks.REPLAY_CPU_TIME] / FRAMES;
+            }
+
+            final double msPerFrame = BenchmarkReport.median(realTimes) / 1e6;
+            final Map<String, Double> counters = new HashMap<>();
+            counters.put("draw_calls", perFrame(results, NativeBenchmarks.REPLAY_DRAW_CALLS));
+            counters.put("vertices", perFrame(results, NativeBenchmarks.REPLAY_VERTICES));
+            counters.put("texture_binds", perFrame(results, NativeBenchmarks.REPLAY_TEXTURE_BINDS));
+            counters.put("flushes", perFrame(results, NativeBenchmarks.REPLAY_FLUSHES));
+            counters.put("ms_per_frame", msPerFrame);
+            counters.put("glyphs_per_second", results[NativeBenchmarks.REPLAY_FILLS] * 1000 / msPerFrame);
+            sReport.addRuns("canvas/" + name, FRAMES, realTimes, cpuTimes, counters);
+            putChecksum(renderer, name, results);
+        }
+    }
+
+    /**
+     * Paths far from the origin have to tessellate as they do near it; the sweep used to step by less than the
+     * precision of a float there and never ended
+     */
+    @Test(timeout = 30000)
+    public void tessellatesFarFromTheOrigin() {
+        if (!NativeBenchmarks.isAvailable()) {
+            Log.w(TAG, "libbgjs-benchmark is missing, build with -PbgjsBenchmarks to test the tessellator");
+            return;
+        }
+        final Random random = new Random(4711);
+        final float[] points = new float[14];
+        final float[] moved = new float[points.length];
+        for (int path = 0; path < 500; path++) {
+            for (int i = 0; i < points.length; i++) {
+                points[i] = random.nextInt(1000) * 0.37f;
+            }
+            final double area = NativeBenchmarks.tessellatedArea(points, false);
+            for (final float offset : new float[]{1e4f, -3e4f, 1e5f}) {
+                for (int i = 0; i < points.length; i++) {
+                    moved[i] = points[i] + offset;
+                }
+                assertEquals("area of path " + path + " moved by " + offset, area,
+                        NativeBenchmarks.tessellatedArea(moved, false), area * 0.01 + 1);
+            }
+        }
+    }
+
+    private static void replay(final String file, final InputStream in, final JSONObject golden) throws Exception {
+        final Matcher match = TRACE_NAME.matcher(file);
+        assertTrue(match.matches());
+        final String name = match.group(1);
+        final int width = Integer.parseInt(match.group(2));
+        final int height = Integer.parseInt(match.group(3));
+
+        final ByteBuffer bytes = ByteBuffer.wrap(readFully(in)).order(ByteOrder.LITTLE_ENDIAN);
+        final float[] trace = new float[bytes.remaining() / 4];
+        bytes.asFloatBuffer().get(trace);
+
+        final long[] results = new long[NativeBenchmarks.REPLAY_RESULT_COUNT];
+        final double[] realTimes = new double[REPETITIONS];
+        final double[] cpuTimes = new double[REPETITIONS];
+        String renderer = null;
+        for (int r = 0; r < REPETITIONS; r++) {
+            renderer = NativeBenchmarks.replayCanvas(trace, width, height, FRAMES, results);
+            if (renderer == null) {
+                Log.w(TAG, "There is no EGL pbuffer to replay canvas traces into");
+                return;
+            }
+            realTimes[r] = (double) results[NativeBenchmarks.REPLAY_REAL_TIME] / FRAMES;
+            cpuTimes[r] = (double) results[NativeBenchmarks.REPLAY_CPU_TIME] / FRAMES;
+        }
+
+        final double msPerFrame = BenchmarkReport.median(realTimes) / 1e6;
+        final Map<String, Double> counters = new HashMap<>();
+        counters.put("draw_calls", perFrame(results, NativeBenchmarks.REPLAY_DRAW_CALLS));
+        counters.put("vertices", perFrame(results, NativeBenchmarks.REPLAY_VERTICES));
+        counters.put("texture_binds", perFrame(results, NativeBenchmarks.REPLAY_TEXTURE_BINDS));
+        counters.put("stencil_passes", perFrame(results, NativeBenchmarks.REPLAY_STENCIL_PASSES));
+        counters.put("flushes", perFrame(results, NativeBenchmarks.REPLAY_FLUSHES));
+        counters.put("ms_per_frame", msPerFrame);
+        counters.put("fills_per_second", results[NativeBenchmarks.REPLAY_FILLS] * 1000 / msPerFrame);
+        counters.put("strokes_per_second", results[NativeBenchmarks.REPLAY_STROKES] * 1000 / msPerFrame);
+        sReport.addRuns("canvas/" + name, FRAMES, realTimes, cpuTimes, counters);
+
+        final String checksum = putChecksum(renderer, name, results);
+        final JSONObject expected = golden.optJSONObject(renderer);
+        if (expected == null || !expected.has(name)) {
+            Log.i(TAG, "No golden checksum of " + name + " for " + renderer + ", it is " + checksum);
+            return;
+        }
+        assertEquals("pixels of " + name + " drawn by " + renderer, expected.getString(name), checksum);
+    }
+
+    /**
+     * Adds the checksum of the first frame to the report; it is the same in every repetition, the first frame is
+     * always drawn into a fresh context
+     */
+    private static String putChecksum(final String renderer, final String name, final long[] results)
+            throws JSONException {
+        final String checksum = String.format(Locale.US, "%016x", results[NativeBenchmarks.REPLAY_CHECKSUM]);
+        JSONObject rendererChecksums = sChecksums.optJSONObject(renderer);
+        if (rendererChecksums == null) {
+            rendererChecksums = new JSONObject();
+            sChecksums.put(renderer, rendererChecksums);
+        }
+        rendererChecksums.put(name, checksum);
+        return checksum;
+    }
+
+    private static double perFrame(final long[] results, final int index) {
+        return (double) results[index] / results[NativeBenchmarks.REPLAY_FRAMES];
+    }
+
+    private static byte[] readFully(final InputStream in) throws IOException {
+        try {
+            final ByteArrayOutputStream out = new ByteArrayOutputStream();
+            final byte[] buffer = new byte[64 * 1024];
+            int read;
+            while ((read = in.read(buffer)) > 0) {
+                out.write(buffer, 0, read);
+            }
+            return out.toByteArray();
+        } finally {
+            in.close();
+        }
+    }
+}
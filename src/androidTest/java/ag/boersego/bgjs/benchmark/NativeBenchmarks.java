@@ -0,0 +1,97 @@
+package ag.boersego.bgjs.benchmark;
+
+import ag.boersego.bgjs.V8Engine;
+import android.support.annotation.NonNull;
+import android.support.annotation.Nullable;
+
+import dalvik.annotation.optimization.CriticalNative;
+import dalvik.annotation.optimization.FastNative;
+
+/**
+ * The benchmarks of libbgjs-benchmark, which is only built with -PbgjsBenchmarks, see BGJSBenchmark.h
+ */
+final class NativeBenchmarks {
+    private static final boolean AVAILABLE;
+
+    // indices into the results of replayCanvas and drawText; times are in ns, counts are the sums over all timed frames
+    static final int REPLAY_FRAMES = 0;
+    static final int REPLAY_REAL_TIME = 1;
+    static final int REPLAY_CPU_TIME = 2;
+    static final int REPLAY_DRAW_CALLS = 3;
+    static final int REPLAY_VERTICES = 4;
+    static final int REPLAY_TEXTURE_BINDS = 5;
+    static final int REPLAY_STENCIL_PASSES = 6;
+    static final int REPLAY_FLUSHES = 7;
+    // fill and stroke commands of a single frame, for drawText the glyphs of a frame
+    static final int REPLAY_FILLS = 8;
+    static final int REPLAY_STROKES = 9;
+    // FNV-1a of the rgba pixels of the first frame
+    static final int REPLAY_CHECKSUM = 10;
+    static final int REPLAY_RESULT_COUNT = 11;
+
+    static {
+        boolean available;
+        try {
+            // before Android M the linker does not load the libraries a library needs on its own
+            System.loadLibrary("bgjs");
+            System.loadLibrary("bgjs-benchmark");
+            available = true;
+        } catch (final UnsatisfiedLinkError e) {
+            available = false;
+        }
+        AVAILABLE = available;
+    }
+
+    private NativeBenchmarks() {
+    }
+
+    static boolean isAvailable() {
+        return AVAILABLE;
+    }
+
+    /**
+     * Runs the native benchmarks whose name contains filter, all of them if it is null or empty, on the calling thread
+     *
+     * @return the results as JSON in the format of Google Benchmark
+     */
+    static native @NonNull String run(@NonNull V8Engine engine, @Nullable String filter, double minTimeMs,
+                                      int repetitions);
+
+    /**
+     * Replays a trace of canvas commands, as returned by context.stopRecording(), as frames frames of width x height
+     * into an offscreen EGL pbuffer on the calling thread, see BGJSCanvasBenchmarks.cpp
+     *
+     * @param results filled with REPLAY_RESULT_COUNT values at the REPLAY_ indices
+     * @return the GL_RENDERER that drew the frames, or null if there is no pbuffer
+     * @throws IllegalArgumentException if the trace is broken
+     */
+    static native @Nullable String replayCanvas(@NonNull float[] trace, int width, int height, int frames,
+                                                @NonNull long[] results);
+
+    /**
+     * Draws text in font, wrapped at width, as frames frames of width x height into an offscreen EGL pbuffer on the
+     * calling thread, like replayCanvas does with a trace; traces do not record text
+     *
+     * @param distanceFields whether the text is drawn with distance fields, see context.distanceFieldText
+     * @param results filled with REPLAY_RESULT_COUNT values at the REPLAY_ indices
+     * @return the GL_RENDERER that drew the frames, or null if there is no pbuffer
+     */
+    static native @Nullable String drawText(@NonNull String text, @NonNull String font, boolean distanceFields,
+                                            int width, int height, int frames, @NonNull long[] results);
+
+    /**
+     * Tessellates the closed path through points, x and y interleaved, like fills of complex paths are
+     *
+     * @return the area of the triangles
+     */
+    static native double tessellatedArea(@NonNull float[] points, boolean evenOdd);
+
+    // the same empty native in each calling convention, see BGJSCallBenchmarks.cpp; all return value + 1
+    static native long regularCall(long value);
+
+    @FastNative
+    static native long fastCall(long value);
+
+    @CriticalNative
+    static native long criticalCall(long value);
+}
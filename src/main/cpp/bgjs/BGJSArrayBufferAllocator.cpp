@@ -0,0 +1,155 @@
+/**
+ * BGJSArrayBufferAllocator
+ * Pooled backing stores of ArrayBuffers
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSArrayBufferAllocator.h"
+
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// buffers of up to 2^MIN_BITS bytes and above 2^(MAX_BITS + 1) bytes are not pooled
+#define BGJS_ARRAY_BUFFER_POOL_MIN_BITS 6
+#define BGJS_ARRAY_BUFFER_POOL_MAX_BITS 21
+#define BGJS_ARRAY_BUFFER_POOL_CLASSES ((BGJS_ARRAY_BUFFER_POOL_MAX_BITS - BGJS_ARRAY_BUFFER_POOL_MIN_BITS + 1) * 4)
+#define BGJS_ARRAY_BUFFER_POOL_DEFAULT_LIMIT (8 * 1024 * 1024)
+
+namespace {
+
+std::mutex poolMutex;
+std::vector<void*> pool[BGJS_ARRAY_BUFFER_POOL_CLASSES];
+size_t pooledBytes = 0;
+size_t poolLimit = BGJS_ARRAY_BUFFER_POOL_DEFAULT_LIMIT;
+
+/**
+ * size class of a buffer of length bytes and its capacity; -1 if buffers of this length are not pooled
+ * lengths in (2^b, 2^(b+1)] are rounded up to a multiple of 2^(b-2)
+ */
+int sizeClass(size_t length, size_t* capacity) {
+	if (length <= ((size_t) 1 << BGJS_ARRAY_BUFFER_POOL_MIN_BITS)) {
+		return -1;
+	}
+	const int bits = 63 - __builtin_clzll((unsigned long long) (length - 1));
+	if (bits > BGJS_ARRAY_BUFFER_POOL_MAX_BITS) {
+		return -1;
+	}
+	const size_t step = (size_t) 1 << (bits - 2);
+	const size_t steps = (length + step - 1) / step;
+	*capacity = steps * step;
+	return (bits - BGJS_ARRAY_BUFFER_POOL_MIN_BITS) * 4 + (int) (steps - 5);
+}
+
+void trimLocked(size_t bytes) {
+	for (int i = BGJS_ARRAY_BUFFER_POOL_CLASSES - 1; i >= 0 && pooledBytes > bytes; i--) {
+		// every buffer of a class has the same capacity
+		const size_t capacity = (size_t) (5 + i % 4) << (i / 4 + BGJS_ARRAY_BUFFER_POOL_MIN_BITS - 2);
+		while (!pool[i].empty() && pooledBytes > bytes) {
+			free(pool[i].back());
+			pool[i].pop_back();
+			pooledBytes -= capacity;
+		}
+	}
+}
+
+}
+
+BGJSArrayBufferAllocator::BGJSArrayBufferAllocator() : _liveBytes(0), _peakBytes(0), _allocations(0), _poolHits(0) {
+}
+
+void* BGJSArrayBufferAllocator::Allocate(size_t length) {
+	return allocate(length, true);
+}
+
+void* BGJSArrayBufferAllocator::AllocateUninitialized(size_t length) {
+	return allocate(length, false);
+}
+
+void* BGJSArrayBufferAllocator::allocate(size_t length, bool zeroed) {
+	size_t capacity = length;
+	const int index = sizeClass(length, &capacity);
+	void* data = nullptr;
+	if (index >= 0) {
+		std::lock_guard<std::mutex> lock(poolMutex);
+		if (!pool[index].empty()) {
+			data = pool[index].back();
+			pool[index].pop_back();
+			pooledBytes -= capacity;
+		}
+	}
+
+	if (data) {
+		_poolHits++;
+		if (zeroed) {
+			// the rest of the capacity is never read; its length is all that v8 knows of the buffer
+			memset(data, 0, length);
+		}
+	} else {
+		// fresh memory from calloc is often zero already, e.g. new pages of the kernel
+		data = zeroed ? calloc(capacity ? capacity : 1, 1) : malloc(capacity ? capacity : 1);
+		if (!data) {
+			return nullptr;
+		}
+	}
+
+	_allocations++;
+	const int64_t live = _liveBytes += (int64_t) length;
+	int64_t peak = _peakBytes.load();
+	while (live > peak && !_peakBytes.compare_exchange_weak(peak, live)) {
+	}
+	return data;
+}
+
+void BGJSArrayBufferAllocator::Free(void* data, size_t length) {
+	if (!data) {
+		return;
+	}
+	_liveBytes -= (int64_t) length;
+
+	size_t capacity = length;
+	const int index = sizeClass(length, &capacity);
+	if (index >= 0) {
+		std::lock_guard<std::mutex> lock(poolMutex);
+		if (pooledBytes + capacity <= poolLimit) {
+			pool[index].push_back(data);
+			pooledBytes += capacity;
+			return;
+		}
+	}
+	free(data);
+}
+
+BGJSArrayBufferAllocator::Stats BGJSArrayBufferAllocator::getStats() const {
+	Stats stats;
+	// buffers that came from a worker were counted by the allocator of the worker, so this can drop below 0
+	const int64_t live = _liveBytes.load();
+	stats.liveBytes = live > 0 ? (size_t) live : 0;
+	stats.peakBytes = (size_t) _peakBytes.load();
+	stats.allocations = _allocations.load();
+	stats.poolHits = _poolHits.load();
+	return stats;
+}
+
+void BGJSArrayBufferAllocator::setPoolLimit(size_t bytes) {
+	std::lock_guard<std::mutex> lock(poolMutex);
+	poolLimit = bytes;
+	trimLocked(bytes);
+}
+
+size_t BGJSArrayBufferAllocator::getPoolLimit() {
+	std::lock_guard<std::mutex> lock(poolMutex);
+	return poolLimit;
+}
+
+size_t BGJSArrayBufferAllocator::getPooledBytes() {
+	std::lock_guard<std::mutex> lock(poolMutex);
+	return pooledBytes;
+}
+
+void BGJSArrayBufferAllocator::trimPool(size_t bytes) {
+	std::lock_guard<std::mutex> lock(poolMutex);
+	trimLocked(bytes);
+}
@@ -0,0 +1,58 @@
+#ifndef __BGJSARRAYBUFFERALLOCATOR_H
+#define __BGJSARRAYBUFFERALLOCATOR_H	1
+
+#include <v8.h>
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * BGJSArrayBufferAllocator
+ * Backing stores of ArrayBuffers, reused through a pool of size classes that all isolates of the process share
+ *
+ * Buffers between 64 bytes and 4 MB are rounded up to one of four size classes per power of two, so at most a fifth of
+ * a buffer is unused. Freed buffers go back to the pool of their class as long as the pool stays below its limit, so
+ * buffers of the same size that are created every frame are taken from the pool instead of from malloc. Buffers from
+ * the pool are only zeroed up to the length that was asked for, and not at all by AllocateUninitialized.
+ *
+ * Every isolate has its own allocator, which counts the bytes of the buffers it allocated that are still alive. Buffers
+ * transferred to a worker stay counted for the isolate that allocated them.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
+public:
+	struct Stats {
+		size_t liveBytes;		// of the buffers allocated by this allocator that were not freed yet
+		size_t peakBytes;		// most live bytes so far
+		uint64_t allocations;
+		uint64_t poolHits;		// allocations that reused a pooled buffer
+	};
+
+	BGJSArrayBufferAllocator();
+
+	void* Allocate(size_t length) override;
+	void* AllocateUninitialized(size_t length) override;
+	void Free(void* data, size_t length) override;
+
+	Stats getStats() const;
+
+	// bytes that the pool keeps at most, 8 MB by default; 0 turns pooling off
+	static void setPoolLimit(size_t bytes);
+	static size_t getPoolLimit();
+	static size_t getPooledBytes();
+	// frees pooled buffers until at most bytes are left, e.g. under memory pressure
+	static void trimPool(size_t bytes);
+
+private:
+	void* allocate(size_t length, bool zeroed);
+
+	std::atomic<int64_t> _liveBytes;
+	std::atomic<int64_t> _peakBytes;
+	std::atomic<uint64_t> _allocations;
+	std::atomic<uint64_t> _poolHits;
+};
+
+#endif
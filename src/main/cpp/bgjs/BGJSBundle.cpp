@@ -0,0 +1,78 @@
+/**
+ * BGJSBundle
+ * Modules packed into one asset
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSBundle.h"
+#include "os-android.h"
+
+#include <string.h>
+
+#define LOG_TAG "BGJSBundle"
+
+#define BGJS_BUNDLE_MAGIC "BGJSBNDL"
+#define BGJS_BUNDLE_VERSION 1
+
+static uint32_t readUInt32(const uint8_t* data) {
+	return (uint32_t) data[0] | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+std::shared_ptr<BGJSBundle> BGJSBundle::open(AAssetManager* mgr, const char* path) {
+	AAsset* asset = AAssetManager_open(mgr, path, AASSET_MODE_BUFFER);
+	if (!asset) {
+		return nullptr;
+	}
+	std::shared_ptr<BGJSBundle> bundle(new BGJSBundle(asset));
+	const uint8_t* data = (const uint8_t*) AAsset_getBuffer(asset);
+	if (!data || !bundle->readIndex(data, (size_t) AAsset_getLength(asset))) {
+		LOGE("%s is not a valid bundle", path);
+		return nullptr;
+	}
+	LOGI("Opened bundle %s with %zu modules", path, bundle->size());
+	return bundle;
+}
+
+BGJSBundle::~BGJSBundle() {
+	AAsset_close(_asset);
+}
+
+bool BGJSBundle::readIndex(const uint8_t* data, size_t length) {
+	const size_t headerLength = sizeof(BGJS_BUNDLE_MAGIC) - 1 + 8;
+	if (length < headerLength || memcmp(data, BGJS_BUNDLE_MAGIC, sizeof(BGJS_BUNDLE_MAGIC) - 1) != 0 ||
+			readUInt32(data + 8) != BGJS_BUNDLE_VERSION) {
+		return false;
+	}
+	const size_t count = readUInt32(data + 12);
+	if (count > (length - headerLength) / 24) {
+		return false;
+	}
+
+	_modules.reserve(count);
+	for (size_t i = 0; i < count; i++) {
+		const uint8_t* entry = data + headerLength + i * 24;
+		uint32_t fields[6];
+		for (int j = 0; j < 6; j++) {
+			fields[j] = readUInt32(entry + j * 4);
+		}
+		// every range has to lie within the file
+		for (int j = 0; j < 6; j += 2) {
+			if (fields[j] > length || fields[j + 1] > length - fields[j]) {
+				return false;
+			}
+		}
+		Module module;
+		module.source = (const char*) data + fields[2];
+		module.length = fields[3];
+		module.codeCache = fields[5] ? data + fields[4] : nullptr;
+		module.codeCacheLength = fields[5];
+		_modules[std::string((const char*) data + fields[0], fields[1])] = module;
+	}
+	return true;
+}
+
+const BGJSBundle::Module* BGJSBundle::find(const std::string& path) const {
+	auto it = _modules.find(path);
+	return it != _modules.end() ? &it->second : nullptr;
+}
@@ -0,0 +1,54 @@
+#ifndef __BGJSBUNDLE_H
+#define __BGJSBUNDLE_H	1
+
+#include <android/asset_manager.h>
+
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+
+/**
+ * BGJSBundle
+ * Modules packed into one asset, so require() needs no asset of its own for them
+ *
+ * The asset should be stored uncompressed; then the sources and code caches of all modules are read right out of the
+ * mapped apk. Modules are only compiled when they are first required. Bundles are made by makeBundle.js.
+ *
+ * Layout, all numbers are 32 bit little endian and all offsets are from the start of the file:
+ *   "BGJSBNDL", version, number of modules
+ *   per module: offset and length of its path, of its source and of its code cache; the length is 0 if it has none
+ *   the paths, sources and code caches
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSBundle {
+public:
+	struct Module {
+		const char* source;
+		size_t length;
+		const uint8_t* codeCache;		// NULL if the module has none
+		size_t codeCacheLength;
+	};
+
+	// NULL if there is no bundle at path or it is malformed
+	static std::shared_ptr<BGJSBundle> open(AAssetManager* mgr, const char* path);
+	~BGJSBundle();
+
+	// module at path, as require() resolves it; NULL if the bundle does not contain it
+	const Module* find(const std::string& path) const;
+	size_t size() const { return _modules.size(); }
+
+private:
+	BGJSBundle(AAsset* asset) : _asset(asset) {}
+	BGJSBundle(const BGJSBundle&) = delete;
+	BGJSBundle& operator=(const BGJSBundle&) = delete;
+
+	bool readIndex(const uint8_t* data, size_t length);
+
+	AAsset* _asset;
+	std::unordered_map<std::string, Module> _modules;
+};
+
+#endif
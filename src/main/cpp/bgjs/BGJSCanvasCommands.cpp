@@ -0,0 +1,190 @@
+/**
+ * BGJSCanvasCommands
+ * Display lists of 2d contexts
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSCanvasCommands.h"
+#include "BGJSCanvasContext.h"
+
+#include <math.h>
+
+const BGJSCanvasCommandInfo kBGJSCanvasCommands[kBGJSCommandCount] = {
+	{ "beginPath", 0 },
+	{ "closePath", 0 },
+	{ "moveTo", 2 },
+	{ "lineTo", 2 },
+	{ "bezierCurveTo", 6 },
+	{ "quadraticCurveTo", 4 },
+	{ "arcTo", 5 },
+	{ "arc", 6 },
+	{ "rect", 4 },
+	{ "fill", 1 },
+	{ "stroke", 0 },
+	{ "fillRect", 4 },
+	{ "strokeRect", 4 },
+	{ "clearRect", 4 },
+	{ "save", 0 },
+	{ "restore", 0 },
+	{ "translate", 2 },
+	{ "scale", 2 },
+	{ "rotate", 1 },
+	{ "transform", 6 },
+	{ "setTransform", 6 },
+	{ "lineWidth", 1 },
+	{ "globalAlpha", 1 },
+	{ "fillColor", 4 },
+	{ "strokeColor", 4 },
+	{ "clipRect", 4 },
+	{ "clip", 1 },
+	{ "fillRects", 1 },		// and 4 more for every rect
+	{ "globalCompositeOperation", 1 },
+	{ "lineCap", 1 },
+	{ "lineJoin", 1 },
+	{ "miterLimit", 1 },
+	{ "shadowColor", 4 },
+	{ "shadowBlur", 1 },
+	{ "shadowOffset", 2 },
+};
+
+static EJColorRGBA colorFromOperands(const float* op) {
+	EJColorRGBA color;
+	for (int i = 0; i < 4; i++) {
+		const float value = i < 3 ? op[i] : op[i] * 255.0f;
+		color.components[i] = (unsigned char)(value <= 0 ? 0 : (value >= 255 ? 255 : value + 0.5f));
+	}
+	return color;
+}
+
+// operands that pick one of values names, as 0, 1, ...
+static bool isEnumOperand(float op, int values) {
+	return op >= 0 && op < values && (float)(int)op == op;
+}
+
+size_t BGJSRunCanvasCommands(BGJSCanvasContext* context, const float* commands, size_t count, const char** error) {
+	*error = NULL;
+	for (size_t i = 0; i < count; ) {
+		const size_t start = i;
+		const int opcode = (int)commands[i];
+		if (opcode < 0 || opcode >= kBGJSCommandCount || (float)opcode != commands[i]) {
+			*error = "submit: unknown command";
+			return start;
+		}
+		if (i + 1 + kBGJSCanvasCommands[opcode].operands > count) {
+			*error = "submit: command is missing operands";
+			return start;
+		}
+		const float* op = commands + i + 1;
+		i += 1 + kBGJSCanvasCommands[opcode].operands;
+
+		switch (opcode) {
+			case kBGJSCommandFillRects: {
+				const int rects = (int)op[0];
+				if (rects < 0 || i + 4 * (size_t)rects > count) {
+					*error = "submit: command is missing operands";
+					return start;
+				}
+				i += 4 * (size_t)rects;
+				break;
+			}
+			case kBGJSCommandGlobalCompositeOperation:
+			case kBGJSCommandLineCap:
+			case kBGJSCommandLineJoin:
+				if (!isEnumOperand(op[0], opcode == kBGJSCommandGlobalCompositeOperation ? kEJCompositeOperationXOR + 1 : 3)) {
+					*error = "submit: operand out of range";
+					return start;
+				}
+				break;
+		}
+		if (!context) {
+			continue;
+		}
+
+		switch (opcode) {
+			case kBGJSCommandBeginPath: context->beginPath(); break;
+			case kBGJSCommandClosePath: context->closePath(); break;
+			case kBGJSCommandMoveTo: context->moveToX(op[0], op[1]); break;
+			case kBGJSCommandLineTo: context->lineToX(op[0], op[1]); break;
+			case kBGJSCommandBezierCurveTo: context->bezierCurveToCpx1(op[0], op[1], op[2], op[3], op[4], op[5]); break;
+			case kBGJSCommandQuadraticCurveTo: context->quadraticCurveToCpx(op[0], op[1], op[2], op[3]); break;
+			case kBGJSCommandArcTo: context->arcToX1(op[0], op[1], op[2], op[3], op[4]); break;
+			case kBGJSCommandArc: context->arcX(op[0], op[1], op[2], op[3], op[4], op[5] != 0); break;
+			case kBGJSCommandRect: context->rectX(op[0], op[1], op[2], op[3]); break;
+			case kBGJSCommandFill: context->fill(op[0] != 0 ? kEJFillRuleNonZero : kEJFillRuleEvenOdd); break;
+			case kBGJSCommandStroke: context->stroke(); break;
+			case kBGJSCommandFillRect: context->fillRectX(op[0], op[1], op[2], op[3]); break;
+			case kBGJSCommandStrokeRect: context->strokeRectX(op[0], op[1], op[2], op[3]); break;
+			case kBGJSCommandClearRect: context->clearRectX(op[0], op[1], op[2], op[3]); break;
+			case kBGJSCommandSave: context->save(); break;
+			case kBGJSCommandRestore: context->restore(); break;
+			case kBGJSCommandTranslate: context->translateX(op[0], op[1]); break;
+			case kBGJSCommandScale: context->scaleX(op[0], op[1]); break;
+			case kBGJSCommandRotate: context->rotate(op[0]); break;
+			case kBGJSCommandTransform: context->transformM11(op[0], op[1], op[2], op[3], op[4], op[5]); break;
+			case kBGJSCommandSetTransform: context->setTransformM11(op[0], op[1], op[2], op[3], op[4], op[5]); break;
+			case kBGJSCommandLineWidth:
+				if (BGJSIsCanvasLineWidth(op[0])) {
+					context->state->lineWidth = op[0];
+				}
+				break;
+			case kBGJSCommandGlobalAlpha:
+				if (BGJSIsCanvasGlobalAlpha(op[0])) {
+					context->state->globalAlpha = op[0];
+				}
+				break;
+			case kBGJSCommandFillColor:
+				context->state->fillColor = colorFromOperands(op);
+				context->setFillPaint(NULL);
+				break;
+			case kBGJSCommandStrokeColor:
+				context->state->strokeColor = colorFromOperands(op);
+				context->setStrokePaint(NULL);
+				break;
+			case kBGJSCommandClipRect: {
+				CGRect rect;
+				rect.origin.x = op[0];
+				rect.origin.y = op[1];
+				rect.size.width = op[2];
+				rect.size.height = op[3];
+				context->clipRect(rect);
+				break;
+			}
+			case kBGJSCommandFillRects: context->fillRects(op + 1, (int)op[0]); break;
+			case kBGJSCommandClip: context->clip(op[0] != 0 ? kEJFillRuleNonZero : kEJFillRuleEvenOdd); break;
+			case kBGJSCommandGlobalCompositeOperation:
+				context->setGlobalCompositeOperation((EJCompositeOperation)(int)op[0]);
+				break;
+			case kBGJSCommandLineCap: context->state->lineCap = (EJLineCap)(int)op[0]; break;
+			case kBGJSCommandLineJoin: context->state->lineJoin = (EJLineJoin)(int)op[0]; break;
+			case kBGJSCommandMiterLimit:
+				if (BGJSIsCanvasLineWidth(op[0])) {
+					context->state->miterLimit = op[0];
+				}
+				break;
+			case kBGJSCommandShadowColor: context->state->shadowColor = colorFromOperands(op); break;
+			// like the properties, these ignore values that are not finite, and negative blurs
+			case kBGJSCommandShadowBlur:
+				if (op[0] >= 0 && isfinite(op[0])) {
+					context->state->shadowBlur = op[0];
+				}
+				break;
+			case kBGJSCommandShadowOffset:
+				if (isfinite(op[0]) && isfinite(op[1])) {
+					context->state->shadowOffsetX = op[0];
+					context->state->shadowOffsetY = op[1];
+				}
+				break;
+		}
+	}
+	return count;
+}
+
+bool BGJSIsCanvasLineWidth(double value) {
+	return value > 0 && isfinite(value);
+}
+
+bool BGJSIsCanvasGlobalAlpha(double value) {
+	// NaN fails both comparisons
+	return value >= 0 && value <= 1;
+}
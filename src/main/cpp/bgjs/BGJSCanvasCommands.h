@@ -0,0 +1,83 @@
+#ifndef __BGJSCANVASCOMMANDS_H
+#define __BGJSCANVASCOMMANDS_H	1
+
+#include <stddef.h>
+
+class BGJSCanvasContext;
+
+/**
+ * BGJSCanvasCommands
+ * Display lists of 2d contexts
+ *
+ * Calls into the context are expensive when they are made one by one, because every call takes the locker, opens a
+ * handle scope and converts its arguments. submit(buffer, count) executes a whole Float32Array of commands instead:
+ * every command is its opcode followed by its operands. The opcodes are exported as commands by name.
+ * fillRects is the only command with a variable number of operands.
+ * Contexts record the commands they draw in the same format between startRecording() and stopRecording(), so
+ * screens can be captured and replayed with submit, and pipelined views replay the frames that their scripts
+ * recorded this way on the js thread.
+ *
+ * Licensed under the MIT license.
+ */
+
+enum BGJSCanvasCommand {
+	kBGJSCommandBeginPath,
+	kBGJSCommandClosePath,
+	kBGJSCommandMoveTo,				// x, y
+	kBGJSCommandLineTo,				// x, y
+	kBGJSCommandBezierCurveTo,		// cp1x, cp1y, cp2x, cp2y, x, y
+	kBGJSCommandQuadraticCurveTo,	// cpx, cpy, x, y
+	kBGJSCommandArcTo,				// x1, y1, x2, y2, radius
+	kBGJSCommandArc,				// x, y, radius, startAngle, endAngle, anticlockwise (0 or 1)
+	kBGJSCommandRect,				// x, y, w, h
+	kBGJSCommandFill,				// fill rule: 0 for evenodd, 1 for nonzero
+	kBGJSCommandStroke,
+	kBGJSCommandFillRect,			// x, y, w, h
+	kBGJSCommandStrokeRect,			// x, y, w, h
+	kBGJSCommandClearRect,			// x, y, w, h
+	kBGJSCommandSave,
+	kBGJSCommandRestore,
+	kBGJSCommandTranslate,			// x, y
+	kBGJSCommandScale,				// x, y
+	kBGJSCommandRotate,				// angle
+	kBGJSCommandTransform,			// m11, m12, m21, m22, dx, dy
+	kBGJSCommandSetTransform,		// m11, m12, m21, m22, dx, dy
+	kBGJSCommandLineWidth,			// width
+	kBGJSCommandGlobalAlpha,		// alpha
+	kBGJSCommandFillColor,			// r, g, b in 0..255, a in 0..1
+	kBGJSCommandStrokeColor,		// r, g, b in 0..255, a in 0..1
+	kBGJSCommandClipRect,			// x, y, w, h
+	kBGJSCommandClip,				// fill rule, 0 for even-odd and 1 for nonzero
+	kBGJSCommandFillRects,			// n, followed by x, y, w, h of n rects
+	kBGJSCommandGlobalCompositeOperation,	// operation, in the order of EJCompositeOperation
+	kBGJSCommandLineCap,			// 0 for butt, 1 for round, 2 for square
+	kBGJSCommandLineJoin,			// 0 for miter, 1 for bevel, 2 for round
+	kBGJSCommandMiterLimit,			// limit
+	kBGJSCommandShadowColor,		// r, g, b in 0..255, a in 0..1
+	kBGJSCommandShadowBlur,			// blur
+	kBGJSCommandShadowOffset,		// x, y
+	kBGJSCommandCount
+};
+
+struct BGJSCanvasCommandInfo {
+	const char* name;
+	int operands;
+};
+
+extern const BGJSCanvasCommandInfo kBGJSCanvasCommands[kBGJSCommandCount];
+
+/**
+ * runs the commands in the count floats of commands on context, or only checks them if context is null
+ * returns the number of floats of the commands that were run; if that is less than count, error says why the command
+ * after them was not
+ */
+size_t BGJSRunCanvasCommands(BGJSCanvasContext* context, const float* commands, size_t count, const char** error);
+
+/**
+ * whether a value is one the lineWidth and miterLimit, or the globalAlpha property accepts; the properties and the
+ * commands ignore all others, like browsers do
+ */
+bool BGJSIsCanvasLineWidth(double value);
+bool BGJSIsCanvasGlobalAlpha(double value);
+
+#endif
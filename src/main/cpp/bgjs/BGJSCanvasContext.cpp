@@ -1,11 +1,14 @@
 #include "BGJSCanvasContext.h"
 
 #include "BGJSV8Engine.h"
+#include "BGJSGLView.h"
 
 #include "mallocdebug.h"
 #include "v8.h"
 
 #include "../ejecta/EJCanvas/GLcompat.h"
+#include "../ejecta/EJCanvas/EJGLBackend.h"
+#include "../ejecta/EJCanvas/EJGLState.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -13,8 +16,6 @@
 
 #define LOG_TAG "BGJSCanvasContext"
 
-// #define DEBUG_GL 	1
-#undef DEBUG_GL
 // #define DEBUG 1
 #undef DEBUG
 
@@ -29,29 +30,30 @@ using namespace v8;
  */
 
 
-static void checkGlError(const char* op) {
-#ifdef DEBUG_GL
-	for (GLint error = glGetError(); error; error = glGetError()) {
-		LOGI("after %s() glError (0x%x)\n", op, error);
-	}
-#endif
-}
-
 
-BGJSCanvasContext::BGJSCanvasContext(int width, int height) : EJCanvasContext(width, height) {
+BGJSCanvasContext::BGJSCanvasContext(int width, int height, EJCanvasResources *resources) :
+		EJCanvasContext(width, height, resources) {
 	// allocate renderbuffer storage
 	// glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, viewRenderBuffer);
 
 	stencilBuffer = 0;
-
-	glDisable(GL_CULL_FACE);
-	glDisable(GL_DEPTH_TEST);
-	glDisable(GL_LIGHTING);
-	glDisable(GL_DITHER);
+	_hasDamage = false;
+
+	EJGLState::disable(GL_CULL_FACE);
+	EJGLState::disable(GL_DEPTH_TEST);
+	// dithering hides the banding of gradients on 16 bit surfaces, and costs nothing on the others
+	GLint redBits = 8;
+	glGetIntegerv(GL_RED_BITS, &redBits);
+	if (redBits < 8) {
+		EJGLState::enable(GL_DITHER);
+	} else {
+		EJGLState::disable(GL_DITHER);
+	}
 	bzero(stateStack2, sizeof(stateStack2));
+	state2 = &stateStack2[0];
 
-	glEnable(GL_BLEND);
-	checkGlError("glEnable GL_BLEND");
+	EJGLState::enable(GL_BLEND);
+	EJ_CHECK_GL_ERROR("glEnable GL_BLEND");
 
 	EJCanvasContext::prepare();
 	// setFont("arial", 20);
@@ -66,12 +68,14 @@ void BGJSCanvasContext::save() {
 }
 
 void BGJSCanvasContext::restore() {
+	const BGJSCanvasState old = *state2;
 	EJCanvasContext::restore();
 	state2 = &stateStack2[stateIndex];
-	if (!state2->clip) {
-		glDisable(GL_SCISSOR_TEST);
-	} else {
-		clipRect(state2->clipRect);
+
+	// restoring the scissor that is already there does not flush, so rows of a list can be clipped cheaply
+	if (old.clip != state2->clip || (old.clip && !BGJSPixelRectEqual(old.scissor, state2->scissor))) {
+		flushBuffers();
+		applyScissor();
 	}
 }
 
@@ -87,31 +91,101 @@ void BGJSCanvasContext::clipY (float y, float y2) {
 }
 
 void BGJSCanvasContext::clipRect(CGRect rect) {
+	const CGAffineTransform &t = state->transform;
+	const float x = rect.origin.x, y = rect.origin.y, x2 = x + rect.size.width, y2 = y + rect.size.height;
+	const EJVector2 corners[4] = {
+		EJVector2ApplyTransform(EJVector2Make(x, y), t),
+		EJVector2ApplyTransform(EJVector2Make(x2, y), t),
+		EJVector2ApplyTransform(EJVector2Make(x2, y2), t),
+		EJVector2ApplyTransform(EJVector2Make(x, y2), t)
+	};
+
+	// rotated or skewed rects are not axis aligned any more, so they go to the stencil like paths
+	if ((t.b != 0 || t.c != 0) && (t.a != 0 || t.d != 0)) {
+		EJCanvasClip clip;
+		const int order[6] = { 0, 1, 2, 0, 2, 3 };
+		for (int i = 0; i < 6; i++) {
+			clip.triangles.push_back(corners[order[i]]);
+		}
+		pushClip(clip);
+		return;
+	}
+
+	float minX = corners[0].x, minY = corners[0].y, maxX = corners[0].x, maxY = corners[0].y;
+	for (int i = 1; i < 4; i++) {
+		minX = std::min(minX, corners[i].x);
+		minY = std::min(minY, corners[i].y);
+		maxX = std::max(maxX, corners[i].x);
+		maxY = std::max(maxY, corners[i].y);
+	}
+
+	// opengl (0,0) is bottom left, canvas (0,0) is top left; pixels are inside if their center is
+	const int left = (int)floorf(minX + 0.5f), right = (int)floorf(maxX + 0.5f);
+	const int bottom = viewportHeight - (int)floorf(maxY + 0.5f), top = viewportHeight - (int)floorf(minY + 0.5f);
+	BGJSPixelRect scissor = { left, bottom, std::max(0, right - left), std::max(0, top - bottom) };
+	if (state2->clip) {
+		scissor = BGJSPixelRectIntersection(state2->scissor, scissor);
+		if (BGJSPixelRectEqual(scissor, state2->scissor)) {
+			return;
+		}
+	}
 
 	flushBuffers();
+	state2->scissor = scissor;
+	state2->clip = true;
+	applyScissor();
+}
 
-	float x, y, x2, y2;
-
-    state2->clipRect = rect;
-    state2->clip = true;
-    
-    // this code will obviously NOT work if the transform includes rotation
-    // but it WILL work with translation; charting does not rotate clipping regions,
-    // and we would not be able to use the scissor test for that anyway so thats fine for now
-    
-    // opengl (0,0) is bottom left, canvas (0,0) is top left
-    // => invert y
-    y = viewportHeight - EJVector2ApplyTransform( EJVector2Make(0, rect.origin.y), state->transform).y; // *backingStoreRatio;
-    y2 = viewportHeight - EJVector2ApplyTransform( EJVector2Make(0, rect.origin.y+rect.size.height), state->transform).y; // *backingStoreRatio;
-    
-    x =  EJVector2ApplyTransform( EJVector2Make(rect.origin.x, 0), state->transform).x; // *backingStoreRatio;
-    x2 = EJVector2ApplyTransform( EJVector2Make(rect.origin.x + rect.size.width, 0), state->transform).x; // *backingStoreRatio;
-    
-    glEnable(GL_SCISSOR_TEST);
-    glScissor(x,y2,x2-x,y-y2);
-    checkGlError("glScissor clipRect");
+void BGJSCanvasContext::applyScissor (bool withClipRect) {
+	const bool clip = withClipRect && state2->clip;
+	if (!clip && !_hasDamage) {
+		EJGLState::disable(GL_SCISSOR_TEST);
+		return;
+	}
+
+	BGJSPixelRect rect = clip ? state2->scissor : _damage;
+	if (clip && _hasDamage) {
+		rect = BGJSPixelRectIntersection(rect, _damage);
+	}
+	EJGLState::enable(GL_SCISSOR_TEST);
+	EJGLState::scissor(rect.x, rect.y, rect.width, rect.height);
+	EJ_CHECK_GL_ERROR("glScissor applyScissor");
 }
 
+void BGJSCanvasContext::setDamage(const BGJSPixelRect &rect) {
+	_damage = rect;
+	_hasDamage = true;
+}
+
+void BGJSCanvasContext::beginFrame() {
+	// the damage of the frame is final now
+	if (view) {
+		view->onBeginFrame();
+	}
+
+	// the stencil is cleared within all of the damage, and the path clips that are left from the last frame drawn again
+	applyScissor(false);
+	EJGLState::stencilMask(0xff);
+	glClear(GL_STENCIL_BUFFER_BIT);
+	EJ_CHECK_GL_ERROR("glClear(beginFrame)");
+	redrawClips();
+	applyScissor();
+}
+
+
+void BGJSCanvasContext::activate() {
+	backend->resetState();
+	restoreTarget();
+	EJ_CHECK_GL_ERROR("activate");
+}
+
+void BGJSCanvasContext::restoreTarget() {
+	backend->bindFramebuffer(framebuffer());
+	glViewport(0, 0, viewportWidth, viewportHeight);
+	backend->setProjection(width, height, true);
+	applyScissor();
+	applyClipStencil();
+}
 
 void BGJSCanvasContext::resize (int widthp, int heightp) {
 
@@ -125,54 +199,23 @@ void BGJSCanvasContext::resize (int widthp, int heightp) {
 		LOGD("resize to %dx%d, buffer %dx%d", viewportWidth, viewportHeight, bufferWidth, bufferHeight);
 	#endif
 
-	// reallocate color buffer backing based on the current layer size
-#ifndef SIMPLE_STENCIL
-    // glBindRenderbufferOES(COMPAT_GL_RENDERBUFFER, viewRenderBuffer);
-    // [glContext renderbufferStorage:GL_RENDERBUFFER fromDrawable:layer];
-
-	// reallocate msaa buffer backing
-	if(msaaEnabled) {
-		glBindRenderbufferOES(COMPAT_GL_RENDERBUFFER, msaaRenderBuffer);
-		checkGlError("glBindRenderBufferOES(resize)");
-		// glRenderbufferStorageMultisampleAPPLE(GL_RENDERBUFFER, msaaSamples, GL_RGBA8_OES, bufferWidth, bufferHeight);
-	}
-#endif
+	// the color buffer, multisampled or not, belongs to the window surface and is resized by egl
 	prepare();
 
-#ifndef SIMPLE_STENCIL
-	// recreate stencil buffer
-	if(stencilBuffer) {
-		LOGD("Deleting stencil buffer %u", stencilBuffer);
-		glDeleteRenderbuffersOES(1, &stencilBuffer);
-		checkGlError("glDeleteRenderbuffersOES(resize)");
-		stencilBuffer = 0;
-		createStencilBufferOnce();
-	}
-#endif
-
     glClear(GL_COLOR_BUFFER_BIT);
-    checkGlError("glClear(resize)");
+    EJ_CHECK_GL_ERROR("glClear(resize)");
 
-	glTranslatef(0, heightp, 0);
-	glScalef( 1, -1, 1 );
+	backend->setProjection(width, height, true);
 }
 
 void BGJSCanvasContext::startRendering() {
 
-	//------------------------------
-	// bind framebuffer
-	//------------------------------
-#ifndef SIMPLE_STENCIL
-	// glBindFramebufferOES(GL_FRAMEBUFFER_OES, msaaEnabled?msaaFrameBuffer:viewFrameBuffer);
-#endif
-
-
-	glStencilMask(0xff);
-	glClear(GL_STENCIL_BUFFER_BIT);
-	// glClear(GL_STENCIL_BUFFER_BIT|GL_COLOR_BUFFER_BIT);
-	checkGlError("glClear(startRendering)");
+	// the stencil is cleared with the first draw call, once the damage of the frame is known
+	_hasDamage = false;
+	frameBegun = false;
 
 	_isRendering = YES;
+	resetFrameArena();
 
 	setState();
 }
@@ -181,38 +224,8 @@ void BGJSCanvasContext::endRendering() {
 	_isRendering = NO;
 
 	flushBuffers();
+	_hasDamage = false;
+	applyScissor();
 
-#ifndef SIMPLE_STENCIL
-	//------------------------------
-	// resolve MSAA
-	//------------------------------
-	if(msaaEnabled) {
-		// Apple (and the khronos group) encourages you to discard depth // render buffer contents whenever is possible
-		/* GLenum attachments[] = {GL_DEPTH_ATTACHMENT_OES,GL_STENCIL_ATTACHMENT_OES};
-		glDiscardFramebufferEXT(COMPAT_GL_FRAMEBUFFER, 2, attachments);
-		//Bind both MSAA and View FrameBuffers.
-		glBindFramebufferOES(GL_READ_FRAMEBUFFER_APPLE, msaaFrameBuffer);
-		glBindFramebufferOES(GL_DRAW_FRAMEBUFFER_APPLE, viewFrameBuffer);
-		// Call a resolve to combine both buffers
-		glResolveMultisampleFramebufferAPPLE();
-
-		glBindRenderbufferOES(GL_RENDERBUFFER_OES, viewRenderBuffer);
-
-	//------------------------------
-	// discard unneeded buffers
-	//------------------------------
-		const GLenum discards[]  = {GL_STENCIL_ATTACHMENT_OES};
-		glBindFramebuffer(GL_FRAMEBUFFER, msaaFrameBuffer);
-		glDiscardFramebufferEXT(GL_FRAMEBUFFER,2,discards); */
-	} else {
-		const GLenum discards[]  = {GL_STENCIL_ATTACHMENT_OES};
-		// COMPAT_glBindFramebuffer(COMPAT_GL_FRAMEBUFFER, viewFrameBuffer);
-		// TODO: Can we do this somehow?
-		// glDiscardFramebufferEXT(COMPAT_GL_FRAMEBUFFER,1,discards);
-	}
-#endif
-	//------------------------------
-	// Present final image to screen
-	//------------------------------
-	// [glContext presentRenderbuffer:GL_RENDERBUFFER_OES];
+	// a multisampled window surface is resolved by eglSwapBuffers, there is no resolve framebuffer to blit to
 }
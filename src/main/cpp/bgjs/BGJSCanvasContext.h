@@ -1,11 +1,11 @@
 #ifndef __BGJSCANVASCONTEXT_H
 #define __BGJSCANVASCONTEXT_H	1
 
-#define MSAA_SAMPLES 2
-
 #include "../ejecta/EJCanvas/EJCanvasContext.h"
 #include "../ejecta/EJCanvas/CGCompat.h"
 
+#include <algorithm>
+
 /**
  * BGJSCanvasContext
  * Manages a JS Canvas object and its OpenGL state. Loosely based on EJCanvasContext
@@ -14,26 +14,82 @@
  * Licensed under the MIT license.
  */
 
+// rect of framebuffer pixels, with the origin in the bottom left corner like gl and egl
+typedef struct {
+	int x, y, width, height;
+} BGJSPixelRect;
+
+static inline BGJSPixelRect BGJSPixelRectUnion (const BGJSPixelRect &a, const BGJSPixelRect &b) {
+	const int x = std::min(a.x, b.x), y = std::min(a.y, b.y);
+	const BGJSPixelRect rect = { x, y, std::max(a.x + a.width, b.x + b.width) - x, std::max(a.y + a.height, b.y + b.height) - y };
+	return rect;
+}
+
+static inline BGJSPixelRect BGJSPixelRectIntersection (const BGJSPixelRect &a, const BGJSPixelRect &b) {
+	const int x = std::max(a.x, b.x), y = std::max(a.y, b.y);
+	const BGJSPixelRect rect = { x, y, std::max(0, std::min(a.x + a.width, b.x + b.width) - x),
+			std::max(0, std::min(a.y + a.height, b.y + b.height) - y) };
+	return rect;
+}
+
+static inline bool BGJSPixelRectEqual (const BGJSPixelRect &a, const BGJSPixelRect &b) {
+	return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+// axis aligned clip rects of a state, intersected in framebuffer pixels; other clips are path clips of EJCanvasState
 typedef struct {
-	CGRect clipRect;
+	BGJSPixelRect scissor;
 	bool clip;
 } BGJSCanvasState;
 
+class BGJSGLView;
+
 class BGJSCanvasContext : public EJCanvasContext {
 	BGJSCanvasState stateStack2[EJ_CANVAS_STATE_STACK_SIZE];
 	BGJSCanvasState * state2;
 
+	BGJSPixelRect _damage;
+	bool _hasDamage;
+
+protected:
+	// scissors draw calls to the clip rect of the state and the damage of the frame
+	void applyScissor (bool withClipRect = true);
+	void beginFrame();
+
+	// framebuffer the context draws into; 0 is the window surface
+	virtual GLuint framebuffer() { return 0; }
+	void restoreTarget();
+
 public:
-	BGJSCanvasContext(int width, int height);
+	BGJSCanvasContext(int width, int height, EJCanvasResources *resources = NULL);
 	void resize(int width, int height);
 	void save();
 	void restore();
 	void clipY (float y, float y2);
+	// scissors to rects that stay axis aligned under the transform, and clips to others like to a path
 	void clipRect (CGRect rect);
+	// the window surface and offscreen framebuffers come with a stencil buffer
+	void createStencilBufferOnce() {}
 	void startRendering();
 	void endRendering();
 
+	/**
+	 * contexts of a view share its gl context; this restores the gl state of this one
+	 * after another context drew. The previous context has to be flushed first
+	 */
+	virtual void activate();
+
+	/**
+	 * limits drawing to rect until the end of the frame; drawing outside of it keeps the pixels that are there
+	 * has to be set before the first draw call of the frame
+	 */
+	void setDamage (const BGJSPixelRect &rect);
+	// true once anything was drawn in the frame, also if it still waits in a batch; the damage applies to all of it
+	bool hasDrawnInFrame() const { return frameBegun || hasPendingDraws(); }
+
 	bool _isRendering;
+	// told when the first draw call of a frame is made
+	BGJSGLView *view = nullptr;
 };
 
 #endif
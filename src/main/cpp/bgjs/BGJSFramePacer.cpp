@@ -0,0 +1,96 @@
+/**
+ * BGJSFramePacer
+ * Keeps the frames of a view that the gpu has not finished yet to a few, with EGL_KHR_fence_sync
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSFramePacer.h"
+
+#include <string.h>
+#include <time.h>
+
+namespace {
+
+// a gpu that takes longer than this for a frame is given up on, so it does not hang the render thread as well
+const EGLTimeKHR kWaitTimeout = 100 * 1000000ull;
+
+int64_t now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+}
+
+BGJSFramePacer* BGJSFramePacer::create() {
+	EGLDisplay display = eglGetCurrentDisplay();
+	const char* extensions = display != EGL_NO_DISPLAY ? eglQueryString(display, EGL_EXTENSIONS) : nullptr;
+	if (!extensions || !strstr(extensions, "EGL_KHR_fence_sync")) {
+		return nullptr;
+	}
+
+	BGJSFramePacer* pacer = new BGJSFramePacer();
+	pacer->_display = display;
+	pacer->_createSync = (PFNEGLCREATESYNCKHRPROC)eglGetProcAddress("eglCreateSyncKHR");
+	pacer->_destroySync = (PFNEGLDESTROYSYNCKHRPROC)eglGetProcAddress("eglDestroySyncKHR");
+	pacer->_clientWaitSync = (PFNEGLCLIENTWAITSYNCKHRPROC)eglGetProcAddress("eglClientWaitSyncKHR");
+	if (!pacer->_createSync || !pacer->_destroySync || !pacer->_clientWaitSync) {
+		delete pacer;
+		return nullptr;
+	}
+	if (strstr(extensions, "EGL_ANDROID_presentation_time")) {
+		pacer->_presentationTime = (EGLBoolean (*)(EGLDisplay, EGLSurface, int64_t))eglGetProcAddress("eglPresentationTimeANDROID");
+	}
+	return pacer;
+}
+
+BGJSFramePacer::~BGJSFramePacer() {
+	for (int i = 0; i < _inFlight; i++) {
+		_destroySync(_display, _fences[(_first + i) % kMaxFramesInFlight]);
+	}
+}
+
+void BGJSFramePacer::setMaxFramesInFlight(int frames) {
+	_maxFramesInFlight = frames < 1 ? 1 : (frames > kMaxFramesInFlight ? kMaxFramesInFlight : frames);
+}
+
+void BGJSFramePacer::beforeSwap(EGLDisplay display, EGLSurface surface, int64_t presentTimeNanos) {
+	// fences signal in the order of the frames
+	while (_inFlight > 0 && finished(false)) {
+	}
+	// the frame that is swapped now takes one of the places
+	while (_inFlight >= _maxFramesInFlight) {
+		finished(true);
+	}
+	_queueDepth = _inFlight;
+
+	if (_presentationTime && presentTimeNanos > 0) {
+		_presentationTime(display, surface, presentTimeNanos);
+	}
+
+	// the swap flushes the fence along with the frame
+	EGLSyncKHR fence = _createSync(display, EGL_SYNC_FENCE_KHR, nullptr);
+	if (fence != EGL_NO_SYNC_KHR) {
+		const int slot = (_first + _inFlight) % kMaxFramesInFlight;
+		_fences[slot] = fence;
+		_swapTimes[slot] = now();
+		_inFlight++;
+	}
+}
+
+bool BGJSFramePacer::finished(bool wait) {
+	const EGLint result = _clientWaitSync(_display, _fences[_first], wait ? EGL_SYNC_FLUSH_COMMANDS_BIT_KHR : 0,
+										  wait ? kWaitTimeout : 0);
+	if (!wait && result == EGL_TIMEOUT_EXPIRED_KHR) {
+		return false;
+	}
+	// a fence that failed or timed out is dropped as well, it tells nothing about the latency
+	if (result == EGL_CONDITION_SATISFIED_KHR) {
+		_presentLatency = now() - _swapTimes[_first];
+	}
+	_destroySync(_display, _fences[_first]);
+	_first = (_first + 1) % kMaxFramesInFlight;
+	_inFlight--;
+	return true;
+}
@@ -0,0 +1,68 @@
+#ifndef __BGJSFRAMEPACER_H
+#define __BGJSFRAMEPACER_H	1
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <stdint.h>
+
+/**
+ * BGJSFramePacer
+ * Keeps the frames of a view that the gpu has not finished yet to a few, with EGL_KHR_fence_sync
+ *
+ * A fence goes behind the draws of every frame. Before the next swap the pacer waits for the oldest fences until fewer
+ * than maxFramesInFlight frames are left on the gpu, so the render thread records the next frame while the last one is
+ * drawn, instead of finding out in eglSwapBuffers that the driver has queued too many. Where
+ * EGL_ANDROID_presentation_time is available, frames are presented no earlier than the vsync they were made for, so
+ * a frame that was quick does not get shown before one that was slow.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSFramePacer {
+public:
+	static const int kMaxFramesInFlight = 3;
+
+	// pacer for the egl display that is current; nullptr if it has no fences
+	static BGJSFramePacer* create();
+	~BGJSFramePacer();
+
+	// frames the gpu may still be drawing while the next one is recorded, at least 1 and at most kMaxFramesInFlight
+	void setMaxFramesInFlight(int frames);
+
+	/**
+	 * called with the draws of a frame issued, right before it is swapped; presentTimeNanos is in CLOCK_MONOTONIC,
+	 * like the frame times of the Choreographer, 0 presents as soon as possible
+	 */
+	void beforeSwap(EGLDisplay display, EGLSurface surface, int64_t presentTimeNanos);
+
+	// frames that were on the gpu when the last one was swapped, that one not included
+	int queueDepth() const { return _queueDepth; }
+	/**
+	 * nanoseconds from the swap of the latest frame the gpu finished until the pacer found out, at a later swap or
+	 * while waiting for it; -1 until one finished
+	 */
+	int64_t presentLatency() const { return _presentLatency; }
+
+private:
+	BGJSFramePacer() {}
+
+	// takes the oldest fence if it signaled, or, with wait, once it did
+	bool finished(bool wait);
+
+	EGLDisplay _display = EGL_NO_DISPLAY;
+	EGLSyncKHR _fences[kMaxFramesInFlight];
+	int64_t _swapTimes[kMaxFramesInFlight];
+	int _first = 0;			// oldest fence in flight
+	int _inFlight = 0;
+	int _maxFramesInFlight = 1;
+	int _queueDepth = 0;
+	int64_t _presentLatency = -1;
+
+	PFNEGLCREATESYNCKHRPROC _createSync = nullptr;
+	PFNEGLDESTROYSYNCKHRPROC _destroySync = nullptr;
+	PFNEGLCLIENTWAITSYNCKHRPROC _clientWaitSync = nullptr;
+	// EGL_ANDROID_presentation_time, null where missing
+	EGLBoolean (*_presentationTime)(EGLDisplay display, EGLSurface surface, int64_t time) = nullptr;
+};
+
+#endif
@@ -8,22 +8,46 @@
 
 #include "BGJSGLView.h"
 #include "BGJSCanvasContext.h"
+#include "BGJSTrace.h"
+#include "BGJSCanvasCommands.h"
 
 #include "GLcompat.h"
+#include "EJGLState.h"
+#include "EJHardwareBuffer.h"
+#include "EJImage.h"
+#include "EJExternalTexture.h"
 
 #include <EGL/egl.h>
+#include <android/bitmap.h>
+#include <dlfcn.h>
 #include <string.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 #include <v8.h>
 
+// from EGL/eglext.h, which not every ndk has all of
+#ifndef EGL_BUFFER_AGE_EXT
+#define EGL_BUFFER_AGE_EXT 0x313D
+#endif
+typedef EGLBoolean (*BGJSSetDamageRegionProc) (EGLDisplay dpy, EGLSurface surface, EGLint *rects, EGLint n_rects);
+typedef EGLBoolean (*BGJSSwapBuffersWithDamageProc) (EGLDisplay dpy, EGLSurface surface, EGLint *rects, EGLint n_rects);
+
+// from android/bitmap.h of api 30
+#ifndef ANDROID_BITMAP_FLAGS_ALPHA_MASK
+#define ANDROID_BITMAP_FLAGS_ALPHA_MASK 0x3
+#define ANDROID_BITMAP_FLAGS_ALPHA_UNPREMUL 0x2
+#endif
+
 #include "os-android.h"
 #include "../jni/JNIWrapper.h"
 
 #undef DEBUG
 // #define DEBUG 1
 //#undef DEBUG
-// #define DEBUG_GL 0
-#undef DEBUG_GL
 #define LOG_TAG "BGJSGLView"
 
 using namespace v8;
@@ -36,27 +60,41 @@ using namespace v8;
  * Licensed under the MIT license.
  */
 
-static void checkGlError(const char* op) {
-#ifdef DEBUG_GL
-	for (GLint error = glGetError(); error; error = glGetError()) {
-		LOGI("after %s() glError (0x%x)\n", op, error);
-	}
-#endif
-}
-
 BGJS_JNI_LINK(BGJSGLView, "ag/boersego/bgjs/BGJSGLView");
 
+JNIMethodHandle<void()> BGJSGLView::_jniRequestRender;
+
 void BGJSGLView::initializeJNIBindings(JNIClassInfo *info, bool isReload) {
     info->registerNativeMethod("prepareRedraw", "()V", (void*)BGJSGLView::prepareRedraw);
     info->registerNativeMethod("endRedraw", "()V", (void*)BGJSGLView::endRedraw);
     info->registerNativeMethod("setTouchPosition", "(II)V", (void*)BGJSGLView::setTouchPosition);
+    info->registerNativeMethod("getTouchRegion", "()Ljava/lang/String;", (void*)BGJSGLView::getTouchRegion);
+    info->registerNativeMethod("setSharesContext", "(Z)V", (void*)BGJSGLView::setSharesContext);
     info->registerNativeMethod("setViewData", "(FZII)V", (void*)BGJSGLView::setViewData);
     info->registerNativeMethod("viewWasResized", "(II)V", (void*)BGJSGLView::viewWasResized);
-    info->registerMethod("requestAnimationFrame", "(Lag/boersego/bgjs/JNIV8Function;)I");
-    info->registerMethod("cancelAnimationFrame", "(I)V");
+    info->registerNativeMethod("runFrameCallbacks", "(JJ)Z", (void*)BGJSGLView::runFrameCallbacks);
+    info->registerNativeMethod("clearFrameCallbacks", "()V", (void*)BGJSGLView::clearFrameCallbacks);
+    info->registerNativeMethod("backBufferCleared", "()V", (void*)BGJSGLView::backBufferCleared);
+    info->registerNativeMethod("setFrameStatsEnabled", "(Z)V", (void*)BGJSGLView::setFrameStatsEnabled);
+    info->registerNativeMethod("getFrameStats", "([J)Z", (void*)BGJSGLView::getFrameStats);
+    info->registerNativeMethod("setMaxFramesInFlight", "(I)V", (void*)BGJSGLView::setMaxFramesInFlight);
+    info->registerNativeMethod("registerBitmap", "(Ljava/lang/String;Landroid/graphics/Bitmap;)Z", (void*)BGJSGLView::registerBitmap);
+    info->registerNativeMethod("registerHardwareBuffer", "(Ljava/lang/String;Landroid/hardware/HardwareBuffer;Z)Z",
+                               (void*)BGJSGLView::registerHardwareBuffer);
+    info->registerNativeMethod("registerSurfaceTexture", "(Ljava/lang/String;III)Z", (void*)BGJSGLView::registerSurfaceTexture);
+    info->registerNativeMethod("updateSurfaceTexture", "(Ljava/lang/String;[F)V", (void*)BGJSGLView::updateSurfaceTexture);
+    info->registerNativeMethod("unregisterImage", "(Ljava/lang/String;)V", (void*)BGJSGLView::unregisterImage);
+    info->registerMethod("requestRender", "()V");
+    _jniRequestRender.resolve(info, "requestRender", "()V");
 }
 
 void BGJSGLView::initializeV8Bindings(JNIV8ClassInfo *info) {
+    info->registerAccessor("frameStart", (JNIV8ObjectAccessorGetterCallback)&BGJSGLView::getFrameStart);
+    info->registerAccessor("frameBudgetLeft", (JNIV8ObjectAccessorGetterCallback)&BGJSGLView::getFrameBudgetLeft);
+    info->registerAccessor("vertexBufferSize", (JNIV8ObjectAccessorGetterCallback)&BGJSGLView::getVertexBufferSize,
+                           (JNIV8ObjectAccessorSetterCallback)&BGJSGLView::setVertexBufferSize);
+    info->registerAccessor("pipelined", (JNIV8ObjectAccessorGetterCallback)&BGJSGLView::getPipelined,
+                           (JNIV8ObjectAccessorSetterCallback)&BGJSGLView::setPipelined);
 }
 
 bool BGJSGLView::isWrappableV8Object(v8::Local<v8::Object> object) {
@@ -68,9 +106,22 @@ void BGJSGLView::viewWasResized(JNIEnv *env, jobject objWrapped, int width, int
 
     self->_width = width;
     self->_height = height;
+    self->_damageHistorySize = 0;
     self->context2d->resize(width, height);
 }
 
+void BGJSGLView::backBufferCleared(JNIEnv *env, jobject objWrapped) {
+    auto self = JNIWrapper::wrapObject<BGJSGLView>(objWrapped);
+
+    self->_damageHistorySize = 0;
+}
+
+void BGJSGLView::setSharesContext(JNIEnv *env, jobject objWrapped, bool doShareContext) {
+    auto self = JNIWrapper::wrapObject<BGJSGLView>(objWrapped);
+
+    self->sharesContext = doShareContext;
+}
+
 void BGJSGLView::setViewData(JNIEnv *env, jobject objWrapped, float pixelRatio, bool doNoClearOnFlip, int width, int height) {
 	auto self = JNIWrapper::wrapObject<BGJSGLView>(objWrapped);
 
@@ -87,20 +138,50 @@ void BGJSGLView::onSetViewData(float pixelRatio, bool doNoClearOnFlip, int width
     const char* eglVersion = eglQueryString(eglGetCurrentDisplay(), EGL_VERSION);
     LOGD("egl version %s", eglVersion);
     // bzero (_frameRequests, sizeof(_frameRequests));
+    queryDamageExtensions();
+    _damageHistorySize = 0;
+    // fences of the old context may never signal for this one
+    delete _framePacer;
+    _framePacer = BGJSFramePacer::create();
+    _swapBehaviorSurface = EGL_NO_SURFACE;
 
-    context2d = new BGJSCanvasContext(width, height);
+    // the context is new, or was made current on this thread again
+    EJGLState::invalidate();
+    EJCanvasResources *resources = sharesContext ? EJCanvasResources::shared(getEngine()) : NULL;
+    context2d = new BGJSCanvasContext(width, height, resources);
+    if (resources) {
+        resources->release();
+    }
+    context2d->view = this;
     context2d->backingStoreRatio = pixelRatio;
+    context2d->setVertexBufferSize(_vertexBufferSize);
 #ifdef DEBUG
     LOGI("pixel Ratio %f", pixelRatio);
 #endif
     context2d->create();
     context2d->resize(width, height);
+    _currentContext = context2d;
+
+    // the samples are chosen with the egl config by V8TextureView.setMultisampling; offscreen canvases follow the view
+    GLint samples = 0;
+    glGetIntegerv(GL_SAMPLES, &samples);
+    context2d->msaaSamples = samples;
+    context2d->msaaEnabled = samples > 1;
 }
 
 BGJSGLView::~BGJSGLView() {
+    delete _gpuTimer;
+    delete _framePacer;
+    for (auto &request : _pixelReadbacks) {
+        delete request.readback;
+    }
+    for (auto context : _offscreenContexts) {
+        delete context;
+    }
 	if (context2d) {
 		delete (context2d);
 	}
+    clearHitRegions();
 }
 
 int BGJSGLView::getWidth() {
@@ -118,7 +199,181 @@ void BGJSGLView::prepareRedraw(JNIEnv *env, jobject objWrapped) {
 }
 
 void BGJSGLView::onPrepareRedraw() {
+    // the gl state may have been changed outside of the canvases since the last frame
+    EJGLState::invalidate();
+
+    // nothing is pending to draw yet, so the textures can go
+    context2d->getResources()->purgeIfRequested();
+
+    for (auto context : _releasedOffscreenContexts) {
+        _offscreenContexts.erase(std::find(_offscreenContexts.begin(), _offscreenContexts.end(), context));
+        delete context;
+    }
+    _releasedOffscreenContexts.clear();
+
+    // canvases resized since the last frame are cleared before anything is drawn into them
+    for (auto context : _offscreenContexts) {
+        if (context->needsResize()) {
+            useContext(context);
+        }
+        context->startRendering();
+    }
+    beginRedraw();
+}
+
+void BGJSGLView::beginRedraw() {
+    useContext(context2d);
+
+    _hasFrameDamage = false;
+    _bufferAge = -1;
     context2d->startRendering();
+
+    if (_frameStatsEnabled) {
+        memset(&_frameStats, 0, sizeof(_frameStats));
+        if (!_gpuTimerQueried) {
+            _gpuTimer = BGJSGpuTimer::create();
+            _gpuTimerQueried = true;
+        }
+        if (_gpuTimer) {
+            _gpuTimer->beginFrame();
+        }
+    }
+    attachFrameStats();
+}
+
+void BGJSGLView::attachFrameStats() {
+    EJFrameStats *stats = _frameStatsEnabled ? &_frameStats : nullptr;
+    context2d->frameStats = stats;
+    for (auto context : _offscreenContexts) {
+        context->frameStats = stats;
+    }
+}
+
+void BGJSGLView::setFrameStatsEnabled(JNIEnv *env, jobject objWrapped, jboolean enabled) {
+    auto self = JNIWrapper::wrapObject<BGJSGLView>(objWrapped);
+
+    // the timer is made with the first frame that is measured, and kept; its queries are cheap while unused
+    self->_frameStatsEnabled = enabled;
+    memset(&self->_lastFrameStats, 0, sizeof(self->_lastFrameStats));
+    self->_lastFrameStats.gpuTime = self->_lastGpuTime = -1;
+    self->_lastFrameStats.presentLatency = -1;
+}
+
+jboolean BGJSGLView::getFrameStats(JNIEnv *env, jobject objWrapped, jlongArray stats) {
+    auto self = JNIWrapper::wrapObject<BGJSGLView>(objWrapped);
+
+    const EJFrameStats *last = self->lastFrameStats();
+    const jsize length = env->GetArrayLength(stats);
+    if (!last || length < 6) {
+        return JNI_FALSE;
+    }
+    // arrays of callers that predate the pacing values only get the first six
+    const jlong values[8] = { last->drawCalls, last->vertices, last->textureBinds, last->stencilPasses, last->flushes,
+                              last->gpuTime, last->queueDepth, last->presentLatency };
+    env->SetLongArrayRegion(stats, 0, std::min<jsize>(length, 8), values);
+    return JNI_TRUE;
+}
+
+void BGJSGLView::setMaxFramesInFlight(JNIEnv *env, jobject objWrapped, jint frames) {
+    auto self = JNIWrapper::wrapObject<BGJSGLView>(objWrapped);
+
+    self->_maxFramesInFlight = std::max(1, std::min((int)frames, BGJSFramePacer::kMaxFramesInFlight));
+}
+
+void BGJSGLView::useContext(BGJSCanvasContext *context) {
+    if (context == _currentContext) {
+        return;
+    }
+    if (_currentContext && _currentContext->hasPendingDraws()) {
+        _currentContext->flushBuffers();
+    }
+    _currentContext = context;
+    context->activate();
+}
+
+BGJSOffscreenCanvasContext* BGJSGLView::createOffscreenContext(int width, int height) {
+    // creating the context changes the gl state, so it is restored on the next draw call
+    if (_currentContext && _currentContext->hasPendingDraws()) {
+        _currentContext->flushBuffers();
+    }
+    _currentContext = nullptr;
+    BGJSOffscreenCanvasContext *context = new BGJSOffscreenCanvasContext(width, height, context2d->getResources(),
+            context2d->msaaEnabled ? context2d->msaaSamples : 0);
+    context->backingStoreRatio = _pixelRatio;
+    context->setVertexBufferSize(_vertexBufferSize);
+    context->frameStats = context2d->frameStats;
+    if (context2d->_isRendering) {
+        context->startRendering();
+    }
+    _offscreenContexts.push_back(context);
+    return context;
+}
+
+void BGJSGLView::releaseOffscreenContext(BGJSOffscreenCanvasContext *context) {
+    _releasedOffscreenContexts.push_back(context);
+}
+
+void BGJSGLView::queryDamageExtensions() {
+    const char* extensions = eglQueryString(eglGetCurrentDisplay(), EGL_EXTENSIONS);
+    if (!extensions) {
+        extensions = "";
+    }
+    const bool partialUpdate = strstr(extensions, "EGL_KHR_partial_update") != NULL;
+    _hasBufferAge = partialUpdate || strstr(extensions, "EGL_EXT_buffer_age") != NULL;
+    _setDamageRegion = partialUpdate ? (void*)eglGetProcAddress("eglSetDamageRegionKHR") : nullptr;
+    _swapBuffersWithDamage = nullptr;
+    if (strstr(extensions, "EGL_KHR_swap_buffers_with_damage")) {
+        _swapBuffersWithDamage = (void*)eglGetProcAddress("eglSwapBuffersWithDamageKHR");
+    } else if (strstr(extensions, "EGL_EXT_swap_buffers_with_damage")) {
+        _swapBuffersWithDamage = (void*)eglGetProcAddress("eglSwapBuffersWithDamageEXT");
+    }
+    LOGD("partial update: buffer age %d, set damage %d, swap with damage %d", (int)_hasBufferAge,
+         (int)(_setDamageRegion != nullptr), (int)(_swapBuffersWithDamage != nullptr));
+}
+
+bool BGJSGLView::invalidateRect(float x, float y, float width, float height) {
+    if (context2d->hasDrawnInFrame() || !context2d->_isRendering) {
+        LOGI("invalidateRect ignored, it has to be called in a frame callback before anything is drawn");
+        return false;
+    }
+
+    if (_bufferAge < 0) {
+        // a preserved back buffer always holds the previous frame
+        EGLint age = 0;
+        if (noClearOnFlip) {
+            age = 1;
+        } else if (_hasBufferAge && !eglQuerySurface(eglGetCurrentDisplay(), eglGetCurrentSurface(EGL_DRAW),
+                                                     EGL_BUFFER_AGE_EXT, &age)) {
+            age = 0;
+        }
+        _bufferAge = age;
+    }
+    // the back buffer holds the frame _bufferAge frames ago, which only helps if it and the damage since are known
+    if (_bufferAge < 1 || _bufferAge > _damageHistorySize) {
+        return false;
+    }
+
+    // canvas (0,0) is top left, gl (0,0) is bottom left
+    const int left = std::max(0, (int)floorf(x)), right = std::min(_width, (int)ceilf(x + width));
+    const int top = std::max(0, (int)floorf(y)), bottom = std::min(_height, (int)ceilf(y + height));
+    const BGJSPixelRect rect = { left, _height - bottom, std::max(0, right - left), std::max(0, bottom - top) };
+
+    _frameDamage = _hasFrameDamage ? BGJSPixelRectUnion(_frameDamage, rect) : rect;
+    _hasFrameDamage = true;
+
+    _redrawRegion = _frameDamage;
+    for (int i = 0; i < _bufferAge - 1; i++) {
+        _redrawRegion = BGJSPixelRectUnion(_redrawRegion, _damageHistory[i]);
+    }
+    context2d->setDamage(_redrawRegion);
+    return true;
+}
+
+void BGJSGLView::onBeginFrame() {
+    if (_hasFrameDamage && _setDamageRegion) {
+        EGLint rect[4] = { _redrawRegion.x, _redrawRegion.y, _redrawRegion.width, _redrawRegion.height };
+        ((BGJSSetDamageRegionProc)_setDamageRegion)(eglGetCurrentDisplay(), eglGetCurrentSurface(EGL_DRAW), rect, 1);
+    }
 }
 
 static unsigned int nextPowerOf2(unsigned int n)
@@ -140,10 +395,541 @@ void BGJSGLView::endRedraw(JNIEnv *env, jobject objWrapped) {
 }
 
 void BGJSGLView::onEndRedraw() {
+    // offscreen contexts were flushed when the view switched away from them
+    useContext(context2d);
+    for (auto context : _offscreenContexts) {
+        context->endRendering();
+    }
     context2d->endRendering();
+    if (context2d->frameStats) {
+        // the query ends before the swap, so it covers the draws of the frame and not the wait for a buffer
+        if (_gpuTimer) {
+            _gpuTimer->endFrame();
+            const int64_t gpuTime = _gpuTimer->poll();
+            if (gpuTime >= 0) {
+                _lastGpuTime = gpuTime;
+            }
+        }
+        // stats may have been turned off during the frame; the swap fills in the pacing
+        if (_frameStatsEnabled) {
+            _lastFrameStats = _frameStats;
+            _lastFrameStats.gpuTime = _lastGpuTime;
+            _lastFrameStats.queueDepth = 0;
+            _lastFrameStats.presentLatency = -1;
+        }
+    }
     if (!noFlushOnRedraw) {
         this->swapBuffers();
+    } else if (sharesContext) {
+        // textures uploaded in this frame have to reach the other contexts of the group
+        glFlush();
+    }
+}
+
+int BGJSGLView::requestAnimationFrame(v8::Local<v8::Function> callback) {
+    // the view only has to be woken up for the first request of a frame
+    const bool needsRender = _frameCallbacks.empty();
+
+    const int id = ++_nextFrameCallbackId;
+    _frameCallbacks.push_back(FrameCallback());
+    _frameCallbacks.back().id = id;
+    _frameCallbacks.back().callback.Reset(v8::Isolate::GetCurrent(), callback);
+
+    if (needsRender) {
+        _jniRequestRender.call(this);
+    }
+    return id;
+}
+
+void BGJSGLView::cancelAnimationFrame(int id) {
+    auto it = std::find_if(_frameCallbacks.begin(), _frameCallbacks.end(), [id](const FrameCallback &request) {
+        return request.id == id;
+    });
+    if (it != _frameCallbacks.end()) {
+        _frameCallbacks.erase(it);
+        return;
+    }
+
+    // a callback of the running frame may cancel one that has not been called yet
+    for (auto &request : _runningFrameCallbacks) {
+        if (request.id == id) {
+            request.callback.Reset();
+            return;
+        }
+    }
+}
+
+void BGJSGLView::setFrameTiming(jlong frameTimeNanos, jlong frameBudgetNanos) {
+    _frameStart = frameTimeNanos / 1e6;
+    _frameDeadline = _frameStart + frameBudgetNanos / 1e6;
+    // queued tasks of the js thread make way for the next frame
+    getEngine()->getTaskScheduler()->onFrame(_frameStart, frameBudgetNanos / 1e6);
+}
+
+void BGJSGLView::callFrameCallbacks(v8::Isolate *isolate, v8::Local<v8::Context> context) {
+    Local<Value> timestamp = Number::New(isolate, _frameStart);
+    BGJSTraceScope callbacksTrace("BGJSGLView.animationFrameCallbacks");
+    for (auto &request : _runningFrameCallbacks) {
+        if (request.callback.IsEmpty()) {
+            continue;
+        }
+        Local<Function> callback = Local<Function>::New(isolate, request.callback);
+        request.callback.Reset();
+
+        TryCatch trycatch(isolate);
+        if (callback->Call(context, context->Global(), 1, &timestamp).IsEmpty() && trycatch.HasCaught()) {
+            // one failing animation must not stop the others or leave the frame unfinished
+            Local<Value> stackTrace;
+            if (!trycatch.StackTrace(context).ToLocal(&stackTrace)) {
+                stackTrace = trycatch.Exception();
+            }
+            LOGE("Uncaught exception in animation frame callback: %s",
+                 JNIV8Marshalling::v8string2string(stackTrace).c_str());
+        }
     }
+    _runningFrameCallbacks.clear();
+}
+
+jboolean BGJSGLView::runFrameCallbacks(JNIEnv *env, jobject objWrapped, jlong frameTimeNanos, jlong frameBudgetNanos) {
+    auto self = JNIWrapper::wrapObject<BGJSGLView>(objWrapped);
+    BGJSTraceScope trace("BGJSGLView.runFrameCallbacks");
+    // frames are made for the vsync at the end of their budget, pipelined ones as well as the others
+    self->_presentTimeNanos = frameBudgetNanos > 0 ? frameTimeNanos + frameBudgetNanos : 0;
+
+    // pipelined frames do not wait for the isolate, which the js thread holds while it records the next one
+    {
+        std::lock_guard<std::mutex> lock(self->_replayMutex);
+        if (self->_pipelined) {
+            return self->runPipelinedFrame(frameTimeNanos, frameBudgetNanos);
+        }
+    }
+
+    v8::Isolate* isolate = self->getEngine()->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = self->getEngine()->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    self->finishPixelReadbacks();
+
+    if (self->_frameCallbacks.empty()) {
+        return JNI_FALSE;
+    }
+
+    // callbacks requested while the frame is running are run in the next frame
+    self->_runningFrameCallbacks.swap(self->_frameCallbacks);
+    self->setFrameTiming(frameTimeNanos, frameBudgetNanos);
+
+    self->onPrepareRedraw();
+    self->replayLeftoverCommands();
+    self->callFrameCallbacks(isolate, context);
+    self->onEndRedraw();
+    // garbage collected in the rest of the frame does not interrupt the next one
+    self->getEngine()->idleNotification(self->_frameDeadline, true);
+    self->_frameDeadline = 0;
+
+    return JNI_TRUE;
+}
+
+namespace {
+struct PipelinedFrame {
+    JNIRetainedRef<BGJSGLView> view;
+    jlong frameTimeNanos, frameBudgetNanos;
+};
+}
+
+jboolean BGJSGLView::runPipelinedFrame(jlong frameTimeNanos, jlong frameBudgetNanos) {
+    bool hasCommands;
+    {
+        std::lock_guard<std::mutex> lock(_commandsMutex);
+        hasCommands = _hasCompletedCommands;
+        if (hasCommands) {
+            _replayCommands.swap(_completedCommands);
+            _completedCommands.clear();
+            _hasCompletedCommands = false;
+        }
+    }
+
+    // the callbacks of the next frame run while this one is drawn; there is one frame on the js thread at a time
+    if (!_pipelinedFramePending.exchange(true)) {
+        getEngine()->runOnJSThread(recordPipelinedFrame, new PipelinedFrame { JNIRetainedRef<BGJSGLView>(this),
+                                                                             frameTimeNanos, frameBudgetNanos });
+    }
+    if (!hasCommands) {
+        return JNI_FALSE;
+    }
+
+    BGJSTraceScope trace("BGJSGLView.replayFrame");
+    // the rest of onPrepareRedraw is about offscreen canvases and pixel readbacks, which pipelined views do not have
+    EJGLState::invalidate();
+    context2d->getResources()->purgeIfRequested();
+    if (_vertexBufferSizeChanged.exchange(false)) {
+        context2d->setVertexBufferSize(_vertexBufferSize);
+    }
+    beginRedraw();
+    replayCommands(_replayCommands);
+    onEndRedraw();
+    return JNI_TRUE;
+}
+
+void BGJSGLView::recordPipelinedFrame(BGJSV8Engine *engine, void *data) {
+    PipelinedFrame *frame = (PipelinedFrame*)data;
+    BGJSGLView *self = frame->view.get();
+    BGJSTraceScope trace("BGJSGLView.recordFrame");
+
+    v8::Isolate* isolate = engine->getIsolate();
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = engine->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    // a view that is not pipelined any more draws what is left with its next frame on the render thread
+    bool completed = false;
+    if (self->_pipelined) {
+        if (!self->_frameCallbacks.empty()) {
+            self->_runningFrameCallbacks.swap(self->_frameCallbacks);
+            self->setFrameTiming(frame->frameTimeNanos, frame->frameBudgetNanos);
+            self->callFrameCallbacks(isolate, context);
+        }
+        if (!self->_recordingCommands.empty() && self->_pipelined) {
+            std::lock_guard<std::mutex> lock(self->_commandsMutex);
+            // a list that was not replayed yet is drawn together with this one
+            if (self->_hasCompletedCommands) {
+                self->_completedCommands.insert(self->_completedCommands.end(), self->_recordingCommands.begin(),
+                                                self->_recordingCommands.end());
+                self->_recordingCommands.clear();
+            } else {
+                self->_completedCommands.swap(self->_recordingCommands);
+            }
+            self->_hasCompletedCommands = true;
+            completed = true;
+        }
+    }
+    self->_pipelinedFramePending = false;
+    if (completed) {
+        _jniRequestRender.call(self);
+    }
+
+    if (self->_frameDeadline) {
+        engine->idleNotification(self->_frameDeadline, true);
+        self->_frameDeadline = 0;
+    }
+    delete frame;
+}
+
+void BGJSGLView::replayCommands(const std::vector<float> &commands) {
+    const char *error;
+    BGJSRunCanvasCommands(context2d, commands.data(), commands.size(), &error);
+    if (error) {
+        // the list was checked while it was recorded, so this is not the fault of the script
+        LOGE("replaying the display list failed: %s", error);
+    }
+}
+
+void BGJSGLView::replayLeftoverCommands() {
+    // the isolate is locked, so the js thread does not record now, and the render thread does not replay
+    if (_hasCompletedCommands) {
+        replayCommands(_completedCommands);
+        _completedCommands.clear();
+        _hasCompletedCommands = false;
+    }
+    if (!_recordingCommands.empty()) {
+        replayCommands(_recordingCommands);
+        _recordingCommands.clear();
+    }
+    _pipelinedStates.clear();
+}
+
+std::vector<float>* BGJSGLView::pipelinedCommands() {
+    if (!_pipelined || !context2d) {
+        return nullptr;
+    }
+    // the render thread does not change the state of the context before it got a list, so it can be copied then
+    if (_pipelinedStates.empty()) {
+        _pipelinedStates.push_back(*context2d->state);
+        _pipelinedStates.back().fillPaint = _pipelinedStates.back().strokePaint = NULL;
+        _pipelinedStates.back().fontName = NULL;
+    }
+    return &_recordingCommands;
+}
+
+EJCanvasState* BGJSGLView::pipelinedState() {
+    return &_pipelinedStates.back();
+}
+
+void BGJSGLView::savePipelinedState() {
+    // the same limit as that of the context, so the states stay in step with those the render thread has
+    if (_pipelinedStates.size() < EJ_CANVAS_STATE_STACK_SIZE) {
+        _pipelinedStates.push_back(_pipelinedStates.back());
+    }
+}
+
+void BGJSGLView::restorePipelinedState() {
+    if (_pipelinedStates.size() > 1) {
+        _pipelinedStates.pop_back();
+    }
+}
+
+void BGJSGLView::getPipelined(const std::string &propertyName, const v8::PropertyCallbackInfo<v8::Value> &info) {
+    info.GetReturnValue().Set(_pipelined.load());
+}
+
+void BGJSGLView::setPipelined(const std::string &propertyName, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void> &info) {
+    const bool pipelined = value->BooleanValue(info.GetIsolate());
+    if (pipelined && sharesContext) {
+        // the views of the group share fonts and textures, which only the engine lock keeps them from using at once
+        ThrowV8TypeError(std::string("views that share their gl context can not be pipelined"));
+        return;
+    }
+    _pipelined = pipelined;
+    if (!pipelined) {
+        // once a replay that is running is done, the context can be used by the js thread again
+        std::lock_guard<std::mutex> lock(_replayMutex);
+    }
+    _jniRequestRender.call(this);
+}
+
+void BGJSGLView::addPixelReadback(EJPixelReadback *readback, v8::Local<v8::Object> imageData,
+                                  v8::Local<v8::ArrayBuffer> data, v8::Local<v8::Promise::Resolver> resolver) {
+    v8::Isolate* isolate = v8::Isolate::GetCurrent();
+    _pixelReadbacks.push_back(PixelReadback());
+    _pixelReadbacks.back().readback = readback;
+    _pixelReadbacks.back().imageData.Reset(isolate, imageData);
+    _pixelReadbacks.back().data.Reset(isolate, data);
+    _pixelReadbacks.back().resolver.Reset(isolate, resolver);
+
+    _jniRequestRender.call(this);
+}
+
+void BGJSGLView::finishPixelReadbacks() {
+    if (_pixelReadbacks.empty()) {
+        return;
+    }
+    v8::Isolate* isolate = v8::Isolate::GetCurrent();
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+    // promise reactions may read back again, so the finished requests are taken out before they are resolved
+    std::vector<PixelReadback> finished;
+    for (auto it = _pixelReadbacks.begin(); it != _pixelReadbacks.end();) {
+        if (it->readback->isComplete()) {
+            finished.push_back(std::move(*it));
+            it = _pixelReadbacks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    for (auto &request : finished) {
+        Local<ArrayBuffer> data = Local<ArrayBuffer>::New(isolate, request.data);
+        context2d->finishReadPixels(request.readback, (GLubyte*)data->GetContents().Data());
+        delete request.readback;
+
+        Local<Promise::Resolver> resolver = Local<Promise::Resolver>::New(isolate, request.resolver);
+        resolver->Resolve(context, Local<Object>::New(isolate, request.imageData)).FromMaybe(false);
+    }
+    if (!finished.empty()) {
+        isolate->RunMicrotasks();
+    }
+
+    // the view only renders on request, so it has to come back for the ones still waiting for the gpu
+    if (!_pixelReadbacks.empty()) {
+        _jniRequestRender.call(this);
+    }
+}
+
+void BGJSGLView::clearFrameCallbacks(JNIEnv *env, jobject objWrapped) {
+    auto self = JNIWrapper::wrapObject<BGJSGLView>(objWrapped);
+
+    v8::Locker l(self->getEngine()->getIsolate());
+    self->_frameCallbacks.clear();
+    for (auto &request : self->_runningFrameCallbacks) {
+        request.callback.Reset();
+    }
+}
+
+void BGJSGLView::getFrameStart(const std::string &propertyName, const v8::PropertyCallbackInfo<v8::Value> &info) {
+    info.GetReturnValue().Set(_frameStart);
+}
+
+void BGJSGLView::getFrameBudgetLeft(const std::string &propertyName, const v8::PropertyCallbackInfo<v8::Value> &info) {
+    // System.nanoTime that the frame time is taken from uses the monotonic clock as well
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    const double now = ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+
+    info.GetReturnValue().Set(std::max(0.0, _frameDeadline - now));
+}
+
+void BGJSGLView::getVertexBufferSize(const std::string &propertyName, const v8::PropertyCallbackInfo<v8::Value> &info) {
+    info.GetReturnValue().Set(_vertexBufferSize);
+}
+
+void BGJSGLView::setVertexBufferSize(const std::string &propertyName, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void> &info) {
+    if (!value->IsInt32() || value.As<v8::Int32>()->Value() < 6 ||
+        value.As<v8::Int32>()->Value() > EJ_CANVAS_MAX_VERTEX_BUFFER_SIZE) {
+        ThrowV8RangeError(std::string("vertexBufferSize must be an integer from 6 to ") +
+                          std::to_string(EJ_CANVAS_MAX_VERTEX_BUFFER_SIZE));
+        return;
+    }
+    _vertexBufferSize = value.As<v8::Int32>()->Value();
+    if (_pipelined) {
+        _vertexBufferSizeChanged = true;
+        return;
+    }
+    // resizing flushes, which only a current context may do while rendering
+    if (context2d) {
+        if (context2d->_isRendering) {
+            useContext(context2d);
+        }
+        context2d->setVertexBufferSize(_vertexBufferSize);
+    }
+    for (auto context : _offscreenContexts) {
+        if (context->_isRendering) {
+            useContext(context);
+        }
+        context->setVertexBufferSize(_vertexBufferSize);
+    }
+}
+
+namespace {
+
+// the hardware buffer functions of the ndk that take java objects, which need api 26 and 30
+struct HardwareBufferJNI {
+    AHardwareBuffer* (*fromHardwareBuffer)(JNIEnv *env, jobject buffer);
+    int (*bitmapHardwareBuffer)(JNIEnv *env, jobject bitmap, AHardwareBuffer **buffer);
+
+    HardwareBufferJNI() {
+        fromHardwareBuffer = EJHardwareBuffer::available()
+                ? (AHardwareBuffer* (*)(JNIEnv*, jobject)) dlsym(RTLD_DEFAULT, "AHardwareBuffer_fromHardwareBuffer")
+                : nullptr;
+        bitmapHardwareBuffer = EJHardwareBuffer::available()
+                ? (int (*)(JNIEnv*, jobject, AHardwareBuffer**)) dlsym(RTLD_DEFAULT, "AndroidBitmap_getHardwareBuffer")
+                : nullptr;
+    }
+};
+
+const HardwareBufferJNI& hardwareBufferJNI() {
+    static const HardwareBufferJNI functions;
+    return functions;
+}
+
+// the registered images are retained until they are removed, the images made of them until they are collected
+std::mutex registeredImagesMutex;
+std::unordered_map<std::string, EJImage*> registeredImages;
+
+void registerImage(const std::string &path, EJImage *image) {
+    EJImage *previous = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(registeredImagesMutex);
+        EJImage *&entry = registeredImages[path];
+        previous = entry;
+        entry = image;
+    }
+    if (previous) {
+        previous->release();
+    }
+}
+
+}
+
+jboolean BGJSGLView::registerBitmap(JNIEnv *env, jclass clazz, jstring path, jobject bitmap) {
+    AndroidBitmapInfo info;
+    if (AndroidBitmap_getInfo(env, bitmap, &info) != ANDROID_BITMAP_RESULT_SUCCESS) {
+        return JNI_FALSE;
+    }
+    const std::string strPath = JNIWrapper::jstring2string(path);
+    const bool premultiplied = (info.flags & ANDROID_BITMAP_FLAGS_ALPHA_MASK) != ANDROID_BITMAP_FLAGS_ALPHA_UNPREMUL;
+
+    // hardware bitmaps only have a buffer, which is sampled as it is; it is released once the image has acquired it
+    AHardwareBuffer *buffer = nullptr;
+    const HardwareBufferJNI &jni = hardwareBufferJNI();
+    if (jni.bitmapHardwareBuffer && jni.bitmapHardwareBuffer(env, bitmap, &buffer) == ANDROID_BITMAP_RESULT_SUCCESS && buffer) {
+        int width, height;
+        jboolean registered = JNI_FALSE;
+        if (EJHardwareBuffer::describe(buffer, &width, &height)) {
+            registerImage(strPath, EJImage::initWithHardwareBuffer(strPath.c_str(), buffer, width, height, premultiplied));
+            registered = JNI_TRUE;
+        }
+        EJHardwareBuffer::release(buffer);
+        return registered;
+    }
+
+    // all others are copied once, since java may change or recycle their pixels; the caller converts other formats
+    if (info.format != ANDROID_BITMAP_FORMAT_RGBA_8888) {
+        return JNI_FALSE;
+    }
+    void *data = nullptr;
+    if (AndroidBitmap_lockPixels(env, bitmap, &data) != ANDROID_BITMAP_RESULT_SUCCESS || !data) {
+        return JNI_FALSE;
+    }
+    GLubyte *pixels = (GLubyte*)malloc((size_t)info.width * info.height * 4);
+    if (pixels) {
+        for (uint32_t y = 0; y < info.height; y++) {
+            memcpy(pixels + (size_t)y * info.width * 4, (const GLubyte*)data + (size_t)y * info.stride, info.width * 4);
+        }
+    }
+    AndroidBitmap_unlockPixels(env, bitmap);
+    if (!pixels) {
+        return JNI_FALSE;
+    }
+    registerImage(strPath, EJImage::initWithPixels(strPath.c_str(), info.width, info.height, pixels, premultiplied));
+    return JNI_TRUE;
+}
+
+jboolean BGJSGLView::registerHardwareBuffer(JNIEnv *env, jclass clazz, jstring path, jobject buffer, jboolean premultiplied) {
+    const HardwareBufferJNI &jni = hardwareBufferJNI();
+    // the buffer is valid as long as the java object, and the image acquires it
+    AHardwareBuffer *nativeBuffer = jni.fromHardwareBuffer ? jni.fromHardwareBuffer(env, buffer) : nullptr;
+    int width, height;
+    if (!nativeBuffer || !EJHardwareBuffer::describe(nativeBuffer, &width, &height)) {
+        return JNI_FALSE;
+    }
+    const std::string strPath = JNIWrapper::jstring2string(path);
+    registerImage(strPath, EJImage::initWithHardwareBuffer(strPath.c_str(), nativeBuffer, width, height, premultiplied));
+    return JNI_TRUE;
+}
+
+jboolean BGJSGLView::registerSurfaceTexture(JNIEnv *env, jclass clazz, jstring path, jint textureId, jint width, jint height) {
+    if (!textureId || width <= 0 || height <= 0) {
+        return JNI_FALSE;
+    }
+    const std::string strPath = JNIWrapper::jstring2string(path);
+    EJExternalTexture *texture = new EJExternalTexture((unsigned int)textureId, width, height);
+    registerImage(strPath, EJImage::initWithExternalTexture(strPath.c_str(), texture));
+    texture->release();
+    return JNI_TRUE;
+}
+
+void BGJSGLView::updateSurfaceTexture(JNIEnv *env, jclass clazz, jstring path, jfloatArray transform) {
+    if (!transform || env->GetArrayLength(transform) < 16) {
+        return;
+    }
+    jfloat matrix[16];
+    env->GetFloatArrayRegion(transform, 0, 16, matrix);
+
+    std::lock_guard<std::mutex> lock(registeredImagesMutex);
+    auto it = registeredImages.find(JNIWrapper::jstring2string(path));
+    if (it != registeredImages.end() && it->second->externalTexture()) {
+        it->second->externalTexture()->setTransformMatrix(matrix);
+    }
+}
+
+void BGJSGLView::unregisterImage(JNIEnv *env, jclass clazz, jstring path) {
+    EJImage *image = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(registeredImagesMutex);
+        auto it = registeredImages.find(JNIWrapper::jstring2string(path));
+        if (it == registeredImages.end()) {
+            return;
+        }
+        image = it->second;
+        registeredImages.erase(it);
+    }
+    // images that js still holds draw nothing once the SurfaceTexture deletes its texture
+    if (image->externalTexture()) {
+        image->externalTexture()->detach();
+    }
+    image->release();
 }
 
 void BGJSGLView::setTouchPosition(JNIEnv *env, jobject objWrapped, int x, int y) {
@@ -153,17 +939,117 @@ void BGJSGLView::setTouchPosition(JNIEnv *env, jobject objWrapped, int x, int y)
 }
 
 void BGJSGLView::onSetTouchPosition(int x, int y) {
-    // A NOP. Subclasses might be interested in this though
+    // touches come in logical pixels, regions in those of the canvas
+    const EJVector2 point = EJVector2Make(x * _pixelRatio, y * _pixelRatio);
+
+    std::lock_guard<std::mutex> lock(_hitRegionsMutex);
+    _hasTouchRegion = false;
+    for (auto it = _hitRegions.rbegin(); it != _hitRegions.rend(); ++it) {
+        if (it->path->containsPoint(EJVector2ApplyTransform(point, it->inverseTransform), it->fillRule)) {
+            _touchRegion = it->id;
+            _hasTouchRegion = true;
+            break;
+        }
+    }
+}
+
+jstring BGJSGLView::getTouchRegion(JNIEnv *env, jobject objWrapped) {
+    auto self = JNIWrapper::wrapObject<BGJSGLView>(objWrapped);
+
+    std::lock_guard<std::mutex> lock(self->_hitRegionsMutex);
+    return self->_hasTouchRegion ? JNIWrapper::string2jstring(self->_touchRegion) : nullptr;
+}
+
+void BGJSGLView::addHitRegion(const std::string &id, const EJPath &path, CGAffineTransform transform, EJFillRule fillRule) {
+    // the copy is made and indexed outside of the lock, so touches are not held up by it
+    EJPath *copy = new EJPath(true);
+    copy->addPath(path);
+    copy->containsPoint(EJVector2Make(0, 0), fillRule);
+    const HitRegion region = { id, copy, CGAffineTransformInvert(transform), fillRule };
+
+    EJPath *replaced = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_hitRegionsMutex);
+        for (auto it = _hitRegions.begin(); it != _hitRegions.end(); ++it) {
+            if (it->id == id) {
+                replaced = it->path;
+                _hitRegions.erase(it);
+                break;
+            }
+        }
+        _hitRegions.push_back(region);
+    }
+    delete replaced;
+}
+
+void BGJSGLView::removeHitRegion(const std::string &id) {
+    EJPath *removed = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_hitRegionsMutex);
+        for (auto it = _hitRegions.begin(); it != _hitRegions.end(); ++it) {
+            if (it->id == id) {
+                removed = it->path;
+                _hitRegions.erase(it);
+                break;
+            }
+        }
+    }
+    delete removed;
+}
+
+void BGJSGLView::clearHitRegions() {
+    std::vector<HitRegion> regions;
+    {
+        std::lock_guard<std::mutex> lock(_hitRegionsMutex);
+        regions.swap(_hitRegions);
+    }
+    for (auto &region : regions) {
+        delete region.path;
+    }
 }
 
 void BGJSGLView::swapBuffers() {
+	BGJSTraceScope trace("BGJSGLView.swapBuffers");
 	// At least HC on Tegra 2 doesn't like this
 	EGLDisplay display = eglGetCurrentDisplay();
 	EGLSurface surface = eglGetCurrentSurface(EGL_DRAW);
-	eglSurfaceAttrib(display, surface, EGL_SWAP_BEHAVIOR, noClearOnFlip ? EGL_BUFFER_PRESERVED : EGL_BUFFER_DESTROYED);
-	EGLBoolean res = eglSwapBuffers (display, surface);
+	if (surface != _swapBehaviorSurface || noClearOnFlip != _swapBehaviorPreserved) {
+		eglSurfaceAttrib(display, surface, EGL_SWAP_BEHAVIOR, noClearOnFlip ? EGL_BUFFER_PRESERVED : EGL_BUFFER_DESTROYED);
+		_swapBehaviorSurface = surface;
+		_swapBehaviorPreserved = noClearOnFlip;
+	}
+
+	// waits for the gpu only if more frames than allowed would be on it after this swap
+	if (_framePacer) {
+		BGJSTraceScope pacingTrace("BGJSGLView.framePacing");
+		_framePacer->setMaxFramesInFlight(_maxFramesInFlight);
+		_framePacer->beforeSwap(display, surface, _presentTimeNanos);
+		if (_frameStatsEnabled) {
+			_lastFrameStats.queueDepth = _framePacer->queueDepth();
+			_lastFrameStats.presentLatency = _framePacer->presentLatency();
+		}
+	}
+	_presentTimeNanos = 0;
+
+	// remember what changed, so a later frame knows what to redraw in an older back buffer
+	const BGJSPixelRect full = { 0, 0, _width, _height };
+	const BGJSPixelRect damage = _hasFrameDamage ? _frameDamage : full;
+	for (int i = std::min(_damageHistorySize, kDamageHistory - 1); i > 0; i--) {
+		_damageHistory[i] = _damageHistory[i - 1];
+	}
+	_damageHistory[0] = damage;
+	_damageHistorySize = std::min(_damageHistorySize + 1, kDamageHistory);
+
+	EGLBoolean res;
+	if (_hasFrameDamage && _swapBuffersWithDamage) {
+		EGLint rect[4] = { damage.x, damage.y, damage.width, damage.height };
+		res = ((BGJSSwapBuffersWithDamageProc)_swapBuffersWithDamage)(display, surface, rect, 1);
+	} else {
+		res = eglSwapBuffers (display, surface);
+	}
+	_hasFrameDamage = false;
 	// LOGD("eglSwap %d", (int)res);
-	// checkGlError("eglSwapBuffers");
+	// EJ_CHECK_GL_ERROR("eglSwapBuffers");
 }
 
 
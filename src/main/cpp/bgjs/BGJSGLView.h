@@ -2,10 +2,18 @@
 #define __BGJSGLVIEW_H	1
 
 #include "BGJSCanvasContext.h"
+#include "BGJSOffscreenCanvasContext.h"
+#include "../ejecta/EJCanvas/EJPixelReadback.h"
+#include "BGJSGpuTimer.h"
+#include "BGJSFramePacer.h"
 #include "BGJSV8Engine.h"
 #include "../v8/JNIV8Object.h"
 #include "os-android.h"
 
+#include <vector>
+#include <atomic>
+#include <mutex>
+
 /**
  * BGJSGLView
  * Wrapper class around native windows that expose OpenGL operations
@@ -18,6 +26,11 @@ class BGJSGLView : public JNIScope<BGJSGLView, JNIV8Object> {
 public:
 	BGJSGLView(jobject obj, JNIClassInfo *info) : JNIScope(obj, info) {};
 
+    /**
+     * set before setViewData if the gl context shares objects with the contexts of other views; the contexts of all views
+     * of an engine then share fonts and image textures, since the engine lock lets only one of them draw at a time
+     */
+    static void setSharesContext(JNIEnv *env, jobject objWrapped, bool sharesContext);
     static void setViewData(JNIEnv *env, jobject objWrapped, float pixelRatio, bool doNoClearOnFlip, int width, int height);
 	virtual void onSetViewData(float pixelRatio, bool doNoClearOnFlip, int width, int heigh);
 
@@ -33,11 +46,123 @@ public:
 
     static void viewWasResized(JNIEnv *env, jobject objWrapped, int width, int height);
 
+    /**
+     * animation frame callbacks are stored natively and run in one batch by runFrameCallbacks,
+     * so a frame costs a single JNI call independent of the number of requests
+     */
+    int requestAnimationFrame(v8::Local<v8::Function> callback);
+    void cancelAnimationFrame(int id);
+    static jboolean runFrameCallbacks(JNIEnv *env, jobject objWrapped, jlong frameTimeNanos, jlong frameBudgetNanos);
+    static void clearFrameCallbacks(JNIEnv *env, jobject objWrapped);
+
+    void getFrameStart(const std::string &propertyName, const v8::PropertyCallbackInfo<v8::Value> &info);
+    void getFrameBudgetLeft(const std::string &propertyName, const v8::PropertyCallbackInfo<v8::Value> &info);
+
+    /**
+     * pipelined frames: while pipelined is set, the frame callbacks run on the js thread, and what they draw into the
+     * 2d context of the view is recorded as a display list in the format of submit. The render thread replays the
+     * list that was completed last while the callbacks of the next frame run, so a frame takes the longer of both
+     * instead of their sum, and is presented one vsync later. Only what submit can replay is available: text, images,
+     * gradients, patterns, Path2D objects, pixel access and offscreen canvases throw while the view is pipelined.
+     * Views that share their gl context can not be pipelined
+     */
+    void getPipelined(const std::string &propertyName, const v8::PropertyCallbackInfo<v8::Value> &info);
+    void setPipelined(const std::string &propertyName, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void> &info);
+    bool isPipelined() const { return _pipelined; }
+    // the display list the 2d context of the view records into, null if it draws right away; js thread only
+    std::vector<float>* pipelinedCommands();
+    // the state of the 2d context once the display list is replayed, which its properties read and write
+    EJCanvasState* pipelinedState();
+    void savePipelinedState();
+    void restorePipelinedState();
+
+    /**
+     * number of vertices the 2d context collects before drawing them
+     */
+    void getVertexBufferSize(const std::string &propertyName, const v8::PropertyCallbackInfo<v8::Value> &info);
+    void setVertexBufferSize(const std::string &propertyName, v8::Local<v8::Value> value, const v8::PropertyCallbackInfo<void> &info);
+
+    /**
+     * asynchronous getImageData: the gpu copies the pixels into a buffer object, which is checked at the start of every
+     * frame; once it is done the pixels are copied into data and the promise is resolved with imageData
+     */
+    void addPixelReadback(EJPixelReadback *readback, v8::Local<v8::Object> imageData, v8::Local<v8::ArrayBuffer> data,
+                          v8::Local<v8::Promise::Resolver> resolver);
+
+    /**
+     * partial redraw: limits drawing and presenting of the current frame to the union of the invalidated rects,
+     * in canvas pixels. Has to be called before the first draw call of the frame. Returns false if the frame has to be
+     * drawn completely, because the contents of the back buffer are unknown
+     */
+    bool invalidateRect(float x, float y, float width, float height);
+    // called by the 2d context before the first draw call of a frame reaches gl
+    void onBeginFrame();
+    // the back buffer was cleared outside of the view, so the pixels of previous frames are gone
+    static void backBufferCleared(JNIEnv *env, jobject objWrapped);
+
+    /**
+     * 2d contexts of offscreen canvases share the gl context of the view. Only the current context may have unflushed
+     * draws, so switching flushes the previous one; every draw call of a context has to make it current first
+     */
+    void useContext(BGJSCanvasContext *context);
+    // only while rendering, when the gl context is current
+    BGJSOffscreenCanvasContext* createOffscreenContext(int width, int height);
+    // the context is deleted at the start of the next frame, since gl calls are not possible everywhere
+    void releaseOffscreenContext(BGJSOffscreenCanvasContext *context);
+
+    /**
+     * frame stats count what the contexts of the view send to gl in every frame, and measure its gpu time where
+     * GL_EXT_disjoint_timer_query is available; they are off by default, and turning them on takes effect with the
+     * next frame. getFrameStats fills stats with draw calls, vertices, texture binds, stencil passes, flushes and
+     * gpu time in ns of the last frame, followed by the frames still on the gpu when it was swapped and the present
+     * latency in ns of the latest frame the gpu finished, or -1, if stats has room for them; returns false while they
+     * are off
+     */
+    static void setFrameStatsEnabled(JNIEnv *env, jobject objWrapped, jboolean enabled);
+    static jboolean getFrameStats(JNIEnv *env, jobject objWrapped, jlongArray stats);
+    // stats of the last frame, whose gpu time is that of the latest frame measured, a few frames earlier; null while off
+    const EJFrameStats* lastFrameStats() const { return _frameStatsEnabled ? &_lastFrameStats : nullptr; }
+
+    /**
+     * frames the gpu may still draw while the render thread records the next one, 1 to 3; 1 by default, which keeps the
+     * latency from the frame callbacks to the screen lowest. Takes effect with the next swap, on drivers with
+     * EGL_KHR_fence_sync; on others the driver alone decides how many frames it queues
+     */
+    static void setMaxFramesInFlight(JNIEnv *env, jobject objWrapped, jint frames);
+
+    /**
+     * images of bitmaps that were decoded in java, which canvases draw as the images of path until they are removed;
+     * see BGJSGLView.registerImage. Hardware bitmaps and buffers are sampled by textures without a copy where the
+     * device supports it; the pixels of other bitmaps are copied once
+     */
+    static jboolean registerBitmap(JNIEnv *env, jclass clazz, jstring path, jobject bitmap);
+    static jboolean registerHardwareBuffer(JNIEnv *env, jclass clazz, jstring path, jobject buffer, jboolean premultiplied);
+    /**
+     * image of the GL_TEXTURE_EXTERNAL_OES texture a SurfaceTexture streams into, which only canvases of the gl context
+     * that made the texture can draw; the transform of every new frame is passed to updateSurfaceTexture
+     */
+    static jboolean registerSurfaceTexture(JNIEnv *env, jclass clazz, jstring path, jint textureId, jint width, jint height);
+    static void updateSurfaceTexture(JNIEnv *env, jclass clazz, jstring path, jfloatArray transform);
+    static void unregisterImage(JNIEnv *env, jclass clazz, jstring path);
+
 	static void setTouchPosition(JNIEnv *env, jobject objWrapped, int x, int y);
+    // tests the touch position, in logical pixels, against the hit regions; subclasses that override it call it
     virtual void onSetTouchPosition(int x, int y);
+
+    /**
+     * hit regions: addHitRegion of the 2d context copies a Path2D with the transform of that moment under an id.
+     * Touch positions are tested against them natively on the ui thread, the last region added first, and touch
+     * events carry the id of the region under the latest position as region, so js handlers need no hit tests of
+     * their own. A region with the id of an existing one replaces it
+     */
+    void addHitRegion(const std::string &id, const EJPath &path, CGAffineTransform transform, EJFillRule fillRule);
+    void removeHitRegion(const std::string &id);
+    void clearHitRegions();
+    // id of the hit region under the latest touch position, null if there is none
+    static jstring getTouchRegion(JNIEnv *env, jobject objWrapped);
     void swapBuffers();
 
-	BGJSCanvasContext *context2d;
+	BGJSCanvasContext *context2d = nullptr;
 
     int getWidth();
     int getHeight();
@@ -45,10 +170,106 @@ public:
 protected:
     bool noFlushOnRedraw = false;
     bool noClearOnFlip = false;
+    bool sharesContext = false;
 
 	float _pixelRatio = 0;
     int _width = 0;
     int _height = 0;
+    int _vertexBufferSize = EJ_CANVAS_VERTEX_BUFFER_SIZE;
+
+private:
+    struct FrameCallback {
+        int id;
+        v8::Global<v8::Function> callback;
+    };
+
+    std::vector<FrameCallback> _frameCallbacks, _runningFrameCallbacks;
+
+    struct HitRegion {
+        std::string id;
+        EJPath *path;
+        CGAffineTransform inverseTransform;		// from canvas pixels to the coordinates of the path
+        EJFillRule fillRule;
+    };
+    // written on the js thread and tested on the ui thread; the lock is only held to copy or to test the regions
+    std::mutex _hitRegionsMutex;
+    std::vector<HitRegion> _hitRegions;
+    std::string _touchRegion;
+    bool _hasTouchRegion = false;
+
+    struct PixelReadback {
+        EJPixelReadback *readback;
+        v8::Global<v8::Object> imageData;
+        v8::Global<v8::ArrayBuffer> data;
+        v8::Global<v8::Promise::Resolver> resolver;
+    };
+    std::vector<PixelReadback> _pixelReadbacks;
+
+    BGJSCanvasContext *_currentContext = nullptr;
+    std::vector<BGJSOffscreenCanvasContext*> _offscreenContexts, _releasedOffscreenContexts;
+    void finishPixelReadbacks();
+    int _nextFrameCallbackId = 0;
+
+    // damage of the frames that were presented, most recent first; a rect covering the surface if it was drawn completely
+    static const int kDamageHistory = 4;
+    BGJSPixelRect _damageHistory[kDamageHistory];
+    int _damageHistorySize = 0;
+    // damage of the frame that is rendered and the region that has to be redrawn for a back buffer of age _bufferAge
+    BGJSPixelRect _frameDamage, _redrawRegion;
+    bool _hasFrameDamage = false;
+    int _bufferAge = -1;	// -1 until queried in the frame
+
+    // egl extensions for partial updates, null where missing
+    void *_setDamageRegion = nullptr;
+    void *_swapBuffersWithDamage = nullptr;
+    bool _hasBufferAge = false;
+    void queryDamageExtensions();
+
+    bool _frameStatsEnabled = false;
+    EJFrameStats _frameStats, _lastFrameStats;
+    BGJSGpuTimer *_gpuTimer = nullptr;
+    bool _gpuTimerQueried = false;
+    int64_t _lastGpuTime = -1;
+    // points the contexts at the counters of the frame, or at none
+    void attachFrameStats();
+
+    BGJSFramePacer *_framePacer = nullptr;
+    std::atomic<int> _maxFramesInFlight{1};
+    // when the frame that is rendered is meant to be on the screen, in ns of the monotonic clock; 0 if not known
+    int64_t _presentTimeNanos = 0;
+    // the swap behavior is only set again when it or the surface changes, some drivers stall on every call
+    EGLSurface _swapBehaviorSurface = EGL_NO_SURFACE;
+    bool _swapBehaviorPreserved = false;
+
+    // timing of the frame that is currently rendered, in ms of the monotonic clock
+    double _frameStart = 0;
+    double _frameDeadline = 0;
+    void setFrameTiming(jlong frameTimeNanos, jlong frameBudgetNanos);
+    void callFrameCallbacks(v8::Isolate *isolate, v8::Local<v8::Context> context);
+    // the part of onPrepareRedraw that every frame of the view needs, also a replayed one
+    void beginRedraw();
+
+    /*
+     * the js thread records into _recordingCommands and hands it over as _completedCommands, which the render thread
+     * swaps with _replayCommands under _commandsMutex; the buffers keep their capacity from frame to frame
+     */
+    std::atomic<bool> _pipelined{false};
+    std::vector<float> _recordingCommands, _completedCommands, _replayCommands;
+    bool _hasCompletedCommands = false;
+    std::mutex _commandsMutex;
+    // held by the render thread while it replays, so the js thread can wait for that when it turns pipelining off
+    std::mutex _replayMutex;
+    // set while the callbacks of a pipelined frame are waiting for the js thread or running on it
+    std::atomic<bool> _pipelinedFramePending{false};
+    std::vector<EJCanvasState> _pipelinedStates;
+    // vertexBufferSize was set while pipelined, so the render thread applies it with the next frame
+    std::atomic<bool> _vertexBufferSizeChanged{false};
+    jboolean runPipelinedFrame(jlong frameTimeNanos, jlong frameBudgetNanos);
+    static void recordPipelinedFrame(BGJSV8Engine *engine, void *data);
+    void replayCommands(const std::vector<float> &commands);
+    void replayLeftoverCommands();
+
+    static JNIMethodHandle<void()> _jniRequestRender;
 };
 
 BGJS_JNI_LINK_DEF(BGJSGLView)
@@ -0,0 +1,87 @@
+/**
+ * BGJSGlyphRasterizer
+ * Renders glyphs for canvas text with the Android font stack
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSGlyphRasterizer.h"
+#include "../jni/JNIWrapper.h"
+
+#include <android/log.h>
+
+#define LOG_TAG "BGJSGlyphRasterizer"
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+decltype(BGJSGlyphRasterizer::_jniGlyphRasterizer) BGJSGlyphRasterizer::_jniGlyphRasterizer = {0};
+
+void BGJSGlyphRasterizer::initJNICache() {
+	JNIEnv *env = JNIWrapper::getEnvironment();
+
+	_jniGlyphRasterizer.clazz = (jclass) env->NewGlobalRef(env->FindClass("ag/boersego/bgjs/GlyphRasterizer"));
+	_jniGlyphRasterizer.createPaint.resolve(env, _jniGlyphRasterizer.clazz, "createPaint",
+											"(Ljava/lang/String;F[F)Landroid/graphics/Paint;");
+	_jniGlyphRasterizer.rasterize.resolve(env, _jniGlyphRasterizer.clazz, "rasterize",
+										  "(Landroid/graphics/Paint;ILjava/nio/ByteBuffer;[I)F");
+}
+
+void* BGJSGlyphRasterizer::createFace(const char* font, float pxSize, EJFontMetrics* metrics) {
+	JNIEnv *env = JNIWrapper::getEnvironment();
+
+	jstring fontRef = JNIWrapper::string2jstring(font);
+	jfloatArray metricsRef = env->NewFloatArray(3);
+	jobject paintRef = _jniGlyphRasterizer.createPaint.call(env, fontRef, (jfloat) pxSize, metricsRef);
+
+	jobject face = nullptr;
+	if (env->ExceptionCheck()) {
+		LOGE("Failed to create font %s", font);
+		env->ExceptionDescribe();
+		env->ExceptionClear();
+	} else if (paintRef) {
+		jfloat values[3];
+		env->GetFloatArrayRegion(metricsRef, 0, 3, values);
+		metrics->ascender = values[0];
+		metrics->descender = values[1];
+		metrics->height = values[2];
+		face = env->NewGlobalRef(paintRef);
+	}
+
+	env->DeleteLocalRef(paintRef);
+	env->DeleteLocalRef(metricsRef);
+	env->DeleteLocalRef(fontRef);
+	return face;
+}
+
+void BGJSGlyphRasterizer::releaseFace(void* face) {
+	JNIWrapper::getEnvironment()->DeleteGlobalRef((jobject) face);
+}
+
+bool BGJSGlyphRasterizer::rasterize(void* face, uint32_t codepoint, unsigned char* pixels, size_t capacity, EJGlyphBitmap* bitmap) {
+	JNIEnv *env = JNIWrapper::getEnvironment();
+
+	jobject bufferRef = env->NewDirectByteBuffer(pixels, (jlong) capacity);
+	jintArray boundsRef = env->NewIntArray(5);
+	jfloat advance = _jniGlyphRasterizer.rasterize.call(env, (jobject) face, (jint) codepoint, bufferRef, boundsRef);
+
+	bool result = true;
+	if (env->ExceptionCheck()) {
+		LOGE("Failed to render glyph %u", codepoint);
+		env->ExceptionDescribe();
+		env->ExceptionClear();
+		result = false;
+	} else {
+		// width, height, stride, left, top
+		jint bounds[5];
+		env->GetIntArrayRegion(boundsRef, 0, 5, bounds);
+		bitmap->width = bounds[0];
+		bitmap->height = bounds[1];
+		bitmap->stride = bounds[2];
+		bitmap->left = bounds[3];
+		bitmap->top = bounds[4];
+		bitmap->advance = advance;
+	}
+
+	env->DeleteLocalRef(boundsRef);
+	env->DeleteLocalRef(bufferRef);
+	return result;
+}
@@ -0,0 +1,35 @@
+#ifndef __BGJSGLYPHRASTERIZER_H
+#define __BGJSGLYPHRASTERIZER_H	1
+
+#include <jni.h>
+
+#include "EJGlyphAtlas.h"
+#include "../jni/JNIMethodHandle.h"
+
+/**
+ * BGJSGlyphRasterizer
+ * Renders glyphs for canvas text with the Android font stack via ag.boersego.bgjs.GlyphRasterizer
+ *
+ * Faces are global references to the Paint configured for a font; all methods can be called from any thread
+ * that is attached to the vm.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSGlyphRasterizer : public EJGlyphRasterizer {
+public:
+	static void initJNICache();
+
+	void* createFace(const char* font, float pxSize, EJFontMetrics* metrics) override;
+	void releaseFace(void* face) override;
+	bool rasterize(void* face, uint32_t codepoint, unsigned char* pixels, size_t capacity, EJGlyphBitmap* bitmap) override;
+
+private:
+	static struct {
+		jclass clazz;
+		JNIStaticMethodHandle<jobject(jobject, jfloat, jobject)> createPaint;
+		JNIStaticMethodHandle<jfloat(jobject, jint, jobject, jobject)> rasterize;
+	} _jniGlyphRasterizer;
+};
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * BGJSGpuTimer
+ * Measures how long the gpu takes for frames, with GL_EXT_disjoint_timer_query
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSGpuTimer.h"
+
+#include <EGL/egl.h>
+#include <GLES2/gl2.h>
+#include <string.h>
+
+// from GLES2/gl2ext.h, which not every ndk has all of
+#ifndef GL_TIME_ELAPSED_EXT
+#define GL_TIME_ELAPSED_EXT 0x88BF
+#endif
+#ifndef GL_QUERY_RESULT_EXT
+#define GL_QUERY_RESULT_EXT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE_EXT
+#define GL_QUERY_RESULT_AVAILABLE_EXT 0x8867
+#endif
+#ifndef GL_GPU_DISJOINT_EXT
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+#endif
+
+BGJSGpuTimer* BGJSGpuTimer::create() {
+	const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+	if (!extensions || !strstr(extensions, "GL_EXT_disjoint_timer_query")) {
+		return nullptr;
+	}
+
+	BGJSGpuTimer* timer = new BGJSGpuTimer();
+	timer->_genQueries = (void (*)(int, unsigned int*))eglGetProcAddress("glGenQueriesEXT");
+	timer->_deleteQueries = (void (*)(int, const unsigned int*))eglGetProcAddress("glDeleteQueriesEXT");
+	timer->_beginQuery = (void (*)(unsigned int, unsigned int))eglGetProcAddress("glBeginQueryEXT");
+	timer->_endQuery = (void (*)(unsigned int))eglGetProcAddress("glEndQueryEXT");
+	timer->_getQueryObjectuiv = (void (*)(unsigned int, unsigned int, unsigned int*))eglGetProcAddress("glGetQueryObjectuivEXT");
+	timer->_getQueryObjectui64v = (void (*)(unsigned int, unsigned int, uint64_t*))eglGetProcAddress("glGetQueryObjectui64vEXT");
+	if (!timer->_genQueries || !timer->_deleteQueries || !timer->_beginQuery || !timer->_endQuery ||
+			!timer->_getQueryObjectuiv || !timer->_getQueryObjectui64v) {
+		delete timer;
+		return nullptr;
+	}
+	timer->_genQueries(kQueries, timer->_queries);
+	return timer;
+}
+
+BGJSGpuTimer::~BGJSGpuTimer() {
+	if (_deleteQueries) {
+		_deleteQueries(kQueries, _queries);
+	}
+}
+
+void BGJSGpuTimer::beginFrame() {
+	_timing = _inFlight < kQueries;
+	if (_timing) {
+		_beginQuery(GL_TIME_ELAPSED_EXT, _queries[(_first + _inFlight) % kQueries]);
+	}
+}
+
+void BGJSGpuTimer::endFrame() {
+	if (_timing) {
+		_endQuery(GL_TIME_ELAPSED_EXT);
+		_inFlight++;
+		_timing = false;
+	}
+}
+
+int64_t BGJSGpuTimer::poll() {
+	// results become available in the order the queries ended
+	int64_t latest = -1;
+	while (_inFlight > 0) {
+		unsigned int available = 0;
+		_getQueryObjectuiv(_queries[_first], GL_QUERY_RESULT_AVAILABLE_EXT, &available);
+		if (!available) {
+			break;
+		}
+		uint64_t elapsed = 0;
+		_getQueryObjectui64v(_queries[_first], GL_QUERY_RESULT_EXT, &elapsed);
+		latest = (int64_t)elapsed;
+		_first = (_first + 1) % kQueries;
+		_inFlight--;
+	}
+
+	// the flag is reset by reading it; a disjoint result may be off by anything
+	GLint disjoint = 0;
+	glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+	return disjoint ? -1 : latest;
+}
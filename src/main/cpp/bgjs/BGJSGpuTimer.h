@@ -0,0 +1,47 @@
+#ifndef __BGJSGPUTIMER_H
+#define __BGJSGPUTIMER_H	1
+
+#include <stdint.h>
+
+/**
+ * BGJSGpuTimer
+ * Measures how long the gpu takes for frames, with GL_EXT_disjoint_timer_query
+ *
+ * Every frame is timed by a query of its own; the results arrive a few frames later, so a ring of queries is in flight.
+ * Frames that start while all of them are still waiting are not measured. Results of frames the gpu was disjoint in,
+ * e.g. because its clock changed, are thrown away.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSGpuTimer {
+public:
+	// timer for the gl context that is current; nullptr if it has no timer queries
+	static BGJSGpuTimer* create();
+	// has to be deleted with the gl context current
+	~BGJSGpuTimer();
+
+	void beginFrame();
+	void endFrame();
+	// gpu time of the latest frame whose result arrived since the last call in nanoseconds, or -1
+	int64_t poll();
+
+private:
+	BGJSGpuTimer() {}
+
+	static const int kQueries = 4;
+	unsigned int _queries[kQueries];
+	int _first = 0;			// oldest query in flight
+	int _inFlight = 0;
+	bool _timing = false;	// a query was begun for the current frame
+
+	// GL_EXT_disjoint_timer_query, from eglGetProcAddress
+	void (*_genQueries)(int n, unsigned int *ids) = nullptr;
+	void (*_deleteQueries)(int n, const unsigned int *ids) = nullptr;
+	void (*_beginQuery)(unsigned int target, unsigned int id) = nullptr;
+	void (*_endQuery)(unsigned int target) = nullptr;
+	void (*_getQueryObjectuiv)(unsigned int id, unsigned int pname, unsigned int *params) = nullptr;
+	void (*_getQueryObjectui64v)(unsigned int id, unsigned int pname, uint64_t *params) = nullptr;
+};
+
+#endif
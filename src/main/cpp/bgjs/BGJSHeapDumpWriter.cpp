@@ -0,0 +1,287 @@
+/**
+ * BGJSHeapDumpWriter
+ * Writes heap snapshots and allocation profiles on a thread of its own
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSHeapDumpWriter.h"
+#include "BGJSV8Engine.h"
+
+#include <stdio.h>
+
+#define LOG_TAG "BGJSHeapDumpWriter"
+
+using namespace v8;
+
+// big chunks == faster
+#define BGJS_HEAP_DUMP_CHUNK_SIZE 65536
+// serializing waits for the disk once this much has not been written yet
+#define BGJS_HEAP_DUMP_MAX_QUEUED_BYTES (4 * 1024 * 1024)
+
+BGJSHeapDumpWriter* BGJSHeapDumpWriter::open(BGJSV8Engine* engine, const std::string& path, Callback callback) {
+	FILE* file = fopen(path.c_str(), "w");
+	if (!file) {
+		LOGE("Cannot open %s for writing", path.c_str());
+		return nullptr;
+	}
+	return new BGJSHeapDumpWriter(engine, path, file, callback);
+}
+
+BGJSHeapDumpWriter::BGJSHeapDumpWriter(BGJSV8Engine* engine, const std::string& path, FILE* file, Callback callback) :
+		_engine(engine), _path(path), _file(file), _callback(callback), _queuedBytes(0), _ended(false),
+		_failed(false) {
+	_thread = std::thread(&BGJSHeapDumpWriter::run, this);
+}
+
+BGJSHeapDumpWriter::~BGJSHeapDumpWriter() {
+	// the callback only gets the writer once its thread is done
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+}
+
+int BGJSHeapDumpWriter::GetChunkSize() {
+	return BGJS_HEAP_DUMP_CHUNK_SIZE;
+}
+
+OutputStream::WriteResult BGJSHeapDumpWriter::WriteAsciiChunk(char* data, int size) {
+	std::unique_lock<std::mutex> lock(_mutex);
+	_condition.wait(lock, [this] { return _failed || _queuedBytes < BGJS_HEAP_DUMP_MAX_QUEUED_BYTES; });
+	if (_failed) {
+		return kAbort;
+	}
+	_queue.emplace_back(data, data + size);
+	_queuedBytes += size;
+	_condition.notify_all();
+	return kContinue;
+}
+
+void BGJSHeapDumpWriter::EndOfStream() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	_ended = true;
+	_condition.notify_all();
+}
+
+void BGJSHeapDumpWriter::run() {
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (true) {
+		_condition.wait(lock, [this] { return _ended || !_queue.empty(); });
+		if (_queue.empty()) {
+			break;
+		}
+		std::vector<char> chunk = std::move(_queue.front());
+		_queue.pop_front();
+
+		lock.unlock();
+		const bool written = fwrite(chunk.data(), 1, chunk.size(), _file) == chunk.size();
+		lock.lock();
+
+		_queuedBytes -= chunk.size();
+		if (!written) {
+			LOGE("Failed to write %s", _path.c_str());
+			_failed = true;
+			_queue.clear();
+			_queuedBytes = 0;
+		}
+		_condition.notify_all();
+		if (_failed) {
+			// the serializer aborts with its next chunk and ends the stream
+			_condition.wait(lock, [this] { return _ended; });
+			break;
+		}
+	}
+	lock.unlock();
+
+	if (fclose(_file) != 0) {
+		_failed = true;
+	}
+	_file = nullptr;
+	_engine->runOnJSThread(done, this);
+}
+
+void BGJSHeapDumpWriter::done(BGJSV8Engine* engine, void* data) {
+	BGJSHeapDumpWriter* writer = (BGJSHeapDumpWriter*) data;
+	writer->_callback(engine, writer);
+}
+
+static std::string jsonString(const char* string) {
+	std::string json = "\"";
+	for (const char* c = string; c && *c; c++) {
+		switch (*c) {
+			case '"': json += "\\\""; break;
+			case '\\': json += "\\\\"; break;
+			case '\n': json += "\\n"; break;
+			case '\r': json += "\\r"; break;
+			case '\t': json += "\\t"; break;
+			default:
+				if ((unsigned char) *c < 0x20) {
+					char escaped[8];
+					snprintf(escaped, sizeof(escaped), "\\u%04x", *c);
+					json += escaped;
+				} else {
+					json += *c;
+				}
+		}
+	}
+	return json + "\"";
+}
+
+static std::string jsonString(Isolate* isolate, Local<String> string) {
+	if (string.IsEmpty()) {
+		return "\"\"";
+	}
+	String::Utf8Value utf8(isolate, string);
+	return jsonString(*utf8);
+}
+
+//-----------------------------------------------------------
+// Allocation profiles
+//-----------------------------------------------------------
+
+void BGJSHeapDumpWriter::writeAllocationProfile(Isolate* isolate, AllocationProfile* profile) {
+	HandleScope scope(isolate);
+
+	append("{\"head\":");
+	appendNode(isolate, profile->GetRootNode());
+	append(",\"samples\":[");
+	const std::vector<AllocationProfile::Sample>& samples = profile->GetSamples();
+	for (size_t i = 0; i < samples.size(); i++) {
+		append((i ? ",{\"size\":" : "{\"size\":") + std::to_string(samples[i].size * samples[i].count) +
+			   ",\"nodeId\":" + std::to_string(samples[i].node_id) +
+			   ",\"ordinal\":" + std::to_string(samples[i].sample_id) + "}");
+	}
+	append("]}");
+	flush();
+	EndOfStream();
+}
+
+void BGJSHeapDumpWriter::appendNode(Isolate* isolate, const AllocationProfile::Node* node) {
+	size_t selfSize = 0;
+	for (auto &allocation : node->allocations) {
+		selfSize += allocation.size * allocation.count;
+	}
+	// devtools counts lines and columns from 0, v8 from 1
+	append("{\"callFrame\":{\"functionName\":" + jsonString(isolate, node->name) +
+		   ",\"scriptId\":\"" + std::to_string(node->script_id) +
+		   "\",\"url\":" + jsonString(isolate, node->script_name) +
+		   ",\"lineNumber\":" + std::to_string(node->line_number - 1) +
+		   ",\"columnNumber\":" + std::to_string(node->column_number - 1) +
+		   "},\"selfSize\":" + std::to_string(selfSize) +
+		   ",\"id\":" + std::to_string(node->node_id) + ",\"children\":[");
+	for (size_t i = 0; i < node->children.size(); i++) {
+		if (i) {
+			append(",");
+		}
+		appendNode(isolate, node->children[i]);
+	}
+	append("]}");
+}
+
+//-----------------------------------------------------------
+// Cpu profiles
+//-----------------------------------------------------------
+
+// assigns ids to the nodes below node in the order appendNode writes them
+static void numberNodes(const CpuProfileNode* node, std::unordered_map<const CpuProfileNode*, unsigned int>& ids,
+						unsigned int& lastId) {
+	for (int i = 0, n = node->GetChildrenCount(); i < n; i++) {
+		const CpuProfileNode* child = node->GetChild(i);
+		ids[child] = ++lastId;
+		numberNodes(child, ids, lastId);
+	}
+}
+
+void BGJSHeapDumpWriter::writeCpuProfile(const std::vector<const CpuProfile*>& profiles) {
+	// nodes are numbered anew, since every profile counts from 1; the root comes first
+	std::unordered_map<const CpuProfileNode*, unsigned int> ids;
+	unsigned int rootHits = 0;
+	for (const CpuProfile* profile : profiles) {
+		ids[profile->GetTopDownRoot()] = 1;
+		rootHits += profile->GetTopDownRoot()->GetHitCount();
+	}
+	unsigned int lastId = 1;
+	for (const CpuProfile* profile : profiles) {
+		numberNodes(profile->GetTopDownRoot(), ids, lastId);
+	}
+
+	append("{\"nodes\":[{\"id\":1,\"callFrame\":{\"functionName\":\"(root)\",\"scriptId\":\"0\",\"url\":\"\","
+		   "\"lineNumber\":-1,\"columnNumber\":-1},\"hitCount\":" + std::to_string(rootHits) + ",\"children\":[");
+	bool first = true;
+	for (const CpuProfile* profile : profiles) {
+		const CpuProfileNode* root = profile->GetTopDownRoot();
+		for (int i = 0, n = root->GetChildrenCount(); i < n; i++) {
+			append((first ? "" : ",") + std::to_string(ids[root->GetChild(i)]));
+			first = false;
+		}
+	}
+	append("]}");
+	for (const CpuProfile* profile : profiles) {
+		const CpuProfileNode* root = profile->GetTopDownRoot();
+		for (int i = 0, n = root->GetChildrenCount(); i < n; i++) {
+			appendNode(root->GetChild(i), ids);
+		}
+	}
+
+	const int64_t startTime = profiles.empty() ? 0 : profiles.front()->GetStartTime();
+	const int64_t endTime = profiles.empty() ? 0 : profiles.back()->GetEndTime();
+	append("],\"startTime\":" + std::to_string(startTime) + ",\"endTime\":" + std::to_string(endTime) + ",\"samples\":[");
+	first = true;
+	for (const CpuProfile* profile : profiles) {
+		for (int i = 0, n = profile->GetSamplesCount(); i < n; i++) {
+			append((first ? "" : ",") + std::to_string(ids[profile->GetSample(i)]));
+			first = false;
+		}
+	}
+	append("],\"timeDeltas\":[");
+	int64_t time = startTime;
+	first = true;
+	for (const CpuProfile* profile : profiles) {
+		for (int i = 0, n = profile->GetSamplesCount(); i < n; i++) {
+			const int64_t timestamp = profile->GetSampleTimestamp(i);
+			append((first ? "" : ",") + std::to_string(timestamp - time));
+			time = timestamp;
+			first = false;
+		}
+	}
+	append("]}");
+	flush();
+	EndOfStream();
+}
+
+void BGJSHeapDumpWriter::appendNode(const CpuProfileNode* node, std::unordered_map<const CpuProfileNode*, unsigned int>& ids) {
+	// devtools counts lines and columns from 0, v8 from 1
+	std::string json = ",{\"id\":" + std::to_string(ids[node]) +
+			",\"callFrame\":{\"functionName\":" + jsonString(node->GetFunctionNameStr()) +
+			",\"scriptId\":\"" + std::to_string(node->GetScriptId()) +
+			"\",\"url\":" + jsonString(node->GetScriptResourceNameStr()) +
+			",\"lineNumber\":" + std::to_string(node->GetLineNumber() - 1) +
+			",\"columnNumber\":" + std::to_string(node->GetColumnNumber() - 1) +
+			"},\"hitCount\":" + std::to_string(node->GetHitCount());
+	const char* bailoutReason = node->GetBailoutReason();
+	if (bailoutReason && *bailoutReason) {
+		json += ",\"deoptReason\":" + jsonString(bailoutReason);
+	}
+	json += ",\"children\":[";
+	for (int i = 0, n = node->GetChildrenCount(); i < n; i++) {
+		json += (i ? "," : "") + std::to_string(ids[node->GetChild(i)]);
+	}
+	append(json + "]}");
+	for (int i = 0, n = node->GetChildrenCount(); i < n; i++) {
+		appendNode(node->GetChild(i), ids);
+	}
+}
+
+void BGJSHeapDumpWriter::append(const std::string& text) {
+	_buffer += text;
+	if (_buffer.size() >= BGJS_HEAP_DUMP_CHUNK_SIZE) {
+		flush();
+	}
+}
+
+void BGJSHeapDumpWriter::flush() {
+	if (!_buffer.empty()) {
+		WriteAsciiChunk(&_buffer[0], (int) _buffer.size());
+		_buffer.clear();
+	}
+}
@@ -0,0 +1,79 @@
+#ifndef __BGJSHEAPDUMPWRITER_H
+#define __BGJSHEAPDUMPWRITER_H	1
+
+#include <v8.h>
+#include <v8-profiler.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * BGJSHeapDumpWriter
+ * Stream of heap snapshots, allocation profiles and cpu profiles that is written to a file on a thread of its own, so the thread
+ * serializing them does not wait for the disk. Chunks wait in a queue of bounded size; serializing blocks once it is
+ * full. When the stream has ended and everything is written, the writer hands itself to the js thread of its engine.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSV8Engine;
+
+class BGJSHeapDumpWriter : public v8::OutputStream {
+public:
+	// called on the js thread of engine once the file is complete or writing failed; has to delete the writer
+	typedef void (*Callback) (BGJSV8Engine* engine, BGJSHeapDumpWriter* writer);
+
+	// opens path for writing; NULL if it can not be created
+	static BGJSHeapDumpWriter* open(BGJSV8Engine* engine, const std::string& path, Callback callback);
+	~BGJSHeapDumpWriter();
+
+	// writes the allocation profile in the format of the sampling heap profiler of chrome, and ends the stream
+	void writeAllocationProfile(v8::Isolate* isolate, v8::AllocationProfile* profile);
+	/**
+	 * writes cpu profiles in the .cpuprofile format of chrome, and ends the stream
+	 * consecutive profiles with recorded samples are joined into one, whose call trees share the root
+	 */
+	void writeCpuProfile(const std::vector<const v8::CpuProfile*>& profiles);
+
+	const std::string& path() const { return _path; }
+	// true if everything was written; only valid once the writer was handed to the callback
+	bool succeeded() const { return !_failed; }
+
+	// v8::OutputStream
+	int GetChunkSize() override;
+	WriteResult WriteAsciiChunk(char* data, int size) override;
+	void EndOfStream() override;
+
+private:
+	BGJSHeapDumpWriter(BGJSV8Engine* engine, const std::string& path, FILE* file, Callback callback);
+
+	void run();
+	static void done(BGJSV8Engine* engine, void* data);
+
+	// buffers the json produced by writeAllocationProfile into chunks
+	void append(const std::string& text);
+	void appendNode(v8::Isolate* isolate, const v8::AllocationProfile::Node* node);
+	void appendNode(const v8::CpuProfileNode* node, std::unordered_map<const v8::CpuProfileNode*, unsigned int>& ids);
+	void flush();
+
+	BGJSV8Engine* _engine;
+	std::string _path;
+	FILE* _file;
+	Callback _callback;
+	std::string _buffer;
+
+	std::mutex _mutex;
+	std::condition_variable _condition;
+	std::deque<std::vector<char>> _queue;
+	size_t _queuedBytes;
+	bool _ended;
+	bool _failed;
+	std::thread _thread;
+};
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * BGJSIsolatePool
+ * Keeps a spare isolate for the next engine
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSIsolatePool.h"
+#include "BGJSV8Engine.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#define LOG_TAG "BGJSIsolatePool"
+
+using namespace v8;
+
+namespace {
+
+enum EBGJSIsolatePoolState {
+	kPoolEmpty,
+	kPoolPreparing,
+	kPoolReady
+};
+
+std::mutex poolMutex;
+std::condition_variable poolCondition;
+EBGJSIsolatePoolState poolState = kPoolEmpty;
+std::unique_ptr<BGJSIsolatePool::Spare> spare;
+std::string spareSnapshotPath;
+
+}
+
+BGJSIsolatePool::Spare::Spare() : isolate(nullptr), allocator(nullptr), snapshotFile(nullptr) {
+	snapshotBlob.data = nullptr;
+	snapshotBlob.raw_size = 0;
+}
+
+BGJSIsolatePool::Spare::~Spare() {
+	// spares that were taken have handed their isolate to an engine
+	if (isolate) {
+		{
+			Locker l(isolate);
+			context.Reset();
+		}
+		isolate->Dispose();
+		delete allocator;
+	}
+	if (snapshotFile) {
+		delete[] snapshotFile;
+	}
+}
+
+Isolate* BGJSIsolatePool::newIsolate(StartupData* snapshotBlob, BGJSArrayBufferAllocator** allocator) {
+	Isolate::CreateParams createParams;
+	*allocator = new BGJSArrayBufferAllocator();
+	createParams.array_buffer_allocator = *allocator;
+	createParams.external_references = BGJSV8Engine::getExternalReferences();
+	createParams.snapshot_blob = snapshotBlob;
+	return Isolate::New(createParams);
+}
+
+void BGJSIsolatePool::prepare(const std::string& snapshotPath) {
+	std::lock_guard<std::mutex> lock(poolMutex);
+	if (poolState != kPoolEmpty) {
+		return;
+	}
+	poolState = kPoolPreparing;
+	spareSnapshotPath = snapshotPath;
+	std::thread(BGJSIsolatePool::prepareSpare, snapshotPath).detach();
+}
+
+void BGJSIsolatePool::prepareSpare(std::string snapshotPath) {
+	std::unique_ptr<Spare> prepared(new Spare());
+	if (!snapshotPath.empty()) {
+		BGJSV8Engine::loadSnapshot(snapshotPath, &prepared->snapshotFile, &prepared->snapshotBlob);
+	}
+	prepared->isolate = newIsolate(prepared->snapshotFile ? &prepared->snapshotBlob : nullptr, &prepared->allocator);
+
+	if (prepared->snapshotFile) {
+		Locker l(prepared->isolate);
+		Isolate::Scope isolateScope(prepared->isolate);
+		HandleScope scope(prepared->isolate);
+
+		Local<Context> context;
+		if (Context::FromSnapshot(prepared->isolate, 0).ToLocal(&context)) {
+			prepared->context.Reset(prepared->isolate, context);
+		} else {
+			LOGE("Failed to deserialize spare context from startup snapshot %s", snapshotPath.c_str());
+		}
+	}
+	LOGD("Prepared spare isolate %p", prepared->isolate);
+
+	std::lock_guard<std::mutex> lock(poolMutex);
+	spare = std::move(prepared);
+	poolState = kPoolReady;
+	poolCondition.notify_all();
+}
+
+std::unique_ptr<BGJSIsolatePool::Spare> BGJSIsolatePool::take(const std::string& snapshotPath) {
+	std::unique_ptr<Spare> taken;
+	{
+		std::unique_lock<std::mutex> lock(poolMutex);
+		// finishing the spare is faster than starting over
+		poolCondition.wait(lock, [] { return poolState != kPoolPreparing; });
+		if (poolState != kPoolReady) {
+			return taken;
+		}
+		poolState = kPoolEmpty;
+		taken = std::move(spare);
+		if (spareSnapshotPath == snapshotPath) {
+			return taken;
+		}
+		LOGI("Discarding spare isolate prepared for snapshot '%s'", spareSnapshotPath.c_str());
+	}
+	// the snapshot changed since the spare was prepared; disposing of it happens outside of the lock
+	taken.reset();
+	return taken;
+}
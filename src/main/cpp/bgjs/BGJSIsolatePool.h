@@ -0,0 +1,49 @@
+#ifndef __BGJSISOLATEPOOL_H
+#define __BGJSISOLATEPOOL_H	1
+
+#include <v8.h>
+
+#include "BGJSArrayBufferAllocator.h"
+
+#include <memory>
+#include <string>
+
+/**
+ * BGJSIsolatePool
+ * Keeps a spare isolate, prepared on a background thread while the app is idle, for the next engine that creates its
+ * context. Creating the heap and deserializing the startup snapshot are most of the cost of creating an engine, so
+ * engines created after a reset start almost instantly.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSIsolatePool {
+public:
+	/**
+	 * an isolate that no engine has used yet
+	 * context is the context deserialized from the startup snapshot, or empty if there is none or it failed to load
+	 */
+	struct Spare {
+		v8::Isolate* isolate;
+		BGJSArrayBufferAllocator* allocator;	// of isolate
+		v8::Global<v8::Context> context;
+		char* snapshotFile;			// must outlive the isolate
+		v8::StartupData snapshotBlob;
+
+		Spare();
+		~Spare();
+	};
+
+	// starts preparing a spare for engines with the startup snapshot at snapshotPath, unless there already is one
+	static void prepare(const std::string& snapshotPath);
+	// the spare for snapshotPath, waiting for it if it is still being prepared; null if there is none
+	static std::unique_ptr<Spare> take(const std::string& snapshotPath);
+
+	// creates an isolate for an engine, from snapshotBlob if it is not null, and stores its own allocator in allocator
+	static v8::Isolate* newIsolate(v8::StartupData* snapshotBlob, BGJSArrayBufferAllocator** allocator);
+
+private:
+	static void prepareSpare(std::string snapshotPath);
+};
+
+#endif
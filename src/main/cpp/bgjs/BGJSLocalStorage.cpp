@@ -0,0 +1,317 @@
+/**
+ * BGJSLocalStorage
+ * Persistent string key-value store behind localStorage
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSLocalStorage.h"
+#include "os-android.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <iterator>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+#define LOG_TAG "BGJSLocalStorage"
+
+#define BGJS_LOCAL_STORAGE_MAGIC "BGJSLSTR"
+#define BGJS_LOCAL_STORAGE_VERSION 1
+#define BGJS_LOCAL_STORAGE_HEADER_LENGTH 16
+#define BGJS_LOCAL_STORAGE_REMOVED 0xFFFFFFFF
+// files grow and shrink in steps of this size
+#define BGJS_LOCAL_STORAGE_PAGE_SIZE 4096
+// smaller logs are never compacted
+#define BGJS_LOCAL_STORAGE_MIN_COMPACT_LENGTH 65536
+
+static uint32_t readUInt32(const uint8_t* data) {
+	return (uint32_t) data[0] | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+static void writeUInt32(uint8_t* data, uint32_t value) {
+	data[0] = (uint8_t) value;
+	data[1] = (uint8_t) (value >> 8);
+	data[2] = (uint8_t) (value >> 16);
+	data[3] = (uint8_t) (value >> 24);
+}
+
+static size_t recordLength(size_t keyLength, size_t valueLength) {
+	return 8 + (keyLength + valueLength) * sizeof(char16_t);
+}
+
+static size_t roundToPages(size_t length) {
+	return (length + BGJS_LOCAL_STORAGE_PAGE_SIZE - 1) / BGJS_LOCAL_STORAGE_PAGE_SIZE * BGJS_LOCAL_STORAGE_PAGE_SIZE;
+}
+
+static void writeHeader(uint8_t* data, size_t end) {
+	memcpy(data, BGJS_LOCAL_STORAGE_MAGIC, sizeof(BGJS_LOCAL_STORAGE_MAGIC) - 1);
+	writeUInt32(data + 8, BGJS_LOCAL_STORAGE_VERSION);
+	writeUInt32(data + 12, (uint32_t) end);
+}
+
+BGJSLocalStorage* BGJSLocalStorage::open(const std::string& path) {
+	static std::mutex mutex;
+	static std::unordered_map<std::string, BGJSLocalStorage*> stores;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = stores.find(path);
+	if (it != stores.end()) {
+		return it->second;
+	}
+
+	const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+	if (fd < 0) {
+		LOGE("Cannot open %s", path.c_str());
+		return nullptr;
+	}
+	struct stat info;
+	if (fstat(fd, &info) != 0) {
+		LOGE("Cannot stat %s", path.c_str());
+		::close(fd);
+		return nullptr;
+	}
+	BGJSLocalStorage* store = new BGJSLocalStorage(path, fd);
+	// a new file is empty and gets its header from readLog
+	const size_t size = roundToPages(std::max((size_t) info.st_size, (size_t) BGJS_LOCAL_STORAGE_HEADER_LENGTH));
+	if (((size_t) info.st_size != size && ftruncate(fd, size) != 0) || !store->map(size)) {
+		LOGE("Cannot map %s", path.c_str());
+		delete store;
+		return nullptr;
+	}
+	store->readLog();
+
+	// stores are never closed, a change may come in at any time until the process ends
+	stores[path] = store;
+	LOGI("Opened %s with %zu items", path.c_str(), store->_items.size());
+	return store;
+}
+
+BGJSLocalStorage::~BGJSLocalStorage() {
+	if (_data) {
+		munmap(_data, _size);
+	}
+	::close(_fd);
+}
+
+bool BGJSLocalStorage::map(size_t size) {
+	void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+	if (data == MAP_FAILED) {
+		return false;
+	}
+	if (_data) {
+		munmap(_data, _size);
+	}
+	_data = (uint8_t*) data;
+	_size = size;
+	return true;
+}
+
+void BGJSLocalStorage::readLog() {
+	_items.clear();
+	_liveBytes = 0;
+	if (memcmp(_data, BGJS_LOCAL_STORAGE_MAGIC, sizeof(BGJS_LOCAL_STORAGE_MAGIC) - 1) != 0 ||
+			readUInt32(_data + 8) != BGJS_LOCAL_STORAGE_VERSION) {
+		// items of unknown versions are dropped; localStorage is a cache by contract
+		_end = BGJS_LOCAL_STORAGE_HEADER_LENGTH;
+		writeHeader(_data, _end);
+		return;
+	}
+
+	const size_t end = std::min((size_t) readUInt32(_data + 12), _size);
+	size_t offset = BGJS_LOCAL_STORAGE_HEADER_LENGTH;
+	while (offset + 8 <= end) {
+		const size_t keyLength = readUInt32(_data + offset);
+		const uint32_t valueLength = readUInt32(_data + offset + 4);
+		const bool removed = valueLength == BGJS_LOCAL_STORAGE_REMOVED;
+		if (keyLength > end || (!removed && valueLength > end)) {
+			break;
+		}
+		const size_t length = recordLength(keyLength, removed ? 0 : valueLength);
+		if (length > end - offset) {
+			break;
+		}
+		std::u16string key(keyLength, 0);
+		memcpy(&key[0], _data + offset + 8, keyLength * sizeof(char16_t));
+		auto it = _items.find(key);
+		if (it != _items.end()) {
+			_liveBytes -= recordLength(it->first.size(), it->second.size());
+		}
+		if (removed) {
+			if (it != _items.end()) {
+				_items.erase(it);
+			}
+		} else {
+			std::u16string& value = _items[key];
+			value.resize(valueLength);
+			memcpy(&value[0], _data + offset + 8 + keyLength * sizeof(char16_t), valueLength * sizeof(char16_t));
+			_liveBytes += length;
+		}
+		offset += length;
+	}
+	_end = offset;
+	writeUInt32(_data + 12, (uint32_t) _end);
+}
+
+bool BGJSLocalStorage::getItem(const std::u16string& key, std::u16string* value) const {
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto it = _items.find(key);
+	if (it == _items.end()) {
+		return false;
+	}
+	*value = it->second;
+	return true;
+}
+
+bool BGJSLocalStorage::setItem(const std::u16string& key, const std::u16string& value) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto it = _items.find(key);
+	if (it != _items.end() && it->second == value) {
+		return true;
+	}
+	// the record goes first, a compaction on the way writes the items as they were before
+	if (!append(key, &value)) {
+		return false;
+	}
+	it = _items.find(key);
+	if (it != _items.end()) {
+		_liveBytes -= recordLength(it->first.size(), it->second.size());
+		it->second = value;
+	} else {
+		_items[key] = value;
+	}
+	_liveBytes += recordLength(key.size(), value.size());
+	return true;
+}
+
+void BGJSLocalStorage::removeItem(const std::u16string& key) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_items.find(key) == _items.end() || !append(key, nullptr)) {
+		return;
+	}
+	auto it = _items.find(key);
+	_liveBytes -= recordLength(it->first.size(), it->second.size());
+	_items.erase(it);
+}
+
+void BGJSLocalStorage::clear() {
+	std::lock_guard<std::mutex> lock(_mutex);
+	_items.clear();
+	_liveBytes = 0;
+	_end = BGJS_LOCAL_STORAGE_HEADER_LENGTH;
+	writeHeader(_data, _end);
+	// shrinking is optional, the header alone already empties the log
+	if (_size > BGJS_LOCAL_STORAGE_PAGE_SIZE && map(BGJS_LOCAL_STORAGE_PAGE_SIZE)) {
+		ftruncate(_fd, BGJS_LOCAL_STORAGE_PAGE_SIZE);
+	}
+}
+
+bool BGJSLocalStorage::key(size_t index, std::u16string* key) const {
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (index >= _items.size()) {
+		return false;
+	}
+	auto it = _items.begin();
+	std::advance(it, index);
+	*key = it->first;
+	return true;
+}
+
+size_t BGJSLocalStorage::length() const {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _items.size();
+}
+
+bool BGJSLocalStorage::append(const std::u16string& key, const std::u16string* value) {
+	const size_t length = recordLength(key.size(), value ? value->size() : 0);
+	if (length > _size - _end && !makeRoom(length)) {
+		return false;
+	}
+	uint8_t* record = _data + _end;
+	writeUInt32(record, (uint32_t) key.size());
+	writeUInt32(record + 4, value ? (uint32_t) value->size() : BGJS_LOCAL_STORAGE_REMOVED);
+	memcpy(record + 8, key.data(), key.size() * sizeof(char16_t));
+	if (value) {
+		memcpy(record + 8 + key.size() * sizeof(char16_t), value->data(), value->size() * sizeof(char16_t));
+	}
+	_end += length;
+	writeUInt32(_data + 12, (uint32_t) _end);
+	return true;
+}
+
+bool BGJSLocalStorage::makeRoom(size_t length) {
+	// compacting pays off when most of the log is outdated
+	if (_end >= BGJS_LOCAL_STORAGE_MIN_COMPACT_LENGTH && _end - BGJS_LOCAL_STORAGE_HEADER_LENGTH > 2 * _liveBytes &&
+			compact() && length <= _size - _end) {
+		return true;
+	}
+	if (_end + length > UINT32_MAX) {
+		LOGE("%s is full", _path.c_str());
+		return false;
+	}
+	const size_t size = roundToPages(std::max(_size * 2, _end + length));
+	if (ftruncate(_fd, size) != 0 || !map(size)) {
+		LOGE("Cannot grow %s to %zu bytes", _path.c_str(), size);
+		ftruncate(_fd, _size);
+		return false;
+	}
+	return true;
+}
+
+bool BGJSLocalStorage::compact() {
+	std::vector<uint8_t> log(BGJS_LOCAL_STORAGE_HEADER_LENGTH + _liveBytes);
+	size_t offset = BGJS_LOCAL_STORAGE_HEADER_LENGTH;
+	for (auto &item : _items) {
+		uint8_t* record = &log[offset];
+		writeUInt32(record, (uint32_t) item.first.size());
+		writeUInt32(record + 4, (uint32_t) item.second.size());
+		memcpy(record + 8, item.first.data(), item.first.size() * sizeof(char16_t));
+		memcpy(record + 8 + item.first.size() * sizeof(char16_t), item.second.data(),
+			   item.second.size() * sizeof(char16_t));
+		offset += recordLength(item.first.size(), item.second.size());
+	}
+	writeHeader(&log[0], log.size());
+
+	// the new log replaces the old one in one rename, so a crash keeps one of them
+	const std::string tmpPath = _path + ".tmp";
+	const int fd = ::open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+	if (fd < 0) {
+		LOGE("Cannot open %s", tmpPath.c_str());
+		return false;
+	}
+	const size_t size = roundToPages(log.size() * 2);
+	size_t written = 0;
+	while (written < log.size()) {
+		const ssize_t result = write(fd, &log[written], log.size() - written);
+		if (result <= 0) {
+			break;
+		}
+		written += result;
+	}
+	void* data = MAP_FAILED;
+	if (written == log.size() && ftruncate(fd, size) == 0 && fsync(fd) == 0) {
+		data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	}
+	if (data == MAP_FAILED || rename(tmpPath.c_str(), _path.c_str()) != 0) {
+		LOGE("Cannot compact %s", _path.c_str());
+		if (data != MAP_FAILED) {
+			munmap(data, size);
+		}
+		::close(fd);
+		unlink(tmpPath.c_str());
+		return false;
+	}
+
+	munmap(_data, _size);
+	::close(_fd);
+	_fd = fd;
+	_data = (uint8_t*) data;
+	_size = size;
+	LOGD("Compacted %s from %zu to %zu bytes", _path.c_str(), _end, log.size());
+	_end = log.size();
+	return true;
+}
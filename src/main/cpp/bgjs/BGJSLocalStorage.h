@@ -0,0 +1,64 @@
+#ifndef __BGJSLOCALSTORAGE_H
+#define __BGJSLOCALSTORAGE_H	1
+
+#include <map>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+
+/**
+ * BGJSLocalStorage
+ * Persistent string key-value store behind localStorage, kept in memory and in a memory mapped append-only log
+ *
+ * Every change appends one record to the mapped file, so setItem neither rewrites the file nor waits for the disk; the
+ * kernel writes the pages back. Once the log holds more than twice as much as the current items need, it is rewritten
+ * with only those items. Changes survive a crash of the app but not of the device; the file is not meant to be shared
+ * between processes.
+ *
+ * Layout, all numbers are 32 bit little endian:
+ *   "BGJSLSTR", version, length of the log including this header
+ *   per change: length of the key, length of the value or 0xFFFFFFFF if the item was removed, key and value in UTF-16
+ * A record is only part of the log once the length in the header includes it, so a crash can not leave half of one.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSLocalStorage {
+public:
+	// store of the file at path, shared by all engines of the process; NULL if the file can not be opened
+	static BGJSLocalStorage* open(const std::string& path);
+	~BGJSLocalStorage();
+
+	// false if there is no item for key
+	bool getItem(const std::u16string& key, std::u16string* value) const;
+	// false if the item could not be written, e.g. because the disk is full
+	bool setItem(const std::u16string& key, const std::u16string& value);
+	void removeItem(const std::u16string& key);
+	void clear();
+	// key of the item at index, in the order of the keys; false if index is out of range
+	bool key(size_t index, std::u16string* key) const;
+	size_t length() const;
+
+private:
+	BGJSLocalStorage(const std::string& path, int fd) : _path(path), _fd(fd), _data(nullptr), _size(0), _end(0),
+		_liveBytes(0) {}
+	BGJSLocalStorage(const BGJSLocalStorage&) = delete;
+	BGJSLocalStorage& operator=(const BGJSLocalStorage&) = delete;
+
+	bool map(size_t size);
+	void readLog();
+	bool append(const std::u16string& key, const std::u16string* value);
+	bool makeRoom(size_t length);
+	bool compact();
+
+	mutable std::mutex _mutex;
+	const std::string _path;
+	int _fd;
+	uint8_t* _data;
+	size_t _size;			// of the file and the mapping
+	size_t _end;			// of the log
+	size_t _liveBytes;		// that the records of the current items take up
+	std::map<std::u16string, std::u16string> _items;
+};
+
+#endif
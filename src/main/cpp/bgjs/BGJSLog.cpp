@@ -0,0 +1,197 @@
+/**
+ * BGJSLog
+ * Asynchronous log of the console functions
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSLog.h"
+
+#include <android/log.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+namespace {
+
+const uint32_t kRecords = 256;	// a power of two
+const size_t kTextLength = 480;
+
+/**
+ * a message in the ring, as in the bounded queue of Dmitry Vyukov: a record at position p of the log can be claimed
+ * while its sequence is p, holds the message once it is p + 1 and is written to logcat once it is p + kRecords,
+ * which is the position it holds the next message of
+ */
+struct Record {
+	std::atomic<uint32_t> sequence;
+	int level;
+	const char* tag;
+	int64_t time;		// ms since the epoch
+	char* overflow;		// all of a message longer than text, freed by the log thread once it is written
+	char text[kTextLength];
+};
+
+struct Ring {
+	Record records[kRecords];
+	std::atomic<uint32_t> enqueuePos;
+	std::atomic<uint32_t> dropped;
+
+	Ring() : enqueuePos(0), dropped(0) {
+		for (uint32_t i = 0; i < kRecords; i++) {
+			records[i].sequence.store(i, std::memory_order_relaxed);
+			records[i].overflow = nullptr;
+		}
+	}
+};
+
+Ring ring;
+
+std::atomic<bool> threadStarted(false);
+/*
+ * the log thread sleeps until a message is published. It announces that in sleeping before it checks the next record
+ * once more, and producers check sleeping after they published, so one of both always sees the other; producers only
+ * take the mutex then, so the wakeup can not get lost between the check and the wait
+ */
+std::mutex wakeMutex;
+std::condition_variable wake;
+std::atomic<bool> sleeping(false);
+
+int64_t now() {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+void drain() {
+	uint32_t pos = 0;
+	for (;;) {
+		Record &record = ring.records[pos & (kRecords - 1)];
+		if (record.sequence.load(std::memory_order_acquire) == pos + 1) {
+			const uint32_t dropped = ring.dropped.exchange(0, std::memory_order_relaxed);
+			if (dropped) {
+				__android_log_print(ANDROID_LOG_WARN, "BGJSLog", "%u messages were dropped", dropped);
+			}
+			__android_log_write(record.level, record.tag, record.overflow ? record.overflow : record.text);
+			free(record.overflow);
+			record.overflow = nullptr;
+			record.sequence.store(pos + kRecords, std::memory_order_release);
+			pos++;
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(wakeMutex);
+		sleeping.store(true);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		wake.wait(lock, [&record, pos] { return record.sequence.load(std::memory_order_acquire) == pos + 1; });
+		sleeping.store(false);
+	}
+}
+
+}
+
+void BGJSLog::write(int level, const char* tag, const char* message, size_t length) {
+	if (!threadStarted.load(std::memory_order_relaxed) && !threadStarted.exchange(true)) {
+		std::thread(drain).detach();
+	}
+
+	uint32_t pos = ring.enqueuePos.load(std::memory_order_relaxed);
+	Record* record;
+	for (;;) {
+		record = &ring.records[pos & (kRecords - 1)];
+		const int32_t diff = (int32_t)(record->sequence.load(std::memory_order_acquire) - pos);
+		if (diff == 0) {
+			if (ring.enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+				// breadcrumbs that see any of the message below also see the claim
+				std::atomic_thread_fence(std::memory_order_release);
+				break;
+			}
+		} else if (diff < 0) {
+			// full; errors are not lost, even if they overtake the messages before them
+			if (level >= ANDROID_LOG_ERROR) {
+				__android_log_write(level, tag, std::string(message, length).c_str());
+			} else {
+				ring.dropped.fetch_add(1, std::memory_order_relaxed);
+			}
+			return;
+		} else {
+			pos = ring.enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	record->level = level;
+	record->tag = tag;
+	record->time = now();
+	size_t inlineLength = length < kTextLength - 1 ? length : kTextLength - 1;
+	// breadcrumbs end up in java strings, so messages are not cut off inside a character
+	while (inlineLength < length && inlineLength > 0 && (message[inlineLength] & 0xc0) == 0x80) {
+		inlineLength--;
+	}
+	memcpy(record->text, message, inlineLength);
+	record->text[inlineLength] = 0;
+	record->overflow = nullptr;
+	if (length > inlineLength) {
+		record->overflow = (char*)malloc(length + 1);
+		if (record->overflow) {
+			memcpy(record->overflow, message, length);
+			record->overflow[length] = 0;
+		}
+	}
+	record->sequence.store(pos + 1, std::memory_order_release);
+
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (sleeping.load(std::memory_order_relaxed)) {
+		std::lock_guard<std::mutex> lock(wakeMutex);
+		wake.notify_one();
+	}
+}
+
+std::string BGJSLog::breadcrumbs() {
+	static const char kLevels[] = "??VDIWEF";
+	std::string result;
+	const uint32_t end = ring.enqueuePos.load(std::memory_order_acquire);
+	const uint32_t start = end < kRecords ? 0 : end - kRecords;
+	char text[kTextLength];
+	for (uint32_t pos = start; pos != end; pos++) {
+		Record &record = ring.records[pos & (kRecords - 1)];
+		const uint32_t sequence = record.sequence.load(std::memory_order_acquire);
+		if (sequence != pos + 1 && sequence != pos + kRecords) {
+			continue;
+		}
+		const int level = record.level;
+		const char* tag = record.tag;
+		const time_t seconds = (time_t)(record.time / 1000);
+		const int millis = (int)(record.time % 1000);
+		strncpy(text, record.text, kTextLength - 1);
+		text[kTextLength - 1] = 0;
+
+		/*
+		 * skip records that changed while they were copied: the sequence may only have moved on from filled to
+		 * written, and a position past this one was claimed for a newer message that may be half written
+		 */
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const uint32_t after = record.sequence.load(std::memory_order_relaxed);
+		if ((after != sequence && after != pos + kRecords) ||
+				(int32_t)(ring.enqueuePos.load(std::memory_order_relaxed) - (pos + kRecords)) > 0) {
+			continue;
+		}
+
+		struct tm local;
+		localtime_r(&seconds, &local);
+		char prefix[64];
+		snprintf(prefix, sizeof(prefix), "%02d:%02d:%02d.%03d %c ", local.tm_hour, local.tm_min, local.tm_sec, millis,
+				 level >= 0 && level < (int)sizeof(kLevels) - 1 ? kLevels[level] : '?');
+		result += prefix;
+		result += tag ? tag : "";
+		result += ": ";
+		result += text;
+		result += '\n';
+	}
+	return result;
+}
@@ -0,0 +1,36 @@
+#ifndef __BGJSLOG_H
+#define __BGJSLOG_H	1
+
+#include <stddef.h>
+#include <string>
+
+/**
+ * BGJSLog
+ * Asynchronous log of the console functions of all engines and workers
+ *
+ * Writing to logcat takes a syscall per message, which is too slow for the js thread of scripts that log every
+ * frame. Messages are copied into a ring of fixed records instead, which producers claim without a lock, and a
+ * background thread writes them to logcat in order. When the ring is full, debug and info messages are dropped and
+ * counted, while errors are written right away. The records stay in the ring after they were written, so the latest
+ * messages can be added to crash reports.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSLog {
+public:
+	/**
+	 * queues message for logcat with the android log priority level; tag has to be a string literal, as the record
+	 * keeps a pointer to it. Never waits for logcat, and only takes a lock to wake the log thread when it sleeps;
+	 * may be called on any thread
+	 */
+	static void write(int level, const char* tag, const char* message, size_t length);
+
+	/**
+	 * the latest messages, oldest first, one per line with the time they were logged at; messages that are longer
+	 * than a record are cut off. Best effort while other threads keep logging
+	 */
+	static std::string breadcrumbs();
+};
+
+#endif
@@ -0,0 +1,90 @@
+#include "BGJSOffscreenCanvasContext.h"
+
+#include "../ejecta/EJCanvas/EJGLBackend.h"
+#include "../ejecta/EJCanvas/EJGLState.h"
+
+#include "os-android.h"
+
+#include <algorithm>
+
+#define LOG_TAG "BGJSOffscreenCanvasContext"
+
+
+/**
+ * BGJSOffscreenCanvasContext
+ * 2d context of a canvas that renders into a texture
+ *
+ * Licensed under the MIT license.
+ */
+
+BGJSOffscreenCanvasContext::BGJSOffscreenCanvasContext(int width, int height, EJCanvasResources *resources, int samples) :
+		BGJSCanvasContext(std::max(width, 1), std::max(height, 1), resources) {
+	_requestedWidth = this->width;
+	_requestedHeight = this->height;
+	_requestedSamples = samples;
+	createFramebuffer();
+}
+
+BGJSOffscreenCanvasContext::~BGJSOffscreenCanvasContext() {
+	deleteFramebuffer();
+}
+
+void BGJSOffscreenCanvasContext::createFramebuffer() {
+	_texture = EJTexture::initWithWidth(width, height);
+	_framebuffer = backend->createFramebuffer(_texture->textureId, _texture->realWidth, _texture->realHeight,
+			_requestedSamples, &_stencil);
+	msaaEnabled = NO;
+	if (!_framebuffer) {
+		LOGE("cannot create framebuffer of %dx%d for offscreen canvas", width, height);
+		return;
+	}
+
+	// the backend falls back to a plain framebuffer if multisampling is not supported
+	GLint samples = 0;
+	glGetIntegerv(GL_SAMPLES, &samples);
+	msaaSamples = samples;
+	msaaEnabled = samples > 1;
+
+	// new textures hold undefined pixels; canvases start out transparent
+	GLfloat clearColor[4];
+	glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+	glClearColor(0, 0, 0, 0);
+	glClear(GL_COLOR_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+	glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+	EJ_CHECK_GL_ERROR("createFramebuffer");
+}
+
+void BGJSOffscreenCanvasContext::deleteFramebuffer() {
+	backend->deleteFramebuffer(_framebuffer, _stencil);
+	_framebuffer = _stencil = 0;
+	delete _texture;
+	_texture = nullptr;
+}
+
+void BGJSOffscreenCanvasContext::requestSize(int widthp, int heightp) {
+	_requestedWidth = std::max(widthp, 1);
+	_requestedHeight = std::max(heightp, 1);
+}
+
+void BGJSOffscreenCanvasContext::activate() {
+	if (needsResize()) {
+		// nothing refers to the old texture, since only the current context has unflushed draws
+		deleteFramebuffer();
+		viewportWidth = bufferWidth = width = _requestedWidth;
+		viewportHeight = bufferHeight = height = _requestedHeight;
+		createFramebuffer();
+	}
+	BGJSCanvasContext::activate();
+}
+
+void BGJSOffscreenCanvasContext::startRendering() {
+	_isRendering = YES;
+	frameBegun = false;
+	resetFrameArena();
+}
+
+void BGJSOffscreenCanvasContext::endRendering() {
+	// a context that was not drawn into in this frame does not need its stencil cleared any more
+	_isRendering = NO;
+	frameBegun = true;
+}
@@ -0,0 +1,54 @@
+#ifndef __BGJSOFFSCREENCANVASCONTEXT_H
+#define __BGJSOFFSCREENCANVASCONTEXT_H	1
+
+#include "BGJSCanvasContext.h"
+#include "../ejecta/EJCanvas/EJTexture.h"
+
+/**
+ * BGJSOffscreenCanvasContext
+ * 2d context of a canvas that is not on screen; it draws into a texture through a framebuffer object,
+ * so the canvas can be drawn into other contexts with drawImage
+ *
+ * Offscreen contexts share the gl context of the view that created them, which also switches between them. The
+ * framebuffer is in gl orientation like the window surface, so the texture is upside down compared to images.
+ * Resizing is deferred to the next time the context is activated, since gl calls are only possible while rendering.
+ * With samples > 1 the framebuffer is multisampled if the gl can resolve it into the texture on tile memory.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSOffscreenCanvasContext : public BGJSCanvasContext {
+public:
+	BGJSOffscreenCanvasContext(int width, int height, EJCanvasResources *resources, int samples = 0);
+	~BGJSOffscreenCanvasContext();
+
+	void activate();
+
+	// the view runs all of its contexts in its frames, but only flushes the one that is current
+	void startRendering();
+	void endRendering();
+
+	// the canvas is cleared, like a resized html canvas
+	void requestSize(int width, int height);
+	int requestedWidth() const { return _requestedWidth; }
+	int requestedHeight() const { return _requestedHeight; }
+	bool needsResize() const { return _requestedWidth != width || _requestedHeight != height; }
+
+	// null if the framebuffer could not be created
+	EJTexture* texture() { return _framebuffer ? _texture : NULL; }
+
+protected:
+	GLuint framebuffer() { return _framebuffer; }
+
+private:
+	void createFramebuffer();
+	void deleteFramebuffer();
+
+	EJTexture *_texture = nullptr;
+	GLuint _framebuffer = 0;
+	GLuint _stencil = 0;
+	int _requestedWidth, _requestedHeight;
+	int _requestedSamples;
+};
+
+#endif
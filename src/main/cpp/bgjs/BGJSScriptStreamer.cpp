@@ -0,0 +1,98 @@
+/**
+ * BGJSScriptStreamer
+ * Parses and compiles the source of a module on a worker thread of the platform
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSScriptStreamer.h"
+
+#include <string.h>
+
+using namespace v8;
+
+/**
+ * hands the whole source to v8 in a single chunk; v8 takes ownership of it
+ */
+class BGJSScriptStreamer::Stream : public ScriptCompiler::ExternalSourceStream {
+public:
+	explicit Stream(std::string source) : _source(std::move(source)), _isConsumed(false) {}
+
+	size_t GetMoreData(const uint8_t** src) override {
+		if (_isConsumed || _source.empty()) {
+			return 0;
+		}
+		_isConsumed = true;
+		uint8_t* data = new uint8_t[_source.length()];
+		memcpy(data, _source.data(), _source.length());
+		*src = data;
+		const size_t length = _source.length();
+		// the copy is all v8 needs from now on
+		std::string().swap(_source);
+		return length;
+	}
+
+private:
+	std::string _source;
+	bool _isConsumed;
+};
+
+class BGJSScriptStreamer::WorkerTask : public Task {
+public:
+	explicit WorkerTask(std::shared_ptr<BGJSScriptStreamer> streamer) : _streamer(std::move(streamer)) {}
+
+	void Run() override {
+		_streamer->run();
+	}
+
+private:
+	const std::shared_ptr<BGJSScriptStreamer> _streamer;
+};
+
+BGJSScriptStreamer::BGJSScriptStreamer(std::string source) :
+		_source(new ScriptCompiler::StreamedSource(new Stream(std::move(source)),
+												   ScriptCompiler::StreamedSource::UTF8)),
+		_state(kStateQueued) {
+}
+
+std::shared_ptr<BGJSScriptStreamer> BGJSScriptStreamer::start(Isolate* isolate, Platform* platform,
+															  std::string source) {
+	std::shared_ptr<BGJSScriptStreamer> streamer(new BGJSScriptStreamer(std::move(source)));
+	streamer->_task.reset(ScriptCompiler::StartStreamingScript(isolate, streamer->_source.get()));
+	platform->CallOnWorkerThread(std::unique_ptr<Task>(new WorkerTask(streamer)));
+	return streamer;
+}
+
+bool BGJSScriptStreamer::run() {
+	int expected = kStateQueued;
+	if (!_state.compare_exchange_strong(expected, kStateRunning)) {
+		return false;
+	}
+	_task->Run();
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_state = kStateDone;
+	}
+	_done.notify_all();
+	return true;
+}
+
+void BGJSScriptStreamer::wait() {
+	std::unique_lock<std::mutex> lock(_mutex);
+	_done.wait(lock, [this] { return _state != kStateRunning; });
+}
+
+MaybeLocal<Script> BGJSScriptStreamer::finish(Local<Context> context, Local<String> fullSource,
+											  const ScriptOrigin& origin) {
+	if (!run()) {
+		wait();
+	}
+	return ScriptCompiler::Compile(context, _source.get(), fullSource, origin);
+}
+
+void BGJSScriptStreamer::cancel() {
+	int expected = kStateQueued;
+	if (!_state.compare_exchange_strong(expected, kStateDone)) {
+		wait();
+	}
+}
@@ -0,0 +1,69 @@
+#ifndef __BGJSSCRIPTSTREAMER_H
+#define __BGJSSCRIPTSTREAMER_H	1
+
+#include <v8.h>
+#include <v8-platform.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * BGJSScriptStreamer
+ * Parses and compiles the source of a module on a worker thread of the platform, behind require.preload
+ *
+ * v8 does the work in a streaming task that only needs the source, not the isolate lock; the js thread finalizes
+ * the script once the module is required. If the module is required before a worker got to the task, it runs on
+ * the js thread instead of being waited for.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSScriptStreamer : public std::enable_shared_from_this<BGJSScriptStreamer> {
+public:
+	/**
+	 * starts compiling source on a worker thread; source is the UTF-8 source exactly as it will be passed to
+	 * finish(). Has to be called with the isolate locked.
+	 */
+	static std::shared_ptr<BGJSScriptStreamer> start(v8::Isolate* isolate, v8::Platform* platform, std::string source);
+
+	/**
+	 * waits for the compilation and returns the script; fullSource has to be the v8 string of the source passed
+	 * to start(). Has to be called on the js thread.
+	 */
+	v8::MaybeLocal<v8::Script> finish(v8::Local<v8::Context> context, v8::Local<v8::String> fullSource,
+									  const v8::ScriptOrigin& origin);
+
+	/**
+	 * makes sure the task is not run anymore and waits for it if it is running already
+	 * has to be called before the isolate is disposed for every streamer that was not finished
+	 */
+	void cancel();
+
+private:
+	enum State {
+		kStateQueued,
+		kStateRunning,
+		kStateDone
+	};
+
+	class Stream;
+	class WorkerTask;
+
+	explicit BGJSScriptStreamer(std::string source);
+	BGJSScriptStreamer(const BGJSScriptStreamer&) = delete;
+	BGJSScriptStreamer& operator=(const BGJSScriptStreamer&) = delete;
+
+	// runs the streaming task unless another thread took it already; returns false in that case
+	bool run();
+	void wait();
+
+	std::unique_ptr<v8::ScriptCompiler::StreamedSource> _source;
+	std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> _task;
+	std::atomic<int> _state;
+	std::mutex _mutex;
+	std::condition_variable _done;
+};
+
+#endif
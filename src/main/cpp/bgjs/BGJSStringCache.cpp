@@ -0,0 +1,69 @@
+/**
+ * BGJSStringCache
+ * Cache of internalized v8 strings for short property names passed in from java
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSStringCache.h"
+
+#include <string.h>
+
+BGJSStringCache::BGJSStringCache() {
+	for (int set = 0; set < kSets; set++) {
+		for (int way = 0; way < kWays; way++) {
+			_entries[set][way].length = 0;
+			_entries[set][way].hash = 0;
+		}
+		_lru[set] = 0;
+	}
+}
+
+v8::Local<v8::String> BGJSStringCache::get(v8::Isolate *isolate, const uint16_t *chars, int length) {
+	v8::EscapableHandleScope scope(isolate);
+
+	v8::Local<v8::String> string;
+	if (length <= 0 || length > kMaxLength) {
+		if (!v8::String::NewFromTwoByte(isolate, chars, v8::NewStringType::kInternalized, length).ToLocal(&string)) {
+			string = v8::String::Empty(isolate);
+		}
+		return scope.Escape(string);
+	}
+
+	// FNV-1a
+	uint32_t hash = 2166136261u;
+	for (int i = 0; i < length; i++) {
+		hash = (hash ^ chars[i]) * 16777619u;
+	}
+
+	const int set = (int) ((hash ^ (hash >> kSetBits)) & (kSets - 1));
+	for (int way = 0; way < kWays; way++) {
+		Entry &entry = _entries[set][way];
+		if (entry.hash == hash && entry.length == length && !entry.string.IsEmpty() &&
+			!memcmp(entry.chars, chars, length * sizeof(uint16_t))) {
+			_lru[set] = (uint8_t) (1 - way);
+			return scope.Escape(v8::Local<v8::String>::New(isolate, entry.string));
+		}
+	}
+
+	string = v8::String::NewFromTwoByte(isolate, chars, v8::NewStringType::kInternalized, length).ToLocalChecked();
+
+	const int way = _lru[set];
+	Entry &entry = _entries[set][way];
+	entry.string.Reset(isolate, string);
+	entry.hash = hash;
+	entry.length = (uint8_t) length;
+	memcpy(entry.chars, chars, length * sizeof(uint16_t));
+	_lru[set] = (uint8_t) (1 - way);
+
+	return scope.Escape(string);
+}
+
+void BGJSStringCache::clear() {
+	for (int set = 0; set < kSets; set++) {
+		for (int way = 0; way < kWays; way++) {
+			_entries[set][way].string.Reset();
+			_entries[set][way].length = 0;
+		}
+	}
+}
@@ -0,0 +1,49 @@
+#ifndef __BGJSSTRINGCACHE_H
+#define __BGJSSTRINGCACHE_H	1
+
+#include <v8.h>
+#include <stdint.h>
+
+/**
+ * BGJSStringCache
+ * Cache of internalized v8 strings for short property names passed in from java
+ *
+ * Two-way set associative; every set evicts its least recently used entry.
+ * Lookups hash the utf-16 code units directly, so a hit neither allocates nor has v8 create or internalize a string.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSStringCache {
+public:
+	static const int kMaxLength = 32;	// longer strings are not cached
+
+	BGJSStringCache();
+
+	/**
+	 * returns an internalized string with the specified contents
+	 */
+	v8::Local<v8::String> get(v8::Isolate *isolate, const uint16_t *chars, int length);
+
+	/**
+	 * releases all cached strings; has to be called before the isolate is disposed
+	 */
+	void clear();
+
+private:
+	static const int kSetBits = 8;
+	static const int kSets = 1 << kSetBits;
+	static const int kWays = 2;
+
+	struct Entry {
+		v8::Global<v8::String> string;
+		uint32_t hash;
+		uint8_t length;
+		uint16_t chars[kMaxLength];
+	};
+
+	Entry _entries[kSets][kWays];
+	uint8_t _lru[kSets];	// way that is replaced next
+};
+
+#endif
@@ -0,0 +1,149 @@
+/**
+ * BGJSTaskScheduler
+ * Priority lanes for the work of the js thread
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSTaskScheduler.h"
+#include "BGJSV8Engine.h"
+
+#include <math.h>
+#include <string.h>
+#include <time.h>
+
+#define LOG_TAG "BGJSTaskScheduler"
+
+using namespace v8;
+
+// user-visible and background tasks give the looper of the js thread a chance after this many ms
+#define BGJS_TASK_SLICE_MS 5
+// views that did not render for this long are not expected to render the next frame, in ms
+#define BGJS_TASK_FRAME_TIMEOUT_MS 100
+
+static double getMonotonicTime() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+BGJSTaskScheduler::BGJSTaskScheduler() : _count(0), _frameStart(0), _frameInterval(0) {
+}
+
+bool BGJSTaskScheduler::post(Isolate* isolate, Local<Function> callback, Local<Promise::Resolver> resolver,
+							 BGJSTaskPriority priority) {
+	Task task;
+	task.callback.Reset(isolate, callback);
+	task.resolver.Reset(isolate, resolver);
+	task.nativeTask = nullptr;
+	task.data = nullptr;
+	return push(std::move(task), priority);
+}
+
+bool BGJSTaskScheduler::post(NativeTask nativeTask, void* data, BGJSTaskPriority priority) {
+	Task task;
+	task.nativeTask = nativeTask;
+	task.data = data;
+	return push(std::move(task), priority);
+}
+
+bool BGJSTaskScheduler::push(Task&& task, BGJSTaskPriority priority) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	_lanes[priority].push_back(std::move(task));
+	return _count++ == 0;
+}
+
+void BGJSTaskScheduler::run(BGJSV8Engine* engine, BGJSTaskPriority priority, double deadline) {
+	Isolate* isolate = engine->getIsolate();
+	Local<Context> context = engine->getContext();
+
+	// tasks posted by the tasks wait for the next tick, so a task that posts itself does not starve the looper
+	size_t count;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		count = _lanes[priority].size();
+	}
+	bool settled = false;
+	for (size_t i = 0; i < count; i++) {
+		if (i > 0 && getMonotonicTime() >= deadline) {
+			break;
+		}
+		Task task;
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			task = std::move(_lanes[priority].front());
+			_lanes[priority].pop_front();
+			_count--;
+		}
+		if (task.nativeTask) {
+			task.nativeTask(engine, task.data);
+			continue;
+		}
+
+		HandleScope scope(isolate);
+		TryCatch trycatch(isolate);
+		Local<Function> callback = Local<Function>::New(isolate, task.callback);
+		Local<Promise::Resolver> resolver = Local<Promise::Resolver>::New(isolate, task.resolver);
+		Local<Value> result;
+		if (callback->Call(context, context->Global(), 0, nullptr).ToLocal(&result)) {
+			resolver->Resolve(context, result).FromMaybe(false);
+		} else if (trycatch.CanContinue()) {
+			// like in browsers, the exception rejects the promise of the task instead of being reported
+			resolver->Reject(context, trycatch.Exception()).FromMaybe(false);
+		}
+		settled = true;
+	}
+	if (settled) {
+		isolate->RunMicrotasks();
+	}
+}
+
+bool BGJSTaskScheduler::hasTasks() const {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _count > 0;
+}
+
+bool BGJSTaskScheduler::hasTasks(BGJSTaskPriority priority) const {
+	std::lock_guard<std::mutex> lock(_mutex);
+	return !_lanes[priority].empty();
+}
+
+void BGJSTaskScheduler::onFrame(double start, double interval) {
+	_frameStart = start;
+	_frameInterval = interval;
+}
+
+double BGJSTaskScheduler::sliceDeadline() const {
+	const double now = getMonotonicTime();
+	double deadline = now + BGJS_TASK_SLICE_MS;
+	if (_frameInterval > 0 && now >= _frameStart && now - _frameStart < BGJS_TASK_FRAME_TIMEOUT_MS) {
+		// frames keep to the vsync grid, so the next one is expected a whole number of intervals after the last
+		const double nextFrame = _frameStart + ceil((now - _frameStart) / _frameInterval) * _frameInterval;
+		deadline = fmin(deadline, nextFrame);
+	}
+	return deadline;
+}
+
+bool BGJSTaskScheduler::parsePriority(Isolate* isolate, Local<Value> value, BGJSTaskPriority* priority) {
+	if (value->IsUndefined()) {
+		*priority = kTaskPriorityUserVisible;
+		return true;
+	}
+	if (!value->IsString()) {
+		return false;
+	}
+	String::Utf8Value name(isolate, value);
+	if (!*name) {
+		return false;
+	}
+	if (strcmp(*name, "user-blocking") == 0) {
+		*priority = kTaskPriorityUserBlocking;
+	} else if (strcmp(*name, "user-visible") == 0) {
+		*priority = kTaskPriorityUserVisible;
+	} else if (strcmp(*name, "background") == 0) {
+		*priority = kTaskPriorityBackground;
+	} else {
+		return false;
+	}
+	return true;
+}
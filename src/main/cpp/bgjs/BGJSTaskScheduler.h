@@ -0,0 +1,79 @@
+#ifndef __BGJSTASKSCHEDULER_H
+#define __BGJSTASKSCHEDULER_H	1
+
+#include <v8.h>
+#include <deque>
+#include <mutex>
+
+class BGJSV8Engine;
+
+/**
+ * BGJSTaskScheduler
+ * Priority lanes for the work of the js thread of a BGJSV8Engine, behind scheduler.postTask
+ *
+ * user-blocking tasks run at the start of every tick, before the timers. user-visible tasks, e.g. network callbacks,
+ * and background tasks run after the timers in slices of a few ms, background ones only when no user-visible one is
+ * left. A slice also ends when the next frame of a view is due, so queued tasks do not hold the isolate lock that
+ * the frame waits for; what is left runs in the next tick, once the looper of the js thread got to its other messages.
+ *
+ * Licensed under the MIT license.
+ */
+
+enum BGJSTaskPriority {
+	kTaskPriorityUserBlocking = 0,
+	kTaskPriorityUserVisible,
+	kTaskPriorityBackground,
+	kTaskPriorityCount
+};
+
+class BGJSTaskScheduler {
+public:
+	typedef void (*NativeTask) (BGJSV8Engine* engine, void* data);
+
+	BGJSTaskScheduler();
+
+	/**
+	 * queues a js callback whose result settles resolver; has to be called with the isolate locked
+	 * returns true if no task was queued before, so the engine has to ask for a tick
+	 */
+	bool post(v8::Isolate* isolate, v8::Local<v8::Function> callback, v8::Local<v8::Promise::Resolver> resolver,
+			  BGJSTaskPriority priority);
+	/**
+	 * queues a native task; can be called from any thread
+	 */
+	bool post(NativeTask task, void* data, BGJSTaskPriority priority);
+
+	/**
+	 * runs the tasks of priority that were queued when it was called, until deadline in ms of CLOCK_MONOTONIC
+	 * has to be called on the js thread with the isolate locked; at least one task is run if there is one
+	 */
+	void run(BGJSV8Engine* engine, BGJSTaskPriority priority, double deadline);
+	bool hasTasks() const;
+	bool hasTasks(BGJSTaskPriority priority) const;
+
+	/**
+	 * a view rendered a frame that started at start and should take interval ms
+	 */
+	void onFrame(double start, double interval);
+	// end of a slice of user-visible and background tasks that starts now
+	double sliceDeadline() const;
+
+	static bool parsePriority(v8::Isolate* isolate, v8::Local<v8::Value> value, BGJSTaskPriority* priority);
+
+private:
+	struct Task {
+		v8::Global<v8::Function> callback;
+		v8::Global<v8::Promise::Resolver> resolver;
+		NativeTask nativeTask;
+		void* data;
+	};
+
+	bool push(Task&& task, BGJSTaskPriority priority);
+
+	mutable std::mutex _mutex;
+	std::deque<Task> _lanes[kTaskPriorityCount];
+	size_t _count;
+	double _frameStart, _frameInterval;
+};
+
+#endif
@@ -0,0 +1,189 @@
+/**
+ * BGJSTimerWheel
+ * Hierarchical timer wheel backing setTimeout/setInterval of a BGJSV8Engine
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSTimerWheel.h"
+
+#include <algorithm>
+
+BGJSTimerWheel::BGJSTimerWheel() {
+	memset(_slots, 0, sizeof(_slots));
+	memset(_occupied, 0, sizeof(_occupied));
+	_current = 0;
+	_count = 0;
+	_free = nullptr;
+}
+
+BGJSTimerWheel::~BGJSTimerWheel() {
+	for (auto slab : _slabs) {
+		delete[] slab;
+	}
+}
+
+BGJSTimer* BGJSTimerWheel::allocate() {
+	if (!_free) {
+		BGJSTimer *slab = new BGJSTimer[kSlabSize];
+		for (int i = 0; i < kSlabSize - 1; i++) {
+			slab[i].next = &slab[i + 1];
+		}
+		slab[kSlabSize - 1].next = nullptr;
+		_slabs.push_back(slab);
+		_free = slab;
+	}
+
+	BGJSTimer *timer = _free;
+	_free = timer->next;
+
+	timer->prev = timer->next = nullptr;
+	timer->level = kNotScheduled;
+	timer->cancelled = false;
+	timer->recurring = false;
+	return timer;
+}
+
+void BGJSTimerWheel::release(BGJSTimer *timer) {
+	if (isScheduled(timer)) {
+		unschedule(timer);
+	}
+	timer->callback.Reset();
+	timer->thisObj.Reset();
+	timer->next = _free;
+	_free = timer;
+}
+
+void BGJSTimerWheel::schedule(BGJSTimer *timer, uint64_t now, uint32_t delay) {
+	// nothing is pending, so there is no reason to walk through the time that passed since the last tick
+	if (!_count && now > _current) {
+		_current = now;
+	}
+	timer->expires = std::max(now + delay, _current + 1);
+	insert(timer);
+}
+
+void BGJSTimerWheel::unschedule(BGJSTimer *timer) {
+	if (timer->prev) {
+		timer->prev->next = timer->next;
+	} else {
+		_slots[timer->level][timer->slot] = timer->next;
+		if (!timer->next) {
+			_occupied[timer->level] &= ~(1ULL << timer->slot);
+		}
+	}
+	if (timer->next) {
+		timer->next->prev = timer->prev;
+	}
+	timer->prev = timer->next = nullptr;
+	timer->level = kNotScheduled;
+	_count--;
+}
+
+bool BGJSTimerWheel::isScheduled(const BGJSTimer *timer) const {
+	return timer->level != kNotScheduled;
+}
+
+size_t BGJSTimerWheel::size() const {
+	return _count;
+}
+
+void BGJSTimerWheel::insert(BGJSTimer *timer) {
+	const uint64_t delta = timer->expires > _current ? timer->expires - _current : 0;
+
+	int level;
+	uint64_t slot;
+	if (delta >= (1ULL << (kLevels * kSlotBits))) {
+		// too far in the future; park it in the slot of the top level that is cascaded last
+		level = kLevels - 1;
+		slot = (_current >> (level * kSlotBits)) + kSlots - 1;
+	} else {
+		level = 0;
+		while (delta >= (1ULL << ((level + 1) * kSlotBits))) {
+			level++;
+		}
+		slot = timer->expires >> (level * kSlotBits);
+	}
+	slot &= kSlotMask;
+
+	BGJSTimer *&head = _slots[level][slot];
+	timer->prev = nullptr;
+	timer->next = head;
+	if (head) {
+		head->prev = timer;
+	}
+	head = timer;
+	timer->level = (uint8_t) level;
+	timer->slot = (uint8_t) slot;
+	_occupied[level] |= 1ULL << slot;
+	_count++;
+}
+
+void BGJSTimerWheel::cascade(int level) {
+	const int slot = (int) ((_current >> (level * kSlotBits)) & kSlotMask);
+	BGJSTimer *timer = _slots[level][slot];
+	_slots[level][slot] = nullptr;
+	_occupied[level] &= ~(1ULL << slot);
+
+	while (timer) {
+		BGJSTimer *next = timer->next;
+		_count--;
+		insert(timer);
+		timer = next;
+	}
+}
+
+void BGJSTimerWheel::advance(uint64_t now, std::vector<BGJSTimer*> &due) {
+	while (_current < now) {
+		// jump straight to the next slot that either expires or has to be cascaded
+		const uint64_t next = nextTick();
+		if (next > now) {
+			_current = now;
+			break;
+		}
+		_current = next;
+
+		// higher levels first, so timers can trickle down more than one level at once
+		for (int level = kLevels - 1; level > 0; level--) {
+			if ((_current & ((1ULL << (level * kSlotBits)) - 1)) == 0) {
+				cascade(level);
+			}
+		}
+
+		const int slot = (int) (_current & kSlotMask);
+		const size_t first = due.size();
+		while (BGJSTimer *timer = _slots[0][slot]) {
+			unschedule(timer);
+			due.push_back(timer);
+		}
+
+		// slots are lifo; timers expiring at the same time have to run in the order they were created in
+		std::sort(due.begin() + first, due.end(), [](const BGJSTimer *a, const BGJSTimer *b) {
+			return a->id < b->id;
+		});
+	}
+}
+
+uint64_t BGJSTimerWheel::nextTick() const {
+	if (!_count) {
+		return UINT64_MAX;
+	}
+
+	uint64_t best = UINT64_MAX;
+	for (int level = 0; level < kLevels; level++) {
+		const uint64_t occupied = _occupied[level];
+		if (!occupied) {
+			continue;
+		}
+		const int shift = level * kSlotBits;
+		const uint64_t position = _current >> shift;
+
+		// rotate so that bit 0 is the slot after the current one
+		const int rotation = (int) ((position + 1) & kSlotMask);
+		const uint64_t rotated = (occupied >> rotation) | (occupied << ((kSlots - rotation) & kSlotMask));
+		const uint64_t distance = (uint64_t) __builtin_ctzll(rotated) + 1;
+
+		best = std::min(best, (position + distance) << shift);
+	}
+	return best;
+}
@@ -0,0 +1,86 @@
+#ifndef __BGJSTIMERWHEEL_H
+#define __BGJSTIMERWHEEL_H	1
+
+#include <v8.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+/**
+ * BGJSTimerWheel
+ * Hierarchical timer wheel backing setTimeout/setInterval of a BGJSV8Engine
+ *
+ * Four levels of 64 slots with a resolution of one millisecond; timers further than 2^24ms in the future are parked
+ * in the last slot of the top level and re-sorted whenever that slot is cascaded.
+ * Timer records are allocated from slabs and recycled, so scheduling a timer does not hit the allocator.
+ *
+ * Licensed under the MIT license.
+ */
+
+struct BGJSTimer {
+	v8::Persistent<v8::Function> callback;
+	v8::Persistent<v8::Object> thisObj;
+	uint64_t expires;	// absolute time in ms
+	uint32_t interval;	// delay in ms that recurring timers are rescheduled with
+	int id;
+	int context;		// id of the context of the engine that set the timer, 0 for the main one
+	bool recurring;
+	bool cancelled;		// cleared while its callback was running; released once the callback returns
+
+	// intrusive list of the slot the timer is in
+	BGJSTimer *prev, *next;
+	uint8_t level, slot;
+};
+
+class BGJSTimerWheel {
+public:
+	BGJSTimerWheel();
+	~BGJSTimerWheel();
+
+	/**
+	 * returns an unused timer record; has to be returned via release()
+	 */
+	BGJSTimer* allocate();
+	void release(BGJSTimer *timer);
+
+	/**
+	 * adds the timer to the wheel to expire delay ms after now
+	 */
+	void schedule(BGJSTimer *timer, uint64_t now, uint32_t delay);
+	void unschedule(BGJSTimer *timer);
+	bool isScheduled(const BGJSTimer *timer) const;
+
+	/**
+	 * advances the wheel to the specified time and appends all expired timers to due in order of expiry
+	 * the timers are removed from the wheel and have to be re-scheduled or released by the caller
+	 */
+	void advance(uint64_t now, std::vector<BGJSTimer*> &due);
+
+	/**
+	 * returns the next time the wheel has to be advanced at, or UINT64_MAX if there are no timers
+	 */
+	uint64_t nextTick() const;
+
+	size_t size() const;
+
+private:
+	static const int kLevels = 4;
+	static const int kSlotBits = 6;
+	static const int kSlots = 1 << kSlotBits;
+	static const int kSlotMask = kSlots - 1;
+	static const int kSlabSize = 256;
+	static const uint8_t kNotScheduled = 0xff;
+
+	void insert(BGJSTimer *timer);
+	void cascade(int level);
+
+	BGJSTimer *_slots[kLevels][kSlots];
+	uint64_t _occupied[kLevels];	// one bit per non-empty slot
+	uint64_t _current;
+	size_t _count;
+
+	std::vector<BGJSTimer*> _slabs;
+	BGJSTimer *_free;
+};
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * BGJSTrace
+ * Marks sections of native code in system traces
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSTrace.h"
+
+#include <v8-platform.h>
+
+#include <atomic>
+#include <dlfcn.h>
+#include <string.h>
+
+namespace {
+
+// from android/trace.h, which is only there when compiling for api 23 and up
+struct ATraceFunctions {
+	bool (*isEnabled)();
+	void (*beginSection)(const char* name);
+	void (*endSection)();
+
+	ATraceFunctions() {
+		isEnabled = (bool (*)()) dlsym(RTLD_DEFAULT, "ATrace_isEnabled");
+		beginSection = (void (*)(const char*)) dlsym(RTLD_DEFAULT, "ATrace_beginSection");
+		endSection = (void (*)()) dlsym(RTLD_DEFAULT, "ATrace_endSection");
+		if (!isEnabled || !beginSection || !endSection) {
+			isEnabled = nullptr;
+		}
+	}
+};
+
+const ATraceFunctions& atrace() {
+	static const ATraceFunctions functions;
+	return functions;
+}
+
+std::atomic<bool> enabled(false);
+
+// bit of the category flags v8 checks before recording events, from base/trace_event/trace_category.h of chrome
+const uint8_t kEnabledForRecording = 1 << 0;
+
+// the flag of all categories that are not hidden by default
+uint8_t categoryEnabled = 0;
+uint8_t categoryDisabled = 0;
+
+/**
+ * Maps the scoped trace events of v8 to sections. v8 reports scopes as complete events, whose end comes through
+ * UpdateTraceEventDuration; other phases are dropped, as their end could not be matched up with a section.
+ * Scopes that are open while tracing is switched off are not ended by v8, and stay open until the trace ends.
+ */
+class BGJSTracingController : public v8::TracingController {
+public:
+	const uint8_t* GetCategoryGroupEnabled(const char* name) override {
+		// e.g. disabled-by-default-v8.runtime_stats, which would disturb the timing of everything else
+		return strstr(name, "disabled-by-default") ? &categoryDisabled : &categoryEnabled;
+	}
+
+	uint64_t AddTraceEvent(char phase, const uint8_t* categoryEnabledFlag, const char* name, const char* scope,
+						   uint64_t id, uint64_t bindId, int32_t numArgs, const char** argNames,
+						   const uint8_t* argTypes, const uint64_t* argValues,
+						   std::unique_ptr<v8::ConvertableToTraceFormat>* argConvertables, unsigned int flags) override {
+		// a handle of 0 tells UpdateTraceEventDuration that no section was begun
+		if (phase != 'X' || !BGJSTrace::isEnabled()) {
+			return 0;
+		}
+		BGJSTrace::beginSection(name);
+		return 1;
+	}
+
+	uint64_t AddTraceEventWithTimestamp(char phase, const uint8_t* categoryEnabledFlag, const char* name,
+										const char* scope, uint64_t id, uint64_t bindId, int32_t numArgs,
+										const char** argNames, const uint8_t* argTypes, const uint64_t* argValues,
+										std::unique_ptr<v8::ConvertableToTraceFormat>* argConvertables,
+										unsigned int flags, int64_t timestamp) override {
+		return AddTraceEvent(phase, categoryEnabledFlag, name, scope, id, bindId, numArgs, argNames, argTypes,
+							 argValues, argConvertables, flags);
+	}
+
+	void UpdateTraceEventDuration(const uint8_t* categoryEnabledFlag, const char* name, uint64_t handle) override {
+		if (handle) {
+			BGJSTrace::endSection();
+		}
+	}
+};
+
+}
+
+void BGJSTrace::setEnabled(bool isEnabled) {
+	enabled = isEnabled;
+	categoryEnabled = isEnabled ? kEnabledForRecording : 0;
+}
+
+bool BGJSTrace::isEnabled() {
+	if (!enabled.load(std::memory_order_relaxed)) {
+		return false;
+	}
+	const ATraceFunctions& functions = atrace();
+	return functions.isEnabled && functions.isEnabled();
+}
+
+void BGJSTrace::beginSection(const char* name) {
+	atrace().beginSection(name);
+}
+
+void BGJSTrace::endSection() {
+	atrace().endSection();
+}
+
+v8::TracingController* BGJSTrace::createTracingController() {
+	return new BGJSTracingController();
+}
@@ -0,0 +1,52 @@
+#ifndef __BGJSTRACE_H
+#define __BGJSTRACE_H	1
+
+/**
+ * BGJSTrace
+ * Marks sections of native code in system traces, so time spent in the js bridge shows up in systrace and perfetto
+ *
+ * Uses ATrace of the ndk, which exists from api 23 on; looked up at runtime, so older devices simply do not trace.
+ * Sections are only begun while tracing is enabled and a trace is being recorded, and have to end on the thread they
+ * began on, in reverse order. The trace events of v8 itself, e.g. of garbage collections and compiling, become sections
+ * too when the platform is made with the tracing controller.
+ *
+ * Licensed under the MIT license.
+ */
+
+namespace v8 {
+class TracingController;
+}
+
+class BGJSTrace {
+public:
+	// off by default, so nothing is traced unless asked for; can be switched on any thread at any time
+	static void setEnabled(bool enabled);
+	static bool isEnabled();
+	static void beginSection(const char* name);
+	static void endSection();
+
+	// tracing controller for the v8 platform, which owns it
+	static v8::TracingController* createTracingController();
+};
+// traces the scope it is declared in, if a trace was being recorded when it began
+class BGJSTraceScope {
+public:
+	BGJSTraceScope(const char* name) : _active(BGJSTrace::isEnabled()) {
+		if (_active) {
+			BGJSTrace::beginSection(name);
+		}
+	}
+	~BGJSTraceScope() {
+		if (_active) {
+			BGJSTrace::endSection();
+		}
+	}
+
+private:
+	BGJSTraceScope(const BGJSTraceScope&) = delete;
+	BGJSTraceScope& operator=(const BGJSTraceScope&) = delete;
+
+	bool _active;
+};
+
+#endif
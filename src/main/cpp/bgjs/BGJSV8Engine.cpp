@@ -12,24 +12,36 @@
 #include "../v8/JNIV8Wrapper.h"
 #include "../v8/JNIV8GenericObject.h"
 #include "../v8/JNIV8Function.h"
+#include "../v8/JNIV8ObjectStats.h"
 
 #include <android/asset_manager.h>
 #include <android/asset_manager_jni.h>
 
 #include "mallocdebug.h"
 #include <assert.h>
+#include <math.h>
 #include <sstream>
+#include <algorithm>
+#include <memory>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "BGJSGLView.h"
+#include "../ejecta/EJCanvas/EJCanvasResources.h"
+#include "BGJSHeapDumpWriter.h"
+#include "BGJSIsolatePool.h"
+#include "BGJSLog.h"
+#include "BGJSTrace.h"
+#include "BGJSWatchdog.h"
+#include "BGJSWorker.h"
+#include "modules/BGJSMessagePackModule.h"
 #include "v8-profiler.h"
 
 #define LOG_TAG    "BGJSV8Engine-jni"
 
 using namespace v8;
 
-// We can only dump one Isolate's heap at a time
-char *_nextProfileDumpPath = NULL;
-
 BGJS_JNI_LINK(BGJSV8Engine, "ag/boersego/bgjs/V8Engine")
 
 //-----------------------------------------------------------
@@ -79,7 +91,7 @@ std::string normalize_path(std::string &path) {
     return outPath;
 }
 
-std::string getPathName(std::string &path) {
+std::string getPathName(const std::string &path) {
     size_t found = path.find_last_of("/");
 
     if (found == string::npos) {
@@ -181,6 +193,33 @@ static void RequireCallback(const v8::FunctionCallbackInfo<v8::Value> &args) {
     }
 }
 
+static void PreloadCallback(const v8::FunctionCallbackInfo<v8::Value> &args) {
+    Isolate *isolate = args.GetIsolate();
+    args.GetReturnValue().SetUndefined();
+    if (args.Length() < 1) {
+        return;
+    }
+
+    HandleScope scope(isolate);
+    BGJSV8Engine *engine = BGJSV8Engine::GetInstance(isolate);
+    Local<Context> context = isolate->GetCurrentContext();
+
+    if (args[0]->IsString()) {
+        engine->preload(JNIV8Marshalling::v8string2string(args[0].As<String>()));
+        return;
+    }
+    if (!args[0]->IsArray()) {
+        return;
+    }
+    Local<Array> paths = args[0].As<Array>();
+    for (uint32_t i = 0, n = paths->Length(); i < n; i++) {
+        Local<Value> path;
+        if (paths->Get(context, i).ToLocal(&path) && path->IsString()) {
+            engine->preload(JNIV8Marshalling::v8string2string(path.As<String>()));
+        }
+    }
+}
+
 //-----------------------------------------------------------
 // V8Engine
 //-----------------------------------------------------------
@@ -188,6 +227,7 @@ static void RequireCallback(const v8::FunctionCallbackInfo<v8::Value> &args) {
 decltype(BGJSV8Engine::_jniV8Module) BGJSV8Engine::_jniV8Module = {0};
 decltype(BGJSV8Engine::_jniV8Exception) BGJSV8Engine::_jniV8Exception = {0};
 decltype(BGJSV8Engine::_jniV8JSException) BGJSV8Engine::_jniV8JSException = {0};
+v8::Platform *BGJSV8Engine::_platform = nullptr;
 decltype(BGJSV8Engine::_jniStackTraceElement) BGJSV8Engine::_jniStackTraceElement = {0};
 decltype(BGJSV8Engine::_jniV8Engine) BGJSV8Engine::_jniV8Engine = {0};
 
@@ -255,7 +295,7 @@ maybeValue = L->Get(context, String::NewFromOneByte(_isolate, (uint8_t *) M, New
 if(maybeValue.ToLocal(&value) && value->IsFunction()) {\
 maybeValue = value.As<Function>()->Call(context, L, 0, nullptr);\
 if(maybeValue.ToLocal(&value) && value->IsString()) {\
-V = JNIV8Marshalling::v8string2jstring(value.As<String>());\
+V = JNIV8Marshalling::v8string2jstring(env, value.As<String>());\
 }\
 }
 
@@ -301,147 +341,151 @@ bool BGJSV8Engine::forwardV8ExceptionToJNI(v8::TryCatch *try_catch) const {
         }
     }
 
-    jobject exceptionAsObject = JNIV8Marshalling::v8value2jobject(exception);
-
-    // convert v8 stack trace to a java stack trace
-    jobject v8JSException;
-    jstring exceptionMessage = nullptr;
+    jobject exceptionAsObject = JNIV8Marshalling::v8value2jobject(env, exception);
 
-    jobjectArray stackTrace = nullptr;
-    bool error = false;
-    if (exception->IsObject()) {
-        // retrieve message (toString contains typename, we don't want that..)
-        std::string strExceptionMessage;
-        maybeValue = exception.As<Object>()->Get(context, String::NewFromOneByte(_isolate, (uint8_t *) "message",
-                                                                                 NewStringType::kInternalized).ToLocalChecked());
-        if (maybeValue.ToLocal(&value) && value->IsString()) {
-            strExceptionMessage = JNIV8Marshalling::v8string2string(
-                    maybeValue.ToLocalChecked()->ToString(_isolate));
-        }
-
-        // retrieve error name (e.g. "SyntaxError")
-        std::string strErrorName;
-        maybeValue = exception.As<Object>()->Get(context, String::NewFromOneByte(_isolate, (uint8_t *) "name",
-                                                                                 NewStringType::kInternalized).ToLocalChecked());
-        if (maybeValue.ToLocal(&value) && value->IsString()) {
-            strErrorName = JNIV8Marshalling::v8string2string(
-                    maybeValue.ToLocalChecked()->ToString(_isolate));
-        }
-
-        // the stack trace for syntax errors does not contain the location of the actual error
-        // and neither does the message
-        // so we have to append that manually
-        // for errors thrown from native code it might not be available though
-        if (strErrorName == "SyntaxError") {
-            int lineNumber = -1;
-            Maybe<int> maybeLineNumber = try_catch->Message()->GetLineNumber(context);
-            if (!maybeLineNumber.IsNothing()) {
-                lineNumber = maybeLineNumber.ToChecked();
-            }
-            Local<Value> jsScriptResourceName = try_catch->Message()->GetScriptResourceName();
-            if (jsScriptResourceName->IsString()) {
-                strExceptionMessage =
-                        JNIV8Marshalling::v8string2string(jsScriptResourceName.As<String>()) +
-                        (lineNumber > 0 ? ":" + std::to_string(lineNumber) : "") +
-                        " - " + strExceptionMessage;
-            }
+    // where the exception was thrown; syntax errors need it for their message, and it is all there is to show for
+    // errors without a stack trace. Script resource names might not be set for exceptions from native code
+    jint lineNumber = -1;
+    jstring scriptName = nullptr;
+    Local<Message> message = try_catch->Message();
+    if (!message.IsEmpty()) {
+        lineNumber = message->GetLineNumber(context).FromMaybe(-1);
+        Local<Value> jsScriptResourceName = message->GetScriptResourceName();
+        if (jsScriptResourceName->IsString()) {
+            scriptName = JNIV8Marshalling::v8string2jstring(env, jsScriptResourceName.As<String>());
         }
+    }
 
-        exceptionMessage = JNIWrapper::string2jstring("[" + strErrorName + "] " + strExceptionMessage);
+    jobject v8JSException;
+    if (exception->IsObject()) {
+        // reading the message and the stack trace of an error calls into js for every frame; lots of exceptions are
+        // caught and dropped by java => they are only read once java asks for them, see readJSError
+        v8JSException = env->NewObject(_jniV8JSException.clazz, _jniV8JSException.lazyInitId, exceptionAsObject,
+                                       scriptName, lineNumber, causeException);
+    } else {
+        v8JSException = env->NewObject(_jniV8JSException.clazz, _jniV8JSException.initId,
+                                       JNIV8Marshalling::v8string2jstring(env, exception->ToString(_isolate)),
+                                       exceptionAsObject, causeException);
+        env->CallVoidMethod(v8JSException, _jniV8JSException.setStackTraceId,
+                            makeFallbackStackTrace(env, scriptName, lineNumber));
+    }
 
-        Local<Function> getStackTraceFn = Local<Function>::New(_isolate, _getStackTraceFn);
+    // throw final exception
+    env->Throw((jthrowable) env->NewObject(_jniV8Exception.clazz, _jniV8Exception.initId,
+                                           JNIWrapper::string2jstring("An exception was thrown in JavaScript"),
+                                           v8JSException));
 
-        maybeValue = getStackTraceFn->Call(context, context->Global(), 1, &exception);
-        if (maybeValue.ToLocal(&value) && value->IsArray()) {
-            Local<Array> array = value.As<Array>();
+    return true;
+}
 
-            uint32_t size = array->Length();
-            stackTrace = env->NewObjectArray(size, _jniStackTraceElement.clazz, nullptr);
+jobjectArray BGJSV8Engine::makeFallbackStackTrace(JNIEnv *env, jstring scriptName, jint lineNumber) const {
+    // dummy trace entry
+    return env->NewObjectArray(1, _jniStackTraceElement.clazz,
+                               env->NewObject(_jniStackTraceElement.clazz, _jniStackTraceElement.initId,
+                                              JNIWrapper::string2jstring("<unknown>"),
+                                              JNIWrapper::string2jstring("<unknown>"),
+                                              scriptName,
+                                              scriptName ? (lineNumber >= 1 ? lineNumber : -1) : -2));
+}
 
-            jobject stackTraceElement;
-            for (uint32_t i = 0; i < size; i++) {
-                maybeValue = array->Get(context, i);
-                if (maybeValue.ToLocal(&value) && value->IsObject()) {
-                    Local<Object> callSite = value.As<Object>();
+jstring BGJSV8Engine::readJSError(JNIEnv *env, Local<Object> exception, jobject javaException, jstring scriptName,
+                                  jint lineNumber) const {
+    Local<Context> context = getContext();
 
-                    jstring fileName = nullptr;
-                    jstring methodName = nullptr;
-                    jstring functionName = nullptr;
-                    jstring typeName = nullptr;
-                    jint lineNumber = 0;
+    MaybeLocal<Value> maybeValue;
+    Local<Value> value;
 
-                    CALLSITE_STRING(callSite, "getFileName", fileName);
-                    CALLSITE_STRING(callSite, "getMethodName", methodName);
-                    CALLSITE_STRING(callSite, "getFunctionName", functionName);
-                    CALLSITE_STRING(callSite, "getTypeName", typeName);
+    // convert v8 stack trace to a java stack trace
+    jobjectArray stackTrace = nullptr;
+    bool error = false;
 
-                    maybeValue = callSite->Get(context, String::NewFromOneByte(_isolate, (uint8_t *) "getLineNumber",
-                                                                               NewStringType::kInternalized).ToLocalChecked());
-                    if (maybeValue.ToLocal(&value) && value->IsFunction()) {
-                        maybeValue = value.As<Function>()->Call(context, callSite, 0, nullptr);
-                        if (maybeValue.ToLocal(&value) && value->IsNumber()) {
-                            lineNumber = (jint) value.As<Number>()->IntegerValue(context).FromJust();
-                        }
+    // retrieve message (toString contains typename, we don't want that..)
+    std::string strExceptionMessage;
+    maybeValue = exception->Get(context, String::NewFromOneByte(_isolate, (uint8_t *) "message",
+                                                                NewStringType::kInternalized).ToLocalChecked());
+    if (maybeValue.ToLocal(&value) && value->IsString()) {
+        strExceptionMessage = JNIV8Marshalling::v8string2string(value.As<String>());
+    }
+
+    // retrieve error name (e.g. "SyntaxError")
+    std::string strErrorName;
+    maybeValue = exception->Get(context, String::NewFromOneByte(_isolate, (uint8_t *) "name",
+                                                                NewStringType::kInternalized).ToLocalChecked());
+    if (maybeValue.ToLocal(&value) && value->IsString()) {
+        strErrorName = JNIV8Marshalling::v8string2string(value.As<String>());
+    }
+
+    // the stack trace for syntax errors does not contain the location of the actual error
+    // and neither does the message
+    // so we have to append that manually
+    // for errors thrown from native code it might not be available though
+    if (strErrorName == "SyntaxError" && scriptName) {
+        strExceptionMessage = JNIWrapper::jstring2string(scriptName) +
+                              (lineNumber > 0 ? ":" + std::to_string(lineNumber) : "") +
+                              " - " + strExceptionMessage;
+    }
+
+    jstring exceptionMessage = JNIWrapper::string2jstring("[" + strErrorName + "] " + strExceptionMessage);
+
+    Local<Function> getStackTraceFn = Local<Function>::New(_isolate, _getStackTraceFn);
+
+    Local<Value> exceptionValue = exception;
+    maybeValue = getStackTraceFn->Call(context, context->Global(), 1, &exceptionValue);
+    if (maybeValue.ToLocal(&value) && value->IsArray()) {
+        Local<Array> array = value.As<Array>();
+
+        uint32_t size = array->Length();
+        stackTrace = env->NewObjectArray(size, _jniStackTraceElement.clazz, nullptr);
+
+        jobject stackTraceElement;
+        for (uint32_t i = 0; i < size; i++) {
+            maybeValue = array->Get(context, i);
+            if (maybeValue.ToLocal(&value) && value->IsObject()) {
+                Local<Object> callSite = value.As<Object>();
+
+                jstring fileName = nullptr;
+                jstring methodName = nullptr;
+                jstring functionName = nullptr;
+                jstring typeName = nullptr;
+                jint callSiteLineNumber = 0;
+
+                CALLSITE_STRING(callSite, "getFileName", fileName);
+                CALLSITE_STRING(callSite, "getMethodName", methodName);
+                CALLSITE_STRING(callSite, "getFunctionName", functionName);
+                CALLSITE_STRING(callSite, "getTypeName", typeName);
+
+                maybeValue = callSite->Get(context, String::NewFromOneByte(_isolate, (uint8_t *) "getLineNumber",
+                                                                           NewStringType::kInternalized).ToLocalChecked());
+                if (maybeValue.ToLocal(&value) && value->IsFunction()) {
+                    maybeValue = value.As<Function>()->Call(context, callSite, 0, nullptr);
+                    if (maybeValue.ToLocal(&value) && value->IsNumber()) {
+                        callSiteLineNumber = (jint) value.As<Number>()->IntegerValue(context).FromJust();
                     }
-
-                    stackTraceElement = env->NewObject(_jniStackTraceElement.clazz, _jniStackTraceElement.initId,
-                                                       typeName ? typeName : JNIWrapper::string2jstring("<unknown>"),
-                                                       !methodName && !functionName ? JNIWrapper::string2jstring(
-                                                               "<anonymous>") : methodName ? methodName : functionName,
-                                                       fileName, // fileName can be zero => maps to "Unknown Source" or "Native Method" (Depending on line numer)
-                                                       fileName ? (lineNumber >= 1 ? lineNumber : -1)
-                                                                : -2); // -1 is unknown, -2 means native
-                    env->SetObjectArrayElement(stackTrace, i, stackTraceElement);
-                } else {
-                    error = true;
-                    break;
                 }
+
+                stackTraceElement = env->NewObject(_jniStackTraceElement.clazz, _jniStackTraceElement.initId,
+                                                   typeName ? typeName : JNIWrapper::string2jstring("<unknown>"),
+                                                   !methodName && !functionName ? JNIWrapper::string2jstring(
+                                                           "<anonymous>") : methodName ? methodName : functionName,
+                                                   fileName, // fileName can be zero => maps to "Unknown Source" or "Native Method" (Depending on line numer)
+                                                   fileName ? (callSiteLineNumber >= 1 ? callSiteLineNumber : -1)
+                                                            : -2); // -1 is unknown, -2 means native
+                env->SetObjectArrayElement(stackTrace, i, stackTraceElement);
+                env->DeleteLocalRef(stackTraceElement);
+            } else {
+                error = true;
+                break;
             }
         }
     }
 
     // if no stack trace was provided by v8, or if there was an error converting it, we still have to show something
     if (error || !stackTrace) {
-        int lineNumber = -1;
-        Maybe<int> maybeLineNumber = try_catch->Message()->GetLineNumber(context);
-        if (!maybeLineNumber.IsNothing()) {
-            lineNumber = maybeLineNumber.ToChecked();
-        }
-
-        // script resource might not be set if the exception came from native code
-        jstring fileName;
-        Local<Value> jsScriptResourceName = try_catch->Message()->GetScriptResourceName();
-        if (jsScriptResourceName->IsString()) {
-            fileName = JNIV8Marshalling::v8string2jstring(jsScriptResourceName.As<String>());
-        } else {
-            fileName = nullptr;
-        }
-
-        // dummy trace entry
-        stackTrace = env->NewObjectArray(1, _jniStackTraceElement.clazz,
-                                         env->NewObject(_jniStackTraceElement.clazz, _jniStackTraceElement.initId,
-                                                        JNIWrapper::string2jstring("<unknown>"),
-                                                        JNIWrapper::string2jstring("<unknown>"),
-                                                        fileName,
-                                                        fileName ? (lineNumber >= 1 ? lineNumber : -1) : -2));
-    }
-
-    // if exception was not an Error object, or if .message is not set for some reason => use toString()
-    if (!exceptionMessage) {
-        exceptionMessage = JNIV8Marshalling::v8string2jstring(exception->ToString(_isolate));
+        stackTrace = makeFallbackStackTrace(env, scriptName, lineNumber);
     }
+    env->CallVoidMethod(javaException, _jniV8JSException.setStackTraceId, stackTrace);
 
-    // apply trace to js exception
-    v8JSException = env->NewObject(_jniV8JSException.clazz, _jniV8JSException.initId, exceptionMessage,
-                                   exceptionAsObject, causeException);
-    env->CallVoidMethod(v8JSException, _jniV8JSException.setStackTraceId, stackTrace);
-
-    // throw final exception
-    env->Throw((jthrowable) env->NewObject(_jniV8Exception.clazz, _jniV8Exception.initId,
-                                           JNIWrapper::string2jstring("An exception was thrown in JavaScript"),
-                                           v8JSException));
-
-    return true;
+    return exceptionMessage;
 }
 
 // Register
@@ -463,7 +507,7 @@ void BGJSV8Engine::JavaModuleRequireCallback(BGJSV8Engine *engine, v8::Handle<v8
     HandleScope scope(isolate);
     Local<Context> context = engine->getContext();
 
-    MaybeLocal<Value> maybeLocal = target->Get(context, String::NewFromUtf8(isolate, "id"));
+    MaybeLocal<Value> maybeLocal = target->Get(context, engine->getString(kStringId));
     if (maybeLocal.IsEmpty()) {
         return;
     }
@@ -512,6 +556,29 @@ MaybeLocal<Value> BGJSV8Engine::parseJSON(Handle<String> source) const {
     return scope.Escape(result.ToLocalChecked());
 }
 
+MaybeLocal<Value> BGJSV8Engine::parseJSON(const char *source, size_t length, bool isOneByte) const {
+    EscapableHandleScope scope(_isolate);
+    Local<Context> context = getContext();
+
+    // ascii is valid latin1, so those sources can be copied as-is instead of being decoded
+    MaybeLocal<String> maybeString;
+    if (isOneByte) {
+        maybeString = String::NewFromOneByte(_isolate, (const uint8_t *) source, NewStringType::kNormal, (int) length);
+    } else {
+        maybeString = String::NewFromUtf8(_isolate, source, NewStringType::kNormal, (int) length);
+    }
+    Local<String> string;
+    if (!maybeString.ToLocal(&string)) {
+        return MaybeLocal<Value>();
+    }
+
+    MaybeLocal<Value> result = JSON::Parse(context, string);
+    if (result.IsEmpty()) {
+        return result;
+    }
+    return scope.Escape(result.ToLocalChecked());
+}
+
 // utility method to convert v8 values to readable strings for debugging
 const std::string BGJSV8Engine::toDebugString(Handle<Value> source) const {
     Handle<Value> stringValue;
@@ -554,12 +621,24 @@ v8::Local<v8::Function> BGJSV8Engine::makeRequireFunction(std::string pathName)
     EscapableHandleScope handle_scope(_isolate);
     Local<Function> makeRequireFn, baseRequireFn;
 
-    if (_makeRequireFn.IsEmpty()) {
+    // the functions are created in the context they require modules for
+    BGJSV8EngineContext *isolatedContext = getCurrentIsolatedContext();
+    v8::Persistent<v8::Function> &makeRequireFnHandle = isolatedContext ? isolatedContext->makeRequireFn : _makeRequireFn;
+    v8::Persistent<v8::Function> &requireFnHandle = isolatedContext ? isolatedContext->requireFn : _requireFn;
+
+    if (makeRequireFnHandle.IsEmpty()) {
         const char *szJSRequireCode =
                 "(function(internalRequire, prefix) {"
-                        "   return function require(path) {"
-                        "       return internalRequire(path.indexOf('./')===0?'./'+prefix+'/'+path.substr(2):path);"
+                        "   function resolve(path) {"
+                        "       return path.indexOf('./')===0?'./'+prefix+'/'+path.substr(2):path;"
+                        "   }"
+                        "   var require = function require(path) {"
+                        "       return internalRequire(resolve(path));"
                         "   };"
+                        "   require.preload = function preload(paths) {"
+                        "       internalRequire.preload([].concat(paths).map(resolve));"
+                        "   };"
+                        "   return require;"
                         "})";
 
         ScriptOrigin origin = ScriptOrigin(String::NewFromOneByte(_isolate, (const uint8_t *) "binding:makeRequireFn",
@@ -574,11 +653,14 @@ v8::Local<v8::Function> BGJSV8Engine::makeRequireFunction(std::string pathName)
                         ).ToLocalChecked()->Run(context).ToLocalChecked()
                 );
         baseRequireFn = v8::FunctionTemplate::New(_isolate, RequireCallback)->GetFunction();
-        _makeRequireFn.Reset(_isolate, makeRequireFn);
-        _requireFn.Reset(_isolate, baseRequireFn);
+        baseRequireFn->Set(context, String::NewFromOneByte(_isolate, (const uint8_t *) "preload",
+                                                           NewStringType::kInternalized).ToLocalChecked(),
+                           v8::FunctionTemplate::New(_isolate, PreloadCallback)->GetFunction()).FromJust();
+        makeRequireFnHandle.Reset(_isolate, makeRequireFn);
+        requireFnHandle.Reset(_isolate, baseRequireFn);
     } else {
-        makeRequireFn = Local<Function>::New(_isolate, _makeRequireFn);
-        baseRequireFn = Local<Function>::New(_isolate, _requireFn);
+        makeRequireFn = Local<Function>::New(_isolate, makeRequireFnHandle);
+        baseRequireFn = Local<Function>::New(_isolate, requireFnHandle);
     }
 
     Handle<Value> args[] = {baseRequireFn, String::NewFromUtf8(_isolate, pathName.c_str())};
@@ -586,24 +668,224 @@ v8::Local<v8::Function> BGJSV8Engine::makeRequireFunction(std::string pathName)
     return handle_scope.Escape(Local<Function>::Cast(result));
 }
 
+//-----------------------------------------------------------
+// Asset loading
+//-----------------------------------------------------------
+
+// name of the asset with the bundle of modules, if the app ships one
+#define BGJS_BUNDLE_ASSET "bgjs.bundle"
+
+// sources are wrapped in an anonymous function to set up an isolated scope
+static const char *const kModuleSourcePrefix = "(function (exports, require, module, __filename, __dirname) {";
+static const char *const kModuleSourcePostfix = "})";
+
+/**
+ * Source of a module read from the apk
+ * AAsset_getBuffer maps uncompressed assets directly, so pure ASCII sources can be handed to v8 as external
+ * strings without ever being copied. v8 then owns the asset and closes it once the string is collected.
+ * Sources of bundled modules lie in the asset of the bundle, which they keep open.
+ */
+class BGJSV8EngineAsset : public v8::String::ExternalOneByteStringResource {
+public:
+    static BGJSV8EngineAsset *fromBundle(const std::shared_ptr<BGJSBundle> &bundle, const BGJSBundle::Module *module) {
+        BGJSV8EngineAsset *asset = new BGJSV8EngineAsset(nullptr, module->source, module->length);
+        asset->_bundle = bundle;
+        return asset;
+    }
+
+    static BGJSV8EngineAsset *open(AAssetManager *mgr, const char *path) {
+        AAsset *asset = AAssetManager_open(mgr, path, AASSET_MODE_BUFFER);
+        if (!asset) {
+            return nullptr;
+        }
+
+        const void *data = AAsset_getBuffer(asset);
+        if (!data) {
+            AAsset_close(asset);
+            return nullptr;
+        }
+
+        return new BGJSV8EngineAsset(asset, (const char *) data, (size_t) AAsset_getLength(asset));
+    }
+
+    const char *data() const override {
+        return _data;
+    }
+
+    size_t length() const override {
+        return _length;
+    }
+
+    /**
+     * creates a v8 string with the contents of the asset
+     * ownership of the asset might be transferred to v8; always call close() instead of deleting it!
+     */
+    v8::Local<v8::String> makeString(v8::Isolate *isolate) {
+        if (!_isExternal && isAscii()) {
+            v8::Local<v8::String> string;
+            if (v8::String::NewExternalOneByte(isolate, this).ToLocal(&string)) {
+                _isExternal = true;
+                return string;
+            }
+        }
+        return v8::String::NewFromUtf8(isolate, _data, v8::NewStringType::kNormal, (int) _length).ToLocalChecked();
+    }
+
+    void close() {
+        if (!_isExternal) {
+            delete this;
+        }
+    }
+
+    ~BGJSV8EngineAsset() override {
+        if (_asset) {
+            AAsset_close(_asset);
+        }
+    }
+
+private:
+    BGJSV8EngineAsset(AAsset *asset, const char *data, size_t length) :
+            _asset(asset), _data(data), _length(length), _isExternal(false) {}
+
+    bool isAscii() const {
+        for (size_t i = 0; i < _length; i++) {
+            if ((uint8_t) _data[i] & 0x80) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    AAsset *_asset;
+    std::shared_ptr<BGJSBundle> _bundle;
+    const char *_data;
+    size_t _length;
+    bool _isExternal;
+};
+
+BGJSV8EngineAsset *BGJSV8Engine::openAsset(const char *path) const {
+    JNIEnv *env = JNIWrapper::getEnvironment();
+    return BGJSV8EngineAsset::open(AAssetManager_fromJava(env, _javaAssetManager), path);
+}
+
 #define _CHECK_AND_RETURN_REQUIRE_CACHE(fileName) std::map<std::string, v8::Persistent<v8::Value>>::iterator it; \
-it = _moduleCache.find(fileName); \
-if(it != _moduleCache.end()) { \
+it = moduleCache.find(fileName); \
+if(it != moduleCache.end()) { \
     return handle_scope.Escape(Local<Value>::New(_isolate, it->second)); \
 }
 
+BGJSV8EngineAsset *BGJSV8Engine::openModuleAsset(const std::string &path, const BGJSBundle::Module **bundled) {
+    *bundled = _bundle ? _bundle->find(path) : nullptr;
+    if (*bundled) {
+        return BGJSV8EngineAsset::fromBundle(_bundle, *bundled);
+    }
+    return openAsset(path.c_str());
+}
+
+bool BGJSV8Engine::assetExists(const std::string &path) {
+    _assetProbes++;
+    if (_bundle && _bundle->find(path)) {
+        return true;
+    }
+    const size_t slash = path.find_last_of('/');
+    const std::string dirName = slash == std::string::npos ? std::string() : path.substr(0, slash);
+
+    auto dir = _assetDirectories.find(dirName);
+    if (dir == _assetDirectories.end()) {
+        // one listing per directory replaces opening every path require probes; listings only contain files
+        std::unordered_set<std::string> &fileNames = _assetDirectories[dirName];
+        JNIEnv *env = JNIWrapper::getEnvironment();
+        AAssetDir *assetDir = AAssetManager_openDir(AAssetManager_fromJava(env, _javaAssetManager), dirName.c_str());
+        if (assetDir) {
+            while (const char *fileName = AAssetDir_getNextFileName(assetDir)) {
+                fileNames.insert(fileName);
+            }
+            AAssetDir_close(assetDir);
+        }
+        dir = _assetDirectories.find(dirName);
+    }
+    return dir->second.count(slash == std::string::npos ? path : path.substr(slash + 1)) != 0;
+}
+
+static bool endsWith(const std::string &str, const char *suffix) {
+    const size_t length = strlen(suffix);
+    return str.length() >= length && str.compare(str.length() - length, length, suffix) == 0;
+}
+
+bool BGJSV8Engine::resolveModule(const std::string &baseName, BGJSResolvedModule *resolved) {
+    resolved->isJson = false;
+    if (assetExists(baseName)) {
+        resolved->fileName = baseName;
+        resolved->isJson = endsWith(baseName, ".json");
+        return true;
+    }
+
+    // Check if this is a directory containing package.json or index.js
+    resolved->fileName = baseName + "/package.json";
+    if (assetExists(resolved->fileName)) {
+        const BGJSBundle::Module *bundled;
+        BGJSV8EngineAsset *asset = openModuleAsset(resolved->fileName, &bundled);
+        if (!asset) {
+            return false;
+        }
+        // Parse the package.json
+        HandleScope scope(_isolate);
+        Local<Value> res;
+        MaybeLocal<Value> maybeRes = parseJSON(asset->makeString(_isolate));
+        asset->close();
+        Local<String> mainStr = getString(kStringMain);
+        if (maybeRes.ToLocal(&res) && res->IsObject() && res.As<Object>()->Has(mainStr)) {
+            String::Utf8Value jsFileNameC(_isolate, res.As<Object>()->Get(mainStr)->ToString(_isolate));
+            resolved->fileName = baseName + "/" + *jsFileNameC;
+            return true;
+        }
+        LOGE("%s/package.json doesn't have a main object", baseName.c_str());
+        return false;
+    }
+
+    // It might be a directory with an index.js, or just a js file, or json
+    static const char *const suffixes[] = {"/index.js", ".js", ".json"};
+    for (const char *suffix : suffixes) {
+        resolved->fileName = baseName + suffix;
+        if (assetExists(resolved->fileName)) {
+            resolved->isJson = endsWith(resolved->fileName, ".json");
+            return true;
+        }
+    }
+    return false;
+}
+
 MaybeLocal<Value> BGJSV8Engine::require(std::string baseNameStr) {
+    BGJSTraceScope trace("BGJSV8Engine.require");
     Local<Context> context = _isolate->GetCurrentContext();
     EscapableHandleScope handle_scope(_isolate);
 
     Local<Value> result;
 
+    // every context has modules of its own
+    BGJSV8EngineContext *isolatedContext = getCurrentIsolatedContext();
+    if (isolatedContext && isolatedContext->disposed) {
+        _isolate->ThrowException(v8::Exception::Error(
+                String::NewFromUtf8(_isolate, ("Cannot require '" + baseNameStr + "' in a disposed context").c_str())));
+        return MaybeLocal<Value>();
+    }
+    std::map<std::string, v8::Persistent<v8::Value>> &moduleCache =
+            isolatedContext ? isolatedContext->moduleCache : _moduleCache;
+
+    loadBundle();
+
+    // names are resolved once; a module that was loaded before needs no asset at all
+    auto resolved = _resolvedModules.find(baseNameStr);
+    if (resolved != _resolvedModules.end()) {
+        _CHECK_AND_RETURN_REQUIRE_CACHE(resolved->second.fileName)
+    }
+    const std::string requestedName = baseNameStr;
+
     if (baseNameStr.find("./") == 0) {
         baseNameStr = baseNameStr.substr(2);
         find_and_replace(baseNameStr, std::string("/./"), std::string("/"));
         baseNameStr = normalize_path(baseNameStr);
     }
-    bool isJson = false;
 
     // check cache first
     _CHECK_AND_RETURN_REQUIRE_CACHE(baseNameStr)
@@ -611,102 +893,80 @@ MaybeLocal<Value> BGJSV8Engine::require(std::string baseNameStr) {
 
     // Source of JS file if external code
     Handle<String> source;
-    const char *buf = 0;
+    BGJSV8EngineAsset *asset = nullptr;
 
     // Check if this is an internal module
-    requireHook module = _modules[baseNameStr];
+    auto moduleIt = _modules.find(baseNameStr);
+    requireHook module = moduleIt != _modules.end() ? moduleIt->second : nullptr;
 
     if (module) {
+        if (_isCreatingSnapshot) {
+            // native modules hold state outside of the heap, which can not be serialized
+            _isolate->ThrowException(v8::Exception::Error(
+                    String::NewFromUtf8(_isolate, ("Native module '" + baseNameStr + "' can not be part of a startup snapshot").c_str())));
+            return MaybeLocal<Value>();
+        }
         Local<Object> exportsObj = Object::New(_isolate);
         Local<Object> moduleObj = Object::New(_isolate);
-        moduleObj->Set(String::NewFromUtf8(_isolate, "id"), String::NewFromUtf8(_isolate, baseNameStr.c_str()));
-        moduleObj->Set(String::NewFromUtf8(_isolate, "environment"), String::NewFromUtf8(_isolate, "BGJSContext"));
-        moduleObj->Set(String::NewFromUtf8(_isolate, "exports"), exportsObj);
-        moduleObj->Set(String::NewFromUtf8(_isolate, "platform"), String::NewFromUtf8(_isolate, "android"));
-        moduleObj->Set(String::NewFromUtf8(_isolate, "debug"), Boolean::New(_isolate, _debug));
-        moduleObj->Set(String::NewFromUtf8(_isolate, "isStoreBuild"), Boolean::New(_isolate, _isStoreBuild));
+        moduleObj->Set(getString(kStringId), String::NewFromUtf8(_isolate, baseNameStr.c_str()));
+        moduleObj->Set(getString(kStringEnvironment), getString(kStringBGJSContext));
+        moduleObj->Set(getString(kStringExports), exportsObj);
+        moduleObj->Set(getString(kStringPlatform), getString(kStringAndroid));
+        moduleObj->Set(getString(kStringDebug), Boolean::New(_isolate, _debug));
+        moduleObj->Set(getString(kStringIsStoreBuild), Boolean::New(_isolate, _isStoreBuild));
 
         module(this, moduleObj);
-        result = moduleObj->Get(String::NewFromUtf8(_isolate, "exports"));
-        _moduleCache[baseNameStr].Reset(_isolate, result);
+        result = moduleObj->Get(getString(kStringExports));
+        moduleCache[baseNameStr].Reset(_isolate, result);
         return handle_scope.Escape(result);
     }
-    std::string fileName, pathName;
 
-    fileName = baseNameStr;
-    buf = loadFile(fileName.c_str());
-    if (!buf) {
-        // Check if this is a directory containing index.js or package.json
-        fileName = baseNameStr + "/package.json";
-        buf = loadFile(fileName.c_str());
-
-        if (!buf) {
-            // It might be a directory with an index.js
-            fileName = baseNameStr + "/index.js";
-            _CHECK_AND_RETURN_REQUIRE_CACHE(fileName)
-            buf = loadFile(fileName.c_str());
-
-            if (!buf) {
-                // So it might just be a js file
-                fileName = baseNameStr + ".js";
-                _CHECK_AND_RETURN_REQUIRE_CACHE(fileName)
-                buf = loadFile(fileName.c_str());
-
-                if (!buf) {
-                    // No JS file, but maybe JSON?
-                    fileName = baseNameStr + ".json";
-                    buf = loadFile(fileName.c_str());
-
-                    if (buf) {
-                        isJson = true;
-                    }
-                }
-            }
-        } else {
-            // Parse the package.json
-            // Create a string containing the JSON source
-            source = String::NewFromUtf8(_isolate, buf);
-            Handle<Value> res;
-            MaybeLocal<Value> maybeRes = parseJSON(source);
-            Handle<String> mainStr = String::NewFromUtf8(_isolate, (const char *) "main");
-            if (maybeRes.ToLocal(&res) && res->IsObject() && res.As<Object>()->Has(mainStr)) {
-                Handle<String> jsFileName = res.As<Object>()->Get(mainStr)->ToString(_isolate);
-                String::Utf8Value jsFileNameC(_isolate, jsFileName);
-
-                fileName = baseNameStr + "/" + *jsFileNameC;
-                if (buf) {
-                    free((void *) buf);
-                    buf = NULL;
-                }
+    // what loading the module takes is recorded for getModuleStats
+    BGJSModuleStats stats;
+    const double startTime = _platform->MonotonicallyIncreasingTime();
+    const size_t startHeap = usedHeapSize();
+    const int startProbes = _assetProbes;
 
-                // It might be a directory with an index.js
-                _CHECK_AND_RETURN_REQUIRE_CACHE(fileName)
-                buf = loadFile(fileName.c_str());
-            } else {
-                LOGE("%s doesn't have a main object: %s", baseNameStr.c_str(), buf);
-                if (buf) {
-                    free((void *) buf);
-                    buf = NULL;
-                }
-            }
-        }
-    } else if (baseNameStr.find(".json") == baseNameStr.length() - 5) {
-        isJson = true;
+    BGJSResolvedModule resolvedModule;
+    if (resolved != _resolvedModules.end()) {
+        resolvedModule = resolved->second;
+    } else if (resolveModule(baseNameStr, &resolvedModule)) {
+        _resolvedModules[requestedName] = resolvedModule;
     }
+    const std::string &fileName = resolvedModule.fileName;
+    const bool isJson = resolvedModule.isJson;
+    const BGJSBundle::Module *bundled = nullptr;
+    if (!fileName.empty()) {
+        _CHECK_AND_RETURN_REQUIRE_CACHE(fileName)
+        asset = openModuleAsset(fileName, &bundled);
+    }
+    std::string pathName;
 
     MaybeLocal<Value> maybeLocal;
 
-    if (!buf) {
+    if (!asset) {
         _isolate->ThrowException(v8::Exception::Error(
                 String::NewFromUtf8(_isolate, (const char *) ("Cannot find module '" + baseNameStr + "'").c_str())));
         return maybeLocal;
     }
 
+    double time = _platform->MonotonicallyIncreasingTime();
+    stats.fileName = fileName;
+    stats.probes = _assetProbes - startProbes;
+    stats.bytes = asset->length();
+    stats.loadTime = (time - startTime) * 1000;
+    stats.compileTime = stats.evalTime = 0;
+    stats.codeCache = kCodeCacheNone;
+
     if (isJson) {
         // Create a string containing the JSON source
-        source = String::NewFromUtf8(_isolate, buf);
-        MaybeLocal<Value> res = parseJSON(source);
-        free((void *) buf);
+        source = asset->makeString(_isolate);
+        // parseJSON creates the objects in the main context
+        MaybeLocal<Value> res = isolatedContext ? v8::JSON::Parse(context, source) : parseJSON(source);
+        asset->close();
+        stats.compileTime = (_platform->MonotonicallyIncreasingTime() - time) * 1000;
+        stats.heapDelta = (int64_t) usedHeapSize() - (int64_t) startHeap;
+        recordModuleStats(stats);
         if (res.IsEmpty()) return res;
         return handle_scope.Escape(res.ToLocalChecked());
     }
@@ -714,23 +974,38 @@ MaybeLocal<Value> BGJSV8Engine::require(std::string baseNameStr) {
     pathName = getPathName(fileName);
 
     // wrap source in anonymous function to set up an isolated scope
-    const char *szSourcePrefix = "(function (exports, require, module, __filename, __dirname) {";
-    const char *szSourcePostfix = "})";
     source = String::Concat(_isolate,
             String::Concat(_isolate,
-                    String::NewFromUtf8(_isolate, szSourcePrefix),
-                    String::NewFromUtf8(_isolate, buf)
+                    String::NewFromUtf8(_isolate, kModuleSourcePrefix),
+                    asset->makeString(_isolate)
             ),
-            String::NewFromUtf8(_isolate, szSourcePostfix)
+            String::NewFromUtf8(_isolate, kModuleSourcePostfix)
     );
-    free((void *) buf);
 
     // Create script origin
     v8::ScriptOrigin* origin = new ScriptOrigin(String::NewFromOneByte(Isolate::GetCurrent(),
                                             (const uint8_t *) baseNameStr.c_str(),
                                             NewStringType::kInternalized).ToLocalChecked());
-    // compile script
-    MaybeLocal<Script> scriptR = Script::Compile(context, source, origin);
+    MaybeLocal<Script> scriptR;
+    auto preloaded = _preloads.find(fileName);
+    if (preloaded != _preloads.end()) {
+        // compiled by a worker since require.preload; only has to be finalized
+        std::shared_ptr<BGJSScriptStreamer> streamer = preloaded->second;
+        _preloads.erase(preloaded);
+        scriptR = streamer->finish(context, source, *origin);
+        stats.codeCache = kCodeCacheStreamed;
+        if (!scriptR.IsEmpty() && !_codeCachePath.empty()) {
+            writeCodeCache(scriptR.ToLocalChecked(), getCodeCacheFileName(fileName, asset->data(), asset->length()),
+                           fileName);
+        }
+    } else {
+        // compile script; uses the persistent code cache if one is configured
+        scriptR = compileModule(context, source, origin, fileName, asset->data(), asset->length(), bundled,
+                                &stats.codeCache);
+    }
+    asset->close();
+    const double compiledTime = _platform->MonotonicallyIncreasingTime();
+    stats.compileTime = (compiledTime - time) * 1000;
 
     // run script; this will effectively return a function if everything worked
     // if not, something went wrong
@@ -744,12 +1019,12 @@ MaybeLocal<Value> BGJSV8Engine::require(std::string baseNameStr) {
 
         Local<Object> exportsObj = Object::New(_isolate);
         Local<Object> moduleObj = Object::New(_isolate);
-        moduleObj->Set(String::NewFromUtf8(_isolate, "id"), String::NewFromUtf8(_isolate, fileName.c_str()));
-        moduleObj->Set(String::NewFromUtf8(_isolate, "environment"), String::NewFromUtf8(_isolate, "BGJSContext"));
-        moduleObj->Set(String::NewFromUtf8(_isolate, "platform"), String::NewFromUtf8(_isolate, "android"));
-        moduleObj->Set(String::NewFromUtf8(_isolate, "exports"), exportsObj);
-        moduleObj->Set(String::NewFromUtf8(_isolate, "debug"), Boolean::New(_isolate, _debug));
-        moduleObj->Set(String::NewFromUtf8(_isolate, "isStoreBuild"), Boolean::New(_isolate, _isStoreBuild));
+        moduleObj->Set(getString(kStringId), String::NewFromUtf8(_isolate, fileName.c_str()));
+        moduleObj->Set(getString(kStringEnvironment), getString(kStringBGJSContext));
+        moduleObj->Set(getString(kStringPlatform), getString(kStringAndroid));
+        moduleObj->Set(getString(kStringExports), exportsObj);
+        moduleObj->Set(getString(kStringDebug), Boolean::New(_isolate, _debug));
+        moduleObj->Set(getString(kStringIsStoreBuild), Boolean::New(_isolate, _isStoreBuild));
 
         Handle<Value> fnModuleInitializerArgs[] = {
                 exportsObj,                                      // exports
@@ -762,18 +1037,272 @@ MaybeLocal<Value> BGJSV8Engine::require(std::string baseNameStr) {
         maybeLocal = fnModuleInitializer->Call(context, context->Global(), 5, fnModuleInitializerArgs);
 
         if (!maybeLocal.IsEmpty()) {
-            result = moduleObj->Get(String::NewFromUtf8(_isolate, "exports"));
-            _moduleCache[fileName].Reset(_isolate, result);
-
-            return handle_scope.Escape(result);
+            result = moduleObj->Get(getString(kStringExports));
+            moduleCache[fileName].Reset(_isolate, result);
         }
+    }
 
+    stats.evalTime = (_platform->MonotonicallyIncreasingTime() - compiledTime) * 1000;
+    stats.heapDelta = (int64_t) usedHeapSize() - (int64_t) startHeap;
+    recordModuleStats(stats);
+    if (!maybeLocal.IsEmpty()) {
+        return handle_scope.Escape(result);
     }
 
     // this only happens when something went wrong (e.g. exception)
     return maybeLocal;
 }
 
+void BGJSV8Engine::recordModuleStats(const BGJSModuleStats &stats) {
+    auto it = _moduleStatsIndex.find(stats.fileName);
+    if (it != _moduleStatsIndex.end()) {
+        // json modules are not cached, and failed modules can be required again
+        _moduleStats[it->second] = stats;
+    } else {
+        _moduleStatsIndex[stats.fileName] = _moduleStats.size();
+        _moduleStats.push_back(stats);
+    }
+}
+
+size_t BGJSV8Engine::usedHeapSize() const {
+    HeapStatistics heapStats;
+    _isolate->GetHeapStatistics(&heapStats);
+    return heapStats.used_heap_size();
+}
+
+std::string BGJSV8Engine::getModuleStatsJSON() const {
+    static const char *const codeCacheNames[] = {"none", "bundled", "hit", "miss", "streamed"};
+    std::ostringstream json;
+    json << "[";
+    for (size_t i = 0; i < _moduleStats.size(); i++) {
+        const BGJSModuleStats &stats = _moduleStats[i];
+        // asset paths need no escaping beyond quotes and backslashes
+        std::string fileName = stats.fileName;
+        find_and_replace(fileName, std::string("\\"), std::string("\\\\"));
+        find_and_replace(fileName, std::string("\""), std::string("\\\""));
+        json << (i ? "," : "") << "{\"file\":\"" << fileName << "\",\"probes\":" << stats.probes
+             << ",\"bytes\":" << stats.bytes << ",\"loadMs\":" << stats.loadTime
+             << ",\"compileMs\":" << stats.compileTime << ",\"evalMs\":" << stats.evalTime
+             << ",\"codeCache\":\"" << codeCacheNames[stats.codeCache] << "\",\"heapDelta\":" << stats.heapDelta
+             << "}";
+    }
+    json << "]";
+    return json.str();
+}
+
+std::string BGJSV8Engine::getArrayBufferStatsJSON() const {
+    // engines that created a snapshot have no allocator of their own
+    BGJSArrayBufferAllocator::Stats stats = {0, 0, 0, 0};
+    if (_arrayBufferAllocator) {
+        stats = _arrayBufferAllocator->getStats();
+    }
+    std::ostringstream json;
+    json << "{\"liveBytes\":" << stats.liveBytes << ",\"peakBytes\":" << stats.peakBytes
+         << ",\"allocations\":" << stats.allocations << ",\"poolHits\":" << stats.poolHits
+         << ",\"pooledBytes\":" << BGJSArrayBufferAllocator::getPooledBytes()
+         << ",\"poolLimit\":" << BGJSArrayBufferAllocator::getPoolLimit() << "}";
+    return json.str();
+}
+
+v8::Local<v8::ArrayBuffer> BGJSV8Engine::newUninitializedArrayBuffer(size_t length) {
+    void *data = _arrayBufferAllocator ? _arrayBufferAllocator->AllocateUninitialized(length) : nullptr;
+    if (!data) {
+        return v8::ArrayBuffer::New(_isolate, length);
+    }
+    // internalized contents are freed by the allocator of the isolate once the buffer is collected
+    return v8::ArrayBuffer::New(_isolate, data, length, v8::ArrayBufferCreationMode::kInternalized);
+}
+
+std::string BGJSV8Engine::writeModuleStats(const char *basePath) const {
+    char fileName[1024];
+    snprintf(fileName, sizeof(fileName), "%s/modulestats-%lu.json", basePath, (unsigned long) time(nullptr));
+    const std::string json = getModuleStatsJSON();
+    FILE *file = fopen(fileName, "wb");
+    if (!file) {
+        LOGE("Cannot write module stats to %s", fileName);
+        return std::string();
+    }
+    bool ok = fwrite(json.data(), 1, json.length(), file) == json.length();
+    ok = (fclose(file) == 0) && ok;
+    if (!ok) {
+        LOGE("Cannot write module stats to %s", fileName);
+        unlink(fileName);
+        return std::string();
+    }
+    return fileName;
+}
+
+void BGJSV8Engine::loadBundle() {
+    if (!_isBundleLoaded) {
+        _isBundleLoaded = true;
+        JNIEnv *env = JNIWrapper::getEnvironment();
+        _bundle = BGJSBundle::open(AAssetManager_fromJava(env, _javaAssetManager), BGJS_BUNDLE_ASSET);
+    }
+}
+
+void BGJSV8Engine::preload(std::string baseNameStr) {
+    if (_isCreatingSnapshot) {
+        // modules of a snapshot are compiled once at build time, there is nothing to win
+        return;
+    }
+    loadBundle();
+
+    BGJSResolvedModule resolvedModule;
+    auto resolved = _resolvedModules.find(baseNameStr);
+    if (resolved != _resolvedModules.end()) {
+        resolvedModule = resolved->second;
+    } else {
+        const std::string requestedName = baseNameStr;
+        if (baseNameStr.find("./") == 0) {
+            baseNameStr = baseNameStr.substr(2);
+            find_and_replace(baseNameStr, std::string("/./"), std::string("/"));
+            baseNameStr = normalize_path(baseNameStr);
+        }
+        if (_modules.count(baseNameStr) || _moduleCache.count(baseNameStr) ||
+            !resolveModule(baseNameStr, &resolvedModule)) {
+            // unknown modules throw once they are required
+            return;
+        }
+        _resolvedModules[requestedName] = resolvedModule;
+    }
+    const std::string &fileName = resolvedModule.fileName;
+    if (resolvedModule.isJson || _moduleCache.count(fileName) || _preloads.count(fileName)) {
+        return;
+    }
+
+    const BGJSBundle::Module *bundled = nullptr;
+    BGJSV8EngineAsset *asset = openModuleAsset(fileName, &bundled);
+    if (!asset) {
+        return;
+    }
+    // consuming a code cache is faster than anything a worker could do ahead of time
+    const bool hasCodeCache = (bundled && bundled->codeCache) || (!_codeCachePath.empty() &&
+            access(getCodeCacheFileName(fileName, asset->data(), asset->length()).c_str(), R_OK) == 0);
+    if (!hasCodeCache) {
+        std::string source;
+        source.reserve(strlen(kModuleSourcePrefix) + asset->length() + strlen(kModuleSourcePostfix));
+        source.append(kModuleSourcePrefix).append(asset->data(), asset->length()).append(kModuleSourcePostfix);
+        _preloads[fileName] = BGJSScriptStreamer::start(_isolate, _platform, std::move(source));
+    }
+    asset->close();
+}
+
+/**
+ * 64bit FNV-1a hash; used to derive code cache keys from module paths and contents
+ */
+static uint64_t fnv1aHash(const char *data, size_t length, uint64_t hash = 0xcbf29ce484222325ULL) {
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (uint8_t) data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string BGJSV8Engine::getCodeCacheFileName(const std::string &fileName, const char *buf, size_t length) const {
+    // the v8 version is part of the key so that an engine upgrade never even tries to consume stale caches
+    const char *version = v8::V8::GetVersion();
+    uint64_t pathHash = fnv1aHash(version, strlen(version));
+    pathHash = fnv1aHash(fileName.c_str(), fileName.length(), pathHash);
+    uint64_t contentHash = fnv1aHash(buf, length);
+
+    char name[64];
+    snprintf(name, sizeof(name), "/%016llx-%016llx.v8cache", (unsigned long long) pathHash,
+             (unsigned long long) contentHash);
+    return _codeCachePath + name;
+}
+
+MaybeLocal<Script> BGJSV8Engine::compileModule(Local<Context> context, Local<String> source, ScriptOrigin *origin,
+                                               const std::string &fileName, const char *buf, size_t length,
+                                               const BGJSBundle::Module *bundled, BGJSCodeCacheUse *codeCacheUse) {
+    BGJSTraceScope trace("BGJSV8Engine.compileModule");
+    BGJSCodeCacheUse unused;
+    if (!codeCacheUse) {
+        codeCacheUse = &unused;
+    }
+    *codeCacheUse = _codeCachePath.empty() ? kCodeCacheNone : kCodeCacheMiss;
+    if (bundled && bundled->codeCache) {
+        // the code cache of the bundle stays in the mapped asset
+        ScriptCompiler::CachedData *bundledData = new ScriptCompiler::CachedData(
+                bundled->codeCache, (int) bundled->codeCacheLength, ScriptCompiler::CachedData::BufferNotOwned);
+        ScriptCompiler::Source scriptSource(source, *origin, bundledData);
+        MaybeLocal<Script> scriptR = ScriptCompiler::Compile(context, &scriptSource, ScriptCompiler::kConsumeCodeCache);
+        if (scriptR.IsEmpty() || !bundledData->rejected) {
+            *codeCacheUse = kCodeCacheBundled;
+            return scriptR;
+        }
+        // made by another version of v8 or with other flags; the cache in the cache directory might still fit
+        LOGI("Code cache of bundled module %s was rejected", fileName.c_str());
+    }
+    if (_codeCachePath.empty()) {
+        return Script::Compile(context, source, origin);
+    }
+
+    const std::string cacheFileName = getCodeCacheFileName(fileName, buf, length);
+
+    // try to load an existing cache entry
+    ScriptCompiler::CachedData *cachedData = nullptr;
+    FILE *file = fopen(cacheFileName.c_str(), "rb");
+    if (file) {
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        if (size > 0) {
+            uint8_t *data = new uint8_t[size];
+            if (fread(data, 1, (size_t) size, file) == (size_t) size) {
+                cachedData = new ScriptCompiler::CachedData(data, (int) size,
+                                                            ScriptCompiler::CachedData::BufferOwned);
+            } else {
+                delete[] data;
+            }
+        }
+        fclose(file);
+    }
+
+    // source takes ownership of the cached data
+    ScriptCompiler::Source scriptSource(source, *origin, cachedData);
+    MaybeLocal<Script> scriptR = ScriptCompiler::Compile(context, &scriptSource,
+                                                         cachedData ? ScriptCompiler::kConsumeCodeCache
+                                                                    : ScriptCompiler::kNoCompileOptions);
+    if (scriptR.IsEmpty()) {
+        return scriptR;
+    }
+
+    if (cachedData && !cachedData->rejected) {
+        *codeCacheUse = kCodeCacheHit;
+        return scriptR;
+    }
+
+    if (cachedData) {
+        // v8 did not accept the data (e.g. flag mismatch); drop it and produce a fresh one below
+        LOGI("Code cache for %s was rejected", fileName.c_str());
+        unlink(cacheFileName.c_str());
+    }
+
+    writeCodeCache(scriptR.ToLocalChecked(), cacheFileName, fileName);
+    return scriptR;
+}
+
+void BGJSV8Engine::writeCodeCache(Local<Script> script, const std::string &cacheFileName,
+                                  const std::string &fileName) {
+    ScriptCompiler::CachedData *newData = ScriptCompiler::CreateCodeCache(script->GetUnboundScript());
+    if (!newData) {
+        return;
+    }
+
+    // write to a temporary file first so that a crash never leaves a truncated entry behind
+    const std::string tmpFileName = cacheFileName + ".tmp";
+    FILE *file = fopen(tmpFileName.c_str(), "wb");
+    if (file) {
+        bool ok = fwrite(newData->data, 1, (size_t) newData->length, file) == (size_t) newData->length;
+        ok = (fclose(file) == 0) && ok;
+        if (!ok || rename(tmpFileName.c_str(), cacheFileName.c_str()) != 0) {
+            LOGE("Failed to write code cache for %s", fileName.c_str());
+            unlink(tmpFileName.c_str());
+        }
+    }
+    delete newData;
+}
+
 v8::Isolate *BGJSV8Engine::getIsolate() const {
     if (_isolate == nullptr) {
         JNIEnv *env = JNIWrapper::getEnvironment();
@@ -788,50 +1317,190 @@ v8::Local<v8::Context> BGJSV8Engine::getContext() const {
     return scope.Escape(Local<Context>::New(_isolate, _context));
 }
 
-void BGJSV8Engine::js_global_getLocale(Local<String> property,
-                                       const v8::PropertyCallbackInfo<v8::Value> &info) {
-    EscapableHandleScope scope(Isolate::GetCurrent());
-    BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(info.GetIsolate());
-
-    if (ctx->_locale) {
-        info.GetReturnValue().Set(scope.Escape(String::NewFromUtf8(Isolate::GetCurrent(), ctx->_locale)));
-    } else {
-        info.GetReturnValue().SetNull();
+v8::Local<v8::Context> BGJSV8Engine::getContext(int id) const {
+    if (id == 0) {
+        return getContext();
     }
+    auto it = _isolatedContexts.find(id);
+    if (it == _isolatedContexts.end() || it->second->disposed) {
+        return Local<Context>();
+    }
+    EscapableHandleScope scope(_isolate);
+    return scope.Escape(Local<Context>::New(_isolate, it->second->context));
 }
 
-void BGJSV8Engine::js_global_getLang(Local<String> property,
-                                     const v8::PropertyCallbackInfo<v8::Value> &info) {
-    EscapableHandleScope scope(Isolate::GetCurrent());
-    BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(info.GetIsolate());
-
-    if (ctx->_lang) {
-        info.GetReturnValue().Set(scope.Escape(String::NewFromUtf8(Isolate::GetCurrent(), ctx->_lang)));
-    } else {
-        info.GetReturnValue().SetNull();
+BGJSV8EngineContext *BGJSV8Engine::getCurrentIsolatedContext() const {
+    if (_isolatedContexts.empty() || !_isolate->InContext()) {
+        return nullptr;
     }
+    return reinterpret_cast<BGJSV8EngineContext *>(_isolate->GetCurrentContext()->GetAlignedPointerFromEmbedderData(
+            EBGJSV8EngineEmbedderData::kIsolatedContext));
 }
 
-void BGJSV8Engine::js_global_getTz(Local<String> property,
-                                   const v8::PropertyCallbackInfo<v8::Value> &info) {
-    EscapableHandleScope scope(Isolate::GetCurrent());
-    BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(info.GetIsolate());
+int BGJSV8Engine::createIsolatedContext() {
+    BGJS_ASSERT_LOCKED(_isolate)
+    HandleScope scope(_isolate);
 
-    if (ctx->_tz) {
-        info.GetReturnValue().Set(scope.Escape(String::NewFromUtf8(Isolate::GetCurrent(), ctx->_tz)));
-    } else {
-        info.GetReturnValue().SetNull();
+    // all contexts share the templates of the bindings, so they only pay for their instances
+    if (_globalTemplate.IsEmpty()) {
+        _globalTemplate.Reset(_isolate, createGlobalTemplate());
     }
-}
+    Local<Context> context = v8::Context::New(_isolate, nullptr, Local<ObjectTemplate>::New(_isolate, _globalTemplate));
 
-void BGJSV8Engine::js_global_getDeviceClass(Local<String> property,
-                                            const v8::PropertyCallbackInfo<v8::Value> &info) {
-    EscapableHandleScope scope(Isolate::GetCurrent());
-    BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(info.GetIsolate());
+    BGJSV8EngineContext *isolatedContext = new BGJSV8EngineContext();
+    isolatedContext->id = _nextContextId++;
+    isolatedContext->engine = this;
+    isolatedContext->disposed = false;
+    isolatedContext->context.Reset(_isolate, context);
+    context->SetAlignedPointerInEmbedderData(EBGJSV8EngineEmbedderData::kContext, this);
+    context->SetAlignedPointerInEmbedderData(EBGJSV8EngineEmbedderData::kIsolatedContext, isolatedContext);
+    _isolatedContexts[isolatedContext->id] = isolatedContext;
 
-    if (ctx->_deviceClass) {
-        info.GetReturnValue().Set(scope.Escape(String::NewFromUtf8(Isolate::GetCurrent(), ctx->_deviceClass)));
-    } else {
+    v8::Context::Scope ctxScope(context);
+    context->Global()->Set(context, String::NewFromUtf8(_isolate, "global"), context->Global()).FromJust();
+
+    return isolatedContext->id;
+}
+
+bool BGJSV8Engine::disposeIsolatedContext(int id) {
+    BGJS_ASSERT_LOCKED(_isolate)
+    auto it = _isolatedContexts.find(id);
+    if (it == _isolatedContexts.end() || it->second->disposed) {
+        return false;
+    }
+    BGJSV8EngineContext *isolatedContext = it->second;
+    isolatedContext->disposed = true;
+    isolatedContext->moduleCache.clear();
+    isolatedContext->requireFn.Reset();
+    isolatedContext->makeRequireFn.Reset();
+
+    for (auto timer = _timersById.begin(); timer != _timersById.end();) {
+        if (timer->second->context != id) {
+            ++timer;
+            continue;
+        }
+        if (_timers.isScheduled(timer->second)) {
+            _timers.release(timer->second);
+        } else {
+            // callback is currently running; runTimers will release the timer once it returns
+            timer->second->cancelled = true;
+        }
+        timer = _timersById.erase(timer);
+    }
+
+    // functions of the context may still be held by java or other contexts, so the state goes with the context
+    isolatedContext->context.SetWeak(isolatedContext, &BGJSV8Engine::onIsolatedContextCollected,
+                                     WeakCallbackType::kParameter);
+    _isolate->ContextDisposedNotification();
+    return true;
+}
+
+void BGJSV8Engine::onIsolatedContextCollected(const v8::WeakCallbackInfo<BGJSV8EngineContext> &info) {
+    BGJSV8EngineContext *isolatedContext = info.GetParameter();
+    isolatedContext->context.Reset();
+    isolatedContext->engine->_isolatedContexts.erase(isolatedContext->id);
+    delete isolatedContext;
+}
+
+v8::Local<v8::Private> BGJSV8Engine::getWrapperCacheKey() {
+    EscapableHandleScope scope(_isolate);
+    if (_wrapperCacheKey.IsEmpty()) {
+        _wrapperCacheKey.Reset(_isolate, Private::New(_isolate, String::NewFromUtf8(_isolate, "JNIV8Wrapper")));
+    }
+    return scope.Escape(Local<Private>::New(_isolate, _wrapperCacheKey));
+}
+
+v8::Local<v8::String> BGJSV8Engine::getString(EBGJSV8EngineString name) {
+    static const char* const kStrings[kStringCount] = {
+            "id", "exports", "environment", "platform", "debug", "isStoreBuild", "main", "BGJSContext", "android"
+    };
+
+    // eternal handles can not be released, which a snapshot creator requires of all handles
+    if (_isCreatingSnapshot) {
+        return String::NewFromUtf8(_isolate, kStrings[name], NewStringType::kInternalized).ToLocalChecked();
+    }
+    if (_strings[name].IsEmpty()) {
+        _strings[name].Set(_isolate, String::NewFromUtf8(_isolate, kStrings[name], NewStringType::kInternalized).ToLocalChecked());
+    }
+    return _strings[name].Get(_isolate);
+}
+
+v8::Local<v8::String> BGJSV8Engine::getPropertyName(const uint16_t *chars, int length) {
+    return _propertyNames.get(_isolate, chars, length);
+}
+
+int BGJSV8Engine::createPropertyKey(const uint16_t *chars, int length) {
+    std::u16string name((const char16_t *) chars, (size_t) length);
+    auto it = _propertyKeysByName.find(name);
+    if (it != _propertyKeysByName.end()) {
+        return it->second;
+    }
+
+    HandleScope scope(_isolate);
+    Local<String> string = String::NewFromTwoByte(_isolate, chars, NewStringType::kInternalized, length).ToLocalChecked();
+    const int key = (int) _propertyKeys.size();
+    _propertyKeys.emplace_back(_isolate, string);
+    _propertyKeysByName[name] = key;
+    return key;
+}
+
+v8::Local<v8::String> BGJSV8Engine::getPropertyKey(int key) const {
+    return _propertyKeys[key].Get(_isolate);
+}
+
+v8::Local<v8::ObjectTemplate> BGJSV8Engine::getRecordTemplate(const void *layout) const {
+    auto it = _recordTemplates.find(layout);
+    return it != _recordTemplates.end() ? it->second.Get(_isolate) : v8::Local<v8::ObjectTemplate>();
+}
+
+void BGJSV8Engine::setRecordTemplate(const void *layout, v8::Local<v8::ObjectTemplate> tpl) {
+    _recordTemplates[layout] = v8::Eternal<v8::ObjectTemplate>(_isolate, tpl);
+}
+
+void BGJSV8Engine::js_global_getLocale(Local<String> property,
+                                       const v8::PropertyCallbackInfo<v8::Value> &info) {
+    EscapableHandleScope scope(Isolate::GetCurrent());
+    BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(info.GetIsolate());
+
+    if (ctx->_locale) {
+        info.GetReturnValue().Set(scope.Escape(String::NewFromUtf8(Isolate::GetCurrent(), ctx->_locale)));
+    } else {
+        info.GetReturnValue().SetNull();
+    }
+}
+
+void BGJSV8Engine::js_global_getLang(Local<String> property,
+                                     const v8::PropertyCallbackInfo<v8::Value> &info) {
+    EscapableHandleScope scope(Isolate::GetCurrent());
+    BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(info.GetIsolate());
+
+    if (ctx->_lang) {
+        info.GetReturnValue().Set(scope.Escape(String::NewFromUtf8(Isolate::GetCurrent(), ctx->_lang)));
+    } else {
+        info.GetReturnValue().SetNull();
+    }
+}
+
+void BGJSV8Engine::js_global_getTz(Local<String> property,
+                                   const v8::PropertyCallbackInfo<v8::Value> &info) {
+    EscapableHandleScope scope(Isolate::GetCurrent());
+    BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(info.GetIsolate());
+
+    if (ctx->_tz) {
+        info.GetReturnValue().Set(scope.Escape(String::NewFromUtf8(Isolate::GetCurrent(), ctx->_tz)));
+    } else {
+        info.GetReturnValue().SetNull();
+    }
+}
+
+void BGJSV8Engine::js_global_getDeviceClass(Local<String> property,
+                                            const v8::PropertyCallbackInfo<v8::Value> &info) {
+    EscapableHandleScope scope(Isolate::GetCurrent());
+    BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(info.GetIsolate());
+
+    if (ctx->_deviceClass) {
+        info.GetReturnValue().Set(scope.Escape(String::NewFromUtf8(Isolate::GetCurrent(), ctx->_deviceClass)));
+    } else {
         info.GetReturnValue().SetNull();
     }
 }
@@ -839,16 +1508,24 @@ void BGJSV8Engine::js_global_getDeviceClass(Local<String> property,
 void BGJSV8Engine::js_global_requestAnimationFrame(
         const v8::FunctionCallbackInfo<v8::Value> &args) {
     BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(args.GetIsolate());
-    v8::Locker l(args.GetIsolate());
+    BGJS_ASSERT_LOCKED(args.GetIsolate())
     HandleScope scope(args.GetIsolate());
 
     if (args.Length() >= 2 && args[0]->IsFunction() && args[1]->IsObject()) {
+        // gl views keep their callbacks natively and run them in one batch per frame
+        auto glView = JNIV8Wrapper::wrapObject<BGJSGLView>(args[1]->ToObject(args.GetIsolate()));
+        if (glView) {
+            args.GetReturnValue().Set(glView->requestAnimationFrame(Local<Function>::Cast(args[0])));
+            return;
+        }
+
         Local<Object> localFunc = args[0]->ToObject(args.GetIsolate());
 
         auto view = JNIV8Wrapper::wrapObject<JNIV8Object>(args[1]->ToObject(args.GetIsolate()));
         jobject functionWrapped = JNIV8Marshalling::v8value2jobject(localFunc);
         args.GetReturnValue().Set(view->callJavaIntMethod("requestAnimationFrame", functionWrapped));
         JNIWrapper::getEnvironment()->DeleteLocalRef(functionWrapped);
+        return;
     } else {
         LOGI("requestAnimationFrame: Wrong number or type of parameters (num %d, is function %d %d, is object %d %d, is null %d %d)",
              args.Length(), args[0]->IsFunction(), args.Length() >= 2 ? args[1]->IsFunction() : false,
@@ -866,7 +1543,7 @@ void BGJSV8Engine::js_global_requestAnimationFrame(
 void BGJSV8Engine::js_process_nextTick(const v8::FunctionCallbackInfo<v8::Value> &args) {
     BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(args.GetIsolate());
 
-    if (args.Length() >= 2 && args[0]->IsFunction()) {
+    if (args.Length() >= 1 && args[0]->IsFunction()) {
         ctx->enqueueNextTick(args);
     }
 }
@@ -874,13 +1551,18 @@ void BGJSV8Engine::js_process_nextTick(const v8::FunctionCallbackInfo<v8::Value>
 void BGJSV8Engine::js_global_cancelAnimationFrame(
         const v8::FunctionCallbackInfo<v8::Value> &args) {
     BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(args.GetIsolate());
-    v8::Locker l(ctx->getIsolate());
+    BGJS_ASSERT_LOCKED(ctx->getIsolate())
     HandleScope scope(ctx->getIsolate());
     if (args.Length() >= 2 && args[0]->IsNumber() && args[1]->IsObject()) {
 
         int id = (int) (Local<Number>::Cast(args[0])->Value());
-        auto view = JNIV8Wrapper::wrapObject<JNIV8Object>(args[1]->ToObject(ctx->getIsolate()));
-        view->callJavaVoidMethod("cancelAnimationFrame", id);
+        auto glView = JNIV8Wrapper::wrapObject<BGJSGLView>(args[1]->ToObject(ctx->getIsolate()));
+        if (glView) {
+            glView->cancelAnimationFrame(id);
+        } else {
+            auto view = JNIV8Wrapper::wrapObject<JNIV8Object>(args[1]->ToObject(ctx->getIsolate()));
+            view->callJavaVoidMethod("cancelAnimationFrame", id);
+        }
     } else {
         ctx->getIsolate()->ThrowException(
                 v8::Exception::ReferenceError(
@@ -899,35 +1581,45 @@ void BGJSV8Engine::js_global_setInterval(const v8::FunctionCallbackInfo<v8::Valu
     setTimeoutInt(args, true);
 }
 
+/**
+ * monotonic time in ms; same clock as SystemClock.uptimeMillis used by the java Handler
+ */
+static uint64_t getMonotonicTime() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000 + (uint64_t) ts.tv_nsec / 1000000;
+}
+
 void BGJSV8Engine::setTimeoutInt(const v8::FunctionCallbackInfo<v8::Value> &args,
                                  bool recurring) {
     BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(args.GetIsolate());
-    v8::Locker l(args.GetIsolate());
+    BGJS_ASSERT_LOCKED(args.GetIsolate())
     HandleScope scope(args.GetIsolate());
 
 
     if (args.Length() == 2 && args[0]->IsFunction() && args[1]->IsNumber()) {
         Local<v8::Function> callback = Local<Function>::Cast(args[0]);
 
-        WrapPersistentFunc *ws = new WrapPersistentFunc();
-        BGJS_RESET_PERSISTENT(ctx->getIsolate(), ws->callbackFunc, callback);
-        WrapPersistentObj *wo = new WrapPersistentObj();
-        BGJS_RESET_PERSISTENT(ctx->getIsolate(), wo->obj, args.This());
+        double delay = Local<Number>::Cast(args[1])->Value();
+        // negative, NaN and huge delays behave like in browsers: they are clamped to 0
+        if (!(delay >= 0) || delay > INT32_MAX) {
+            delay = 0;
+        }
 
-        jlong timeout = (jlong) (Local<Number>::Cast(args[1])->Value());
+        BGJSTimer *timer = ctx->_timers.allocate();
+        timer->callback.Reset(ctx->getIsolate(), callback);
+        timer->thisObj.Reset(ctx->getIsolate(), args.This());
+        timer->id = ctx->_nextTimerId++;
+        BGJSV8EngineContext *isolatedContext = ctx->getCurrentIsolatedContext();
+        timer->context = isolatedContext ? isolatedContext->id : 0;
+        timer->interval = (uint32_t) delay;
+        timer->recurring = recurring;
 
-        JNIEnv *env = JNIWrapper::getEnvironment();
-        if (env == NULL) {
-            LOGE("Cannot execute setTimeout with no envCache");
-            args.GetReturnValue().SetUndefined();
-            return;
-        }
+        ctx->_timers.schedule(timer, getMonotonicTime(), timer->interval);
+        ctx->_timersById[timer->id] = timer;
+        ctx->requestTimerTick(timer->expires);
 
-        assert(ctx->_jniV8Engine.setTimeoutId);
-        assert(ctx->_jniV8Engine.clazz);
-        int subId = env->CallStaticIntMethod(ctx->_jniV8Engine.clazz, ctx->_jniV8Engine.setTimeoutId, (jlong) ws,
-                                             (jlong) wo, timeout, (jboolean) recurring);
-        args.GetReturnValue().Set(subId);
+        args.GetReturnValue().Set(timer->id);
     } else {
         ctx->getIsolate()->ThrowException(
                 v8::Exception::ReferenceError(
@@ -946,7 +1638,7 @@ void BGJSV8Engine::js_global_clearTimeout(const v8::FunctionCallbackInfo<v8::Val
 
 void BGJSV8Engine::clearTimeoutInt(const v8::FunctionCallbackInfo<v8::Value> &args) {
     BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(args.GetIsolate());
-    v8::Locker l(ctx->getIsolate());
+    BGJS_ASSERT_LOCKED(ctx->getIsolate())
     HandleScope scope(ctx->getIsolate());
 
     args.GetReturnValue().SetUndefined();
@@ -959,13 +1651,19 @@ void BGJSV8Engine::clearTimeoutInt(const v8::FunctionCallbackInfo<v8::Value> &ar
             return;
         }
 
-        JNIEnv *env = JNIWrapper::getEnvironment();
-        if (env == NULL) {
-            LOGE("Cannot execute setTimeout with no envCache");
+        auto it = ctx->_timersById.find(id);
+        if (it == ctx->_timersById.end()) {
             return;
         }
+        BGJSTimer *timer = it->second;
+        ctx->_timersById.erase(it);
 
-        env->CallStaticVoidMethod(ctx->_jniV8Engine.clazz, ctx->_jniV8Engine.removeTimeoutId, (jint) id);
+        if (ctx->_timers.isScheduled(timer)) {
+            ctx->_timers.release(timer);
+        } else {
+            // callback is currently running; runTimers will release the timer once it returns
+            timer->cancelled = true;
+        }
     } else {
         ctx->getIsolate()->ThrowException(
                 v8::Exception::ReferenceError(
@@ -974,6 +1672,374 @@ void BGJSV8Engine::clearTimeoutInt(const v8::FunctionCallbackInfo<v8::Value> &ar
     }
 }
 
+void BGJSV8Engine::requestTimerTick(uint64_t tick) {
+    // runTimers reports the next tick itself when it is done
+    if (_isRunningTimers || tick >= _scheduledTimerTick) {
+        return;
+    }
+    _scheduledTimerTick = tick;
+
+    const uint64_t now = getMonotonicTime();
+    JNIEnv *env = JNIWrapper::getEnvironment();
+    jobject javaObject = getJObject();
+    _jniV8Engine.scheduleTimers.call(env, javaObject, (jlong) (tick > now ? tick - now : 0));
+    env->DeleteLocalRef(javaObject);
+}
+
+void BGJSV8Engine::runOnJSThread(BGJSV8EngineTask task, void *data) {
+    {
+        std::lock_guard<std::mutex> lock(_tasksMutex);
+        _tasks.push_back(std::make_pair(task, data));
+        if (_tasks.size() > 1) {
+            // an earlier task already asked for a tick that has not run yet
+            return;
+        }
+    }
+
+    JNIEnv *env = JNIWrapper::getEnvironment();
+    jobject javaObject = getJObject();
+    _jniV8Engine.scheduleTimers.call(env, javaObject, (jlong) 0);
+    env->DeleteLocalRef(javaObject);
+}
+
+std::vector<void *> BGJSV8Engine::cancelJSThreadTasks(BGJSV8EngineTask task) {
+    std::vector<void *> cancelled;
+    std::lock_guard<std::mutex> lock(_tasksMutex);
+    size_t kept = 0;
+    for (auto &entry : _tasks) {
+        if (entry.first == task) {
+            cancelled.push_back(entry.second);
+        } else {
+            _tasks[kept++] = entry;
+        }
+    }
+    _tasks.resize(kept);
+    return cancelled;
+}
+
+void BGJSV8Engine::postTask(BGJSV8EngineTask task, void *data, BGJSTaskPriority priority) {
+    if (!_scheduler.post(task, data, priority)) {
+        // an earlier task already asked for a tick
+        return;
+    }
+
+    JNIEnv *env = JNIWrapper::getEnvironment();
+    jobject javaObject = getJObject();
+    _jniV8Engine.scheduleTimers.call(env, javaObject, (jlong) 0);
+    env->DeleteLocalRef(javaObject);
+}
+
+void BGJSV8Engine::js_scheduler_postTask(const v8::FunctionCallbackInfo<v8::Value> &args) {
+    Isolate *isolate = args.GetIsolate();
+    BGJSV8Engine *ctx = BGJSV8Engine::GetInstance(isolate);
+    BGJS_ASSERT_LOCKED(isolate)
+    HandleScope scope(isolate);
+    Local<Context> context = isolate->GetCurrentContext();
+
+    if (args.Length() < 1 || !args[0]->IsFunction()) {
+        isolate->ThrowException(v8::Exception::TypeError(
+                String::NewFromUtf8(isolate, "postTask: first argument has to be a function")));
+        return;
+    }
+    BGJSTaskPriority priority = kTaskPriorityUserVisible;
+    if (args.Length() >= 2 && args[1]->IsObject()) {
+        Local<Value> value;
+        if (!args[1].As<Object>()->Get(context, String::NewFromUtf8(isolate, "priority")).ToLocal(&value)) {
+            return;
+        }
+        if (!BGJSTaskScheduler::parsePriority(isolate, value, &priority)) {
+            isolate->ThrowException(v8::Exception::TypeError(String::NewFromUtf8(isolate,
+                    "postTask: priority has to be one of user-blocking, user-visible and background")));
+            return;
+        }
+    }
+
+    Local<Promise::Resolver> resolver;
+    if (!Promise::Resolver::New(context).ToLocal(&resolver)) {
+        return;
+    }
+    if (ctx->_scheduler.post(isolate, args[0].As<Function>(), resolver, priority)) {
+        ctx->requestTimerTick(getMonotonicTime());
+    }
+    args.GetReturnValue().Set(resolver->GetPromise());
+}
+
+jlong BGJSV8Engine::runTimers() {
+    BGJSTraceScope trace("BGJSV8Engine.runTimers");
+    Local<Context> context = _isolate->GetCurrentContext();
+    HandleScope scope(_isolate);
+
+    // tasks posted by other threads run before the timers; the ones they post in turn wait for the next tick
+    {
+        std::lock_guard<std::mutex> lock(_tasksMutex);
+        _runningTasks.swap(_tasks);
+    }
+    for (auto &task : _runningTasks) {
+        task.first(this, task.second);
+    }
+    _runningTasks.clear();
+
+    const uint64_t now = getMonotonicTime();
+    _isRunningTimers = true;
+    _isIdleGCDone = false;
+
+    // input handlers and the like go before the timers, however long they take
+    _scheduler.run(this, kTaskPriorityUserBlocking, INFINITY);
+
+    _dueTimers.clear();
+    _timers.advance(now, _dueTimers);
+
+    bool failed = false;
+    for (size_t i = 0; i < _dueTimers.size(); i++) {
+        BGJSTimer *timer = _dueTimers[i];
+
+        if (timer->cancelled) {
+            _timers.release(timer);
+            continue;
+        }
+        if (failed) {
+            // an exception is pending in java; remaining timers are postponed to the next tick
+            _timers.schedule(timer, now, 0);
+            continue;
+        }
+
+        TryCatch trycatch(_isolate);
+        Local<Function> callback = Local<Function>::New(_isolate, timer->callback);
+        Local<Object> thisObj = Local<Object>::New(_isolate, timer->thisObj);
+        if (callback->Call(context, thisObj, 0, nullptr).IsEmpty()) {
+            forwardV8ExceptionToJNI(&trycatch);
+            failed = true;
+        }
+
+        if (timer->cancelled) {
+            _timers.release(timer);
+        } else if (timer->recurring) {
+            _timers.schedule(timer, now, timer->interval);
+        } else {
+            _timersById.erase(timer->id);
+            _timers.release(timer);
+        }
+    }
+    _dueTimers.clear();
+
+    // everything else only gets a slice; what is left waits for the frames and messages of the looper
+    if (!failed && _scheduler.hasTasks()) {
+        const double deadline = _scheduler.sliceDeadline();
+        _scheduler.run(this, kTaskPriorityUserVisible, deadline);
+        if (!_scheduler.hasTasks(kTaskPriorityUserVisible)) {
+            _scheduler.run(this, kTaskPriorityBackground, deadline);
+        }
+    }
+
+    _isRunningTimers = false;
+    _scheduledTimerTick = _timers.nextTick();
+
+    {
+        // the java side replaces the message of a task posted in the meantime with the returned delay
+        std::lock_guard<std::mutex> lock(_tasksMutex);
+        if (!_tasks.empty() || _scheduler.hasTasks()) {
+            _scheduledTimerTick = now;
+        }
+    }
+
+    if (_scheduledTimerTick == UINT64_MAX) {
+        return -1;
+    }
+    return (jlong) (_scheduledTimerTick > now ? _scheduledTimerTick - now : 0);
+}
+
+// idle periods shorter than this are not worth waking the garbage collector for, in ms
+#define BGJS_MIN_IDLE_TIME 1
+// while views render, garbage is collected in their frames; work on the js thread could hold up the next one, in ms
+#define BGJS_FRAME_IDLE_TIMEOUT 100
+// long idle notifications do nothing unless the heap grew by this much since the last one
+#define BGJS_LONG_IDLE_MIN_GROWTH (1024 * 1024)
+
+void BGJSV8Engine::idleNotification(double deadline, bool afterFrame) {
+    rotateBackgroundCpuProfile();
+
+    const uint64_t now = getMonotonicTime();
+    if (afterFrame) {
+        // every frame runs js
+        _isIdleGCDone = false;
+        _lastFrameTime = now;
+    } else if (now - _lastFrameTime < BGJS_FRAME_IDLE_TIMEOUT) {
+        return;
+    }
+    if (deadline - now < BGJS_MIN_IDLE_TIME) {
+        return;
+    }
+
+    // objects finalized by java go first; what they leave behind is collected in the time that is left, if any
+    bool hasDisposals = !_runningDisposals.empty();
+    if (!hasDisposals) {
+        std::lock_guard<std::mutex> lock(_disposalsMutex);
+        hasDisposals = !_pendingDisposals.empty();
+    }
+    if (hasDisposals) {
+        _isIdleGCDone = false;
+        if (!runPendingDisposals(deadline, SIZE_MAX)) {
+            // the wake queued for the rest by disposeLater or wakeForDisposals goes on with it
+            return;
+        }
+    }
+    const double idleTime = deadline - getMonotonicTime();
+    if (_isIdleGCDone || idleTime < BGJS_MIN_IDLE_TIME) {
+        return;
+    }
+
+    // the deadline has to be in the time base of the platform
+    const double start = _platform->MonotonicallyIncreasingTime();
+    _isIdleGCDone = _isolate->IdleNotificationDeadline(start + idleTime / 1000);
+    const double left = start + idleTime / 1000 - _platform->MonotonicallyIncreasingTime();
+    if (left > 0) {
+        v8::platform::RunIdleTasks(_platform, _isolate, left);
+    }
+}
+
+// destructors are cheap compared to reading the clock
+#define BGJS_DISPOSALS_PER_DEADLINE_CHECK 32
+// objects a wake of the js thread deletes, whether it is idle or not
+#define BGJS_DISPOSALS_PER_WAKE 64
+// past this many waiting objects or this age of the oldest one in ms, they are deleted without making way for frames
+#define BGJS_DISPOSALS_FORCE_COUNT 256
+#define BGJS_DISPOSALS_FORCE_AGE 1000
+
+void BGJSV8Engine::disposeLater(JNIObject *object) {
+    {
+        std::lock_guard<std::mutex> lock(_disposalsMutex);
+        _pendingDisposals.push_back(object);
+        if (!_disposalsSince) {
+            _disposalsSince = getMonotonicTime();
+        }
+        if (_isDisposalWakeQueued) {
+            // an earlier object already woke the js thread
+            return;
+        }
+        _isDisposalWakeQueued = true;
+    }
+    runOnJSThread(wakeForDisposals, nullptr);
+}
+
+void BGJSV8Engine::wakeForDisposals(BGJSV8Engine *engine, void *data) {
+    {
+        std::lock_guard<std::mutex> lock(engine->_disposalsMutex);
+        engine->_isDisposalWakeQueued = false;
+    }
+    // the idle handler deletes as many as fit into the time the js thread has left, but it does not run while views
+    // render or the engine is paused => a batch goes right away
+    if (engine->runPendingDisposals(INFINITY, BGJS_DISPOSALS_PER_WAKE)) {
+        return;
+    }
+
+    size_t count = engine->_runningDisposals.size();
+    uint64_t since;
+    {
+        std::lock_guard<std::mutex> lock(engine->_disposalsMutex);
+        if (engine->_isDisposalWakeQueued) {
+            return;
+        }
+        engine->_isDisposalWakeQueued = true;
+        count += engine->_pendingDisposals.size();
+        since = engine->_disposalsSince;
+    }
+    if (count >= BGJS_DISPOSALS_FORCE_COUNT || getMonotonicTime() - since >= BGJS_DISPOSALS_FORCE_AGE) {
+        engine->runOnJSThread(wakeForDisposals, nullptr);
+    } else {
+        engine->postTask(wakeForDisposals, nullptr, kTaskPriorityBackground);
+    }
+}
+
+void BGJSV8Engine::drainDisposals() {
+    runPendingDisposals(INFINITY, SIZE_MAX);
+}
+
+bool BGJSV8Engine::runPendingDisposals(double deadline, size_t limit) {
+    BGJSTraceScope trace("BGJSV8Engine.runPendingDisposals");
+    size_t count = 0;
+    while (true) {
+        if (_runningDisposals.empty()) {
+            std::lock_guard<std::mutex> lock(_disposalsMutex);
+            if (_pendingDisposals.empty()) {
+                _disposalsSince = 0;
+                return true;
+            }
+            _runningDisposals.swap(_pendingDisposals);
+        }
+        if (count == limit || (++count % BGJS_DISPOSALS_PER_DEADLINE_CHECK == 0 && getMonotonicTime() >= deadline)) {
+            return false;
+        }
+        delete _runningDisposals.back();
+        _runningDisposals.pop_back();
+    }
+}
+
+void BGJSV8Engine::longIdleNotification() {
+    HeapStatistics stats;
+    _isolate->GetHeapStatistics(&stats);
+    if (stats.used_heap_size() < _heapSizeAfterLongIdle + BGJS_LONG_IDLE_MIN_GROWTH) {
+        return;
+    }
+    _isolate->LowMemoryNotification();
+    _isolate->GetHeapStatistics(&stats);
+    _heapSizeAfterLongIdle = stats.used_heap_size();
+    _isIdleGCDone = true;
+    LOGD("Collected garbage after long idle period, heap is %zu bytes", _heapSizeAfterLongIdle);
+}
+
+void BGJSV8Engine::onMemoryPressure(EBGJSMemoryPressure level) {
+    LOGI("Memory pressure %d", (int) level);
+    _isolate->MemoryPressureNotification(level == kMemoryPressureCritical ? v8::MemoryPressureLevel::kCritical :
+                                         level == kMemoryPressureModerate ? v8::MemoryPressureLevel::kModerate :
+                                         v8::MemoryPressureLevel::kNone);
+    if (level == kMemoryPressureNone) {
+        return;
+    }
+    // the gl threads free them before their next frame
+    EJCanvasResources::requestPurge(level == kMemoryPressureCritical);
+    // pooled ArrayBuffers are not counted by the heap, so v8 can not free them
+    BGJSArrayBufferAllocator::trimPool(level == kMemoryPressureCritical ? 0 : BGJSArrayBufferAllocator::getPoolLimit() / 2);
+    if (level == kMemoryPressureCritical) {
+        runOnJSThread(purgePropertyNames, nullptr);
+    }
+}
+
+void BGJSV8Engine::purgePropertyNames(BGJSV8Engine *engine, void *data) {
+    engine->_propertyNames.clear();
+}
+
+// the heap limit is raised by a quarter of the initial one at a time, up to this many times
+#define BGJS_HEAP_LIMIT_RAISES 2
+
+/**
+ * called by v8 in the middle of a garbage collection when the heap is about to run out
+ * the limit set with setMaxHeapSize is raised a few times, so the app can react before v8 aborts the process
+ */
+size_t BGJSV8Engine::NearHeapLimitCallback(void *data, size_t currentHeapLimit, size_t initialHeapLimit) {
+    BGJSV8Engine *engine = reinterpret_cast<BGJSV8Engine *>(data);
+    if (currentHeapLimit >= initialHeapLimit + initialHeapLimit / 4 * BGJS_HEAP_LIMIT_RAISES) {
+        LOGE("js heap reached its limit of %zu bytes", currentHeapLimit);
+        return currentHeapLimit;
+    }
+    const size_t heapLimit = currentHeapLimit + initialHeapLimit / 4;
+    LOGE("js heap is close to its limit of %zu bytes, raising it to %zu", currentHeapLimit, heapLimit);
+    // js can not run during garbage collection
+    engine->runOnJSThread(reportNearHeapLimit, (void *) heapLimit);
+    return heapLimit;
+}
+
+void BGJSV8Engine::reportNearHeapLimit(BGJSV8Engine *engine, void *data) {
+    JNIEnv *env = JNIWrapper::getEnvironment();
+    jobject javaObject = engine->getJObject();
+    _jniV8Engine.onNearHeapLimit.call(env, javaObject, (jlong) (size_t) data);
+    env->DeleteLocalRef(javaObject);
+    if (env->ExceptionCheck()) {
+        LOGE("Exception in near heap limit listener");
+        env->ExceptionDescribe();
+        env->ExceptionClear();
+    }
+}
+
 /**
  * cache JNI class references
  */
@@ -983,6 +2049,8 @@ void BGJSV8Engine::initJNICache() {
     _jniV8JSException.clazz = (jclass) env->NewGlobalRef(env->FindClass("ag/boersego/bgjs/V8JSException"));
     _jniV8JSException.initId = env->GetMethodID(_jniV8JSException.clazz, "<init>",
                                                 "(Ljava/lang/String;Ljava/lang/Object;Ljava/lang/Throwable;)V");
+    _jniV8JSException.lazyInitId = env->GetMethodID(_jniV8JSException.clazz, "<init>",
+                                                    "(Ljava/lang/Object;Ljava/lang/String;ILjava/lang/Throwable;)V");
     _jniV8JSException.setStackTraceId = env->GetMethodID(_jniV8JSException.clazz, "setStackTrace",
                                                          "([Ljava/lang/StackTraceElement;)V");
 
@@ -994,24 +2062,85 @@ void BGJSV8Engine::initJNICache() {
     _jniStackTraceElement.initId = env->GetMethodID(_jniStackTraceElement.clazz, "<init>",
                                                     "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;I)V");
     _jniV8Engine.clazz = (jclass) env->NewGlobalRef(env->FindClass("ag/boersego/bgjs/V8Engine"));
-    _jniV8Engine.enqueueOnNextTick = env->GetMethodID(_jniV8Engine.clazz, "enqueueOnNextTick",
-                                                      "(Lag/boersego/bgjs/JNIV8Function;)Z");
-    _jniV8Engine.setTimeoutId = env->GetStaticMethodID(_jniV8Engine.clazz, "setTimeout",
-                                                       "(JJJZ)I");
-    _jniV8Engine.removeTimeoutId = env->GetStaticMethodID(_jniV8Engine.clazz, "removeTimeout",
-                                                          "(I)V");
+    _jniV8Engine.scheduleTimers.resolve(env, _jniV8Engine.clazz, "scheduleTimers", "(J)V");
+    _jniV8Engine.onNearHeapLimit.resolve(env, _jniV8Engine.clazz, "onNearHeapLimit", "(J)V");
+    _jniV8Engine.onHeapDumpProgress.resolve(env, _jniV8Engine.clazz, "onHeapDumpProgress", "(Ljava/lang/String;I)V");
+    _jniV8Engine.onHeapDumpFinished.resolve(env, _jniV8Engine.clazz, "onHeapDumpFinished", "(Ljava/lang/String;Z)V");
+    _jniV8Engine.onCpuProfileWritten.resolve(env, _jniV8Engine.clazz, "onCpuProfileWritten", "(Ljava/lang/String;Z)V");
+    _jniV8Engine.onLongTask.resolve(env, _jniV8Engine.clazz, "onLongTask", "(Ljava/lang/String;J)V");
 }
 
 BGJSV8Engine::BGJSV8Engine(jobject obj, JNIClassInfo *info) : JNIObject(obj, info) {
     _nextTimerId = 1;
+    _scheduledTimerTick = UINT64_MAX;
+    _isRunningTimers = false;
+    _nextTickHead = 0;
+    _nextTickCount = 0;
+    _isNextTickScheduled = false;
     _locale = NULL;
     _nextEmbedderDataIndex = EBGJSV8EngineEmbedderData::FIRST_UNUSED;
     _javaAssetManager = nullptr;
     _isolate = NULL;
+    _arrayBufferAllocator = nullptr;
+    _maxHeapSize = 0;
+    _isStoreBuild = false;
+    _logLevel = LOG_DEBUG;
+    _isCreatingSnapshot = false;
+    _snapshotFile = nullptr;
+    _snapshotBlob.data = nullptr;
+    _snapshotBlob.raw_size = 0;
+    _isIdleGCDone = false;
+    _lastFrameTime = 0;
+    _disposalsSince = 0;
+    _isDisposalWakeQueued = false;
+    _heapSizeAfterLongIdle = 0;
+    _isTakingHeapSnapshot = false;
+    _isBundleLoaded = false;
+    _assetProbes = 0;
+    _cpuProfiler = nullptr;
+    _cpuProfileCount = 0;
+    _backgroundCpuProfileWindow = 0;
+    _backgroundCpuProfileStart = 0;
+    _backgroundCpuProfileSegment = 0;
+    _backgroundCpuProfile = nullptr;
+    _watchdog = nullptr;
+    _nextContextId = 1;
+    _classInfos.reserve(JNIV8Wrapper::getClassCount());
+}
+
+// leaving a locker never blocks, so V8Engine.unlock is a @CriticalNative
+static void unlockCritical(jlong lockerPtr) {
+    v8::Locker *locker = reinterpret_cast<Locker *>(lockerPtr);
+    delete (locker);
 }
 
-void BGJSV8Engine::initializeJNIBindings(JNIClassInfo *info, bool isReload) {
+static void unlock(JNIEnv *env, jclass clazz, jlong lockerPtr) {
+    unlockCritical(lockerPtr);
+}
+
+// the js thread marks every message it handles while the watchdog runs, so these are @CriticalNative, too
+static void beginWatchdogTaskCritical(jlong watchdogPtr) {
+    reinterpret_cast<BGJSWatchdog *>(watchdogPtr)->beginTask();
+}
+
+static void beginWatchdogTask(JNIEnv *env, jclass clazz, jlong watchdogPtr) {
+    beginWatchdogTaskCritical(watchdogPtr);
+}
+
+static void endWatchdogTaskCritical(jlong watchdogPtr) {
+    reinterpret_cast<BGJSWatchdog *>(watchdogPtr)->endTask();
+}
 
+static void endWatchdogTask(JNIEnv *env, jclass clazz, jlong watchdogPtr) {
+    endWatchdogTaskCritical(watchdogPtr);
+}
+
+void BGJSV8Engine::initializeJNIBindings(JNIClassInfo *info, bool isReload) {
+    info->registerCriticalNativeMethod("unlock", "(J)V", (void*)unlock, (void*)unlockCritical);
+    info->registerCriticalNativeMethod("beginWatchdogTask", "(J)V", (void*)beginWatchdogTask,
+                                       (void*)beginWatchdogTaskCritical);
+    info->registerCriticalNativeMethod("endWatchdogTask", "(J)V", (void*)endWatchdogTask,
+                                       (void*)endWatchdogTaskCritical);
 }
 
 void BGJSV8Engine::setAssetManager(jobject jAssetManager) {
@@ -1019,32 +2148,66 @@ void BGJSV8Engine::setAssetManager(jobject jAssetManager) {
     _javaAssetManager = env->NewGlobalRef(jAssetManager);
 }
 
-void BGJSV8Engine::createContext() {
+/**
+ * null terminated list of all native callbacks reachable from the global context
+ * v8 needs these to rebind functions and accessors when a context is deserialized from a startup snapshot
+ */
+const intptr_t *BGJSV8Engine::getExternalReferences() {
+    static const intptr_t references[] = {
+            reinterpret_cast<intptr_t>(LogCallback),
+            reinterpret_cast<intptr_t>(DebugCallback),
+            reinterpret_cast<intptr_t>(InfoCallback),
+            reinterpret_cast<intptr_t>(ErrorCallback),
+            reinterpret_cast<intptr_t>(AssertCallback),
+            reinterpret_cast<intptr_t>(TraceCallback),
+            reinterpret_cast<intptr_t>(RequireCallback),
+            reinterpret_cast<intptr_t>(PreloadCallback),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_process_nextTick),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_scheduler_postTask),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_global_getLocale),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_global_getLang),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_global_getTz),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_global_getDeviceClass),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_global_requestAnimationFrame),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_global_cancelAnimationFrame),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_global_setTimeout),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_global_setInterval),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_global_clearTimeout),
+            reinterpret_cast<intptr_t>(BGJSV8Engine::js_global_clearInterval),
+            reinterpret_cast<intptr_t>(BGJSWorker::js_worker_constructor),
+            reinterpret_cast<intptr_t>(BGJSWorker::js_worker_postMessage),
+            reinterpret_cast<intptr_t>(BGJSWorker::js_worker_terminate),
+            0
+    };
+    return references;
+}
+
+void BGJSV8Engine::initializePlatform() {
     static bool isPlatformInitialized = false;
 
     if (!isPlatformInitialized) {
         isPlatformInitialized = true;
         LOGI("Creating default platform");
-        v8::Platform *platform = v8::platform::CreateDefaultPlatform();
-        LOGD("Created default platform %p", platform);
-        v8::V8::InitializePlatform(platform);
+        // idle tasks of the garbage collector run in the idle time the engines report; trace events of v8 end up in
+        // the same system traces as the sections of the engine
+        _platform = v8::platform::CreateDefaultPlatform(0, v8::platform::IdleTaskSupport::kEnabled,
+                                                        v8::platform::InProcessStackDumping::kEnabled,
+                                                        BGJSTrace::createTracingController());
+        LOGD("Created default platform %p", _platform);
+        v8::V8::InitializePlatform(_platform);
         LOGD("Initialized platform");
         v8::V8::Initialize();
-        std::string flags = "--expose_gc --max_old_space_size=";
-        flags = flags + std::to_string(_maxHeapSize);
+        std::string flags = "--expose_gc";
+        if (_maxHeapSize > 0) {
+            flags = flags + " --max_old_space_size=" + std::to_string(_maxHeapSize);
+        }
         v8::V8::SetFlagsFromString(flags.c_str(), (int) flags.length());
         LOGD("Initialized v8: %s", v8::V8::GetVersion());
     }
+}
 
-    v8::Isolate::CreateParams create_params;
-    create_params.array_buffer_allocator =
-            v8::ArrayBuffer::Allocator::NewDefaultAllocator();
-
-    _isolate = v8::Isolate::New(create_params);
-
-    v8::Locker l(_isolate);
-    Isolate::Scope isolate_scope(_isolate);
-    HandleScope scope(_isolate);
+v8::Local<v8::ObjectTemplate> BGJSV8Engine::createGlobalTemplate() {
+    EscapableHandleScope scope(_isolate);
 
     // Create global object template
     v8::Local<v8::ObjectTemplate> globalObjTpl = v8::ObjectTemplate::New(_isolate);
@@ -1082,6 +2245,13 @@ void BGJSV8Engine::createContext() {
                                            Local<Signature>(), 0, ConstructorBehavior::kThrow));
     globalObjTpl->Set(v8::String::NewFromUtf8(_isolate, "process"), process);
 
+    // priority lanes of the js thread, as in the scheduler api of browsers
+    v8::Local<v8::ObjectTemplate> scheduler = v8::ObjectTemplate::New(_isolate);
+    scheduler->Set(String::NewFromUtf8(_isolate, "postTask"),
+                   v8::FunctionTemplate::New(_isolate, BGJSV8Engine::js_scheduler_postTask, Local<Value>(),
+                                             Local<Signature>(), 0, ConstructorBehavior::kThrow));
+    globalObjTpl->Set(v8::String::NewFromUtf8(_isolate, "scheduler"), scheduler);
+
     // environment variables
     globalObjTpl->SetAccessor(String::NewFromUtf8(_isolate, "_locale"),
                               BGJSV8Engine::js_global_getLocale, 0, Local<Value>(), AccessControl::DEFAULT,
@@ -1118,16 +2288,75 @@ void BGJSV8Engine::createContext() {
                       v8::FunctionTemplate::New(_isolate, BGJSV8Engine::js_global_clearInterval, Local<Value>(),
                                                 Local<Signature>(), 0, ConstructorBehavior::kThrow));
 
-    // Create a new context.
-    Local<Context> context = v8::Context::New(_isolate, NULL, globalObjTpl);
+    // scripts in isolates of their own on a pool of threads
+    globalObjTpl->Set(String::NewFromUtf8(_isolate, "Worker"), BGJSWorker::createTemplate(_isolate));
+
+    return scope.Escape(globalObjTpl);
+}
+
+void BGJSV8Engine::createContext() {
+    initializePlatform();
+
+    // a spare isolate has its heap set up and the snapshot deserialized already
+    std::unique_ptr<BGJSIsolatePool::Spare> spare = BGJSIsolatePool::take(_snapshotPath);
+    if (spare) {
+        _isolate = spare->isolate;
+        _arrayBufferAllocator = spare->allocator;
+        _snapshotFile = spare->snapshotFile;
+        _snapshotBlob = spare->snapshotBlob;
+        spare->isolate = nullptr;
+        spare->allocator = nullptr;
+        spare->snapshotFile = nullptr;
+    } else {
+        if (!_snapshotPath.empty()) {
+            loadSnapshot(_snapshotPath, &_snapshotFile, &_snapshotBlob);
+        }
+        _isolate = BGJSIsolatePool::newIsolate(_snapshotFile ? &_snapshotBlob : nullptr, &_arrayBufferAllocator);
+    }
+
+    v8::Locker l(_isolate);
+    Isolate::Scope isolate_scope(_isolate);
+    HandleScope scope(_isolate);
+
+    _isolate->AddNearHeapLimitCallback(NearHeapLimitCallback, this);
+
+    Local<Context> context;
+    bool isFromSnapshot = false;
+    if (spare) {
+        isFromSnapshot = !spare->context.IsEmpty();
+        if (isFromSnapshot) {
+            context = Local<Context>::New(_isolate, spare->context);
+            spare->context.Reset();
+        }
+        LOGI("Using spare isolate %p", _isolate);
+    } else if (_snapshotBlob.data) {
+        // the bootstrapped context is stored at index 0; the default context of the blob is unused
+        isFromSnapshot = v8::Context::FromSnapshot(_isolate, 0).ToLocal(&context);
+        if (!isFromSnapshot) {
+            LOGE("Failed to deserialize context from startup snapshot %s", _snapshotPath.c_str());
+        }
+    }
+    if (!isFromSnapshot) {
+        context = v8::Context::New(_isolate, NULL, createGlobalTemplate());
+    }
     context->SetAlignedPointerInEmbedderData(EBGJSV8EngineEmbedderData::kContext, this);
+    context->SetAlignedPointerInEmbedderData(EBGJSV8EngineEmbedderData::kIsolatedContext, nullptr);
 
-    // register global object for all required modules
     v8::Context::Scope ctxScope(context);
+    _context.Reset(_isolate, context);
+
+    if (isFromSnapshot && restoreSnapshotData(context)) {
+        LOGI("Context restored from startup snapshot %s", _snapshotPath.c_str());
+        return;
+    }
+
+    // register global object for all required modules
     context->Global()->Set(String::NewFromUtf8(_isolate, "global"), context->Global());
 
-    _context.Reset(_isolate, context);
+    createBindings(context);
+}
 
+void BGJSV8Engine::createBindings(v8::Local<v8::Context> context) {
     //----------------------------------------
     // create bindings
     // we create as much as possible here all at once, so methods can be const
@@ -1213,17 +2442,240 @@ void BGJSV8Engine::createContext() {
     }
 }
 
+//-----------------------------------------------------------
+// Startup snapshots
+//-----------------------------------------------------------
+
+// snapshot files start with this magic and the v8 version string they were created with
+// v8 aborts the process when deserializing a blob of a different version, so we have to check this ourselves
+#define BGJS_SNAPSHOT_MAGIC "BGJSSNAP"
+
+// order of the per-context data added to the snapshot; indices are assigned sequentially by v8
+enum EBGJSV8EngineSnapshotData {
+    kSnapshotMakeJavaErrorFn = 0,
+    kSnapshotGetStackTraceFn,
+    kSnapshotJsonParseFn,
+    kSnapshotJsonStringifyFn,
+    kSnapshotMakeRequireFn,
+    kSnapshotRequireFn,
+    kSnapshotModuleCache,
+    kSnapshotDataCount
+};
+
+void BGJSV8Engine::setSnapshotPath(const char *path) {
+    _snapshotPath = path ? path : "";
+}
+
+void BGJSV8Engine::prepareSpareIsolate() {
+    initializePlatform();
+    BGJSIsolatePool::prepare(_snapshotPath);
+}
+
+bool BGJSV8Engine::loadSnapshot(const std::string &path, char **snapshotFile, v8::StartupData *blob) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    const std::string header = std::string(BGJS_SNAPSHOT_MAGIC) + v8::V8::GetVersion();
+    // header is stored including its terminating zero
+    const long headerSize = (long) header.length() + 1;
+
+    char *buf = nullptr;
+    if (size > headerSize) {
+        buf = new char[size];
+        if (fread(buf, 1, (size_t) size, file) != (size_t) size || memcmp(buf, header.c_str(), (size_t) headerSize) != 0) {
+            LOGI("Ignoring startup snapshot %s: created by a different v8 version", path.c_str());
+            delete[] buf;
+            buf = nullptr;
+        }
+    }
+    fclose(file);
+
+    if (!buf) {
+        return false;
+    }
+
+    *snapshotFile = buf;
+    blob->data = buf + headerSize;
+    blob->raw_size = (int) (size - headerSize);
+
+    return true;
+}
+
+bool BGJSV8Engine::restoreSnapshotData(v8::Local<v8::Context> context) {
+    Local<Value> values[kSnapshotDataCount];
+    for (size_t i = 0; i < kSnapshotDataCount; i++) {
+        if (!context->GetDataFromSnapshotOnce<Value>(i).ToLocal(&values[i])) {
+            LOGE("Startup snapshot is missing binding #%zu", i);
+            return false;
+        }
+    }
+
+    _makeJavaErrorFn.Reset(_isolate, values[kSnapshotMakeJavaErrorFn].As<Function>());
+    _getStackTraceFn.Reset(_isolate, values[kSnapshotGetStackTraceFn].As<Function>());
+    _jsonParseFn.Reset(_isolate, values[kSnapshotJsonParseFn].As<Function>());
+    _jsonStringifyFn.Reset(_isolate, values[kSnapshotJsonStringifyFn].As<Function>());
+    // require bindings are created lazily => they only exist if warm modules were loaded
+    if (values[kSnapshotMakeRequireFn]->IsFunction() && values[kSnapshotRequireFn]->IsFunction()) {
+        _makeRequireFn.Reset(_isolate, values[kSnapshotMakeRequireFn].As<Function>());
+        _requireFn.Reset(_isolate, values[kSnapshotRequireFn].As<Function>());
+    }
+
+    // re-populate the module cache with the exports of all modules required while creating the snapshot
+    Local<Object> moduleCache = values[kSnapshotModuleCache].As<Object>();
+    Local<Array> fileNames = moduleCache->GetOwnPropertyNames(context).ToLocalChecked();
+    for (uint32_t i = 0, n = fileNames->Length(); i < n; i++) {
+        Local<Value> fileName = fileNames->Get(context, i).ToLocalChecked();
+        _moduleCache[JNIV8Marshalling::v8string2string(fileName)].Reset(_isolate,
+                                                                        moduleCache->Get(context, fileName).ToLocalChecked());
+    }
+
+    return true;
+}
+
+/**
+ * Bootstraps a fresh context, requires the specified modules and serializes the result to a startup snapshot
+ * Can only be called on an engine whose context has not been created yet; the engine is unusable afterwards.
+ * Modules loaded this way must only contain javascript and must not schedule timers or call into java.
+ */
+bool BGJSV8Engine::createSnapshot(const char *path, const std::vector<std::string> &warmModules) {
+    JNI_ASSERT(_isolate == nullptr, "Snapshots can only be created by an engine without context");
+
+    initializePlatform();
+
+    bool success = true;
+    v8::StartupData blob = {nullptr, 0};
+    {
+        v8::SnapshotCreator creator(getExternalReferences());
+        _isolate = creator.GetIsolate();
+        _isCreatingSnapshot = true;
+        {
+            HandleScope scope(_isolate);
+
+            creator.SetDefaultContext(v8::Context::New(_isolate));
+
+            Local<Context> context = v8::Context::New(_isolate, NULL, createGlobalTemplate());
+            context->SetAlignedPointerInEmbedderData(EBGJSV8EngineEmbedderData::kContext, this);
+            context->SetAlignedPointerInEmbedderData(EBGJSV8EngineEmbedderData::kIsolatedContext, nullptr);
+            v8::Context::Scope ctxScope(context);
+            _context.Reset(_isolate, context);
+
+            context->Global()->Set(String::NewFromUtf8(_isolate, "global"), context->Global());
+            createBindings(context);
+
+            TryCatch tryCatch(_isolate);
+            for (auto &moduleName : warmModules) {
+                if (require(moduleName).IsEmpty()) {
+                    LOGE("Failed to require '%s' for startup snapshot: %s", moduleName.c_str(),
+                         tryCatch.HasCaught() ? JNIV8Marshalling::v8string2string(tryCatch.Exception()).c_str() : "");
+                    success = false;
+                    break;
+                }
+            }
+
+            if (success) {
+                Local<Value> undefined = Undefined(_isolate);
+                Local<Object> moduleCache = Object::New(_isolate);
+                for (auto &it : _moduleCache) {
+                    moduleCache->Set(String::NewFromUtf8(_isolate, it.first.c_str()), Local<Value>::New(_isolate, it.second));
+                }
+
+                creator.AddData(context, Local<Function>::New(_isolate, _makeJavaErrorFn));
+                creator.AddData(context, Local<Function>::New(_isolate, _getStackTraceFn));
+                creator.AddData(context, Local<Function>::New(_isolate, _jsonParseFn));
+                creator.AddData(context, Local<Function>::New(_isolate, _jsonStringifyFn));
+                creator.AddData(context, _makeRequireFn.IsEmpty() ? undefined : Local<Function>::New(_isolate, _makeRequireFn).As<Value>());
+                creator.AddData(context, _requireFn.IsEmpty() ? undefined : Local<Function>::New(_isolate, _requireFn).As<Value>());
+                creator.AddData(context, moduleCache);
+            }
+
+            // the engine pointer is only valid for this process
+            context->SetAlignedPointerInEmbedderData(EBGJSV8EngineEmbedderData::kContext, nullptr);
+
+            // v8 refuses to serialize while there are still persistent handles
+            _context.Reset();
+            _requireFn.Reset();
+            _makeRequireFn.Reset();
+            _jsonParseFn.Reset();
+            _jsonStringifyFn.Reset();
+            _makeJavaErrorFn.Reset();
+            _getStackTraceFn.Reset();
+            for (auto &it : _moduleCache) {
+                it.second.Reset();
+            }
+            _moduleCache.clear();
+
+            creator.AddContext(context);
+        }
+        blob = creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+
+        _isCreatingSnapshot = false;
+        _isolate = nullptr;
+    }
+
+    if (!blob.data) {
+        LOGE("Failed to serialize startup snapshot");
+        return false;
+    }
+
+    if (success) {
+        const std::string header = std::string(BGJS_SNAPSHOT_MAGIC) + v8::V8::GetVersion();
+        const std::string tmpPath = std::string(path) + ".tmp";
+        FILE *file = fopen(tmpPath.c_str(), "wb");
+        success = file != nullptr;
+        if (file) {
+            success = fwrite(header.c_str(), 1, header.length() + 1, file) == header.length() + 1 &&
+                      fwrite(blob.data, 1, (size_t) blob.raw_size, file) == (size_t) blob.raw_size;
+            success = (fclose(file) == 0) && success;
+            success = success && rename(tmpPath.c_str(), path) == 0;
+            if (!success) {
+                unlink(tmpPath.c_str());
+            }
+        }
+        if (success) {
+            LOGI("Wrote startup snapshot with %zu modules to %s (%d bytes)", warmModules.size(), path, blob.raw_size);
+        } else {
+            LOGE("Failed to write startup snapshot to %s", path);
+        }
+    }
+    delete[] blob.data;
+
+    return success;
+}
+
 void BGJSV8Engine::log(int debugLevel, const v8::FunctionCallbackInfo<v8::Value> &args) {
-    v8::Locker locker(args.GetIsolate());
+    // filtered messages do not even convert their arguments, which may have to stringify whole objects
+    if (debugLevel < _logLevel) {
+        return;
+    }
+    BGJS_ASSERT_LOCKED(args.GetIsolate())
     HandleScope scope(args.GetIsolate());
 
-    std::stringstream str;
-    int l = args.Length();
-    for (int i = 0; i < l; i++) {
-        str << " " << toDebugString(args[i]);
+    std::string message;
+    appendDebugStrings(message, args, 0);
+    BGJSLog::write(debugLevel, LOG_TAG, message.data(), message.size());
+}
+
+void BGJSV8Engine::appendDebugStrings(std::string &message, const v8::FunctionCallbackInfo<v8::Value> &args,
+                                      int start) const {
+    for (int i = start, l = args.Length(); i < l; i++) {
+        message += ' ';
+        // strings are by far the most common arguments, and are written into the message directly
+        if (args[i]->IsString()) {
+            Local<String> string = args[i].As<String>();
+            const size_t offset = message.size();
+            message.resize(offset + string->Utf8Length(_isolate));
+            string->WriteUtf8(_isolate, &message[offset], (int)(message.size() - offset), nullptr,
+                              String::NO_NULL_TERMINATION | String::REPLACE_INVALID_UTF8);
+        } else {
+            message += toDebugString(args[i]);
+        }
     }
-
-    LOG(debugLevel, "%s", str.str().c_str());
 }
 
 void BGJSV8Engine::setLocale(const char *locale, const char *lang,
@@ -1248,6 +2700,19 @@ void BGJSV8Engine::setDebug(bool debug) {
 
 void BGJSV8Engine::setIsStoreBuild(bool isStoreBuild) {
     _isStoreBuild = isStoreBuild;
+    _logLevel = isStoreBuild ? LOG_INFO : LOG_DEBUG;
+}
+
+void BGJSV8Engine::setLogLevel(int level) {
+    _logLevel = level;
+}
+
+/**
+ * Sets the directory that compiled code of required modules is cached in
+ * @param path existing writable directory; empty or null disables the code cache
+ */
+void BGJSV8Engine::setCodeCachePath(const char *path) {
+    _codeCachePath = path ? path : "";
 }
 
 /**
@@ -1290,9 +2755,48 @@ BGJSV8Engine::~BGJSV8Engine() {
     LOGI("Cleaning up");
 
     JNIEnv *env = JNIWrapper::getEnvironment();
+
+    // no js runs anymore that the watchdog could interrupt
+    delete _watchdog;
+    _watchdog = nullptr;
+
+    // workers load their scripts with the asset manager
+    BGJSWorker::terminateAll(this);
     env->DeleteGlobalRef(_javaAssetManager);
 
     // clear persistent references
+    for (auto &it : _timersById) {
+        _timers.release(it.second);
+    }
+    _timersById.clear();
+    _nextTickQueue.clear();
+
+    for (auto &it : _isolatedContexts) {
+        BGJSV8EngineContext *isolatedContext = it.second;
+        isolatedContext->context.Reset();
+        isolatedContext->moduleCache.clear();
+        isolatedContext->requireFn.Reset();
+        isolatedContext->makeRequireFn.Reset();
+        delete isolatedContext;
+    }
+    _isolatedContexts.clear();
+    _globalTemplate.Reset();
+
+    // workers must not parse for an isolate that is gone
+    for (auto &it : _preloads) {
+        it.second->cancel();
+    }
+    _preloads.clear();
+
+    // objects finalized by java that the js thread did not get to yet
+    for (JNIObject *object : _runningDisposals) {
+        delete object;
+    }
+    for (JNIObject *object : _pendingDisposals) {
+        delete object;
+    }
+    _runningDisposals.clear();
+    _pendingDisposals.clear();
     _context.Reset();
     _requireFn.Reset();
     _makeRequireFn.Reset();
@@ -1300,11 +2804,24 @@ BGJSV8Engine::~BGJSV8Engine() {
     _jsonStringifyFn.Reset();
     _makeJavaErrorFn.Reset();
     _getStackTraceFn.Reset();
+    _wrapperCacheKey.Reset();
+    _propertyNames.clear();
+
+    // deletes the profiles that are left, too
+    if (_cpuProfiler) {
+        _cpuProfiler->Dispose();
+        _cpuProfiler = nullptr;
+    }
 
     if (_locale) {
         free(_locale);
     }
-    _isolate->Exit();
+    if (_isolate) {
+        _isolate->Exit();
+    }
+    if (_snapshotFile) {
+        delete[] _snapshotFile;
+    }
 
     for (auto &it : _javaModules) {
         env->DeleteGlobalRef(it.second);
@@ -1315,32 +2832,86 @@ BGJSV8Engine::~BGJSV8Engine() {
 
 void BGJSV8Engine::enqueueNextTick(const v8::FunctionCallbackInfo<v8::Value> &args) {
     JNI_ASSERT(args.Length() >= 1 && args[0]->IsFunction(), "enqueueNextTick must be called with a callback function");
-    HandleScope scope(args.GetIsolate());
-    const auto wrappedFunction = JNIV8Wrapper::wrapObject<JNIV8Function>(args[0]->ToObject(args.GetIsolate()));
-    JNIEnv *env = JNIWrapper::getEnvironment();
-    env->CallBooleanMethod(getJObject(), _jniV8Engine.enqueueOnNextTick, wrappedFunction.get()->getJObject());
+
+    // grow ring buffer; it never shrinks, so in steady state no allocations happen
+    if (_nextTickCount == _nextTickQueue.size()) {
+        std::vector<v8::Global<v8::Function>> queue(std::max<size_t>(16, _nextTickQueue.size() * 2));
+        for (size_t i = 0; i < _nextTickCount; i++) {
+            queue[i] = std::move(_nextTickQueue[(_nextTickHead + i) % _nextTickQueue.size()]);
+        }
+        _nextTickQueue.swap(queue);
+        _nextTickHead = 0;
+    }
+    _nextTickQueue[(_nextTickHead + _nextTickCount) % _nextTickQueue.size()].Reset(args.GetIsolate(),
+                                                                                   args[0].As<Function>());
+    _nextTickCount++;
+
+    // the whole queue is drained by a single microtask, which v8 runs once the current macrotask has finished
+    if (!_isNextTickScheduled) {
+        _isNextTickScheduled = true;
+        args.GetIsolate()->EnqueueMicrotask(BGJSV8Engine::runNextTicks, this);
+    }
+}
+
+void BGJSV8Engine::resumeNextTicks(BGJSV8Engine *engine, void *data) {
+    runNextTicks(engine);
+}
+
+void BGJSV8Engine::runNextTicks(void *data) {
+    BGJSV8Engine *engine = reinterpret_cast<BGJSV8Engine *>(data);
+    Isolate *isolate = engine->_isolate;
+    HandleScope scope(isolate);
+    // microtasks may run without an entered context
+    Local<Context> context = engine->getContext();
+
+    // ticks enqueued by callbacks are run by the same loop
+    while (engine->_nextTickCount) {
+        v8::Global<v8::Function> &slot = engine->_nextTickQueue[engine->_nextTickHead];
+        Local<Function> callback = Local<Function>::New(isolate, slot);
+        slot.Reset();
+        engine->_nextTickHead = (engine->_nextTickHead + 1) % engine->_nextTickQueue.size();
+        engine->_nextTickCount--;
+
+        TryCatch trycatch(isolate);
+        if (callback->Call(context, context->Global(), 0, nullptr).IsEmpty() && trycatch.HasCaught()) {
+            /*
+             * like the exceptions of timers, it is thrown to the java code whose call ran the microtasks; no more
+             * calls into java are allowed while it is pending, so the other ticks wait for the next task, which is
+             * posted before the exception is
+             */
+            engine->_isNextTickScheduled = false;
+            if (engine->_nextTickCount) {
+                engine->postTask(resumeNextTicks, nullptr, kTaskPriorityUserBlocking);
+            }
+            engine->forwardV8ExceptionToJNI(&trycatch);
+            return;
+        }
+    }
+    engine->_isNextTickScheduled = false;
 }
 
 void BGJSV8Engine::trace(const FunctionCallbackInfo<Value> &args) {
-    v8::Locker locker(args.GetIsolate());
+    if (LOG_INFO < _logLevel) {
+        return;
+    }
+    BGJS_ASSERT_LOCKED(args.GetIsolate())
     HandleScope scope(args.GetIsolate());
 
+    std::string message;
+    appendDebugStrings(message, args, 0);
     std::stringstream str;
-    int l = args.Length();
-    for (int i = 0; i < l; i++) {
-        str << " " << toDebugString(args[i]);
-    }
-    str << "\n";
+    str << message << "\n";
 
     Local<StackTrace> stackTrace = StackTrace::CurrentStackTrace(args.GetIsolate(), 15);
-    l = stackTrace->GetFrameCount();
+    int l = stackTrace->GetFrameCount();
     for (int i = 0; i < l; i++) {
         const Local<StackFrame> &frame = stackTrace->GetFrame(args.GetIsolate(), i);
         str << "    " << JNIV8Marshalling::v8string2string(frame->GetScriptName()) << " ("
             << JNIV8Marshalling::v8string2string(frame->GetFunctionName()) << ":" << frame->GetLineNumber() << ")\n";
     }
 
-    LOG(LOG_INFO, "%s", str.str().c_str());
+    const std::string trace = str.str();
+    BGJSLog::write(LOG_INFO, LOG_TAG, trace.data(), trace.size());
 }
 
 /**
@@ -1357,20 +2928,19 @@ void BGJSV8Engine::doAssert(const FunctionCallbackInfo<Value> &args) {
         return;
     }
 
-    v8::Locker locker(isolate);
+    BGJS_ASSERT_LOCKED(isolate)
     HandleScope scope(isolate);
 
     Local<Boolean> assertion = args[0]->ToBoolean(isolate);
 
     if (!assertion->Value()) {
+        // logged with the console messages, so it shows up after the ones before it
+        std::stringstream str;
+        str << "Assertion failed";
         if (args.Length() > 1) {
-            const std::string assertionMessage = toDebugString(args[1]);
-            LOG(LOG_ERROR, "Assertion failed: %s", assertionMessage.c_str());
-        } else {
-            LOG(LOG_ERROR, "Assertion failed");
+            str << ": " << toDebugString(args[1]);
         }
-
-        std::stringstream str;
+        str << "\n";
 
         Local<StackTrace> stackTrace = StackTrace::CurrentStackTrace(args.GetIsolate(), 15);
         int l = stackTrace->GetFrameCount();
@@ -1381,92 +2951,317 @@ void BGJSV8Engine::doAssert(const FunctionCallbackInfo<Value> &args) {
                 << ")\n";
         }
 
-        LOG(LOG_ERROR, "%s", str.str().c_str());
+        const std::string assertion = str.str();
+        BGJSLog::write(LOG_ERROR, LOG_TAG, assertion.data(), assertion.size());
 
     }
 }
 
-/////////////// Heap dump functions
-// These are based on https://github.com/bnoordhuis/node-heapdump
+//-----------------------------------------------------------
+// Heap dumps
+//-----------------------------------------------------------
 
-class FileOutputStream : public OutputStream {
+// forwards the progress of taking a heap snapshot to java in steps of a percent
+class HeapSnapshotProgress : public ActivityControl {
 public:
-    FileOutputStream(FILE *stream) : stream_(stream) {}
-
-    virtual int GetChunkSize() {
-        return 65536;  // big chunks == faster
+    HeapSnapshotProgress(BGJSV8Engine *engine, const std::string &path) : _engine(engine), _path(path),
+                                                                          _percent(-1) {}
+
+    ControlOption ReportProgressValue(int done, int total) override {
+        const int percent = total > 0 ? (int) ((int64_t) done * 100 / total) : 0;
+        if (percent != _percent) {
+            _percent = percent;
+            _engine->reportHeapDumpProgress(_path, percent);
+        }
+        return kContinue;
     }
 
-    virtual void EndOfStream() {}
+private:
+    BGJSV8Engine *_engine;
+    const std::string &_path;
+    int _percent;
+};
 
-    virtual WriteResult WriteAsciiChunk(char *data, int size) {
-        const size_t len = static_cast<size_t>(size);
-        size_t off = 0;
+std::string BGJSV8Engine::enqueueMemoryDump(const char *basePath) {
+    if (_isTakingHeapSnapshot.exchange(true)) {
+        return std::string();
+    }
 
-        while (off < len && !feof(stream_) && !ferror(stream_))
-            off += fwrite(data + off, 1, len - off, stream_);
+    char filename[512];
+    snprintf(filename, sizeof(filename), "%s/heapdump-%lu.heapsnapshot", basePath, (unsigned long) time(nullptr));
+    LOGI("Enqueueing heap dump to %s", filename);
 
-        return off == len ? kContinue : kAbort;
-    }
+    // taking the snapshot collects all garbage first, and has to happen on the js thread like any other use of the heap
+    runOnJSThread(takeHeapSnapshot, new std::string(filename));
+    return filename;
+}
 
-private:
-    FILE *stream_;
-};
+void BGJSV8Engine::takeHeapSnapshot(BGJSV8Engine *engine, void *data) {
+    std::unique_ptr<std::string> path((std::string *) data);
+    Isolate *isolate = engine->_isolate;
 
-inline bool WriteSnapshotHelper(Isolate *isolate, const char *filename) {
-    FILE *fp = fopen(filename, "w");
-    if (fp == NULL) return false;
+    BGJSHeapDumpWriter *writer = BGJSHeapDumpWriter::open(engine, *path, heapDumpWritten);
+    if (!writer) {
+        engine->_isTakingHeapSnapshot = false;
+        engine->reportHeapDumpProgress(*path, -1);
+        return;
+    }
 
-    const HeapSnapshot *const snap = isolate->GetHeapProfiler()->TakeHeapSnapshot();
-    FileOutputStream stream(fp);
-    snap->Serialize(&stream, HeapSnapshot::kJSON);
-    fclose(fp);
+    HeapSnapshotProgress progress(engine, *path);
+    const HeapSnapshot *const snap = isolate->GetHeapProfiler()->TakeHeapSnapshot(&progress);
+    // js waits for serializing, but not for the disk unless it falls behind by more than the writer buffers
+    snap->Serialize(writer, HeapSnapshot::kJSON);
     // Work around a deficiency in the API.  The HeapSnapshot object is const
     // but we cannot call HeapProfiler::DeleteAllHeapSnapshots() because that
     // invalidates _all_ snapshots, including those created by other tools.
     const_cast<HeapSnapshot *>(snap)->Delete();
+    engine->_isTakingHeapSnapshot = false;
+}
+
+bool BGJSV8Engine::startSamplingHeapProfiler(int sampleInterval, int stackDepth) {
+    return _isolate->GetHeapProfiler()->StartSamplingHeapProfiler((uint64_t) sampleInterval, stackDepth);
+}
+
+std::string BGJSV8Engine::stopSamplingHeapProfiler(const char *basePath) {
+    std::unique_ptr<AllocationProfile> profile(_isolate->GetHeapProfiler()->GetAllocationProfile());
+    if (!profile) {
+        return std::string();
+    }
+    _isolate->GetHeapProfiler()->StopSamplingHeapProfiler();
+
+    char filename[512];
+    snprintf(filename, sizeof(filename), "%s/heapprofile-%lu.heapprofile", basePath, (unsigned long) time(nullptr));
+    BGJSHeapDumpWriter *writer = BGJSHeapDumpWriter::open(this, filename, heapDumpWritten);
+    if (!writer) {
+        return std::string();
+    }
+    writer->writeAllocationProfile(_isolate, profile.get());
+    LOGI("Writing allocation profile to %s", filename);
+    return filename;
+}
+
+void BGJSV8Engine::reportHeapDumpProgress(const std::string &path, int percent) {
+    JNIEnv *env = JNIWrapper::getEnvironment();
+    jobject javaObject = getJObject();
+    jstring jPath = env->NewStringUTF(path.c_str());
+    if (percent < 0) {
+        _jniV8Engine.onHeapDumpFinished.call(env, javaObject, jPath, (jboolean) false);
+    } else {
+        _jniV8Engine.onHeapDumpProgress.call(env, javaObject, jPath, (jint) percent);
+    }
+    env->DeleteLocalRef(jPath);
+    env->DeleteLocalRef(javaObject);
+}
+
+void BGJSV8Engine::heapDumpWritten(BGJSV8Engine *engine, BGJSHeapDumpWriter *writer) {
+    LOGI("heap dump to %s %s", writer->path().c_str(), writer->succeeded() ? "done" : "failed");
+
+    JNIEnv *env = JNIWrapper::getEnvironment();
+    jobject javaObject = engine->getJObject();
+    jstring jPath = env->NewStringUTF(writer->path().c_str());
+    _jniV8Engine.onHeapDumpFinished.call(env, javaObject, jPath, (jboolean) writer->succeeded());
+    env->DeleteLocalRef(jPath);
+    env->DeleteLocalRef(javaObject);
+    delete writer;
+}
+
+//-----------------------------------------------------------
+// Cpu profiles
+//-----------------------------------------------------------
+
+// profiles can only be told apart by title; the background profile alternates between two
+static Local<String> backgroundCpuProfileTitle(Isolate *isolate, unsigned int segment) {
+    return String::NewFromUtf8(isolate, segment % 2 ? "bgjs-background-1" : "bgjs-background-0");
+}
+
+void BGJSV8Engine::startCpuProfiling(Local<String> title, int samplingInterval) {
+    if (!_cpuProfiler) {
+        _cpuProfiler = CpuProfiler::New(_isolate);
+    }
+    // the interval can only change while no profile is recorded
+    if (_cpuProfileCount == 0) {
+        _cpuProfiler->SetSamplingInterval(samplingInterval);
+    }
+    _cpuProfiler->StartProfiling(title, true);
+    _cpuProfileCount++;
+}
+
+bool BGJSV8Engine::startCpuProfile(const std::string &title, int samplingInterval) {
+    if (!_cpuProfileTitle.empty() || title.empty()) {
+        return false;
+    }
+    HandleScope scope(_isolate);
+    _cpuProfileTitle = title;
+    startCpuProfiling(String::NewFromUtf8(_isolate, title.c_str()), samplingInterval);
+    LOGI("Started cpu profile '%s'", title.c_str());
     return true;
 }
 
-void BGJSV8Engine::OnGCCompletedForDump(Isolate *isolate, GCType type,
-                                        GCCallbackFlags flags) {
+std::string BGJSV8Engine::stopCpuProfile(const char *basePath) {
+    if (_cpuProfileTitle.empty()) {
+        return std::string();
+    }
+    HandleScope scope(_isolate);
+    CpuProfile *profile = _cpuProfiler->StopProfiling(String::NewFromUtf8(_isolate, _cpuProfileTitle.c_str()));
+    _cpuProfileCount--;
+    _cpuProfileTitle.clear();
+    if (!profile) {
+        return std::string();
+    }
+    const std::string path = writeCpuProfile(basePath, "cpuprofile", std::vector<const CpuProfile *>(1, profile));
+    profile->Delete();
+    return path;
+}
 
+void BGJSV8Engine::startBackgroundCpuProfile(int samplingInterval, int windowMs) {
+    if (_backgroundCpuProfileWindow || windowMs <= 0) {
+        return;
+    }
+    HandleScope scope(_isolate);
+    _backgroundCpuProfileWindow = windowMs;
+    _backgroundCpuProfileStart = getMonotonicTime();
+    startCpuProfiling(backgroundCpuProfileTitle(_isolate, _backgroundCpuProfileSegment), samplingInterval);
+}
 
-    if (_nextProfileDumpPath == NULL) {
+void BGJSV8Engine::stopBackgroundCpuProfile() {
+    if (!_backgroundCpuProfileWindow) {
         return;
     }
-    const char *dumpPath = _nextProfileDumpPath;
-    _nextProfileDumpPath = NULL;
-    LOGI("GC completed, now dumping to %s", dumpPath);
+    HandleScope scope(_isolate);
+    CpuProfile *profile = _cpuProfiler->StopProfiling(backgroundCpuProfileTitle(_isolate, _backgroundCpuProfileSegment));
+    _cpuProfileCount--;
+    if (profile) {
+        profile->Delete();
+    }
+    if (_backgroundCpuProfile) {
+        _backgroundCpuProfile->Delete();
+        _backgroundCpuProfile = nullptr;
+    }
+    _backgroundCpuProfileWindow = 0;
+}
 
-    WriteSnapshotHelper(isolate, dumpPath);
-    free((void *) dumpPath);
-    isolate->RemoveGCEpilogueCallback((const v8::Isolate::GCCallback) &(BGJSV8Engine::OnGCCompletedForDump));
+BGJSWatchdog *BGJSV8Engine::startWatchdog(uint32_t thresholdMs, uint32_t terminateAfterMs) {
+    if (!_watchdog) {
+        _watchdog = new BGJSWatchdog(_isolate, &BGJSV8Engine::onLongTask, this);
+    }
+    _watchdog->start(thresholdMs, terminateAfterMs);
+    return _watchdog;
+}
 
-    LOGI("heap dump to %s done", dumpPath);
+void BGJSV8Engine::stopWatchdog() {
+    if (_watchdog) {
+        _watchdog->stop();
+    }
 }
 
-const char *BGJSV8Engine::enqueueMemoryDump(const char *basePath) {
-    v8::Isolate *isolate = getIsolate();
-    v8::Locker l(isolate);
+void BGJSV8Engine::onLongTask(Isolate *isolate, const std::string &stack, uint64_t blockedMs, void *data) {
+    BGJSV8Engine *engine = reinterpret_cast<BGJSV8Engine *>(data);
+    LOGI("js task has run for %u ms at\n%s", (unsigned int) blockedMs, stack.c_str());
 
-    if (_nextProfileDumpPath != NULL) {
-        return NULL;
+    JNIEnv *env = JNIWrapper::getEnvironment();
+    jobject javaObject = engine->getJObject();
+    jstring jStack = env->NewStringUTF(stack.c_str());
+    _jniV8Engine.onLongTask.call(env, javaObject, jStack, (jlong) blockedMs);
+    env->DeleteLocalRef(jStack);
+    env->DeleteLocalRef(javaObject);
+    if (env->ExceptionCheck()) {
+        LOGE("Exception in long task listener");
+        env->ExceptionDescribe();
+        env->ExceptionClear();
     }
+}
 
-    char *filename = static_cast<char *>(malloc(512));
-    std::time_t result = std::time(nullptr);
-    snprintf(filename, 512, "%s/heapdump-%lu.heapsnapshot", basePath, result);
-    LOGI("Enqueueing heap dump to %s", filename);
+CpuProfile *BGJSV8Engine::nextBackgroundCpuProfileSegment() {
+    HandleScope scope(_isolate);
+    // the next segment starts before the current one stops, so the profiler keeps sampling
+    _cpuProfiler->StartProfiling(backgroundCpuProfileTitle(_isolate, _backgroundCpuProfileSegment + 1), true);
+    CpuProfile *profile = _cpuProfiler->StopProfiling(backgroundCpuProfileTitle(_isolate, _backgroundCpuProfileSegment));
+    _backgroundCpuProfileSegment++;
+    _backgroundCpuProfileStart = getMonotonicTime();
+    return profile;
+}
+
+void BGJSV8Engine::rotateBackgroundCpuProfile() {
+    if (!_backgroundCpuProfileWindow ||
+        getMonotonicTime() - _backgroundCpuProfileStart < (uint64_t) _backgroundCpuProfileWindow) {
+        return;
+    }
+    CpuProfile *profile = nextBackgroundCpuProfileSegment();
+    if (_backgroundCpuProfile) {
+        _backgroundCpuProfile->Delete();
+    }
+    _backgroundCpuProfile = profile;
+}
 
-    _nextProfileDumpPath = filename;
+std::string BGJSV8Engine::dumpBackgroundCpuProfile(const char *basePath) {
+    if (!_backgroundCpuProfileWindow) {
+        return std::string();
+    }
+    CpuProfile *profile = nextBackgroundCpuProfileSegment();
+    std::vector<const CpuProfile *> profiles;
+    if (_backgroundCpuProfile) {
+        profiles.push_back(_backgroundCpuProfile);
+    }
+    if (profile) {
+        profiles.push_back(profile);
+    }
+    const std::string path = writeCpuProfile(basePath, "background", profiles);
+
+    // the segment that was current is kept, so the next dump overlaps with this one
+    if (_backgroundCpuProfile) {
+        _backgroundCpuProfile->Delete();
+    }
+    _backgroundCpuProfile = profile;
+    return path;
+}
 
-    isolate->AddGCEpilogueCallback((v8::Isolate::GCCallback) &OnGCCompletedForDump);
-    isolate->RequestGarbageCollectionForTesting(Isolate::GarbageCollectionType::kFullGarbageCollection);
+std::string BGJSV8Engine::writeCpuProfile(const char *basePath, const char *prefix,
+                                          const std::vector<const CpuProfile *> &profiles) {
+    if (profiles.empty()) {
+        return std::string();
+    }
+    // several dumps can happen in a second
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    char filename[512];
+    snprintf(filename, sizeof(filename), "%s/%s-%lu%03ld.cpuprofile", basePath, prefix, (unsigned long) now.tv_sec,
+             now.tv_nsec / 1000000);
 
+    BGJSHeapDumpWriter *writer = BGJSHeapDumpWriter::open(this, filename, cpuProfileWritten);
+    if (!writer) {
+        return std::string();
+    }
+    writer->writeCpuProfile(profiles);
+    LOGI("Writing cpu profile to %s", filename);
     return filename;
 }
 
+void BGJSV8Engine::cpuProfileWritten(BGJSV8Engine *engine, BGJSHeapDumpWriter *writer) {
+    JNIEnv *env = JNIWrapper::getEnvironment();
+    jobject javaObject = engine->getJObject();
+    jstring jPath = env->NewStringUTF(writer->path().c_str());
+    _jniV8Engine.onCpuProfileWritten.call(env, javaObject, jPath, (jboolean) writer->succeeded());
+    env->DeleteLocalRef(jPath);
+    env->DeleteLocalRef(javaObject);
+    delete writer;
+}
+
+// runs a Runnable passed to V8Engine.postTask; data is a global reference to it
+static void runJavaTask(BGJSV8Engine *engine, void *data) {
+    JNIEnv *env = JNIWrapper::getEnvironment();
+    jobject runnable = (jobject) data;
+    static jmethodID runId = env->GetMethodID(env->FindClass("java/lang/Runnable"), "run", "()V");
+
+    env->CallVoidMethod(runnable, runId);
+    env->DeleteGlobalRef(runnable);
+    if (env->ExceptionCheck()) {
+        // the tasks after this one still run, so the exception must not stay pending
+        LOGE("Uncaught exception in task posted with V8Engine.postTask");
+        env->ExceptionDescribe();
+        env->ExceptionClear();
+    }
+}
+
 extern "C" {
 
 JNIEXPORT jstring JNICALL
@@ -1475,47 +3270,405 @@ Java_ag_boersego_bgjs_V8Engine_dumpHeap(JNIEnv *env, jobject obj, jstring pathTo
 
     auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
 
-    const char *outPath = engine->enqueueMemoryDump(path);
+    const std::string outPath = engine->enqueueMemoryDump(path);
 
     env->ReleaseStringUTFChars(pathToSaveIn, path);
 
-    if (outPath != NULL) {
-        return env->NewStringUTF(outPath);
+    if (!outPath.empty()) {
+        return env->NewStringUTF(outPath.c_str());
     } else {
         return NULL;
     }
 }
 
-JNIEXPORT jobject JNICALL
-Java_ag_boersego_bgjs_V8Engine_parseJSON(JNIEnv *env, jobject obj, jstring json) {
+JNIEXPORT jboolean JNICALL
+Java_ag_boersego_bgjs_V8Engine_startSamplingHeapProfiler(JNIEnv *env, jobject obj, jint sampleInterval,
+                                                         jint stackDepth) {
     auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
 
     v8::Isolate *isolate = engine->getIsolate();
     v8::Locker l(isolate);
     v8::Isolate::Scope isolateScope(isolate);
-    v8::HandleScope scope(isolate);
-    v8::Local<v8::Context> context = engine->getContext();
-    v8::Context::Scope ctxScope(context);
 
-    v8::TryCatch try_catch(isolate);
-    v8::MaybeLocal<v8::Value> value = engine->parseJSON(JNIV8Marshalling::jstring2v8string(json));
-    if (value.IsEmpty()) {
-        engine->forwardV8ExceptionToJNI(&try_catch);
-        return nullptr;
-    }
-    return JNIV8Marshalling::v8value2jobject(value.ToLocalChecked());
+    return (jboolean) engine->startSamplingHeapProfiler(sampleInterval, stackDepth);
 }
 
-JNIEXPORT jobject JNICALL
-Java_ag_boersego_bgjs_V8Engine_require(JNIEnv *env, jobject obj, jstring file) {
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_V8Engine_stopSamplingHeapProfiler(JNIEnv *env, jobject obj, jstring pathToSaveIn) {
     auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
 
     v8::Isolate *isolate = engine->getIsolate();
     v8::Locker l(isolate);
     v8::Isolate::Scope isolateScope(isolate);
-    v8::HandleScope scope(isolate);
-    v8::Local<v8::Context> context = engine->getContext();
-    v8::Context::Scope ctxScope(context);
+
+    const std::string outPath = engine->stopSamplingHeapProfiler(JNIWrapper::jstring2string(pathToSaveIn).c_str());
+    return outPath.empty() ? nullptr : env->NewStringUTF(outPath.c_str());
+}
+
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_V8Engine_getModuleStats(JNIEnv *env, jobject obj) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+
+    return env->NewStringUTF(engine->getModuleStatsJSON().c_str());
+}
+
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_V8Engine_getArrayBufferStats(JNIEnv *env, jobject obj) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+    return env->NewStringUTF(engine->getArrayBufferStatsJSON().c_str());
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_setArrayBufferPoolLimit(JNIEnv *env, jclass clazz, jlong bytes) {
+    BGJSArrayBufferAllocator::setPoolLimit(bytes > 0 ? (size_t) bytes : 0);
+}
+
+JNIEXPORT jlong JNICALL
+Java_ag_boersego_bgjs_V8Engine_startWatchdogNative(JNIEnv *env, jobject obj, jint thresholdMs, jint terminateAfterMs) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+    return (jlong) engine->startWatchdog((uint32_t) std::max(thresholdMs, 1), (uint32_t) std::max(terminateAfterMs, 0));
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_stopWatchdogNative(JNIEnv *env, jobject obj) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+    engine->stopWatchdog();
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_setLogLevel(JNIEnv *env, jobject obj, jint priority) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+    engine->setLogLevel(priority);
+}
+
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_V8Engine_getObjectStats(JNIEnv *env, jclass clazz) {
+    return env->NewStringUTF(JNIV8ObjectStats::getJSON().c_str());
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_setAllocationSampleInterval(JNIEnv *env, jclass clazz, jint interval) {
+    JNIV8ObjectStats::setSampleInterval((uint32_t) std::max(interval, 0));
+}
+
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_V8Engine_getLogBreadcrumbs(JNIEnv *env, jclass clazz) {
+    // logged js strings may contain characters outside of the bmp and nul characters, which modified utf-8 can not
+    const std::string breadcrumbs = BGJSLog::breadcrumbs();
+    return JNIWrapper::utf82jstring(env, breadcrumbs.data(), breadcrumbs.length());
+}
+
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_V8Engine_dumpModuleStats(JNIEnv *env, jobject obj, jstring pathToSaveIn) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+
+    const std::string outPath = engine->writeModuleStats(JNIWrapper::jstring2string(pathToSaveIn).c_str());
+    return outPath.empty() ? nullptr : env->NewStringUTF(outPath.c_str());
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_setTracingEnabled(JNIEnv *env, jobject obj, jboolean enabled) {
+    BGJSTrace::setEnabled(enabled);
+}
+
+JNIEXPORT jboolean JNICALL
+Java_ag_boersego_bgjs_V8Engine_startCpuProfile(JNIEnv *env, jobject obj, jstring title, jint samplingInterval) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+
+    return (jboolean) engine->startCpuProfile(JNIWrapper::jstring2string(title), samplingInterval);
+}
+
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_V8Engine_stopCpuProfile(JNIEnv *env, jobject obj, jstring pathToSaveIn) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+
+    const std::string outPath = engine->stopCpuProfile(JNIWrapper::jstring2string(pathToSaveIn).c_str());
+    return outPath.empty() ? nullptr : env->NewStringUTF(outPath.c_str());
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_startBackgroundCpuProfile(JNIEnv *env, jobject obj, jint samplingInterval,
+                                                         jint windowMs) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+
+    engine->startBackgroundCpuProfile(samplingInterval, windowMs);
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_stopBackgroundCpuProfile(JNIEnv *env, jobject obj) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+
+    engine->stopBackgroundCpuProfile();
+}
+
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_V8Engine_dumpBackgroundCpuProfile(JNIEnv *env, jobject obj, jstring pathToSaveIn) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+
+    const std::string outPath = engine->dumpBackgroundCpuProfile(JNIWrapper::jstring2string(pathToSaveIn).c_str());
+    return outPath.empty() ? nullptr : env->NewStringUTF(outPath.c_str());
+}
+
+JNIEXPORT jobject JNICALL
+Java_ag_boersego_bgjs_V8Engine_parseJSON(JNIEnv *env, jobject obj, jstring json) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = engine->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    v8::TryCatch try_catch(isolate);
+    v8::MaybeLocal<v8::Value> value = engine->parseJSON(JNIV8Marshalling::jstring2v8string(env, json));
+    if (value.IsEmpty()) {
+        engine->forwardV8ExceptionToJNI(&try_catch);
+        return nullptr;
+    }
+    return JNIV8Marshalling::v8value2jobject(env, value.ToLocalChecked());
+}
+
+JNIEXPORT jobject JNICALL
+Java_ag_boersego_bgjs_V8Engine_parseJSONBuffer(JNIEnv *env, jobject obj, jobject buffer, jint length, jboolean isOneByte) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    const char *source = (const char *) env->GetDirectBufferAddress(buffer);
+    if (!source && length) {
+        env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "buffer must be direct");
+        return nullptr;
+    }
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = engine->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    v8::TryCatch try_catch(isolate);
+    v8::MaybeLocal<v8::Value> value = engine->parseJSON(source, (size_t) length, isOneByte);
+    if (value.IsEmpty()) {
+        engine->forwardV8ExceptionToJNI(&try_catch);
+        return nullptr;
+    }
+    return JNIV8Marshalling::v8value2jobject(env, value.ToLocalChecked());
+}
+
+JNIEXPORT jobject JNICALL
+Java_ag_boersego_bgjs_V8Engine_stringifyToUtf8(JNIEnv *env, jobject obj, jobject value) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    // called from js, e.g. by ajax, the value is stringified in the context that called
+    v8::Local<v8::Context> context = isolate->InContext() ? isolate->GetCurrentContext() : engine->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    v8::TryCatch try_catch(isolate);
+    v8::Local<v8::String> json;
+    if (!v8::JSON::Stringify(context, JNIV8Marshalling::jobject2v8value(env, value)).ToLocal(&json)) {
+        engine->forwardV8ExceptionToJNI(&try_catch);
+        return nullptr;
+    }
+    // undefined, functions and symbols have no JSON, which Stringify returns as the string "undefined"
+    if (json->StrictEquals(v8::String::NewFromUtf8(isolate, "undefined"))) {
+        return nullptr;
+    }
+
+    // the buffer belongs to java, so it is collected like any other and needs no native memory of its own
+    const int length = json->Utf8Length(isolate);
+    jclass byteBufferClass = env->FindClass("java/nio/ByteBuffer");
+    jobject buffer = env->CallStaticObjectMethod(byteBufferClass,
+                                                 env->GetStaticMethodID(byteBufferClass, "allocateDirect",
+                                                                        "(I)Ljava/nio/ByteBuffer;"),
+                                                 (jint) length);
+    env->DeleteLocalRef(byteBufferClass);
+    if (env->ExceptionCheck()) {
+        return nullptr;
+    }
+    json->WriteUtf8(isolate, (char *) env->GetDirectBufferAddress(buffer), length, nullptr,
+                    v8::String::NO_NULL_TERMINATION | v8::String::REPLACE_INVALID_UTF8);
+    return buffer;
+}
+
+JNIEXPORT jbyteArray JNICALL
+Java_ag_boersego_bgjs_V8Engine_serializeToArray(JNIEnv *env, jobject obj, jobject value) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = engine->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    v8::TryCatch try_catch(isolate);
+    // the same structured clone workers exchange, without a transfer list
+    std::unique_ptr<BGJSWorkerMessage> message(BGJSWorkerMessage::write(isolate, context,
+                                                                        JNIV8Marshalling::jobject2v8value(env, value),
+                                                                        v8::Local<v8::Value>()));
+    if (!message) {
+        engine->forwardV8ExceptionToJNI(&try_catch);
+        return nullptr;
+    }
+
+    jbyteArray result = env->NewByteArray((jsize) message->length());
+    if (result) {
+        env->SetByteArrayRegion(result, 0, (jsize) message->length(), (const jbyte *) message->data());
+    }
+    return result;
+}
+
+JNIEXPORT jobject JNICALL
+Java_ag_boersego_bgjs_V8Engine_deserializeBuffer(JNIEnv *env, jobject obj, jobject buffer, jbyteArray array,
+                                                 jint offset, jint length) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    // not a critical section: deserializing allocates on the heap and may call into java for JNIV8Objects
+    jbyte *elements = nullptr;
+    const uint8_t *data;
+    if (buffer) {
+        data = (const uint8_t *) env->GetDirectBufferAddress(buffer);
+        if (!data) {
+            env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "buffer must be direct");
+            return nullptr;
+        }
+    } else {
+        elements = env->GetByteArrayElements(array, nullptr);
+        data = (const uint8_t *) elements;
+    }
+
+    jobject result = nullptr;
+    {
+        v8::Isolate *isolate = engine->getIsolate();
+        v8::Locker l(isolate);
+        v8::Isolate::Scope isolateScope(isolate);
+        v8::HandleScope scope(isolate);
+        v8::Local<v8::Context> context = engine->getContext();
+        v8::Context::Scope ctxScope(context);
+
+        v8::TryCatch try_catch(isolate);
+        v8::ValueDeserializer deserializer(isolate, data + offset, (size_t) length);
+        v8::Local<v8::Value> value;
+        if (deserializer.ReadHeader(context).FromMaybe(false) && deserializer.ReadValue(context).ToLocal(&value)) {
+            result = JNIV8Marshalling::v8value2jobject(env, value);
+        } else {
+            engine->forwardV8ExceptionToJNI(&try_catch);
+        }
+    }
+
+    if (elements) {
+        env->ReleaseByteArrayElements(array, elements, JNI_ABORT);
+    }
+    return result;
+}
+
+JNIEXPORT jobject JNICALL
+Java_ag_boersego_bgjs_V8Engine_parseMessagePackBuffer(JNIEnv *env, jobject obj, jobject buffer, jbyteArray array,
+                                                      jint offset, jint length) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    jbyte *elements = nullptr;
+    const uint8_t *data;
+    if (buffer) {
+        data = (const uint8_t *) env->GetDirectBufferAddress(buffer);
+        if (!data) {
+            env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "buffer must be direct");
+            return nullptr;
+        }
+    } else {
+        elements = env->GetByteArrayElements(array, nullptr);
+        data = (const uint8_t *) elements;
+    }
+
+    jobject result = nullptr;
+    {
+        v8::Isolate *isolate = engine->getIsolate();
+        v8::Locker l(isolate);
+        v8::Isolate::Scope isolateScope(isolate);
+        v8::HandleScope scope(isolate);
+        v8::Local<v8::Context> context = engine->getContext();
+        v8::Context::Scope ctxScope(context);
+
+        v8::TryCatch try_catch(isolate);
+        v8::Local<v8::Value> value;
+        if (BGJSMessagePackModule::decode(isolate, context, data + offset, (size_t) length).ToLocal(&value)) {
+            result = JNIV8Marshalling::v8value2jobject(env, value);
+        } else {
+            engine->forwardV8ExceptionToJNI(&try_catch);
+        }
+    }
+
+    if (elements) {
+        env->ReleaseByteArrayElements(array, elements, JNI_ABORT);
+    }
+    return result;
+}
+
+JNIEXPORT jint JNICALL
+Java_ag_boersego_bgjs_V8Engine_createPropertyKey(JNIEnv *env, jobject obj, jstring name) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+
+    jsize length = env->GetStringLength(name);
+    std::vector<jchar> chars((size_t) length);
+    env->GetStringRegion(name, 0, length, chars.data());
+    return engine->createPropertyKey(chars.data(), length);
+}
+
+// the context of an id passed to V8Engine; throws if it is unknown or disposed
+static v8::Local<v8::Context> getContextOrThrow(JNIEnv *env, BGJSV8Engine *engine, jint contextId) {
+    v8::Local<v8::Context> context = engine->getContext(contextId);
+    if (context.IsEmpty()) {
+        env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "context does not exist");
+    }
+    return context;
+}
+
+static jobject requireInContext(JNIEnv *env, jobject obj, jint contextId, jstring file) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = getContextOrThrow(env, engine.get(), contextId);
+    if (context.IsEmpty()) {
+        return nullptr;
+    }
+    v8::Context::Scope ctxScope(context);
 
     v8::TryCatch try_catch(isolate);
 
@@ -1525,7 +3678,17 @@ Java_ag_boersego_bgjs_V8Engine_require(JNIEnv *env, jobject obj, jstring file) {
         engine->forwardV8ExceptionToJNI(&try_catch);
         return nullptr;
     }
-    return JNIV8Marshalling::v8value2jobject(value.ToLocalChecked());
+    return JNIV8Marshalling::v8value2jobject(env, value.ToLocalChecked());
+}
+
+JNIEXPORT jobject JNICALL
+Java_ag_boersego_bgjs_V8Engine_require(JNIEnv *env, jobject obj, jstring file) {
+    return requireInContext(env, obj, 0, file);
+}
+
+JNIEXPORT jobject JNICALL
+Java_ag_boersego_bgjs_V8Engine_requireInContext(JNIEnv *env, jobject obj, jint contextId, jstring file) {
+    return requireInContext(env, obj, contextId, file);
 }
 
 JNIEXPORT jlong JNICALL
@@ -1538,35 +3701,65 @@ Java_ag_boersego_bgjs_V8Engine_lock(JNIEnv *env, jobject obj) {
     return (jlong) locker;
 }
 
-JNIEXPORT jobject JNICALL
-Java_ag_boersego_bgjs_V8Engine_getGlobalObject(JNIEnv *env, jobject obj) {
+static jobject getGlobalObjectOfContext(JNIEnv *env, jobject obj, jint contextId) {
     auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
 
     v8::Isolate *isolate = engine->getIsolate();
     v8::Locker l(isolate);
     v8::Isolate::Scope isolateScope(isolate);
     v8::HandleScope scope(isolate);
-    v8::Local<v8::Context> context = engine->getContext();
+    v8::Local<v8::Context> context = getContextOrThrow(env, engine.get(), contextId);
+    if (context.IsEmpty()) {
+        return nullptr;
+    }
     v8::Context::Scope ctxScope(context);
 
-    return JNIV8Marshalling::v8value2jobject(context->Global());
+    return JNIV8Marshalling::v8value2jobject(env, context->Global());
 }
 
-JNIEXPORT void JNICALL
-Java_ag_boersego_bgjs_V8Engine_unlock(JNIEnv *env, jobject obj, jlong lockerPtr) {
-    v8::Locker *locker = reinterpret_cast<Locker *>(lockerPtr);
-    delete (locker);
+JNIEXPORT jobject JNICALL
+Java_ag_boersego_bgjs_V8Engine_getGlobalObject(JNIEnv *env, jobject obj) {
+    return getGlobalObjectOfContext(env, obj, 0);
 }
 
 JNIEXPORT jobject JNICALL
-Java_ag_boersego_bgjs_V8Engine_runScript(JNIEnv *env, jobject obj, jstring script, jstring name) {
+Java_ag_boersego_bgjs_V8Engine_getGlobalObjectOfContext(JNIEnv *env, jobject obj, jint contextId) {
+    return getGlobalObjectOfContext(env, obj, contextId);
+}
+
+JNIEXPORT jint JNICALL
+Java_ag_boersego_bgjs_V8Engine_createIsolatedContext(JNIEnv *env, jobject obj) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+
+    return engine->createIsolatedContext();
+}
+
+JNIEXPORT jboolean JNICALL
+Java_ag_boersego_bgjs_V8Engine_disposeIsolatedContext(JNIEnv *env, jobject obj, jint contextId) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+
+    return (jboolean) engine->disposeIsolatedContext(contextId);
+}
+
+static jobject runScriptInContext(JNIEnv *env, jobject obj, jint contextId, jstring script, jstring name) {
     auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
 
     v8::Isolate *isolate = engine->getIsolate();
     v8::Locker l(isolate);
     v8::Isolate::Scope isolateScope(isolate);
     v8::HandleScope scope(isolate);
-    v8::Local<v8::Context> context = engine->getContext();
+    v8::Local<v8::Context> context = getContextOrThrow(env, engine.get(), contextId);
+    if (context.IsEmpty()) {
+        return nullptr;
+    }
     v8::Context::Scope ctxScope(context);
 
     v8::TryCatch try_catch(isolate);
@@ -1577,7 +3770,7 @@ Java_ag_boersego_bgjs_V8Engine_runScript(JNIEnv *env, jobject obj, jstring scrip
     v8::MaybeLocal<v8::Value> value =
             Script::Compile(
                     context,
-                    JNIV8Marshalling::jstring2v8string(script),
+                    JNIV8Marshalling::jstring2v8string(env, script),
                     &origin
             ).ToLocalChecked()->Run(context);
 
@@ -1585,7 +3778,108 @@ Java_ag_boersego_bgjs_V8Engine_runScript(JNIEnv *env, jobject obj, jstring scrip
         engine->forwardV8ExceptionToJNI(&try_catch);
         return nullptr;
     }
-    return JNIV8Marshalling::v8value2jobject(value.ToLocalChecked());
+    return JNIV8Marshalling::v8value2jobject(env, value.ToLocalChecked());
+}
+
+JNIEXPORT jobject JNICALL
+Java_ag_boersego_bgjs_V8Engine_runScript(JNIEnv *env, jobject obj, jstring script, jstring name) {
+    return runScriptInContext(env, obj, 0, script, name);
+}
+
+JNIEXPORT jobject JNICALL
+Java_ag_boersego_bgjs_V8Engine_runScriptInContext(JNIEnv *env, jobject obj, jint contextId, jstring script,
+                                                  jstring name) {
+    return runScriptInContext(env, obj, contextId, script, name);
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_postTaskNative(JNIEnv *env, jobject obj, jobject runnable, jint priority) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+    engine->postTask(runJavaTask, env->NewGlobalRef(runnable), (BGJSTaskPriority) priority);
+}
+
+JNIEXPORT jlong JNICALL
+Java_ag_boersego_bgjs_V8Engine_runTimers(JNIEnv *env, jobject obj) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = engine->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    return engine->runTimers();
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_idleNotification(JNIEnv *env, jobject obj, jlong idleTime) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+
+    engine->idleNotification((double) getMonotonicTime() + idleTime, false);
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_drainDisposals(JNIEnv *env, jobject obj) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    // finalizers of wrapped objects may create handles and call into js
+    v8::Local<v8::Context> context = engine->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    engine->drainDisposals();
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_onMemoryPressure(JNIEnv *env, jobject obj, jint level) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+    if (!engine->getIsolate()) {
+        return;
+    }
+    // no lock: js may be running, and the notification is meant to reach v8 right away
+    engine->onMemoryPressure((BGJSV8Engine::EBGJSMemoryPressure) level);
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_longIdleNotification(JNIEnv *env, jobject obj) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+
+    engine->longIdleNotification();
+}
+
+JNIEXPORT jboolean JNICALL
+Java_ag_boersego_bgjs_V8Engine_createSnapshot(JNIEnv *env, jobject obj, jobject assetManager, jstring path,
+                                              jobjectArray warmModules) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+    engine->setAssetManager(assetManager);
+
+    std::vector<std::string> modules;
+    jsize numModules = warmModules ? env->GetArrayLength(warmModules) : 0;
+    for (jsize i = 0; i < numModules; i++) {
+        jstring module = (jstring) env->GetObjectArrayElement(warmModules, i);
+        modules.push_back(JNIWrapper::jstring2string(module));
+        env->DeleteLocalRef(module);
+    }
+
+    return (jboolean) engine->createSnapshot(JNIWrapper::jstring2string(path).c_str(), modules);
+}
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_V8Engine_prepareSpareIsolate(JNIEnv *env, jobject obj) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(obj);
+    engine->prepareSpareIsolate();
 }
 
 JNIEXPORT void JNICALL
@@ -1611,4 +3905,22 @@ Java_ag_boersego_bgjs_V8Engine_getConstructor(JNIEnv *env, jobject obj, jstring
     return JNIV8Wrapper::wrapObject<JNIV8Function>(
             JNIV8Wrapper::getJSConstructor(engine.get(), strCanonicalName))->getJObject();
 }
+
+JNIEXPORT jstring JNICALL
+Java_ag_boersego_bgjs_V8JSException_readJSError(JNIEnv *env, jobject obj, jobject error, jstring scriptName,
+                                                jint lineNumber) {
+    auto jsError = JNIWrapper::wrapObject<JNIV8Object>(error);
+    BGJSV8Engine *engine = jsError->getEngine();
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = engine->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    // java is only asking for details; errors in the getters of the js error are not passed on
+    v8::TryCatch try_catch(isolate);
+    return engine->readJSError(env, jsError->getJSObject(), obj, scriptName, lineNumber);
+}
 }
\ No newline at end of file
@@ -2,16 +2,30 @@
 #define __BGJSV8Engine_H 1
 
 #include <v8.h>
+#include <v8-profiler.h>
 #include <jni.h>
 #include <map>
 #include <string>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <assert.h>
 #include <mallocdebug.h>
 
 #include "os-android.h"
 #include "BGJSModule.h"
+#include "BGJSArrayBufferAllocator.h"
+#include "BGJSTimerWheel.h"
+#include "BGJSTaskScheduler.h"
+#include "BGJSStringCache.h"
+#include "BGJSBundle.h"
+#include "BGJSScriptStreamer.h"
 
 #include "../jni/jni.h"
+#include "../v8/JNIV8ClassInfoTable.h"
 
 /**
  * BGJSV8Engine
@@ -22,24 +36,65 @@
  */
 
 class BGJSGLView;
+class BGJSV8EngineAsset;
+class BGJSHeapDumpWriter;
+class BGJSWatchdog;
 
 #define MAX_FRAME_REQUESTS 10
 
-struct WrapPersistentFunc {
-	v8::Persistent<v8::Function> callbackFunc;
-};
-
-struct WrapPersistentObj {
-	v8::Persistent<v8::Object> obj;
-};
+/**
+ * Threading
+ * The isolate is only entered through JNI entry points (require, runScript, callbacks from java, the gl view), which
+ * take a v8::Locker for their whole turn. Callbacks invoked by v8 always run inside such a turn, so they do not lock
+ * again; debug builds check that the lock is actually held.
+ */
+#ifdef NDEBUG
+#define BGJS_ASSERT_LOCKED(isolate)
+#else
+#define BGJS_ASSERT_LOCKED(isolate) assert(v8::Locker::IsLocked(isolate));
+#endif
 
 typedef  void (*requireHook) (class BGJSV8Engine* engine, v8::Handle<v8::Object> target);
+// work handed to the js thread by native threads; runs inside a locked turn with a handle scope and the context entered
+typedef void (*BGJSV8EngineTask) (class BGJSV8Engine* engine, void* data);
 
 typedef enum EBGJSV8EngineEmbedderData {
     kContext = 1,
-    FIRST_UNUSED = 2
+    kIsolatedContext = 2,   // BGJSV8EngineContext of contexts made by createIsolatedContext, null for the main one
+    FIRST_UNUSED = 3
 } EBGJSV8EngineEmbedderData;
 
+/**
+ * a context of the isolate besides the main one, for independent scripts such as widgets, which costs a context and
+ * not a whole isolate. It has its own global, module cache and timers; compiled code, the templates of the global and
+ * the classes bridged to java are shared with the main context. Scripts can not reach the globals of other contexts,
+ * only values that java hands them.
+ */
+struct BGJSV8EngineContext {
+    int id;
+    class BGJSV8Engine* engine;
+    bool disposed;      // the state lives on until the context is collected, as its functions may still be called
+    v8::Persistent<v8::Context> context;
+    std::map<std::string, v8::Persistent<v8::Value>> moduleCache;
+    v8::Persistent<v8::Function> requireFn, makeRequireFn;
+};
+
+/**
+ * names used by the engine itself; created once per isolate and kept for its whole lifetime
+ */
+typedef enum EBGJSV8EngineString {
+    kStringId = 0,
+    kStringExports,
+    kStringEnvironment,
+    kStringPlatform,
+    kStringDebug,
+    kStringIsStoreBuild,
+    kStringMain,
+    kStringBGJSContext,
+    kStringAndroid,
+    kStringCount
+} EBGJSV8EngineString;
+
 class BGJSV8Engine : public JNIObject {
 	friend class JNIWrapper;
 public:
@@ -54,6 +109,36 @@ public:
 	static BGJSV8Engine* GetInstance(v8::Isolate* isolate);
 
     v8::MaybeLocal<v8::Value> require(std::string baseNameStr);
+	/**
+	 * starts compiling the module require(baseNameStr) would load on a worker thread, so that require only has to
+	 * finalize it; does nothing for native, json and already loaded modules and for modules with a code cache
+	 */
+	void preload(std::string baseNameStr);
+
+	enum BGJSCodeCacheUse {
+		kCodeCacheNone,		// disabled, or the module is json
+		kCodeCacheBundled,	// consumed the code cache of the bundle
+		kCodeCacheHit,		// consumed the code cache in the cache directory
+		kCodeCacheMiss,		// compiled, and wrote a code cache if enabled
+		kCodeCacheStreamed	// compiled on a worker since require.preload
+	};
+	// what loading a module from an asset took; recorded by require for every file it loaded
+	struct BGJSModuleStats {
+		std::string fileName;
+		int probes;				// assets looked for while resolving the name
+		size_t bytes;			// of the source
+		double loadTime;		// ms of resolving the name and opening the asset
+		double compileTime;		// ms of compiling it, or parsing it for json
+		double evalTime;		// ms of running it, including the modules it requires
+		BGJSCodeCacheUse codeCache;
+		int64_t heapDelta;		// bytes used on the heap after running it minus before resolving it
+	};
+	// stats of all modules loaded so far, in the order they started loading, as a json array
+	std::string getModuleStatsJSON() const;
+	// writes getModuleStatsJSON to a file in basePath; returns its path, or an empty string if it could not be written
+	std::string writeModuleStats(const char* basePath) const;
+	// stats of the ArrayBuffer allocator of the isolate and of the pool all isolates share, as a json object
+	std::string getArrayBufferStatsJSON() const;
     uint8_t requestEmbedderDataIndex();
     bool registerModule(const char *name, requireHook f);
 	bool registerJavaModule(jobject module);
@@ -61,8 +146,61 @@ public:
 	v8::Isolate* getIsolate() const;
 	v8::Local<v8::Context> getContext() const;
 
+	/**
+	 * creates a context with its own global, see BGJSV8EngineContext; returns its id. The main context has id 0
+	 */
+	int createIsolatedContext();
+	// the context of id, or an empty handle if there is none (anymore)
+	v8::Local<v8::Context> getContext(int id) const;
+	// cancels the timers of the context and drops its modules; false if there is no context of id
+	bool disposeIsolatedContext(int id);
+
+	/**
+	 * private symbol under which JNIV8Wrapper stores the wrapper object created for a js object
+	 */
+	v8::Local<v8::Private> getWrapperCacheKey();
+
+	/**
+	 * class infos that JNIV8Wrapper created for this engine
+	 */
+	JNIV8ClassInfoTable& getClassInfoTable() { return _classInfos; }
+
+	/**
+	 * creates an ArrayBuffer without zeroing its contents; the caller has to overwrite all of them before js can read it
+	 */
+	v8::Local<v8::ArrayBuffer> newUninitializedArrayBuffer(size_t length);
+
+	/**
+	 * returns the internalized string for one of the names used by the engine
+	 */
+	v8::Local<v8::String> getString(EBGJSV8EngineString name);
+
+	/**
+	 * returns an internalized string for a property name; short names are served from a cache
+	 */
+	v8::Local<v8::String> getPropertyName(const uint16_t *chars, int length);
+
+	/**
+	 * property keys are internalized names that are kept for the lifetime of the engine
+	 * creating a key for the same name twice returns the same key
+	 */
+	int createPropertyKey(const uint16_t *chars, int length);
+	v8::Local<v8::String> getPropertyKey(int key) const;
+
+	/**
+	 * object template that JNIV8Record created for the layout of a record class; empty if there is none yet
+	 */
+	v8::Local<v8::ObjectTemplate> getRecordTemplate(const void *layout) const;
+	void setRecordTemplate(const void *layout, v8::Local<v8::ObjectTemplate> tpl);
+
 	bool forwardJNIExceptionToV8() const;
 	bool forwardV8ExceptionToJNI(v8::TryCatch* try_catch) const;
+	/**
+	 * sets the stack trace of the java exception that was made for a js error by forwardV8ExceptionToJNI, and
+	 * returns its message; has to be called with the isolate locked and the context entered
+	 */
+	jstring readJSError(JNIEnv *env, v8::Local<v8::Object> exception, jobject javaException, jstring scriptName,
+						jint lineNumber) const;
 
 	void setLocale(const char* locale, const char* lang, const char* tz, const char* deviceClass);
 	void setDensity(float density);
@@ -70,9 +208,15 @@ public:
 	void setDebug(bool debug);
 
 	char* loadFile(const char* path, unsigned int* length = nullptr) const;
+	BGJSV8EngineAsset* openAsset(const char* path) const;
+	// true if there is an asset at path, or the bundle contains it; lists its directory the first time
+	bool assetExists(const std::string& path);
+	// source of the module at path, from the bundle if it contains it; bundled is set to its entry then
+	BGJSV8EngineAsset* openModuleAsset(const std::string& path, const BGJSBundle::Module** bundled);
 
 	static void js_global_requestAnimationFrame (const v8::FunctionCallbackInfo<v8::Value>&);
     static void js_process_nextTick (const v8::FunctionCallbackInfo<v8::Value>&);
+	static void js_scheduler_postTask (const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void js_global_cancelAnimationFrame (const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void js_global_setTimeout (const v8::FunctionCallbackInfo<v8::Value>& info);
 	static void js_global_clearTimeout (const v8::FunctionCallbackInfo<v8::Value>& info);
@@ -89,10 +233,101 @@ public:
     static void setTimeoutInt(const v8::FunctionCallbackInfo<v8::Value>& info, bool recurring);
 	static void clearTimeoutInt(const v8::FunctionCallbackInfo<v8::Value>& info);
 
+	/**
+	 * runs all expired timers
+	 * returns the delay in ms until the next timer expires, or -1 if no timers are left
+	 */
+	jlong runTimers();
+
+	/**
+	 * lets v8 collect garbage until deadline, in ms of CLOCK_MONOTONIC; has to be called with the isolate locked
+	 * afterFrame is set for the time left in a frame once its callbacks ran; otherwise the js thread is idle, which is
+	 * ignored while views render frames
+	 */
+	void idleNotification(double deadline, bool afterFrame);
+	// the js thread has been idle for a long time; frees as much memory as possible if the heap grew since the last time
+	void longIdleNotification();
+
+	enum EBGJSMemoryPressure {
+		kMemoryPressureNone = 0,
+		kMemoryPressureModerate,
+		kMemoryPressureCritical
+	};
+	/**
+	 * the system is running low on memory; can be called on any thread, even while js runs
+	 * v8 collects garbage accordingly, canvases free their image textures, and under critical pressure their fonts and
+	 * the cache of property names as well
+	 */
+	void onMemoryPressure(EBGJSMemoryPressure level);
+
+	/**
+	 * calls task with data on the js thread as soon as possible; can be called from any thread
+	 * tasks posted while the engine is paused run once it resumes
+	 */
+	void runOnJSThread(BGJSV8EngineTask task, void* data);
+	/**
+	 * removes the tasks passed to runOnJSThread that call task before they ran and returns their data, so whoever
+	 * posted them can free it when the engine goes away; can be called from any thread
+	 */
+	std::vector<void*> cancelJSThreadTasks(BGJSV8EngineTask task);
+	/**
+	 * calls task with data on the js thread in the lane of priority; can be called from any thread
+	 * unlike runOnJSThread, user-visible and background tasks make way for frames, see BGJSTaskScheduler
+	 */
+	void postTask(BGJSV8EngineTask task, void* data, BGJSTaskPriority priority);
+	BGJSTaskScheduler* getTaskScheduler() { return &_scheduler; }
+
+	/**
+	 * deletes object on the js thread once it is idle; can be called from any thread
+	 * used for native objects of garbage collected java objects whose destructors need the isolate, so the finalizing
+	 * daemon does not have to wait for js
+	 * every wake of the js thread deletes a batch of them as well, so busy or paused engines do not pile them up
+	 */
+	void disposeLater(JNIObject* object);
+	/**
+	 * deletes all objects passed to disposeLater right away; has to be called on the js thread with the isolate locked
+	 */
+	void drainDisposals();
+
 	v8::MaybeLocal<v8::Value> parseJSON(v8::Handle<v8::String> source) const;
+	// parses utf-8 encoded json straight from native memory; isOneByte can be set if the source was found to be pure ascii
+	v8::MaybeLocal<v8::Value> parseJSON(const char *source, size_t length, bool isOneByte) const;
 	v8::MaybeLocal<v8::Value> stringifyJSON(v8::Handle<v8::Object> source, bool pretty = false) const;
 
-    const char* enqueueMemoryDump(const char *basePath);
+    /**
+     * takes a heap snapshot on the js thread and writes it to a file in basePath in the background
+     * returns the path of the file, or an empty string if a snapshot is being taken already
+     */
+    std::string enqueueMemoryDump(const char *basePath);
+    // samples allocations every sampleInterval bytes on average, with stacks of up to stackDepth frames
+    bool startSamplingHeapProfiler(int sampleInterval, int stackDepth);
+    // stops the sampling heap profiler and writes its profile to a file in basePath in the background; empty if it did not run
+    std::string stopSamplingHeapProfiler(const char *basePath);
+    // calls the java engine with the progress of a heap snapshot; a negative percent reports that it failed
+    void reportHeapDumpProgress(const std::string& path, int percent);
+
+    /**
+     * starts recording a cpu profile, sampling every samplingInterval microseconds
+     * profiles that start while the background profile runs sample at its rate; false if a profile runs already
+     */
+    bool startCpuProfile(const std::string& title, int samplingInterval);
+    // stops the cpu profile and writes it to a .cpuprofile file in basePath in the background; empty if none ran
+    std::string stopCpuProfile(const char *basePath);
+    /**
+     * samples at a low rate until stopped, in segments of windowMs; the latest complete segment is kept, so the
+     * js of the last windowMs to twice that can be dumped any time, e.g. when a frame was dropped
+     */
+    void startBackgroundCpuProfile(int samplingInterval, int windowMs);
+    void stopBackgroundCpuProfile();
+    // writes the latest segments of the background profile to a .cpuprofile file in basePath; empty if none runs
+    std::string dumpBackgroundCpuProfile(const char *basePath);
+
+    /**
+     * reports the js stacks of tasks of the js thread that run longer than thresholdMs to V8Engine.onLongTask, and
+     * terminates them after terminateAfterMs unless it is 0; returns the watchdog, which lives as long as the engine
+     */
+    BGJSWatchdog* startWatchdog(uint32_t thresholdMs, uint32_t terminateAfterMs);
+    void stopWatchdog();
 
 	void createContext();
 
@@ -110,18 +345,66 @@ public:
     void setMaxHeapSize(int maxHeapSize);
 
     void setIsStoreBuild(bool isStoreBuild);
+    // console messages below the android log priority level are dropped before their arguments are converted;
+    // LOG_DEBUG by default, LOG_INFO in store builds
+    void setLogLevel(int level);
+
+    void setCodeCachePath(const char* path);
+    void setSnapshotPath(const char* path);
+    bool createSnapshot(const char* path, const std::vector<std::string>& warmModules);
+    // prepares an isolate in the background for the next engine that creates its context
+    void prepareSpareIsolate();
+    // reads a snapshot file created by createSnapshot; file receives its contents, which have to outlive the isolate
+    static bool loadSnapshot(const std::string& path, char** file, v8::StartupData* blob);
+
+    static const intptr_t* getExternalReferences();
 
 private:
 	// utility method to convert v8 values to readable strings for debugging
 	const std::string toDebugString(v8::Handle<v8::Value> source) const;
+	// appends the debug strings of the arguments from index start on, separated by spaces, to message
+	void appendDebugStrings(std::string& message, const v8::FunctionCallbackInfo<v8::Value>& args, int start) const;
+
+	// a stack trace of a single frame at the location an exception was thrown, if known
+	jobjectArray makeFallbackStackTrace(JNIEnv *env, jstring scriptName, jint lineNumber) const;
 
 	// called by JNIWrapper
 	static void initializeJNIBindings(JNIClassInfo *info, bool isReload);
 
 	static void JavaModuleRequireCallback(BGJSV8Engine *engine, v8::Handle<v8::Object> target);
 
-    static void OnGCCompletedForDump(v8::Isolate* isolate, v8::GCType type,
-                                     v8::GCCallbackFlags flags);
+	// compiles the wrapped source of a module, consuming and producing code cache entries if enabled
+	v8::MaybeLocal<v8::Script> compileModule(v8::Local<v8::Context> context, v8::Local<v8::String> source,
+											 v8::ScriptOrigin* origin, const std::string& fileName, const char* buf, size_t length,
+											 const BGJSBundle::Module* bundled = nullptr,
+											 BGJSCodeCacheUse* codeCacheUse = nullptr);
+	std::string getCodeCacheFileName(const std::string& fileName, const char* buf, size_t length) const;
+	void writeCodeCache(v8::Local<v8::Script> script, const std::string& cacheFileName, const std::string& fileName);
+	void loadBundle();
+
+	void initializePlatform();
+	v8::Local<v8::ObjectTemplate> createGlobalTemplate();
+	void createBindings(v8::Local<v8::Context> context);
+	bool restoreSnapshotData(v8::Local<v8::Context> context);
+
+	struct BGJSResolvedModule {
+		std::string fileName;
+		bool isJson;
+	};
+	// finds the asset that require(baseName) loads, without opening any asset that does not exist
+	bool resolveModule(const std::string& baseName, BGJSResolvedModule* resolved);
+
+	static void takeHeapSnapshot(BGJSV8Engine* engine, void* data);
+	static void heapDumpWritten(BGJSV8Engine* engine, BGJSHeapDumpWriter* writer);
+	static void cpuProfileWritten(BGJSV8Engine* engine, BGJSHeapDumpWriter* writer);
+	void startCpuProfiling(v8::Local<v8::String> title, int samplingInterval);
+	v8::CpuProfile* nextBackgroundCpuProfileSegment();
+	static void onLongTask(v8::Isolate* isolate, const std::string& stack, uint64_t blockedMs, void* data);
+	void rotateBackgroundCpuProfile();
+	std::string writeCpuProfile(const char *basePath, const char *prefix, const std::vector<const v8::CpuProfile*>& profiles);
+	static size_t NearHeapLimitCallback(void* data, size_t currentHeapLimit, size_t initialHeapLimit);
+	static void reportNearHeapLimit(BGJSV8Engine* engine, void* data);
+	static void purgePropertyNames(BGJSV8Engine* engine, void* data);
 
 	static struct {
 		jclass clazz;
@@ -132,6 +415,7 @@ private:
 	static struct {
 		jclass clazz;
 		jmethodID initId;
+		jmethodID lazyInitId;
 		jmethodID setStackTraceId;
 	} _jniV8JSException;
 
@@ -147,9 +431,12 @@ private:
 
 	static struct {
 		jclass clazz;
-		jmethodID removeTimeoutId;
-		jmethodID setTimeoutId;
-		jmethodID enqueueOnNextTick;
+		JNIMethodHandle<void(jlong)> scheduleTimers;
+		JNIMethodHandle<void(jlong)> onNearHeapLimit;
+		JNIMethodHandle<void(jobject, jint)> onHeapDumpProgress;
+		JNIMethodHandle<void(jobject, jboolean)> onHeapDumpFinished;
+		JNIMethodHandle<void(jobject, jboolean)> onCpuProfileWritten;
+		JNIMethodHandle<void(jobject, jlong)> onLongTask;
 	} _jniV8Engine;
 
 	char *_locale;		// de_DE
@@ -158,6 +445,12 @@ private:
 	char *_deviceClass; // "phone"/"tablet"
 	int _maxHeapSize;	// in MB
     bool _isStoreBuild;
+    int _logLevel;
+	std::string _codeCachePath; // directory for compiled module code; empty if disabled
+	std::string _snapshotPath;  // startup snapshot to deserialize the context from; empty if disabled
+	char* _snapshotFile;        // contents of the snapshot file, must outlive the isolate
+	v8::StartupData _snapshotBlob;
+	bool _isCreatingSnapshot;
 
 	float _density;
 
@@ -165,22 +458,95 @@ private:
 	jobject _javaObject, _javaAssetManager;
 
     void enqueueNextTick(const v8::FunctionCallbackInfo<v8::Value>&);
+	static void runNextTicks(void *data);
+	// posted task that runs the ticks left in the queue by one that threw
+	static void resumeNextTicks(BGJSV8Engine *engine, void *data);
+
+	// ring buffer of pending process.nextTick callbacks
+	std::vector<v8::Global<v8::Function>> _nextTickQueue;
+	size_t _nextTickHead, _nextTickCount;
+	bool _isNextTickScheduled;
 
 	v8::Persistent<v8::Context> _context;
+	// contexts made by createIsolatedContext, including disposed ones that were not collected yet
+	std::map<int, BGJSV8EngineContext*> _isolatedContexts;
+	int _nextContextId;
+	v8::Persistent<v8::ObjectTemplate> _globalTemplate;	// of the isolated contexts
+	BGJSV8EngineContext* getCurrentIsolatedContext() const;
+	static void onIsolatedContextCollected(const v8::WeakCallbackInfo<BGJSV8EngineContext>& info);
 
 	// Attributes
 	std::map<std::string, jobject> _javaModules;
 	std::map<std::string, requireHook> _modules;
     std::map<std::string, v8::Persistent<v8::Value>> _moduleCache;
+	// assets never change, so neither do the files names resolve to
+	std::unordered_map<std::string, BGJSResolvedModule> _resolvedModules;
+	// names of the files in every asset directory listed so far, by directory
+	std::unordered_map<std::string, std::unordered_set<std::string>> _assetDirectories;
+	std::shared_ptr<BGJSBundle> _bundle;	// opened by the first require; null if the app has none
+	bool _isBundleLoaded;
+	int _assetProbes;	// calls of assetExists so far
+	std::vector<BGJSModuleStats> _moduleStats;
+	std::unordered_map<std::string, size_t> _moduleStatsIndex;	// index in _moduleStats by file name
+	void recordModuleStats(const BGJSModuleStats& stats);
+	size_t usedHeapSize() const;
+	// modules compiling on worker threads since require.preload, by file name
+	std::unordered_map<std::string, std::shared_ptr<BGJSScriptStreamer>> _preloads;
     v8::Isolate* _isolate;
+	BGJSArrayBufferAllocator* _arrayBufferAllocator;
 
     v8::Persistent<v8::Function> _requireFn, _makeRequireFn;
 	v8::Persistent<v8::Function> _jsonParseFn, _jsonStringifyFn;
 	v8::Persistent<v8::Function> _makeJavaErrorFn;
 	v8::Persistent<v8::Function> _getStackTraceFn;
+	v8::Persistent<v8::Private> _wrapperCacheKey;
+	JNIV8ClassInfoTable _classInfos;
+	BGJSStringCache _propertyNames;
+	v8::Eternal<v8::String> _strings[kStringCount];
+	std::vector<v8::Eternal<v8::String>> _propertyKeys;
+	std::unordered_map<std::u16string, int> _propertyKeysByName;
+	std::unordered_map<const void*, v8::Eternal<v8::ObjectTemplate>> _recordTemplates;
     v8::Local<v8::Function> makeRequireFunction(std::string pathName);
 
+	// make sure the java side advances the timer wheel no later than the specified time
+	void requestTimerTick(uint64_t tick);
+
 	int _nextTimerId;
+	BGJSTimerWheel _timers;
+	std::unordered_map<int, BGJSTimer*> _timersById;
+	std::vector<BGJSTimer*> _dueTimers;
+	uint64_t _scheduledTimerTick;	// time the java side will call runTimers at next; UINT64_MAX if none
+	bool _isRunningTimers;
+
+	std::mutex _tasksMutex;
+	std::vector<std::pair<BGJSV8EngineTask, void*>> _tasks, _runningTasks;
+	BGJSTaskScheduler _scheduler;
+
+	// deletes objects passed to disposeLater until deadline or limit of them are gone; returns false if some are left
+	bool runPendingDisposals(double deadline, size_t limit);
+	static void wakeForDisposals(BGJSV8Engine* engine, void* data);
+
+	std::mutex _disposalsMutex;
+	std::vector<JNIObject*> _pendingDisposals;
+	std::vector<JNIObject*> _runningDisposals;	// only accessed on the js thread
+	uint64_t _disposalsSince;			// time the objects waiting for disposal started to pile up; 0 if there are none
+	bool _isDisposalWakeQueued;
+
+	static v8::Platform* _platform;
+	bool _isIdleGCDone;					// v8 has nothing left to do until js runs again
+	uint64_t _lastFrameTime;			// end of the last frame that had time left for garbage collection
+	size_t _heapSizeAfterLongIdle;
+
+	std::atomic<bool> _isTakingHeapSnapshot;
+
+	v8::CpuProfiler* _cpuProfiler;			// created with the first profile
+	int _cpuProfileCount;					// profiles being recorded, including the background one
+	std::string _cpuProfileTitle;			// of the profile started by startCpuProfile; empty if none
+	BGJSWatchdog* _watchdog;				// created by the first startWatchdog
+	int _backgroundCpuProfileWindow;		// in ms; 0 if the background profile does not run
+	uint64_t _backgroundCpuProfileStart;	// of the current segment
+	unsigned int _backgroundCpuProfileSegment;
+	v8::CpuProfile* _backgroundCpuProfile;	// the latest complete segment, or nullptr
 
 };
 
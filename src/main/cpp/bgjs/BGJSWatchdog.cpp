@@ -0,0 +1,134 @@
+/**
+ * BGJSWatchdog
+ * Finds the js that blocks the js thread of an engine
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSWatchdog.h"
+#include "os-android.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <time.h>
+
+#define LOG_TAG	"BGJSWatchdog"
+
+using namespace v8;
+
+namespace {
+
+// frames of a report; deeper stacks are cut off
+const int kMaxFrames = 32;
+
+uint64_t now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+}
+
+BGJSWatchdog::BGJSWatchdog(Isolate* isolate, Report report, void* data) :
+		_isolate(isolate), _report(report), _reportData(data), _running(false), _threshold(0), _terminateAfter(0),
+		_taskStart(0), _task(0), _interruptedTask(0), _terminatedTask(0) {
+}
+
+BGJSWatchdog::~BGJSWatchdog() {
+	stop();
+}
+
+void BGJSWatchdog::start(uint32_t thresholdMs, uint32_t terminateAfterMs) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	_threshold = std::max<uint32_t>(thresholdMs, 1);
+	_terminateAfter = terminateAfterMs ? std::max(terminateAfterMs, _threshold) : 0;
+	if (_running) {
+		_wake.notify_one();
+		return;
+	}
+	_running = true;
+	_thread = std::thread(&BGJSWatchdog::watch, this);
+}
+
+void BGJSWatchdog::stop() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_running) {
+			return;
+		}
+		_running = false;
+	}
+	_wake.notify_one();
+	_thread.join();
+}
+
+void BGJSWatchdog::beginTask() {
+	std::lock_guard<std::mutex> lock(_taskMutex);
+	_task.fetch_add(1, std::memory_order_acq_rel);
+	_taskStart.store(now(), std::memory_order_release);
+}
+
+void BGJSWatchdog::endTask() {
+	std::lock_guard<std::mutex> lock(_taskMutex);
+	_taskStart.store(0, std::memory_order_release);
+	// a termination that did not get to js before the task ended must not hit the next one
+	if (_terminatedTask.load(std::memory_order_acquire) == _task.load(std::memory_order_relaxed)) {
+		_isolate->CancelTerminateExecution();
+	}
+}
+
+void BGJSWatchdog::watch() {
+	std::unique_lock<std::mutex> lock(_mutex);
+	uint32_t reported = 0, terminated = 0;
+	while (_running) {
+		_wake.wait_for(lock, std::chrono::milliseconds(std::max<uint32_t>(_threshold / 4, 5)));
+		if (!_running) {
+			break;
+		}
+
+		std::lock_guard<std::mutex> taskLock(_taskMutex);
+		const uint32_t task = _task.load(std::memory_order_acquire);
+		const uint64_t start = _taskStart.load(std::memory_order_acquire);
+		if (!start) {
+			continue;
+		}
+		const uint64_t elapsed = now() - start;
+		if (elapsed >= _threshold && reported != task) {
+			reported = task;
+			_interruptedTask.store(task, std::memory_order_release);
+			_isolate->RequestInterrupt(&BGJSWatchdog::onInterrupt, this);
+		}
+		if (_terminateAfter && elapsed >= _terminateAfter && terminated != task) {
+			terminated = task;
+			LOGE("Terminating js task that has run for %u ms", (unsigned int)elapsed);
+			// stored first, so endTask of this very task cancels it, whenever it gets the lock
+			_terminatedTask.store(task, std::memory_order_release);
+			_isolate->TerminateExecution();
+		}
+	}
+}
+
+void BGJSWatchdog::onInterrupt(Isolate* isolate, void* data) {
+	BGJSWatchdog* watchdog = (BGJSWatchdog*)data;
+	// the interrupt may only be serviced once the task it was asked for has ended
+	const uint32_t task = watchdog->_task.load(std::memory_order_acquire);
+	const uint64_t start = watchdog->_taskStart.load(std::memory_order_acquire);
+	if (!start || watchdog->_interruptedTask.load(std::memory_order_acquire) != task) {
+		return;
+	}
+
+	HandleScope scope(isolate);
+	Local<StackTrace> stackTrace = StackTrace::CurrentStackTrace(isolate, kMaxFrames, StackTrace::kOverview);
+	std::stringstream str;
+	const int frames = stackTrace->GetFrameCount();
+	for (int i = 0; i < frames; i++) {
+		const Local<StackFrame> frame = stackTrace->GetFrame(isolate, i);
+		const String::Utf8Value scriptName(isolate, frame->GetScriptName());
+		const String::Utf8Value functionName(isolate, frame->GetFunctionName());
+		str << "    " << (*scriptName ? *scriptName : "<unknown>") << " ("
+			<< (*functionName && **functionName ? *functionName : "<anonymous>") << ":" << frame->GetLineNumber()
+			<< ":" << frame->GetColumn() << ")\n";
+	}
+	watchdog->_report(isolate, str.str(), now() - start, watchdog->_reportData);
+}
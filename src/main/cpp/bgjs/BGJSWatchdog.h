@@ -0,0 +1,73 @@
+#ifndef __BGJSWATCHDOG_H
+#define __BGJSWATCHDOG_H	1
+
+#include <v8.h>
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * BGJSWatchdog
+ * Finds the js that blocks the js thread of an engine
+ *
+ * The js thread marks the beginning and end of every message it handles. A thread of the watchdog wakes up a few times
+ * per threshold, and once a message ran longer than the threshold it asks the isolate for an interrupt, which captures
+ * the stack of the running js without stopping it and hands it to the report callback on the js thread.
+ * Interrupts are only serviced while js runs, so tasks that are blocked in native or java code are reported once they
+ * return to js, if they do before they end. Tasks that run longer than terminateAfter are terminated like a script that
+ * throws an exception no js can catch.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSWatchdog {
+public:
+	// called on the js thread from an interrupt, with the isolate locked and a handle scope open
+	typedef void (*Report) (v8::Isolate* isolate, const std::string& stack, uint64_t blockedMs, void* data);
+
+	BGJSWatchdog(v8::Isolate* isolate, Report report, void* data);
+	~BGJSWatchdog();
+
+	/**
+	 * reports tasks that run longer than thresholdMs; terminateAfterMs is 0 or at least the threshold, 0 never
+	 * terminates. May be called again to change the thresholds
+	 */
+	void start(uint32_t thresholdMs, uint32_t terminateAfterMs);
+	void stop();
+
+	// called on the js thread around every task it runs, without the isolate lock
+	void beginTask();
+	void endTask();
+
+private:
+	BGJSWatchdog(const BGJSWatchdog&) = delete;
+	BGJSWatchdog& operator=(const BGJSWatchdog&) = delete;
+
+	void watch();
+	static void onInterrupt(v8::Isolate* isolate, void* data);
+
+	v8::Isolate* _isolate;
+	Report _report;
+	void* _reportData;
+
+	std::mutex _mutex;
+	std::condition_variable _wake;
+	std::thread _thread;
+	bool _running;
+	uint32_t _threshold, _terminateAfter;	// in ms
+
+	/*
+	 * held by the js thread while it begins or ends a task, and by the watchdog from reading the task until it asked
+	 * for its termination, so a task can not end between the two and leave the termination to the next one
+	 */
+	std::mutex _taskMutex;
+	std::atomic<uint64_t> _taskStart;		// in ms of CLOCK_MONOTONIC; 0 while the thread is idle
+	std::atomic<uint32_t> _task;			// counts the tasks, so reports and terminations stick to theirs
+	std::atomic<uint32_t> _interruptedTask;
+	std::atomic<uint32_t> _terminatedTask;
+};
+
+#endif
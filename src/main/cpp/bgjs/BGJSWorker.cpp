@@ -0,0 +1,722 @@
+/**
+ * BGJSWorker
+ * Web Workers: scripts that run in isolates of their own on a pool of threads
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSWorker.h"
+#include "BGJSArrayBufferAllocator.h"
+#include "BGJSV8Engine.h"
+#include "../v8/JNIV8Wrapper.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_TAG "BGJSWorker"
+
+using namespace v8;
+
+// a worker handles this many messages in a row before the others of the pool get their turn
+#define BGJS_WORKER_MESSAGES_PER_TURN 16
+// the pool has a thread per core but one, which is left to the js and gl threads of the engine, and at most this many
+#define BGJS_WORKER_MAX_THREADS 4
+
+// isolate data slot of the worker running in an isolate
+#define BGJS_WORKER_ISOLATE_SLOT 0
+
+namespace {
+
+// workers that are not released yet, for terminating those of an engine that goes away
+std::mutex registryMutex;
+std::vector<BGJSWorker*> registry;
+// turns running on the pool by engine, which is not destroyed before those of its workers are over
+std::condition_variable turnsCondition;
+std::map<BGJSV8Engine*, int> runningTurns;
+
+std::mutex poolMutex;
+std::condition_variable poolCondition;
+std::deque<BGJSWorker*> runQueue;
+bool poolStarted = false;
+
+// sent to the js thread of the engine; carries a reference to the worker
+struct WorkerMessageTask {
+	BGJSWorker* worker;
+	BGJSWorkerMessage* message;
+};
+
+struct WorkerErrorTask {
+	BGJSWorker* worker;
+	std::string message, fileName;
+	int lineNumber;
+};
+
+class WorkerSerializerDelegate : public ValueSerializer::Delegate {
+public:
+	explicit WorkerSerializerDelegate(Isolate* isolate) : _isolate(isolate) {}
+	void ThrowDataCloneError(Local<String> message) override {
+		_isolate->ThrowException(Exception::Error(message));
+	}
+private:
+	Isolate* _isolate;
+};
+
+void throwDataCloneError(Isolate* isolate, const char* message) {
+	isolate->ThrowException(Exception::Error(String::NewFromUtf8(isolate, message)));
+}
+
+}
+
+//-----------------------------------------------------------
+// Messages
+//-----------------------------------------------------------
+
+BGJSWorkerMessage* BGJSWorkerMessage::write(Isolate* isolate, Local<Context> context, Local<Value> value,
+											Local<Value> transfer) {
+	WorkerSerializerDelegate delegate(isolate);
+	ValueSerializer serializer(isolate, &delegate);
+
+	std::vector<Local<ArrayBuffer>> buffers;
+	if (!transfer.IsEmpty() && !transfer->IsUndefined()) {
+		if (!transfer->IsArray()) {
+			throwDataCloneError(isolate, "The transfer list has to be an array");
+			return nullptr;
+		}
+		Local<Array> list = transfer.As<Array>();
+		for (uint32_t i = 0; i < list->Length(); i++) {
+			Local<Value> item;
+			if (!list->Get(context, i).ToLocal(&item)) {
+				return nullptr;
+			}
+			if (!item->IsArrayBuffer()) {
+				throwDataCloneError(isolate, "Only ArrayBuffers can be transferred");
+				return nullptr;
+			}
+			Local<ArrayBuffer> buffer = item.As<ArrayBuffer>();
+			// buffers with memory of their owners, and those in use by wasm, can not be moved
+			if (buffer->IsExternal() || !buffer->IsNeuterable()) {
+				throwDataCloneError(isolate, "An ArrayBuffer in the transfer list can not be transferred");
+				return nullptr;
+			}
+			if (std::find(buffers.begin(), buffers.end(), buffer) != buffers.end()) {
+				throwDataCloneError(isolate, "An ArrayBuffer is in the transfer list more than once");
+				return nullptr;
+			}
+			serializer.TransferArrayBuffer((uint32_t) buffers.size(), buffer);
+			buffers.push_back(buffer);
+		}
+	}
+
+	serializer.WriteHeader();
+	if (!serializer.WriteValue(context, value).FromMaybe(false)) {
+		return nullptr;
+	}
+
+	BGJSWorkerMessage* message = new BGJSWorkerMessage();
+	std::pair<uint8_t*, size_t> data = serializer.Release();
+	message->_data = data.first;
+	message->_length = data.second;
+	// the contents were allocated by a BGJSArrayBufferAllocator, whose buffers can be freed with free()
+	for (auto &buffer : buffers) {
+		ArrayBuffer::Contents contents = buffer->Externalize();
+		buffer->Neuter();
+		message->_buffers.push_back(std::make_pair(contents.Data(), contents.ByteLength()));
+	}
+	return message;
+}
+
+MaybeLocal<Value> BGJSWorkerMessage::read(Isolate* isolate, Local<Context> context) {
+	EscapableHandleScope scope(isolate);
+	ValueDeserializer deserializer(isolate, _data, _length);
+	if (!deserializer.ReadHeader(context).FromMaybe(false)) {
+		return MaybeLocal<Value>();
+	}
+	for (size_t i = 0; i < _buffers.size(); i++) {
+		Local<ArrayBuffer> buffer = ArrayBuffer::New(isolate, _buffers[i].first, _buffers[i].second,
+													 ArrayBufferCreationMode::kInternalized);
+		deserializer.TransferArrayBuffer((uint32_t) i, buffer);
+	}
+	// the isolate owns the contents now, even if reading fails
+	_buffers.clear();
+
+	Local<Value> value;
+	if (!deserializer.ReadValue(context).ToLocal(&value)) {
+		return MaybeLocal<Value>();
+	}
+	return scope.Escape(value);
+}
+
+BGJSWorkerMessage::~BGJSWorkerMessage() {
+	free(_data);
+	for (auto &buffer : _buffers) {
+		free(buffer.first);
+	}
+}
+
+//-----------------------------------------------------------
+// Worker
+//-----------------------------------------------------------
+
+BGJSWorker::BGJSWorker(BGJSV8Engine* engine, const std::string& path) :
+		_engine(engine), _path(path), _refCount(1), _isolate(nullptr), _closing(false), _scheduled(false),
+		_terminated(false) {
+	std::lock_guard<std::mutex> lock(registryMutex);
+	registry.push_back(this);
+}
+
+BGJSWorker::~BGJSWorker() {
+	for (auto message : _inbox) {
+		delete message;
+	}
+	std::lock_guard<std::mutex> lock(registryMutex);
+	registry.erase(std::find(registry.begin(), registry.end(), this));
+}
+
+void BGJSWorker::retain() {
+	_refCount++;
+}
+
+void BGJSWorker::release() {
+	if (--_refCount == 0) {
+		delete this;
+	}
+}
+
+void BGJSWorker::terminate() {
+	// the Worker object lets go of the worker; its isolate is disposed of by the pool
+	_object.Reset();
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_terminated) {
+			return;
+		}
+		_terminated = true;
+		if (_isolate) {
+			_isolate->TerminateExecution();
+		}
+		for (auto message : _inbox) {
+			delete message;
+		}
+		_inbox.clear();
+		if (!_scheduled) {
+			_scheduled = true;
+			schedule(this);
+		}
+	}
+	this->release();
+}
+
+void BGJSWorker::terminateAll(BGJSV8Engine* engine) {
+	std::vector<BGJSWorker*> workers;
+	{
+		std::lock_guard<std::mutex> lock(registryMutex);
+		for (auto worker : registry) {
+			if (worker->_engine != engine) {
+				continue;
+			}
+			if (!worker->_object.IsEmpty()) {
+				workers.push_back(worker);
+			} else {
+				// closed itself and its object is gone; it is only kept by the pool or by deliveries
+				std::lock_guard<std::mutex> workerLock(worker->_mutex);
+				worker->_terminated = true;
+				if (worker->_isolate) {
+					worker->_isolate->TerminateExecution();
+				}
+			}
+		}
+	}
+	for (auto worker : workers) {
+		worker->_object.ClearWeak();
+		worker->terminate();
+	}
+
+	// a turn that is running can still be loading a script with the engine, or be about to post to it
+	{
+		std::unique_lock<std::mutex> lock(registryMutex);
+		turnsCondition.wait(lock, [engine] { return runningTurns.find(engine) == runningTurns.end(); });
+	}
+
+	// deliveries that the js thread will never get to hold references to their workers
+	for (void* data : engine->cancelJSThreadTasks(deliverMessage)) {
+		WorkerMessageTask* task = (WorkerMessageTask*) data;
+		delete task->message;
+		task->worker->release();
+		delete task;
+	}
+	for (void* data : engine->cancelJSThreadTasks(deliverError)) {
+		WorkerErrorTask* task = (WorkerErrorTask*) data;
+		task->worker->release();
+		delete task;
+	}
+	for (void* data : engine->cancelJSThreadTasks(deliverClosed)) {
+		((BGJSWorker*) data)->release();
+	}
+}
+
+void BGJSWorker::post(BGJSWorkerMessage* message) {
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_terminated || _closing) {
+		delete message;
+		return;
+	}
+	_inbox.push_back(message);
+	if (!_scheduled) {
+		_scheduled = true;
+		schedule(this);
+	}
+}
+
+void BGJSWorker::schedule(BGJSWorker* worker) {
+	// the run queue holds a reference until the turn is over
+	worker->retain();
+	std::lock_guard<std::mutex> lock(poolMutex);
+	if (!poolStarted) {
+		const int threads = std::max(1, std::min((int) std::thread::hardware_concurrency() - 1, BGJS_WORKER_MAX_THREADS));
+		for (int i = 0; i < threads; i++) {
+			std::thread(BGJSWorker::poolThread).detach();
+		}
+		poolStarted = true;
+	}
+	runQueue.push_back(worker);
+	poolCondition.notify_one();
+}
+
+void BGJSWorker::poolThread() {
+	for (;;) {
+		BGJSWorker* worker;
+		{
+			std::unique_lock<std::mutex> lock(poolMutex);
+			poolCondition.wait(lock, [] { return !runQueue.empty(); });
+			worker = runQueue.front();
+			runQueue.pop_front();
+		}
+		worker->run();
+	}
+}
+
+void BGJSWorker::run() {
+	// the worker can be gone at the end of the turn
+	BGJSV8Engine* engine = _engine;
+	{
+		std::lock_guard<std::mutex> lock(registryMutex);
+		runningTurns[engine]++;
+	}
+	this->turn();
+
+	std::lock_guard<std::mutex> lock(registryMutex);
+	auto it = runningTurns.find(engine);
+	if (--it->second == 0) {
+		runningTurns.erase(it);
+		turnsCondition.notify_all();
+	}
+}
+
+void BGJSWorker::turn() {
+	bool stopped;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		stopped = _terminated;
+	}
+
+	if (!stopped && !_isolate) {
+		// workers share one allocator; its buffers come from the same pool as those of the engines
+		static ArrayBuffer::Allocator* allocator = new BGJSArrayBufferAllocator();
+		Isolate::CreateParams params;
+		params.array_buffer_allocator = allocator;
+		Isolate* isolate = Isolate::New(params);
+		isolate->SetData(BGJS_WORKER_ISOLATE_SLOT, this);
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		_isolate = isolate;
+		stopped = _terminated;
+	}
+
+	if (!stopped) {
+		Locker locker(_isolate);
+		Isolate::Scope isolateScope(_isolate);
+		HandleScope scope(_isolate);
+
+		if (_context.IsEmpty()) {
+			this->start(_isolate);
+		} else {
+			Local<Context> context = Local<Context>::New(_isolate, _context);
+			Context::Scope contextScope(context);
+			Local<String> onmessage = String::NewFromUtf8(_isolate, "onmessage");
+			Local<String> dataName = String::NewFromUtf8(_isolate, "data");
+
+			for (int i = 0; i < BGJS_WORKER_MESSAGES_PER_TURN && !_closing; i++) {
+				BGJSWorkerMessage* message;
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					if (_terminated || _inbox.empty()) {
+						break;
+					}
+					message = _inbox.front();
+					_inbox.pop_front();
+				}
+
+				HandleScope messageScope(_isolate);
+				TryCatch tryCatch(_isolate);
+				Local<Value> value, handler;
+				if (message->read(_isolate, context).ToLocal(&value) &&
+					context->Global()->Get(context, onmessage).ToLocal(&handler) && handler->IsFunction()) {
+					Local<Object> event = Object::New(_isolate);
+					event->Set(dataName, value);
+					Local<Value> argv[] = { event };
+					handler.As<Function>()->Call(context, context->Global(), 1, argv);
+				}
+				delete message;
+				if (tryCatch.HasCaught()) {
+					this->reportException(_isolate, &tryCatch);
+				}
+			}
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		stopped = _terminated || _closing;
+	}
+	if (stopped) {
+		this->dispose();
+	}
+
+	bool again = false;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_terminated && !_closing && !_inbox.empty()) {
+			again = true;
+		} else {
+			_scheduled = false;
+		}
+	}
+	if (again) {
+		// behind the workers that have been waiting
+		std::lock_guard<std::mutex> lock(poolMutex);
+		runQueue.push_back(this);
+		poolCondition.notify_one();
+		return;
+	}
+	this->release();
+}
+
+bool BGJSWorker::start(Isolate* isolate) {
+	// the scope has postMessage, close, importScripts and console; it shares nothing with the engine
+	Local<ObjectTemplate> global = ObjectTemplate::New(isolate);
+	global->Set(String::NewFromUtf8(isolate, "postMessage"), FunctionTemplate::New(isolate, js_self_postMessage));
+	global->Set(String::NewFromUtf8(isolate, "close"), FunctionTemplate::New(isolate, js_self_close));
+	global->Set(String::NewFromUtf8(isolate, "importScripts"), FunctionTemplate::New(isolate, js_self_importScripts));
+
+	Local<ObjectTemplate> console = ObjectTemplate::New(isolate);
+	const char* names[] = { "log", "info", "debug", "warn", "error" };
+	const int levels[] = { LOG_INFO, LOG_INFO, LOG_DEBUG, LOG_ERROR, LOG_ERROR };
+	for (int i = 0; i < 5; i++) {
+		console->Set(String::NewFromUtf8(isolate, names[i]),
+					 FunctionTemplate::New(isolate, js_self_log, Integer::New(isolate, levels[i])));
+	}
+	global->Set(String::NewFromUtf8(isolate, "console"), console);
+
+	Local<Context> context = Context::New(isolate, nullptr, global);
+	_context.Reset(isolate, context);
+	Context::Scope contextScope(context);
+	context->Global()->Set(String::NewFromUtf8(isolate, "self"), context->Global());
+
+	TryCatch tryCatch(isolate);
+	if (!this->runScript(isolate, context, _path.c_str())) {
+		this->reportException(isolate, &tryCatch);
+		return false;
+	}
+	return true;
+}
+
+bool BGJSWorker::runScript(Isolate* isolate, Local<Context> context, const char* path) {
+	unsigned int length = 0;
+	char* buf;
+	{
+		// terminateAll waits for the turn, but the engine must not be used once it began
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_terminated) {
+			return false;
+		}
+		buf = _engine->loadFile(path, &length);
+	}
+	if (!buf) {
+		isolate->ThrowException(Exception::Error(String::NewFromUtf8(isolate, (std::string("Cannot load worker script ") + path).c_str())));
+		return false;
+	}
+	Local<String> source = String::NewFromUtf8(isolate, buf, NewStringType::kNormal, (int) length).ToLocalChecked();
+	free(buf);
+
+	ScriptOrigin origin(String::NewFromUtf8(isolate, path));
+	Local<Script> script;
+	if (!Script::Compile(context, source, &origin).ToLocal(&script)) {
+		return false;
+	}
+	return !script->Run(context).IsEmpty();
+}
+
+void BGJSWorker::dispose() {
+	Isolate* isolate;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		isolate = _isolate;
+		_isolate = nullptr;
+	}
+	if (isolate) {
+		{
+			Locker locker(isolate);
+			Isolate::Scope isolateScope(isolate);
+			_context.Reset();
+		}
+		isolate->Dispose();
+	}
+}
+
+void BGJSWorker::reportException(Isolate* isolate, TryCatch* tryCatch) {
+	if (tryCatch->HasTerminated()) {
+		return;
+	}
+	WorkerErrorTask* task = new WorkerErrorTask();
+	task->worker = this;
+	task->message = JNIV8Marshalling::v8string2string(tryCatch->Exception());
+	task->lineNumber = 0;
+	Local<Message> message = tryCatch->Message();
+	if (!message.IsEmpty()) {
+		task->fileName = JNIV8Marshalling::v8string2string(message->GetScriptResourceName());
+		task->lineNumber = message->GetLineNumber(isolate->GetCurrentContext()).FromMaybe(0);
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_terminated) {
+		delete task;
+		return;
+	}
+	this->retain();
+	_engine->runOnJSThread(deliverError, task);
+}
+
+//-----------------------------------------------------------
+// Delivery on the js thread of the engine
+//-----------------------------------------------------------
+
+void BGJSWorker::deliverMessage(BGJSV8Engine* engine, void* data) {
+	WorkerMessageTask* task = (WorkerMessageTask*) data;
+	BGJSWorker* worker = task->worker;
+	if (!worker->_object.IsEmpty()) {
+		Isolate* isolate = engine->getIsolate();
+		HandleScope scope(isolate);
+		Local<Context> context = isolate->GetCurrentContext();
+		Local<Object> self = Local<Object>::New(isolate, worker->_object);
+
+		TryCatch trycatch(isolate);
+		Local<Value> value, handler;
+		if (task->message->read(isolate, context).ToLocal(&value) &&
+			self->Get(context, String::NewFromUtf8(isolate, "onmessage")).ToLocal(&handler) && handler->IsFunction()) {
+			Local<Object> event = Object::New(isolate);
+			event->Set(String::NewFromUtf8(isolate, "data"), value);
+			event->Set(String::NewFromUtf8(isolate, "target"), self);
+			Local<Value> argv[] = { event };
+			handler.As<Function>()->Call(context, self, 1, argv);
+		}
+		if (trycatch.HasCaught()) {
+			Local<Value> stackTrace;
+			if (!trycatch.StackTrace(context).ToLocal(&stackTrace)) {
+				stackTrace = trycatch.Exception();
+			}
+			LOGE("Uncaught exception in worker onmessage handler: %s", JNIV8Marshalling::v8string2string(stackTrace).c_str());
+		}
+	}
+	delete task->message;
+	delete task;
+	worker->release();
+}
+
+void BGJSWorker::deliverError(BGJSV8Engine* engine, void* data) {
+	WorkerErrorTask* task = (WorkerErrorTask*) data;
+	BGJSWorker* worker = task->worker;
+
+	bool handled = false;
+	if (!worker->_object.IsEmpty()) {
+		Isolate* isolate = engine->getIsolate();
+		HandleScope scope(isolate);
+		Local<Context> context = isolate->GetCurrentContext();
+		Local<Object> self = Local<Object>::New(isolate, worker->_object);
+
+		Local<Value> handler;
+		if (self->Get(context, String::NewFromUtf8(isolate, "onerror")).ToLocal(&handler) && handler->IsFunction()) {
+			Local<Object> event = Object::New(isolate);
+			event->Set(String::NewFromUtf8(isolate, "message"), String::NewFromUtf8(isolate, task->message.c_str()));
+			event->Set(String::NewFromUtf8(isolate, "filename"), String::NewFromUtf8(isolate, task->fileName.c_str()));
+			event->Set(String::NewFromUtf8(isolate, "lineno"), Integer::New(isolate, task->lineNumber));
+			event->Set(String::NewFromUtf8(isolate, "target"), self);
+
+			TryCatch trycatch(isolate);
+			Local<Value> argv[] = { event };
+			handler.As<Function>()->Call(context, self, 1, argv);
+			if (trycatch.HasCaught()) {
+				LOGE("Uncaught exception in worker onerror handler: %s",
+					 JNIV8Marshalling::v8string2string(trycatch.Exception()).c_str());
+			}
+			handled = true;
+		}
+	}
+	if (!handled) {
+		LOGE("Uncaught exception in worker %s: %s (%s:%d)", worker->_path.c_str(), task->message.c_str(),
+			 task->fileName.c_str(), task->lineNumber);
+	}
+	delete task;
+	worker->release();
+}
+
+void BGJSWorker::deliverClosed(BGJSV8Engine* engine, void* data) {
+	// the Worker object is not needed to keep the worker alive anymore
+	BGJSWorker* worker = (BGJSWorker*) data;
+	if (!worker->_object.IsEmpty()) {
+		worker->_object.SetWeak(worker, weakCallback, WeakCallbackType::kParameter);
+	}
+	worker->release();
+}
+
+void BGJSWorker::weakCallback(const WeakCallbackInfo<BGJSWorker>& info) {
+	// only workers that closed themselves are weak, so there is nothing left to stop
+	BGJSWorker* worker = info.GetParameter();
+	worker->_object.Reset();
+	worker->release();
+}
+
+//-----------------------------------------------------------
+// Worker objects of the engine
+//-----------------------------------------------------------
+
+Local<FunctionTemplate> BGJSWorker::createTemplate(Isolate* isolate) {
+	EscapableHandleScope scope(isolate);
+	Local<FunctionTemplate> ft = FunctionTemplate::New(isolate, js_worker_constructor);
+	ft->SetClassName(String::NewFromUtf8(isolate, "Worker"));
+	ft->InstanceTemplate()->SetInternalFieldCount(1);
+	Local<ObjectTemplate> proto = ft->PrototypeTemplate();
+	proto->Set(String::NewFromUtf8(isolate, "postMessage"), FunctionTemplate::New(isolate, js_worker_postMessage));
+	proto->Set(String::NewFromUtf8(isolate, "terminate"), FunctionTemplate::New(isolate, js_worker_terminate));
+	return scope.Escape(ft);
+}
+
+void BGJSWorker::js_worker_constructor(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	BGJS_ASSERT_LOCKED(isolate)
+	if (!args.IsConstructCall()) {
+		isolate->ThrowException(Exception::TypeError(String::NewFromUtf8(isolate, "Worker has to be called with new")));
+		return;
+	}
+	if (args.Length() < 1 || !args[0]->IsString()) {
+		isolate->ThrowException(Exception::TypeError(String::NewFromUtf8(isolate, "Worker requires the path of a script")));
+		return;
+	}
+
+	BGJSWorker* worker = new BGJSWorker(BGJSV8Engine::GetInstance(isolate),
+										JNIV8Marshalling::v8string2string(args[0]));
+	// workers are kept alive by their object until they are terminated or close themselves, like those of browsers
+	args.This()->SetAlignedPointerInInternalField(0, worker);
+	worker->_object.Reset(isolate, args.This());
+
+	// the first turn starts the isolate and runs the script
+	std::lock_guard<std::mutex> lock(worker->_mutex);
+	worker->_scheduled = true;
+	schedule(worker);
+}
+
+void BGJSWorker::js_worker_postMessage(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	BGJS_ASSERT_LOCKED(isolate)
+	if (args.This()->InternalFieldCount() < 1) {
+		return;
+	}
+	BGJSWorker* worker = (BGJSWorker*) args.This()->GetAlignedPointerFromInternalField(0);
+	if (worker->_object.IsEmpty()) {
+		// terminated; messages to it are dropped
+		return;
+	}
+	BGJSWorkerMessage* message = BGJSWorkerMessage::write(isolate, isolate->GetCurrentContext(), args[0],
+														   args.Length() > 1 ? args[1] : Local<Value>());
+	if (message) {
+		worker->post(message);
+	}
+}
+
+void BGJSWorker::js_worker_terminate(const FunctionCallbackInfo<Value>& args) {
+	BGJS_ASSERT_LOCKED(args.GetIsolate())
+	if (args.This()->InternalFieldCount() < 1) {
+		return;
+	}
+	BGJSWorker* worker = (BGJSWorker*) args.This()->GetAlignedPointerFromInternalField(0);
+	if (!worker->_object.IsEmpty()) {
+		worker->terminate();
+	}
+}
+
+//-----------------------------------------------------------
+// Worker scope
+//-----------------------------------------------------------
+
+void BGJSWorker::js_self_postMessage(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	BGJSWorker* worker = (BGJSWorker*) isolate->GetData(BGJS_WORKER_ISOLATE_SLOT);
+	BGJSWorkerMessage* message = BGJSWorkerMessage::write(isolate, isolate->GetCurrentContext(), args[0],
+														   args.Length() > 1 ? args[1] : Local<Value>());
+	if (!message) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(worker->_mutex);
+	if (worker->_terminated) {
+		delete message;
+		return;
+	}
+	worker->retain();
+	worker->_engine->runOnJSThread(deliverMessage, new WorkerMessageTask { worker, message });
+}
+
+void BGJSWorker::js_self_close(const FunctionCallbackInfo<Value>& args) {
+	// the running script finishes, queued messages are dropped
+	Isolate* isolate = args.GetIsolate();
+	BGJSWorker* worker = (BGJSWorker*) isolate->GetData(BGJS_WORKER_ISOLATE_SLOT);
+	std::lock_guard<std::mutex> lock(worker->_mutex);
+	if (worker->_closing) {
+		return;
+	}
+	worker->_closing = true;
+	for (auto message : worker->_inbox) {
+		delete message;
+	}
+	worker->_inbox.clear();
+	if (!worker->_terminated) {
+		worker->retain();
+		worker->_engine->runOnJSThread(deliverClosed, worker);
+	}
+}
+
+void BGJSWorker::js_self_importScripts(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	BGJSWorker* worker = (BGJSWorker*) isolate->GetData(BGJS_WORKER_ISOLATE_SLOT);
+	Local<Context> context = isolate->GetCurrentContext();
+	for (int i = 0; i < args.Length(); i++) {
+		if (!worker->runScript(isolate, context, JNIV8Marshalling::v8string2string(args[i]).c_str())) {
+			return;
+		}
+	}
+}
+
+void BGJSWorker::js_self_log(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	BGJSWorker* worker = (BGJSWorker*) isolate->GetData(BGJS_WORKER_ISOLATE_SLOT);
+	std::stringstream str;
+	for (int i = 0; i < args.Length(); i++) {
+		String::Utf8Value utf8(isolate, args[i]);
+		str << " " << (*utf8 ? *utf8 : "<string conversion failed>");
+	}
+	LOG(args.Data().As<Integer>()->Value(), "[%s]%s", worker->_path.c_str(), str.str().c_str());
+}
@@ -0,0 +1,111 @@
+#ifndef __BGJSWORKER_H
+#define __BGJSWORKER_H	1
+
+#include <v8.h>
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * BGJSWorker
+ * Web Workers: scripts that run in isolates of their own on a pool of threads, so the js of an engine can use more than
+ * one core. Messages are structured clones written with v8::ValueSerializer; array buffers in the transfer list are
+ * moved to the receiver without copying their contents.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSV8Engine;
+
+/**
+ * a value serialized in one isolate for deserializing in another
+ * the contents of transferred array buffers travel with it, and are freed with it unless they were received
+ */
+class BGJSWorkerMessage {
+public:
+	// clones value, moving the array buffers in transfer; NULL with a DataCloneError thrown if it can not be cloned
+	static BGJSWorkerMessage* write(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value,
+									v8::Local<v8::Value> transfer);
+	// the cloned value; the transferred buffers belong to the isolate of context afterwards
+	v8::MaybeLocal<v8::Value> read(v8::Isolate* isolate, v8::Local<v8::Context> context);
+
+	const uint8_t* data() const { return _data; }
+	size_t length() const { return _length; }
+
+	~BGJSWorkerMessage();
+
+private:
+	BGJSWorkerMessage() : _data(nullptr), _length(0) {}
+
+	uint8_t* _data;
+	size_t _length;
+	std::vector<std::pair<void*, size_t>> _buffers;
+};
+
+class BGJSWorker {
+public:
+	// the Worker constructor of the global object of engines
+	static v8::Local<v8::FunctionTemplate> createTemplate(v8::Isolate* isolate);
+	// terminates the workers of engine and waits for their turns on the pool to end; called before it is destroyed
+	static void terminateAll(BGJSV8Engine* engine);
+
+	static void js_worker_constructor(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_worker_postMessage(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_worker_terminate(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+private:
+	BGJSWorker(BGJSV8Engine* engine, const std::string& path);
+	~BGJSWorker();
+
+	void retain();
+	void release();
+	void terminate();
+
+	// queues a message for the worker and wakes the pool; takes ownership of message
+	void post(BGJSWorkerMessage* message);
+	// runs a turn of the worker on a pool thread, counted in the running turns of its engine
+	void run();
+	// starts its isolate, handles queued messages, or disposes of it
+	void turn();
+	bool start(v8::Isolate* isolate);
+	void dispose();
+	void reportException(v8::Isolate* isolate, v8::TryCatch* tryCatch);
+
+	static void schedule(BGJSWorker* worker);
+	static void poolThread();
+
+	// delivered to the Worker object on the js thread of the engine
+	static void deliverMessage(BGJSV8Engine* engine, void* data);
+	static void deliverError(BGJSV8Engine* engine, void* data);
+	static void deliverClosed(BGJSV8Engine* engine, void* data);
+	static void weakCallback(const v8::WeakCallbackInfo<BGJSWorker>& info);
+
+	// globals of the worker scope
+	static void js_self_postMessage(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_self_close(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_self_importScripts(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_self_log(const v8::FunctionCallbackInfo<v8::Value>& args);
+	bool runScript(v8::Isolate* isolate, v8::Local<v8::Context> context, const char* path);
+
+	BGJSV8Engine* _engine;
+	std::string _path;
+	std::atomic<int> _refCount;
+
+	// owned by the js thread of the engine
+	v8::Global<v8::Object> _object;
+
+	// owned by the pool thread that runs the worker
+	v8::Global<v8::Context> _context;
+
+	std::mutex _mutex;
+	v8::Isolate* _isolate;	// set and cleared by the pool thread, terminated by others
+	bool _closing;			// the worker called close()
+	std::deque<BGJSWorkerMessage*> _inbox;
+	bool _scheduled;		// in the run queue of the pool, or running
+	bool _terminated;
+};
+
+#endif
@@ -22,7 +22,9 @@
 
 #include "BGJSV8Engine.h"
 #include "modules/BGJSGLModule.h"
+#include "modules/BGJSMessagePackModule.h"
 #include "BGJSGLView.h"
+#include "BGJSGlyphRasterizer.h"
 
 #include "jniext.h"
 #include "../jni/JNIWrapper.h"
@@ -47,6 +49,9 @@ jint JNI_OnLoad(JavaVM* vm, void* reserved)  {
 
 		JNIWrapper::registerObject<BGJSV8Engine>();
         JNIV8Wrapper::registerObject<BGJSGLView>();
+
+        BGJSGlyphRasterizer::initJNICache();
+        EJGlyphRasterizer::setShared(new BGJSGlyphRasterizer());
     }
 
     return JNI_VERSION_1_6;
@@ -54,7 +59,8 @@ jint JNI_OnLoad(JavaVM* vm, void* reserved)  {
 
 JNIEXPORT void JNICALL Java_ag_boersego_bgjs_ClientAndroid_initialize(
 		JNIEnv * env, jobject obj, jobject assetManager, jobject v8Engine, jstring locale, jstring lang,
-        jstring timezone, jfloat density, jstring deviceClass, jboolean debug, jboolean isStoreBuild, jint maxHeapSize) {
+        jstring timezone, jfloat density, jstring deviceClass, jboolean debug, jboolean isStoreBuild, jint maxHeapSize,
+        jstring codeCachePath, jstring snapshotPath) {
 
 	auto ct = JNIV8Wrapper::wrapObject<BGJSV8Engine>(v8Engine);
 	ct->setAssetManager(assetManager);
@@ -68,6 +74,12 @@ JNIEXPORT void JNICALL Java_ag_boersego_bgjs_ClientAndroid_initialize(
 	ct->setDebug(debug);
     ct->setIsStoreBuild(isStoreBuild);
 	ct->setMaxHeapSize(maxHeapSize);
+	if (codeCachePath) {
+		ct->setCodeCachePath(JNIWrapper::jstring2string(codeCachePath).c_str());
+	}
+	if (snapshotPath) {
+		ct->setSnapshotPath(JNIWrapper::jstring2string(snapshotPath).c_str());
+	}
 	env->ReleaseStringUTFChars(locale, localeStr);
 	env->ReleaseStringUTFChars(lang, langStr);
 	env->ReleaseStringUTFChars(timezone, tzStr);
@@ -77,53 +89,6 @@ JNIEXPORT void JNICALL Java_ag_boersego_bgjs_ClientAndroid_initialize(
 	LOGD("BGJS context created");
 
 	ct->registerModule("canvas", BGJSGLModule::doRequire);
+	ct->registerModule("msgpack", BGJSMessagePackModule::doRequire);
 	LOGD("ClientAndroid init: registerModule done");
 }
-
-JNIEXPORT void JNICALL Java_ag_boersego_bgjs_ClientAndroid_timeoutCB(
-		JNIEnv * env, jobject obj, jobject engine, jlong jsCbPtr, jlong thisPtr, jboolean cleanup, jboolean runCb) {
-	auto context = JNIWrapper::wrapObject<BGJSV8Engine>(engine);
-    v8::Isolate* isolate = context->getIsolate();
-    v8::Locker l (isolate);
-	Isolate::Scope isolateScope(isolate);
-	if (DEBUG) {
-		LOGD("clientAndroid timeoutCB");
-	}
-	HandleScope scope (isolate);
-	Context::Scope context_scope(context->getContext());
-
-	TryCatch trycatch(isolate);
-
-	// Persistent<Function>* callbackPers = (Persistent<Function>*) jsCbPtr;
-	WrapPersistentObj* wo = (WrapPersistentObj*)thisPtr;
-	Local<Object> thisObj = (*reinterpret_cast<Local<Object>*>(&wo->obj));
-	WrapPersistentFunc* ws = (WrapPersistentFunc*)jsCbPtr;
-	Local<Function> callbackP = Local<Function>::New(isolate, *reinterpret_cast<Local<Function>*>(&ws->callbackFunc));
-
-
-	if (runCb) {
-		int argcount = 0;
-		Handle<Value> argarray[] = { };
-
-		Handle<Value> result = callbackP->Call(thisObj, argcount, argarray);
-		if (result.IsEmpty()) {
-			context->forwardV8ExceptionToJNI(&trycatch);
-		}
-		if (DEBUG) {
-			LOGI("timeoutCb finished");
-		}
-	}
-
-	if (cleanup) {
-		if (DEBUG) {
-			LOGI("timeoutCb cleaning up");
-		}
-		BGJS_CLEAR_PERSISTENT(wo->obj)
-		delete(wo);
-		BGJS_CLEAR_PERSISTENT(ws->callbackFunc)
-		delete(ws);
-	}
-}
-
-
-
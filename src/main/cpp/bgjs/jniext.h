@@ -13,12 +13,11 @@ extern "C" {
 	// ClientAndroid
 	JNIEXPORT void JNICALL Java_ag_boersego_bgjs_ClientAndroid_initialize(
 			JNIEnv * env, jobject obj, jobject assetManager, jobject v8Engine, jstring locale, jstring lang,
-            jstring timezone, float density, jstring deviceClass, jboolean debug, jboolean isStoreBuild, jint maxHeapSizeInMb);
+            jstring timezone, float density, jstring deviceClass, jboolean debug, jboolean isStoreBuild, jint maxHeapSizeInMb,
+            jstring codeCachePath, jstring snapshotPath);
 	JNIEXPORT bool JNICALL Java_ag_boersego_bgjs_ClientAndroid_ajaxDone(
 		JNIEnv * env, jobject obj, jobject engine, jstring dataStr, jint responseCode,
 		jlong jsCbPtr, jlong thisPtr, jlong errorCb, jboolean success, jboolean processData);
-	JNIEXPORT void JNICALL Java_ag_boersego_bgjs_ClientAndroid_timeoutCB(
-			JNIEnv * env, jobject obj, jobject engine, jlong jsCbPtr, jlong thisPtr, jboolean cleanup, jboolean runCb);
 	JNIEXPORT void JNICALL Java_ag_boersego_bgjs_ClientAndroid_runCBBoolean (JNIEnv * env, jobject obj, jobject engine, jlong cbPtr, jlong thisPtr, jboolean b);
 
 	// BGJSGLModule
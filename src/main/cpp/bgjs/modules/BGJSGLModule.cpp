@@ -2,6 +2,8 @@
 
 #include "../BGJSV8Engine.h"
 #include "../BGJSGLView.h"
+#include "../BGJSTrace.h"
+#include "../BGJSCanvasCommands.h"
 
 #include "v8.h"
 #include "../ejecta/EJConvert.h"
@@ -12,7 +14,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
-#include <android/bitmap.h>
+#include <algorithm>
+#include <vector>
+#include <string>
 #include <EJCanvasTypes.h>
 
 #include "../jniext.h"
@@ -24,6 +28,9 @@
 
 #define LOG_TAG "BGJSGLModule"
 
+// floats of commands a recording may grow to, 16 MB; a script that never stops recording must not take all memory
+#define BGJS_CANVAS_MAX_RECORDING (4 * 1024 * 1024)
+
 using namespace v8;
 
 /**
@@ -41,16 +48,22 @@ EscapableHandleScope scope(isolate);
 #define CREATE_UNESCAPABLE_CONTEXT   	v8::Isolate* isolate = Isolate::GetCurrent(); \
 HandleScope scope(isolate);
 
-// Fetch the canvascontext from the context2d function in a FunctionTemplate
-#define CONTEXT_FETCH_BASE v8::Locker l(isolate); \
+// Fetch the canvascontext from the context2d function in a FunctionTemplate, and trace the call.
+// The context of a pipelined view belongs to its render thread; __deferred calls only record their commands for it
+#define CONTEXT_FETCH_BASE BGJS_ASSERT_LOCKED(isolate) \
+BGJSTraceScope __trace(__func__); \
 if (!args.This()->IsObject()) { \
 	LOGE("context method '%s' got no this object", __PRETTY_FUNCTION__);  \
 	isolate->ThrowException(v8::Exception::ReferenceError(v8::String::NewFromUtf8(isolate, "Can't run as static function"))); \
 } \
-BGJSCanvasContext *__context = BGJSClass::externalToClassPtr<BGJSV8Engine2dGL>(args.This()->ToObject(isolate)->GetInternalField(0))->context; \
-if (!__context->_isRendering) { \
+BGJSV8Engine2dGL *__context2d = static_cast<BGJSV8Engine2dGL*>(args.This()->ToObject(isolate)->GetAlignedPointerFromInternalField(0)); \
+BGJSCanvasContext *__context = __context2d->context; \
+const bool __deferred = pipelinedCommands(__context2d) != nullptr; \
+if (!__deferred && !__context->_isRendering) { \
 	LOGI("Context is not in rendering phase in method '%s'", __PRETTY_FUNCTION__); \
 	isolate->ThrowException(v8::Exception::ReferenceError(v8::String::NewFromUtf8(isolate, "Can't run when not in rendering phase"))); \
+} else if (!__deferred && __context2d->view) { \
+	__context2d->view->useContext(__context); \
 }
 
 
@@ -60,6 +73,12 @@ CONTEXT_FETCH_BASE
 #define CONTEXT_FETCH()  CREATE_UNESCAPABLE_CONTEXT \
 CONTEXT_FETCH_BASE
 
+// Bail from calls that need the gl context right away, which a pipelined view only has on its render thread
+#define REQUIRE_IMMEDIATE()	if (__deferred) { \
+	isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, "Not available while the view is pipelined"))); \
+	return; \
+}
+
 // Bail if not exactly n parameters were passed
 #define REQUIRE_PARAMS(n)		if (args.Length() != n) { \
 	LOGI("Context method '%s' requires %i parameters", __PRETTY_FUNCTION__, n); \
@@ -68,30 +87,86 @@ CONTEXT_FETCH_BASE
 
 // Fetch the canvascontext from the context2d function for Accessors
 #define CONTEXT_FETCH_VAR               v8::Isolate* isolate = Isolate::GetCurrent(); \
-v8::Locker l(isolate); \
+BGJS_ASSERT_LOCKED(isolate) \
 HandleScope scope(isolate); \
 Local<Object> self = info.Holder(); \
-Local<External> wrap = Local<External>::Cast(self->GetInternalField(0)); \
-void* ptr = wrap->Value(); \
-BGJSCanvasContext *__context = static_cast<BGJSV8Engine2dGL*>(ptr)->context;
+void* ptr = self->GetAlignedPointerFromInternalField(0); \
+BGJSV8Engine2dGL *__context2d = static_cast<BGJSV8Engine2dGL*>(ptr); \
+BGJSCanvasContext *__context = __context2d->context; \
+const bool __deferred = pipelinedCommands(__context2d) != nullptr; \
+EJCanvasState *__state = __deferred ? __context2d->view->pipelinedState() : __context->state;
 
 #define CONTEXT_FETCH_VAR_ESCAPABLE       v8::Isolate* isolate = Isolate::GetCurrent(); \
-v8::Locker l(isolate); \
+BGJS_ASSERT_LOCKED(isolate) \
 EscapableHandleScope scope(isolate); \
 Local<Object> self = info.Holder(); \
-Local<External> wrap = Local<External>::Cast(self->GetInternalField(0)); \
-void* ptr = wrap->Value(); \
-BGJSCanvasContext *__context = static_cast<BGJSV8Engine2dGL*>(ptr)->context;
+void* ptr = self->GetAlignedPointerFromInternalField(0); \
+BGJSV8Engine2dGL *__context2d = static_cast<BGJSV8Engine2dGL*>(ptr); \
+BGJSCanvasContext *__context = __context2d->context; \
+const bool __deferred = pipelinedCommands(__context2d) != nullptr; \
+EJCanvasState *__state = __deferred ? __context2d->view->pipelinedState() : __context->state;
 
 
 class BGJSV8Engine2dGL {
 public:
 	v8::Persistent<v8::Object> _jsValue;
 	BGJSCanvasContext* context;
+	BGJSGLView* view = nullptr;
+	// fillStyle and strokeStyle strings parsed recently
+	EJColorCache colorCache;
+	// commands drawn since startRecording(), in the format of submit
+	bool isRecording = false;
+	std::vector<float> recording;
+	// why stopRecording refuses the recording, since a call drew something without a command or it grew too large
+	const char* unrecorded = nullptr;
 
     ~BGJSV8Engine2dGL();
 };
 
+// The display list that the context records into for its pipelined view, or null if it draws right away. Offscreen
+// canvases use the gl context of the view, so they can not be drawn into while it is pipelined
+static std::vector<float>* pipelinedCommands(BGJSV8Engine2dGL* context2d) {
+	if (!context2d->view || context2d->context != context2d->view->context2d) {
+		return nullptr;
+	}
+	return context2d->view->pipelinedCommands();
+}
+
+// Marks the recording as one that can not be replayed; the commands recorded after a call without a command of its
+// own would replay with different paint, or leave out what it drew
+static void unrecordable(BGJSV8Engine2dGL* context2d, const char* reason) {
+	if (context2d->isRecording && !context2d->unrecorded) {
+		context2d->unrecorded = reason;
+		std::vector<float>().swap(context2d->recording);
+	}
+}
+
+// Appends commands to the recording of the context while it records, and to the display list of its pipelined view
+static void appendCommands(BGJSV8Engine2dGL* context2d, const float* commands, size_t count) {
+	if (context2d->isRecording && !context2d->unrecorded) {
+		if (context2d->recording.size() + count > BGJS_CANVAS_MAX_RECORDING) {
+			unrecordable(context2d, "it is larger than 16 MB");
+		} else {
+			context2d->recording.insert(context2d->recording.end(), commands, commands + count);
+		}
+	}
+	std::vector<float>* list = pipelinedCommands(context2d);
+	if (list) {
+		list->insert(list->end(), commands, commands + count);
+	}
+}
+
+template <typename... Operands>
+static void recordCommand(BGJSV8Engine2dGL* context2d, BGJSCanvasCommand opcode, Operands... operands) {
+	const float command[] = { (float)opcode, (float)operands... };
+	appendCommands(context2d, command, sizeof(command) / sizeof(float));
+}
+
+static void recordColor(BGJSV8Engine2dGL* context2d, BGJSCanvasCommand opcode, const EJColorRGBA& color) {
+	recordCommand(context2d, opcode, color.components[0], color.components[1], color.components[2],
+				  color.components[3] / 255.0f);
+}
+
 BGJSV8Engine2dGL::~BGJSV8Engine2dGL() {
     if (context) {
         context = nullptr;
@@ -106,6 +181,10 @@ public:
 	JNIRetainedRef<BGJSGLView> _view;
 	const BGJSV8Engine2dGL* _context2d;
 	const BGJSV8Engine* _context;
+	// set for canvases created with createCanvas, which draw into a texture instead of the view
+	BGJSOffscreenCanvasContext* _offscreen = nullptr;
+	// bytes of the framebuffer of an offscreen canvas that were reported to v8
+	int64_t _externalMemory = 0;
 
     ~BGJSCanvasGL();
 
@@ -123,6 +202,19 @@ public:
     			const v8::PropertyCallbackInfo<void>& info);
 };
 
+// Tells v8 how many bytes of native memory an object keeps alive now, so it collects objects that hold textures and
+// pixels sooner than their small size on the heap would make it
+static void reportExternalMemory(Isolate* isolate, int64_t* reported, int64_t bytes) {
+	if (bytes != *reported) {
+		isolate->AdjustAmountOfExternalAllocatedMemory(bytes - *reported);
+		*reported = bytes;
+	}
+}
+
+static int64_t offscreenBytes(BGJSOffscreenCanvasContext* offscreen) {
+	return (int64_t)std::max(offscreen->requestedWidth(), 0) * std::max(offscreen->requestedHeight(), 0) * 4;
+}
+
 /**
  * internal struct for storing information for weak callbacks
  */
@@ -135,34 +227,149 @@ BGJSCanvasGL::~BGJSCanvasGL() {
     if (_context2d) {
         delete _context2d;
     }
+    if (_offscreen) {
+        _view->releaseOffscreenContext(_offscreen);
+    }
 }
 
 v8::Persistent<v8::Function> BGJSGLModule::g_classRefCanvasGL;
 v8::Persistent<v8::Function> BGJSGLModule::g_classRefContext2dGL;
+v8::Persistent<v8::FunctionTemplate> BGJSGLModule::g_templatePath2D;
+v8::Persistent<v8::FunctionTemplate> BGJSGLModule::g_templateImage;
+v8::Persistent<v8::FunctionTemplate> BGJSGLModule::g_templateCanvasGL;
+v8::Persistent<v8::FunctionTemplate> BGJSGLModule::g_templateCanvasGradient;
+v8::Persistent<v8::FunctionTemplate> BGJSGLModule::g_templateCanvasPattern;
+
+/**
+ * CanvasGradient and CanvasPattern
+ * Script objects of paints, created by createLinearGradient, createRadialGradient and createPattern. Each retains its
+ * paint, and so does every state of a context that draws with it; paint->wrapper points back at the holder while the
+ * object is alive, so fillStyle returns the same object it was set to.
+ */
+
+struct PaintCallbackHolder {
+	v8::Persistent<v8::Object> persistent;
+	EJCanvasPaint* paint;
+};
+
+static void js_paint_destruct(const v8::WeakCallbackInfo<void>& data) {
+	PaintCallbackHolder* paintHolder = (PaintCallbackHolder*)data.GetParameter();
+
+	paintHolder->persistent.Reset();
+
+	paintHolder->paint->wrapper = NULL;
+	paintHolder->paint->release();
+	delete paintHolder;
+}
+
+// Returns the paint of a CanvasGradient or CanvasPattern object, or null if value is neither
+static EJCanvasPaint* paintFromValue(Isolate* isolate, Local<Value> value) {
+	if (!value->IsObject() || (!Local<FunctionTemplate>::New(isolate, BGJSGLModule::g_templateCanvasGradient)->HasInstance(value) &&
+			!Local<FunctionTemplate>::New(isolate, BGJSGLModule::g_templateCanvasPattern)->HasInstance(value))) {
+		return NULL;
+	}
+	Local<External> external = Local<External>::Cast(value->ToObject(isolate)->GetInternalField(0));
+	return static_cast<PaintCallbackHolder*>(external->Value())->paint;
+}
+
+// Returns the script object of paint, making a new one if it has none (anymore)
+static Local<Object> paintToValue(Isolate* isolate, EJCanvasPaint* paint) {
+	if (paint->wrapper) {
+		return Local<Object>::New(isolate, static_cast<PaintCallbackHolder*>(paint->wrapper)->persistent);
+	}
+	Local<FunctionTemplate> ft = Local<FunctionTemplate>::New(isolate, paint->type() == kEJPaintPattern ?
+			BGJSGLModule::g_templateCanvasPattern : BGJSGLModule::g_templateCanvasGradient);
+	Local<Object> self = ft->GetFunction()->NewInstance(BGJSV8Engine::GetInstance(isolate)->getContext()).ToLocalChecked();
+
+	PaintCallbackHolder* persistentHolder = new PaintCallbackHolder();
+	paint->retain();
+	paint->wrapper = persistentHolder;
+	persistentHolder->paint = paint;
+	self->SetInternalField(0, External::New(isolate, persistentHolder));
+	persistentHolder->persistent.Reset(isolate, self);
+	persistentHolder->persistent.SetWeak((void*)persistentHolder, js_paint_destruct, WeakCallbackType::kParameter);
+	return self;
+}
+
+static void js_gradient_addColorStop(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	v8::Isolate* isolate = Isolate::GetCurrent();
+	BGJS_ASSERT_LOCKED(isolate)
+	HandleScope scope(isolate);
+	EJCanvasPaint* paint = paintFromValue(isolate, args.This());
+	if (!paint || paint->type() == kEJPaintPattern) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Not a CanvasGradient")));
+		return;
+	}
+	if (args.Length() < 2) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Not enough parameters")));
+		return;
+	}
+	const double offset = Local<Number>::Cast(args[0])->Value();
+	if (!(offset >= 0 && offset <= 1)) {
+		isolate->ThrowException(v8::Exception::RangeError(v8::String::NewFromUtf8(isolate, "Color stop offset has to be between 0 and 1")));
+		return;
+	}
+	paint->addColorStop((float)offset, JSValueToColorRGBA(args[1]));
+	args.GetReturnValue().SetUndefined();
+}
 
 void js_context_get_fillStyle(Local<String> property,
 		const v8::PropertyCallbackInfo<Value>& info) {
 	CONTEXT_FETCH_VAR_ESCAPABLE;
-	info.GetReturnValue().Set(scope.Escape(ColorRGBAToJSValue(isolate, __context->state->fillColor)));
+	if (__state->fillPaint) {
+		info.GetReturnValue().Set(scope.Escape(paintToValue(isolate, __state->fillPaint)));
+		return;
+	}
+	info.GetReturnValue().Set(scope.Escape(ColorRGBAToJSValue(isolate, __state->fillColor)));
 }
 
 void js_context_set_fillStyle(Local<String> property, Local<Value> value,
 		const v8::PropertyCallbackInfo<void>& info) {
 	CONTEXT_FETCH_VAR;
-	__context->state->fillColor = JSValueToColorRGBA(value);
-	 // LOGD(" setFillStyle rgba(%d,%d,%d,%.3f)", __context->state->fillColor.rgba.r, __context->state->fillColor.rgba.g, __context->state->fillColor.rgba.b, (float)__context->state->fillColor.rgba.a/255.0f);
+	EJCanvasPaint* paint = paintFromValue(isolate, value);
+	if (!paint) {
+		__state->fillColor = __context2d->colorCache.get(isolate, value);
+		recordColor(__context2d, kBGJSCommandFillColor, __state->fillColor);
+	} else if (__deferred) {
+		isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, "Gradients and patterns are not available while the view is pipelined")));
+		return;
+	} else {
+		unrecordable(__context2d, "gradients and patterns are not recorded");
+	}
+	// the color command of a display list resets the paint when the render thread replays it
+	if (!__deferred) {
+		__context->setFillPaint(paint);
+	}
+	 // LOGD(" setFillStyle rgba(%d,%d,%d,%.3f)", __state->fillColor.rgba.r, __state->fillColor.rgba.g, __state->fillColor.rgba.b, (float)__state->fillColor.rgba.a/255.0f);
 }
 
 void js_context_get_strokeStyle(Local<String> property,
 		const v8::PropertyCallbackInfo<Value>& info) {
 	CONTEXT_FETCH_VAR_ESCAPABLE;
-	info.GetReturnValue().Set(scope.Escape(ColorRGBAToJSValue(isolate, __context->state->strokeColor)));
+	if (__state->strokePaint) {
+		info.GetReturnValue().Set(scope.Escape(paintToValue(isolate, __state->strokePaint)));
+		return;
+	}
+	info.GetReturnValue().Set(scope.Escape(ColorRGBAToJSValue(isolate, __state->strokeColor)));
 }
 
 void js_context_set_strokeStyle(Local<String> property, Local<Value> value,
 		const v8::PropertyCallbackInfo<void>& info) {
 	CONTEXT_FETCH_VAR;
-	__context->state->strokeColor = JSValueToColorRGBA(value);
+	EJCanvasPaint* paint = paintFromValue(isolate, value);
+	if (!paint) {
+		__state->strokeColor = __context2d->colorCache.get(isolate, value);
+		recordColor(__context2d, kBGJSCommandStrokeColor, __state->strokeColor);
+	} else if (__deferred) {
+		isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, "Gradients and patterns are not available while the view is pipelined")));
+		return;
+	} else {
+		unrecordable(__context2d, "gradients and patterns are not recorded");
+	}
+	// the color command of a display list resets the paint when the render thread replays it
+	if (!__deferred) {
+		__context->setStrokePaint(paint);
+	}
 }
 
 static void js_context_get_textAlign(Local<String> property,
@@ -170,7 +377,7 @@ static void js_context_get_textAlign(Local<String> property,
 	CONTEXT_FETCH_VAR_ESCAPABLE;
 
 	Local<String> stringRef;
-	switch (__context->state->textAlign) {
+	switch (__state->textAlign) {
 	case kEJTextAlignStart:
 		stringRef = String::NewFromUtf8(isolate, "start");
 		break;
@@ -204,15 +411,15 @@ static void js_context_set_textAlign(Local<String> property, Local<Value> value,
 	const char *str = *utf8;
 
 	if (strcmp(str, "left") == 0) {
-		__context->state->textAlign = kEJTextAlignLeft;
+		__state->textAlign = kEJTextAlignLeft;
 	} else if (strcmp(str, "right") == 0) {
-		__context->state->textAlign = kEJTextAlignRight;
+		__state->textAlign = kEJTextAlignRight;
 	} else if (strcmp(str, "start") == 0) {
-		__context->state->textAlign = kEJTextAlignStart;
+		__state->textAlign = kEJTextAlignStart;
 	} else if (strcmp(str, "end") == 0) {
-		__context->state->textAlign = kEJTextAlignEnd;
+		__state->textAlign = kEJTextAlignEnd;
 	} else if (strcmp(str, "center") == 0) {
-		__context->state->textAlign = kEJTextAlignCenter;
+		__state->textAlign = kEJTextAlignCenter;
 	}
 }
 
@@ -221,7 +428,7 @@ static void js_context_get_globalCompositeOperation(Local<String> property,
 	CONTEXT_FETCH_VAR_ESCAPABLE;
 
 	Local<String> stringRef;
-	switch (__context->state->globalCompositeOperation) {
+	switch (__state->globalCompositeOperation) {
 	case kEJCompositeOperationLighter:
 		stringRef = String::NewFromUtf8(isolate, "lighter");
 		break;
@@ -254,17 +461,27 @@ static void js_context_set_globalCompositeOperation(Local<String> property, Loca
 
 	const char *str = *utf8;
 
+	EJCompositeOperation operation;
 	if (strcmp(str, "source-over") == 0) {
-		__context->setGlobalCompositeOperation (kEJCompositeOperationSourceOver);
+		operation = kEJCompositeOperationSourceOver;
 	} else if (strcmp(str, "lighter") == 0) {
-		__context->setGlobalCompositeOperation (kEJCompositeOperationLighter);
-	} else if (strcmp(str, "start") == 0) {
-		__context->state->textAlign = kEJTextAlignStart;
-	} else if (strcmp(str, "end") == 0) {
-		__context->state->textAlign = kEJTextAlignEnd;
-	} else if (strcmp(str, "center") == 0) {
-		__context->state->textAlign = kEJTextAlignCenter;
+		operation = kEJCompositeOperationLighter;
+	} else {
+		if (strcmp(str, "start") == 0) {
+			__state->textAlign = kEJTextAlignStart;
+		} else if (strcmp(str, "end") == 0) {
+			__state->textAlign = kEJTextAlignEnd;
+		} else if (strcmp(str, "center") == 0) {
+			__state->textAlign = kEJTextAlignCenter;
+		}
+		return;
+	}
+	if (__deferred) {
+		__state->globalCompositeOperation = operation;
+	} else {
+		__context->setGlobalCompositeOperation(operation);
 	}
+	recordCommand(__context2d, kBGJSCommandGlobalCompositeOperation, operation);
 }
 
 static void js_context_get_textBaseline(Local<String> property,
@@ -272,7 +489,7 @@ static void js_context_get_textBaseline(Local<String> property,
 	CONTEXT_FETCH_VAR_ESCAPABLE;
 
 	Local<String> stringRef;
-	switch (__context->state->textBaseline) {
+	switch (__state->textBaseline) {
 	case kEJTextBaselineAlphabetic:
 		stringRef = String::NewFromUtf8(isolate, "alphabetic");
 		break;
@@ -310,19 +527,19 @@ static void js_context_set_textBaseline(Local<String> property,
 	// top, hanging, middle, alphabetic, ideographic, bottom
 
 	if (strcmp(str, "top") == 0) {
-		__context->state->textBaseline = kEJTextBaselineTop;
+		__state->textBaseline = kEJTextBaselineTop;
 	} else if (strcmp(str, "bottom") == 0) {
-		__context->state->textBaseline = kEJTextBaselineBottom;
+		__state->textBaseline = kEJTextBaselineBottom;
 	} else if (strcmp(str, "middle") == 0) {
-		__context->state->textBaseline = kEJTextBaselineMiddle;
+		__state->textBaseline = kEJTextBaselineMiddle;
 	} else if (strcmp(str, "hanging") == 0) {
-		__context->state->textBaseline = kEJTextBaselineHanging;
+		__state->textBaseline = kEJTextBaselineHanging;
 	} else if (strcmp(str, "alphabetic") == 0) {
-		__context->state->textBaseline = kEJTextBaselineAlphabetic;
+		__state->textBaseline = kEJTextBaselineAlphabetic;
 	} else if (strcmp(str, "ideographic") == 0) {
-		__context->state->textBaseline = kEJTextBaselineIdeographic;
+		__state->textBaseline = kEJTextBaselineIdeographic;
 	} else if (strcmp(str, "bottom") == 0) {
-		__context->state->textBaseline = kEJTextBaselineBottom;
+		__state->textBaseline = kEJTextBaselineBottom;
 	}
 }
 
@@ -342,6 +559,11 @@ static void js_context_set_font(Local<String> property, Local<Value> value,
 		return;
 	}
 
+	// fonts are loaded with the gl context, and text can not be drawn while the view is pipelined anyway
+	if (__deferred) {
+		return;
+	}
+
 	String::Utf8Value utf8(isolate, value);
 	const char *str = *utf8;
 
@@ -351,37 +573,39 @@ static void js_context_set_font(Local<String> property, Local<Value> value,
 static void js_context_get_lineWidth(Local<String> property,
 		const v8::PropertyCallbackInfo<Value>& info) {
 	CONTEXT_FETCH_VAR;
-	info.GetReturnValue().Set(__context->state->lineWidth);
+	info.GetReturnValue().Set(__state->lineWidth);
 }
 
 static void js_context_set_lineWidth(Local<String> property, Local<Value> value,
 		const v8::PropertyCallbackInfo<void>& info) {
 	CONTEXT_FETCH_VAR;
 
-	if (!value->IsNumber()) {
-		LOGI("context set lineWidth expects number");
+	// zero, negative, infinite and NaN widths are ignored
+	if (!value->IsNumber() || !BGJSIsCanvasLineWidth(Local<Number>::Cast(value)->Value())) {
 		return;
 	}
 	float num = Local<Number>::Cast(value)->Value();
-	__context->state->lineWidth = num;
+	__state->lineWidth = num;
+	recordCommand(__context2d, kBGJSCommandLineWidth, num);
 }
 
 static void js_context_get_globalAlpha(Local<String> property,
 		const v8::PropertyCallbackInfo<Value>& info) {
 	CONTEXT_FETCH_VAR;
-	info.GetReturnValue().Set(__context->state->globalAlpha);
+	info.GetReturnValue().Set(__state->globalAlpha);
 }
 
 static void js_context_set_globalAlpha(Local<String> property,
 		Local<Value> value, const v8::PropertyCallbackInfo<void>& info) {
 	CONTEXT_FETCH_VAR;
 
-	if (!value->IsNumber()) {
-		LOGI("context set lineWidth expects number");
+	// values outside of 0..1 and NaN are ignored
+	if (!value->IsNumber() || !BGJSIsCanvasGlobalAlpha(Local<Number>::Cast(value)->Value())) {
 		return;
 	}
 	float num = Local<Number>::Cast(value)->Value();
-	__context->state->globalAlpha = num;
+	__state->globalAlpha = num;
+	recordCommand(__context2d, kBGJSCommandGlobalAlpha, num);
 }
 
 static void js_context_get_lineJoin(Local<String> property,
@@ -390,7 +614,7 @@ static void js_context_get_lineJoin(Local<String> property,
 
 	Local<String> stringRef;
 
-	switch (__context->state->lineJoin) {
+	switch (__state->lineJoin) {
 	case kEJLineJoinRound:
 		stringRef = String::NewFromUtf8(isolate, "round");
 		break;
@@ -418,12 +642,13 @@ static void js_context_set_lineJoin(Local<String> property, Local<Value> value,
 	const char *str = *utf8;
 
 	if (strcmp(str, "round") == 0) {
-		__context->state->lineJoin = kEJLineJoinRound;
+		__state->lineJoin = kEJLineJoinRound;
 	} else if (strcmp(str, "bevel")) {
-		__context->state->lineJoin = kEJLineJoinBevel;
+		__state->lineJoin = kEJLineJoinBevel;
 	} else if (strcmp(str, "miter")) {
-		__context->state->lineJoin = kEJLineJoinMiter;
+		__state->lineJoin = kEJLineJoinMiter;
 	}
+	recordCommand(__context2d, kBGJSCommandLineJoin, __state->lineJoin);
 }
 
 static void js_context_get_lineCap(Local<String> property,
@@ -432,7 +657,7 @@ static void js_context_get_lineCap(Local<String> property,
 
 	Local<String> stringRef;
 
-	switch (__context->state->lineCap) {
+	switch (__state->lineCap) {
 	case kEJLineCapButt:
 		stringRef = String::NewFromUtf8(isolate, "butt");
 		break;
@@ -459,29 +684,107 @@ static void js_context_set_lineCap(Local<String> property, Local<Value> value,
 	const char *str = *utf8;
 
 	if (strcmp(str, "butt") == 0) {
-		__context->state->lineCap = kEJLineCapButt;
+		__state->lineCap = kEJLineCapButt;
 	} else if (strcmp(str, "round") == 0) {
-		__context->state->lineCap = kEJLineCapRound;
+		__state->lineCap = kEJLineCapRound;
 	} else if (strcmp(str, "square") == 0) {
-		__context->state->lineCap = kEJLineCapSquare;
+		__state->lineCap = kEJLineCapSquare;
 	}
+	recordCommand(__context2d, kBGJSCommandLineCap, __state->lineCap);
 }
 
 static void js_context_get_miterLimit(Local<String> property,
 		const v8::PropertyCallbackInfo<Value>& info) {
 	CONTEXT_FETCH_VAR;
-	info.GetReturnValue().Set(__context->state->miterLimit);
+	info.GetReturnValue().Set(__state->miterLimit);
 }
 
 static void js_context_set_miterLimit(Local<String> property,
 		Local<Value> value, const v8::PropertyCallbackInfo<void>& info) {
 	CONTEXT_FETCH_VAR;
-	if (!value->IsNumber()) {
-		LOGI("context set lineWidth expects number");
+	// zero, negative, infinite and NaN limits are ignored
+	if (!value->IsNumber() || !BGJSIsCanvasLineWidth(Local<Number>::Cast(value)->Value())) {
 		return;
 	}
 	float num = Local<Number>::Cast(value)->Value();
-	__context->state->miterLimit = num;
+	__state->miterLimit = num;
+	recordCommand(__context2d, kBGJSCommandMiterLimit, num);
+}
+
+static void js_context_get_shadowColor(Local<String> property,
+		const v8::PropertyCallbackInfo<Value>& info) {
+	CONTEXT_FETCH_VAR_ESCAPABLE;
+	info.GetReturnValue().Set(scope.Escape(ColorRGBAToJSValue(isolate, __state->shadowColor)));
+}
+
+static void js_context_set_shadowColor(Local<String> property,
+		Local<Value> value, const v8::PropertyCallbackInfo<void>& info) {
+	CONTEXT_FETCH_VAR;
+	__state->shadowColor = __context2d->colorCache.get(isolate, value);
+	recordColor(__context2d, kBGJSCommandShadowColor, __state->shadowColor);
+}
+
+static void js_context_get_shadowBlur(Local<String> property,
+		const v8::PropertyCallbackInfo<Value>& info) {
+	CONTEXT_FETCH_VAR;
+	info.GetReturnValue().Set(__state->shadowBlur);
+}
+
+static void js_context_set_shadowBlur(Local<String> property,
+		Local<Value> value, const v8::PropertyCallbackInfo<void>& info) {
+	CONTEXT_FETCH_VAR;
+	// negative, infinite and NaN values are ignored
+	const double num = value->IsNumber() ? Local<Number>::Cast(value)->Value() : -1;
+	if (!(num >= 0 && isfinite(num))) {
+		return;
+	}
+	__state->shadowBlur = num;
+	recordCommand(__context2d, kBGJSCommandShadowBlur, num);
+}
+
+static void js_context_get_shadowOffsetX(Local<String> property,
+		const v8::PropertyCallbackInfo<Value>& info) {
+	CONTEXT_FETCH_VAR;
+	info.GetReturnValue().Set(__state->shadowOffsetX);
+}
+
+static void js_context_set_shadowOffsetX(Local<String> property,
+		Local<Value> value, const v8::PropertyCallbackInfo<void>& info) {
+	CONTEXT_FETCH_VAR;
+	if (!value->IsNumber() || !isfinite(Local<Number>::Cast(value)->Value())) {
+		return;
+	}
+	__state->shadowOffsetX = Local<Number>::Cast(value)->Value();
+	recordCommand(__context2d, kBGJSCommandShadowOffset, __state->shadowOffsetX, __state->shadowOffsetY);
+}
+
+static void js_context_get_shadowOffsetY(Local<String> property,
+		const v8::PropertyCallbackInfo<Value>& info) {
+	CONTEXT_FETCH_VAR;
+	info.GetReturnValue().Set(__state->shadowOffsetY);
+}
+
+static void js_context_set_shadowOffsetY(Local<String> property,
+		Local<Value> value, const v8::PropertyCallbackInfo<void>& info) {
+	CONTEXT_FETCH_VAR;
+	if (!value->IsNumber() || !isfinite(Local<Number>::Cast(value)->Value())) {
+		return;
+	}
+	__state->shadowOffsetY = Local<Number>::Cast(value)->Value();
+	recordCommand(__context2d, kBGJSCommandShadowOffset, __state->shadowOffsetX, __state->shadowOffsetY);
+}
+
+// distanceFieldText is not part of the canvas spec; text drawn with it stays sharp when it is scaled or rotated
+static void js_context_get_distanceFieldText(Local<String> property,
+		const v8::PropertyCallbackInfo<Value>& info) {
+	CONTEXT_FETCH_VAR;
+	info.GetReturnValue().Set(__context->distanceFieldText);
+}
+
+static void js_context_set_distanceFieldText(Local<String> property,
+		Local<Value> value, const v8::PropertyCallbackInfo<void>& info) {
+	CONTEXT_FETCH_VAR;
+	__context->distanceFieldText = value->BooleanValue(info.GetIsolate());
 }
 
 void BGJSCanvasGL::getWidth(Local<String> property,
@@ -490,7 +793,8 @@ void BGJSCanvasGL::getWidth(Local<String> property,
 	Local<Object> self = info.Holder();
 	Local<External> wrap = Local<External>::Cast(self->GetInternalField(0));
 	void* ptr = wrap->Value();
-	int value = static_cast<BGJSCanvasGL*>(ptr)->_view->getWidth();
+	BGJSCanvasGL* canvas = static_cast<BGJSCanvasGL*>(ptr);
+	int value = canvas->_offscreen ? canvas->_offscreen->requestedWidth() : canvas->_view->getWidth();
 #ifdef DEBUG
 	LOGD("getWidth %d", value);
 #endif
@@ -503,7 +807,8 @@ void BGJSCanvasGL::getHeight(Local<String> property,
 	Local<Object> self = info.Holder();
 	Local<External> wrap = Local<External>::Cast(self->GetInternalField(0));
 	void* ptr = wrap->Value();
-	int value = static_cast<BGJSCanvasGL*>(ptr)->_view->getHeight();
+	BGJSCanvasGL* canvas = static_cast<BGJSCanvasGL*>(ptr);
+	int value = canvas->_offscreen ? canvas->_offscreen->requestedHeight() : canvas->_view->getHeight();
 #ifdef DEBUG
 	LOGD("getHeight %d", value);
 #endif
@@ -523,12 +828,21 @@ void BGJSCanvasGL::getPixelRatio(Local<String> property,
 
 void BGJSCanvasGL::setHeight(Local<String> property, Local<Value> value,
 		const v8::PropertyCallbackInfo<void>& info) {
-	// NOP
+	// the size of view canvases follows the view; offscreen canvases are resized with their next frame
+	BGJSCanvasGL* canvas = static_cast<BGJSCanvasGL*>(Local<External>::Cast(info.Holder()->GetInternalField(0))->Value());
+	if (canvas->_offscreen && value->IsNumber()) {
+		canvas->_offscreen->requestSize(canvas->_offscreen->requestedWidth(), (int)Local<Number>::Cast(value)->Value());
+		reportExternalMemory(info.GetIsolate(), &canvas->_externalMemory, offscreenBytes(canvas->_offscreen));
+	}
 }
 
 void BGJSCanvasGL::setWidth(Local<String> property, Local<Value> value,
 		const v8::PropertyCallbackInfo<void>& info) {
-	// NOP
+	BGJSCanvasGL* canvas = static_cast<BGJSCanvasGL*>(Local<External>::Cast(info.Holder()->GetInternalField(0))->Value());
+	if (canvas->_offscreen && value->IsNumber()) {
+		canvas->_offscreen->requestSize((int)Local<Number>::Cast(value)->Value(), canvas->_offscreen->requestedHeight());
+		reportExternalMemory(info.GetIsolate(), &canvas->_externalMemory, offscreenBytes(canvas->_offscreen));
+	}
 }
 
 void BGJSCanvasGL::setPixelRatio(Local<String> property, Local<Value> value,
@@ -538,13 +852,19 @@ void BGJSCanvasGL::setPixelRatio(Local<String> property, Local<Value> value,
 
 static void js_context_beginPath(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	CONTEXT_FETCH();
-	__context->beginPath();
+	if (!__deferred) {
+		__context->beginPath();
+	}
+	recordCommand(__context2d, kBGJSCommandBeginPath);
 	args.GetReturnValue().SetUndefined();
 }
 
 static void js_context_closePath(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	CONTEXT_FETCH();
-	__context->closePath();
+	if (!__deferred) {
+		__context->closePath();
+	}
+	recordCommand(__context2d, kBGJSCommandClosePath);
 	args.GetReturnValue().SetUndefined();
 }
 
@@ -553,7 +873,10 @@ static void js_context_moveTo(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	REQUIRE_PARAMS(2);
 	float x = Local<Number>::Cast(args[0])->Value();
 	float y = Local<Number>::Cast(args[1])->Value();
-	__context->moveToX(x, y);
+	if (!__deferred) {
+		__context->moveToX(x, y);
+	}
+	recordCommand(__context2d, kBGJSCommandMoveTo, x, y);
 	args.GetReturnValue().SetUndefined();
 }
 
@@ -562,31 +885,82 @@ static void js_context_lineTo(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	REQUIRE_PARAMS(2);
 	float x = Local<Number>::Cast(args[0])->Value();
 	float y = Local<Number>::Cast(args[1])->Value();
-	__context->lineToX(x, y);
+	if (!__deferred) {
+		__context->lineToX(x, y);
+	}
+	recordCommand(__context2d, kBGJSCommandLineTo, x, y);
 	args.GetReturnValue().SetUndefined();
 }
 
+// Returns the EJPath of a Path2D object, or null if value is no Path2D
+static EJPath* pathFromValue(Isolate* isolate, Local<Value> value) {
+	if (!value->IsObject() || !Local<FunctionTemplate>::New(isolate, BGJSGLModule::g_templatePath2D)->HasInstance(value)) {
+		return NULL;
+	}
+	Local<External> external = Local<External>::Cast(value->ToObject(isolate)->GetInternalField(0));
+	return static_cast<EJPath*>(external->Value());
+}
+
 static void js_context_stroke(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	CONTEXT_FETCH();
-	__context->stroke();
+	EJPath* path = args.Length() > 0 ? pathFromValue(isolate, args[0]) : NULL;
+	if (path) {
+		REQUIRE_IMMEDIATE();
+		unrecordable(__context2d, "Path2D objects are not recorded");
+		__context->strokePath(path);
+	} else {
+		if (!__deferred) {
+			__context->stroke();
+		}
+		recordCommand(__context2d, kBGJSCommandStroke);
+	}
 	args.GetReturnValue().SetUndefined();
 }
 
 static void js_context_fill(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	CONTEXT_FETCH();
-	__context->fill();
+	// fill([path,] [fillRule]); the stencil this canvas used to fill with is even-odd, so that stays the default
+	EJPath* path = args.Length() > 0 ? pathFromValue(isolate, args[0]) : NULL;
+	const int ruleIndex = path ? 1 : 0;
+	EJFillRule fillRule = kEJFillRuleEvenOdd;
+	if (args.Length() > ruleIndex && args[ruleIndex]->IsString()) {
+		String::Utf8Value utf8(isolate, args[ruleIndex]);
+		if (strcmp(*utf8, "nonzero") == 0) {
+			fillRule = kEJFillRuleNonZero;
+		}
+	}
+	if (path) {
+		REQUIRE_IMMEDIATE();
+		unrecordable(__context2d, "Path2D objects are not recorded");
+		__context->fillPath(path, fillRule);
+	} else {
+		if (!__deferred) {
+			__context->fill(fillRule);
+		}
+		recordCommand(__context2d, kBGJSCommandFill, fillRule == kEJFillRuleNonZero ? 1 : 0);
+	}
 	args.GetReturnValue().SetUndefined();
 }
 
 static void js_context_save(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	CONTEXT_FETCH();
-	__context->save();
+	if (__deferred) {
+		__context2d->view->savePipelinedState();
+	} else {
+		__context->save();
+	}
+	recordCommand(__context2d, kBGJSCommandSave);
 	args.GetReturnValue().SetUndefined();
 }
 
 static void js_context_restore(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	CONTEXT_FETCH();
-	__context->restore();
+	if (__deferred) {
+		__context2d->view->restorePipelinedState();
+	} else {
+		__context->restore();
+	}
+	recordCommand(__context2d, kBGJSCommandRestore);
 	args.GetReturnValue().SetUndefined();
 }
 
@@ -595,7 +969,10 @@ static void js_context_scale(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	REQUIRE_PARAMS(2);
 	float x = Local<Number>::Cast(args[0])->Value();
 	float y = Local<Number>::Cast(args[1])->Value();
-	__context->scaleX(x, y);
+	if (!__deferred) {
+		__context->scaleX(x, y);
+	}
+	recordCommand(__context2d, kBGJSCommandScale, x, y);
 	args.GetReturnValue().SetUndefined();
 }
 
@@ -603,7 +980,10 @@ static void js_context_rotate(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	CONTEXT_FETCH();
 	REQUIRE_PARAMS(1);
 	float degrees = Local<Number>::Cast(args[0])->Value();
-	__context->rotate(degrees);
+	if (!__deferred) {
+		__context->rotate(degrees);
+	}
+	recordCommand(__context2d, kBGJSCommandRotate, degrees);
 	args.GetReturnValue().SetUndefined();
 }
 
@@ -612,7 +992,10 @@ static void js_context_translate(const v8::FunctionCallbackInfo<v8::Value>& args
 	REQUIRE_PARAMS(2);
 	float x = Local<Number>::Cast(args[0])->Value();
 	float y = Local<Number>::Cast(args[1])->Value();
-	__context->translateX(x, y);
+	if (!__deferred) {
+		__context->translateX(x, y);
+	}
+	recordCommand(__context2d, kBGJSCommandTranslate, x, y);
 	args.GetReturnValue().SetUndefined();
 }
 
@@ -638,26 +1021,36 @@ static void js_context_setTransform(const v8::FunctionCallbackInfo<v8::Value>& a
 
 }
 
+// Gradients and patterns only draw with a context, so they can be created outside of the rendering phase
 static void js_context_createLinearGradient(const v8::FunctionCallbackInfo<v8::Value>& args) {
-	//CONTEXT_FETCH();
-
-	/*
-	 void scrollPathIntoView();
-	 */
-	//assert(argumentCount==0);
-	LOGI("createLinearGradient: unimplemented stub!");
-	args.GetReturnValue().Set(false);
+	CREATE_UNESCAPABLE_CONTEXT
+	BGJS_ASSERT_LOCKED(isolate)
+	if (args.Length() < 4) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Not enough parameters")));
+		return;
+	}
+	EJCanvasPaint* paint = EJCanvasPaint::linearGradient(Local<Number>::Cast(args[0])->Value(), Local<Number>::Cast(args[1])->Value(),
+			Local<Number>::Cast(args[2])->Value(), Local<Number>::Cast(args[3])->Value());
+	args.GetReturnValue().Set(paintToValue(isolate, paint));
+	paint->release();
 }
 
-static void js_context_createPattern(const v8::FunctionCallbackInfo<v8::Value>& args) {
-	//CONTEXT_FETCH();
-
-	/*
-	 void scrollPathIntoView();
-	 */
-	//assert(argumentCount==0);
-	LOGI("createPattern: unimplemented stub!");
-	args.GetReturnValue().SetUndefined();
+static void js_context_createRadialGradient(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CREATE_UNESCAPABLE_CONTEXT
+	BGJS_ASSERT_LOCKED(isolate)
+	if (args.Length() < 6) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Not enough parameters")));
+		return;
+	}
+	const double r0 = Local<Number>::Cast(args[2])->Value(), r1 = Local<Number>::Cast(args[5])->Value();
+	if (r0 < 0 || r1 < 0) {
+		isolate->ThrowException(v8::Exception::RangeError(v8::String::NewFromUtf8(isolate, "Radius can not be negative")));
+		return;
+	}
+	EJCanvasPaint* paint = EJCanvasPaint::radialGradient(Local<Number>::Cast(args[0])->Value(), Local<Number>::Cast(args[1])->Value(), r0,
+			Local<Number>::Cast(args[3])->Value(), Local<Number>::Cast(args[4])->Value(), r1);
+	args.GetReturnValue().Set(paintToValue(isolate, paint));
+	paint->release();
 }
 
 static void js_context_scrollPathIntoView(const v8::FunctionCallbackInfo<v8::Value>& args) {
@@ -678,7 +1071,10 @@ static void js_context_clearRect(const v8::FunctionCallbackInfo<v8::Value>& args
 	float y = Local<Number>::Cast(args[1])->Value();
 	float w = Local<Number>::Cast(args[2])->Value();
 	float h = Local<Number>::Cast(args[3])->Value();
-	__context->clearRectX(x, y, w, h);
+	if (!__deferred) {
+		__context->clearRectX(x, y, w, h);
+	}
+	recordCommand(__context2d, kBGJSCommandClearRect, x, y, w, h);
 	// LOGD("clearRect %f %f . w %f h %f", x, y, w, h);
 	args.GetReturnValue().SetUndefined();
 }
@@ -690,7 +1086,10 @@ static void js_context_fillRect(const v8::FunctionCallbackInfo<v8::Value>& args)
 	float y = Local<Number>::Cast(args[1])->Value();
 	float w = Local<Number>::Cast(args[2])->Value();
 	float h = Local<Number>::Cast(args[3])->Value();
-	__context->fillRectX(x, y, w, h);
+	if (!__deferred) {
+		__context->fillRectX(x, y, w, h);
+	}
+	recordCommand(__context2d, kBGJSCommandFillRect, x, y, w, h);
 	// LOGD("fillRect %f %f . w %f h %f", x, y, w, h);
 	args.GetReturnValue().SetUndefined();
 }
@@ -702,7 +1101,10 @@ static void js_context_strokeRect(const v8::FunctionCallbackInfo<v8::Value>& arg
 	float y = Local<Number>::Cast(args[1])->Value();
 	float w = Local<Number>::Cast(args[2])->Value();
 	float h = Local<Number>::Cast(args[3])->Value();
-	__context->strokeRectX(x, y, w, h);
+	if (!__deferred) {
+		__context->strokeRectX(x, y, w, h);
+	}
+	recordCommand(__context2d, kBGJSCommandStrokeRect, x, y, w, h);
 	args.GetReturnValue().SetUndefined();
 }
 
@@ -713,7 +1115,10 @@ static void js_context_quadraticCurveTo(const v8::FunctionCallbackInfo<v8::Value
 	float cpy = Local<Number>::Cast(args[1])->Value();
 	float x = Local<Number>::Cast(args[2])->Value();
 	float y = Local<Number>::Cast(args[3])->Value();
-	__context->quadraticCurveToCpx(cpx, cpy, x, y);
+	if (!__deferred) {
+		__context->quadraticCurveToCpx(cpx, cpy, x, y);
+	}
+	recordCommand(__context2d, kBGJSCommandQuadraticCurveTo, cpx, cpy, x, y);
 	args.GetReturnValue().SetUndefined();
 }
 
@@ -727,7 +1132,10 @@ static void js_context_bezierCurveTo(const v8::FunctionCallbackInfo<v8::Value>&
 	float x = Local<Number>::Cast(args[4])->Value();
 	float y = Local<Number>::Cast(args[5])->Value();
 
-	__context->bezierCurveToCpx1(cpx1, cpy1, cpx2, cpy2, x, y);
+	if (!__deferred) {
+		__context->bezierCurveToCpx1(cpx1, cpy1, cpx2, cpy2, x, y);
+	}
+	recordCommand(__context2d, kBGJSCommandBezierCurveTo, cpx1, cpy1, cpx2, cpy2, x, y);
 	args.GetReturnValue().SetUndefined();
 }
 
@@ -740,7 +1148,10 @@ static void js_context_arcTo(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	float y2 = Local<Number>::Cast(args[3])->Value();
 	float radius = Local<Number>::Cast(args[5])->Value();
 
-	__context->arcToX1(x1, y1, x2, y2, radius);
+	if (!__deferred) {
+		__context->arcToX1(x1, y1, x2, y2, radius);
+	}
+	recordCommand(__context2d, kBGJSCommandArcTo, x1, y1, x2, y2, radius);
 	args.GetReturnValue().SetUndefined();
 }
 
@@ -751,7 +1162,10 @@ static void js_context_rect(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	float y = Local<Number>::Cast(args[1])->Value();
 	float w = Local<Number>::Cast(args[2])->Value();
 	float h = Local<Number>::Cast(args[3])->Value();
-	__context->rectX(x, y, w, h);
+	if (!__deferred) {
+		__context->rectX(x, y, w, h);
+	}
+	recordCommand(__context2d, kBGJSCommandRect, x, y, w, h);
 	args.GetReturnValue().SetUndefined();
 }
 
@@ -768,7 +1182,10 @@ static void js_context_arc(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	float startAngle = Local<Number>::Cast(args[3])->Value();
 	float endAngle = Local<Number>::Cast(args[4])->Value();
 	bool antiClockWise = args[5]->BooleanValue(isolate);
-	__context->arcX(x, y, radius, startAngle, endAngle, antiClockWise);
+	if (!__deferred) {
+		__context->arcX(x, y, radius, startAngle, endAngle, antiClockWise);
+	}
+	recordCommand(__context2d, kBGJSCommandArc, x, y, radius, startAngle, endAngle, antiClockWise ? 1 : 0);
 	// [__context arcX:(float)JSValueToNumber(ctx,arguments[0],exception) y:(float)JSValueToNumber(ctx,arguments[1],exception) radius:(float)JSValueToNumber(ctx,arguments[2],exception) startAngle:(float)JSValueToNumber(ctx,arguments[3],exception) endAngle:(float)JSValueToNumber(ctx,arguments[4],exception) antiClockwise:JSValueToBoolean(ctx,arguments[5])];
 	args.GetReturnValue().SetUndefined();
 }
@@ -789,6 +1206,7 @@ static void js_context_drawCustomFocusRing(const v8::FunctionCallbackInfo<v8::Va
 
 static void js_context_clipY(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	CONTEXT_FETCH();
+	REQUIRE_IMMEDIATE();
 
 	REQUIRE_PARAMS(2);
 	float y1 = Local<Number>::Cast(args[0])->Value();
@@ -822,38 +1240,135 @@ static void js_context_clipRect(const v8::FunctionCallbackInfo<v8::Value>& args)
 	rect.size.width = w;
 	rect.size.height = h;
 
-	__context->clipRect(rect);
+	if (!__deferred) {
+		__context->clipRect(rect);
+	}
+	recordCommand(__context2d, kBGJSCommandClipRect, inputX, inputY, w, h);
 
 	args.GetReturnValue().SetUndefined();
 }
 
 static void js_context_clip(const v8::FunctionCallbackInfo<v8::Value>& args) {
-	/*
-	 void clip();
-	 */
-	//assert(argumentCount==0);
-#ifdef DEBUG
-	LOGD("js clip called: not implemented");
-#endif
-
+	CONTEXT_FETCH();
+	// clip([path,] [fillRule]); unlike fill there are no old scripts that rely on even-odd
+	EJPath* path = args.Length() > 0 ? pathFromValue(isolate, args[0]) : NULL;
+	const int ruleIndex = path ? 1 : 0;
+	EJFillRule fillRule = kEJFillRuleNonZero;
+	if (args.Length() > ruleIndex && args[ruleIndex]->IsString()) {
+		String::Utf8Value utf8(isolate, args[ruleIndex]);
+		if (strcmp(*utf8, "evenodd") == 0) {
+			fillRule = kEJFillRuleEvenOdd;
+		}
+	}
+	if (path) {
+		REQUIRE_IMMEDIATE();
+		unrecordable(__context2d, "Path2D objects are not recorded");
+		__context->clipPath(path, fillRule);
+	} else {
+		if (!__deferred) {
+			__context->clip(fillRule);
+		}
+		recordCommand(__context2d, kBGJSCommandClip, fillRule == kEJFillRuleNonZero ? 1 : 0);
+	}
 	args.GetReturnValue().SetUndefined();
 }
 
 static void js_context_isPointInPath(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	CONTEXT_FETCH();
+	REQUIRE_IMMEDIATE();
+	// isPointInPath([path,] x, y, [fillRule]); unlike fill, the default rule is the nonzero one of the spec
+	EJPath* path = args.Length() > 0 ? pathFromValue(isolate, args[0]) : NULL;
+	const int xIndex = path ? 1 : 0;
+	if (args.Length() < xIndex + 2) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "isPointInPath requires x and y")));
+		return;
+	}
+	float x = Local<Number>::Cast(args[xIndex])->Value();
+	float y = Local<Number>::Cast(args[xIndex + 1])->Value();
+	EJFillRule fillRule = kEJFillRuleNonZero;
+	if (args.Length() > xIndex + 2 && args[xIndex + 2]->IsString()) {
+		String::Utf8Value utf8(isolate, args[xIndex + 2]);
+		if (strcmp(*utf8, "evenodd") == 0) {
+			fillRule = kEJFillRuleEvenOdd;
+		}
+	}
 
-	REQUIRE_PARAMS(5);
-	float x = Local<Number>::Cast(args[0])->Value();
-	float y = Local<Number>::Cast(args[1])->Value();
+	bool isInside = path ? __context->isPointInPath(path, x, y, fillRule) : __context->isPointInPath(x, y, fillRule);
+	args.GetReturnValue().Set(isInside);
+}
 
-	bool isInside = NO;
-	// TODO: Incomplete
+static void js_context_isPointInStroke(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CONTEXT_FETCH();
+	REQUIRE_IMMEDIATE();
+	// isPointInStroke([path,] x, y)
+	EJPath* path = args.Length() > 0 ? pathFromValue(isolate, args[0]) : NULL;
+	const int xIndex = path ? 1 : 0;
+	if (args.Length() < xIndex + 2) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "isPointInStroke requires x and y")));
+		return;
+	}
+	float x = Local<Number>::Cast(args[xIndex])->Value();
+	float y = Local<Number>::Cast(args[xIndex + 1])->Value();
 
+	bool isInside = path ? __context->isPointInStroke(path, x, y) : __context->isPointInStroke(x, y);
 	args.GetReturnValue().Set(isInside);
 }
 
+static void js_context_addHitRegion(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CONTEXT_FETCH();
+	// addHitRegion({ path, id, [fillRule] }); regions are tested by the view on touches, so they need a Path2D that
+	// outlives the frame; the current path of the context is not supported
+	if (!__context2d->view) {
+		isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, "Hit regions need the context of a view")));
+		return;
+	}
+	v8::Local<v8::Context> context = isolate->GetCurrentContext();
+	v8::Local<v8::Object> options;
+	v8::Local<v8::Value> pathValue, idValue, ruleValue;
+	EJPath *path = nullptr;
+	if (args.Length() > 0 && args[0]->IsObject()) {
+		options = args[0].As<v8::Object>();
+		if (options->Get(context, String::NewFromUtf8(isolate, "path")).ToLocal(&pathValue)) {
+			path = pathFromValue(isolate, pathValue);
+		}
+	}
+	if (!path || !options->Get(context, String::NewFromUtf8(isolate, "id")).ToLocal(&idValue) || idValue->IsNullOrUndefined()) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "addHitRegion requires a Path2D and an id")));
+		return;
+	}
+	EJFillRule fillRule = kEJFillRuleNonZero;
+	if (options->Get(context, String::NewFromUtf8(isolate, "fillRule")).ToLocal(&ruleValue) && ruleValue->IsString()) {
+		String::Utf8Value utf8(isolate, ruleValue);
+		if (strcmp(*utf8, "evenodd") == 0) {
+			fillRule = kEJFillRuleEvenOdd;
+		}
+	}
+	const CGAffineTransform transform = __deferred ? __context2d->view->pipelinedState()->transform : __context->state->transform;
+	if (transform.a * transform.d - transform.b * transform.c == 0) {
+		return;
+	}
+	String::Utf8Value id(isolate, idValue);
+	__context2d->view->addHitRegion(std::string(*id, id.length()), *path, transform, fillRule);
+}
+
+static void js_context_removeHitRegion(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CONTEXT_FETCH();
+	if (__context2d->view && args.Length() > 0) {
+		String::Utf8Value id(isolate, args[0]);
+		__context2d->view->removeHitRegion(std::string(*id, id.length()));
+	}
+}
+
+static void js_context_clearHitRegions(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CONTEXT_FETCH();
+	if (__context2d->view) {
+		__context2d->view->clearHitRegions();
+	}
+}
+
 static void js_context_strokeText(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	CONTEXT_FETCH();
+	REQUIRE_IMMEDIATE();
 
 	/*
 	 void fillText(in DOMString text, in double x, in double y, in optional double maxWidth);
@@ -864,12 +1379,14 @@ static void js_context_strokeText(const v8::FunctionCallbackInfo<v8::Value>& arg
 	float x = Local<Number>::Cast(args[1])->Value();
 	float y = Local<Number>::Cast(args[2])->Value();
 
+	unrecordable(__context2d, "text is not recorded");
 	__context->strokeText(*utf8, x, y);
 	args.GetReturnValue().SetUndefined();
 }
 
 static void js_context_fillText(const v8::FunctionCallbackInfo<v8::Value>& args) {
 	CONTEXT_FETCH();
+	REQUIRE_IMMEDIATE();
 
 	/*
 	 void fillText(in DOMString text, in double x, in double y, in optional double maxWidth);
@@ -880,6 +1397,7 @@ static void js_context_fillText(const v8::FunctionCallbackInfo<v8::Value>& args)
 	float x = Local<Number>::Cast(args[1])->Value();
 	float y = Local<Number>::Cast(args[2])->Value();
 
+	unrecordable(__context2d, "text is not recorded");
 	__context->fillText(*utf8, x, y);
 	args.GetReturnValue().SetUndefined();
 }
@@ -890,6 +1408,7 @@ static void js_context_measureText(const v8::FunctionCallbackInfo<v8::Value>& ar
 	 */
 	//assert(argumentCount==1);
 	CONTEXT_FETCH_ESCAPABLE();
+	REQUIRE_IMMEDIATE();
 
 	Local<String> text = Local<String>::Cast(args[0]);
 	String::Utf8Value utf8(isolate, text);
@@ -901,73 +1420,873 @@ static void js_context_measureText(const v8::FunctionCallbackInfo<v8::Value>& ar
 	args.GetReturnValue().Set(scope.Escape(objRef));
 }
 
+// optional trailing number arguments of the text box functions
+static float numberArgument(const v8::FunctionCallbackInfo<v8::Value>& args, int index, float defaultValue) {
+	return args.Length() > index && args[index]->IsNumber() ? (float)Local<Number>::Cast(args[index])->Value() : defaultValue;
+}
+
+static void js_context_layoutText(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	/*
+	 object layoutText(in DOMString text, in double maxWidth, in optional long maxLines);
+	 returns { width, truncated, lines: [{ text, width }] } without drawing anything
+	 */
+	CONTEXT_FETCH_ESCAPABLE();
+	REQUIRE_IMMEDIATE();
+
+	String::Utf8Value utf8(isolate, args[0]);
+	if (!*utf8) {
+		return;
+	}
+	const EJFontLayout* layout = __context->layoutText(*utf8, numberArgument(args, 1, 0), (int)numberArgument(args, 2, 0));
+
+	Local<Context> context = isolate->GetCurrentContext();
+	Local<String> widthKey = String::NewFromUtf8(isolate, "width", NewStringType::kInternalized).ToLocalChecked();
+	Local<String> textKey = String::NewFromUtf8(isolate, "text", NewStringType::kInternalized).ToLocalChecked();
+	Local<Array> lines = Array::New(isolate, (int)layout->lines.size());
+	for (size_t i = 0; i < layout->lines.size(); i++) {
+		const EJFontLine& line = layout->lines[i];
+		Local<Object> lineRef = Object::New(isolate);
+		lineRef->CreateDataProperty(context, textKey, String::NewFromUtf8(isolate, *utf8 + line.start,
+				NewStringType::kNormal, (int)line.length).ToLocalChecked()).FromJust();
+		lineRef->CreateDataProperty(context, widthKey, Number::New(isolate, line.width)).FromJust();
+		lines->Set(context, (uint32_t)i, lineRef).FromJust();
+	}
+
+	Local<Object> objRef = Object::New(isolate);
+	objRef->CreateDataProperty(context, widthKey, Number::New(isolate, layout->width)).FromJust();
+	objRef->CreateDataProperty(context, String::NewFromUtf8(isolate, "truncated"),
+			v8::Boolean::New(isolate, layout->truncated)).FromJust();
+	objRef->CreateDataProperty(context, String::NewFromUtf8(isolate, "lines"), lines).FromJust();
+	args.GetReturnValue().Set(scope.Escape(objRef));
+}
+
+static void textBox(const v8::FunctionCallbackInfo<v8::Value>& args, bool fill) {
+	CONTEXT_FETCH();
+	REQUIRE_IMMEDIATE();
+
+	/*
+	 long fillTextBox(in DOMString text, in double x, in double y, in double maxWidth,
+	 	in optional double lineHeight, in optional long maxLines);
+	 returns the number of lines that were drawn
+	 */
+	if (args.Length() < 4) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate,
+				"text boxes require text, x, y and maxWidth")));
+		return;
+	}
+	String::Utf8Value utf8(isolate, args[0]);
+	if (!*utf8) {
+		return;
+	}
+	const float x = Local<Number>::Cast(args[1])->Value();
+	const float y = Local<Number>::Cast(args[2])->Value();
+	const float maxWidth = numberArgument(args, 3, 0);
+	const float lineHeight = numberArgument(args, 4, 0);
+	const int maxLines = (int)numberArgument(args, 5, 0);
+
+	unrecordable(__context2d, "text is not recorded");
+	const EJFontLayout* layout = fill ? __context->fillTextBox(*utf8, x, y, maxWidth, lineHeight, maxLines) :
+			__context->strokeTextBox(*utf8, x, y, maxWidth, lineHeight, maxLines);
+	args.GetReturnValue().Set((uint32_t)layout->lines.size());
+}
+
+static void js_context_fillTextBox(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	textBox(args, true);
+}
+
+static void js_context_strokeTextBox(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	textBox(args, false);
+}
+
+/**
+ * Image
+ * A png that is decoded on a pool of threads, so loading does not stall scripts or frames. src is an asset path, or a
+ * file if it starts with '/'; onload or onerror is called on the js thread once decoding is done. Images with the same src
+ * share their pixels, and every canvas context makes a texture of them the first time they are drawn.
+ */
+
+struct ImageCallbackHolder {
+	v8::Persistent<v8::Object> persistent;
+	BGJSV8Engine* engine;
+	EJImage* image;
+	std::string src;
+	int width, height;
+	bool complete;
+	int generation;	// incremented for every src, so the result of a replaced load is ignored
+	int pending;	// loads that have not called back yet; the object is kept alive while there are any
+	int64_t externalMemory;	// bytes of the decoded image that were reported to v8
+};
+
+struct ImageLoad {
+	ImageCallbackHolder* holder;
+	int generation;
+};
+
+// Returns the holder of an Image object, or null if value is no Image
+static ImageCallbackHolder* imageFromValue(Isolate* isolate, Local<Value> value) {
+	if (!value->IsObject() || !Local<FunctionTemplate>::New(isolate, BGJSGLModule::g_templateImage)->HasInstance(value)) {
+		return NULL;
+	}
+	return (ImageCallbackHolder*)Local<External>::Cast(value->ToObject(isolate)->GetInternalField(0))->Value();
+}
+
+// Returns the native side of a canvas object, or null if value is no canvas
+static BGJSCanvasGL* canvasFromValue(Isolate* isolate, Local<Value> value) {
+	if (!value->IsObject() || !Local<FunctionTemplate>::New(isolate, BGJSGLModule::g_templateCanvasGL)->HasInstance(value)) {
+		return NULL;
+	}
+	// the module exports are a canvas object without a view
+	Local<Value> field = value->ToObject(isolate)->GetInternalField(0);
+	return field->IsExternal() ? (BGJSCanvasGL*)Local<External>::Cast(field)->Value() : NULL;
+}
+
+// createPattern(image, repetition) returns null while the image is not decoded; canvases can not be patterns yet
+static void js_context_createPattern(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CREATE_UNESCAPABLE_CONTEXT
+	BGJS_ASSERT_LOCKED(isolate)
+	ImageCallbackHolder* holder = args.Length() > 0 ? imageFromValue(isolate, args[0]) : NULL;
+	if (!holder) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "createPattern requires an Image")));
+		return;
+	}
+
+	EJPatternRepetition repetition = kEJPatternRepeat;
+	if (args.Length() > 1 && !args[1]->IsNull() && !args[1]->IsUndefined()) {
+		String::Utf8Value utf8(isolate, args[1]);
+		const char* name = *utf8 ? *utf8 : "";
+		if (strcmp(name, "repeat-x") == 0) {
+			repetition = kEJPatternRepeatX;
+		} else if (strcmp(name, "repeat-y") == 0) {
+			repetition = kEJPatternRepeatY;
+		} else if (strcmp(name, "no-repeat") == 0) {
+			repetition = kEJPatternNoRepeat;
+		} else if (name[0] && strcmp(name, "repeat") != 0) {
+			isolate->ThrowException(v8::Exception::SyntaxError(v8::String::NewFromUtf8(isolate, "Unknown pattern repetition")));
+			return;
+		}
+	}
+
+	if (!holder->image || holder->image->state() != kEJImageDecoded || !holder->image->ensurePixels()) {
+		args.GetReturnValue().SetNull();
+		return;
+	}
+	EJCanvasPaint* paint = EJCanvasPaint::pattern(holder->image, repetition);
+	args.GetReturnValue().Set(paintToValue(isolate, paint));
+	paint->release();
+}
+
 static void js_context_drawImage(const v8::FunctionCallbackInfo<v8::Value>& args) {
-	//CONTEXT_FETCH();
+	CONTEXT_FETCH();
+	REQUIRE_IMMEDIATE();
 
 	/*
 	 void drawImage(in HTMLImageElement image, in double dx, in double dy);
 	 void drawImage(in HTMLImageElement image, in double dx, in double dy, in double dw, in double dh);
 	 void drawImage(in HTMLImageElement image, in double sx, in double sy, in double sw, in double sh, in double dx, in double dy, in double dw, in double dh);
-	 void drawImage(in HTMLCanvasElement image, in double dx, in double dy);
-	 void drawImage(in HTMLCanvasElement image, in double dx, in double dy, in double dw, in double dh);
-	 void drawImage(in HTMLCanvasElement image, in double sx, in double sy, in double sw, in double sh, in double dx, in double dy, in double dw, in double dh);
-	 void drawImage(in HTMLVideoElement image, in double dx, in double dy);
-	 void drawImage(in HTMLVideoElement image, in double dx, in double dy, in double dw, in double dh);
-	 void drawImage(in HTMLVideoElement image, in double sx, in double sy, in double sw, in double sh, in double dx, in double dy, in double dw, in double dh);
+	 instead of an image, a canvas created with createCanvas can be drawn; view canvases and video elements are not supported
 	 */
-	//assert(argumentCount==3||argumentCount==5||argumentCount==9);
-	LOGI("drawImage: unimplemented stub!");
-	args.GetReturnValue().SetUndefined();
+	if (args.Length() != 3 && args.Length() != 5 && args.Length() != 9) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Wrong number of parameters")));
+		return;
+	}
+	EJImage* image = NULL;
+	EJTexture* canvasTexture = NULL;
+	BGJSCanvasGL* canvas = canvasFromValue(isolate, args[0]);
+	if (canvas) {
+		if (!canvas->_offscreen) {
+			isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "drawImage can only draw canvases created with createCanvas")));
+			return;
+		}
+		args.GetReturnValue().SetUndefined();
+		// a framebuffer can not be sampled while it is drawn into
+		if (canvas->_offscreen == __context) {
+			LOGI("drawImage of a canvas into its own context is not supported");
+			return;
+		}
+		canvasTexture = canvas->_offscreen->texture();
+		if (!canvasTexture) {
+			return;
+		}
+	} else {
+		ImageCallbackHolder* holder = imageFromValue(isolate, args[0]);
+		if (!holder) {
+			isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "drawImage requires an Image")));
+			return;
+		}
+		args.GetReturnValue().SetUndefined();
+		// images that are still loading, or failed to, draw nothing; those of hardware buffers do not need pixels
+		if (!holder->image || holder->image->state() != kEJImageDecoded ||
+				(!holder->image->hardwareBuffer() && !holder->image->ensurePixels())) {
+			return;
+		}
+		image = holder->image;
+	}
+
+	const float width = image ? image->width() : canvasTexture->width;
+	const float height = image ? image->height() : canvasTexture->height;
+	float sx = 0, sy = 0, sw = width, sh = height;
+	float dx, dy, dw = sw, dh = sh;
+	if (args.Length() == 9) {
+		sx = Local<Number>::Cast(args[1])->Value();
+		sy = Local<Number>::Cast(args[2])->Value();
+		sw = Local<Number>::Cast(args[3])->Value();
+		sh = Local<Number>::Cast(args[4])->Value();
+	}
+	const int d = args.Length() == 9 ? 5 : 1;
+	dx = Local<Number>::Cast(args[d])->Value();
+	dy = Local<Number>::Cast(args[d + 1])->Value();
+	if (args.Length() > 3) {
+		dw = Local<Number>::Cast(args[d + 2])->Value();
+		dh = Local<Number>::Cast(args[d + 3])->Value();
+	}
+
+	// the source rect is clipped to the image, the destination shrinks with it; small images share an atlas texture
+	// and must not sample their neighbours
+	if (sw < 0) { sx += sw; sw = -sw; }
+	if (sh < 0) { sy += sh; sh = -sh; }
+	if (sw == 0 || sh == 0) {
+		return;
+	}
+	const float scaleX = dw / sw, scaleY = dh / sh;
+	const float x0 = std::max(sx, 0.0f), y0 = std::max(sy, 0.0f);
+	const float x1 = std::min(sx + sw, width), y1 = std::min(sy + sh, height);
+	if (x1 <= x0 || y1 <= y0) {
+		return;
+	}
+	dx += (x0 - sx) * scaleX;
+	dy += (y0 - sy) * scaleY;
+
+	unrecordable(__context2d, "images are not recorded");
+	if (canvasTexture) {
+		// the framebuffer has its origin in the bottom left corner
+		__context->drawImage(canvasTexture, x0, height - y0, x1 - x0, y0 - y1,
+				dx, dy, (x1 - x0) * scaleX, (y1 - y0) * scaleY);
+		return;
+	}
+	EJImageTexture texture = __context->getTextureCache()->texture(image, __context);
+	if (!texture.texture) {
+		return;
+	}
+	__context->drawImage(texture.texture, texture.x + x0, texture.y + y0, x1 - x0, y1 - y0,
+			dx, dy, (x1 - x0) * scaleX, (y1 - y0) * scaleY);
+}
+
+// Largest ImageData that is created; 4 bytes per pixel have to fit into an int
+#define BGJS_IMAGEDATA_MAX_PIXELS (1 << 28)
+
+// Creates an ImageData object of width x height pixels, all transparent black unless the caller overwrites all of them
+static Local<Object> newImageData(Isolate* isolate, int width, int height, Local<ArrayBuffer>* buffer, bool zeroed = true) {
+	*buffer = zeroed ? ArrayBuffer::New(isolate, (size_t)width * height * 4) :
+			  BGJSV8Engine::GetInstance(isolate)->newUninitializedArrayBuffer((size_t)width * height * 4);
+	Local<Object> imageData = Object::New(isolate);
+	imageData->Set(String::NewFromUtf8(isolate, "width"), Integer::New(isolate, width));
+	imageData->Set(String::NewFromUtf8(isolate, "height"), Integer::New(isolate, height));
+	imageData->Set(String::NewFromUtf8(isolate, "data"), Uint8ClampedArray::New(*buffer, 0, (size_t)width * height * 4));
+	return imageData;
+}
+
+// Reads the size of an ImageData; returns false and throws if value is not one
+static bool imageDataSize(Isolate* isolate, Local<Value> value, int* width, int* height, uint8_t** pixels) {
+	if (value->IsObject()) {
+		Local<Object> obj = value->ToObject(isolate);
+		Local<Value> w = obj->Get(String::NewFromUtf8(isolate, "width"));
+		Local<Value> h = obj->Get(String::NewFromUtf8(isolate, "height"));
+		Local<Value> data = obj->Get(String::NewFromUtf8(isolate, "data"));
+		if (w->IsInt32() && h->IsInt32() && data->IsUint8ClampedArray()) {
+			*width = w.As<Int32>()->Value();
+			*height = h.As<Int32>()->Value();
+			Local<Uint8ClampedArray> array = data.As<Uint8ClampedArray>();
+			if (*width > 0 && *height > 0 && array->Length() >= (size_t)*width * *height * 4) {
+				*pixels = (uint8_t*)array->Buffer()->GetContents().Data() + array->ByteOffset();
+				return true;
+			}
+		}
+	}
+	isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Expected an ImageData")));
+	return false;
+}
+
+// Reads sx, sy, sw, sh of getImageData; a negative size extends the rectangle to the left or up
+static bool imageDataRect(Isolate* isolate, const v8::FunctionCallbackInfo<v8::Value>& args, float* sx, float* sy, int* sw, int* sh) {
+	if (args.Length() < 4) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Not enough parameters")));
+		return false;
+	}
+	*sx = Local<Number>::Cast(args[0])->Value();
+	*sy = Local<Number>::Cast(args[1])->Value();
+	float w = Local<Number>::Cast(args[2])->Value();
+	float h = Local<Number>::Cast(args[3])->Value();
+	if (w < 0) { *sx += w; w = -w; }
+	if (h < 0) { *sy += h; h = -h; }
+	*sw = (int)w;
+	*sh = (int)h;
+	if (*sw <= 0 || *sh <= 0 || (double)*sw * *sh > BGJS_IMAGEDATA_MAX_PIXELS) {
+		isolate->ThrowException(v8::Exception::RangeError(v8::String::NewFromUtf8(isolate, "Invalid ImageData size")));
+		return false;
+	}
+	return true;
 }
 
 static void js_context_createImageData(const v8::FunctionCallbackInfo<v8::Value>& args) {
-	//CONTEXT_FETCH();
+	CONTEXT_FETCH();
 
 	/*
 	 ImageData createImageData(in double sw, in double sh);
 	 ImageData createImageData(in ImageData imagedata);
 	 */
-	//assert(argumentCount==1||argumentCount==2);
-	LOGI("createImageData: unimplemented stub!");
-	args.GetReturnValue().SetUndefined();
+	int width, height;
+	if (args.Length() == 1) {
+		uint8_t* pixels;
+		if (!imageDataSize(isolate, args[0], &width, &height, &pixels)) {
+			return;
+		}
+	} else {
+		if (args.Length() < 2) {
+			isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Not enough parameters")));
+			return;
+		}
+		width = (int)fabs(Local<Number>::Cast(args[0])->Value());
+		height = (int)fabs(Local<Number>::Cast(args[1])->Value());
+		if (width <= 0 || height <= 0 || (double)width * height > BGJS_IMAGEDATA_MAX_PIXELS) {
+			isolate->ThrowException(v8::Exception::RangeError(v8::String::NewFromUtf8(isolate, "Invalid ImageData size")));
+			return;
+		}
+	}
+	Local<ArrayBuffer> buffer;
+	args.GetReturnValue().Set(newImageData(isolate, width, height, &buffer));
 }
 
 static void js_context_getImageData(const v8::FunctionCallbackInfo<v8::Value>& args) {
-	//CONTEXT_FETCH();
+	CONTEXT_FETCH();
+	REQUIRE_IMMEDIATE();
 
 	/*
 	 ImageData getImageData(in double sx, in double sy, in double sw, in double sh);
 	 */
-	//assert(argumentCount==4);
-	LOGI("getImageData: unimplemented stub!");
-	args.GetReturnValue().SetUndefined();
+	float sx, sy;
+	int sw, sh;
+	if (!imageDataRect(isolate, args, &sx, &sy, &sw, &sh)) {
+		return;
+	}
+	// the pixels are read straight into the memory of the typed array; readPixels writes every one of them
+	Local<ArrayBuffer> buffer;
+	Local<Object> imageData = newImageData(isolate, sw, sh, &buffer, false);
+	__context->readPixels(sx, sy, sw, sh, (GLubyte*)buffer->GetContents().Data());
+	args.GetReturnValue().Set(imageData);
+}
+
+static void js_context_getImageDataAsync(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CONTEXT_FETCH();
+	REQUIRE_IMMEDIATE();
+
+	/*
+	 Promise<ImageData> getImageDataAsync(in double sx, in double sy, in double sw, in double sh);
+	 resolved once the gpu has copied the pixels; contexts without GLES3 read synchronously and resolve right away
+	 */
+	float sx, sy;
+	int sw, sh;
+	if (!imageDataRect(isolate, args, &sx, &sy, &sw, &sh)) {
+		return;
+	}
+	Local<Context> context = isolate->GetCurrentContext();
+	Local<Promise::Resolver> resolver;
+	if (!Promise::Resolver::New(context).ToLocal(&resolver)) {
+		return;
+	}
+	Local<ArrayBuffer> buffer;
+	Local<Object> imageData = newImageData(isolate, sw, sh, &buffer);
+
+	BGJSGLView* view = static_cast<BGJSV8Engine2dGL*>(args.This()->ToObject(isolate)->GetAlignedPointerFromInternalField(0))->view;
+	EJPixelReadback* readback = view ? __context->beginReadPixels(sx, sy, sw, sh) : NULL;
+	if (readback) {
+		view->addPixelReadback(readback, imageData, buffer, resolver);
+	} else {
+		__context->readPixels(sx, sy, sw, sh, (GLubyte*)buffer->GetContents().Data());
+		resolver->Resolve(context, imageData).FromMaybe(false);
+	}
+	args.GetReturnValue().Set(resolver->GetPromise());
+}
+
+static void js_context_invalidateRect(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CONTEXT_FETCH();
+	REQUIRE_IMMEDIATE();
+
+	/*
+	 boolean invalidateRect(in double x, in double y, in double w, in double h);
+	 limits the current frame to the union of the invalidated rects, pixels outside of it keep their contents.
+	 has to be called before the first draw call of the frame; false means the frame has to be drawn completely
+	 */
+	REQUIRE_PARAMS(4);
+	float x = Local<Number>::Cast(args[0])->Value();
+	float y = Local<Number>::Cast(args[1])->Value();
+	float w = Local<Number>::Cast(args[2])->Value();
+	float h = Local<Number>::Cast(args[3])->Value();
+
+	BGJSGLView* view = static_cast<BGJSV8Engine2dGL*>(args.This()->ToObject(isolate)->GetAlignedPointerFromInternalField(0))->view;
+	args.GetReturnValue().Set(view != NULL && view->invalidateRect(x, y, w, h));
 }
 
 static void js_context_putImageData(const v8::FunctionCallbackInfo<v8::Value>& args) {
-	//CONTEXT_FETCH();
+	CONTEXT_FETCH();
+	REQUIRE_IMMEDIATE();
 
 	/*
 	 void putImageData(in ImageData imagedata, in double dx, in double dy);
 	 void putImageData(in ImageData imagedata, in double dx, in double dy, in double dirtyX, in double dirtyY, in double dirtyWidth, in double dirtyHeight);
 
 	 */
-	//assert(argumentCount==3||argumentCount==7);
-	LOGI("putImageData: unimplemented stub!");
+	if (args.Length() != 3 && args.Length() != 7) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Wrong number of parameters")));
+		return;
+	}
+	int width, height;
+	uint8_t* pixels;
+	if (!imageDataSize(isolate, args[0], &width, &height, &pixels)) {
+		return;
+	}
+	float dx = Local<Number>::Cast(args[1])->Value();
+	float dy = Local<Number>::Cast(args[2])->Value();
+	unrecordable(__context2d, "image data is not recorded");
+	if (args.Length() == 3) {
+		__context->putPixels(width, height, pixels, dx, dy);
+		return;
+	}
+
+	// only the dirty rectangle, clipped to the image, is put
+	float dirtyX = Local<Number>::Cast(args[3])->Value();
+	float dirtyY = Local<Number>::Cast(args[4])->Value();
+	float dirtyWidth = Local<Number>::Cast(args[5])->Value();
+	float dirtyHeight = Local<Number>::Cast(args[6])->Value();
+	if (dirtyWidth < 0) { dirtyX += dirtyWidth; dirtyWidth = -dirtyWidth; }
+	if (dirtyHeight < 0) { dirtyY += dirtyHeight; dirtyHeight = -dirtyHeight; }
+	const int left = std::max(0, (int)floorf(dirtyX));
+	const int top = std::max(0, (int)floorf(dirtyY));
+	const int right = std::min(width, (int)ceilf(dirtyX + dirtyWidth));
+	const int bottom = std::min(height, (int)ceilf(dirtyY + dirtyHeight));
+	if (right <= left || bottom <= top) {
+		return;
+	}
+	std::vector<uint8_t> dirty((right - left) * (bottom - top) * 4);
+	for (int y = top; y < bottom; y++) {
+		memcpy(&dirty[(y - top) * (right - left) * 4], pixels + (y * width + left) * 4, (right - left) * 4);
+	}
+	__context->putPixels(right - left, bottom - top, dirty.data(), dx + left, dy + top);
+}
+
+static void js_context_submit(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CONTEXT_FETCH();
+	if (args.Length() < 1 || !args[0]->IsFloat32Array()) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "submit requires a Float32Array")));
+		return;
+	}
+	Local<Float32Array> array = Local<Float32Array>::Cast(args[0]);
+	size_t count = array->Length();
+	if (args.Length() > 1 && !args[1]->IsUndefined()) {
+		const double requested = args[1]->IsNumber() ? Local<Number>::Cast(args[1])->Value() : -1;
+		// also false for NaN
+		if (!(requested >= 0 && requested <= count)) {
+			isolate->ThrowException(v8::Exception::RangeError(v8::String::NewFromUtf8(isolate, "submit: count has to be a number from 0 to the length of the array")));
+			return;
+		}
+		count = (size_t)requested;
+	}
+	const float* buffer = (const float*)((const uint8_t*)array->Buffer()->GetContents().Data() + array->ByteOffset());
+
+	// the commands that ran are recorded even if a later one fails, like those of the calls before it
+	const char* error;
+	const size_t done = BGJSRunCanvasCommands(__deferred ? NULL : __context, buffer, count, &error);
+	appendCommands(__context2d, buffer, done);
+	if (error) {
+		isolate->ThrowException(v8::Exception::RangeError(v8::String::NewFromUtf8(isolate, error)));
+		return;
+	}
+	args.GetReturnValue().SetUndefined();
+}
+
+// startRecording(): records the following commands of this context until stopRecording(), also outside of the
+// rendering phase; text, images, gradients, patterns and Path2D objects are drawn but not recorded, so stopRecording
+// refuses recordings that use them
+static void js_context_startRecording(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CREATE_UNESCAPABLE_CONTEXT
+	BGJS_ASSERT_LOCKED(isolate)
+	BGJSV8Engine2dGL *context2d = static_cast<BGJSV8Engine2dGL*>(args.This()->ToObject(isolate)->GetAlignedPointerFromInternalField(0));
+	context2d->recording.clear();
+	context2d->unrecorded = nullptr;
+	context2d->isRecording = true;
+	args.GetReturnValue().SetUndefined();
+}
+
+// stopRecording(): returns a Float32Array of the recorded commands, which submit replays; throws if they would not
+// replay what was drawn
+static void js_context_stopRecording(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CREATE_ESCAPABLE_CONTEXT
+	BGJS_ASSERT_LOCKED(isolate)
+	BGJSV8Engine2dGL *context2d = static_cast<BGJSV8Engine2dGL*>(args.This()->ToObject(isolate)->GetAlignedPointerFromInternalField(0));
+	if (context2d->unrecorded) {
+		const std::string message = std::string("The recording can not be replayed, ") + context2d->unrecorded;
+		context2d->isRecording = false;
+		context2d->unrecorded = nullptr;
+		isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, message.c_str())));
+		return;
+	}
+	const size_t count = context2d->recording.size();
+	Local<ArrayBuffer> buffer = BGJSV8Engine::GetInstance(isolate)->newUninitializedArrayBuffer(count * sizeof(float));
+	if (count) {
+		memcpy(buffer->GetContents().Data(), context2d->recording.data(), count * sizeof(float));
+	}
+	context2d->isRecording = false;
+	std::vector<float>().swap(context2d->recording);
+	args.GetReturnValue().Set(scope.Escape(Float32Array::New(buffer, 0, count)));
+}
+
+// getFrameStats(): what the view sent to gl in the last frame, or null while frame stats are off; gpuTime is in ms
+// and lags a few frames behind, null where it is not measured. queueDepth is the number of frames still on the gpu when
+// the frame was swapped, presentLatency the ms from the swap of the latest finished frame until it was seen finished,
+// null until there is one
+static void js_context_getFrameStats(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	CONTEXT_FETCH_ESCAPABLE();
+
+	// the stats of a pipelined view are written by its render thread
+	const EJFrameStats* stats = __context2d->view && !__deferred ? __context2d->view->lastFrameStats() : NULL;
+	if (!stats) {
+		args.GetReturnValue().SetNull();
+		return;
+	}
+	Local<Object> objRef = Object::New(isolate);
+	objRef->Set(String::NewFromUtf8(isolate, "drawCalls"), Integer::New(isolate, stats->drawCalls));
+	objRef->Set(String::NewFromUtf8(isolate, "vertices"), Integer::New(isolate, stats->vertices));
+	objRef->Set(String::NewFromUtf8(isolate, "textureBinds"), Integer::New(isolate, stats->textureBinds));
+	objRef->Set(String::NewFromUtf8(isolate, "stencilPasses"), Integer::New(isolate, stats->stencilPasses));
+	objRef->Set(String::NewFromUtf8(isolate, "flushes"), Integer::New(isolate, stats->flushes));
+	if (stats->gpuTime >= 0) {
+		objRef->Set(String::NewFromUtf8(isolate, "gpuTime"), Number::New(isolate, stats->gpuTime / 1e6));
+	} else {
+		objRef->Set(String::NewFromUtf8(isolate, "gpuTime"), Null(isolate));
+	}
+	objRef->Set(String::NewFromUtf8(isolate, "queueDepth"), Integer::New(isolate, stats->queueDepth));
+	if (stats->presentLatency >= 0) {
+		objRef->Set(String::NewFromUtf8(isolate, "presentLatency"), Number::New(isolate, stats->presentLatency / 1e6));
+	} else {
+		objRef->Set(String::NewFromUtf8(isolate, "presentLatency"), Null(isolate));
+	}
+
+	args.GetReturnValue().Set(scope.Escape(objRef));
+}
+
+/**
+ * Path2D
+ * A path that is kept across frames; it records its commands, so it can be flattened again when it is drawn
+ * at a different scale, and caches its tessellation between fills.
+ */
+
+// Fetch the EJPath of a Path2D from this
+#define PATH_FETCH() v8::Isolate* isolate = Isolate::GetCurrent(); \
+BGJS_ASSERT_LOCKED(isolate) \
+HandleScope scope(isolate); \
+EJPath* __path = pathFromValue(isolate, args.This()); \
+if (!__path) { \
+	isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Not a Path2D"))); \
+	return; \
+}
+
+// Bail if less than n parameters were passed
+#define REQUIRE_MIN_PARAMS(n)	if (args.Length() < n) { \
+	isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Not enough parameters"))); \
+	return; \
+}
+
+struct PathCallbackHolder {
+    v8::Persistent<v8::Object> persistent;
+    EJPath* path;
+};
+
+static void js_path_destruct(const v8::WeakCallbackInfo<void>& data) {
+	PathCallbackHolder* pathHolder = (PathCallbackHolder*)data.GetParameter();
+
+	pathHolder->persistent.Reset();
+
+	delete pathHolder->path;
+	delete pathHolder;
+}
+
+static void js_path_constructor(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	v8::Isolate* isolate = Isolate::GetCurrent();
+	BGJS_ASSERT_LOCKED(isolate)
+	HandleScope scope(isolate);
+
+	if (!args.IsConstructCall()) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Path2D must be called with new")));
+		return;
+	}
+
+	EJPath* path = new EJPath(true);
+	path->reset();
+	// new Path2D(path) copies the other path; svg path strings are not supported
+	EJPath* other = args.Length() > 0 ? pathFromValue(isolate, args[0]) : NULL;
+	if (other) {
+		path->addPath(*other);
+	} else if (args.Length() > 0 && !args[0]->IsUndefined()) {
+		LOGI("Path2D: only copying another Path2D is supported");
+	}
+
+	Local<Object> self = args.This();
+	self->SetInternalField(0, External::New(isolate, path));
+	PathCallbackHolder* persistentHolder = new PathCallbackHolder();
+	persistentHolder->path = path;
+	persistentHolder->persistent.Reset(isolate, self);
+	persistentHolder->persistent.SetWeak((void*)persistentHolder, js_path_destruct, WeakCallbackType::kParameter);
+	args.GetReturnValue().Set(self);
+}
+
+static void js_path_addPath(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	PATH_FETCH();
+	REQUIRE_MIN_PARAMS(1);
+	EJPath* other = pathFromValue(isolate, args[0]);
+	if (!other) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "addPath requires a Path2D")));
+		return;
+	}
+	if (other != __path) {
+		__path->addPath(*other);
+	}
+	args.GetReturnValue().SetUndefined();
+}
+
+static void js_path_closePath(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	PATH_FETCH();
+	__path->close();
+	args.GetReturnValue().SetUndefined();
+}
+
+static void js_path_moveTo(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	PATH_FETCH();
+	REQUIRE_MIN_PARAMS(2);
+	__path->moveToX(Local<Number>::Cast(args[0])->Value(), Local<Number>::Cast(args[1])->Value());
 	args.GetReturnValue().SetUndefined();
 }
 
+static void js_path_lineTo(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	PATH_FETCH();
+	REQUIRE_MIN_PARAMS(2);
+	__path->lineToX(Local<Number>::Cast(args[0])->Value(), Local<Number>::Cast(args[1])->Value());
+	args.GetReturnValue().SetUndefined();
+}
+
+static void js_path_bezierCurveTo(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	PATH_FETCH();
+	REQUIRE_MIN_PARAMS(6);
+	// the scale is ignored: retained paths flatten for the scale they are drawn at
+	__path->bezierCurveToCpx1(Local<Number>::Cast(args[0])->Value(), Local<Number>::Cast(args[1])->Value(),
+			Local<Number>::Cast(args[2])->Value(), Local<Number>::Cast(args[3])->Value(),
+			Local<Number>::Cast(args[4])->Value(), Local<Number>::Cast(args[5])->Value(), 1);
+	args.GetReturnValue().SetUndefined();
+}
+
+static void js_path_quadraticCurveTo(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	PATH_FETCH();
+	REQUIRE_MIN_PARAMS(4);
+	__path->quadraticCurveToCpx(Local<Number>::Cast(args[0])->Value(), Local<Number>::Cast(args[1])->Value(),
+			Local<Number>::Cast(args[2])->Value(), Local<Number>::Cast(args[3])->Value(), 1);
+	args.GetReturnValue().SetUndefined();
+}
+
+static void js_path_arcTo(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	PATH_FETCH();
+	REQUIRE_MIN_PARAMS(5);
+	__path->arcToX1(Local<Number>::Cast(args[0])->Value(), Local<Number>::Cast(args[1])->Value(),
+			Local<Number>::Cast(args[2])->Value(), Local<Number>::Cast(args[3])->Value(),
+			Local<Number>::Cast(args[4])->Value());
+	args.GetReturnValue().SetUndefined();
+}
+
+static void js_path_arc(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	PATH_FETCH();
+	REQUIRE_MIN_PARAMS(5);
+	const bool antiClockwise = args.Length() > 5 && args[5]->BooleanValue(isolate);
+	__path->arcX(Local<Number>::Cast(args[0])->Value(), Local<Number>::Cast(args[1])->Value(),
+			Local<Number>::Cast(args[2])->Value(), Local<Number>::Cast(args[3])->Value(),
+			Local<Number>::Cast(args[4])->Value(), antiClockwise);
+	args.GetReturnValue().SetUndefined();
+}
+
+static void js_path_rect(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	PATH_FETCH();
+	REQUIRE_MIN_PARAMS(4);
+	const float x = Local<Number>::Cast(args[0])->Value();
+	const float y = Local<Number>::Cast(args[1])->Value();
+	const float w = Local<Number>::Cast(args[2])->Value();
+	const float h = Local<Number>::Cast(args[3])->Value();
+	__path->moveToX(x, y);
+	__path->lineToX(x + w, y);
+	__path->lineToX(x + w, y + h);
+	__path->lineToX(x, y + h);
+	__path->close();
+	args.GetReturnValue().SetUndefined();
+}
+
+// Reads an asset for the decoder threads
+static unsigned char* js_image_loadAsset(const char* path, size_t* length, void* data) {
+	unsigned int assetLength = 0;
+	char* buffer = ((BGJSV8Engine*)data)->loadFile(path, &assetLength);
+	*length = assetLength;
+	return (unsigned char*)buffer;
+}
+
+static void js_image_destruct(const v8::WeakCallbackInfo<void>& data) {
+	ImageCallbackHolder* imageHolder = (ImageCallbackHolder*)data.GetParameter();
+
+	imageHolder->persistent.Reset();
+
+	reportExternalMemory(data.GetIsolate(), &imageHolder->externalMemory, 0);
+	if (imageHolder->image) {
+		imageHolder->image->release();
+	}
+	delete imageHolder;
+}
+
+static void js_image_loaded(BGJSV8Engine* engine, void* data) {
+	ImageLoad* load = (ImageLoad*)data;
+	ImageCallbackHolder* holder = load->holder;
+	const bool current = load->generation == holder->generation;
+	delete load;
+
+	Isolate* isolate = engine->getIsolate();
+	HandleScope scope(isolate);
+	Local<Object> self = Local<Object>::New(isolate, holder->persistent);
+	if (--holder->pending == 0) {
+		holder->persistent.SetWeak((void*)holder, js_image_destruct, WeakCallbackType::kParameter);
+	}
+	if (!current) {
+		return;
+	}
+
+	const bool decoded = holder->image->state() == kEJImageDecoded;
+	holder->complete = true;
+	if (decoded) {
+		holder->width = holder->image->width();
+		holder->height = holder->image->height();
+		const EJCompressedImage* compressed = holder->image->compressed();
+		reportExternalMemory(isolate, &holder->externalMemory,
+				compressed ? (int64_t)compressed->bytes() : (int64_t)holder->width * holder->height * 4);
+	}
+
+	Local<Context> context = isolate->GetCurrentContext();
+	Local<Value> handler = self->Get(String::NewFromUtf8(isolate, decoded ? "onload" : "onerror"));
+	if (!handler->IsFunction()) {
+		return;
+	}
+	TryCatch trycatch(isolate);
+	if (handler.As<Function>()->Call(context, self, 0, nullptr).IsEmpty() && trycatch.HasCaught()) {
+		Local<Value> stackTrace;
+		if (!trycatch.StackTrace(context).ToLocal(&stackTrace)) {
+			stackTrace = trycatch.Exception();
+		}
+		LOGE("Uncaught exception in image %s handler: %s", decoded ? "onload" : "onerror",
+			 JNIV8Marshalling::v8string2string(stackTrace).c_str());
+	}
+}
+
+// Called by the decoder; handlers run on the next tick of the js thread even if the image was decoded already
+static void js_image_decoded(EJImage* image, void* data) {
+	ImageLoad* load = (ImageLoad*)data;
+	load->holder->engine->runOnJSThread(js_image_loaded, load);
+}
+
+static void js_image_constructor(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	v8::Isolate* isolate = Isolate::GetCurrent();
+	BGJS_ASSERT_LOCKED(isolate)
+	HandleScope scope(isolate);
+
+	if (!args.IsConstructCall()) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "Image must be called with new")));
+		return;
+	}
+
+	Local<Object> self = args.This();
+	ImageCallbackHolder* persistentHolder = new ImageCallbackHolder();
+	persistentHolder->engine = BGJSV8Engine::GetInstance(isolate);
+	persistentHolder->image = NULL;
+	persistentHolder->width = persistentHolder->height = 0;
+	persistentHolder->complete = true;
+	persistentHolder->generation = 0;
+	persistentHolder->pending = 0;
+	persistentHolder->externalMemory = 0;
+	self->SetInternalField(0, External::New(isolate, persistentHolder));
+	persistentHolder->persistent.Reset(isolate, self);
+	persistentHolder->persistent.SetWeak((void*)persistentHolder, js_image_destruct, WeakCallbackType::kParameter);
+	args.GetReturnValue().Set(self);
+}
+
+static void js_image_get_src(Local<String> property, const PropertyCallbackInfo<Value>& info) {
+	v8::Isolate* isolate = Isolate::GetCurrent();
+	ImageCallbackHolder* holder = imageFromValue(isolate, info.This());
+	if (holder) {
+		info.GetReturnValue().Set(String::NewFromUtf8(isolate, holder->src.c_str()));
+	}
+}
+
+static void js_image_set_src(Local<String> property, Local<Value> value, const PropertyCallbackInfo<void>& info) {
+	v8::Isolate* isolate = Isolate::GetCurrent();
+	BGJS_ASSERT_LOCKED(isolate)
+	HandleScope scope(isolate);
+	ImageCallbackHolder* holder = imageFromValue(isolate, info.This());
+	if (!holder) {
+		return;
+	}
+
+	String::Utf8Value src(isolate, value);
+	const std::string path = *src ? *src : "";
+	if (holder->image) {
+		holder->image->release();
+		holder->image = NULL;
+	}
+	reportExternalMemory(isolate, &holder->externalMemory, 0);
+	holder->src = path;
+	holder->width = holder->height = 0;
+	holder->generation++;
+	holder->complete = path.empty();
+	if (path.empty()) {
+		return;
+	}
+
+	holder->image = EJImage::load(path.c_str(), js_image_loadAsset, holder->engine);
+	if (holder->pending++ == 0) {
+		holder->persistent.ClearWeak();
+	}
+	ImageLoad* load = new ImageLoad();
+	load->holder = holder;
+	load->generation = holder->generation;
+	holder->image->whenDone(js_image_decoded, load);
+}
+
+static void js_image_get_width(Local<String> property, const PropertyCallbackInfo<Value>& info) {
+	ImageCallbackHolder* holder = imageFromValue(Isolate::GetCurrent(), info.This());
+	info.GetReturnValue().Set(holder ? holder->width : 0);
+}
+
+static void js_image_get_height(Local<String> property, const PropertyCallbackInfo<Value>& info) {
+	ImageCallbackHolder* holder = imageFromValue(Isolate::GetCurrent(), info.This());
+	info.GetReturnValue().Set(holder ? holder->height : 0);
+}
+
+static void js_image_get_complete(Local<String> property, const PropertyCallbackInfo<Value>& info) {
+	ImageCallbackHolder* holder = imageFromValue(Isolate::GetCurrent(), info.This());
+	info.GetReturnValue().Set(holder ? holder->complete : false);
+}
+
 void js_canvas_destruct(const v8::WeakCallbackInfo<void>& data) {
 	CanvasCallbackHolder* canvasHolder = (CanvasCallbackHolder*)data.GetParameter();
 
     canvasHolder->persistent.Reset();
 
+	reportExternalMemory(data.GetIsolate(), &canvasHolder->canvas->_externalMemory, 0);
     delete canvasHolder->canvas;
     delete canvasHolder;
 }
 
 void BGJSGLModule::js_canvas_constructor(const v8::FunctionCallbackInfo<v8::Value>& args) {
     Isolate* isolate = Isolate::GetCurrent();
-	v8::Locker l(isolate);
+	BGJS_ASSERT_LOCKED(isolate)
 	EscapableHandleScope scope(isolate);
 
 	// BGJSGLModule *objPtr = externalToClassPtr<BGJSGLModule>(args.Data());
@@ -1002,9 +2321,58 @@ void BGJSGLModule::js_canvas_constructor(const v8::FunctionCallbackInfo<v8::Valu
 	args.GetReturnValue().Set(scope.Escape(fnLocal));
 }
 
+void BGJSGLModule::js_canvas_createCanvas(const v8::FunctionCallbackInfo<v8::Value>& args) {
+    Isolate* isolate = Isolate::GetCurrent();
+	BGJS_ASSERT_LOCKED(isolate)
+	EscapableHandleScope scope(isolate);
+
+	/*
+	 HTMLCanvasElement createCanvas(in long width, in long height);
+	 offscreen canvas that shares the gl context of the view of this canvas; it can be drawn with drawImage
+	 */
+	BGJSCanvasGL* view = canvasFromValue(isolate, args.This());
+	if (!view || view->_offscreen) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "createCanvas has to be called on the canvas of a view")));
+		return;
+	}
+	if (args.Length() != 2 || !args[0]->IsNumber() || !args[1]->IsNumber()) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "createCanvas requires a width and a height")));
+		return;
+	}
+	// the framebuffer is created right away, which needs the gl context
+	if (view->_view->isPipelined()) {
+		isolate->ThrowException(v8::Exception::Error(v8::String::NewFromUtf8(isolate, "Not available while the view is pipelined")));
+		return;
+	}
+	if (!view->_view->context2d || !view->_view->context2d->_isRendering) {
+		isolate->ThrowException(v8::Exception::ReferenceError(v8::String::NewFromUtf8(isolate, "Can't run when not in rendering phase")));
+		return;
+	}
+
+	MaybeLocal<Object> fn = Local<Function>::New(isolate, BGJSGLModule::g_classRefCanvasGL)->NewInstance(BGJSV8Engine::GetInstance(isolate)->getContext());
+    if (fn.IsEmpty()) {
+        LOGE("js_canvas_createCanvas cannot create BGJSGLModule instance");
+        args.GetReturnValue().SetUndefined();
+        return;
+    }
+	BGJSCanvasGL* canvas = new BGJSCanvasGL();
+	canvas->_view = view->_view;
+	canvas->_offscreen = view->_view->createOffscreenContext((int)Local<Number>::Cast(args[0])->Value(),
+			(int)Local<Number>::Cast(args[1])->Value());
+	reportExternalMemory(isolate, &canvas->_externalMemory, offscreenBytes(canvas->_offscreen));
+
+    Local<Object> fnLocal = fn.ToLocalChecked();
+    fnLocal->SetInternalField(0, External::New(isolate, canvas));
+    CanvasCallbackHolder* persistentHolder = new CanvasCallbackHolder();
+    persistentHolder->canvas = canvas;
+    persistentHolder->persistent.Reset(isolate, fnLocal);
+    persistentHolder->persistent.SetWeak((void*)persistentHolder, js_canvas_destruct, WeakCallbackType::kParameter);
+	args.GetReturnValue().Set(scope.Escape(fnLocal));
+}
+
 void BGJSGLModule::js_canvas_getContext(const v8::FunctionCallbackInfo<v8::Value>& args) {
     Isolate* isolate = Isolate::GetCurrent();
-	v8::Locker l(isolate);
+	BGJS_ASSERT_LOCKED(isolate)
 	EscapableHandleScope scope(isolate);
 	if (!args.This()->IsObject()) {
 		LOGE("js_canvas_getContext got no this object");
@@ -1031,16 +2399,68 @@ void BGJSGLModule::js_canvas_getContext(const v8::FunctionCallbackInfo<v8::Value
     Local<Object> fnLocal = jsObj.ToLocalChecked();
 	BGJS_RESET_PERSISTENT(isolate, context2d->_jsValue, fnLocal);
 
-	context2d->context = canvas->_view->context2d;
-    fnLocal->SetInternalField(0, External::New(isolate, context2d));
+	context2d->context = canvas->_offscreen ? canvas->_offscreen : canvas->_view->context2d;
+	context2d->view = canvas->_view.get();
+    fnLocal->SetAlignedPointerInInternalField(0, context2d);
 	canvas->_context2d = context2d;
 
+	if (canvas->_offscreen) {
+		// offscreen canvases are collected with their context, so they reference each other instead of being held
+		// by a strong handle
+		Local<Context> context = isolate->GetCurrentContext();
+		fnLocal->Set(String::NewFromUtf8(isolate, "canvas"), args.This());
+		args.This()->SetPrivate(context, v8::Private::ForApi(isolate, String::NewFromUtf8(isolate, "BGJSContext2d")), fnLocal);
+		context2d->_jsValue.SetWeak();
+	}
+
 	args.GetReturnValue().Set(scope.Escape(fnLocal));
 }
 
+// setTextureBudget(bytes) limits the image textures of all canvases; the least recently drawn are deleted beyond it and
+// made again when they are drawn the next time
+static void js_setTextureBudget(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	Isolate* isolate = Isolate::GetCurrent();
+	BGJS_ASSERT_LOCKED(isolate)
+	if (args.Length() < 1 || !args[0]->IsNumber() || !(Local<Number>::Cast(args[0])->Value() >= 0)) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "setTextureBudget requires a number of bytes")));
+		return;
+	}
+	EJTextureCache::setByteLimit((size_t)Local<Number>::Cast(args[0])->Value());
+}
+
+// setImageTextureFormat(format) selects the texels of image textures made from now on: "rgba8888" (the default),
+// "rgb565" for opaque images in 16 bits, or "rgba4444" for translucent ones in 16 bits as well
+static void js_setImageTextureFormat(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	Isolate* isolate = Isolate::GetCurrent();
+	BGJS_ASSERT_LOCKED(isolate)
+	String::Utf8Value utf8(isolate, args[0]);
+	const char* format = args.Length() > 0 && args[0]->IsString() ? *utf8 : "";
+	if (strcmp(format, "rgba8888") == 0) {
+		EJTexture::setImageTextureFormat(kEJImageTextureRGBA8888);
+	} else if (strcmp(format, "rgb565") == 0) {
+		EJTexture::setImageTextureFormat(kEJImageTextureRGB565);
+	} else if (strcmp(format, "rgba4444") == 0) {
+		EJTexture::setImageTextureFormat(kEJImageTextureRGBA4444);
+	} else {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "setImageTextureFormat requires \"rgba8888\", \"rgb565\" or \"rgba4444\"")));
+	}
+}
+
+// setPremultipliedAlpha(enabled) decodes images loaded from now on premultiplied by their alpha, so scaled images
+// have no dark fringes and are blended with premultiplied factors
+static void js_setPremultipliedAlpha(const v8::FunctionCallbackInfo<v8::Value>& args) {
+	Isolate* isolate = Isolate::GetCurrent();
+	BGJS_ASSERT_LOCKED(isolate)
+	if (args.Length() < 1 || !args[0]->IsBoolean()) {
+		isolate->ThrowException(v8::Exception::TypeError(v8::String::NewFromUtf8(isolate, "setPremultipliedAlpha requires a boolean")));
+		return;
+	}
+	EJTexture::setPremultipliedAlpha(args[0]->IsTrue());
+}
+
 void BGJSGLModule::doRequire(BGJSV8Engine* engine, v8::Handle<v8::Object> target) {
     v8::Isolate* isolate = engine->getIsolate();
-	v8::Locker l(isolate);
+	BGJS_ASSERT_LOCKED(isolate)
 	HandleScope scope(isolate);
 
 	// Handle<Object> exports = Object::New();
@@ -1061,6 +2481,9 @@ void BGJSGLModule::doRequire(BGJSV8Engine* engine, v8::Handle<v8::Object> target
 	bgjshtmlit->SetCallAsFunctionHandler(BGJSGLModule::js_canvas_constructor);
 	bgjshtmlit->Set(String::NewFromUtf8(isolate, "getContext"),
 			FunctionTemplate::New(isolate, BGJSGLModule::js_canvas_getContext));
+	bgjshtmlit->Set(String::NewFromUtf8(isolate, "createCanvas"),
+			FunctionTemplate::New(isolate, BGJSGLModule::js_canvas_createCanvas));
+	BGJS_RESET_PERSISTENT(isolate, BGJSGLModule::g_templateCanvasGL, bgjshtmlft);
 
 	// bgjsgl->Set(String::NewFromUtf8(isolate, "log"), FunctionTemplate::New(BGJSGLModule::log));
 	Local<Function> instance = bgjshtmlft->GetFunction();
@@ -1095,6 +2518,16 @@ void BGJSGLModule::doRequire(BGJSV8Engine* engine, v8::Handle<v8::Object> target
 	canvasot->SetAccessor(String::NewFromUtf8(isolate, "miterLimit"), js_context_get_miterLimit,
 			js_context_set_miterLimit);
 	canvasot->SetAccessor(String::NewFromUtf8(isolate, "globalCompositeOperation"), js_context_get_globalCompositeOperation, js_context_set_globalCompositeOperation);
+	canvasot->SetAccessor(String::NewFromUtf8(isolate, "shadowColor"), js_context_get_shadowColor,
+			js_context_set_shadowColor);
+	canvasot->SetAccessor(String::NewFromUtf8(isolate, "shadowBlur"), js_context_get_shadowBlur,
+			js_context_set_shadowBlur);
+	canvasot->SetAccessor(String::NewFromUtf8(isolate, "shadowOffsetX"), js_context_get_shadowOffsetX,
+			js_context_set_shadowOffsetX);
+	canvasot->SetAccessor(String::NewFromUtf8(isolate, "shadowOffsetY"), js_context_get_shadowOffsetY,
+			js_context_set_shadowOffsetY);
+	canvasot->SetAccessor(String::NewFromUtf8(isolate, "distanceFieldText"), js_context_get_distanceFieldText,
+			js_context_set_distanceFieldText);
 
 	// Functions
 	canvasot->Set(String::NewFromUtf8(isolate, "beginPath"),
@@ -1123,6 +2556,8 @@ void BGJSGLModule::doRequire(BGJSV8Engine* engine, v8::Handle<v8::Object> target
 			FunctionTemplate::New(isolate, js_context_setTransform));
 	canvasot->Set(String::NewFromUtf8(isolate, "createLinearGradient"),
 			FunctionTemplate::New(isolate, js_context_createLinearGradient));
+	canvasot->Set(String::NewFromUtf8(isolate, "createRadialGradient"),
+			FunctionTemplate::New(isolate, js_context_createRadialGradient));
 	canvasot->Set(String::NewFromUtf8(isolate, "createPattern"),
 			FunctionTemplate::New(isolate, js_context_createPattern));
 	canvasot->Set(String::NewFromUtf8(isolate, "clearRect"),
@@ -1149,26 +2584,105 @@ void BGJSGLModule::doRequire(BGJSV8Engine* engine, v8::Handle<v8::Object> target
 	canvasot->Set(String::NewFromUtf8(isolate, "clipRect"), FunctionTemplate::New(isolate, js_context_clipRect));
 	canvasot->Set(String::NewFromUtf8(isolate, "isPointInPath"),
 			FunctionTemplate::New(isolate, js_context_isPointInPath));
+	canvasot->Set(String::NewFromUtf8(isolate, "isPointInStroke"),
+			FunctionTemplate::New(isolate, js_context_isPointInStroke));
+	canvasot->Set(String::NewFromUtf8(isolate, "addHitRegion"),
+			FunctionTemplate::New(isolate, js_context_addHitRegion));
+	canvasot->Set(String::NewFromUtf8(isolate, "removeHitRegion"),
+			FunctionTemplate::New(isolate, js_context_removeHitRegion));
+	canvasot->Set(String::NewFromUtf8(isolate, "clearHitRegions"),
+			FunctionTemplate::New(isolate, js_context_clearHitRegions));
 	canvasot->Set(String::NewFromUtf8(isolate, "fillText"),
 			FunctionTemplate::New(isolate, js_context_fillText));
 	canvasot->Set(String::NewFromUtf8(isolate, "strokeText"),
 			FunctionTemplate::New(isolate, js_context_strokeText));
+	canvasot->Set(String::NewFromUtf8(isolate, "getFrameStats"),
+			FunctionTemplate::New(isolate, js_context_getFrameStats));
 	canvasot->Set(String::NewFromUtf8(isolate, "measureText"),
 			FunctionTemplate::New(isolate, js_context_measureText));
+	canvasot->Set(String::NewFromUtf8(isolate, "layoutText"),
+			FunctionTemplate::New(isolate, js_context_layoutText));
+	canvasot->Set(String::NewFromUtf8(isolate, "fillTextBox"),
+			FunctionTemplate::New(isolate, js_context_fillTextBox));
+	canvasot->Set(String::NewFromUtf8(isolate, "strokeTextBox"),
+			FunctionTemplate::New(isolate, js_context_strokeTextBox));
 	canvasot->Set(String::NewFromUtf8(isolate, "drawImage"),
 			FunctionTemplate::New(isolate, js_context_drawImage));
 	canvasot->Set(String::NewFromUtf8(isolate, "createImageData"),
 			FunctionTemplate::New(isolate, js_context_createImageData));
 	canvasot->Set(String::NewFromUtf8(isolate, "getImageData"),
 			FunctionTemplate::New(isolate, js_context_getImageData));
+	canvasot->Set(String::NewFromUtf8(isolate, "getImageDataAsync"),
+			FunctionTemplate::New(isolate, js_context_getImageDataAsync));
 	canvasot->Set(String::NewFromUtf8(isolate, "putImageData"),
 			FunctionTemplate::New(isolate, js_context_putImageData));
+	canvasot->Set(String::NewFromUtf8(isolate, "invalidateRect"),
+			FunctionTemplate::New(isolate, js_context_invalidateRect));
 	canvasot->Set(String::NewFromUtf8(isolate, "clipY"),
 			FunctionTemplate::New(isolate, js_context_clipY));
+	canvasot->Set(String::NewFromUtf8(isolate, "submit"), FunctionTemplate::New(isolate, js_context_submit));
+	canvasot->Set(String::NewFromUtf8(isolate, "startRecording"), FunctionTemplate::New(isolate, js_context_startRecording));
+	canvasot->Set(String::NewFromUtf8(isolate, "stopRecording"), FunctionTemplate::New(isolate, js_context_stopRecording));
 
 	BGJS_RESET_PERSISTENT(isolate, g_classRefContext2dGL, canvasft->GetFunction());
 	// g_classRefContext2dGL
 
+	// Create the template for Path2D objects
+	Local<FunctionTemplate> pathft = FunctionTemplate::New(isolate, js_path_constructor);
+	pathft->SetClassName(String::NewFromUtf8(isolate, "Path2D"));
+	pathft->InstanceTemplate()->SetInternalFieldCount(1);
+	Local<ObjectTemplate> pathpt = pathft->PrototypeTemplate();
+	pathpt->Set(String::NewFromUtf8(isolate, "addPath"), FunctionTemplate::New(isolate, js_path_addPath));
+	pathpt->Set(String::NewFromUtf8(isolate, "closePath"), FunctionTemplate::New(isolate, js_path_closePath));
+	pathpt->Set(String::NewFromUtf8(isolate, "moveTo"), FunctionTemplate::New(isolate, js_path_moveTo));
+	pathpt->Set(String::NewFromUtf8(isolate, "lineTo"), FunctionTemplate::New(isolate, js_path_lineTo));
+	pathpt->Set(String::NewFromUtf8(isolate, "bezierCurveTo"), FunctionTemplate::New(isolate, js_path_bezierCurveTo));
+	pathpt->Set(String::NewFromUtf8(isolate, "quadraticCurveTo"),
+			FunctionTemplate::New(isolate, js_path_quadraticCurveTo));
+	pathpt->Set(String::NewFromUtf8(isolate, "arcTo"), FunctionTemplate::New(isolate, js_path_arcTo));
+	pathpt->Set(String::NewFromUtf8(isolate, "arc"), FunctionTemplate::New(isolate, js_path_arc));
+	pathpt->Set(String::NewFromUtf8(isolate, "rect"), FunctionTemplate::New(isolate, js_path_rect));
+	BGJS_RESET_PERSISTENT(isolate, g_templatePath2D, pathft);
+	exports.ToLocalChecked()->Set(String::NewFromUtf8(isolate, "Path2D"), pathft->GetFunction());
+
+	// Create the template for Image objects
+	Local<FunctionTemplate> imageft = FunctionTemplate::New(isolate, js_image_constructor);
+	imageft->SetClassName(String::NewFromUtf8(isolate, "Image"));
+	Local<ObjectTemplate> imageit = imageft->InstanceTemplate();
+	imageit->SetInternalFieldCount(1);
+	imageit->SetAccessor(String::NewFromUtf8(isolate, "src"), js_image_get_src, js_image_set_src);
+	imageit->SetAccessor(String::NewFromUtf8(isolate, "width"), js_image_get_width);
+	imageit->SetAccessor(String::NewFromUtf8(isolate, "height"), js_image_get_height);
+	imageit->SetAccessor(String::NewFromUtf8(isolate, "complete"), js_image_get_complete);
+	BGJS_RESET_PERSISTENT(isolate, g_templateImage, imageft);
+	exports.ToLocalChecked()->Set(String::NewFromUtf8(isolate, "Image"), imageft->GetFunction());
+
+	// Create the templates for gradients and patterns; their objects are only made by the context
+	Local<FunctionTemplate> gradientft = FunctionTemplate::New(isolate);
+	gradientft->SetClassName(String::NewFromUtf8(isolate, "CanvasGradient"));
+	gradientft->InstanceTemplate()->SetInternalFieldCount(1);
+	gradientft->PrototypeTemplate()->Set(String::NewFromUtf8(isolate, "addColorStop"),
+			FunctionTemplate::New(isolate, js_gradient_addColorStop));
+	BGJS_RESET_PERSISTENT(isolate, g_templateCanvasGradient, gradientft);
+
+	Local<FunctionTemplate> patternft = FunctionTemplate::New(isolate);
+	patternft->SetClassName(String::NewFromUtf8(isolate, "CanvasPattern"));
+	patternft->InstanceTemplate()->SetInternalFieldCount(1);
+	BGJS_RESET_PERSISTENT(isolate, g_templateCanvasPattern, patternft);
+
+	// Opcodes of the commands that context.submit executes
+	Local<Object> commands = Object::New(isolate);
+	for (int i = 0; i < kBGJSCommandCount; i++) {
+		commands->Set(String::NewFromUtf8(isolate, kBGJSCanvasCommands[i].name), Integer::New(isolate, i));
+	}
+	exports.ToLocalChecked()->Set(String::NewFromUtf8(isolate, "commands"), commands);
+	exports.ToLocalChecked()->Set(String::NewFromUtf8(isolate, "setTextureBudget"),
+			FunctionTemplate::New(isolate, js_setTextureBudget)->GetFunction());
+	exports.ToLocalChecked()->Set(String::NewFromUtf8(isolate, "setImageTextureFormat"),
+			FunctionTemplate::New(isolate, js_setImageTextureFormat)->GetFunction());
+	exports.ToLocalChecked()->Set(String::NewFromUtf8(isolate, "setPremultipliedAlpha"),
+			FunctionTemplate::New(isolate, js_setPremultipliedAlpha)->GetFunction());
+
 	target->Set(String::NewFromUtf8(isolate, "exports"), exports.ToLocalChecked());
 }
 
@@ -1177,12 +2691,6 @@ BGJSGLModule::~BGJSGLModule() {
 
 }
 
-static void checkGlError(const char* op) {
-	for (GLint error = glGetError(); error; error = glGetError()) {
-		LOGI("after %s() glError (0x%x)\n", op, error);
-	}
-}
-
 JNIEXPORT jint JNICALL Java_ag_boersego_bgjs_ClientAndroid_cssColorToInt(JNIEnv * env, jobject obj, jstring color) {
     const char* nativeString = env->GetStringUTFChars(color, 0);
     EJColorRGBA colorRGBA = bufferToColorRBGA(nativeString, env->GetStringLength(color));
@@ -24,9 +24,15 @@ public:
 
 	static void js_canvas_constructor(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void js_canvas_getContext(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_canvas_createCanvas(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 	static v8::Persistent<v8::Function> g_classRefCanvasGL;
 	static v8::Persistent<v8::Function> g_classRefContext2dGL;
+	static v8::Persistent<v8::FunctionTemplate> g_templatePath2D;
+	static v8::Persistent<v8::FunctionTemplate> g_templateImage;
+	static v8::Persistent<v8::FunctionTemplate> g_templateCanvasGradient;
+	static v8::Persistent<v8::FunctionTemplate> g_templateCanvasPattern;
+	static v8::Persistent<v8::FunctionTemplate> g_templateCanvasGL;
 };
 
 
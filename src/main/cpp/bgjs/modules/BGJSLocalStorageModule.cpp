@@ -0,0 +1,186 @@
+/**
+ * BGJSLocalStorageModule
+ * localStorage on top of BGJSLocalStorage
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSLocalStorageModule.h"
+#include "../BGJSLocalStorage.h"
+#include "../BGJSV8Engine.h"
+
+#include "../../jni/JNIWrapper.h"
+#include "../../v8/JNIV8Wrapper.h"
+
+#define LOG_TAG "BGJSLocalStorageModule"
+
+using namespace v8;
+
+static std::u16string toText(Isolate* isolate, Local<String> string) {
+	std::u16string text(string->Length(), 0);
+	if (!text.empty()) {
+		string->Write(isolate, (uint16_t*) &text[0], 0, (int) text.size(), String::NO_NULL_TERMINATION);
+	}
+	return text;
+}
+
+static Local<String> toString(Isolate* isolate, const std::u16string& text) {
+	return String::NewFromTwoByte(isolate, (const uint16_t*) text.data(), NewStringType::kNormal,
+								  (int) text.size()).ToLocalChecked();
+}
+
+// keys and values are converted like the browsers do it, so setItem("a", 1) stores "1"
+static bool argumentText(const FunctionCallbackInfo<Value>& args, int index, std::u16string* text) {
+	Isolate* isolate = args.GetIsolate();
+	Local<String> string;
+	if (!args[index]->ToString(isolate->GetCurrentContext()).ToLocal(&string)) {
+		return false;
+	}
+	*text = toText(isolate, string);
+	return true;
+}
+
+static BGJSLocalStorage* storeFromData(Local<Value> data) {
+	return (BGJSLocalStorage*) data.As<External>()->Value();
+}
+
+static bool requireArguments(const FunctionCallbackInfo<Value>& args, int count, const char* message) {
+	if (args.Length() < count) {
+		Isolate* isolate = args.GetIsolate();
+		isolate->ThrowException(Exception::TypeError(String::NewFromUtf8(isolate, message)));
+		return false;
+	}
+	return true;
+}
+
+void BGJSLocalStorageModule::js_getItem(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	std::u16string key, value;
+	if (!requireArguments(args, 1, "getItem requires a key") || !argumentText(args, 0, &key)) {
+		return;
+	}
+	if (storeFromData(args.Data())->getItem(key, &value)) {
+		args.GetReturnValue().Set(toString(isolate, value));
+	} else {
+		args.GetReturnValue().SetNull();
+	}
+}
+
+void BGJSLocalStorageModule::js_setItem(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	std::u16string key, value;
+	if (!requireArguments(args, 2, "setItem requires a key and a value") || !argumentText(args, 0, &key) ||
+			!argumentText(args, 1, &value)) {
+		return;
+	}
+	if (!storeFromData(args.Data())->setItem(key, value)) {
+		isolate->ThrowException(Exception::Error(String::NewFromUtf8(isolate, "setItem could not store the item")));
+	}
+}
+
+void BGJSLocalStorageModule::js_removeItem(const FunctionCallbackInfo<Value>& args) {
+	std::u16string key;
+	if (!requireArguments(args, 1, "removeItem requires a key") || !argumentText(args, 0, &key)) {
+		return;
+	}
+	storeFromData(args.Data())->removeItem(key);
+}
+
+void BGJSLocalStorageModule::js_clear(const FunctionCallbackInfo<Value>& args) {
+	storeFromData(args.Data())->clear();
+}
+
+void BGJSLocalStorageModule::js_key(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	if (!requireArguments(args, 1, "key requires an index")) {
+		return;
+	}
+	double index;
+	if (!args[0]->NumberValue(isolate->GetCurrentContext()).To(&index)) {
+		return;
+	}
+	std::u16string key;
+	if (index >= 0 && storeFromData(args.Data())->key((size_t) index, &key)) {
+		args.GetReturnValue().Set(toString(isolate, key));
+	} else {
+		args.GetReturnValue().SetNull();
+	}
+}
+
+void BGJSLocalStorageModule::js_get_length(Local<Name> property, const PropertyCallbackInfo<Value>& info) {
+	info.GetReturnValue().Set((double) storeFromData(info.Data())->length());
+}
+
+void BGJSLocalStorageModule::doRequire(BGJSV8Engine* engine, Handle<Object> target, BGJSLocalStorage* store) {
+	Isolate* isolate = engine->getIsolate();
+	BGJS_ASSERT_LOCKED(isolate)
+	HandleScope scope(isolate);
+	Local<Context> context = engine->getContext();
+
+	// stores live as long as the process, so the functions can hold on to them without a handle of their own
+	Local<External> data = External::New(isolate, store);
+	target->Set(String::NewFromUtf8(isolate, "getItem"),
+				FunctionTemplate::New(isolate, js_getItem, data)->GetFunction(context).ToLocalChecked());
+	target->Set(String::NewFromUtf8(isolate, "setItem"),
+				FunctionTemplate::New(isolate, js_setItem, data)->GetFunction(context).ToLocalChecked());
+	target->Set(String::NewFromUtf8(isolate, "removeItem"),
+				FunctionTemplate::New(isolate, js_removeItem, data)->GetFunction(context).ToLocalChecked());
+	target->Set(String::NewFromUtf8(isolate, "clear"),
+				FunctionTemplate::New(isolate, js_clear, data)->GetFunction(context).ToLocalChecked());
+	target->Set(String::NewFromUtf8(isolate, "key"),
+				FunctionTemplate::New(isolate, js_key, data)->GetFunction(context).ToLocalChecked());
+	target->SetAccessor(context, String::NewFromUtf8(isolate, "length"), js_get_length, nullptr, data).FromJust();
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL
+Java_ag_boersego_bgjs_modules_BGJSModuleLocalStorage_requireNative(JNIEnv *env, jobject obj, jobject engineObj,
+                                                                    jstring path, jobject module,
+                                                                    jobjectArray importKeys,
+                                                                    jobjectArray importValues) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(engineObj);
+
+    const char *pathChars = env->GetStringUTFChars(path, nullptr);
+    BGJSLocalStorage *store = BGJSLocalStorage::open(pathChars);
+    env->ReleaseStringUTFChars(path, pathChars);
+    if (!store) {
+        env->ThrowNew(env->FindClass("java/io/IOException"), "localStorage could not be opened");
+        return;
+    }
+
+    // items of the SharedPreferences that backed localStorage before are only taken over by a new store
+    if (importKeys && store->length() == 0) {
+        for (jsize i = 0, n = env->GetArrayLength(importKeys); i < n; i++) {
+            jstring key = (jstring) env->GetObjectArrayElement(importKeys, i);
+            jstring value = (jstring) env->GetObjectArrayElement(importValues, i);
+            const jchar *keyChars = env->GetStringChars(key, nullptr);
+            const jchar *valueChars = env->GetStringChars(value, nullptr);
+            store->setItem(std::u16string((const char16_t *) keyChars, (size_t) env->GetStringLength(key)),
+                           std::u16string((const char16_t *) valueChars, (size_t) env->GetStringLength(value)));
+            env->ReleaseStringChars(key, keyChars);
+            env->ReleaseStringChars(value, valueChars);
+            env->DeleteLocalRef(key);
+            env->DeleteLocalRef(value);
+        }
+    }
+
+    if (!module) {
+        return;
+    }
+
+    v8::Isolate *isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = engine->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    v8::Local<v8::Object> exports = v8::Object::New(isolate);
+    BGJSLocalStorageModule::doRequire(engine.get(), exports, store);
+    auto moduleObject = JNIV8Wrapper::wrapObject<JNIV8Object>(module);
+    v8::Local<v8::Object> jsModule = moduleObject->getJSObject();
+    jsModule->Set(v8::String::NewFromUtf8(isolate, "exports"), exports);
+}
+
+}
@@ -0,0 +1,29 @@
+#ifndef __BGJSLOCALSTORAGEMODULE_H
+#define __BGJSLOCALSTORAGEMODULE_H	1
+
+#include "../BGJSModule.h"
+
+class BGJSLocalStorage;
+
+/**
+ * BGJSLocalStorageModule
+ * localStorage on top of BGJSLocalStorage; keys and values go straight between the store and v8 strings
+ *
+ * Required through the java module BGJSModuleLocalStorage, which knows where the store lives.
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSLocalStorageModule {
+public:
+	static void doRequire(BGJSV8Engine* engine, v8::Handle<v8::Object> target, BGJSLocalStorage* store);
+
+	static void js_getItem(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_setItem(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_removeItem(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_clear(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_key(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_get_length(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& info);
+};
+
+#endif
@@ -0,0 +1,906 @@
+/**
+ * BGJSMessagePackModule
+ * MessagePack straight between bytes and v8 values
+ *
+ * Licensed under the MIT license.
+ */
+
+#include "BGJSMessagePackModule.h"
+#include "../BGJSV8Engine.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#define LOG_TAG "BGJSMessagePackModule"
+
+using namespace v8;
+
+namespace {
+
+// nesting of arrays and maps; deeper values are rejected before they exhaust the native stack
+const int kMaxDepth = 512;
+
+const int8_t kTimestampExtension = -1;
+
+struct Schema {
+	std::vector<Global<String>> keys;
+	Global<ObjectTemplate> record;
+	Global<Object> handle;
+};
+
+void onSchemaCollected(const WeakCallbackInfo<Schema>& info) {
+	delete info.GetParameter();
+}
+
+// js can not get at private properties, so a schema can not be forged from an object that happens to look like one
+Local<Private> schemaKey(Isolate* isolate) {
+	return Private::ForApi(isolate, String::NewFromUtf8(isolate, "BGJSMessagePackModule::schema",
+														NewStringType::kInternalized).ToLocalChecked());
+}
+
+void throwTypeError(Isolate* isolate, const char* message) {
+	isolate->ThrowException(Exception::TypeError(String::NewFromUtf8(isolate, message)));
+}
+
+class Reader {
+public:
+	Reader(Isolate* isolate, Local<Context> context, const uint8_t* data, size_t length) :
+			_isolate(isolate), _context(context), _data(data), _length(length), _pos(0) {
+	}
+
+	// all read functions return false with an exception pending in the isolate
+	bool readValue(Local<Value>* value, int depth);
+	bool readRecords(Local<Value>* value, Schema* schema);
+	bool finish();
+
+private:
+	bool fail(const char* error);
+	bool require(size_t bytes);
+	uint64_t readUint(int bytes);
+	bool readLength(int bytes, size_t* length);
+	bool readArrayHeader(size_t* count);
+	bool isArrayNext() const;
+	bool readString(size_t length, bool internalize, Local<Value>* value);
+	bool readArray(size_t count, int depth, Local<Value>* value);
+	bool readMap(size_t count, int depth, Local<Value>* value);
+	bool readKey(Local<Value>* key, int depth);
+	bool readBin(size_t length, Local<Value>* value);
+	bool readExt(size_t length, Local<Value>* value);
+
+	Isolate* _isolate;
+	Local<Context> _context;
+	const uint8_t* _data;
+	size_t _length, _pos;
+};
+
+bool Reader::fail(const char* error) {
+	char message[128];
+	snprintf(message, sizeof(message), "msgpack: %s at offset %zu", error, _pos);
+	throwTypeError(_isolate, message);
+	return false;
+}
+
+bool Reader::require(size_t bytes) {
+	if (_length - _pos < bytes) {
+		return fail("unexpected end of data");
+	}
+	return true;
+}
+
+uint64_t Reader::readUint(int bytes) {
+	uint64_t value = 0;
+	for (int i = 0; i < bytes; i++) {
+		value = (value << 8) | _data[_pos++];
+	}
+	return value;
+}
+
+bool Reader::readLength(int bytes, size_t* length) {
+	if (!require((size_t)bytes)) {
+		return false;
+	}
+	*length = (size_t)readUint(bytes);
+	return true;
+}
+
+bool Reader::isArrayNext() const {
+	const uint8_t type = _data[_pos];
+	return (type & 0xf0) == 0x90 || type == 0xdc || type == 0xdd;
+}
+
+bool Reader::readArrayHeader(size_t* count) {
+	const uint8_t type = _data[_pos++];
+	if ((type & 0xf0) == 0x90) {
+		*count = type & 0x0f;
+		return true;
+	}
+	return readLength(type == 0xdc ? 2 : 4, count);
+}
+
+bool Reader::readValue(Local<Value>* value, int depth) {
+	if (depth > kMaxDepth) {
+		return fail("values are nested too deeply");
+	}
+	if (!require(1)) {
+		return false;
+	}
+	const uint8_t type = _data[_pos++];
+	if (type <= 0x7f) {
+		*value = Integer::New(_isolate, type);
+		return true;
+	}
+	if (type >= 0xe0) {
+		*value = Integer::New(_isolate, (int8_t)type);
+		return true;
+	}
+	if ((type & 0xe0) == 0xa0) {
+		return readString(type & 0x1f, false, value);
+	}
+	if ((type & 0xf0) == 0x90) {
+		return readArray(type & 0x0f, depth, value);
+	}
+	if ((type & 0xf0) == 0x80) {
+		return readMap(type & 0x0f, depth, value);
+	}
+
+	size_t length;
+	switch (type) {
+		case 0xc0:
+			*value = Null(_isolate);
+			return true;
+		case 0xc2:
+			*value = False(_isolate);
+			return true;
+		case 0xc3:
+			*value = True(_isolate);
+			return true;
+		case 0xc4:
+		case 0xc5:
+		case 0xc6:
+			return readLength(1 << (type - 0xc4), &length) && readBin(length, value);
+		case 0xc7:
+		case 0xc8:
+		case 0xc9:
+			return readLength(1 << (type - 0xc7), &length) && readExt(length, value);
+		case 0xca: {
+			if (!require(4)) {
+				return false;
+			}
+			const uint32_t bits = (uint32_t)readUint(4);
+			float number;
+			memcpy(&number, &bits, sizeof(number));
+			*value = Number::New(_isolate, number);
+			return true;
+		}
+		case 0xcb: {
+			if (!require(8)) {
+				return false;
+			}
+			const uint64_t bits = readUint(8);
+			double number;
+			memcpy(&number, &bits, sizeof(number));
+			*value = Number::New(_isolate, number);
+			return true;
+		}
+		case 0xcc:
+		case 0xcd:
+		case 0xce:
+		case 0xcf: {
+			const int bytes = 1 << (type - 0xcc);
+			if (!require((size_t)bytes)) {
+				return false;
+			}
+			// 64 bit integers beyond 2^53 lose precision like they would in JSON
+			const uint64_t number = readUint(bytes);
+			if (number <= UINT32_MAX) {
+				*value = Integer::NewFromUnsigned(_isolate, (uint32_t)number);
+			} else {
+				*value = Number::New(_isolate, (double)number);
+			}
+			return true;
+		}
+		case 0xd0:
+		case 0xd1:
+		case 0xd2:
+		case 0xd3: {
+			const int bytes = 1 << (type - 0xd0);
+			if (!require((size_t)bytes)) {
+				return false;
+			}
+			const uint64_t bits = readUint(bytes);
+			int64_t number;
+			switch (bytes) {
+				case 1: number = (int8_t)bits; break;
+				case 2: number = (int16_t)bits; break;
+				case 4: number = (int32_t)bits; break;
+				default: number = (int64_t)bits; break;
+			}
+			if (number >= INT32_MIN && number <= INT32_MAX) {
+				*value = Integer::New(_isolate, (int32_t)number);
+			} else {
+				*value = Number::New(_isolate, (double)number);
+			}
+			return true;
+		}
+		case 0xd4:
+		case 0xd5:
+		case 0xd6:
+		case 0xd7:
+		case 0xd8:
+			return readExt((size_t)1 << (type - 0xd4), value);
+		case 0xd9:
+		case 0xda:
+		case 0xdb:
+			return readLength(1 << (type - 0xd9), &length) && readString(length, false, value);
+		case 0xdc:
+		case 0xdd:
+			return readLength(2 << (type - 0xdc), &length) && readArray(length, depth, value);
+		case 0xde:
+		case 0xdf:
+			return readLength(2 << (type - 0xde), &length) && readMap(length, depth, value);
+		default:
+			_pos--;
+			return fail("invalid type");
+	}
+}
+
+bool Reader::readString(size_t length, bool internalize, Local<Value>* value) {
+	if (!require(length)) {
+		return false;
+	}
+	if (length > (size_t)String::kMaxLength) {
+		return fail("string is too long");
+	}
+	Local<String> string;
+	if (!String::NewFromUtf8(_isolate, (const char*)_data + _pos,
+							 internalize ? NewStringType::kInternalized : NewStringType::kNormal,
+							 (int)length).ToLocal(&string)) {
+		return fail("string is too long");
+	}
+	_pos += length;
+	*value = string;
+	return true;
+}
+
+bool Reader::readArray(size_t count, int depth, Local<Value>* value) {
+	// every element takes at least a byte, so a corrupt count can not make us allocate more than the data
+	if (count > _length - _pos) {
+		return fail("unexpected end of data");
+	}
+	std::vector<Local<Value>> elements(count);
+	for (size_t i = 0; i < count; i++) {
+		if (!readValue(&elements[i], depth + 1)) {
+			return false;
+		}
+	}
+	*value = Array::New(_isolate, elements.data(), count);
+	return true;
+}
+
+bool Reader::readKey(Local<Value>* key, int depth) {
+	if (!require(1)) {
+		return false;
+	}
+	// keys are mostly the same few strings over and over, which internalized strings are looked up instead of copied
+	const uint8_t type = _data[_pos];
+	if ((type & 0xe0) == 0xa0) {
+		_pos++;
+		return readString(type & 0x1f, true, key);
+	}
+	if (type >= 0xd9 && type <= 0xdb) {
+		size_t length;
+		_pos++;
+		return readLength(1 << (type - 0xd9), &length) && readString(length, true, key);
+	}
+	if (!readValue(key, depth + 1)) {
+		return false;
+	}
+	if (!(*key)->IsNumber()) {
+		return fail("map keys have to be strings or numbers");
+	}
+	return true;
+}
+
+bool Reader::readMap(size_t count, int depth, Local<Value>* value) {
+	if (count > (_length - _pos) / 2) {
+		return fail("unexpected end of data");
+	}
+	Local<Object> object = Object::New(_isolate);
+	for (size_t i = 0; i < count; i++) {
+		Local<Value> key, entry;
+		if (!readKey(&key, depth) || !readValue(&entry, depth + 1)) {
+			return false;
+		}
+		// defining instead of setting the properties keeps a "__proto__" key from changing the prototype
+		Maybe<bool> defined = Nothing<bool>();
+		if (key->IsUint32()) {
+			defined = object->CreateDataProperty(_context, key.As<Uint32>()->Value(), entry);
+		} else if (key->IsString()) {
+			defined = object->CreateDataProperty(_context, key.As<String>(), entry);
+		} else {
+			Local<String> name;
+			if (!key->ToString(_context).ToLocal(&name)) {
+				return false;
+			}
+			defined = object->CreateDataProperty(_context, name, entry);
+		}
+		if (defined.IsNothing()) {
+			return false;
+		}
+	}
+	*value = object;
+	return true;
+}
+
+bool Reader::readBin(size_t length, Local<Value>* value) {
+	if (!require(length)) {
+		return false;
+	}
+	Local<ArrayBuffer> buffer = ArrayBuffer::New(_isolate, length);
+	if (length) {
+		memcpy(buffer->GetContents().Data(), _data + _pos, length);
+	}
+	_pos += length;
+	*value = Uint8Array::New(buffer, 0, length);
+	return true;
+}
+
+bool Reader::readExt(size_t length, Local<Value>* value) {
+	if (!require(length + 1)) {
+		return false;
+	}
+	if ((int8_t)_data[_pos] != kTimestampExtension) {
+		return fail("unsupported extension type");
+	}
+	_pos++;
+
+	int64_t seconds;
+	uint32_t nanoseconds;
+	switch (length) {
+		case 4:
+			seconds = (int64_t)readUint(4);
+			nanoseconds = 0;
+			break;
+		case 8: {
+			const uint64_t bits = readUint(8);
+			nanoseconds = (uint32_t)(bits >> 34);
+			seconds = (int64_t)(bits & 0x3ffffffffULL);
+			break;
+		}
+		case 12:
+			nanoseconds = (uint32_t)readUint(4);
+			seconds = (int64_t)readUint(8);
+			break;
+		default:
+			return fail("invalid timestamp");
+	}
+	if (nanoseconds > 999999999) {
+		return fail("invalid timestamp");
+	}
+	// dates only have milliseconds
+	return Date::New(_context, (double)seconds * 1000 + nanoseconds / 1000000).ToLocal(value);
+}
+
+bool Reader::readRecords(Local<Value>* value, Schema* schema) {
+	if (!require(1)) {
+		return false;
+	}
+	size_t count;
+	if (!isArrayNext()) {
+		return fail("records have to be an array");
+	}
+	if (!readArrayHeader(&count)) {
+		return false;
+	}
+	if (count > _length - _pos) {
+		return fail("unexpected end of data");
+	}
+
+	std::vector<Local<String>> keys;
+	keys.reserve(schema->keys.size());
+	for (const Global<String>& key : schema->keys) {
+		keys.push_back(key.Get(_isolate));
+	}
+	Local<ObjectTemplate> recordTemplate = schema->record.Get(_isolate);
+
+	std::vector<Local<Value>> records(count);
+	for (size_t i = 0; i < count; i++) {
+		if (!require(1)) {
+			return false;
+		}
+		// anything but an array, usually nil for a missing record, is decoded as it is
+		if (!isArrayNext()) {
+			if (!readValue(&records[i], 1)) {
+				return false;
+			}
+			continue;
+		}
+		size_t fields;
+		if (!readArrayHeader(&fields)) {
+			return false;
+		}
+		// records from an older schema may lack fields at the end, which stay null
+		if (fields > keys.size()) {
+			return fail("record has more fields than the schema");
+		}
+		Local<Object> record;
+		if (!recordTemplate->NewInstance(_context).ToLocal(&record)) {
+			return false;
+		}
+		for (size_t j = 0; j < fields; j++) {
+			Local<Value> field;
+			if (!readValue(&field, 2) || record->CreateDataProperty(_context, keys[j], field).IsNothing()) {
+				return false;
+			}
+		}
+		records[i] = record;
+	}
+	*value = Array::New(_isolate, records.data(), count);
+	return true;
+}
+
+bool Reader::finish() {
+	if (_pos != _length) {
+		return fail("unexpected data after the value");
+	}
+	return true;
+}
+
+class Writer {
+public:
+	Writer(Isolate* isolate, Local<Context> context) : _isolate(isolate), _context(context) {
+		_out.reserve(256);
+	}
+
+	// all write functions return false with an exception pending in the isolate
+	bool writeValue(Local<Value> value, int depth);
+	bool writeRecords(Local<Value> records, Schema* schema);
+	Local<Uint8Array> result();
+
+private:
+	bool fail(const char* error);
+	void put(uint8_t byte) {
+		_out.push_back(byte);
+	}
+	void putUint(uint64_t value, int bytes);
+	// fixCount is the number of lengths the fix type can hold, type8 is 0 for types without a one byte length
+	void writeHeader(size_t length, uint8_t fixType, size_t fixCount, uint8_t type8, uint8_t type16, uint8_t type32);
+	void writeInteger(int64_t value);
+	void writeNumber(double value);
+	void writeString(Local<String> string);
+	void writeBin(const uint8_t* data, size_t length);
+	bool writeDate(double time);
+	bool writeArray(Local<Array> array, int depth);
+	bool writeObject(Local<Object> object, int depth);
+	bool checkDepth(int depth);
+
+	Isolate* _isolate;
+	Local<Context> _context;
+	std::vector<uint8_t> _out;
+};
+
+bool Writer::fail(const char* error) {
+	char message[128];
+	snprintf(message, sizeof(message), "msgpack: %s", error);
+	throwTypeError(_isolate, message);
+	return false;
+}
+
+void Writer::putUint(uint64_t value, int bytes) {
+	for (int i = bytes - 1; i >= 0; i--) {
+		_out.push_back((uint8_t)(value >> (8 * i)));
+	}
+}
+
+void Writer::writeHeader(size_t length, uint8_t fixType, size_t fixCount, uint8_t type8, uint8_t type16,
+						 uint8_t type32) {
+	if (length < fixCount) {
+		put((uint8_t)(fixType | length));
+	} else if (type8 && length <= 0xff) {
+		put(type8);
+		putUint(length, 1);
+	} else if (length <= 0xffff) {
+		put(type16);
+		putUint(length, 2);
+	} else {
+		put(type32);
+		putUint(length, 4);
+	}
+}
+
+void Writer::writeInteger(int64_t value) {
+	if (value >= 0) {
+		if (value <= 0x7f) {
+			put((uint8_t)value);
+		} else if (value <= 0xff) {
+			put(0xcc);
+			putUint((uint64_t)value, 1);
+		} else if (value <= 0xffff) {
+			put(0xcd);
+			putUint((uint64_t)value, 2);
+		} else if (value <= 0xffffffffLL) {
+			put(0xce);
+			putUint((uint64_t)value, 4);
+		} else {
+			put(0xcf);
+			putUint((uint64_t)value, 8);
+		}
+	} else if (value >= -32) {
+		put((uint8_t)value);
+	} else if (value >= INT8_MIN) {
+		put(0xd0);
+		putUint((uint64_t)value, 1);
+	} else if (value >= INT16_MIN) {
+		put(0xd1);
+		putUint((uint64_t)value, 2);
+	} else if (value >= INT32_MIN) {
+		put(0xd2);
+		putUint((uint64_t)value, 4);
+	} else {
+		put(0xd3);
+		putUint((uint64_t)value, 8);
+	}
+}
+
+void Writer::writeNumber(double value) {
+	// integral numbers that are exact in a double take the smallest integer type; -0 stays a double
+	if (value == trunc(value) && fabs(value) <= 9007199254740991.0 && !(value == 0 && signbit(value))) {
+		writeInteger((int64_t)value);
+		return;
+	}
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	put(0xcb);
+	putUint(bits, 8);
+}
+
+void Writer::writeString(Local<String> string) {
+	const int length = string->Utf8Length(_isolate);
+	writeHeader((size_t)length, 0xa0, 32, 0xd9, 0xda, 0xdb);
+	if (!length) {
+		return;
+	}
+	const size_t pos = _out.size();
+	_out.resize(pos + length);
+	string->WriteUtf8(_isolate, (char*)&_out[pos], length, nullptr,
+					  String::NO_NULL_TERMINATION | String::REPLACE_INVALID_UTF8);
+}
+
+void Writer::writeBin(const uint8_t* data, size_t length) {
+	writeHeader(length, 0, 0, 0xc4, 0xc5, 0xc6);
+	_out.insert(_out.end(), data, data + length);
+}
+
+bool Writer::writeDate(double time) {
+	if (!isfinite(time)) {
+		return fail("invalid date");
+	}
+	// time values are whole milliseconds
+	const int64_t millis = (int64_t)time;
+	const int64_t seconds = millis >= 0 ? millis / 1000 : -((-millis + 999) / 1000);
+	const uint32_t nanoseconds = (uint32_t)(millis - seconds * 1000) * 1000000;
+	if (!nanoseconds && seconds >= 0 && seconds <= 0xffffffffLL) {
+		put(0xd6);
+		put((uint8_t)kTimestampExtension);
+		putUint((uint64_t)seconds, 4);
+	} else if (seconds >= 0 && seconds < (1LL << 34)) {
+		put(0xd7);
+		put((uint8_t)kTimestampExtension);
+		putUint(((uint64_t)nanoseconds << 34) | (uint64_t)seconds, 8);
+	} else {
+		put(0xc7);
+		put(12);
+		put((uint8_t)kTimestampExtension);
+		putUint(nanoseconds, 4);
+		putUint((uint64_t)seconds, 8);
+	}
+	return true;
+}
+
+bool Writer::checkDepth(int depth) {
+	if (depth >= kMaxDepth) {
+		_isolate->ThrowException(Exception::RangeError(
+				String::NewFromUtf8(_isolate, "msgpack: value is nested too deeply or circular")));
+		return false;
+	}
+	return true;
+}
+
+bool Writer::writeArray(Local<Array> array, int depth) {
+	if (!checkDepth(depth)) {
+		return false;
+	}
+	const uint32_t length = array->Length();
+	writeHeader(length, 0x90, 16, 0, 0xdc, 0xdd);
+	for (uint32_t i = 0; i < length; i++) {
+		Local<Value> element;
+		if (!array->Get(_context, i).ToLocal(&element) || !writeValue(element, depth + 1)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool Writer::writeObject(Local<Object> object, int depth) {
+	if (!checkDepth(depth)) {
+		return false;
+	}
+	Local<Array> names;
+	if (!object->GetOwnPropertyNames(_context, static_cast<PropertyFilter>(ONLY_ENUMERABLE | SKIP_SYMBOLS),
+									 KeyConversionMode::kConvertToString).ToLocal(&names)) {
+		return false;
+	}
+
+	// like JSON, properties that hold undefined or functions are left out, so the count is only known after the values
+	const uint32_t count = names->Length();
+	std::vector<Local<Value>> keys, values;
+	keys.reserve(count);
+	values.reserve(count);
+	for (uint32_t i = 0; i < count; i++) {
+		Local<Value> key, value;
+		if (!names->Get(_context, i).ToLocal(&key) || !object->Get(_context, key).ToLocal(&value)) {
+			return false;
+		}
+		if (value->IsUndefined() || value->IsFunction() || value->IsSymbol()) {
+			continue;
+		}
+		keys.push_back(key);
+		values.push_back(value);
+	}
+
+	writeHeader(keys.size(), 0x80, 16, 0, 0xde, 0xdf);
+	for (size_t i = 0; i < keys.size(); i++) {
+		writeString(keys[i].As<String>());
+		if (!writeValue(values[i], depth + 1)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool Writer::writeValue(Local<Value> value, int depth) {
+	if (value->IsInt32()) {
+		writeInteger(value.As<Int32>()->Value());
+	} else if (value->IsNumber()) {
+		writeNumber(value.As<Number>()->Value());
+	} else if (value->IsString()) {
+		writeString(value.As<String>());
+	} else if (value->IsNullOrUndefined() || value->IsFunction() || value->IsSymbol()) {
+		// functions and symbols in arrays become null, as in JSON
+		put(0xc0);
+	} else if (value->IsBoolean()) {
+		put(value->IsTrue() ? 0xc3 : 0xc2);
+	} else if (value->IsArrayBufferView()) {
+		Local<ArrayBufferView> view = value.As<ArrayBufferView>();
+		const uint8_t* data = (const uint8_t*)view->Buffer()->GetContents().Data();
+		writeBin(data ? data + view->ByteOffset() : nullptr, view->ByteLength());
+	} else if (value->IsArrayBuffer()) {
+		ArrayBuffer::Contents contents = value.As<ArrayBuffer>()->GetContents();
+		writeBin((const uint8_t*)contents.Data(), contents.ByteLength());
+	} else if (value->IsDate()) {
+		return writeDate(value.As<Date>()->ValueOf());
+	} else if (value->IsNumberObject()) {
+		writeNumber(value.As<NumberObject>()->ValueOf());
+	} else if (value->IsStringObject()) {
+		writeString(value.As<StringObject>()->ValueOf());
+	} else if (value->IsBooleanObject()) {
+		put(value.As<BooleanObject>()->ValueOf() ? 0xc3 : 0xc2);
+	} else if (value->IsArray()) {
+		return writeArray(value.As<Array>(), depth);
+	} else if (value->IsObject()) {
+		return writeObject(value.As<Object>(), depth);
+	} else {
+		return fail("value can not be encoded");
+	}
+	return true;
+}
+
+bool Writer::writeRecords(Local<Value> value, Schema* schema) {
+	if (!value->IsArray()) {
+		return fail("records have to be an array");
+	}
+	Local<Array> records = value.As<Array>();
+	const uint32_t count = records->Length();
+	std::vector<Local<String>> keys;
+	keys.reserve(schema->keys.size());
+	for (const Global<String>& key : schema->keys) {
+		keys.push_back(key.Get(_isolate));
+	}
+
+	writeHeader(count, 0x90, 16, 0, 0xdc, 0xdd);
+	for (uint32_t i = 0; i < count; i++) {
+		Local<Value> element;
+		if (!records->Get(_context, i).ToLocal(&element)) {
+			return false;
+		}
+		if (element->IsNullOrUndefined()) {
+			put(0xc0);
+			continue;
+		}
+		if (!element->IsObject() || element->IsArray()) {
+			return fail("records have to be objects");
+		}
+		Local<Object> record = element.As<Object>();
+		writeHeader(keys.size(), 0x90, 16, 0, 0xdc, 0xdd);
+		for (const Local<String>& key : keys) {
+			Local<Value> field;
+			if (!record->Get(_context, key).ToLocal(&field) || !writeValue(field, 2)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+Local<Uint8Array> Writer::result() {
+	Local<ArrayBuffer> buffer = ArrayBuffer::New(_isolate, _out.size());
+	if (!_out.empty()) {
+		memcpy(buffer->GetContents().Data(), _out.data(), _out.size());
+	}
+	return Uint8Array::New(buffer, 0, _out.size());
+}
+
+// the bytes of an ArrayBuffer or a view of one, which are read in place
+bool argumentBytes(const FunctionCallbackInfo<Value>& args, const char* message, const uint8_t** data,
+				   size_t* length) {
+	Local<Value> value = args[0];
+	if (value->IsArrayBufferView()) {
+		Local<ArrayBufferView> view = value.As<ArrayBufferView>();
+		*data = (const uint8_t*)view->Buffer()->GetContents().Data() + view->ByteOffset();
+		*length = view->ByteLength();
+		return true;
+	}
+	if (value->IsArrayBuffer()) {
+		ArrayBuffer::Contents contents = value.As<ArrayBuffer>()->GetContents();
+		*data = (const uint8_t*)contents.Data();
+		*length = contents.ByteLength();
+		return true;
+	}
+	throwTypeError(args.GetIsolate(), message);
+	return false;
+}
+
+Schema* argumentSchema(const FunctionCallbackInfo<Value>& args, int index, const char* message) {
+	Isolate* isolate = args.GetIsolate();
+	Local<Value> value;
+	if (args[index]->IsObject() &&
+		args[index].As<Object>()->GetPrivate(isolate->GetCurrentContext(), schemaKey(isolate)).ToLocal(&value) &&
+		value->IsExternal()) {
+		return (Schema*)value.As<External>()->Value();
+	}
+	throwTypeError(isolate, message);
+	return nullptr;
+}
+
+void setFunction(Isolate* isolate, Local<Context> context, Handle<Object> target, const char* name,
+				 FunctionCallback callback) {
+	target->Set(String::NewFromUtf8(isolate, name),
+				FunctionTemplate::New(isolate, callback)->GetFunction(context).ToLocalChecked());
+}
+
+}
+
+MaybeLocal<Value> BGJSMessagePackModule::decode(Isolate* isolate, Local<Context> context, const uint8_t* data,
+												size_t length) {
+	EscapableHandleScope scope(isolate);
+	Reader reader(isolate, context, data, length);
+	Local<Value> value;
+	if (!reader.readValue(&value, 0) || !reader.finish()) {
+		return MaybeLocal<Value>();
+	}
+	return scope.Escape(value);
+}
+
+void BGJSMessagePackModule::js_decode(const FunctionCallbackInfo<Value>& args) {
+	const uint8_t* data;
+	size_t length;
+	if (!argumentBytes(args, "decode requires an ArrayBuffer or a view of one", &data, &length)) {
+		return;
+	}
+	Local<Value> value;
+	if (decode(args.GetIsolate(), args.GetIsolate()->GetCurrentContext(), data, length).ToLocal(&value)) {
+		args.GetReturnValue().Set(value);
+	}
+}
+
+void BGJSMessagePackModule::js_encode(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	Writer writer(isolate, isolate->GetCurrentContext());
+	if (writer.writeValue(args[0], 0)) {
+		args.GetReturnValue().Set(writer.result());
+	}
+}
+
+void BGJSMessagePackModule::js_createSchema(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	Local<Context> context = isolate->GetCurrentContext();
+	if (!args[0]->IsArray()) {
+		throwTypeError(isolate, "createSchema requires an array of keys");
+		return;
+	}
+	Local<Array> keys = args[0].As<Array>();
+	const uint32_t count = keys->Length();
+
+	std::unique_ptr<Schema> schema(new Schema());
+	std::set<std::string> seen;
+	// every record starts out with all fields, so records of a schema share a single hidden class
+	Local<ObjectTemplate> recordTemplate = ObjectTemplate::New(isolate);
+	for (uint32_t i = 0; i < count; i++) {
+		Local<Value> key;
+		if (!keys->Get(context, i).ToLocal(&key)) {
+			return;
+		}
+		if (!key->IsString()) {
+			throwTypeError(isolate, "createSchema requires an array of keys");
+			return;
+		}
+		const String::Utf8Value text(isolate, key);
+		if (!seen.insert(std::string(*text, (size_t)text.length())).second) {
+			throwTypeError(isolate, "createSchema requires keys to be unique");
+			return;
+		}
+		Local<String> name = String::NewFromUtf8(isolate, *text, NewStringType::kInternalized,
+												 text.length()).ToLocalChecked();
+		schema->keys.emplace_back(isolate, name);
+		recordTemplate->Set(name, Null(isolate));
+	}
+	schema->record.Reset(isolate, recordTemplate);
+
+	Local<Object> object = Object::New(isolate);
+	if (object->SetPrivate(context, schemaKey(isolate), External::New(isolate, schema.get())).IsNothing() ||
+		object->CreateDataProperty(context, String::NewFromUtf8(isolate, "length"),
+								   Integer::NewFromUnsigned(isolate, count)).IsNothing()) {
+		return;
+	}
+	schema->handle.Reset(isolate, object);
+	schema->handle.SetWeak(schema.get(), onSchemaCollected, WeakCallbackType::kParameter);
+	schema.release();
+	args.GetReturnValue().Set(object);
+}
+
+void BGJSMessagePackModule::js_decodeRecords(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	const uint8_t* data;
+	size_t length;
+	Schema* schema;
+	if (!argumentBytes(args, "decodeRecords requires an ArrayBuffer or a view of one", &data, &length) ||
+		!(schema = argumentSchema(args, 1, "decodeRecords requires a schema from createSchema"))) {
+		return;
+	}
+	Reader reader(isolate, isolate->GetCurrentContext(), data, length);
+	Local<Value> value;
+	if (reader.readRecords(&value, schema) && reader.finish()) {
+		args.GetReturnValue().Set(value);
+	}
+}
+
+void BGJSMessagePackModule::js_encodeRecords(const FunctionCallbackInfo<Value>& args) {
+	Isolate* isolate = args.GetIsolate();
+	Schema* schema = argumentSchema(args, 1, "encodeRecords requires a schema from createSchema");
+	if (!schema) {
+		return;
+	}
+	Writer writer(isolate, isolate->GetCurrentContext());
+	if (writer.writeRecords(args[0], schema)) {
+		args.GetReturnValue().Set(writer.result());
+	}
+}
+
+void BGJSMessagePackModule::doRequire(BGJSV8Engine* engine, Handle<Object> target) {
+	Isolate* isolate = engine->getIsolate();
+	BGJS_ASSERT_LOCKED(isolate)
+	HandleScope scope(isolate);
+	// modules are required in the context that asked for them, which may be an isolated one
+	Local<Context> context = isolate->GetCurrentContext();
+
+	setFunction(isolate, context, target, "decode", js_decode);
+	setFunction(isolate, context, target, "encode", js_encode);
+	setFunction(isolate, context, target, "createSchema", js_createSchema);
+	setFunction(isolate, context, target, "decodeRecords", js_decodeRecords);
+	setFunction(isolate, context, target, "encodeRecords", js_encodeRecords);
+}
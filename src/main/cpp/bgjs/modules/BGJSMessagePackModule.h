@@ -0,0 +1,44 @@
+#ifndef __BGJSMESSAGEPACKMODULE_H
+#define __BGJSMESSAGEPACKMODULE_H	1
+
+#include "../BGJSModule.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * BGJSMessagePackModule
+ * MessagePack straight between bytes and v8 values
+ *
+ * Decoding in js creates a string for every key and a closure for every value, and JSON.parse of a payload that came
+ * over the wire in a binary format needs a conversion to text first. The codec here reads the bytes of an
+ * ArrayBuffer or view in place and creates the values through the api, with internalized map keys. For the common
+ * payload of many records with the same fields, a schema created from the field names lets decodeRecords turn an
+ * array of arrays into objects of the same shape, which never repeats the keys on the wire and keeps property
+ * access in js monomorphic.
+ *
+ * Required as "msgpack": decode(buffer), encode(value), createSchema(keys), decodeRecords(buffer, schema) and
+ * encodeRecords(records, schema).
+ *
+ * Licensed under the MIT license.
+ */
+
+class BGJSMessagePackModule {
+public:
+	static void doRequire(BGJSV8Engine* engine, v8::Handle<v8::Object> target);
+
+	/**
+	 * decodes the single value in data; throws a TypeError into the isolate and returns an empty handle if data is
+	 * not valid MessagePack, uses extension types other than timestamps or has bytes after the value
+	 */
+	static v8::MaybeLocal<v8::Value> decode(v8::Isolate* isolate, v8::Local<v8::Context> context, const uint8_t* data,
+											size_t length);
+
+	static void js_decode(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_encode(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_createSchema(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_decodeRecords(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void js_encodeRecords(const v8::FunctionCallbackInfo<v8::Value>& args);
+};
+
+#endif
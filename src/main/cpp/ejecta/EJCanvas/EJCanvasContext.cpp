@@ -1,22 +1,30 @@
 #include "EJCanvasContext.h"
+#include "EJPixelReadback.h"
 #include "EJFont.h"
+#include "EJGLBackend.h"
+#include "EJGLState.h"
+#include "EJExternalTexture.h"
+#include "EJPixelKernels.h"
+#include "EJVertexTransform.h"
 
 #include "stdlib.h"
 #include "mallocdebug.h"
 
 #include "NdkMisc.h"
+#include "../../bgjs/BGJSTrace.h"
 #define LOG_TAG	"EJCanvasContext"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-
-EJVertex CanvasVertexBuffer[EJ_CANVAS_VERTEX_BUFFER_SIZE];
+#include <stddef.h>
+#include <math.h>
+#include <algorithm>
 
 #undef EJ_MSAA
 
 // #define SIMPLE	1
 
-EJCanvasContext::EJCanvasContext (short widthp, short heightp) {
+EJCanvasContext::EJCanvasContext (short widthp, short heightp, EJCanvasResources *resourcesp) {
 	std::memset(stateStack, 0, sizeof(stateStack));
 	stateIndex = 0;
 	state = &stateStack[stateIndex];
@@ -33,31 +41,44 @@ EJCanvasContext::EJCanvasContext (short widthp, short heightp) {
 	state->fontName = "Arial";
 	state->fontSize = 10;
 	vertexBufferBound = false;
+	frameBegun = true;
 
 	bufferWidth = viewportWidth = width = widthp;
 	bufferHeight = viewportHeight = height = heightp;
 
-	path = new EJPath();
+	path = new EJPath(false, &frameArena);
 	backingStoreRatio = 1;
-	_font = NULL;
-
-	// TODO: Font
-	// fontCache = [[NSCache alloc] init];
-	// fontCache.countLimit = 8;
+	distanceFieldText = false;
+	textOutline = 0;
+	if( resourcesp ) {
+		resourcesp->retain();
+		resources = resourcesp;
+	}
+	else {
+		resources = new EJCanvasResources();
+	}
+	fontCache = resources->fontCache();
+	textureCache = resources->textureCache();
+	backend = EJGLBackend::create();
+	shadowCache = new EJShadowCache(backend);
+	shadowCapture = false;
+	frameStats = NULL;
+
+	vertexBufferSize = EJ_CANVAS_VERTEX_BUFFER_SIZE;
+	vertexBuffer = (EJVertex*)malloc(vertexBufferSize * sizeof(EJVertex));
+	sortedVertexBuffer = (EJVertex*)malloc(vertexBufferSize * sizeof(EJVertex));
+	vertexBufferIndex = 0;
+	commandFirst = -1;
+	currentTexture = NULL;
+	paintActive = false;
+	memset(vertexBufferObjects, 0, sizeof(vertexBufferObjects));
+	vertexBufferObjectIndex = 0;
 
 	msaaEnabled = NO;
 	msaaSamples = 2;
 	// scaleX(1, 1);
 }
 
-static void checkGlError(const char* op) {
-#ifdef DEBUG_GL
-	for (GLint error = glGetError(); error; error = glGetError()) {
-		LOGI("after %s() glError (0x%x)\n", op, error);
-	}
-#endif
-}
-
 EJCanvasContext* EJCanvasContext::initWithWidth (short widthp, short heightp) {
 	EJCanvasContext* self = new EJCanvasContext(widthp, heightp);
 
@@ -83,11 +104,8 @@ EJCanvasContext* EJCanvasContext::initWithWidth (short widthp, short heightp) {
 
 	path = new EJPath();
 	backingStoreRatio = 1;
-	_font = NULL;
-
-	// TODO: Font
-	// fontCache = [[NSCache alloc] init];
-	// fontCache.countLimit = 8;
+	distanceFieldText = false;
+	textOutline = 0;
 
 	msaaEnabled = NO;
 	msaaSamples = 2;
@@ -96,15 +114,20 @@ EJCanvasContext* EJCanvasContext::initWithWidth (short widthp, short heightp) {
 }
 
 EJCanvasContext::~EJCanvasContext() {
-	// TODO: Font
-	/* if (fontCache) {
-		delete fontCache;
+	for( int i = 0; i <= stateIndex; i++ ) {
+		if( stateStack[i].fillPaint ) { stateStack[i].fillPaint->release(); }
+		if( stateStack[i].strokePaint ) { stateStack[i].strokePaint->release(); }
 	}
+	for( std::list<EJCanvasPaintTexture>::iterator it = paintTextures.begin(); it != paintTextures.end(); ++it ) {
+		delete it->texture;
+	}
+	resources->release();
+	delete shadowCache;
+	delete backend;
 
-	// Release all fonts from the stack
-	for( int i = 0; i < stateIndex + 1; i++ ) {
-		[stateStack[i].font release];
-	} */
+	if( vertexBufferObjects[0] ) { glDeleteBuffers(EJ_CANVAS_VERTEX_BUFFER_OBJECTS, vertexBufferObjects); }
+	free(vertexBuffer);
+	free(sortedVertexBuffer);
 
 	if( viewFrameBuffer ) { COMPAT_glDeleteFramebuffers( 1, &viewFrameBuffer); }
 	if( viewRenderBuffer ) { COMPAT_glDeleteRenderbuffers(1, &viewRenderBuffer); }
@@ -146,9 +169,9 @@ void EJCanvasContext::createStencilBufferOnce () {
 
 	#ifndef SIMPLE_STENCIL
 	COMPAT_glGenRenderbuffers(1, &stencilBuffer);
-	checkGlError("COMPAT_glGenRenderbuffers(createStencilBufferOnce)");
+	EJ_CHECK_GL_ERROR("COMPAT_glGenRenderbuffers(createStencilBufferOnce)");
 	COMPAT_glBindRenderbuffer(COMPAT_GL_RENDERBUFFER, stencilBuffer);
-	checkGlError("COMPAT_glBindRenderbuffer(createStencilBufferOnce)");
+	EJ_CHECK_GL_ERROR("COMPAT_glBindRenderbuffer(createStencilBufferOnce)");
 
 #ifdef EJ_MSAA
 	if( msaaEnabled ) {
@@ -161,40 +184,31 @@ void EJCanvasContext::createStencilBufferOnce () {
 	}
 #endif
 	COMPAT_glFramebufferRenderbuffer(COMPAT_GL_FRAMEBUFFER, COMPAT_GL_STENCIL_ATTACHMENT, COMPAT_GL_RENDERBUFFER, stencilBuffer);
-	checkGlError("COMPAT_glFramebufferRenderbuffer(createStencilBufferOnce)");
+	EJ_CHECK_GL_ERROR("COMPAT_glFramebufferRenderbuffer(createStencilBufferOnce)");
 
 	// COMPAT_glBindRenderbuffer(COMPAT_GL_RENDERBUFFER, msaaEnabled ? msaaRenderBuffer : viewRenderBuffer );
 
 	glClear(GL_STENCIL_BUFFER_BIT);
-	checkGlError("glClear(createStencilBufferOnce)");
+	EJ_CHECK_GL_ERROR("glClear(createStencilBufferOnce)");
 #endif
 }
 
 void EJCanvasContext::bindVertexBuffer() {
-	glVertexPointer(2, GL_FLOAT, sizeof(EJVertex), &CanvasVertexBuffer[0].pos.x);
-	checkGlError("glVertexPointer(bindVertexBuffer)");
-	glTexCoordPointer(2, GL_FLOAT, sizeof(EJVertex), &CanvasVertexBuffer[0].uv.x);
-	checkGlError("glTexCoordPointer(bindVertexBuffer)");
-	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(EJVertex), &CanvasVertexBuffer[0].color);
-	checkGlError("glColorPointer(bindVertexBuffer)");
-
-	glEnableClientState(GL_VERTEX_ARRAY);
-	checkGlError("glEnableClientState(bindVertexBuffer)");
-	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-	checkGlError("glEnableClientState(bindVertexBuffer)");
-	glEnableClientState(GL_COLOR_ARRAY);
-	checkGlError("glEnableClientState(bindVertexBuffer)");
+	backend->enableVertexArrays();
+	EJ_CHECK_GL_ERROR("enableVertexArrays(bindVertexBuffer)");
 
 	vertexBufferIndex = 0;
 }
 
 void EJCanvasContext::setState() {
 	EJCompositeOperation op = state->globalCompositeOperation;
-	glBlendFunc( EJCompositeOperationFuncs[op].source, EJCompositeOperationFuncs[op].destination );
-	checkGlError("glBlendFunc(prepare)");
+	EJGLState::blendFunc( EJCompositeOperationFuncs[op].source, EJCompositeOperationFuncs[op].destination );
+	EJ_CHECK_GL_ERROR("EJGLState::blendFunc(prepare)");
 }
 
 void EJCanvasContext::prepare() {
+	this->flushBuffers();
+
 	// Bind the frameBuffer and vertexBuffer array
 #ifndef SIMPLE_STENCIL
 	/* COMPAT_glBindFramebuffer(COMPAT_GL_FRAMEBUFFER, msaaEnabled ? msaaFrameBuffer : viewFrameBuffer );
@@ -203,27 +217,18 @@ void EJCanvasContext::prepare() {
 
 	glViewport(0, 0, viewportWidth, viewportHeight);
 	LOGD("prepare. New viewport %ux%u for projection %ux%u", viewportWidth, viewportHeight, width, height);
-	checkGlError("glViewport(prepare)");
-
-	glMatrixMode(GL_PROJECTION);
-	checkGlError("glMatrixMode(prepare)");
-	glLoadIdentity();
-	checkGlError("glLoadIdentity(prepare)");
-	glOrthof(0, width, 0, height, -1, 1);
-	checkGlError("glOrthof(prepare)");
+	EJ_CHECK_GL_ERROR("glViewport(prepare)");
 
-	glMatrixMode(GL_MODELVIEW);
-	checkGlError("glMatrixMode(prepare)");
-	glLoadIdentity();
-	checkGlError("glLoadIdentity(prepare)");
+	backend->setProjection(width, height, false);
+	EJ_CHECK_GL_ERROR("setProjection(prepare)");
 
 #ifndef SIMPLE
 	EJCompositeOperation op = state->globalCompositeOperation;
-	glBlendFunc( EJCompositeOperationFuncs[op].source, EJCompositeOperationFuncs[op].destination );
-	checkGlError("glBlendFunc(prepare)");
+	EJGLState::blendFunc( EJCompositeOperationFuncs[op].source, EJCompositeOperationFuncs[op].destination );
+	EJ_CHECK_GL_ERROR("EJGLState::blendFunc(prepare)");
 #endif
-	glDisable(GL_TEXTURE_2D);
-	checkGlError("glDisable(prepare)");
+	backend->setFill(kEJGLFillSolid);
+	EJ_CHECK_GL_ERROR("setFill(prepare)");
 	currentTexture = NULL;
 
 	if (!vertexBufferBound) {
@@ -233,110 +238,521 @@ void EJCanvasContext::prepare() {
 }
 
 void EJCanvasContext::setTexture (EJTexture *newTexture) {
-	if( currentTexture == newTexture ) { return; }
+	// only recorded; the texture is bound when the batches are flushed
+	currentTexture = newTexture;
+}
 
-	this->flushBuffers();
+void EJCanvasContext::setCoverageTexture (float *u0, float *u1, float *v) {
+	EJGlyphAtlas *atlas = fontCache->atlas();
+	this->setTexture(atlas->solidTexture(commands.empty() ? NULL : batches[commands.back().batch].texture));
+	*u0 = atlas->rampTexCoord0();
+	*u1 = atlas->rampTexCoord1();
+	*v = atlas->whiteTexCoord();
+}
 
-	if( !newTexture && currentTexture ) {
-		// Was enabled; should be disabled
-		glDisable(GL_TEXTURE_2D);
+void EJCanvasContext::beginCommand() {
+	this->endCommand();
+
+	// solid fills sample the white texels of the font atlas, preferably on the page text was drawn with last
+	commandSolid = !currentTexture;
+	commandTexture = currentTexture;
+	if( commandSolid ) {
+		commandTexture = fontCache->atlas()->solidTexture(commands.empty() ? NULL : batches[commands.back().batch].texture);
+	}
+	commandCompositeOperation = state->globalCompositeOperation;
+	commandOutline = textOutline;
+	commandFirst = vertexBufferIndex;
+}
+
+void EJCanvasContext::endCommand() {
+	if( commandFirst < 0 ) { return; }
+
+	const int first = commandFirst;
+	const int count = vertexBufferIndex - commandFirst;
+	commandFirst = -1;
+	if( count <= 0 ) { return; }
+
+	EJVertex * vb = &vertexBuffer[first];
+	float minX = vb[0].pos.x, minY = vb[0].pos.y, maxX = minX, maxY = minY;
+	for( int i = 1; i < count; i++ ) {
+		minX = MIN(minX, vb[i].pos.x);
+		minY = MIN(minY, vb[i].pos.y);
+		maxX = MAX(maxX, vb[i].pos.x);
+		maxY = MAX(maxY, vb[i].pos.y);
 	}
-	else if( newTexture && !currentTexture ) {
-		// Was disabled; should be enabled
-		glEnable(GL_TEXTURE_2D);
+	if( commandSolid ) {
+		const float white = fontCache->atlas()->whiteTexCoord();
+		for( int i = 0; i < count; i++ ) {
+			vb[i].uv = (EJVector2) { white, white };
+		}
+	}
+	else if( commandTexture->isPremultiplied() ) {
+		// the color modulates the texels, so it has to be premultiplied as well
+		for( int i = 0; i < count; i++ ) {
+			EJColorRGBA &color = vb[i].color;
+			const unsigned a = color.rgba.a;
+			color.rgba.r = EJPremultiply(color.rgba.r, a);
+			color.rgba.g = EJPremultiply(color.rgba.g, a);
+			color.rgba.b = EJPremultiply(color.rgba.b, a);
+		}
 	}
 
-	currentTexture = newTexture;
-	if (currentTexture) {
-		currentTexture->bind();
+	// look for a batch with the same state that can be moved past everything drawn after it
+	int target = -1;
+	const int last = (int)batches.size() - 1;
+	for( int i = last; i >= 0 && i > last - EJ_CANVAS_BATCH_SEARCH_DEPTH; i-- ) {
+		const EJCanvasBatch &batch = batches[i];
+		if( batch.texture == commandTexture && batch.compositeOperation == commandCompositeOperation &&
+				batch.outline == commandOutline ) {
+			target = i;
+			break;
+		}
+		if( minX < batch.maxX && batch.minX < maxX && minY < batch.maxY && batch.minY < maxY ) {
+			break;
+		}
 	}
+
+	if( target < 0 ) {
+		EJCanvasBatch batch = { commandTexture, commandCompositeOperation, commandOutline, minX, minY, maxX, maxY, 0, 0, 0 };
+		batches.push_back(batch);
+		target = (int)batches.size() - 1;
+	}
+	else {
+		EJCanvasBatch &batch = batches[target];
+		batch.minX = MIN(batch.minX, minX);
+		batch.minY = MIN(batch.minY, minY);
+		batch.maxX = MAX(batch.maxX, maxX);
+		batch.maxY = MAX(batch.maxY, maxY);
+	}
+	batches[target].count += count;
+
+	EJCanvasCommand command = { target, first, count };
+	commands.push_back(command);
 }
 
 void EJCanvasContext::pushTriX1(float x1, float y1, float x2, float y2, float x3, float y3, EJColorRGBA color, CGAffineTransform transform)	{
-	if( vertexBufferIndex >= EJ_CANVAS_VERTEX_BUFFER_SIZE - 3 ) {
+	if( vertexBufferIndex >= vertexBufferSize - 3 ) {
 		this->flushBuffers();
 	}
+	this->beginCommand();
 
-	EJVector2 d1 = { x1, y1 };
-	EJVector2 d2 = { x2, y2 };
-	EJVector2 d3 = { x3, y3 };
-
+	float xs[4] = { x1, x2, x3, x3 };
+	float ys[4] = { y1, y2, y3, y3 };
 	if( !CGAffineTransformIsIdentity(transform) ) {
-		d1 = EJVector2ApplyTransform( d1, transform );
-		d2 = EJVector2ApplyTransform( d2, transform );
-		d3 = EJVector2ApplyTransform( d3, transform );
+		EJTransformPoints4(xs, ys, transform);
 	}
 
-	EJVertex * vb = &CanvasVertexBuffer[vertexBufferIndex];
-	vb[0] = (EJVertex) { d1, {0.5, 1}, color };
-	vb[1] = (EJVertex) { d2, {0.5, 0.5}, color };
-	vb[2] = (EJVertex) { d3, {0.5, 1}, color };
+	EJVertex * vb = &vertexBuffer[vertexBufferIndex];
+	for( int i = 0; i < 3; i++ ) {
+		const EJVector2 pos = { xs[i], ys[i] };
+		const EJVector2 uv = paintActive ? this->paintUV(pos) : EJVector2Make(0.5, i == 1 ? 0.5 : 1);
+		vb[i] = (EJVertex) { pos, uv, color };
+	}
 
 	vertexBufferIndex += 3;
 }
 
 void EJCanvasContext::pushQuadV1 (EJVector2 v1, EJVector2 v2, EJVector2 v3, EJVector2 v4, EJVector2 t1, EJVector2 t2, EJVector2 t3, EJVector2 t4, EJColorRGBA color, CGAffineTransform transform) {
-	if( vertexBufferIndex >= EJ_CANVAS_VERTEX_BUFFER_SIZE - 6 ) {
+	if( vertexBufferIndex >= vertexBufferSize - 6 ) {
 		this->flushBuffers();
 	}
+	this->beginCommand();
 
+	float xs[4] = { v1.x, v2.x, v3.x, v4.x };
+	float ys[4] = { v1.y, v2.y, v3.y, v4.y };
 	if( !CGAffineTransformIsIdentity(transform) ) {
-		v1 = EJVector2ApplyTransform( v1, transform );
-		v2 = EJVector2ApplyTransform( v2, transform );
-		v3 = EJVector2ApplyTransform( v3, transform );
-		v4 = EJVector2ApplyTransform( v4, transform );
+		EJTransformPoints4(xs, ys, transform);
 	}
 
-	EJVertex * vb = &CanvasVertexBuffer[vertexBufferIndex];
-	vb[0] = (EJVertex) { v1, t1, color };
-	vb[1] = (EJVertex) { v2, t2, color };
-	vb[2] = (EJVertex) { v3, t3, color };
-	vb[3] = (EJVertex) { v2, t2, color };
-	vb[4] = (EJVertex) { v3, t3, color };
-	vb[5] = (EJVertex) { v4, t4, color };
+	EJVector2 uvs[4] = { t1, t2, t3, t4 };
+	if( paintActive ) {
+		for( int i = 0; i < 4; i++ ) {
+			uvs[i] = this->paintUV(EJVector2Make(xs[i], ys[i]));
+		}
+	}
+	EJWriteQuad(&vertexBuffer[vertexBufferIndex], xs, ys, uvs, color);
 
 	vertexBufferIndex += 6;
 }
 
 void EJCanvasContext::pushRectX(float x, float y, float w, float h, float tx, float ty, float tw, float th, EJColorRGBA color, CGAffineTransform transform) {
-	if( vertexBufferIndex >= EJ_CANVAS_VERTEX_BUFFER_SIZE - 6 ) {
+	if( vertexBufferIndex >= vertexBufferSize - 6 ) {
 		this->flushBuffers();
 	}
+	this->beginCommand();
 
-	EJVector2 d11 = { x, y };
-	EJVector2 d21 = { x+w, y };
-	EJVector2 d12 = { x, y+h };
-	EJVector2 d22 = { x+w, y+h };
-
+	float xs[4] = { x, x+w, x, x+w };
+	float ys[4] = { y, y, y+h, y+h };
 	if( !CGAffineTransformIsIdentity(transform) ) {
-		d11 = EJVector2ApplyTransform( d11, transform );
-		d21 = EJVector2ApplyTransform( d21, transform );
-		d12 = EJVector2ApplyTransform( d12, transform );
-		d22 = EJVector2ApplyTransform( d22, transform );
+		EJTransformPoints4(xs, ys, transform);
 	}
 
-	EJVertex * vb = &CanvasVertexBuffer[vertexBufferIndex];
-	vb[0] = (EJVertex) { d11, {tx, ty}, color };	// top left
-	vb[1] = (EJVertex) { d21, {tx+tw, ty}, color };	// top right
-	vb[2] = (EJVertex) { d12, {tx, ty+th}, color };	// bottom left
-
-	vb[3] = (EJVertex) { d21, {tx+tw, ty}, color };	// top right
-	vb[4] = (EJVertex) { d12, {tx, ty+th}, color };	// bottom left
-	vb[5] = (EJVertex) { d22, {tx+tw, ty+th}, color };// bottom right
+	// top left, top right, bottom left, bottom right; the texture coordinates of paints follow the corners
+	EJVector2 uvs[4] = { { tx, ty }, { tx+tw, ty }, { tx, ty+th }, { tx+tw, ty+th } };
+	if( paintActive ) {
+		for( int i = 0; i < 4; i++ ) {
+			uvs[i] = this->paintUV(EJVector2Make(xs[i], ys[i]));
+		}
+	}
+	EJWriteQuad(&vertexBuffer[vertexBufferIndex], xs, ys, uvs, color);
 
 	vertexBufferIndex += 6;
 }
 
+void EJCanvasContext::pushRects (const float *rects, int count, EJColorRGBA color, CGAffineTransform transform) {
+	const bool transformed = !CGAffineTransformIsIdentity(transform);
+	const EJVector2 zero[4] = { { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } };
+	// a command per chunk keeps its bounds small enough to batch past other draws
+	const int chunk = MIN(64, vertexBufferSize / 6);
+
+	while( count > 0 ) {
+		const int rectCount = MIN(count, chunk);
+		EJVertex * vb = this->pushVertices(rectCount * 6);
+		for( int r = 0; r < rectCount; r++, rects += 4, vb += 6 ) {
+			const float x = rects[0], y = rects[1], w = rects[2], h = rects[3];
+			float xs[4] = { x, x+w, x, x+w };
+			float ys[4] = { y, y, y+h, y+h };
+			if( transformed ) {
+				EJTransformPoints4(xs, ys, transform);
+			}
+			if( paintActive ) {
+				EJVector2 uvs[4];
+				for( int i = 0; i < 4; i++ ) {
+					uvs[i] = this->paintUV(EJVector2Make(xs[i], ys[i]));
+				}
+				EJWriteQuad(vb, xs, ys, uvs, color);
+			}
+			else {
+				EJWriteQuad(vb, xs, ys, zero, color);
+			}
+		}
+		count -= rectCount;
+	}
+}
+
+EJVertex* EJCanvasContext::pushVertices (int count) {
+	if( vertexBufferIndex >= vertexBufferSize - count ) {
+		this->flushBuffers();
+	}
+	this->beginCommand();
+
+	EJVertex * vb = &vertexBuffer[vertexBufferIndex];
+	vertexBufferIndex += count;
+	return vb;
+}
+
+// fill kind for the format of texture; external textures bring the transform of their latest frame
+static void EJSetTextureFill (EJGLBackend *backend, EJTexture *texture, float outline) {
+	if( texture->externalTexture() ) {
+		backend->setFill(kEJGLFillExternal);
+		backend->setExternalTransform(texture->externalTexture()->uvTransform());
+		return;
+	}
+	const GLenum format = texture->getFormat();
+	if( format == GL_LUMINANCE && outline > 0 ) {
+		backend->setFill(kEJGLFillOutline);
+		backend->setOutlineWidth(outline);
+		return;
+	}
+	backend->setFill(format == GL_ALPHA ? kEJGLFillAlpha : format == GL_LUMINANCE ? kEJGLFillDistance : kEJGLFillTexture);
+}
+
 void EJCanvasContext::flushBuffers() {
-	if( vertexBufferIndex == 0 ) { return; }
+	BGJSTraceScope trace("EJCanvasContext.flushBuffers");
+	if( !frameBegun ) {
+		frameBegun = true;
+		this->beginFrame();
+	}
+	this->endCommand();
+	if( commands.empty() ) {
+		vertexBufferIndex = 0;
+		return;
+	}
+
+	// lay out the vertices of every batch next to each other; in a single batch they already are
+	EJVertex * vertices = vertexBuffer;
+	if( batches.size() > 1 ) {
+		int offset = 0;
+		for( size_t i = 0; i < batches.size(); i++ ) {
+			batches[i].first = offset;
+			offset += batches[i].count;
+		}
+		for( size_t i = 0; i < commands.size(); i++ ) {
+			const EJCanvasCommand &command = commands[i];
+			EJCanvasBatch &batch = batches[command.batch];
+			memcpy(&sortedVertexBuffer[batch.first + batch.copied], &vertexBuffer[command.first], command.count * sizeof(EJVertex));
+			batch.copied += command.count;
+		}
+		vertices = sortedVertexBuffer;
+	}
+
+	// rotate through the buffer objects, so an upload never has to wait for a draw call that still reads from one
+	if( !vertexBufferObjects[0] ) {
+		glGenBuffers(EJ_CANVAS_VERTEX_BUFFER_OBJECTS, vertexBufferObjects);
+	}
+	const GLuint vertexBufferObject = vertexBufferObjects[vertexBufferObjectIndex];
+	glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject);
+	vertexBufferObjectIndex = (vertexBufferObjectIndex + 1) % EJ_CANVAS_VERTEX_BUFFER_OBJECTS;
 
-	glDrawArrays(GL_TRIANGLES, 0, vertexBufferIndex);
+	// orphan the previous storage instead of synchronizing with it; there is room for the quad of a shadow at the end
+	glBufferData(GL_ARRAY_BUFFER, (vertexBufferSize + 6) * sizeof(EJVertex), NULL, GL_DYNAMIC_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, vertexBufferIndex * sizeof(EJVertex), vertices);
+	EJ_CHECK_GL_ERROR("glBufferSubData(flushBuffers)");
+
+	if( shadowCapture ) {
+		this->drawShadow(vertexBufferObject);
+	}
+
+	// the state of the first batch is always set, since gl state may have been changed since the last flush
+	int binds = 0;
+	for( size_t i = 0; i < batches.size(); i++ ) {
+		const EJCanvasBatch &batch = batches[i];
+		const bool premultiplied = batch.texture->isPremultiplied();
+		if( i == 0 || batch.compositeOperation != batches[i-1].compositeOperation ||
+				premultiplied != batches[i-1].texture->isPremultiplied() ) {
+			const EJCompositeOperation op = batch.compositeOperation;
+			EJGLState::blendFunc( premultiplied ? EJCompositeOperationFuncs[op].premultipliedSource : EJCompositeOperationFuncs[op].source,
+				EJCompositeOperationFuncs[op].destination );
+		}
+		if( i == 0 || batch.texture != batches[i-1].texture ) {
+			batch.texture->bind();
+			binds++;
+			EJSetTextureFill(backend, batch.texture, batch.outline);
+		}
+		else if( batch.outline != batches[i-1].outline ) {
+			EJSetTextureFill(backend, batch.texture, batch.outline);
+		}
+		backend->drawTriangles(batch.first, batch.count);
+	}
+	EJ_CHECK_GL_ERROR("drawTriangles(flushBuffers)");
+	if( frameStats ) {
+		frameStats->flushes++;
+		frameStats->drawCalls += (int)batches.size();
+		frameStats->textureBinds += binds;
+		frameStats->vertices += vertexBufferIndex;
+	}
+	batches.clear();
+	commands.clear();
+
+	// EJPath draws its stencil from client side arrays, which only works while no buffer object is bound
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
 	vertexBufferIndex = 0;
 }
 
-void EJCanvasContext::setGlobalCompositeOperation (EJCompositeOperation op) {
+void EJCanvasContext::restoreTarget() {
+	backend->bindFramebuffer(msaaEnabled ? msaaFrameBuffer : viewFrameBuffer);
+	glViewport(0, 0, viewportWidth, viewportHeight);
+	backend->setProjection(width, height, false);
+	this->applyClipStencil();
+}
+
+// fnv-1a over words
+static inline void EJShadowHash (uint64_t &key, uint32_t value) {
+	key = (key ^ value) * 1099511628211ULL;
+}
+
+void EJCanvasContext::beginShadow() {
+	// a shadow right under a shape that is not blurred is hidden by it
+	const bool visible = state->shadowColor.rgba.a && (state->shadowBlur > 0 || state->shadowOffsetX || state->shadowOffsetY);
+	if( !visible || !backend->supportsBlur() ) { return; }
+
+	this->flushBuffers();
+	shadowCapture = true;
+}
+
+void EJCanvasContext::endShadow() {
+	if( !shadowCapture ) { return; }
+	this->flushBuffers();
+	shadowCapture = false;
+}
+
+void EJCanvasContext::drawShadow (GLuint vertexBufferObject) {
+	float minX = batches[0].minX, minY = batches[0].minY, maxX = batches[0].maxX, maxY = batches[0].maxY;
+	for( size_t i = 1; i < batches.size(); i++ ) {
+		minX = MIN(minX, batches[i].minX);
+		minY = MIN(minY, batches[i].minY);
+		maxX = MAX(maxX, batches[i].maxX);
+		maxY = MAX(maxY, batches[i].maxY);
+	}
+	if( !(maxX > minX && maxY > minY) ) { return; }
+
+	// the blur is a gaussian of half of shadowBlur; the silhouette is scaled down until that is at most 3 texels,
+	// or until it fits into the largest shadow texture
+	const float deviceScale = (float)viewportWidth / width;
+	const float sigma = state->shadowBlur / 2 * deviceScale;
+	const float extent = MAX(maxX - minX, maxY - minY) * deviceScale + 6 * sigma + 4;
+	const float downscale = MAX(MAX(1.0f, sigma / 3), extent / (EJ_CANVAS_SHADOW_MAX_SIZE - 4));
+	const int viewWidth = MAX(1, (int)ceilf(viewportWidth / downscale));
+	const int viewHeight = MAX(1, (int)ceilf(viewportHeight / downscale));
+	const float scaleX = (float)viewWidth / width, scaleY = (float)viewHeight / height;
+	const float texelSigma = sigma / downscale;
+	const int taps = MIN((int)ceilf(texelSigma * 3), EJ_GL_BLUR_TAPS);
+	const int pad = taps + 1;
+
+	// the key: quantized positions relative to the bounds, the rest of every vertex, textures and the scale of the blur
+	uint64_t key = 14695981039346656037ULL;
+	EJShadowHash(key, vertexBufferIndex);
+	EJShadowHash(key, viewWidth);
+	EJShadowHash(key, viewHeight);
+	EJShadowHash(key, lroundf(texelSigma * 256));
+	for( size_t i = 0; i < batches.size(); i++ ) {
+		batches[i].texture->ensureUploaded();
+		EJShadowHash(key, batches[i].texture->textureId);
+		EJShadowHash(key, batches[i].count);
+		EJShadowHash(key, lroundf(batches[i].outline * 4096));
+	}
+	const EJVertex *vertices = batches.size() > 1 ? sortedVertexBuffer : vertexBuffer;
+	for( int i = 0; i < vertexBufferIndex; i++ ) {
+		uint32_t uv[2];
+		memcpy(uv, &vertices[i].uv, sizeof(uv));
+		EJShadowHash(key, lroundf((vertices[i].pos.x - minX) * 16));
+		EJShadowHash(key, lroundf((vertices[i].pos.y - minY) * 16));
+		EJShadowHash(key, uv[0]);
+		EJShadowHash(key, uv[1]);
+		EJShadowHash(key, vertices[i].color.hex);
+	}
+
+	EJShadow *shadow = shadowCache->get(key);
+	if( !shadow ) {
+		// with the projection of the canvas, texel rows grow with canvas y
+		const int originX = (int)floorf(minX * scaleX) - pad, originY = (int)floorf(minY * scaleY) - pad;
+		const int texelsX = (int)ceilf(maxX * scaleX) + pad - originX, texelsY = (int)ceilf(maxY * scaleY) + pad - originY;
+
+		EJGLState::disable(GL_SCISSOR_TEST);
+		EJGLState::disable(GL_STENCIL_TEST);
+		EJTexture *silhouette = shadowCache->bindScratch(0, texelsX, texelsY);
+		if( !silhouette ) {
+			this->restoreTarget();
+			return;
+		}
+
+		GLfloat clearColor[4];
+		glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+		glClearColor(0, 0, 0, 0);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		// only the alpha of the silhouette counts, and it has to add up the way it does on the canvas
+		glViewport(-originX, -originY, viewWidth, viewHeight);
+		backend->setProjection(width, height, false);
+		EJGLState::blendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+		for( size_t i = 0; i < batches.size(); i++ ) {
+			const EJCanvasBatch &batch = batches[i];
+			batch.texture->bind();
+			EJSetTextureFill(backend, batch.texture, batch.outline);
+			backend->drawTriangles(batch.first, batch.count);
+		}
+		if( frameStats ) {
+			frameStats->drawCalls += (int)batches.size();
+			frameStats->textureBinds += (int)batches.size();
+		}
+
+		if( taps > 0 ) {
+			float weights[EJ_GL_BLUR_TAPS + 1];
+			float sum = 0;
+			for( int i = 0; i <= taps; i++ ) {
+				weights[i] = expf(-(float)(i * i) / (2 * texelSigma * texelSigma));
+				sum += i ? 2 * weights[i] : weights[i];
+			}
+			for( int i = 0; i <= taps; i++ ) {
+				weights[i] /= sum;
+			}
+
+			// the padding around the silhouette is cleared, so the kernel never reaches pixels of an earlier shadow
+			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			EJGLState::blendFunc(GL_ONE, GL_ZERO);
+			glViewport(0, 0, texelsX, texelsY);
+			EJTexture *horizontal = shadowCache->bindScratch(1, texelsX, texelsY);
+			if( horizontal ) {
+				glClear(GL_COLOR_BUFFER_BIT);
+				silhouette->bind();
+				backend->drawBlur(1.0f / silhouette->realWidth, 0, weights, taps,
+						(float)texelsX / silhouette->realWidth, (float)texelsY / silhouette->realHeight);
+				shadowCache->bindScratch(0, texelsX, texelsY);
+				horizontal->bind();
+				backend->drawBlur(0, 1.0f / horizontal->realHeight, weights, taps,
+						(float)texelsX / horizontal->realWidth, (float)texelsY / horizontal->realHeight);
+				if( frameStats ) {
+					frameStats->drawCalls += 2;
+					frameStats->textureBinds += 2;
+				}
+			}
+			else {
+				// without a second framebuffer the shadow stays sharp
+				shadowCache->bindScratch(0, texelsX, texelsY);
+			}
+			glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject);
+		}
+
+		shadow = shadowCache->add(key, texelsX, texelsY);
+		glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, texelsX, texelsY);
+		shadow->x = originX / scaleX - minX;
+		shadow->y = originY / scaleY - minY;
+		shadow->w = texelsX / scaleX;
+		shadow->h = texelsY / scaleY;
+		EJ_CHECK_GL_ERROR("drawShadow");
+
+		glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+		this->restoreTarget();
+	}
+
+	// the quad goes behind the vertices of the flush; its color is that of the shadow, its alpha that of the texture
+	const float x = minX + shadow->x + state->shadowOffsetX, y = minY + shadow->y + state->shadowOffsetY;
+	float xs[4] = { x, x + shadow->w, x, x + shadow->w };
+	float ys[4] = { y, y, y + shadow->h, y + shadow->h };
+	const float u = (float)shadow->width / shadow->texture->realWidth, v = (float)shadow->height / shadow->texture->realHeight;
+	EJVector2 uvs[4] = { { 0, 0 }, { u, 0 }, { 0, v }, { u, v } };
+	EJVertex quad[6];
+	EJWriteQuad(quad, xs, ys, uvs, state->shadowColor);
+	glBufferSubData(GL_ARRAY_BUFFER, vertexBufferIndex * sizeof(EJVertex), sizeof(quad), quad);
+
+	const EJCompositeOperation op = batches[0].compositeOperation;
+	EJGLState::blendFunc( EJCompositeOperationFuncs[op].source, EJCompositeOperationFuncs[op].destination );
+	shadow->texture->bind();
+	backend->setFill(kEJGLFillAlpha);
+	backend->drawTriangles(vertexBufferIndex, 6);
+	EJ_CHECK_GL_ERROR("drawTriangles(drawShadow)");
+	if( frameStats ) {
+		frameStats->drawCalls++;
+		frameStats->textureBinds++;
+		frameStats->vertices += 6;
+	}
+}
+
+void EJCanvasContext::setVertexBufferSize (int size) {
+	size = MAX(6, MIN(size, EJ_CANVAS_MAX_VERTEX_BUFFER_SIZE));
+	if( size == vertexBufferSize ) { return; }
+
+	// flushing empties the buffers, so new ones are allocated instead of copying them; the old buffers and size stay
+	// unless there is memory for both of the new ones
 	this->flushBuffers();
-	glBlendFunc( EJCompositeOperationFuncs[op].source, EJCompositeOperationFuncs[op].destination );
+	const size_t bytes = (size_t)size * sizeof(EJVertex);
+	EJVertex *vertices = (EJVertex*)malloc(bytes);
+	EJVertex *sortedVertices = (EJVertex*)malloc(bytes);
+	if( !vertices || !sortedVertices ) {
+		LOGE("Cannot allocate a vertex buffer of %d vertices, keeping %d", size, vertexBufferSize);
+		free(vertices);
+		free(sortedVertices);
+		return;
+	}
+	free(vertexBuffer);
+	free(sortedVertexBuffer);
+	vertexBuffer = vertices;
+	sortedVertexBuffer = sortedVertices;
+	vertexBufferSize = size;
+}
+
+void EJCanvasContext::resetFrameArena() {
+	// paths are often built once and drawn every frame, so the current one may outlive the frame
+	path->leaveArena();
+	frameArena.reset();
+}
+
+int EJCanvasContext::getVertexBufferSize() {
+	return vertexBufferSize;
+}
+
+void EJCanvasContext::setGlobalCompositeOperation (EJCompositeOperation op) {
+	// applied per batch when flushing
 	state->globalCompositeOperation = op;
 }
 
@@ -360,6 +776,63 @@ char* EJCanvasContext::getFont() {
 }
 
 
+void EJCanvasContext::setFillPaint (EJCanvasPaint *paint) {
+	if( paint ) { paint->retain(); }
+	if( state->fillPaint ) { state->fillPaint->release(); }
+	state->fillPaint = paint;
+}
+
+void EJCanvasContext::setStrokePaint (EJCanvasPaint *paint) {
+	if( paint ) { paint->retain(); }
+	if( state->strokePaint ) { state->strokePaint->release(); }
+	state->strokePaint = paint;
+}
+
+EJTexture* EJCanvasContext::paintTexture (EJCanvasPaint *paint) {
+	for( std::list<EJCanvasPaintTexture>::iterator it = paintTextures.begin(); it != paintTextures.end(); ++it ) {
+		if( it->paintId != paint->id() ) { continue; }
+		if( it->version == paint->version() ) {
+			paintTextures.splice(paintTextures.begin(), paintTextures, it);
+			return it->texture;
+		}
+		// color stops were added since; batches may still refer to the old texture
+		this->flushBuffers();
+		delete it->texture;
+		paintTextures.erase(it);
+		break;
+	}
+
+	if( paintTextures.size() >= EJ_CANVAS_PAINT_TEXTURES ) {
+		this->flushBuffers();
+		delete paintTextures.back().texture;
+		paintTextures.pop_back();
+	}
+	EJCanvasPaintTexture entry = { paint->id(), paint->version(), paint->createTexture() };
+	paintTextures.push_front(entry);
+	return entry.texture;
+}
+
+EJColorRGBA EJCanvasContext::beginPaint (EJCanvasPaint *paint, EJColorRGBA color) {
+	EJTexture *texture = paint ? this->paintTexture(paint) : NULL;
+	if( !texture ) {
+		this->setTexture(NULL);
+		if( paint ) {
+			// gradients without color stops or extent are transparent black
+			const EJColorRGBA transparent = {{0, 0, 0, 0}};
+			return transparent;
+		}
+		color.rgba.a = (float)color.rgba.a * state->globalAlpha;
+		return color;
+	}
+
+	// vertices are in the coordinates of the framebuffer; the paint is in those of the current transform
+	this->setTexture(texture);
+	paintActive = true;
+	paintTransform = CGAffineTransformConcat(paint->textureTransform(), CGAffineTransformInvert(state->transform));
+	const EJColorRGBA white = {{255, 255, 255, (unsigned char)(255 * state->globalAlpha)}};
+	return white;
+}
+
 void EJCanvasContext::save () {
 	if( stateIndex == EJ_CANVAS_STATE_STACK_SIZE-1 ) {
 		LOGI("Warning: EJ_CANVAS_STATE_STACK_SIZE (%d) reached", EJ_CANVAS_STATE_STACK_SIZE);
@@ -368,6 +841,8 @@ void EJCanvasContext::save () {
 	stateStack[stateIndex+1] = stateStack[stateIndex];
 	stateIndex++;
 	state = &stateStack[stateIndex];
+	if( state->fillPaint ) { state->fillPaint->retain(); }
+	if( state->strokePaint ) { state->strokePaint->retain(); }
 	// TODO: Font
 	// [state->font retain];
 }
@@ -384,11 +859,46 @@ void EJCanvasContext::restore() {
 		state->fontName = NULL;
 	} */
 
+	// draws still to be flushed are inside of the clips that are popped
+	const int oldClipDepth = state->clipDepth;
+	if( stateStack[stateIndex-1].clipDepth < oldClipDepth ) {
+		this->flushBuffers();
+	}
+
+	if( state->fillPaint ) { state->fillPaint->release(); }
+	if( state->strokePaint ) { state->strokePaint->release(); }
 	stateIndex--;
 	state = &stateStack[stateIndex];
 
     path->transform = state->transform;
 
+	if( state->clipDepth < oldClipDepth ) {
+		// count the pixels inside the popped clips back down to the depth of this state, over their bounds
+		float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
+		for( int i = state->clipDepth; i < oldClipDepth; i++ ) {
+			minX = MIN(minX, clips[i].minX);
+			minY = MIN(minY, clips[i].minY);
+			maxX = MAX(maxX, clips[i].maxX);
+			maxY = MAX(maxY, clips[i].maxY);
+		}
+		clips.resize(state->clipDepth);
+
+		const EJVector2 rect[4] = { { minX, minY }, { maxX, minY }, { maxX, maxY }, { minX, maxY } };
+		const bool scissored = EJGLState::isEnabled(GL_SCISSOR_TEST);
+		EJGLState::disable(GL_SCISSOR_TEST);
+		EJGLState::colorMask(false);
+		EJGLState::enable(GL_STENCIL_TEST);
+		EJGLState::stencilMask(EJ_STENCIL_CLIP_MASK);
+		EJGLState::stencilFunc(GL_LESS, state->clipDepth, EJ_STENCIL_CLIP_MASK);
+		EJGLState::stencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+		backend->drawFan(rect, 4);
+		EJGLState::colorMask(true);
+		if( scissored ) {
+			EJGLState::enable(GL_SCISSOR_TEST);
+		}
+		this->applyClipStencil();
+	}
+
 	if( state->globalCompositeOperation != oldCompositeOp ) {
 		this->setGlobalCompositeOperation (state->globalCompositeOperation);
 	}
@@ -427,34 +937,45 @@ void EJCanvasContext::drawImage (EJTexture *texture, float sx, float sy,
 	float th = texture->realHeight;
 
 	EJColorRGBA color = {{255, 255, 255, (unsigned char)(255 * state->globalAlpha)}};
+	this->beginShadow();
 	this->setTexture(texture);
 	this->pushRectX(dx, dy, dw, dh, sx/tw, sy/th, sw/tw, sh/th, color, state->transform);
+	this->endShadow();
 }
 
 void EJCanvasContext::fillRectX (float x, float y, float w, float h) {
-	this->setTexture(NULL);
-
-	EJColorRGBA color = state->fillColor;
-	color.rgba.a = (float)color.rgba.a * state->globalAlpha;
+	this->beginShadow();
+	EJColorRGBA color = this->beginPaint(state->fillPaint, state->fillColor);
 	// LOGD("fillRect. (%f, %f) w %f h %f  rgba(%d,%d,%d,%.3f)", x, y, w, h, color.rgba.r, color.rgba.g, color.rgba.b, (float)color.rgba.a/255.0f);
 	this->pushRectX (x, y, w, h, 0, 0, 0, 0, color, state->transform);
+	this->endPaint();
+	this->endShadow();
 	// [self pushRectX:x y:y w:w h:h tx:0 ty:0 tw:0 th:0 color:color withTransform:state->transform];
 }
 
+void EJCanvasContext::fillRects (const float *rects, int count) {
+	this->beginShadow();
+	EJColorRGBA color = this->beginPaint(state->fillPaint, state->fillColor);
+	this->pushRects(rects, count, color, state->transform);
+	this->endPaint();
+	this->endShadow();
+}
+
 void EJCanvasContext::strokeRectX (float x, float y, float w, float h) {
 	// strokeRect should not affect the current path, so we create
 	// a new, tempPath instead.
-	EJPath * tempPath = new EJPath();
-	tempPath->transform = state->transform;
+	EJPath tempPath(false, &frameArena);
+	tempPath.transform = state->transform;
 
-	tempPath->moveToX (x, y);
-	tempPath->lineToX (x+w, y);
-	tempPath->lineToX (x+w, y+h);
-	tempPath->lineToX (x, y+h);
-	tempPath->close();
+	tempPath.moveToX (x, y);
+	tempPath.lineToX (x+w, y);
+	tempPath.lineToX (x+w, y+h);
+	tempPath.lineToX (x, y+h);
+	tempPath.close();
 
-	tempPath->drawLinesToContext(this);
-	delete tempPath;
+	this->beginShadow();
+	tempPath.drawLinesToContext(this, CGAffineTransformIdentity);
+	this->endShadow();
 
 	/* [tempPath moveToX:x y:y];
 	[tempPath lineToX:x+w y:y];
@@ -479,28 +1000,103 @@ void EJCanvasContext::clearRectX (float x, float y, float w, float h) {
 	this->setGlobalCompositeOperation(oldOp);
 }
 
+EJPixelRegion EJCanvasContext::pixelRegionSx (float sx, float sy, int sw, int sh) {
+	EJPixelRegion region;
+	region.sx = sx;
+	region.sy = sy;
+	region.sw = sw;
+	region.sh = sh;
+	region.scale = (float)bufferWidth / width;
+	region.framebufferHeight = bufferHeight;
+
+	// framebuffer pixels the first and behind the last canvas pixel start on, measured from the top left
+	const int left = std::max(0, (int)floorf(sx * region.scale));
+	const int top = std::max(0, (int)floorf(sy * region.scale));
+	const int right = std::min((int)bufferWidth, (int)floorf((sx + sw - 1) * region.scale) + 1);
+	const int bottom = std::min((int)bufferHeight, (int)floorf((sy + sh - 1) * region.scale) + 1);
+
+	region.x = left;
+	region.y = bufferHeight - bottom;
+	region.width = std::max(0, right - left);
+	region.height = std::max(0, bottom - top);
+	return region;
+}
+
 EJImageData* EJCanvasContext::getImageDataSx (float sx, float sy, float sw, float sh) {
-	this->flushBuffers();
-	GLubyte * pixels = (GLubyte*)malloc( sw * sh * 4 * sizeof(GLubyte));
-	glReadPixels(sx, sy, sw, sh, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+	GLubyte * pixels = (GLubyte*)malloc( (int)sw * (int)sh * 4 * sizeof(GLubyte));
+	this->readPixels(sx, sy, sw, sh, pixels);
 
 	EJImageData *data = EJImageData::initWithWidth(sw, sh, pixels);
 	return data;
 	// return [[[EJImageData alloc] initWithWidth:sw height:sh pixels:pixels] autorelease];
 }
 
+void EJCanvasContext::readPixels (float sx, float sy, int sw, int sh, GLubyte *pixels) {
+	this->flushBuffers();
+	const EJPixelRegion region = pixelRegionSx(sx, sy, sw, sh);
+
+	// unscaled reads inside the framebuffer go straight to pixels and are flipped in place
+	if( region.scale == 1 && region.width == sw && region.height == sh && sx == floorf(sx) && sy == floorf(sy) ) {
+		glReadPixels(region.x, region.y, sw, sh, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+		const int stride = sw * 4;
+		std::vector<GLubyte> row(stride);
+		for( int y = 0; y < sh / 2; y++ ) {
+			GLubyte *a = pixels + y * stride, *b = pixels + (sh - 1 - y) * stride;
+			memcpy(row.data(), a, stride);
+			memcpy(a, b, stride);
+			memcpy(b, row.data(), stride);
+		}
+		return;
+	}
+
+	std::vector<GLubyte> framebufferPixels(std::max(4, region.width * region.height * 4));
+	if( region.width > 0 && region.height > 0 ) {
+		glReadPixels(region.x, region.y, region.width, region.height, GL_RGBA, GL_UNSIGNED_BYTE, framebufferPixels.data());
+	}
+	EJImageData::copyFramebufferPixels(framebufferPixels.data(), region, pixels);
+}
+
+EJPixelReadback* EJCanvasContext::beginReadPixels (float sx, float sy, int sw, int sh) {
+	if( !EJPixelReadback::isSupported() ) {
+		return NULL;
+	}
+	this->flushBuffers();
+	return new EJPixelReadback(pixelRegionSx(sx, sy, sw, sh));
+}
+
+void EJCanvasContext::finishReadPixels (EJPixelReadback *readback, GLubyte *pixels) {
+	const GLubyte *framebufferPixels = readback->map();
+	EJPixelRegion region = readback->region;
+	if( !framebufferPixels ) {
+		region.width = region.height = 0;
+	}
+	EJImageData::copyFramebufferPixels(framebufferPixels, region, pixels);
+	readback->unmap();
+}
+
 void EJCanvasContext::putImageData (EJImageData* imageData, float dx, float dy) {
-	EJTexture * texture = imageData->getTexture();
-	this->setTexture(texture);
+	this->putPixels(imageData->width, imageData->height, imageData->pixels, dx, dy);
+}
 
-	short tw = texture->realWidth;
-	short th = texture->realHeight;
+void EJCanvasContext::putPixels (int w, int h, const GLubyte *pixels, float dx, float dy) {
+	this->flushBuffers();
+	EJTexture * texture = EJTexture::initWithWidth(w, h, (GLubyte *)pixels);
 
+	// the pixels replace what is there, so they are drawn on their own without blending
+	EJTexture *previousTexture = currentTexture;
+	this->setTexture(texture);
 	static EJColorRGBA white = { { 255, 255, 255, 255 } };
-	this->pushRectX (dx, dy, tw, th, 0, 0, 1, 1, white, CGAffineTransformIdentity);
+	this->pushRectX (dx, dy, w, h, 0, 0, (float)w / texture->realWidth, (float)h / texture->realHeight, white, CGAffineTransformIdentity);
 
-	// [self pushRectX:dx y:dy w:tw h:th tx:0 ty:0 tw:1 th:1 color:white withTransform:CGAffineTransformIdentity];
+	// like the composite operation, the clip does not apply
+	EJGLState::disable(GL_BLEND);
+	EJGLState::disable(GL_STENCIL_TEST);
 	this->flushBuffers();
+	EJGLState::enable(GL_BLEND);
+	this->applyClipStencil();
+
+	this->setTexture(previousTexture);
+	delete texture;
 }
 
 void EJCanvasContext::beginPath () {
@@ -511,12 +1107,132 @@ void EJCanvasContext::closePath () {
 	path->close();
 }
 
-void EJCanvasContext::fill () {
-	path->drawPolygonsToContext(this);
+void EJCanvasContext::fill (EJFillRule fillRule) {
+	this->beginShadow();
+	path->drawPolygonsToContext(this, fillRule, CGAffineTransformIdentity);
+	this->endShadow();
+}
+
+void EJCanvasContext::fillPath (EJPath *retainedPath, EJFillRule fillRule) {
+	retainedPath->flattenForScale(CGAffineTransformGetMaxScale(state->transform));
+	this->beginShadow();
+	retainedPath->drawPolygonsToContext(this, fillRule, state->transform);
+	this->endShadow();
 }
 
 void EJCanvasContext::stroke () {
-	path->drawLinesToContext(this);
+	this->beginShadow();
+	path->drawLinesToContext(this, CGAffineTransformIdentity);
+	this->endShadow();
+}
+
+void EJCanvasContext::strokePath (EJPath *retainedPath) {
+	retainedPath->flattenForScale(CGAffineTransformGetMaxScale(state->transform));
+	this->beginShadow();
+	retainedPath->drawLinesToContext(this, state->transform);
+	this->endShadow();
+}
+
+void EJCanvasContext::clip (EJFillRule fillRule) {
+	EJCanvasClip clip;
+	path->tessellate(fillRule, CGAffineTransformIdentity, clip.triangles);
+	this->pushClip(clip);
+}
+
+void EJCanvasContext::clipPath (EJPath *retainedPath, EJFillRule fillRule) {
+	EJCanvasClip clip;
+	retainedPath->flattenForScale(CGAffineTransformGetMaxScale(state->transform));
+	retainedPath->tessellate(fillRule, state->transform, clip.triangles);
+	this->pushClip(clip);
+}
+
+bool EJCanvasContext::isPointInPath (float x, float y, EJFillRule fillRule) {
+	return path->containsPoint(EJVector2Make(x, y), fillRule);
+}
+
+bool EJCanvasContext::isPointInPath (EJPath *retainedPath, float x, float y, EJFillRule fillRule) {
+	// the point is taken into the coordinates of the path, rather than the path to the point
+	const CGAffineTransform t = state->transform;
+	if( t.a * t.d - t.b * t.c == 0 ) { return false; }
+	return retainedPath->containsPoint(EJVector2ApplyTransform(EJVector2Make(x, y), CGAffineTransformInvert(t)), fillRule);
+}
+
+bool EJCanvasContext::isPointInStroke (float x, float y) {
+	// the points of the path are transformed already; the line is as much wider as the transform scales
+	return path->strokeContainsPoint(EJVector2Make(x, y), state->lineWidth / 2 * CGAffineTransformGetMaxScale(state->transform));
+}
+
+bool EJCanvasContext::isPointInStroke (EJPath *retainedPath, float x, float y) {
+	const CGAffineTransform t = state->transform;
+	if( t.a * t.d - t.b * t.c == 0 ) { return false; }
+	return retainedPath->strokeContainsPoint(EJVector2ApplyTransform(EJVector2Make(x, y), CGAffineTransformInvert(t)), state->lineWidth / 2);
+}
+
+void EJCanvasContext::pushClip (EJCanvasClip &clip) {
+	if( state->clipDepth == EJ_STENCIL_CLIP_MASK ) {
+		LOGI("Warning: %d nested path clips reached, clip ignored", EJ_STENCIL_CLIP_MASK);
+		return;
+	}
+
+	// an empty path clips everything away
+	clip.minX = clip.minY = INFINITY;
+	clip.maxX = clip.maxY = -INFINITY;
+	for( size_t i = 0; i < clip.triangles.size(); i++ ) {
+		clip.minX = MIN(clip.minX, clip.triangles[i].x);
+		clip.minY = MIN(clip.minY, clip.triangles[i].y);
+		clip.maxX = MAX(clip.maxX, clip.triangles[i].x);
+		clip.maxY = MAX(clip.maxY, clip.triangles[i].y);
+	}
+
+	this->flushBuffers();
+	this->createStencilBufferOnce();
+
+	clips.resize(state->clipDepth + 1);
+	clips[state->clipDepth].triangles.swap(clip.triangles);
+	clips[state->clipDepth].minX = clip.minX;
+	clips[state->clipDepth].minY = clip.minY;
+	clips[state->clipDepth].maxX = clip.maxX;
+	clips[state->clipDepth].maxY = clip.maxY;
+	this->drawClip(clips[state->clipDepth], state->clipDepth);
+	state->clipDepth++;
+	this->applyClipStencil();
+}
+
+void EJCanvasContext::drawClip (const EJCanvasClip &clip, int depth) {
+	if( clip.triangles.empty() ) { return; }
+
+	// pixels that are inside of the clips so far count up once, even where triangles of the tessellation overlap
+	EJGLState::colorMask(false);
+	EJGLState::enable(GL_STENCIL_TEST);
+	EJGLState::stencilMask(EJ_STENCIL_CLIP_MASK);
+	EJGLState::stencilFunc(GL_EQUAL, depth, EJ_STENCIL_CLIP_MASK);
+	EJGLState::stencilOp(GL_KEEP, GL_KEEP, GL_INCR);
+	backend->drawMaskTriangles(&clip.triangles[0], (int)clip.triangles.size());
+	EJGLState::colorMask(true);
+	EJ_CHECK_GL_ERROR("drawClip");
+	if( frameStats ) {
+		frameStats->stencilPasses++;
+		frameStats->drawCalls++;
+		frameStats->vertices += (int)clip.triangles.size();
+	}
+}
+
+void EJCanvasContext::redrawClips() {
+	for( int i = 0; i < state->clipDepth; i++ ) {
+		this->drawClip(clips[i], i);
+	}
+	this->applyClipStencil();
+}
+
+void EJCanvasContext::applyClipStencil() {
+	if( state->clipDepth == 0 ) {
+		EJGLState::disable(GL_STENCIL_TEST);
+		return;
+	}
+	EJGLState::enable(GL_STENCIL_TEST);
+	EJGLState::stencilMask(0);
+	EJGLState::stencilFunc(GL_EQUAL, state->clipDepth, EJ_STENCIL_CLIP_MASK);
+	EJGLState::stencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
 }
 
 void EJCanvasContext::moveToX (float x, float y) {
@@ -528,13 +1244,13 @@ void EJCanvasContext::lineToX (float x, float y) {
 }
 
 void EJCanvasContext::bezierCurveToCpx1(float cpx1, float cpy1, float cpx2, float cpy2, float x, float y) {
-	float scale = CGAffineTransformGetScale( state->transform );
+	float scale = CGAffineTransformGetMaxScale( state->transform );
 	path->bezierCurveToCpx1 (cpx1, cpy1, cpx2, cpy2, x, y, scale);
 	// [path bezierCurveToCpx1:cpx1 cpy1:cpy1 cpx2:cpx2 cpy2:cpy2 x:x y:y scale:scale];
 }
 
 void EJCanvasContext::quadraticCurveToCpx (float cpx, float cpy, float x, float y) {
-	float scale = CGAffineTransformGetScale( state->transform );
+	float scale = CGAffineTransformGetMaxScale( state->transform );
 	path->quadraticCurveToCpx (cpx, cpy, x, y, scale);
 	// [path quadraticCurveToCpx:cpx cpy:cpy x:x y:y scale:scale];
 }
@@ -556,48 +1272,57 @@ void EJCanvasContext::arcX (float x, float y, float radius, float startAngle, fl
 }
 
 EJFont* EJCanvasContext::acquireFont (char* fontName, float pointSize, bool fill, float contentScale) {
-
-	if (state->fontName && strcmp (fontName, state->fontName) == 0 && pointSize - 0.99 <= state->fontSize && pointSize + 0.99 >= state->fontSize && _font) {
-		return _font;
-	}
-	setFont(fontName);
-	state->fontSize = pointSize;
-
-	// This font is different, recreate
-	if (_font) {
-		delete(_font);
-	}
-	_font = new EJFont(fontName, pointSize, fill, contentScale);
-	return _font;
-
-	// TODO: Caching
-	/* NSString * cacheKey = [NSString stringWithFormat:@"%@_%.2f_%d_%.2f", fontName, pointSize, fill, contentScale];
-	EJFont * font = [fontCache objectForKey:cacheKey];
-	if( !font ) {
-		font = [[EJFont alloc] initWithFont:fontName size:pointSize fill:fill contentScale:contentScale];
-		[fontCache setObject:font forKey:cacheKey];
-		[font autorelease];
-	}
-	return font; */
+	return fontCache->get(fontName, pointSize, fill, contentScale, distanceFieldText && backend->supportsDistanceFields());
 }
 
 void EJCanvasContext::fillText (const char* text, float x, float y) {
 	EJFont* font = acquireFont(state->fontName, state->fontSize, true, backingStoreRatio);
+	this->beginShadow();
 	font->drawString(text, this, x, y);
+	this->endShadow();
 	/* EJFont *font = [self acquireFont:state->font.fontName size:state->font.pointSize fill:YES contentScale:backingStoreRatio];
 	[font drawString:text toContext:self x:x y:y]; */
 }
 
 void EJCanvasContext::strokeText (const char* text, float x, float y) {
 	EJFont* font = acquireFont(state->fontName, state->fontSize, false, backingStoreRatio);
+	this->beginShadow();
+	textOutline = font->outlineWidth(state->lineWidth);
 	font->drawString(text, this, x, y);
+	textOutline = 0;
+	this->endShadow();
 	/* EJFont *font = [self acquireFont:state->font.fontName size:state->font.pointSize fill:NO contentScale:backingStoreRatio];
 	[font drawString:text toContext:self x:x y:y]; */
 }
 
 float EJCanvasContext::measureText (const char* text) {
 	EJFont* font = acquireFont(state->fontName, state->fontSize, true, backingStoreRatio);
-	return font->measureString(text);
+	return font->measureString(text, this);
 	/* EJFont *font = [self acquireFont:state->font.fontName size:state->font.pointSize fill:YES contentScale:backingStoreRatio];
 	return [font measureString:text]; */
 }
+
+const EJFontLayout* EJCanvasContext::layoutText (const char* text, float maxWidth, int maxLines) {
+	EJFont* font = acquireFont(state->fontName, state->fontSize, true, backingStoreRatio);
+	return font->layout(text, maxWidth, maxLines, this);
+}
+
+const EJFontLayout* EJCanvasContext::fillTextBox (const char* text, float x, float y, float maxWidth, float lineHeight, int maxLines) {
+	EJFont* font = acquireFont(state->fontName, state->fontSize, true, backingStoreRatio);
+	const EJFontLayout* layout = font->layout(text, maxWidth, maxLines, this);
+	this->beginShadow();
+	font->drawLayout(layout, this, x, y, lineHeight > 0 ? lineHeight : font->lineHeight());
+	this->endShadow();
+	return layout;
+}
+
+const EJFontLayout* EJCanvasContext::strokeTextBox (const char* text, float x, float y, float maxWidth, float lineHeight, int maxLines) {
+	EJFont* font = acquireFont(state->fontName, state->fontSize, false, backingStoreRatio);
+	const EJFontLayout* layout = font->layout(text, maxWidth, maxLines, this);
+	this->beginShadow();
+	textOutline = font->outlineWidth(state->lineWidth);
+	font->drawLayout(layout, this, x, y, lineHeight > 0 ? lineHeight : font->lineHeight());
+	textOutline = 0;
+	this->endShadow();
+	return layout;
+}
@@ -9,11 +9,36 @@
 #include "EJPath.h"
 #include "EJCanvasTypes.h"
 #include "EJFont.h"
+#include "EJTextureCache.h"
+#include "EJCanvasResources.h"
+#include "EJCanvasPaint.h"
+#include "EJShadowCache.h"
+
+#include <vector>
+#include <list>
+
+class EJGLBackend;
+class EJPixelReadback;
 
 #define EJ_CANVAS_STATE_STACK_SIZE 16
 #define EJ_CANVAS_VERTEX_BUFFER_SIZE 2048
-
-extern EJVertex CanvasVertexBuffer[EJ_CANVAS_VERTEX_BUFFER_SIZE];
+// larger vertex buffers only take memory; a flush of this many vertices already takes longer than a frame
+#define EJ_CANVAS_MAX_VERTEX_BUFFER_SIZE (256 * 1024)
+#define EJ_CANVAS_VERTEX_BUFFER_OBJECTS 4
+#define EJ_CANVAS_BATCH_SEARCH_DEPTH 8
+#define EJ_CANVAS_TEXTURE_CACHE_BYTES (32 * 1024 * 1024)
+#define EJ_CANVAS_IMAGE_ATLAS_MAX_IMAGE_SIZE 128
+#define EJ_CANVAS_IMAGE_ATLAS_PAGE_SIZE 1024
+#define EJ_CANVAS_IMAGE_ATLAS_PAGES 4
+#define EJ_CANVAS_PAINT_TEXTURES 16
+
+// stencil bits: the lowest three count the path clips a pixel is inside of, the next one is for fills of paths too
+// large to tessellate, and transparent strokes cycle through the highest four
+#define EJ_STENCIL_CLIP_MASK 0x07
+#define EJ_STENCIL_FILL_BIT 0x08
+#define EJ_STENCIL_STROKE_FIRST 0x10
+#define EJ_STENCIL_STROKE_LAST 0x80
+#define EJ_STENCIL_STROKE_MASK 0xf0
 
 typedef enum {
 	kEJLineCapButt,
@@ -54,17 +79,19 @@ typedef enum {
 	kEJCompositeOperationXOR
 } EJCompositeOperation;
 
+// premultipliedSource replaces source for textures whose colors are premultiplied by their alpha already
 static const struct {
 	GLenum source;
 	GLenum destination;
+	GLenum premultipliedSource;
 } EJCompositeOperationFuncs[] = {
-	{GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA},
-	{GL_SRC_ALPHA, GL_ONE},
-	{GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA},
-	{GL_ZERO, GL_ONE_MINUS_SRC_ALPHA},
-	{GL_ONE_MINUS_DST_ALPHA, GL_ONE},
-	{GL_DST_ALPHA, GL_ONE_MINUS_SRC_ALPHA},
-	{GL_ONE_MINUS_DST_ALPHA, GL_ONE_MINUS_SRC_ALPHA}
+	{GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE},
+	{GL_SRC_ALPHA, GL_ONE, GL_ONE},
+	{GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA, GL_DST_COLOR},
+	{GL_ZERO, GL_ONE_MINUS_SRC_ALPHA, GL_ZERO},
+	{GL_ONE_MINUS_DST_ALPHA, GL_ONE, GL_ONE_MINUS_DST_ALPHA},
+	{GL_DST_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_DST_ALPHA},
+	{GL_ONE_MINUS_DST_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE_MINUS_DST_ALPHA}
 };
 
 
@@ -74,6 +101,9 @@ typedef struct {
 	EJCompositeOperation globalCompositeOperation;
 	EJColorRGBA fillColor;
 	EJColorRGBA strokeColor;
+	// gradients or patterns drawn instead of the colors; retained by every state that holds them
+	EJCanvasPaint *fillPaint;
+	EJCanvasPaint *strokePaint;
 	float globalAlpha;
 
 	float lineWidth;
@@ -81,12 +111,49 @@ typedef struct {
 	EJLineJoin lineJoin;
 	float miterLimit;
 
+	// drawn where the color is not transparent and there is a blur or an offset; none of them are transformed
+	EJColorRGBA shadowColor;
+	float shadowBlur;
+	float shadowOffsetX, shadowOffsetY;
+
 	EJTextAlign textAlign;
 	EJTextBaseline textBaseline;
 	char* fontName;
 	float fontSize;
+
+	int clipDepth;		// path clips in effect; inside of all of them the clip bits of the stencil are this
 } EJCanvasState;
 
+// triangles that cover a path clip, in the coordinates of the vertices, and their bounds
+typedef struct {
+	std::vector<EJVector2> triangles;
+	float minX, minY, maxX, maxY;
+} EJCanvasClip;
+
+
+// texture a context made of a paint
+typedef struct {
+	unsigned int paintId, version;
+	EJTexture* texture;
+} EJCanvasPaintTexture;
+
+
+// vertices drawn with one texture and composite operation; bounds are in the coordinates of the vertices
+typedef struct {
+	EJTexture* texture;
+	EJCompositeOperation compositeOperation;
+	float outline;		// width of the band of distance field glyphs that is drawn, 0 if they are filled
+	float minX, minY, maxX, maxY;
+	int first, count;
+	int copied;			// vertices already laid out at first, while flushing
+} EJCanvasBatch;
+
+// vertices of a single push, in the order they were pushed
+typedef struct {
+	int batch;
+	int first, count;
+} EJCanvasCommand;
+
 
 class EJCanvasContext {
 protected:
@@ -100,22 +167,91 @@ protected:
 	EJTexture * currentTexture;
 
 	EJPath *path;
-	EJFont *_font;
+	// memory of the frame: the points of path and scratch of draw calls; reset by resetFrameArena
+	EJFrameArena frameArena;
+	// fonts and image textures, possibly shared with other contexts; the caches are those of resources
+	EJCanvasResources *resources;
+	EJFontCache *fontCache;
+	EJTextureCache *textureCache;
+	// fixed function or shader pipeline, depending on the version of the gl context the canvas was created in
+	EJGLBackend *backend;
+
+	// vertices are collected here and streamed into the next buffer object of the ring on every flush
+	EJVertex *vertexBuffer;
+	int vertexBufferSize;
+	GLuint vertexBufferObjects[EJ_CANVAS_VERTEX_BUFFER_OBJECTS];
+	int vertexBufferObjectIndex;
 
 	int vertexBufferIndex;
 
+	/*
+	 * pushes are recorded as commands and grouped into batches by texture and composite op
+	 * a command joins an earlier batch with the same state if it does not overlap anything drawn in between,
+	 * so the order of overlapping draws is kept. Stencil and scissor changes flush first, so they are never batched over
+	 */
+	std::vector<EJCanvasBatch> batches;
+	std::vector<EJCanvasCommand> commands;
+	EJVertex *sortedVertexBuffer;	// vertices in batch order, as they are uploaded
+	int commandFirst;				// first vertex of the open command, -1 if there is none
+	EJTexture *commandTexture;
+	EJCompositeOperation commandCompositeOperation;
+	bool commandSolid;
+	float commandOutline;
+	// set while strokeText draws glyphs of distance field fonts, see EJFont::outlineWidth
+	float textOutline;
+
+	void beginCommand();
+	void endCommand();
+
+	// canvas pixels sx, sy, sw, sh and where they are in the framebuffer
+	EJPixelRegion pixelRegionSx (float sx, float sy, int sw, int sh);
+
 	int stateIndex;
 	EJCanvasState stateStack[EJ_CANVAS_STATE_STACK_SIZE];
 
-	// TODO: Font
-	//NSCache * fontCache;
+	/*
+	 * path clips of the state stack, innermost last; the first state->clipDepth of them are in effect
+	 * a clip counts the pixels inside of it up by one, and a restore counts them back down with a single rect
+	 * over the clips it pops, so clipping does not clear the stencil. They are kept to be drawn again after it was
+	 */
+	std::vector<EJCanvasClip> clips;
+	// adds a clip covered by the triangles of clip, which are taken over
+	void pushClip (EJCanvasClip &clip);
+	void drawClip (const EJCanvasClip &clip, int depth);
+	// draws the clips in effect again, after the stencil was cleared
+	void redrawClips();
+
+	/*
+	 * textures of the paints drawn recently, most recently used first; pending draws are flushed before one is deleted
+	 * between beginPaint and endPaint the texture coordinates of all pushed vertices are computed from their positions
+	 */
+	std::list<EJCanvasPaintTexture> paintTextures;
+	bool paintActive;
+	CGAffineTransform paintTransform;
+	EJTexture* paintTexture (EJCanvasPaint *paint);
+
+	/*
+	 * between beginShadow and endShadow every flush draws the shadow of its vertices before them: their silhouette
+	 * is drawn into a scratch framebuffer scaled down with the blur, blurred there in two passes and drawn under them.
+	 * Shadows are cached, so drawing the same shape with the same blur again only costs a quad
+	 */
+	EJShadowCache *shadowCache;
+	bool shadowCapture;
+	void drawShadow (GLuint vertexBufferObject);
+
+	// cleared to have beginFrame called before the next draw call reaches gl
+	bool frameBegun;
+	virtual void beginFrame() {}
+	// binds the framebuffer, viewport, projection and clip the context draws with again, after drawing elsewhere
+	virtual void restoreTarget();
 
 public:
 	~EJCanvasContext();
 	EJCanvasContext* initWithWidth (short width, short height);
-	EJCanvasContext (short width, short height);
+	// the context retains resources; without any it gets resources of its own
+	EJCanvasContext (short width, short height, EJCanvasResources *resources = NULL);
 	void create();
-	void createStencilBufferOnce();
+	virtual void createStencilBufferOnce();
 	void bindVertexBuffer();
 	void setState();
 	void prepare();
@@ -123,7 +259,39 @@ public:
 	void pushTriX1 (float x1, float y1, float x2, float y2, float x3, float y3, EJColorRGBA color, CGAffineTransform transform);
 	void pushQuadV1 (EJVector2 v1, EJVector2 v2, EJVector2 v3, EJVector2 v4, EJVector2 t1, EJVector2 t2, EJVector2 t3, EJVector2 t4, EJColorRGBA color, CGAffineTransform transform);
 	void pushRectX (float x, float y, float w, float h, float tx, float ty, float tw, float th, EJColorRGBA color, CGAffineTransform transform);
+	// pushes count solid rects of x, y, w, h each
+	void pushRects (const float *rects, int count, EJColorRGBA color, CGAffineTransform transform);
+	// reserves count vertices in the vertex buffer, flushing it first if it is full; all of them have to be written
+	EJVertex* pushVertices (int count);
+	// number of vertices collected before they are drawn; a frame that fits needs only a single draw call per state change
+	void setVertexBufferSize (int size);
+	int getVertexBufferSize();
+	EJFrameArena* getFrameArena() { return &frameArena; }
+	// frees the memory of the last frame; the current path is kept
+	void resetFrameArena();
 	void flushBuffers();
+	// true if draw calls were recorded since the last flush
+	bool hasPendingDraws() const { return commandFirst >= 0 || !commands.empty(); }
+	EJGLBackend* glBackend() { return backend; }
+	// textures of the images drawn with this context
+	EJTextureCache* getTextureCache() { return textureCache; }
+	EJCanvasResources* getResources() { return resources; }
+
+	// gradient or pattern to fill or stroke with, retained by the state; null to use the color
+	void setFillPaint (EJCanvasPaint *paint);
+	void setStrokePaint (EJCanvasPaint *paint);
+	// sets up drawing with paint, or with color if there is none, and returns the color of the vertices;
+	// color is multiplied with the global alpha
+	EJColorRGBA beginPaint (EJCanvasPaint *paint, EJColorRGBA color);
+	void endPaint() { paintActive = false; }
+	bool isPaintActive() const { return paintActive; }
+	// draws following pushes with the coverage ramp of the glyph atlas, so hairlines batch with solid fills and text;
+	// returns its texture coordinates, which are transparent at u0 and u1 and opaque halfway between, at v
+	void setCoverageTexture (float *u0, float *u1, float *v);
+	// texture coordinate of a vertex at position; only needed for vertices written with pushVertices
+	EJVector2 paintUV (EJVector2 position) const {
+		return paintActive ? EJVector2ApplyTransform(position, paintTransform) : EJVector2Make(0, 0);
+	}
 
 	void save();
 	void restore();
@@ -135,14 +303,41 @@ public:
 	void drawImage (EJTexture *texture, float sx, float sy,
 			float sw, float sh, float dx, float dy, float dw, float dh);
 	void fillRectX (float x, float y, float w, float h);
+	// fills count rects of x, y, w, h each, like fillRectX for every one of them
+	void fillRects (const float *rects, int count);
 	void strokeRectX (float x, float y, float w, float h);
 	void clearRectX (float x, float y, float w, float h);
 	EJImageData* getImageDataSx (float sx, float sy, float sw, float sh);
+	// reads sw x sh canvas pixels at sx, sy as rgba, top row first; pixels outside of the canvas are transparent black
+	void readPixels (float sx, float sy, int sw, int sh, GLubyte *pixels);
+	// starts reading the same pixels without waiting for the gpu; NULL if the gl context can not do that
+	EJPixelReadback* beginReadPixels (float sx, float sy, int sw, int sh);
+	void finishReadPixels (EJPixelReadback *readback, GLubyte *pixels);
 	void putImageData (EJImageData* imageData, float dx, float dy);
+	// replaces width x height canvas pixels at dx, dy with rgba pixels, top row first, ignoring transform, alpha and composite operation
+	void putPixels (int width, int height, const GLubyte *pixels, float dx, float dy);
 	void beginPath();
 	void closePath();
-	void fill();
+	void fill (EJFillRule fillRule);
+	// fill or stroke a retained path with the current transform; its points are not affected by the transform of the context
+	void fillPath (EJPath *retainedPath, EJFillRule fillRule);
 	void stroke();
+	void strokePath (EJPath *retainedPath);
+	// intersects the clip with the path; it is reset by the restore of the current state
+	void clip (EJFillRule fillRule);
+	void clipPath (EJPath *retainedPath, EJFillRule fillRule);
+	// hit tests of a point in canvas units, which the transform does not apply to; retained paths are tested with the
+	// current transform, and strokes with the current line width
+	bool isPointInPath (float x, float y, EJFillRule fillRule);
+	bool isPointInPath (EJPath *retainedPath, float x, float y, EJFillRule fillRule);
+	bool isPointInStroke (float x, float y);
+	bool isPointInStroke (EJPath *retainedPath, float x, float y);
+	// sets the stencil test that keeps draw calls inside the clip; code that uses the stencil calls it when it is done
+	void applyClipStencil();
+	// around a draw call that is to cast a shadow; code that draws with the stencil ends the shadow first,
+	// so those draws cast none
+	void beginShadow();
+	void endShadow();
 	void moveToX (float x, float y);
 	void lineToX (float x, float y);
 	void rectX (float x, float y, float w, float h);
@@ -154,9 +349,16 @@ public:
 	bool setFont (char* font);
 	char* getFont();
 	EJFont* acquireFont (char* fontName, float pointSize, bool fill, float contentScale);
+	// text is drawn with distance fields, which stay sharp at any scale, where the backend supports them
+	bool distanceFieldText;
 	void fillText (const char* text, float x, float y);
 	void strokeText (const char* text, float x, float y);
 	float measureText (const char* text);
+	// text in lines with the current font, see EJFont::layout; the layout is valid until the next call
+	const EJFontLayout* layoutText (const char* text, float maxWidth, int maxLines);
+	// draws text in lines lineHeight apart, or as far apart as the font says for a lineHeight of 0
+	const EJFontLayout* fillTextBox (const char* text, float x, float y, float maxWidth, float lineHeight, int maxLines);
+	const EJFontLayout* strokeTextBox (const char* text, float x, float y, float maxWidth, float lineHeight, int maxLines);
 
 	// Synthesized
 	void setGlobalCompositeOperation (EJCompositeOperation op);
@@ -169,6 +371,8 @@ public:
 	int msaaSamples;
 	short width, height;
 	bool vertexBufferBound;
+	// counters of the frame that is drawn, shared by the contexts of a view; NULL unless frame stats are collected
+	EJFrameStats *frameStats;
 };
 
 /*
@@ -229,14 +433,6 @@ public:
 @property (nonatomic) int msaaSamples; */
 
 /* TODO: not yet implemented:
-	createLinearGradient(x0, y0, x1, y1)
-	createRadialGradient(x0, y0, r0, x1, y1, r1)
-	createPattern(image, repetition)
-	shadowOffsetX
-	shadowOffsetY
-	shadowBlur
-	shadowColor
-	clip()
 	isPointInPath(x, y)
 */
 
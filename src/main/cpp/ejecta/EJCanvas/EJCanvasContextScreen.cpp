@@ -5,6 +5,8 @@
 #include "NdkMisc.h"
 
 #include "GLcompat.h"
+#include "EJGLBackend.h"
+#include "EJGLState.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -28,12 +30,11 @@ EJCanvasContextScreen::EJCanvasContextScreen(short widthp, short heightp) : EJCa
 	// [glview.context renderbufferStorage:GL_RENDERBUFFER fromDrawable:(CAEAGLLayer *)glview.layer];
 	COMPAT_glFramebufferRenderbuffer(COMPAT_GL_FRAMEBUFFER, COMPAT_GL_COLOR_ATTACHMENT0, COMPAT_GL_RENDERBUFFER, viewRenderBuffer);
 
-	glDisable(GL_CULL_FACE);
-	glDisable(GL_DEPTH_TEST);
-	glDisable(GL_LIGHTING);
-	glDisable(GL_DITHER);
+	EJGLState::disable(GL_CULL_FACE);
+	EJGLState::disable(GL_DEPTH_TEST);
+	EJGLState::disable(GL_DITHER);
 
-	glEnable(GL_BLEND);
+	EJGLState::enable(GL_BLEND);
 
 	this->prepare();
 }
@@ -42,38 +43,7 @@ void EJCanvasContextScreen::prepare () {
 	this->EJCanvasContext::prepare();
 
 	// Flip the screen - OpenGL has the origin in the bottom left corner. We want the top left.
-	glTranslatef(0, height, 0);
-	glScalef( 1, -1, 1 );
-}
-
-EJImageData* EJCanvasContextScreen::getImageDataSx (float sx, float sy, float sw, float sh)  {
-	// FIXME: This takes care of the flipped pixel layout and the internal scaling.
-	// The latter will mush pixel; not sure how to fix it - print warning instead.
-
-	this->flushBuffers();
-
-	// Read pixels; take care of the upside down screen layout and the backingStoreRatio
-	int internalWidth = sw * backingStoreRatio;
-	int internalHeight = sh * backingStoreRatio;
-	int internalX = sx * backingStoreRatio;
-	int internalY = (height-sy-sh) * backingStoreRatio;
-
-	EJColorRGBA * internalPixels = (EJColorRGBA *)malloc(internalWidth * internalHeight * sizeof(EJColorRGBA));
-	glReadPixels (internalX, internalY, internalWidth, internalHeight, GL_RGBA, GL_UNSIGNED_BYTE, internalPixels);
-
-	// Flip and scale pixels to requested size
-	EJColorRGBA* pixels = (EJColorRGBA *)malloc (sw * sh * sizeof(EJColorRGBA));
-	int index = 0;
-	for( int y = 0; y < sh; y++ ) {
-		for( int x = 0; x < sw; x++ ) {
-			int internalIndex = (int)((sh-y-1) * backingStoreRatio) * internalWidth + (int)(x * backingStoreRatio);
-			pixels[ index ] = internalPixels[ internalIndex ];
-			index++;
-		}
-	}
-	free(internalPixels);
-
-	return EJImageData::initWithWidth (sw, sh, (GLubyte *)pixels);
+	backend->setProjection(width, height, true);
 }
 
 void EJCanvasContextScreen::finish () {
@@ -24,7 +24,6 @@ public:
 	void present();
 	void finish();
 	void resetGLContext();
-	EJImageData* getImageDataSx(float, float, float, float);
 };
 
 
@@ -0,0 +1,231 @@
+#include "EJCanvasPaint.h"
+
+#include <math.h>
+#include <algorithm>
+
+// texels of the color row of gradients, and of the square radial gradients are evaluated in
+#define EJ_PAINT_GRADIENT_SIZE 256
+#define EJ_PAINT_RADIAL_SIZE 128
+
+static std::atomic<unsigned int> nextPaintId(1);
+
+static int nextPot (int size) {
+	int pot = 1;
+	while( pot < size ) {
+		pot *= 2;
+	}
+	return pot;
+}
+
+EJCanvasPaint::EJCanvasPaint (EJPaintType type) : wrapper(NULL), _refCount(1), _type(type), _id(nextPaintId++), _version(0),
+	_x0(0), _y0(0), _r0(0), _x1(0), _y1(0), _r1(0), _image(NULL), _repetition(kEJPatternRepeat), _imageOpaque(false) {
+}
+
+EJCanvasPaint::~EJCanvasPaint() {
+	if( _image ) { _image->release(); }
+}
+
+EJCanvasPaint* EJCanvasPaint::linearGradient (float x0, float y0, float x1, float y1) {
+	EJCanvasPaint* paint = new EJCanvasPaint(kEJPaintLinearGradient);
+	paint->_x0 = x0; paint->_y0 = y0;
+	paint->_x1 = x1; paint->_y1 = y1;
+	return paint;
+}
+
+EJCanvasPaint* EJCanvasPaint::radialGradient (float x0, float y0, float r0, float x1, float y1, float r1) {
+	EJCanvasPaint* paint = new EJCanvasPaint(kEJPaintRadialGradient);
+	paint->_x0 = x0; paint->_y0 = y0; paint->_r0 = r0;
+	paint->_x1 = x1; paint->_y1 = y1; paint->_r1 = r1;
+	return paint;
+}
+
+EJCanvasPaint* EJCanvasPaint::pattern (EJImage* image, EJPatternRepetition repetition) {
+	EJCanvasPaint* paint = new EJCanvasPaint(kEJPaintPattern);
+	image->retain();
+	paint->_image = image;
+	paint->_repetition = repetition;
+
+	const GLubyte* pixels = image->pixels();
+	const int count = image->width() * image->height();
+	bool opaque = true;
+	for( int i = 0; i < count && opaque; i++ ) {
+		opaque = pixels[i * 4 + 3] == 0xff;
+	}
+	paint->_imageOpaque = opaque;
+	return paint;
+}
+
+void EJCanvasPaint::retain() {
+	_refCount++;
+}
+
+void EJCanvasPaint::release() {
+	if( --_refCount == 0 ) {
+		delete this;
+	}
+}
+
+void EJCanvasPaint::addColorStop (float offset, EJColorRGBA color) {
+	std::vector<std::pair<float, EJColorRGBA> >::iterator at = _stops.begin();
+	while( at != _stops.end() && at->first <= offset ) {
+		++at;
+	}
+	_stops.insert(at, std::make_pair(offset, color));
+	_version++;
+}
+
+bool EJCanvasPaint::isOpaque() const {
+	if( _type == kEJPaintPattern ) {
+		return _imageOpaque && _repetition == kEJPatternRepeat;
+	}
+	for( size_t i = 0; i < _stops.size(); i++ ) {
+		if( _stops[i].second.rgba.a != 0xff ) { return false; }
+	}
+	return !_stops.empty();
+}
+
+void EJCanvasPaint::gradientColors (EJColorRGBA* colors, int count) const {
+	// colors are interpolated without premultiplying alpha, like the canvas spec asks for
+	size_t next = 0;
+	for( int i = 0; i < count; i++ ) {
+		const float t = (float)i / (count - 1);
+		while( next < _stops.size() && _stops[next].first <= t ) {
+			next++;
+		}
+		if( next == 0 ) {
+			colors[i] = _stops.front().second;
+		}
+		else if( next == _stops.size() ) {
+			colors[i] = _stops.back().second;
+		}
+		else {
+			const std::pair<float, EJColorRGBA> &a = _stops[next - 1], &b = _stops[next];
+			const float f = (t - a.first) / (b.first - a.first);
+			for( int c = 0; c < 4; c++ ) {
+				colors[i].components[c] = (unsigned char)(a.second.components[c] + (b.second.components[c] - a.second.components[c]) * f + 0.5f);
+			}
+		}
+	}
+}
+
+EJTexture* EJCanvasPaint::createTexture() const {
+	if( _type == kEJPaintLinearGradient ) {
+		if( _stops.empty() || (_x0 == _x1 && _y0 == _y1) ) { return NULL; }
+
+		EJColorRGBA colors[EJ_PAINT_GRADIENT_SIZE];
+		this->gradientColors(colors, EJ_PAINT_GRADIENT_SIZE);
+		return EJTexture::initWithWidth(EJ_PAINT_GRADIENT_SIZE, 1, (GLubyte*)colors);
+	}
+
+	if( _type == kEJPaintRadialGradient ) {
+		const float minX = std::min(_x0 - _r0, _x1 - _r1), maxX = std::max(_x0 + _r0, _x1 + _r1);
+		const float minY = std::min(_y0 - _r0, _y1 - _r1), maxY = std::max(_y0 + _r0, _y1 + _r1);
+		if( _stops.empty() || maxX <= minX || maxY <= minY ) { return NULL; }
+
+		EJColorRGBA lut[EJ_PAINT_GRADIENT_SIZE];
+		this->gradientColors(lut, EJ_PAINT_GRADIENT_SIZE);
+
+		// for every texel the largest w is searched whose circle, interpolated between both, passes through it
+		const int size = EJ_PAINT_RADIAL_SIZE;
+		std::vector<EJColorRGBA> pixels(size * size);
+		const float cdx = _x1 - _x0, cdy = _y1 - _y0, dr = _r1 - _r0;
+		const float a = cdx * cdx + cdy * cdy - dr * dr;
+		const EJColorRGBA transparent = {{0, 0, 0, 0}};
+		for( int y = 0; y < size; y++ ) {
+			const float pdy = minY + (maxY - minY) * y / (size - 1) - _y0;
+			for( int x = 0; x < size; x++ ) {
+				const float pdx = minX + (maxX - minX) * x / (size - 1) - _x0;
+				const float b = pdx * cdx + pdy * cdy + _r0 * dr;
+				const float c = pdx * pdx + pdy * pdy - _r0 * _r0;
+
+				float w = NAN;
+				if( fabsf(a) < 1e-6f ) {
+					if( b != 0 ) { w = c / (2 * b); }
+					if( _r0 + w * dr < 0 ) { w = NAN; }
+				}
+				else {
+					const float disc = b * b - a * c;
+					if( disc >= 0 ) {
+						const float root = sqrtf(disc);
+						const float w1 = (b + root) / a, w2 = (b - root) / a;
+						w = std::max(w1, w2);
+						if( _r0 + w * dr < 0 ) { w = std::min(w1, w2); }
+						if( _r0 + w * dr < 0 ) { w = NAN; }
+					}
+				}
+
+				if( isnan(w) ) {
+					pixels[y * size + x] = transparent;
+				}
+				else {
+					const float t = std::min(1.0f, std::max(0.0f, w));
+					pixels[y * size + x] = lut[(int)(t * (EJ_PAINT_GRADIENT_SIZE - 1) + 0.5f)];
+				}
+			}
+		}
+		return EJTexture::initWithWidth(size, size, (GLubyte*)pixels.data());
+	}
+
+	// a repeating axis is scaled to a power of two, which GL_REPEAT needs in GLES1 and GLES2;
+	// the others get a transparent texel on both sides for the clamped edge to be transparent
+	const int w = _image->width(), h = _image->height();
+	if( w <= 0 || h <= 0 ) { return NULL; }
+	const bool repeatX = _repetition == kEJPatternRepeat || _repetition == kEJPatternRepeatX;
+	const bool repeatY = _repetition == kEJPatternRepeat || _repetition == kEJPatternRepeatY;
+	const int tw = nextPot(repeatX ? w : w + 2), th = nextPot(repeatY ? h : h + 2);
+
+	const GLuint* source = (const GLuint*)_image->pixels();
+	std::vector<GLuint> pixels(tw * th, 0);
+	for( int y = 0; y < th; y++ ) {
+		const int sy = repeatY ? y * h / th : y - 1;
+		if( sy < 0 || sy >= h ) { continue; }
+		for( int x = 0; x < tw; x++ ) {
+			const int sx = repeatX ? x * w / tw : x - 1;
+			if( sx < 0 || sx >= w ) { continue; }
+			pixels[y * tw + x] = source[sy * w + sx];
+		}
+	}
+	EJTexture* texture = EJTexture::initWithWidth(tw, th, (GLubyte*)pixels.data());
+	texture->setPremultiplied(_image->premultiplied());
+	texture->setWrap(repeatX ? GL_REPEAT : GL_CLAMP_TO_EDGE, repeatY ? GL_REPEAT : GL_CLAMP_TO_EDGE);
+	return texture;
+}
+
+CGAffineTransform EJCanvasPaint::textureTransform() const {
+	CGAffineTransform t = { 0, 0, 0, 0, 0, 0 };
+
+	if( _type == kEJPaintLinearGradient ) {
+		// offset 0 and 1 are at the centers of the first and last texel
+		const float dx = _x1 - _x0, dy = _y1 - _y0;
+		const float length2 = dx * dx + dy * dy;
+		if( length2 == 0 ) { return t; }
+		const float s = (float)(EJ_PAINT_GRADIENT_SIZE - 1) / EJ_PAINT_GRADIENT_SIZE / length2;
+		t.a = dx * s;
+		t.c = dy * s;
+		t.tx = -(_x0 * dx + _y0 * dy) * s + 0.5f / EJ_PAINT_GRADIENT_SIZE;
+		t.ty = 0.5f;
+	}
+	else if( _type == kEJPaintRadialGradient ) {
+		// the bounds of both circles span from the center of the first texel to that of the last
+		const float minX = std::min(_x0 - _r0, _x1 - _r1), maxX = std::max(_x0 + _r0, _x1 + _r1);
+		const float minY = std::min(_y0 - _r0, _y1 - _r1), maxY = std::max(_y0 + _r0, _y1 + _r1);
+		if( maxX <= minX || maxY <= minY ) { return t; }
+		const float s = (float)(EJ_PAINT_RADIAL_SIZE - 1) / EJ_PAINT_RADIAL_SIZE;
+		t.a = s / (maxX - minX);
+		t.d = s / (maxY - minY);
+		t.tx = 0.5f / EJ_PAINT_RADIAL_SIZE - minX * t.a;
+		t.ty = 0.5f / EJ_PAINT_RADIAL_SIZE - minY * t.d;
+	}
+	else {
+		// one repetition of a repeating axis is the whole texture; the image starts one texel in on the others
+		const int w = _image->width(), h = _image->height();
+		const bool repeatX = _repetition == kEJPatternRepeat || _repetition == kEJPatternRepeatX;
+		const bool repeatY = _repetition == kEJPatternRepeat || _repetition == kEJPatternRepeatY;
+		const float tw = nextPot(repeatX ? w : w + 2), th = nextPot(repeatY ? h : h + 2);
+		t.a = repeatX ? 1.0f / w : 1.0f / tw;
+		t.d = repeatY ? 1.0f / h : 1.0f / th;
+		t.tx = repeatX ? 0 : 1.0f / tw;
+		t.ty = repeatY ? 0 : 1.0f / th;
+	}
+	return t;
+}
@@ -0,0 +1,83 @@
+#ifndef __EJCANVASPAINT_H
+#define __EJCANVASPAINT_H	1
+
+#include "EJCanvasTypes.h"
+#include "EJTexture.h"
+#include "EJImage.h"
+
+#include <atomic>
+#include <vector>
+
+typedef enum {
+	kEJPaintLinearGradient,
+	kEJPaintRadialGradient,
+	kEJPaintPattern
+} EJPaintType;
+
+typedef enum {
+	kEJPatternRepeat,
+	kEJPatternRepeatX,
+	kEJPatternRepeatY,
+	kEJPatternNoRepeat
+} EJPatternRepetition;
+
+/**
+ * A gradient or pattern that fills and strokes are drawn with
+ * Paints are drawn with a lookup texture, sampled at texture coordinates that are an affine function of the canvas
+ * coordinates, so they batch like images: linear gradients with a row of colors, radial gradients with the colors
+ * evaluated over the bounds of both circles and patterns with a power of two copy of the image that can repeat.
+ * Paints are kept on the cpu and refcounted, since scripts and saved states hold them; every context makes its own
+ * texture on first use and makes a new one whenever version changes.
+ */
+class EJCanvasPaint {
+public:
+	// retained paints
+	static EJCanvasPaint* linearGradient (float x0, float y0, float x1, float y1);
+	static EJCanvasPaint* radialGradient (float x0, float y0, float r0, float x1, float y1, float r1);
+	// image has to be decoded
+	static EJCanvasPaint* pattern (EJImage* image, EJPatternRepetition repetition);
+
+	void retain();
+	void release();
+
+	EJPaintType type() const { return _type; }
+	// unique for the lifetime of the process, so textures made of a deleted paint are never mistaken for those of a new one
+	unsigned int id() const { return _id; }
+	unsigned int version() const { return _version; }
+
+	// adds a color stop to a gradient; stops at the same offset are kept in the order they were added
+	void addColorStop (float offset, EJColorRGBA color);
+
+	// true if no pixel of the paint is partially transparent, so drawing a pixel twice looks like drawing it once
+	bool isOpaque() const;
+
+	// new texture with the pixels of the paint, on the gl thread; null if the paint draws nothing
+	EJTexture* createTexture() const;
+	// maps canvas units, in the transform the paint is drawn with, to coordinates of its texture
+	CGAffineTransform textureTransform() const;
+
+	// the script object of the paint, while there is one
+	void* wrapper;
+
+private:
+	EJCanvasPaint (EJPaintType type);
+	~EJCanvasPaint();
+
+	// colors of the gradient from offset 0 to 1
+	void gradientColors (EJColorRGBA* colors, int count) const;
+
+	std::atomic<int> _refCount;
+	EJPaintType _type;
+	unsigned int _id, _version;
+
+	// gradients
+	float _x0, _y0, _r0, _x1, _y1, _r1;
+	std::vector<std::pair<float, EJColorRGBA> > _stops;
+
+	// patterns
+	EJImage* _image;
+	EJPatternRepetition _repetition;
+	bool _imageOpaque;
+};
+
+#endif
@@ -0,0 +1,66 @@
+#include "EJCanvasResources.h"
+#include "EJCanvasContext.h"
+
+std::mutex EJCanvasResources::registryMutex;
+std::unordered_map<const void*, EJCanvasResources*> EJCanvasResources::registry;
+std::atomic<unsigned int> EJCanvasResources::purgeRequest(0);
+
+EJCanvasResources::EJCanvasResources() : _refCount(1), _purged(purgeRequest), _group(NULL) {
+	_fontCache = new EJFontCache(8);
+	_textureCache = new EJTextureCache(EJ_CANVAS_IMAGE_ATLAS_MAX_IMAGE_SIZE,
+			EJ_CANVAS_IMAGE_ATLAS_PAGE_SIZE, EJ_CANVAS_IMAGE_ATLAS_PAGES);
+	_uploader = EJTextureUploader::create();
+	_textureCache->setUploader(_uploader);
+}
+
+EJCanvasResources::~EJCanvasResources() {
+	// the textures of the cache cancel their uploads first
+	delete _textureCache;
+	delete _uploader;
+	delete _fontCache;
+}
+
+EJCanvasResources* EJCanvasResources::shared (const void* group) {
+	std::lock_guard<std::mutex> lock(registryMutex);
+	auto it = registry.find(group);
+	if( it != registry.end() ) {
+		it->second->retain();
+		return it->second;
+	}
+
+	EJCanvasResources* resources = new EJCanvasResources();
+	resources->_group = group;
+	registry[group] = resources;
+	return resources;
+}
+
+void EJCanvasResources::requestPurge (bool critical) {
+	// a request racing another one may get lost, which purges only once for both
+	const unsigned int count = (purgeRequest >> 1) + 1;
+	purgeRequest = (count << 1) | (critical ? 1 : 0);
+}
+
+void EJCanvasResources::purgeIfRequested() {
+	const unsigned int request = purgeRequest;
+	if( request == _purged ) {
+		return;
+	}
+	_purged = request;
+	_textureCache->purge();
+	if( request & 1 ) {
+		_fontCache->purge();
+	}
+}
+
+void EJCanvasResources::retain() {
+	_refCount++;
+}
+
+void EJCanvasResources::release() {
+	// the registry lock keeps shared from handing out the resources while they are deleted
+	std::lock_guard<std::mutex> lock(registryMutex);
+	if( --_refCount == 0 ) {
+		if( _group ) { registry.erase(_group); }
+		delete this;
+	}
+}
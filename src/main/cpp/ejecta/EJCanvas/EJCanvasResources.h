@@ -0,0 +1,58 @@
+#ifndef __EJCANVASRESOURCES_H
+#define __EJCANVASRESOURCES_H	1
+
+#include "EJFont.h"
+#include "EJTextureCache.h"
+#include "EJTextureUploader.h"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * The fonts and image textures of canvas contexts; contexts whose gl contexts share objects can share them, so every
+ * glyph and image is uploaded once for all of them
+ * Sharing resources requires the contexts to be driven one at a time and to flush before the next one draws, since
+ * evicting a texture only flushes the context that draws. Shared resources are registered by group while they are
+ * retained; the last release deletes the textures and has to happen with a gl context of the group current.
+ * Resources are created with a gl context of the group current, whose objects the texture uploader shares.
+ */
+class EJCanvasResources {
+public:
+	// resources of a context that shares nothing, retained once
+	EJCanvasResources();
+
+	// retained resources of group, created if the group has none yet
+	static EJCanvasResources* shared (const void* group);
+
+	void retain();
+	void release();
+
+	EJFontCache* fontCache() { return _fontCache; }
+	EJTextureCache* textureCache() { return _textureCache; }
+
+	/**
+	 * asks all resources to free what they can make again, the next time their contexts render; can be called on any
+	 * thread. Image textures are freed in any case, fonts only if critical is set
+	 */
+	static void requestPurge (bool critical);
+	// called with a gl context of the group current before the contexts draw a frame
+	void purgeIfRequested();
+
+private:
+	~EJCanvasResources();
+
+	std::atomic<int> _refCount;
+	unsigned int _purged;		// the last purge request handled
+	const void* _group;
+	EJFontCache* _fontCache;
+	EJTextureCache* _textureCache;
+	EJTextureUploader* _uploader;		// NULL if uploads can not happen in the background
+
+	static std::mutex registryMutex;
+	static std::unordered_map<const void*, EJCanvasResources*> registry;
+	// count of purge requests, shifted left by one; the lowest bit is set if the latest one was critical
+	static std::atomic<unsigned int> purgeRequest;
+};
+
+#endif
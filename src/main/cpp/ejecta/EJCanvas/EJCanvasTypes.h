@@ -3,6 +3,7 @@
 #define __EJCANVASTYPES_H 1
 
 #include <math.h>
+#include <stdint.h>
 #include "CGCompat.h"
 
 
@@ -83,11 +84,27 @@ static inline float CGAffineTransformGetScale( CGAffineTransform t ) {
 	return sqrtf( t.a*t.a + t.c*t.c );
 }
 
+// the largest factor the transform stretches any direction by, its largest singular value
+static inline float CGAffineTransformGetMaxScale( CGAffineTransform t ) {
+	const float sum = t.a*t.a + t.b*t.b + t.c*t.c + t.d*t.d;
+	const float det = t.a*t.d - t.b*t.c;
+	return sqrtf( (sum + sqrtf( fmaxf(sum*sum - 4*det*det, 0) )) / 2 );
+}
+
 typedef struct {
 	EJVector2 pos;
 	EJVector2 uv;
 	EJColorRGBA color;
 } EJVertex;
 
+// what the contexts drawing a frame sent to gl; gpuTime is in nanoseconds, -1 where it is not measured
+// queueDepth and presentLatency are filled in by the view that swaps the frame, see BGJSFramePacer
+typedef struct {
+	int drawCalls, vertices, textureBinds, stencilPasses, flushes;
+	int64_t gpuTime;
+	int queueDepth;
+	int64_t presentLatency;
+} EJFrameStats;
+
 
 #endif
@@ -0,0 +1,160 @@
+#include "EJCompressedImage.h"
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#define EJ_ETC1_RGB8					0x8D64
+#define EJ_ETC2_R11						0x9270
+#define EJ_ETC2_SIGNED_R11				0x9271
+#define EJ_ETC2_RG11					0x9272
+#define EJ_ETC2_SIGNED_RG11				0x9273
+#define EJ_ETC2_RGB8					0x9274
+#define EJ_ETC2_SRGB8					0x9275
+#define EJ_ETC2_RGB8_ALPHA1				0x9276
+#define EJ_ETC2_SRGB8_ALPHA1			0x9277
+#define EJ_ETC2_RGBA8					0x9278
+#define EJ_ETC2_SRGB8_ALPHA8			0x9279
+#define EJ_ASTC_RGBA_4x4				0x93B0
+#define EJ_ASTC_RGBA_12x12				0x93BD
+#define EJ_ASTC_SRGB8_ALPHA8_4x4		0x93D0
+#define EJ_ASTC_SRGB8_ALPHA8_12x12		0x93DD
+
+namespace {
+
+// size of the blocks of format in pixels and bytes; false for formats that are not known here
+bool blockSize (GLenum format, int* blockWidth, int* blockHeight, int* blockBytes) {
+	static const int astcBlocks[14][2] = {
+		{4, 4}, {5, 4}, {5, 5}, {6, 5}, {6, 6}, {8, 5}, {8, 6}, {8, 8}, {10, 5}, {10, 6}, {10, 8}, {10, 10}, {12, 10}, {12, 12}
+	};
+	if( format >= EJ_ASTC_RGBA_4x4 && format <= EJ_ASTC_RGBA_12x12 ) {
+		*blockWidth = astcBlocks[format - EJ_ASTC_RGBA_4x4][0];
+		*blockHeight = astcBlocks[format - EJ_ASTC_RGBA_4x4][1];
+		*blockBytes = 16;
+		return true;
+	}
+	if( format >= EJ_ASTC_SRGB8_ALPHA8_4x4 && format <= EJ_ASTC_SRGB8_ALPHA8_12x12 ) {
+		*blockWidth = astcBlocks[format - EJ_ASTC_SRGB8_ALPHA8_4x4][0];
+		*blockHeight = astcBlocks[format - EJ_ASTC_SRGB8_ALPHA8_4x4][1];
+		*blockBytes = 16;
+		return true;
+	}
+
+	*blockWidth = *blockHeight = 4;
+	switch( format ) {
+		case EJ_ETC1_RGB8: case EJ_ETC2_RGB8: case EJ_ETC2_SRGB8: case EJ_ETC2_RGB8_ALPHA1: case EJ_ETC2_SRGB8_ALPHA1:
+		case EJ_ETC2_R11: case EJ_ETC2_SIGNED_R11:
+			*blockBytes = 8;
+			return true;
+		case EJ_ETC2_RGBA8: case EJ_ETC2_SRGB8_ALPHA8: case EJ_ETC2_RG11: case EJ_ETC2_SIGNED_RG11:
+			*blockBytes = 16;
+			return true;
+	}
+	return false;
+}
+
+size_t levelBytes (GLenum format, int width, int height) {
+	int bw, bh, bytes;
+	if( !blockSize(format, &bw, &bh, &bytes) ) { return 0; }
+	return (size_t)((width + bw - 1) / bw) * ((height + bh - 1) / bh) * bytes;
+}
+
+uint32_t readU32 (const unsigned char* p, bool swap) {
+	uint32_t v;
+	memcpy(&v, p, 4);
+	return swap ? __builtin_bswap32(v) : v;
+}
+
+unsigned readU16BE (const unsigned char* p) {
+	return (p[0] << 8) | p[1];
+}
+
+bool endsWith (const std::string& s, const char* suffix) {
+	const size_t n = strlen(suffix);
+	if( s.size() < n ) { return false; }
+	for( size_t i = 0; i < n; i++ ) {
+		if( tolower(s[s.size() - n + i]) != suffix[i] ) { return false; }
+	}
+	return true;
+}
+
+}
+
+EJCompressedImage* EJCompressedImage::initWithData (const unsigned char* data, size_t length) {
+	static const unsigned char ktxIdentifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+	if( length >= 64 && memcmp(data, ktxIdentifier, sizeof(ktxIdentifier)) == 0 ) {
+		// ktx 1: 13 words after the identifier, key/value data, then the size and data of every mip level
+		const bool swap = readU32(data + 12, false) != 0x04030201;
+		const uint32_t glType = readU32(data + 16, swap);
+		const uint32_t glInternalFormat = readU32(data + 28, swap);
+		const uint32_t width = readU32(data + 36, swap), height = readU32(data + 40, swap);
+		const uint32_t depth = readU32(data + 44, swap), elements = readU32(data + 48, swap), faces = readU32(data + 52, swap);
+		const uint32_t keyValueBytes = readU32(data + 60, swap);
+		if( glType != 0 || depth > 1 || elements > 0 || faces != 1 || width == 0 || height == 0 || width > 0x7fff || height > 0x7fff ) {
+			return NULL;
+		}
+
+		const size_t expected = levelBytes(glInternalFormat, width, height);
+		const size_t offset = 64 + (size_t)keyValueBytes;
+		if( !expected || keyValueBytes > length || offset + 4 > length ) { return NULL; }
+		const size_t bytes = readU32(data + offset, swap);
+		if( bytes < expected || bytes > length - offset - 4 ) { return NULL; }
+		return new EJCompressedImage(glInternalFormat, width, height, data + offset + 4, expected);
+	}
+
+	if( length >= 16 && memcmp(data, "PKM ", 4) == 0 ) {
+		// pkm: version, type, the size padded to blocks and the size of the image, big endian
+		static const GLenum pkmFormats[9] = {
+			EJ_ETC1_RGB8, EJ_ETC2_RGB8, 0, EJ_ETC2_RGBA8, EJ_ETC2_RGB8_ALPHA1, EJ_ETC2_R11, EJ_ETC2_RG11,
+			EJ_ETC2_SIGNED_R11, EJ_ETC2_SIGNED_RG11
+		};
+		const unsigned type = readU16BE(data + 6);
+		const int width = readU16BE(data + 12), height = readU16BE(data + 14);
+		const GLenum format = type < 9 ? pkmFormats[type] : 0;
+		if( !format || (data[4] == '1' && type != 0) || width == 0 || height == 0 ) { return NULL; }
+
+		const size_t expected = levelBytes(format, width, height);
+		if( expected > length - 16 ) { return NULL; }
+		return new EJCompressedImage(format, width, height, data + 16, expected);
+	}
+	return NULL;
+}
+
+EJCompressedImage::EJCompressedImage (GLenum format, int width, int height, const unsigned char* data, size_t bytes) :
+	_format(format), _width(width), _height(height), _data((unsigned char*)malloc(bytes)), _bytes(bytes) {
+	memcpy(_data, data, bytes);
+}
+
+EJCompressedImage::~EJCompressedImage() {
+	free(_data);
+}
+
+std::string EJCompressedImage::fallbackPath (const std::string& path) {
+	if( !endsWith(path, ".ktx") && !endsWith(path, ".pkm") ) { return std::string(); }
+	return path.substr(0, path.size() - 4) + ".png";
+}
+
+GLenum EJCompressedImage::uploadFormat (GLenum format) {
+	static std::vector<GLint> formats;
+	static bool queried = false;
+	if( !queried ) {
+		GLint count = 0;
+		glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &count);
+		formats.resize(std::max(count, 0));
+		if( count > 0 ) { glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data()); }
+		queried = true;
+	}
+
+	if( std::find(formats.begin(), formats.end(), (GLint)format) != formats.end() ) {
+		return format;
+	}
+	// etc1 is a subset of etc2, so drivers that only list the latter sample it as etc2 rgb
+	if( format == EJ_ETC1_RGB8 && std::find(formats.begin(), formats.end(), (GLint)EJ_ETC2_RGB8) != formats.end() ) {
+		return EJ_ETC2_RGB8;
+	}
+	return 0;
+}
@@ -0,0 +1,42 @@
+#ifndef __EJCOMPRESSEDIMAGE_H
+#define __EJCOMPRESSEDIMAGE_H	1
+
+#include "GLcompat.h"
+
+#include <stddef.h>
+#include <string>
+
+/**
+ * The first level of a block compressed texture, read from a ktx or pkm file
+ * ETC1, ETC2/EAC and ASTC textures stay compressed on the gpu, which takes 4 to 8 times less memory and bandwidth
+ * than rgba. Whether a format can be uploaded is only known on the gl thread, from the formats the driver lists;
+ * images that can not be used that way are decoded from the png of the same name instead.
+ */
+class EJCompressedImage {
+public:
+	// NULL if data is neither a ktx nor a pkm file of a compressed 2d texture in a format that is known here
+	static EJCompressedImage* initWithData (const unsigned char* data, size_t length);
+	~EJCompressedImage();
+
+	// path of the png that is drawn instead of a .ktx or .pkm file; empty for other paths
+	static std::string fallbackPath (const std::string& path);
+
+	// format that textures of format are uploaded as, or 0 if the driver can not sample them; on the gl thread
+	static GLenum uploadFormat (GLenum format);
+
+	GLenum format() const { return _format; }
+	int width() const { return _width; }
+	int height() const { return _height; }
+	const unsigned char* data() const { return _data; }
+	size_t bytes() const { return _bytes; }
+
+private:
+	EJCompressedImage (GLenum format, int width, int height, const unsigned char* data, size_t bytes);
+
+	GLenum _format;
+	int _width, _height;
+	unsigned char* _data;
+	size_t _bytes;
+};
+
+#endif
@@ -0,0 +1,80 @@
+#include "EJDistanceField.h"
+
+#include <math.h>
+
+// larger than any squared distance in a glyph, but small enough to add a squared distance to
+#define EJ_DISTANCE_FAR 1e20f
+
+void EJDistanceField::compute (const unsigned char* pixels, int width, int height, int stride, int spread, std::vector<unsigned char>& out) {
+	const int w = width + 2 * spread, h = height + 2 * spread;
+	_inside.assign(w * h, 0);
+	_outside.assign(w * h, 0);
+	for( int y = 0; y < h; y++ ) {
+		for( int x = 0; x < w; x++ ) {
+			const int gx = x - spread, gy = y - spread;
+			const bool in = gx >= 0 && gy >= 0 && gx < width && gy < height && pixels[gy * stride + gx] >= 0x80;
+			// texels are 0 where the distance is measured to
+			_inside[y * w + x] = in ? EJ_DISTANCE_FAR : 0;
+			_outside[y * w + x] = in ? 0 : EJ_DISTANCE_FAR;
+		}
+	}
+	transform(_inside, w, h);
+	transform(_outside, w, h);
+
+	// the outline runs halfway between the last texel inside and the first outside
+	out.resize(w * h);
+	const float scale = 0.5f / spread;
+	for( int i = 0; i < w * h; i++ ) {
+		const float distance = _outside[i] > 0 ? 0.5f - sqrtf(_outside[i]) : sqrtf(_inside[i]) - 0.5f;
+		const float value = 0.5f + distance * scale;
+		out[i] = (unsigned char)(value <= 0 ? 0 : value >= 1 ? 255 : value * 255 + 0.5f);
+	}
+}
+
+void EJDistanceField::transform (std::vector<float>& grid, int width, int height) {
+	// columns first, then rows of the column distances
+	const int longest = width > height ? width : height;
+	_f.resize(longest);
+	_d.resize(longest);
+	_z.resize(longest + 1);
+	_v.resize(longest);
+
+	for( int x = 0; x < width; x++ ) {
+		for( int y = 0; y < height; y++ ) { _f[y] = grid[y * width + x]; }
+		transform1d(height);
+		for( int y = 0; y < height; y++ ) { grid[y * width + x] = _d[y]; }
+	}
+	for( int y = 0; y < height; y++ ) {
+		for( int x = 0; x < width; x++ ) { _f[x] = grid[y * width + x]; }
+		transform1d(width);
+		for( int x = 0; x < width; x++ ) { grid[y * width + x] = _d[x]; }
+	}
+}
+
+void EJDistanceField::transform1d (int count) {
+	// lower envelope of the parabolas rooted at every texel (Felzenszwalb and Huttenlocher)
+	int k = 0;
+	_v[0] = 0;
+	_z[0] = -INFINITY;
+	_z[1] = INFINITY;
+	for( int q = 1; q < count; q++ ) {
+		int p = _v[k];
+		float s = ((_f[q] + q * q) - (_f[p] + p * p)) / (2 * q - 2 * p);
+		while( s <= _z[k] ) {
+			k--;
+			p = _v[k];
+			s = ((_f[q] + q * q) - (_f[p] + p * p)) / (2 * q - 2 * p);
+		}
+		k++;
+		_v[k] = q;
+		_z[k] = s;
+		_z[k + 1] = INFINITY;
+	}
+
+	k = 0;
+	for( int q = 0; q < count; q++ ) {
+		while( _z[k + 1] < q ) { k++; }
+		const int p = _v[k];
+		_d[q] = (float)(q - p) * (q - p) + _f[p];
+	}
+}
@@ -0,0 +1,27 @@
+#ifndef __EJDISTANCEFIELD_H
+#define __EJDISTANCEFIELD_H	1
+
+#include <vector>
+
+/**
+ * Signed distance fields of glyph bitmaps
+ * Every texel holds the distance to the outline of the glyph, 0.5 on the outline and growing inwards, so the glyph can
+ * be scaled and rotated by thresholding the bilinearly filtered field instead of being rendered at every size.
+ * Distances are exact euclidean distances between texel centers (two passes of 1d lower envelopes), clamped to spread.
+ */
+class EJDistanceField {
+public:
+	// writes the field of a bitmap of 8 bit coverage into out, which gets spread texels of padding on every side
+	void compute (const unsigned char* pixels, int width, int height, int stride, int spread, std::vector<unsigned char>& out);
+
+private:
+	// squared distances to the nearest texel of the other side, in place over rows of width texels
+	void transform (std::vector<float>& grid, int width, int height);
+	void transform1d (int count);
+
+	std::vector<float> _inside, _outside;
+	std::vector<float> _f, _d, _z;
+	std::vector<int> _v;
+};
+
+#endif
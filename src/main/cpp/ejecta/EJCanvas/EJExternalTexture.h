@@ -0,0 +1,53 @@
+#ifndef __EJEXTERNALTEXTURE_H
+#define __EJEXTERNALTEXTURE_H	1
+
+#include "CGCompat.h"
+
+#include <atomic>
+
+// from GLES2/gl2ext.h, which not every ndk has all of
+#ifndef GL_TEXTURE_EXTERNAL_OES
+#define GL_TEXTURE_EXTERNAL_OES 0x8D65
+#endif
+
+/**
+ * A texture of GL_TEXTURE_EXTERNAL_OES that a java SurfaceTexture streams the frames of a video or a camera into
+ * The gl texture belongs to the SurfaceTexture, and with it to the gl context of the view that made it, so images of it
+ * are only drawn by the contexts of that view. Every frame may come with another transform from the texture
+ * coordinates of canvases, with 0, 0 at the top left corner of the image, to those of the frame, which can be
+ * flipped, cropped or rotated. The transform and the texture are set and read on the gl thread only.
+ */
+class EJExternalTexture {
+public:
+	EJExternalTexture (unsigned int textureId, int width, int height) :
+		_refCount(1), _textureId(textureId), _width(width), _height(height), _uvTransform(CGAffineTransformIdentity) {
+	}
+
+	void retain() { _refCount++; }
+	void release() { if( --_refCount == 0 ) { delete this; } }
+
+	// 0 once the SurfaceTexture is gone, which samples black
+	unsigned int textureId() const { return _textureId; }
+	void detach() { _textureId = 0; }
+	int width() const { return _width; }
+	int height() const { return _height; }
+
+	const CGAffineTransform& uvTransform() const { return _uvTransform; }
+	// takes the column major 4x4 matrix of SurfaceTexture.getTransformMatrix, whose v grows upwards
+	void setTransformMatrix (const float *m) {
+		// canvases have v = 0 at the top, so v is flipped before the matrix is applied
+		_uvTransform = CGAffineTransformMake(m[0], m[1], -m[4], -m[5], m[12] + m[4], m[13] + m[5]);
+	}
+
+private:
+	~EJExternalTexture() {}
+	EJExternalTexture (const EJExternalTexture&) = delete;
+	EJExternalTexture& operator= (const EJExternalTexture&) = delete;
+
+	std::atomic<int> _refCount;
+	unsigned int _textureId;
+	int _width, _height;
+	CGAffineTransform _uvTransform;
+};
+
+#endif
@@ -1,6 +1,8 @@
 #include <stddef.h>
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <math.h>
 
 #include "stdlib.h"
 #include "mallocdebug.h"
@@ -8,16 +10,6 @@
 #include "EJFont.h"
 #include "EJCanvasContext.h"
 
-//#include "fonts/arial-38.h"
-/*#include "fonts/roboto_regular-15.h"
-#include "fonts/roboto_regular-24.h"
-#include "fonts/roboto_regular-30.h" */
-#include "fonts/roboto-medium-24.h"
-#include "fonts/roboto-medium-30.h" 
-#include "fonts/roboto-medium-40.h" 
-/* #include "fonts/tahoma-15.h"
-#include "fonts/tahoma-24.h"
-#include "fonts/tahoma-30.h" */
 #include "GLcompat.h"
 #include "NdkMisc.h"
 #include <utf8.h>
@@ -26,51 +18,136 @@
 #define PT_TO_PX(pt) pt
 #define LOG_TAG "EJFont"
 
-EJFont::EJFont (const char* font, int size, bool useFill, float cs) {
+EJFont::EJFont (const char* font, int size, bool useFill, float cs, EJFontCache* cache) {
 
 	// size is in points, calculate number of pixels from that.
 	// Points = 1/72 inch, we can assume 2.22 pixel per pt for mdpi
 	float pxSize = (float)size * 1.5f;
-	float realPxSize = pxSize * cs;
 
-	_copy = false;
-    _isFilled = useFill;
+	// glyphs are rendered at the resolution of the backing store and scaled back to canvas units when drawn
+	init(font, pxSize * cs, useFill, 1.0f / cs, cache);
+}
 
-	_font = &font_roboto_medium_24;
-	if (realPxSize >= 40) {
-		_font = &font_roboto_medium_40;
-	} else if (realPxSize >= 30) {
-		_font = &font_roboto_medium_30;
-	} 
+EJFont::EJFont (const char* font, EJFontCache* cache) {
+	init(font, kDistanceFieldSize, true, 1.0f, cache);
+	_distanceField = true;
+}
 
-	if (_font->size != (float)pxSize || cs != 1.0) {
-		_scale = (float)pxSize / _font->size;
-		// LOGI("Scaling font to %f, wanted size is %f (%d), font size is %f, cs is %f, realPx %f", _scale, pxSize, size, _font->size, cs, realPxSize);
-	} else {
-		_scale = 1;
+EJFont::EJFont (EJFont* base, int size, bool useFill) {
+	// the glyphs are scaled anyway, so the resolution of the backing store does not matter
+	init(NULL, 0, useFill, (float)size * 1.5f / kDistanceFieldSize, base->_cache);
+	_base = base;
+	_metrics = base->_metrics;
+}
+
+void EJFont::init (const char* font, float pxSize, bool useFill, float scale, EJFontCache* cache) {
+	_cache = cache;
+	_base = NULL;
+	_distanceField = false;
+    _isFilled = useFill;
+
+	_scale = scale;
+	memset(&_metrics, 0, sizeof(_metrics));
+	_face = NULL;
+	if (font && cache->rasterizer()) {
+		_face = cache->rasterizer()->createFace(font, pxSize, &_metrics);
 	}
+	if (font && !_face) {
+		LOGE("Cannot create font %s at %fpx", font, pxSize);
+	}
+
+	memset(_latin1, 0, sizeof(_latin1));
+
 	_utf32bufsize = 4096;
 	_utf32buffer = (uint32_t*)malloc(_utf32bufsize);
-
-	/* for (int i = 0; i < _font->tex_height * _font->tex_width; ++i) {
-		GLubyte alpha = _font->tex_data[i];
-		if (alpha == 0) {
-			_font->tex_data[i] = 96;
-		}
-	} */
-	_texture = EJTexture::initWithWidth(_font->tex_width, _font->tex_height, (GLubyte*)_font->tex_data, GL_ALPHA, 1);
 }
 
 EJFont::~EJFont() {
-	if (_copy) {
-		free(_font);
+	if (_face) {
+		_cache->rasterizer()->releaseFace(_face);
 	}
 	free(_utf32buffer);
 }
 
-void EJFont::drawString (const char* utf8string, EJCanvasContext* toContext, float pen_x, float pen_y) {
-    size_t i, j, k;
-    const int rawLength = strlen(utf8string);
+EJGlyphAtlas* EJFont::atlas() {
+	return _distanceField || _base ? _cache->distanceAtlas() : _cache->atlas();
+}
+
+EJFontGlyph* EJFont::glyph (uint32_t codepoint, EJCanvasContext* context) {
+	if (_base) {
+		return _base->glyph(codepoint, context);
+	}
+
+	EJFontGlyph* glyph;
+	if (codepoint < 256) {
+		glyph = &_latin1[codepoint];
+	} else {
+		glyph = &_glyphs[codepoint];
+	}
+
+	if (!glyph->loaded || (context && glyph->width && !atlas()->isValid(&glyph->slot))) {
+		if (!loadGlyph(codepoint, glyph, context)) {
+			return NULL;
+		}
+	}
+	return glyph;
+}
+
+bool EJFont::loadGlyph (uint32_t codepoint, EJFontGlyph* glyph, EJCanvasContext* context) {
+	if (!_face) {
+		return false;
+	}
+
+	EJGlyphBitmap bitmap;
+	if (!_cache->rasterizer()->rasterize(_face, codepoint, _cache->glyphBuffer(), EJFontCache::kGlyphBufferSize, &bitmap)) {
+		// remember the failure, so it is not retried for every string
+		memset(glyph, 0, sizeof(EJFontGlyph));
+		glyph->loaded = true;
+		glyph->slot.page = -1;
+		return false;
+	}
+
+	glyph->loaded = true;
+	glyph->width = bitmap.width;
+	glyph->height = bitmap.height;
+	glyph->left = bitmap.left;
+	glyph->top = bitmap.top;
+	glyph->advance = bitmap.advance;
+	glyph->slot.page = -1;
+
+	// distance fields reach past the bitmap, and so does the quad of the glyph
+	if (_distanceField && glyph->width) {
+		glyph->width += 2 * kDistanceFieldSpread;
+		glyph->height += 2 * kDistanceFieldSpread;
+		glyph->left -= kDistanceFieldSpread;
+		glyph->top += kDistanceFieldSpread;
+	}
+
+	// glyphs that were loaded without a context are rendered again once they are drawn
+	if (context && glyph->width) {
+		const unsigned char* pixels = _distanceField ? _cache->distanceField(bitmap) : _cache->glyphBuffer();
+		const int stride = _distanceField ? glyph->width : bitmap.stride;
+		if (!atlas()->add(context, pixels, glyph->width, glyph->height, stride, &glyph->slot)) {
+			glyph->width = 0;
+		}
+	}
+	return true;
+}
+
+const EJFontRun* EJFont::run (const char* utf8string, EJCanvasContext* context) {
+	const size_t rawLength = strlen(utf8string);
+	const bool cacheable = rawLength <= kMaxRunLength;
+	if (cacheable) {
+		_runKey.assign(utf8string, rawLength);
+		auto it = _runIndex.find(_runKey);
+		if (it != _runIndex.end()) {
+			if (it->second != _runs.begin()) {
+				_runs.splice(_runs.begin(), _runs, it->second);
+			}
+			return &(*it->second);
+		}
+	}
+
     const int length = utf8::distance(utf8string, utf8string + rawLength);
 
     if (length * 4 >= _utf32bufsize) {
@@ -80,16 +157,212 @@ void EJFont::drawString (const char* utf8string, EJCanvasContext* toContext, flo
 
     utf8::utf8to32(utf8string, utf8string + rawLength, _utf32buffer);
 
+	EJFontRun* run;
+	if (cacheable) {
+		if (_runs.size() >= kRunCacheSize) {
+			_runIndex.erase(_runs.back().text);
+			_runs.pop_back();
+		}
+		_runs.emplace_front();
+		run = &_runs.front();
+		run->text = _runKey;
+		_runIndex[run->text] = _runs.begin();
+	} else {
+		run = &_uncachedRun;
+	}
+
+	run->glyphs.clear();
+	float pen_x = 0.0f;
+	for (int i=0; i<length; ++i) {
+		const uint32_t codepoint = _utf32buffer[i];
+		EJFontGlyph *glyph = this->glyph(codepoint, context);
+		if (!glyph) {
+			continue;
+		}
+		if (glyph->width) {
+			run->glyphs.push_back((EJFontRunGlyph) {
+				codepoint, glyph,
+				pen_x + glyph->left * _scale, -glyph->top * _scale,
+				glyph->width * _scale, glyph->height * _scale
+			});
+		}
+		pen_x += glyph->advance * _scale;
+	}
+	run->width = pen_x;
+	return run;
+}
+
+// spaces lines are wrapped at; they hang past the end of the line instead of wrapping themselves
+static bool isBreakSpace (uint32_t codepoint) {
+	return codepoint == ' ' || codepoint == '\t' || codepoint == 0x200b || codepoint == 0x3000;
+}
+
+// scripts without spaces between words, which may be wrapped between any two characters
+static bool isIdeographic (uint32_t codepoint) {
+	return (codepoint >= 0x2e80 && codepoint <= 0x9fff) || (codepoint >= 0xac00 && codepoint <= 0xd7af) ||
+		(codepoint >= 0xf900 && codepoint <= 0xfaff) || (codepoint >= 0xff00 && codepoint <= 0xffef) ||
+		(codepoint >= 0x20000 && codepoint <= 0x3ffff);
+}
+
+const EJFontLayout* EJFont::layout (const char* utf8string, float maxWidth, int maxLines, EJCanvasContext* context) {
+	EJFontLayout& layout = _layout;
+	layout.lines.clear();
+	layout.glyphs.clear();
+	layout.width = 0;
+	layout.truncated = false;
+	if (!(maxWidth > 0)) {
+		maxWidth = INFINITY;
+	}
+	if (maxLines <= 0) {
+		maxLines = INT_MAX;
+	}
+	const size_t rawLength = strlen(utf8string);
+
+	// most labels fit on one line, and the run cache already has their glyphs
+	if (!memchr(utf8string, '\n', rawLength)) {
+		const EJFontRun* run = this->run(utf8string, context);
+		if (run->width <= maxWidth) {
+			layout.glyphs = run->glyphs;
+			layout.lines.push_back((EJFontLine) { 0, rawLength, run->width, 0, run->glyphs.size(), false });
+			layout.width = run->width;
+			return &layout;
+		}
+	}
+
+	_layoutChars.clear();
+	float pen = 0.0f;
+	const char* it = utf8string;
+	const char* end = utf8string + rawLength;
+	while (it < end) {
+		const size_t offset = it - utf8string;
+		const uint32_t codepoint = utf8::unchecked::next(it);
+		EJFontGlyph* glyph = this->glyph(codepoint, context);
+		_layoutChars.push_back((LayoutChar) { codepoint, glyph, pen, offset });
+		if (glyph) {
+			pen += glyph->advance * _scale;
+		}
+	}
+	const size_t count = _layoutChars.size();
+	// the pen and offset at the end of the text, so every line can look at the character after it
+	_layoutChars.push_back((LayoutChar) { 0, NULL, pen, rawLength });
+	const LayoutChar* chars = _layoutChars.data();
+
+	// U+2026, or three dots for fonts that lack it
+	uint32_t ellipsisCodepoint = 0x2026;
+	int ellipsisCount = 1;
+	EJFontGlyph* ellipsis = this->glyph(ellipsisCodepoint, context);
+	if (!ellipsis || !ellipsis->advance) {
+		ellipsisCodepoint = '.';
+		ellipsisCount = 3;
+		ellipsis = this->glyph(ellipsisCodepoint, context);
+	}
+	const float ellipsisWidth = ellipsis ? ellipsis->advance * _scale * ellipsisCount : 0.0f;
+
+	size_t lineStart = 0;
+	for (;;) {
+		size_t lineEnd = count, next = count;
+		size_t breakEnd = 0, breakNext = 0;
+		bool newline = false;
+		for (size_t i = lineStart; i < count; i++) {
+			const uint32_t codepoint = chars[i].codepoint;
+			if (codepoint == '\n') {
+				lineEnd = i;
+				next = i + 1;
+				newline = true;
+				break;
+			}
+			if (isBreakSpace(codepoint)) {
+				if (i == lineStart || !isBreakSpace(chars[i - 1].codepoint)) {
+					breakEnd = i;
+				}
+				breakNext = i + 1;
+				continue;
+			}
+			if (i > lineStart && !isBreakSpace(chars[i - 1].codepoint) &&
+					(chars[i - 1].codepoint == '-' || isIdeographic(chars[i - 1].codepoint) || isIdeographic(codepoint))) {
+				breakEnd = breakNext = i;
+			}
+			// every line takes at least one character, however narrow it is
+			if (i > lineStart && chars[i + 1].pen - chars[lineStart].pen > maxWidth) {
+				if (breakEnd > lineStart) {
+					lineEnd = breakEnd;
+					next = breakNext;
+				} else {
+					lineEnd = next = i;
+				}
+				break;
+			}
+		}
+
+		const bool more = newline || next < count;
+		const bool truncated = more && (int)layout.lines.size() + 1 >= maxLines;
+		if (truncated) {
+			while (lineEnd > lineStart && chars[lineEnd].pen - chars[lineStart].pen + ellipsisWidth > maxWidth) {
+				lineEnd--;
+			}
+			while (lineEnd > lineStart && isBreakSpace(chars[lineEnd - 1].codepoint)) {
+				lineEnd--;
+			}
+		}
+
+		EJFontLine line;
+		line.start = chars[lineStart].offset;
+		line.length = chars[lineEnd].offset - line.start;
+		line.firstGlyph = layout.glyphs.size();
+		const float origin = chars[lineStart].pen;
+		for (size_t i = lineStart; i < lineEnd; i++) {
+			const EJFontGlyph* glyph = chars[i].glyph;
+			if (glyph && glyph->width) {
+				layout.glyphs.push_back((EJFontRunGlyph) {
+					chars[i].codepoint, chars[i].glyph,
+					chars[i].pen - origin + glyph->left * _scale, -glyph->top * _scale,
+					glyph->width * _scale, glyph->height * _scale
+				});
+			}
+		}
+		line.width = chars[lineEnd].pen - origin;
+		if (truncated && ellipsis) {
+			for (int i = 0; i < ellipsisCount; i++) {
+				if (ellipsis->width) {
+					layout.glyphs.push_back((EJFontRunGlyph) {
+						ellipsisCodepoint, ellipsis,
+						line.width + ellipsis->left * _scale, -ellipsis->top * _scale,
+						ellipsis->width * _scale, ellipsis->height * _scale
+					});
+				}
+				line.width += ellipsis->advance * _scale;
+			}
+		}
+		line.glyphCount = layout.glyphs.size() - line.firstGlyph;
+		line.ellipsis = truncated;
+		layout.lines.push_back(line);
+		layout.width = fmaxf(layout.width, line.width);
+
+		if (truncated) {
+			layout.truncated = true;
+			break;
+		}
+		if (!more) {
+			break;
+		}
+		lineStart = next;
+	}
+	return &layout;
+}
+
+float EJFont::alignedX (float pen_x, float width, EJCanvasContext* toContext) {
 	// Figure out the x position with the current textAlign.
 	if(toContext->state->textAlign != kEJTextAlignLeft) {
-		float w = measureStringFromBuffer(length);
 		if( toContext->state->textAlign == kEJTextAlignRight || toContext->state->textAlign == kEJTextAlignEnd ) {
-			pen_x -= w;
+			pen_x -= width;
 		} else if( toContext->state->textAlign == kEJTextAlignCenter ) {
-			pen_x -= w/2.0f;
+			pen_x -= width/2.0f;
 		}
 	}
+	return pen_x;
+}
 
+float EJFont::baselineOffset (EJCanvasContext* toContext) {
 	// Figure out the y position with the current textBaseline
 	switch( toContext->state->textBaseline ) {
 		case kEJTextBaselineAlphabetic:
@@ -97,155 +370,145 @@ void EJFont::drawString (const char* utf8string, EJCanvasContext* toContext, flo
 			break;
 		case kEJTextBaselineTop:
 		case kEJTextBaselineHanging:
-			pen_y += PT_TO_PX(_font->ascender * _scale/* + ascentDelta */);
-			break;
+			return PT_TO_PX(_metrics.ascender * _scale/* + ascentDelta */);
 		case kEJTextBaselineMiddle:
-			pen_y += PT_TO_PX(_font->ascender * _scale - (0.5*_font->height * _scale));
-			break;
+			return PT_TO_PX(_metrics.ascender * _scale - (0.5*_metrics.height * _scale));
 		case kEJTextBaselineBottom:
-			pen_y += PT_TO_PX(_font->descender * _scale);
-			break;
+			return PT_TO_PX(_metrics.descender * _scale);
 	}
-	// pen_y = floor(pen_y);
-
-    toContext->save();
-    toContext->setTexture(_texture);
-    for (i=0; i<length; ++i) {
-        texture_glyph_t *glyph = 0;
-        for (j=0; j<_font->glyphs_count; ++j) {
-            if (_font->glyphs[j].codepoint == _utf32buffer[i]) {
-                glyph = &(_font->glyphs[j]);
-                break;
-            }
-        }
-        if (!glyph) {
-            continue;
-        }
-
-        // Find next glyph for kerning
-        if (i < length - 1) {
-        	uint32_t nextCode = _utf32buffer[i+1];
-            for( k=0; k < glyph->kerning_count; ++k) {
-                if (glyph->kerning[k].codepoint == nextCode) {
-                    pen_x += (glyph->kerning[k].kerning * _scale);
-                    // LOGI("Kerning found for char %c %c: %f", (char)glyph->charcode, nextCode, (glyph->kerning[k].kerning * _scale));
-                    break;
-                }
-            }
-        }
+	return 0.0f;
+}
 
+void EJFont::drawString (const char* utf8string, EJCanvasContext* toContext, float pen_x, float pen_y) {
+	const EJFontRun* run = this->run(utf8string, toContext);
 
-        float x = (pen_x + glyph->offset_x * _scale);
-        float y = (pen_y - glyph->offset_y * _scale);
-        float w  = (glyph->width * _scale);
-        float h  = (glyph->height * _scale);
-        toContext->pushRectX(x, y, w, h, glyph->s0, glyph->t0 /* - 1.0f/256 */, glyph->s1 - glyph->s0, glyph->t1 - glyph->t0 /* + 1.0f/256 */, _isFilled ? toContext->state->fillColor : toContext->state->strokeColor, toContext->state->transform);
-        /* glBegin( GL_TRIANGLES );
-        {
-            glTexCoord2f( glyph->s0, glyph->t0 ); glVertex2i( x,   y   );
-            glTexCoord2f( glyph->s0, glyph->t1 ); glVertex2i( x,   y-h );
-            glTexCoord2f( glyph->s1, glyph->t1 ); glVertex2i( x+w, y-h );
-            glTexCoord2f( glyph->s0, glyph->t0 ); glVertex2i( x,   y   );
-            glTexCoord2f( glyph->s1, glyph->t1 ); glVertex2i( x+w, y-h );
-            glTexCoord2f( glyph->s1, glyph->t0 ); glVertex2i( x+w, y   );
-        }
-        glEnd(); */
-        pen_x += glyph->advance_x * _scale;
-        /* if (w < 2) {
-        	pen_x += 5;
-        } else {
-        	pen_x += w + 1;
-        } */
-        // pen_y += glyph->advance_y;
-    }
-    toContext->restore();
+	toContext->save();
+	drawGlyphs(run->glyphs.data(), run->glyphs.size(), toContext, alignedX(pen_x, run->width, toContext),
+			pen_y + baselineOffset(toContext));
+	toContext->restore();
 }
 
-float EJFont::measureString (const char* utf8string) {
-    size_t i, j, k;
+void EJFont::drawLayout (const EJFontLayout* layout, EJCanvasContext* toContext, float pen_x, float pen_y, float lineHeight) {
+	pen_y += baselineOffset(toContext);
 
-    const int rawLength = strlen(utf8string);
-    const int length = utf8::distance(utf8string, utf8string + rawLength);
-
-    if (length * 4 >= _utf32bufsize) {
-    	_utf32bufsize = length * 4 + 4;
-    	_utf32buffer = (uint32_t*)realloc(_utf32buffer, _utf32bufsize);
-    }
+	toContext->save();
+	for (const EJFontLine& line : layout->lines) {
+		drawGlyphs(layout->glyphs.data() + line.firstGlyph, line.glyphCount, toContext,
+				alignedX(pen_x, line.width, toContext), pen_y);
+		pen_y += lineHeight;
+	}
+	toContext->restore();
+}
 
-    utf8::utf8to32(utf8string, utf8string + rawLength, _utf32buffer);
+void EJFont::drawGlyphs (const EJFontRunGlyph* glyphs, size_t count, EJCanvasContext* toContext, float pen_x, float pen_y) {
+	const EJColorRGBA color = _isFilled ? toContext->state->fillColor : toContext->state->strokeColor;
+	const CGAffineTransform transform = toContext->state->transform;
+	const bool transformed = !CGAffineTransformIsIdentity(transform);
+	EJGlyphAtlas* atlas = this->atlas();
 
-    float width = 0.0f;
-    for (i=0; i<length; ++i) {
-        texture_glyph_t *glyph = 0;
-        for (j=0; j<_font->glyphs_count; ++j) {
-            if (_font->glyphs[j].codepoint == _utf32buffer[i]) {
-                glyph = &(_font->glyphs[j]);
-                break;
-            }
-        }
-        if (!glyph) {
+    for (size_t i = 0; i < count; i++) {
+        const EJFontRunGlyph& runGlyph = glyphs[i];
+        // the page the glyph was on might have been reused, or it was only measured so far
+        if (!atlas->isValid(&runGlyph.glyph->slot) && (!this->glyph(runGlyph.codepoint, toContext) || !runGlyph.glyph->width)) {
             continue;
         }
-
-        width += glyph->advance_x * _scale;
-        // float w = glyph->width;
-        /* if (w < 2) {
-        	width += 5;
-        } else {
-        	width += w + 1;
-        } */
-
-        // Find next glyph for kerning
-        if (i < length - 1) {
-        	uint32_t nextCode = _utf32buffer[i+1];
-            for (k=0; k < glyph->kerning_count; ++k) {
-                if (glyph->kerning[k].codepoint == nextCode) {
-                    width += (glyph->kerning[k].kerning * _scale);
-                    break;
-                }
-            }
+        const EJGlyphAtlasSlot& slot = runGlyph.glyph->slot;
+
+        // glyphs on different pages end up in different batches of the context
+        toContext->setTexture(atlas->use(&slot));
+
+        EJVector2 d11 = { pen_x + runGlyph.x, pen_y + runGlyph.y };
+        EJVector2 d21 = { d11.x + runGlyph.w, d11.y };
+        EJVector2 d12 = { d11.x, d11.y + runGlyph.h };
+        EJVector2 d22 = { d21.x, d12.y };
+        if (transformed) {
+            d11 = EJVector2ApplyTransform(d11, transform);
+            d21 = EJVector2ApplyTransform(d21, transform);
+            d12 = EJVector2ApplyTransform(d12, transform);
+            d22 = EJVector2ApplyTransform(d22, transform);
         }
+
+        EJVertex* vb = toContext->pushVertices(6);
+        vb[0] = (EJVertex) { d11, {slot.s0, slot.t0}, color };	// top left
+        vb[1] = (EJVertex) { d21, {slot.s1, slot.t0}, color };	// top right
+        vb[2] = (EJVertex) { d12, {slot.s0, slot.t1}, color };	// bottom left
+
+        vb[3] = (EJVertex) { d21, {slot.s1, slot.t0}, color };	// top right
+        vb[4] = (EJVertex) { d12, {slot.s0, slot.t1}, color };	// bottom left
+        vb[5] = (EJVertex) { d22, {slot.s1, slot.t1}, color };	// bottom right
     }
-    return width;
 }
 
-float EJFont::measureStringFromBuffer (int length) {
-    size_t i, j, k;
+float EJFont::measureString (const char* utf8string, EJCanvasContext* context) {
+    return run(utf8string, context)->width;
+}
 
+float EJFont::outlineWidth (float lineWidth) {
+	if (!_base) {
+		return 0;
+	}
+	// a texel is _scale canvas units, and the field falls off by 0.5 over the spread; wider strokes are cut off there
+	const float width = lineWidth / 2 / _scale * 0.5f / kDistanceFieldSpread;
+	return width < 0.45f ? width : 0.45f;
+}
 
-    float width = 0.0f;
-    for (i=0; i<length; ++i) {
-        texture_glyph_t *glyph = 0;
-        for (j=0; j<_font->glyphs_count; ++j) {
-            if (_font->glyphs[j].codepoint == _utf32buffer[i]) {
-                glyph = &(_font->glyphs[j]);
-                break;
-            }
-        }
-        if (!glyph) {
-            continue;
-        }
+EJFontCache::EJFontCache (size_t countLimit) : _atlas(512, 4), _distanceAtlas(512, 2, GL_LUMINANCE) {
+	_countLimit = countLimit;
+	_rasterizer = EJGlyphRasterizer::shared();
+}
 
-        // width += glyph->offset_x * _scale;
-
-        // Find next glyph for kerning
-        if (i < length - 1) {
-        	uint32_t nextCode = _utf32buffer[i+1];
-            for (k=0; k < glyph->kerning_count; ++k) {
-                if (glyph->kerning[k].codepoint == nextCode) {
-                    width += (glyph->kerning[k].kerning * _scale);
-                    break;
-                }
-            }
-        }
+EJFontCache::~EJFontCache() {
+	purge();
+}
 
-         width += glyph->advance_x * _scale;
-        // float w = glyph->width;
-        /* if (w < 2) {
-        	width += 5;
-        } else {
-        	width += w + 1;
-        } */
-    }
-    return width;
+void EJFontCache::purge() {
+	for (auto& entry : _entries) {
+		delete entry.font;
+	}
+	_entries.clear();
+	for (auto& font : _distanceFonts) {
+		delete font.second;
+	}
+	_distanceFonts.clear();
+	std::vector<unsigned char>().swap(_distanceBuffer);
+}
+
+const unsigned char* EJFontCache::distanceField (const EJGlyphBitmap& bitmap) {
+	_distanceField.compute(_glyphBuffer, bitmap.width, bitmap.height, bitmap.stride, EJFont::kDistanceFieldSpread, _distanceBuffer);
+	return _distanceBuffer.data();
+}
+
+EJFont* EJFontCache::get (const char* fontName, float pointSize, bool fill, float contentScale, bool distanceField) {
+	for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+		if (it->pointSize == pointSize && it->fill == fill && it->distanceField == distanceField &&
+				(distanceField || it->contentScale == contentScale) && it->name == fontName) {
+			if (it != _entries.begin()) {
+				_entries.splice(_entries.begin(), _entries, it);
+			}
+			return it->font;
+		}
+	}
+
+	if (_entries.size() >= _countLimit) {
+		delete _entries.back().font;
+		_entries.pop_back();
+	}
+
+	Entry entry;
+	entry.name = fontName;
+	entry.pointSize = pointSize;
+	entry.fill = fill;
+	entry.contentScale = contentScale;
+	entry.distanceField = distanceField;
+	if (distanceField) {
+		EJFont*& base = _distanceFonts[fontName];
+		if (!base) {
+			base = new EJFont(fontName, this);
+		}
+		entry.font = new EJFont(base, pointSize, fill);
+	} else {
+		entry.font = new EJFont(fontName, pointSize, fill, contentScale, this);
+	}
+	_entries.push_front(entry);
+	return entry.font;
 }
@@ -2,56 +2,180 @@
 #define __EJFONT_H	1
 
 #include "EJTexture.h"
+#include "EJGlyphAtlas.h"
+#include "EJDistanceField.h"
+
+#include <vector>
+#include <list>
+#include <string>
+#include <unordered_map>
 
 class EJCanvasContext;
+class EJFontCache;
 
 typedef struct
 {
-    uint32_t codepoint;
-    float kerning;
-} kerning_t;
+    bool loaded;
+    int width, height;
+    float left, top;
+    float advance;
+    EJGlyphAtlasSlot slot;
+} EJFontGlyph;
 
 typedef struct
 {
     uint32_t codepoint;
-    int width, height;
-    int offset_x, offset_y;
-    float advance_x, advance_y;
-    float s0, t0, s1, t1;
-    size_t kerning_count;
-    kerning_t kerning[1];
-} texture_glyph_t;
+    EJFontGlyph* glyph;
+    float x, y, w, h;	// quad relative to the pen at the start of the run, in canvas units
+} EJFontRunGlyph;
+
+// laid out string; only glyphs with pixels are part of glyphs
+typedef struct
+{
+    std::string text;
+    float width;
+    std::vector<EJFontRunGlyph> glyphs;
+} EJFontRun;
+
+// line of a layout; its glyphs are those from firstGlyph on in the layout, relative to the pen at the start of the line
+typedef struct
+{
+    size_t start, length;	// bytes of the text on the line, without the spaces it was wrapped at
+    float width;			// including the ellipsis
+    size_t firstGlyph, glyphCount;
+    bool ellipsis;
+} EJFontLine;
 
 typedef struct
 {
-    size_t tex_width;
-    size_t tex_height;
-    size_t tex_depth;
-    unsigned char tex_data[65536];
-    float size;
-    float height;
-    float linegap;
-    float ascender;
-    float descender;
-    size_t glyphs_count;
-    texture_glyph_t glyphs[96];
-} texture_font_t;
+    std::vector<EJFontLine> lines;
+    std::vector<EJFontRunGlyph> glyphs;
+    float width;		// of the widest line
+    bool truncated;		// text did not fit into the lines, and the last one ends in an ellipsis
+} EJFontLayout;
 
+/**
+ * A font at one pixel size; glyphs are rendered on first use and packed into the atlas of the font cache
+ * latin-1 glyphs are looked up in a table, all others in a hash map
+ * the layout of recently used strings is cached, so drawing or measuring them again does not touch the glyphs
+ * Distance field fonts do not render glyphs of their own: they scale those of the font of the same name that the
+ * cache renders once at kDistanceFieldSize pixels, as distance fields into an atlas of their own.
+ */
 class EJFont {
+public:
+	static const int kDistanceFieldSize = 32;	// pixel size distance fields are rendered at
+	static const int kDistanceFieldSpread = 4;	// pixels around the outline the field reaches, on both sides
 private:
-	texture_font_t* _font;
-	EJTexture* _texture;
+	EJFontCache* _cache;
+	EJFont* _base;			// font whose glyphs distance field fonts scale
+	bool _distanceField;	// glyphs are rendered as distance fields
+	void* _face;
+	EJFontMetrics _metrics;
 	float _scale;
-	bool _copy;
 	uint32_t* _utf32buffer;
 	int _utf32bufsize;
     bool _isFilled;
+
+    EJFontGlyph _latin1[256];
+    std::unordered_map<uint32_t, EJFontGlyph> _glyphs;
+
+    // strings that were drawn or measured recently, most recently used first
+    static const size_t kRunCacheSize = 256;
+    static const size_t kMaxRunLength = 128;	// longer strings are laid out on every call
+    std::list<EJFontRun> _runs;
+    std::unordered_map<std::string, std::list<EJFontRun>::iterator> _runIndex;
+    std::string _runKey;
+    EJFontRun _uncachedRun;
+
+    // code points of the text being laid out, with the pen before them and their offset in the text
+    struct LayoutChar {
+        uint32_t codepoint;
+        EJFontGlyph* glyph;
+        float pen;
+        size_t offset;
+    };
+    std::vector<LayoutChar> _layoutChars;
+    EJFontLayout _layout;
+
+	// returns null if the font has no glyph for the code point; glyphs are only added to the atlas when a context is passed
+	EJFontGlyph* glyph (uint32_t codepoint, EJCanvasContext* context);
+	bool loadGlyph (uint32_t codepoint, EJFontGlyph* glyph, EJCanvasContext* context);
+	const EJFontRun* run (const char* text, EJCanvasContext* context);
+	float alignedX (float x, float width, EJCanvasContext* context);
+	float baselineOffset (EJCanvasContext* context);
+	void drawGlyphs (const EJFontRunGlyph* glyphs, size_t count, EJCanvasContext* context, float x, float y);
+	EJGlyphAtlas* atlas();
+	void init (const char* font, float pxSize, bool fill, float scale, EJFontCache* cache);
 public:
-	EJFont (const char* font, int size, bool fill, float contentScale);
+	EJFont (const char* font, int size, bool fill, float contentScale, EJFontCache* cache);
+	// font of distance field glyphs at kDistanceFieldSize pixels
+	EJFont (const char* font, EJFontCache* cache);
+	// font of size that scales the glyphs of a distance field font
+	EJFont (EJFont* base, int size, bool fill);
 	void drawString (const char* text, EJCanvasContext* context, float x, float y);
-	float measureString (const char* string);
-	float measureStringFromBuffer (int length);
+	// measuring and layout add the glyphs to the atlas of context, so they are rendered once when they are drawn next
+	float measureString (const char* string, EJCanvasContext* context);
+	/**
+	 * breaks text into lines of at most maxWidth at spaces, after hyphens, around CJK characters and at newlines; words
+	 * wider than a line are broken anywhere. Text beyond maxLines is cut off with an ellipsis. A maxWidth or maxLines
+	 * of 0 does not limit. The layout is valid until the next call
+	 */
+	const EJFontLayout* layout (const char* text, float maxWidth, int maxLines, EJCanvasContext* context);
+	// draws the lines of a layout of this font lineHeight apart, each aligned to x on its own
+	void drawLayout (const EJFontLayout* layout, EJCanvasContext* context, float x, float y, float lineHeight);
+	float lineHeight() { return _metrics.height * _scale; }
+	/**
+	 * half of a stroke of lineWidth canvas units around the edge of the glyphs, in units of their distance field
+	 * 0 for bitmap fonts, which stroke text like they fill it
+	 */
+	float outlineWidth (float lineWidth);
 	~EJFont();
 };
 
+/**
+ * fonts of a canvas context, keyed by (name, size, fill, contentScale) or (name, size, fill) for distance fields
+ * the least recently used font is evicted once the limit is reached; the glyphs of all fonts share one atlas, and
+ * those of all distance field fonts another one. Both live as long as the cache and have to be destroyed on the gl thread,
+ * just like the fonts distance fields are rendered with, which are kept as long as the cache
+ */
+class EJFontCache {
+public:
+	EJFontCache (size_t countLimit);
+	~EJFontCache();
+
+	// distance field fonts scale to any size and transform, but are only drawn by contexts whose backend supports them
+	EJFont* get (const char* fontName, float pointSize, bool fill, float contentScale, bool distanceField = false);
+	// deletes all fonts, which are made again when they are drawn next; the glyph atlases keep their pages
+	void purge();
+
+	EJGlyphRasterizer* rasterizer() { return _rasterizer; }
+	EJGlyphAtlas* atlas() { return &_atlas; }
+	EJGlyphAtlas* distanceAtlas() { return &_distanceAtlas; }
+
+	// converts a glyph rendered into glyphBuffer() into a distance field with kDistanceFieldSpread texels of padding
+	const unsigned char* distanceField (const EJGlyphBitmap& bitmap);
+
+	// scratch memory glyphs are rendered into before they are copied to the atlas
+	static const size_t kGlyphBufferSize = 256 * 256;
+	unsigned char* glyphBuffer() { return _glyphBuffer; }
+private:
+	struct Entry {
+		std::string name;
+		float pointSize;
+		bool fill;
+		float contentScale;
+		bool distanceField;
+		EJFont* font;
+	};
+	std::list<Entry> _entries;		// most recently used first
+	size_t _countLimit;
+	EJGlyphRasterizer* _rasterizer;
+	EJGlyphAtlas _atlas;
+	EJGlyphAtlas _distanceAtlas;
+	std::unordered_map<std::string, EJFont*> _distanceFonts;
+	EJDistanceField _distanceField;
+	std::vector<unsigned char> _distanceBuffer;
+	unsigned char _glyphBuffer[kGlyphBufferSize];
+};
+
 #endif
@@ -0,0 +1,65 @@
+#include "EJFrameArena.h"
+
+EJFrameArena::EJFrameArena() {
+	_current = 0;
+	_allocated = 0;
+	_generation = 0;
+}
+
+EJFrameArena::~EJFrameArena() {
+	for( size_t i = 0; i < _blocks.size(); i++ ) {
+		free(_blocks[i].data);
+	}
+}
+
+void* EJFrameArena::allocate (size_t size) {
+	size = (size + EJ_FRAME_ARENA_ALIGNMENT - 1) & ~(size_t)(EJ_FRAME_ARENA_ALIGNMENT - 1);
+	if( _allocated + size > EJ_FRAME_ARENA_MAX_SIZE ) { return NULL; }
+
+	// the rest of a block that is too small for this allocation stays unused until the reset
+	while( _current < _blocks.size() && _blocks[_current].used + size > _blocks[_current].size ) {
+		_current++;
+	}
+	if( _current == _blocks.size() ) {
+		Block block;
+		block.size = EJ_FRAME_ARENA_BLOCK_SIZE;
+		while( block.size < size ) { block.size *= 2; }
+		block.data = (char*)malloc(block.size);
+		if( !block.data ) { return NULL; }
+		block.used = 0;
+		_blocks.push_back(block);
+	}
+
+	Block &block = _blocks[_current];
+	void *data = block.data + block.used;
+	block.used += size;
+	_allocated += size;
+	return data;
+}
+
+void EJFrameArena::reset() {
+	_generation++;
+
+	// a frame that needed several blocks gets one block that holds all of it, so the next one is contiguous
+	if( _blocks.size() > 1 ) {
+		size_t size = 0;
+		for( size_t i = 0; i < _blocks.size(); i++ ) {
+			size += _blocks[i].size;
+			free(_blocks[i].data);
+		}
+		_blocks.clear();
+
+		Block block;
+		block.size = EJ_FRAME_ARENA_BLOCK_SIZE;
+		while( block.size < size && block.size < EJ_FRAME_ARENA_MAX_SIZE ) { block.size *= 2; }
+		block.data = (char*)malloc(block.size);
+		if( block.data ) {
+			_blocks.push_back(block);
+		}
+	}
+	for( size_t i = 0; i < _blocks.size(); i++ ) {
+		_blocks[i].used = 0;
+	}
+	_current = 0;
+	_allocated = 0;
+}
@@ -0,0 +1,161 @@
+#ifndef __EJFRAMEARENA_H
+#define __EJFRAMEARENA_H	1
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+// the first block of an arena, and the most it hands out between two resets; beyond that allocate returns NULL
+#define EJ_FRAME_ARENA_BLOCK_SIZE (64 * 1024)
+#define EJ_FRAME_ARENA_MAX_SIZE (4 * 1024 * 1024)
+#define EJ_FRAME_ARENA_ALIGNMENT 16
+
+/**
+ * Bump allocator for memory that is only needed until the next frame, like the points of the current path
+ * Allocations move a pointer through a block; reset rewinds it, so a frame that needs as much memory as the last one
+ * does not call malloc at all. Frames that needed more than one block get a single one of their size with the reset.
+ */
+class EJFrameArena {
+public:
+	EJFrameArena();
+	~EJFrameArena();
+
+	// size bytes, aligned for any type; NULL once the arena handed out EJ_FRAME_ARENA_MAX_SIZE bytes since the reset
+	void* allocate (size_t size);
+	template<typename T> T* allocate (size_t count) { return (T*)allocate(count * sizeof(T)); }
+	// everything allocated so far becomes invalid
+	void reset();
+	// counts the resets, so memory can tell if it is still valid
+	unsigned int generation() const { return _generation; }
+private:
+	struct Block {
+		char *data;
+		size_t size, used;
+	};
+
+	EJFrameArena (const EJFrameArena&);
+	EJFrameArena& operator= (const EJFrameArena&);
+
+	std::vector<Block> _blocks;
+	size_t _current;		// block allocations are taken from
+	size_t _allocated;		// bytes handed out since the reset
+	unsigned int _generation;
+};
+
+/**
+ * A vector of plain data whose items live in a frame arena as long as there is one, and on the heap otherwise
+ * Items are moved and copied with memcpy and are not initialized. Growing within the arena leaves the old items
+ * behind until the reset; clear keeps the items where they are if they are still valid, so a vector that is cleared
+ * and filled again during a frame only ever grows. Vectors that keep their items past the next reset of the arena
+ * have to call leaveArena before it; a heap buffer they got that way is kept for the next time.
+ */
+template<typename T> class EJArenaVector {
+public:
+	EJArenaVector (EJFrameArena *arena = NULL) : _items(NULL), _size(0), _capacity(0), _heap(NULL), _heapCapacity(0),
+		_arena(arena), _inArena(false), _generation(0) {}
+	~EJArenaVector() { free(_heap); }
+
+	size_t size() const { return _size; }
+	bool empty() const { return _size == 0; }
+	T* data() { return _items; }
+	const T* data() const { return _items; }
+	T& operator[] (size_t i) { return _items[i]; }
+	const T& operator[] (size_t i) const { return _items[i]; }
+	T& back() { return _items[_size - 1]; }
+	const T& back() const { return _items[_size - 1]; }
+
+	void push_back (const T &item) {
+		if( _size == _capacity ) { grow(_size + 1); }
+		_items[_size++] = item;
+	}
+	// items added this way are not initialized
+	void resize (size_t size) {
+		if( size > _capacity ) { grow(size); }
+		_size = size;
+	}
+	void pop_back() { _size--; }
+
+	void clear() {
+		_size = 0;
+		// items on the heap or from an earlier frame go back to the arena with the next push
+		if( _arena && (!_inArena || !valid()) ) {
+			_items = NULL;
+			_capacity = 0;
+			_inArena = false;
+		}
+	}
+
+	void leaveArena() {
+		if( !_inArena ) { return; }
+		_inArena = false;
+		if( !valid() || !_size ) {
+			_items = NULL;
+			_capacity = _size = 0;
+			return;
+		}
+		T *items = _items;
+		_items = NULL;
+		_capacity = 0;
+		moveToHeap(items, _size);
+	}
+
+private:
+	EJArenaVector (const EJArenaVector&);
+	EJArenaVector& operator= (const EJArenaVector&);
+
+	bool valid() const { return !_inArena || _arena->generation() == _generation; }
+
+	void grow (size_t minCapacity) {
+		if( !valid() ) {
+			// only vectors that were cleared can be left in an arena that was reset
+			_items = NULL;
+			_capacity = _size = 0;
+			_inArena = false;
+		}
+		size_t capacity = _capacity ? _capacity * 2 : 16;
+		if( capacity < minCapacity ) { capacity = minCapacity; }
+
+		T *items = _arena ? _arena->allocate<T>(capacity) : NULL;
+		if( items ) {
+			if( _size ) { memcpy(items, _items, _size * sizeof(T)); }
+			_items = items;
+			_capacity = capacity;
+			_inArena = true;
+			_generation = _arena->generation();
+			return;
+		}
+
+		// without an arena, or once it is full
+		if( _inArena ) {
+			items = _items;
+			_items = NULL;
+			_inArena = false;
+		} else {
+			items = NULL;
+		}
+		_capacity = 0;
+		moveToHeap(items, capacity);
+	}
+
+	// makes the heap buffer the items, with room for capacity of them; arenaItems are copied into it
+	void moveToHeap (const T *arenaItems, size_t capacity) {
+		if( _heapCapacity < capacity ) {
+			_heap = (T*)realloc(_heap, capacity * sizeof(T));
+			_heapCapacity = capacity;
+		}
+		if( arenaItems && _size ) { memcpy(_heap, arenaItems, _size * sizeof(T)); }
+		_items = _heap;
+		_capacity = _heapCapacity;
+	}
+
+	T *_items;
+	size_t _size, _capacity;
+	T *_heap;				// also kept while the items are in the arena
+	size_t _heapCapacity;
+	EJFrameArena *_arena;
+	bool _inArena;
+	unsigned int _generation;	// of the arena when the items were allocated from it
+};
+
+#endif
@@ -0,0 +1,15 @@
+#include "EJGLBackend.h"
+#include "EJGLBackendES1.h"
+#include "EJGLBackendES2.h"
+#include "GLcompat.h"
+
+#include <string.h>
+
+EJGLBackend* EJGLBackend::create() {
+	// GLES1 contexts report "OpenGL ES-CM 1.x" or "OpenGL ES-CL 1.x", later versions "OpenGL ES 2.0" and up
+	const char* version = (const char*)glGetString(GL_VERSION);
+	if (!version || strncmp(version, "OpenGL ES-C", 11) == 0) {
+		return new EJGLBackendES1();
+	}
+	return new EJGLBackendES2();
+}
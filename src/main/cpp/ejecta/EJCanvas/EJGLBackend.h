@@ -0,0 +1,77 @@
+#ifndef __EJGLBACKEND_H
+#define __EJGLBACKEND_H	1
+
+#include "EJCanvasTypes.h"
+
+typedef enum {
+	kEJGLFillSolid,		// vertex color only
+	kEJGLFillTexture,	// vertex color modulated with an rgba texture
+	kEJGLFillAlpha,		// vertex color with the alpha of an alpha texture, used for glyphs
+	kEJGLFillDistance,	// vertex color with the coverage of a distance field in a luminance texture, used for glyphs
+	kEJGLFillOutline,	// like kEJGLFillDistance, but covering a band around the edge, used for stroked glyphs
+	kEJGLFillExternal,	// vertex color modulated with a GL_TEXTURE_EXTERNAL_OES texture, GLES2 only
+	kEJGLFillCount
+} EJGLFillKind;
+
+// texels on each side of the center that drawBlur samples at most
+#define EJ_GL_BLUR_TAPS 9
+
+/**
+ * The parts of drawing a canvas that differ between the fixed function pipeline of GLES1 and the shaders of GLES2
+ * everything else (blending, stencil, textures and buffer objects) is called directly by the context,
+ * since both versions share those calls
+ */
+class EJGLBackend {
+public:
+	virtual ~EJGLBackend() {}
+
+	// enables the vertex attributes read by drawTriangles
+	virtual void enableVertexArrays() = 0;
+
+	// orthographic projection of width x height canvas units; flipped moves the origin to the top left corner
+	virtual void setProjection (short width, short height, bool flipped) = 0;
+
+	// selects how the vertices of following draw calls are colored; the texture itself is bound by the caller
+	virtual void setFill (EJGLFillKind fill) = 0;
+	// true if kEJGLFillDistance can be drawn; the fixed function pipeline can not threshold a distance field smoothly
+	virtual bool supportsDistanceFields() = 0;
+	// half the width of the band kEJGLFillOutline covers, in units of the field; called right after setFill(kEJGLFillOutline)
+	virtual void setOutlineWidth (float width) = 0;
+	// true if kEJGLFillExternal can be drawn, which needs GL_OES_EGL_image_external
+	virtual bool supportsExternalTextures() = 0;
+	// maps the uvs of the vertices to those of the external texture; called right after setFill(kEJGLFillExternal)
+	virtual void setExternalTransform (const CGAffineTransform &transform) = 0;
+
+	// true if drawBlur works; contexts draw no shadows where it does not, since the fixed function pipeline can not blur
+	virtual bool supportsBlur() = 0;
+
+	// draws count EJVertex triangles, starting at vertex first of the array buffer that is currently bound
+	virtual void drawTriangles (int first, int count) = 0;
+
+	// draws a triangle fan of positions from client memory, for stencil masks
+	virtual void drawFan (const EJVector2* vertices, int count) = 0;
+	// draws count / 3 triangles of positions from client memory, for clip masks
+	virtual void drawMaskTriangles (const EJVector2* vertices, int count) = 0;
+
+	/*
+	 * draws the texture that is bound over the whole viewport, convolved along one axis with a symmetric kernel:
+	 * weights[0] for the center and weights[i] for the texels i steps of dx, dy away on either side, up to taps
+	 * u and v are the texture coordinates of the far corner of the viewport. Positions come from client memory
+	 */
+	virtual void drawBlur (float dx, float dy, const float *weights, int taps, float u, float v) = 0;
+
+	// forgets the gl state the backend keeps track of, after another context drew with the same gl context
+	virtual void resetState() = 0;
+
+	// framebuffer objects are core in GLES2 and an extension in GLES1
+	// creates a framebuffer that draws into texture, with a stencil buffer of the same size; returns 0 if it is incomplete
+	// with samples > 1 it is multisampled where the gl supports it, and resolved into the texture when that is read
+	virtual unsigned int createFramebuffer (unsigned int texture, int width, int height, int samples, unsigned int *stencilBuffer) = 0;
+	virtual void bindFramebuffer (unsigned int framebuffer) = 0;
+	virtual void deleteFramebuffer (unsigned int framebuffer, unsigned int stencilBuffer) = 0;
+
+	// chooses the backend for the version of the gl context that is current on the calling thread
+	static EJGLBackend* create();
+};
+
+#endif
@@ -0,0 +1,135 @@
+#include "EJGLBackendES1.h"
+#include "GLcompat.h"
+#include "EJGLState.h"
+
+#include <stddef.h>
+#include <string.h>
+
+enum {
+	kArrayVertex = 1 << 0,
+	kArrayTexCoord = 1 << 1,
+	kArrayColor = 1 << 2,
+	kArrayAll = kArrayVertex | kArrayTexCoord | kArrayColor
+};
+
+EJGLBackendES1::EJGLBackendES1() {
+	_arrays = -1;
+	EJGLState::disable(GL_LIGHTING);
+}
+
+void EJGLBackendES1::enableVertexArrays() {
+	// the pointers into the buffer object are set up by drawTriangles
+	setArrays(kArrayAll);
+}
+
+void EJGLBackendES1::setArrays (int arrays) {
+	static const GLenum states[] = { GL_VERTEX_ARRAY, GL_TEXTURE_COORD_ARRAY, GL_COLOR_ARRAY };
+	if (_arrays == arrays) {
+		return;
+	}
+	for (int i = 0; i < 3; i++) {
+		const int bit = 1 << i;
+		if (_arrays >= 0 && (_arrays & bit) == (arrays & bit)) {
+			continue;
+		}
+		if (arrays & bit) {
+			glEnableClientState(states[i]);
+		} else {
+			glDisableClientState(states[i]);
+		}
+	}
+	_arrays = arrays;
+}
+
+void EJGLBackendES1::setProjection (short width, short height, bool flipped) {
+	glMatrixMode(GL_PROJECTION);
+	glLoadIdentity();
+	glOrthof(0, width, 0, height, -1, 1);
+
+	glMatrixMode(GL_MODELVIEW);
+	glLoadIdentity();
+
+	if (flipped) {
+		glTranslatef(0, height, 0);
+		glScalef( 1, -1, 1 );
+	}
+}
+
+void EJGLBackendES1::setFill (EJGLFillKind fill) {
+	// GL_MODULATE takes only the alpha of alpha textures, so both kinds of textures are drawn the same way
+	if (fill == kEJGLFillSolid) {
+		EJGLState::disable(GL_TEXTURE_2D);
+	} else {
+		EJGLState::enable(GL_TEXTURE_2D);
+	}
+}
+
+void EJGLBackendES1::drawTriangles (int first, int count) {
+	setArrays(kArrayAll);
+	glVertexPointer(2, GL_FLOAT, sizeof(EJVertex), (GLvoid*)offsetof(EJVertex, pos));
+	glTexCoordPointer(2, GL_FLOAT, sizeof(EJVertex), (GLvoid*)offsetof(EJVertex, uv));
+	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(EJVertex), (GLvoid*)offsetof(EJVertex, color));
+	glDrawArrays(GL_TRIANGLES, first, count);
+}
+
+void EJGLBackendES1::drawFan (const EJVector2* vertices, int count) {
+	drawMask(vertices, count, GL_TRIANGLE_FAN);
+}
+
+void EJGLBackendES1::drawMaskTriangles (const EJVector2* vertices, int count) {
+	drawMask(vertices, count, GL_TRIANGLES);
+}
+
+void EJGLBackendES1::drawMask (const EJVector2* vertices, int count, unsigned int mode) {
+	// the arrays stay like this until the next drawTriangles, so the fans of a path do not switch them back and forth
+	setArrays(kArrayVertex);
+
+	glVertexPointer(2, GL_FLOAT, sizeof(EJVector2), vertices);
+	glDrawArrays(mode, 0, count);
+}
+
+void EJGLBackendES1::resetState() {
+	// the rest of the fixed function state is set completely by every call
+	_arrays = -1;
+}
+
+unsigned int EJGLBackendES1::createFramebuffer (unsigned int texture, int width, int height, int samples, unsigned int *stencilBuffer) {
+	// rendering to multisampled textures is only defined for GLES2, so samples are ignored
+	const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+	if( !extensions || !strstr(extensions, "GL_OES_framebuffer_object") ) {
+		*stencilBuffer = 0;
+		return 0;
+	}
+	// stencil only buffers are an extension of their own; packed depth and stencil is more common
+	const bool packed = strstr(extensions, "GL_OES_packed_depth_stencil") != NULL;
+
+	GLuint framebuffer = 0, stencil = 0;
+	glGenFramebuffersOES(1, &framebuffer);
+	glBindFramebufferOES(GL_FRAMEBUFFER_OES, framebuffer);
+	glFramebufferTexture2DOES(GL_FRAMEBUFFER_OES, GL_COLOR_ATTACHMENT0_OES, GL_TEXTURE_2D, texture, 0);
+
+	glGenRenderbuffersOES(1, &stencil);
+	glBindRenderbufferOES(GL_RENDERBUFFER_OES, stencil);
+	glRenderbufferStorageOES(GL_RENDERBUFFER_OES, packed ? GL_DEPTH24_STENCIL8_OES : GL_STENCIL_INDEX8_OES, width, height);
+	glFramebufferRenderbufferOES(GL_FRAMEBUFFER_OES, GL_STENCIL_ATTACHMENT_OES, GL_RENDERBUFFER_OES, stencil);
+	if( packed ) {
+		glFramebufferRenderbufferOES(GL_FRAMEBUFFER_OES, GL_DEPTH_ATTACHMENT_OES, GL_RENDERBUFFER_OES, stencil);
+	}
+
+	*stencilBuffer = stencil;
+	if( glCheckFramebufferStatusOES(GL_FRAMEBUFFER_OES) != GL_FRAMEBUFFER_COMPLETE_OES ) {
+		deleteFramebuffer(framebuffer, stencil);
+		*stencilBuffer = 0;
+		return 0;
+	}
+	return framebuffer;
+}
+
+void EJGLBackendES1::bindFramebuffer (unsigned int framebuffer) {
+	glBindFramebufferOES(GL_FRAMEBUFFER_OES, framebuffer);
+}
+
+void EJGLBackendES1::deleteFramebuffer (unsigned int framebuffer, unsigned int stencilBuffer) {
+	if( framebuffer ) { glDeleteFramebuffersOES(1, &framebuffer); }
+	if( stencilBuffer ) { glDeleteRenderbuffersOES(1, &stencilBuffer); }
+}
@@ -0,0 +1,36 @@
+#ifndef __EJGLBACKENDES1_H
+#define __EJGLBACKENDES1_H	1
+
+#include "EJGLBackend.h"
+
+/**
+ * Fixed function pipeline of GLES1: the projection lives in the matrix stack and vertices are read from client state arrays
+ */
+class EJGLBackendES1 : public EJGLBackend {
+public:
+	EJGLBackendES1();
+
+	void enableVertexArrays();
+	void setProjection (short width, short height, bool flipped);
+	void setFill (EJGLFillKind fill);
+	bool supportsDistanceFields() { return false; }
+	void setOutlineWidth (float width) {}
+	bool supportsExternalTextures() { return false; }
+	void setExternalTransform (const CGAffineTransform &transform) {}
+	bool supportsBlur() { return false; }
+	void drawTriangles (int first, int count);
+	void drawFan (const EJVector2* vertices, int count);
+	void drawMaskTriangles (const EJVector2* vertices, int count);
+	void drawBlur (float dx, float dy, const float *weights, int taps, float u, float v) {}
+	void resetState();
+	unsigned int createFramebuffer (unsigned int texture, int width, int height, int samples, unsigned int *stencilBuffer);
+	void bindFramebuffer (unsigned int framebuffer);
+	void deleteFramebuffer (unsigned int framebuffer, unsigned int stencilBuffer);
+private:
+	void drawMask (const EJVector2* vertices, int count, unsigned int mode);
+	void setArrays (int arrays);
+
+	int _arrays;	// bits of the enabled client state arrays, -1 if not known
+};
+
+#endif
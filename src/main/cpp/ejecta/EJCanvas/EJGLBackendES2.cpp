@@ -0,0 +1,460 @@
+#include "EJGLBackendES2.h"
+
+#include "NdkMisc.h"
+#define LOG_TAG "EJGLBackendES2"
+
+#include <GLES2/gl2.h>
+#include <EGL/egl.h>
+#include <stddef.h>
+#include <string.h>
+#include <algorithm>
+
+// EXT_multisampled_render_to_texture; the samples live in tile memory and are resolved into the texture on the way out
+#define EJ_GL_MAX_SAMPLES_EXT	0x8D57
+
+typedef void (GL_APIENTRY *EJRenderbufferStorageMultisampleProc) (GLenum target, GLsizei samples, GLenum format, GLsizei width, GLsizei height);
+typedef void (GL_APIENTRY *EJFramebufferTexture2DMultisampleProc) (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLsizei samples);
+
+static EJRenderbufferStorageMultisampleProc ejRenderbufferStorageMultisample = NULL;
+static EJFramebufferTexture2DMultisampleProc ejFramebufferTexture2DMultisample = NULL;
+
+enum {
+	kAttribPosition,
+	kAttribUV,
+	kAttribColor
+};
+
+static const int kAttribAll = (1 << kAttribPosition) | (1 << kAttribUV) | (1 << kAttribColor);
+
+static const char* const EJVertexShader =
+	"uniform vec4 projection;\n"
+	"attribute vec2 position;\n"
+	"attribute vec2 uv;\n"
+	"attribute vec4 color;\n"
+	"varying vec2 v_uv;\n"
+	"varying vec4 v_color;\n"
+	"void main() {\n"
+	"	v_uv = uv;\n"
+	"	v_color = color;\n"
+	"	gl_Position = vec4(position * projection.xy + projection.zw, 0.0, 1.0);\n"
+	"}\n";
+
+static const char* const EJFragmentShaders[kEJGLFillCount] = {
+	// kEJGLFillSolid
+	"precision mediump float;\n"
+	"varying vec4 v_color;\n"
+	"void main() {\n"
+	"	gl_FragColor = v_color;\n"
+	"}\n",
+
+	// kEJGLFillTexture
+	"precision mediump float;\n"
+	"uniform sampler2D sampler;\n"
+	"varying vec2 v_uv;\n"
+	"varying vec4 v_color;\n"
+	"void main() {\n"
+	"	gl_FragColor = v_color * texture2D(sampler, v_uv);\n"
+	"}\n",
+
+	// kEJGLFillAlpha
+	"precision mediump float;\n"
+	"uniform sampler2D sampler;\n"
+	"varying vec2 v_uv;\n"
+	"varying vec4 v_color;\n"
+	"void main() {\n"
+	"	gl_FragColor = vec4(v_color.rgb, v_color.a * texture2D(sampler, v_uv).a);\n"
+	"}\n",
+
+	// kEJGLFillDistance; the edge is smoothed over about a pixel at any scale where derivatives are available
+	"#ifdef GL_OES_standard_derivatives\n"
+	"#extension GL_OES_standard_derivatives : enable\n"
+	"#endif\n"
+	"precision mediump float;\n"
+	"uniform sampler2D sampler;\n"
+	"varying vec2 v_uv;\n"
+	"varying vec4 v_color;\n"
+	"void main() {\n"
+	"	float distance = texture2D(sampler, v_uv).r;\n"
+	"#ifdef GL_OES_standard_derivatives\n"
+	"	float width = 0.75 * fwidth(distance);\n"
+	"#else\n"
+	"	float width = 0.08;\n"
+	"#endif\n"
+	"	gl_FragColor = vec4(v_color.rgb, v_color.a * smoothstep(0.5 - width, 0.5 + width, distance));\n"
+	"}\n",
+
+	// kEJGLFillOutline; the band is centered on the edge at 0.5, smoothed like kEJGLFillDistance
+	"#ifdef GL_OES_standard_derivatives\n"
+	"#extension GL_OES_standard_derivatives : enable\n"
+	"#endif\n"
+	"precision mediump float;\n"
+	"uniform sampler2D sampler;\n"
+	"uniform float outlineWidth;\n"
+	"varying vec2 v_uv;\n"
+	"varying vec4 v_color;\n"
+	"void main() {\n"
+	"	float distance = abs(texture2D(sampler, v_uv).r - 0.5);\n"
+	"#ifdef GL_OES_standard_derivatives\n"
+	"	float width = 0.75 * fwidth(distance);\n"
+	"#else\n"
+	"	float width = 0.08;\n"
+	"#endif\n"
+	"	gl_FragColor = vec4(v_color.rgb, v_color.a * (1.0 - smoothstep(outlineWidth - width, outlineWidth + width, distance)));\n"
+	"}\n",
+
+	// kEJGLFillExternal; frames of SurfaceTextures come with a transform of their own
+	"#extension GL_OES_EGL_image_external : require\n"
+	"precision mediump float;\n"
+	"uniform samplerExternalOES sampler;\n"
+	"uniform mat3 uvTransform;\n"
+	"varying vec2 v_uv;\n"
+	"varying vec4 v_color;\n"
+	"void main() {\n"
+	"	gl_FragColor = v_color * texture2D(sampler, (uvTransform * vec3(v_uv, 1.0)).xy);\n"
+	"}\n"
+};
+
+// separable gaussian of shadows; unused taps have a weight of 0
+static const char* const EJBlurVertexShader =
+	"attribute vec2 position;\n"
+	"attribute vec2 uv;\n"
+	"varying vec2 v_uv;\n"
+	"void main() {\n"
+	"	v_uv = uv;\n"
+	"	gl_Position = vec4(position, 0.0, 1.0);\n"
+	"}\n";
+
+#define EJ_GL_STRINGIFY(x) #x
+#define EJ_GL_TOSTRING(x) EJ_GL_STRINGIFY(x)
+
+static const char* const EJBlurFragmentShader =
+	"precision mediump float;\n"
+	"uniform sampler2D sampler;\n"
+	"uniform vec2 step;\n"
+	"uniform float weights[" EJ_GL_TOSTRING(EJ_GL_BLUR_TAPS) " + 1];\n"
+	"varying vec2 v_uv;\n"
+	"void main() {\n"
+	"	vec4 sum = texture2D(sampler, v_uv) * weights[0];\n"
+	"	for (int i = 1; i <= " EJ_GL_TOSTRING(EJ_GL_BLUR_TAPS) "; i++) {\n"
+	"		vec2 offset = step * float(i);\n"
+	"		sum += (texture2D(sampler, v_uv - offset) + texture2D(sampler, v_uv + offset)) * weights[i];\n"
+	"	}\n"
+	"	gl_FragColor = sum;\n"
+	"}\n";
+
+static GLuint compileShader (GLenum type, const char* source) {
+	GLuint shader = glCreateShader(type);
+	glShaderSource(shader, 1, &source, NULL);
+	glCompileShader(shader);
+
+	GLint status = 0;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+	if (!status) {
+		char log[512];
+		glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+		LOGE("Cannot compile shader: %s", log);
+		glDeleteShader(shader);
+		return 0;
+	}
+	return shader;
+}
+
+EJGLBackendES2::EJGLBackendES2() {
+	memset(_programs, 0, sizeof(_programs));
+	_current = -1;
+	_arrays = -1;
+	_projection[0] = _projection[1] = 1;
+	_projection[2] = _projection[3] = 0;
+	_projectionVersion = 1;
+	_blurProgram = 0;
+	_blurStep = _blurWeights = -1;
+	_externalTextures = -1;
+}
+
+EJGLBackendES2::~EJGLBackendES2() {
+	for (int i = 0; i < kEJGLFillCount; i++) {
+		if (_programs[i].program) {
+			glDeleteProgram(_programs[i].program);
+		}
+	}
+	if (_blurProgram) {
+		glDeleteProgram(_blurProgram);
+	}
+}
+
+// linked program of both shaders with the attributes of EJVertex bound, or 0
+static GLuint linkProgram (const char* vertexSource, const char* fragmentSource) {
+	GLuint vertex = compileShader(GL_VERTEX_SHADER, vertexSource);
+	GLuint fragment = compileShader(GL_FRAGMENT_SHADER, fragmentSource);
+	if (!vertex || !fragment) {
+		if (vertex) { glDeleteShader(vertex); }
+		if (fragment) { glDeleteShader(fragment); }
+		return 0;
+	}
+
+	GLuint program = glCreateProgram();
+	glAttachShader(program, vertex);
+	glAttachShader(program, fragment);
+	glBindAttribLocation(program, kAttribPosition, "position");
+	glBindAttribLocation(program, kAttribUV, "uv");
+	glBindAttribLocation(program, kAttribColor, "color");
+	glLinkProgram(program);
+
+	// the program keeps the shaders alive as long as they are attached
+	glDeleteShader(vertex);
+	glDeleteShader(fragment);
+
+	GLint status = 0;
+	glGetProgramiv(program, GL_LINK_STATUS, &status);
+	if (!status) {
+		char log[512];
+		glGetProgramInfoLog(program, sizeof(log), NULL, log);
+		LOGE("Cannot link program: %s", log);
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
+
+bool EJGLBackendES2::compile (EJGLFillKind fill) {
+	GLuint program = linkProgram(EJVertexShader, EJFragmentShaders[fill]);
+	if (!program) {
+		return false;
+	}
+
+	Program& entry = _programs[fill];
+	entry.program = program;
+	entry.projection = glGetUniformLocation(program, "projection");
+	entry.projectionVersion = 0;
+	entry.uvTransform = glGetUniformLocation(program, "uvTransform");
+	entry.outlineWidth = glGetUniformLocation(program, "outlineWidth");
+
+	glUseProgram(program);
+	glUniform1i(glGetUniformLocation(program, "sampler"), 0);
+	return true;
+}
+
+void EJGLBackendES2::useProgram (EJGLFillKind fill) {
+	Program& entry = _programs[fill];
+	if (!entry.program && !compile(fill)) {
+		return;
+	}
+
+	if (_current != fill) {
+		glUseProgram(entry.program);
+		_current = fill;
+	}
+	if (entry.projectionVersion != _projectionVersion) {
+		glUniform4fv(entry.projection, 1, _projection);
+		entry.projectionVersion = _projectionVersion;
+	}
+}
+
+void EJGLBackendES2::enableVertexArrays() {
+	setArrays(kAttribAll);
+}
+
+void EJGLBackendES2::setArrays (int arrays) {
+	if (_arrays == arrays) {
+		return;
+	}
+	for (int attrib = kAttribPosition; attrib <= kAttribColor; attrib++) {
+		const int bit = 1 << attrib;
+		if (_arrays >= 0 && (_arrays & bit) == (arrays & bit)) {
+			continue;
+		}
+		if (arrays & bit) {
+			glEnableVertexAttribArray(attrib);
+		} else {
+			glDisableVertexAttribArray(attrib);
+		}
+	}
+	_arrays = arrays;
+}
+
+void EJGLBackendES2::setProjection (short width, short height, bool flipped) {
+	// maps 0..width and 0..height to -1..1; flipped puts y = 0 at the top
+	_projection[0] = 2.0f / width;
+	_projection[1] = (flipped ? -2.0f : 2.0f) / height;
+	_projection[2] = -1;
+	_projection[3] = flipped ? 1 : -1;
+	_projectionVersion++;
+
+	if (_current >= 0) {
+		useProgram((EJGLFillKind)_current);
+	}
+}
+
+void EJGLBackendES2::setFill (EJGLFillKind fill) {
+	useProgram(fill);
+}
+
+bool EJGLBackendES2::supportsExternalTextures() {
+	if (_externalTextures < 0) {
+		const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+		_externalTextures = extensions && strstr(extensions, "GL_OES_EGL_image_external") ? 1 : 0;
+	}
+	return _externalTextures == 1;
+}
+
+void EJGLBackendES2::setExternalTransform (const CGAffineTransform &transform) {
+	useProgram(kEJGLFillExternal);
+	const Program& entry = _programs[kEJGLFillExternal];
+	if (!entry.program) {
+		return;
+	}
+	// column major, like every matrix of gl
+	const GLfloat matrix[9] = {
+		transform.a, transform.b, 0,
+		transform.c, transform.d, 0,
+		transform.tx, transform.ty, 1
+	};
+	glUniformMatrix3fv(entry.uvTransform, 1, GL_FALSE, matrix);
+}
+
+void EJGLBackendES2::setOutlineWidth (float width) {
+	useProgram(kEJGLFillOutline);
+	const Program& entry = _programs[kEJGLFillOutline];
+	if (!entry.program) {
+		return;
+	}
+	glUniform1f(entry.outlineWidth, width);
+}
+
+void EJGLBackendES2::drawTriangles (int first, int count) {
+	setArrays(kAttribAll);
+	glVertexAttribPointer(kAttribPosition, 2, GL_FLOAT, GL_FALSE, sizeof(EJVertex), (GLvoid*)offsetof(EJVertex, pos));
+	glVertexAttribPointer(kAttribUV, 2, GL_FLOAT, GL_FALSE, sizeof(EJVertex), (GLvoid*)offsetof(EJVertex, uv));
+	glVertexAttribPointer(kAttribColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(EJVertex), (GLvoid*)offsetof(EJVertex, color));
+	glDrawArrays(GL_TRIANGLES, first, count);
+}
+
+void EJGLBackendES2::drawFan (const EJVector2* vertices, int count) {
+	drawMask(vertices, count, GL_TRIANGLE_FAN);
+}
+
+void EJGLBackendES2::drawMaskTriangles (const EJVector2* vertices, int count) {
+	drawMask(vertices, count, GL_TRIANGLES);
+}
+
+void EJGLBackendES2::drawMask (const EJVector2* vertices, int count, unsigned int mode) {
+	// only the stencil is written, so the solid program with a constant color will do
+	const int previous = _current;
+	useProgram(kEJGLFillSolid);
+	// the arrays stay like this until the next drawTriangles, so the fans of a path do not switch them back and forth
+	setArrays(1 << kAttribPosition);
+	glVertexAttrib4f(kAttribColor, 1, 1, 1, 1);
+
+	glVertexAttribPointer(kAttribPosition, 2, GL_FLOAT, GL_FALSE, sizeof(EJVector2), vertices);
+	glDrawArrays(mode, 0, count);
+
+	if (previous >= 0) {
+		useProgram((EJGLFillKind)previous);
+	}
+}
+
+void EJGLBackendES2::drawBlur (float dx, float dy, const float *weights, int taps, float u, float v) {
+	if (!_blurProgram) {
+		_blurProgram = linkProgram(EJBlurVertexShader, EJBlurFragmentShader);
+		if (!_blurProgram) {
+			return;
+		}
+		_blurStep = glGetUniformLocation(_blurProgram, "step");
+		_blurWeights = glGetUniformLocation(_blurProgram, "weights");
+		glUseProgram(_blurProgram);
+		glUniform1i(glGetUniformLocation(_blurProgram, "sampler"), 0);
+	}
+
+	GLfloat kernel[EJ_GL_BLUR_TAPS + 1] = { 0 };
+	memcpy(kernel, weights, (std::min(taps, EJ_GL_BLUR_TAPS) + 1) * sizeof(GLfloat));
+
+	const int previous = _current;
+	glUseProgram(_blurProgram);
+	_current = -1;
+	glUniform2f(_blurStep, dx, dy);
+	glUniform1fv(_blurWeights, EJ_GL_BLUR_TAPS + 1, kernel);
+
+	const GLfloat positions[8] = { -1, -1, 1, -1, -1, 1, 1, 1 };
+	const GLfloat uvs[8] = { 0, 0, u, 0, 0, v, u, v };
+	setArrays((1 << kAttribPosition) | (1 << kAttribUV));
+	glVertexAttribPointer(kAttribPosition, 2, GL_FLOAT, GL_FALSE, 0, positions);
+	glVertexAttribPointer(kAttribUV, 2, GL_FLOAT, GL_FALSE, 0, uvs);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+	if (previous >= 0) {
+		useProgram((EJGLFillKind)previous);
+	}
+}
+
+void EJGLBackendES2::resetState() {
+	// another backend may have changed the program in use; projections are per program and stay valid
+	_current = -1;
+	_arrays = -1;
+}
+
+unsigned int EJGLBackendES2::createFramebuffer (unsigned int texture, int width, int height, int samples, unsigned int *stencilBuffer) {
+	// GL_STENCIL_INDEX8 is core, but some drivers only attach stencil together with depth
+	const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+	const bool packed = extensions && strstr(extensions, "GL_OES_packed_depth_stencil");
+	const GLenum stencilFormat = packed ? 0x88F0 /* GL_DEPTH24_STENCIL8_OES */ : GL_STENCIL_INDEX8;
+
+	if (samples > 1) {
+		static bool resolved = false;
+		if (!resolved) {
+			if (extensions && strstr(extensions, "GL_EXT_multisampled_render_to_texture")) {
+				ejRenderbufferStorageMultisample = (EJRenderbufferStorageMultisampleProc)eglGetProcAddress("glRenderbufferStorageMultisampleEXT");
+				ejFramebufferTexture2DMultisample = (EJFramebufferTexture2DMultisampleProc)eglGetProcAddress("glFramebufferTexture2DMultisampleEXT");
+			}
+			resolved = true;
+		}
+		if (!ejRenderbufferStorageMultisample || !ejFramebufferTexture2DMultisample) {
+			samples = 0;
+		} else {
+			GLint maxSamples = 0;
+			glGetIntegerv(EJ_GL_MAX_SAMPLES_EXT, &maxSamples);
+			if (samples > maxSamples) {
+				samples = maxSamples;
+			}
+		}
+	}
+	const bool multisampled = samples > 1;
+
+	GLuint framebuffer = 0, stencil = 0;
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	if (multisampled) {
+		ejFramebufferTexture2DMultisample(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0, samples);
+	} else {
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+	}
+
+	glGenRenderbuffers(1, &stencil);
+	glBindRenderbuffer(GL_RENDERBUFFER, stencil);
+	if (multisampled) {
+		ejRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, stencilFormat, width, height);
+	} else {
+		glRenderbufferStorage(GL_RENDERBUFFER, stencilFormat, width, height);
+	}
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, stencil);
+	if (packed) {
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, stencil);
+	}
+
+	*stencilBuffer = stencil;
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+		deleteFramebuffer(framebuffer, stencil);
+		*stencilBuffer = 0;
+		// drivers may not multisample every format; a plain framebuffer is better than none
+		return multisampled ? createFramebuffer(texture, width, height, 0, stencilBuffer) : 0;
+	}
+	return framebuffer;
+}
+
+void EJGLBackendES2::bindFramebuffer (unsigned int framebuffer) {
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+}
+
+void EJGLBackendES2::deleteFramebuffer (unsigned int framebuffer, unsigned int stencilBuffer) {
+	if (framebuffer) { glDeleteFramebuffers(1, &framebuffer); }
+	if (stencilBuffer) { glDeleteRenderbuffers(1, &stencilBuffer); }
+}
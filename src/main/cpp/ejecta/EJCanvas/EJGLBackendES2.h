@@ -0,0 +1,58 @@
+#ifndef __EJGLBACKENDES2_H
+#define __EJGLBACKENDES2_H	1
+
+#include "EJGLBackend.h"
+
+/**
+ * Shader pipeline of GLES2 and later
+ * the projection is applied in the vertex shader; there is one program per fill kind, compiled on first use, and one
+ * for the blur of shadows
+ * (gl types are spelled out, so this header can be included next to the GLES1 headers)
+ */
+class EJGLBackendES2 : public EJGLBackend {
+public:
+	EJGLBackendES2();
+	~EJGLBackendES2();
+
+	void enableVertexArrays();
+	void setProjection (short width, short height, bool flipped);
+	void setFill (EJGLFillKind fill);
+	bool supportsDistanceFields() { return true; }
+	void setOutlineWidth (float width);
+	bool supportsExternalTextures();
+	void setExternalTransform (const CGAffineTransform &transform);
+	bool supportsBlur() { return true; }
+	void drawTriangles (int first, int count);
+	void drawFan (const EJVector2* vertices, int count);
+	void drawMaskTriangles (const EJVector2* vertices, int count);
+	void drawBlur (float dx, float dy, const float *weights, int taps, float u, float v);
+	void resetState();
+	unsigned int createFramebuffer (unsigned int texture, int width, int height, int samples, unsigned int *stencilBuffer);
+	void bindFramebuffer (unsigned int framebuffer);
+	void deleteFramebuffer (unsigned int framebuffer, unsigned int stencilBuffer);
+private:
+	struct Program {
+		unsigned int program;
+		int projection;					// location of the projection uniform
+		unsigned int projectionVersion;	// version of the projection last uploaded to the program
+		int uvTransform;				// location of the uv transform of kEJGLFillExternal, -1 for the others
+		int outlineWidth;				// location of the band width of kEJGLFillOutline, -1 for the others
+	};
+
+	void useProgram (EJGLFillKind fill);
+	void setArrays (int arrays);
+	void drawMask (const EJVector2* vertices, int count, unsigned int mode);
+	bool compile (EJGLFillKind fill);
+
+	Program _programs[kEJGLFillCount];
+	// draws in clip space, without a projection
+	unsigned int _blurProgram;
+	int _blurStep, _blurWeights;		// uniform locations
+	int _current;					// fill kind of the program in use, -1 before the first draw
+	int _arrays;					// bits of the enabled vertex attrib arrays, -1 if not known
+	float _projection[4];			// scale and offset from canvas units to clip space
+	unsigned int _projectionVersion;
+	int _externalTextures;			// 1 if GL_OES_EGL_image_external is supported, 0 if not, -1 if not known
+};
+
+#endif
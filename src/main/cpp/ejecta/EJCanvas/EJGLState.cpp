@@ -0,0 +1,180 @@
+#include "EJGLState.h"
+
+#include "NdkMisc.h"
+#define LOG_TAG	"EJGLState"
+
+namespace {
+
+enum {
+	kEJGLCapBlend,
+	kEJGLCapStencilTest,
+	kEJGLCapScissorTest,
+	kEJGLCapTexture2D,
+	kEJGLCapCount
+};
+
+// values of a thread start out zeroed, which is unknown
+enum {
+	kEJGLUnknown = 0,
+	kEJGLOff,
+	kEJGLOn
+};
+
+struct EJGLStateCache {
+	unsigned char caps[kEJGLCapCount];
+	unsigned char colorMask;
+	bool blendKnown;
+	GLenum blendSource, blendDestination;
+	bool stencilFuncKnown;
+	GLenum stencilFunc;
+	GLint stencilRef;
+	GLuint stencilFuncMask;
+	bool stencilOpKnown;
+	GLenum stencilFail, stencilZFail, stencilZPass;
+	bool stencilMaskKnown;
+	GLuint stencilMask;
+	bool scissorKnown;
+	GLint scissor[4];
+	bool textureKnown;
+	GLuint texture;
+};
+
+thread_local EJGLStateCache cache;
+
+int capIndex (GLenum cap) {
+	switch( cap ) {
+		case GL_BLEND: return kEJGLCapBlend;
+		case GL_STENCIL_TEST: return kEJGLCapStencilTest;
+		case GL_SCISSOR_TEST: return kEJGLCapScissorTest;
+		case GL_TEXTURE_2D: return kEJGLCapTexture2D;
+		default: return -1;
+	}
+}
+
+}
+
+void EJGLState::invalidate() {
+	cache = EJGLStateCache();
+}
+
+void EJGLState::setEnabled (GLenum cap, bool enabled) {
+	const int index = capIndex(cap);
+	const unsigned char value = enabled ? kEJGLOn : kEJGLOff;
+	if( index >= 0 ) {
+		if( cache.caps[index] == value ) { return; }
+		cache.caps[index] = value;
+	}
+	if( enabled ) {
+		glEnable(cap);
+	} else {
+		glDisable(cap);
+	}
+}
+
+void EJGLState::enable (GLenum cap) {
+	setEnabled(cap, true);
+}
+
+void EJGLState::disable (GLenum cap) {
+	setEnabled(cap, false);
+}
+
+bool EJGLState::isEnabled (GLenum cap) {
+	const int index = capIndex(cap);
+	if( index >= 0 && cache.caps[index] != kEJGLUnknown ) {
+		return cache.caps[index] == kEJGLOn;
+	}
+	const bool enabled = glIsEnabled(cap);
+	if( index >= 0 ) {
+		cache.caps[index] = enabled ? kEJGLOn : kEJGLOff;
+	}
+	return enabled;
+}
+
+void EJGLState::blendFunc (GLenum source, GLenum destination) {
+	if( cache.blendKnown && cache.blendSource == source && cache.blendDestination == destination ) { return; }
+	cache.blendKnown = true;
+	cache.blendSource = source;
+	cache.blendDestination = destination;
+	glBlendFunc(source, destination);
+}
+
+void EJGLState::colorMask (bool enabled) {
+	const unsigned char value = enabled ? kEJGLOn : kEJGLOff;
+	if( cache.colorMask == value ) { return; }
+	cache.colorMask = value;
+	const GLboolean mask = enabled ? GL_TRUE : GL_FALSE;
+	glColorMask(mask, mask, mask, mask);
+}
+
+void EJGLState::stencilFunc (GLenum func, GLint ref, GLuint mask) {
+	if( cache.stencilFuncKnown && cache.stencilFunc == func && cache.stencilRef == ref && cache.stencilFuncMask == mask ) {
+		return;
+	}
+	cache.stencilFuncKnown = true;
+	cache.stencilFunc = func;
+	cache.stencilRef = ref;
+	cache.stencilFuncMask = mask;
+	glStencilFunc(func, ref, mask);
+}
+
+void EJGLState::stencilOp (GLenum fail, GLenum zfail, GLenum zpass) {
+	if( cache.stencilOpKnown && cache.stencilFail == fail && cache.stencilZFail == zfail && cache.stencilZPass == zpass ) {
+		return;
+	}
+	cache.stencilOpKnown = true;
+	cache.stencilFail = fail;
+	cache.stencilZFail = zfail;
+	cache.stencilZPass = zpass;
+	glStencilOp(fail, zfail, zpass);
+}
+
+void EJGLState::stencilMask (GLuint mask) {
+	if( cache.stencilMaskKnown && cache.stencilMask == mask ) { return; }
+	cache.stencilMaskKnown = true;
+	cache.stencilMask = mask;
+	glStencilMask(mask);
+}
+
+void EJGLState::scissor (GLint x, GLint y, GLsizei width, GLsizei height) {
+	if( cache.scissorKnown && cache.scissor[0] == x && cache.scissor[1] == y &&
+			cache.scissor[2] == width && cache.scissor[3] == height ) {
+		return;
+	}
+	cache.scissorKnown = true;
+	cache.scissor[0] = x;
+	cache.scissor[1] = y;
+	cache.scissor[2] = width;
+	cache.scissor[3] = height;
+	glScissor(x, y, width, height);
+}
+
+void EJGLState::bindTexture (GLuint texture) {
+	if( cache.textureKnown && cache.texture == texture ) { return; }
+	cache.textureKnown = true;
+	cache.texture = texture;
+	glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+GLuint EJGLState::boundTexture() {
+	if( !cache.textureKnown ) {
+		GLint texture = 0;
+		glGetIntegerv(GL_TEXTURE_BINDING_2D, &texture);
+		cache.textureKnown = true;
+		cache.texture = (GLuint)texture;
+	}
+	return cache.texture;
+}
+
+void EJGLState::deleteTexture (GLuint texture) {
+	if( cache.textureKnown && cache.texture == texture ) {
+		cache.texture = 0;
+	}
+	glDeleteTextures(1, &texture);
+}
+
+void EJGLState::checkError (const char *op) {
+	for( GLenum error = glGetError(); error; error = glGetError() ) {
+		LOGI("after %s() glError (0x%x)\n", op, error);
+	}
+}
@@ -0,0 +1,51 @@
+#ifndef __EJGLSTATE_H
+#define __EJGLSTATE_H	1
+
+#include "GLcompat.h"
+
+/**
+ * Shadow of the gl state that canvases change all the time: blending, stencil, scissor, color mask and the bound
+ * texture. Setting a value that is already set does not reach the driver, and isEnabled and boundTexture are answered
+ * without asking it, which waits for the gpu on some drivers.
+ * The state is kept per thread, since a gl context is current on one thread at a time. Everything that changes this
+ * state has to go through here; invalidate has to be called after another gl context was made current on the thread
+ * and after code that calls gl directly, like the renderer of the app before a frame.
+ */
+class EJGLState {
+public:
+	// forgets everything, so the next call of each kind reaches gl again
+	static void invalidate();
+
+	// GL_BLEND, GL_STENCIL_TEST, GL_SCISSOR_TEST and GL_TEXTURE_2D are shadowed; other caps are passed on
+	// GL_TEXTURE_2D is only a capability on GLES1 and is left to EJGLBackendES1::setFill
+	static void enable (GLenum cap);
+	static void disable (GLenum cap);
+	static void setEnabled (GLenum cap, bool enabled);
+	static bool isEnabled (GLenum cap);
+
+	static void blendFunc (GLenum source, GLenum destination);
+	// all four channels at once
+	static void colorMask (bool enabled);
+	static void stencilFunc (GLenum func, GLint ref, GLuint mask);
+	static void stencilOp (GLenum fail, GLenum zfail, GLenum zpass);
+	static void stencilMask (GLuint mask);
+	static void scissor (GLint x, GLint y, GLsizei width, GLsizei height);
+
+	// GL_TEXTURE_2D of texture unit 0, the only one canvases use
+	static void bindTexture (GLuint texture);
+	static GLuint boundTexture();
+	// deleting the bound texture binds 0 instead
+	static void deleteTexture (GLuint texture);
+
+	// logs the errors of the gl calls since the last check
+	static void checkError (const char *op);
+};
+
+// checks for gl errors only in builds with EJ_DEBUG_GL; glGetError waits for the gpu on some drivers
+#ifdef EJ_DEBUG_GL
+#define EJ_CHECK_GL_ERROR(op) EJGLState::checkError(op)
+#else
+#define EJ_CHECK_GL_ERROR(op) do {} while (0)
+#endif
+
+#endif
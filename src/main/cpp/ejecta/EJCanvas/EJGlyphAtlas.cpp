@@ -0,0 +1,137 @@
+#include "EJGlyphAtlas.h"
+#include "EJCanvasContext.h"
+
+#include <string.h>
+
+EJGlyphRasterizer* EJGlyphRasterizer::_shared = NULL;
+
+static const int kWhiteSize = 3;
+
+void EJGlyphRasterizer::setShared (EJGlyphRasterizer* rasterizer) {
+	_shared = rasterizer;
+}
+
+EJGlyphRasterizer* EJGlyphRasterizer::shared() {
+	return _shared;
+}
+
+EJGlyphAtlas::EJGlyphAtlas (int pageSize, int maxPages, GLenum format) {
+	_pageSize = pageSize;
+	_maxPages = maxPages;
+	_format = format;
+	_clock = 0;
+	// center of the white block, so filtering only ever mixes white texels
+	_whiteTexCoord = (kWhiteSize / 2.0f) / pageSize;
+	// centers of the transparent columns of the ramp, which starts a column to the right of the white block
+	_rampTexCoord0 = (kWhiteSize + 1.5f) / pageSize;
+	_rampTexCoord1 = (kWhiteSize + 3.5f) / pageSize;
+}
+
+EJGlyphAtlas::~EJGlyphAtlas() {
+	for (auto page : _pages) {
+		delete page->texture;
+		delete page;
+	}
+}
+
+EJGlyphAtlas::Page* EJGlyphAtlas::createPage() {
+	std::vector<unsigned char> pixels(_pageSize * _pageSize, 0);
+
+	Page* page = new Page(_pageSize);
+	page->texture = EJTexture::initWithWidth(_pageSize, _pageSize, pixels.data(), _format, 1);
+	page->generation = 0;
+	page->lastUse = 0;
+	addWhite(page);
+	return page;
+}
+
+void EJGlyphAtlas::addWhite (Page* page) {
+	// the first rect of an empty page always ends up at the origin
+	int x, y;
+	page->skyline.pack(2 * (kWhiteSize + 1), kWhiteSize + 1, &x, &y);
+
+	// the ramp is transparent, opaque and transparent again from left to right, in every row
+	std::vector<unsigned char> pixels(kWhiteSize * kWhiteSize, 0xff);
+	std::vector<unsigned char> ramp(kWhiteSize * kWhiteSize, 0);
+	for (int row = 0; row < kWhiteSize; row++) {
+		ramp[row * kWhiteSize + kWhiteSize / 2] = 0xff;
+	}
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	page->texture->updateTextureWithPixels(pixels.data(), x, y, kWhiteSize, kWhiteSize);
+	page->texture->updateTextureWithPixels(ramp.data(), x + kWhiteSize + 1, y, kWhiteSize, kWhiteSize);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+EJTexture* EJGlyphAtlas::solidTexture (EJTexture* preferred) {
+	for (auto page : _pages) {
+		if (page->texture == preferred) {
+			return preferred;
+		}
+	}
+	if (_pages.empty()) {
+		_pages.push_back(createPage());
+	}
+	return _pages[0]->texture;
+}
+
+void EJGlyphAtlas::clearPage (Page* page) {
+	std::vector<unsigned char> pixels(_pageSize * _pageSize, 0);
+	page->texture->updateTextureWithPixels(pixels.data(), 0, 0, _pageSize, _pageSize);
+	page->skyline.reset();
+	page->generation++;
+	addWhite(page);
+}
+
+bool EJGlyphAtlas::add (EJCanvasContext* context, const unsigned char* pixels, int width, int height, int stride, EJGlyphAtlasSlot* slot) {
+	// keep a gutter of one pixel to the right and bottom, so filtering never picks up a neighbour
+	const int paddedWidth = width + 1, paddedHeight = height + 1;
+	if (paddedWidth > _pageSize || paddedHeight > _pageSize) {
+		return false;
+	}
+
+	int index = -1, x = 0, y = 0;
+	for (size_t i = 0; i < _pages.size(); i++) {
+		if (_pages[i]->skyline.pack(paddedWidth, paddedHeight, &x, &y)) {
+			index = (int)i;
+			break;
+		}
+	}
+
+	if (index < 0) {
+		if ((int)_pages.size() < _maxPages) {
+			index = (int)_pages.size();
+			_pages.push_back(createPage());
+		} else {
+			index = 0;
+			for (size_t i = 1; i < _pages.size(); i++) {
+				if (_pages[i]->lastUse < _pages[index]->lastUse) {
+					index = (int)i;
+				}
+			}
+			// queued vertices may still sample the page
+			context->flushBuffers();
+			clearPage(_pages[index]);
+		}
+		_pages[index]->skyline.pack(paddedWidth, paddedHeight, &x, &y);
+	}
+
+	Page* page = _pages[index];
+	if (width && height) {
+		_upload.resize(width * height);
+		for (int row = 0; row < height; row++) {
+			memcpy(&_upload[row * width], &pixels[row * stride], width);
+		}
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		page->texture->updateTextureWithPixels(_upload.data(), x, y, width, height);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	}
+
+	slot->page = index;
+	slot->generation = page->generation;
+	slot->s0 = (float)x / _pageSize;
+	slot->t0 = (float)y / _pageSize;
+	slot->s1 = (float)(x + width) / _pageSize;
+	slot->t1 = (float)(y + height) / _pageSize;
+	page->lastUse = ++_clock;
+	return true;
+}
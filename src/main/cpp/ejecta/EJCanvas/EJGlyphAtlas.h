@@ -0,0 +1,122 @@
+#ifndef __EJGLYPHATLAS_H
+#define __EJGLYPHATLAS_H	1
+
+#include "EJTexture.h"
+#include "EJSkyline.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+class EJCanvasContext;
+
+typedef struct
+{
+    float ascender;		// distance from the baseline to the top of the font, positive
+    float descender;	// distance from the baseline to the bottom of the font, negative
+    float height;		// distance between two baselines
+} EJFontMetrics;
+
+typedef struct
+{
+    int width, height;
+    int stride;			// bytes per row of pixels
+    float left, top;	// position of the bitmap relative to the pen; top is measured upwards from the baseline
+    float advance;
+} EJGlyphBitmap;
+
+/**
+ * Platform font stack used to render glyphs at runtime
+ * faces are opaque handles for a font at one pixel size
+ */
+class EJGlyphRasterizer {
+public:
+	virtual ~EJGlyphRasterizer() {}
+
+	virtual void* createFace (const char* font, float pxSize, EJFontMetrics* metrics) = 0;
+	virtual void releaseFace (void* face) = 0;
+
+	/**
+	 * renders the glyph into pixels as 8 bit alpha values
+	 * a bitmap without width is returned for glyphs that have no pixels or do not fit into capacity bytes
+	 */
+	virtual bool rasterize (void* face, uint32_t codepoint, unsigned char* pixels, size_t capacity, EJGlyphBitmap* bitmap) = 0;
+
+	static void setShared (EJGlyphRasterizer* rasterizer);
+	static EJGlyphRasterizer* shared();
+private:
+	static EJGlyphRasterizer* _shared;
+};
+
+typedef struct
+{
+    int page;				// -1 if the glyph is not in the atlas
+    uint32_t generation;	// generation of the page the glyph was added in
+    float s0, t0, s1, t1;
+} EJGlyphAtlasSlot;
+
+/**
+ * Alpha textures that glyphs of all fonts of a context are packed into
+ * Every page is packed with a skyline; once all pages are full, the least recently used page is cleared and reused.
+ * Slots of a cleared page become invalid and have to be added again.
+ * Every page starts with a block of opaque texels, so solid fills can be drawn with the same texture as text, and a ramp
+ * that hairlines are drawn with.
+ * Atlases of distance fields keep their texels in GL_LUMINANCE textures, which the context draws with the distance fill.
+ */
+class EJGlyphAtlas {
+public:
+	EJGlyphAtlas (int pageSize, int maxPages, GLenum format = GL_ALPHA);
+	~EJGlyphAtlas();
+
+	/**
+	 * copies the glyph into a page; returns false if it is larger than a page
+	 * pending vertices of the context are flushed before a page in use is cleared
+	 */
+	bool add (EJCanvasContext* context, const unsigned char* pixels, int width, int height, int stride, EJGlyphAtlasSlot* slot);
+
+	bool isValid (const EJGlyphAtlasSlot* slot) const {
+		return slot->page >= 0 && _pages[slot->page]->generation == slot->generation;
+	}
+
+	/**
+	 * returns a page to draw solid fills with at whiteTexCoord()
+	 * the preferred texture is returned if it is a page, so fills next to text do not switch textures
+	 */
+	EJTexture* solidTexture (EJTexture* preferred);
+	float whiteTexCoord() const { return _whiteTexCoord; }
+	// the same pages hold a ramp of coverage at a v of whiteTexCoord, transparent at both u and opaque halfway between,
+	// which bilinear filtering turns into the antialiased profile of a line
+	float rampTexCoord0() const { return _rampTexCoord0; }
+	float rampTexCoord1() const { return _rampTexCoord1; }
+
+	// marks the page of the slot as used and returns its texture
+	EJTexture* use (const EJGlyphAtlasSlot* slot) {
+		Page* page = _pages[slot->page];
+		page->lastUse = ++_clock;
+		return page->texture;
+	}
+private:
+	struct Page {
+		EJTexture* texture;
+		EJSkyline skyline;
+		uint32_t generation;
+		uint64_t lastUse;
+
+		Page (int size) : skyline(size, size) {}
+	};
+
+	Page* createPage();
+	void addWhite (Page* page);
+	void clearPage (Page* page);
+
+	int _pageSize;
+	int _maxPages;
+	GLenum _format;
+	float _whiteTexCoord;
+	float _rampTexCoord0, _rampTexCoord1;
+	uint64_t _clock;
+	std::vector<Page*> _pages;
+	std::vector<unsigned char> _upload;
+};
+
+#endif
@@ -0,0 +1,152 @@
+#include "EJHardwareBuffer.h"
+#include "NdkMisc.h"
+
+#define LOG_TAG "EJHardwareBuffer"
+
+#include <EGL/egl.h>
+#include <dlfcn.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+// from android/hardware_buffer.h and EGL/eglext.h, which not every ndk has all of
+struct HardwareBufferDesc {
+	uint32_t width, height, layers, format;
+	uint64_t usage;
+	uint32_t stride, rfu0;
+	uint64_t rfu1;
+};
+
+const uint32_t kHardwareBufferFormatRGBA8888 = 1;		// AHARDWAREBUFFER_FORMAT_R8G8B8A8_UNORM
+const uint64_t kHardwareBufferUsageCpuReadOften = 3;	// AHARDWAREBUFFER_USAGE_CPU_READ_OFTEN
+const uint64_t kHardwareBufferUsageCpuReadMask = 0xf;	// AHARDWAREBUFFER_USAGE_CPU_READ_MASK
+const EGLint kEGLNativeBufferAndroid = 0x3140;			// EGL_NATIVE_BUFFER_ANDROID
+const EGLint kEGLImagePreserved = 0x30D2;				// EGL_IMAGE_PRESERVED_KHR
+
+template <typename T> bool resolve (T &function, const char *name) {
+	function = (T)dlsym(RTLD_DEFAULT, name);
+	return function != NULL;
+}
+
+struct HardwareBufferApi {
+	void (*acquire) (AHardwareBuffer*);
+	void (*release) (AHardwareBuffer*);
+	void (*describe) (const AHardwareBuffer*, HardwareBufferDesc*);
+	int (*lock) (AHardwareBuffer*, uint64_t, int32_t, const void*, void**);
+	int (*unlock) (AHardwareBuffer*, int32_t*);
+	bool available;
+
+	HardwareBufferApi() {
+		available = resolve(acquire, "AHardwareBuffer_acquire") &&
+			resolve(release, "AHardwareBuffer_release") &&
+			resolve(describe, "AHardwareBuffer_describe") &&
+			resolve(lock, "AHardwareBuffer_lock") &&
+			resolve(unlock, "AHardwareBuffer_unlock");
+	}
+};
+
+const HardwareBufferApi& hardwareBuffer() {
+	static HardwareBufferApi api;
+	return api;
+}
+
+// looked up with the first texture, once a gl context is current
+struct EGLImageApi {
+	EGLClientBuffer (*getNativeClientBuffer) (const AHardwareBuffer*);
+	void* (*createImage) (EGLDisplay, EGLContext, EGLenum, EGLClientBuffer, const EGLint*);
+	EGLBoolean (*destroyImage) (EGLDisplay, void*);
+	void (*imageTargetTexture) (GLenum, void*);
+	bool available;
+
+	EGLImageApi() {
+		const char* eglExtensions = eglQueryString(eglGetCurrentDisplay(), EGL_EXTENSIONS);
+		const char* glExtensions = (const char*)glGetString(GL_EXTENSIONS);
+		available = eglExtensions && glExtensions &&
+			strstr(eglExtensions, "EGL_ANDROID_get_native_client_buffer") &&
+			strstr(eglExtensions, "EGL_ANDROID_image_native_buffer") &&
+			strstr(glExtensions, "GL_OES_EGL_image");
+		getNativeClientBuffer = (EGLClientBuffer (*) (const AHardwareBuffer*))eglGetProcAddress("eglGetNativeClientBufferANDROID");
+		createImage = (void* (*) (EGLDisplay, EGLContext, EGLenum, EGLClientBuffer, const EGLint*))eglGetProcAddress("eglCreateImageKHR");
+		destroyImage = (EGLBoolean (*) (EGLDisplay, void*))eglGetProcAddress("eglDestroyImageKHR");
+		imageTargetTexture = (void (*) (GLenum, void*))eglGetProcAddress("glEGLImageTargetTexture2DOES");
+		available = available && getNativeClientBuffer && createImage && destroyImage && imageTargetTexture;
+		LOGI("Sampling hardware buffers %s", available ? "directly" : "from copies of their pixels");
+	}
+};
+
+const EGLImageApi& eglImage() {
+	static EGLImageApi api;
+	return api;
+}
+
+}
+
+bool EJHardwareBuffer::available() {
+	return hardwareBuffer().available;
+}
+
+void EJHardwareBuffer::acquire (AHardwareBuffer* buffer) {
+	hardwareBuffer().acquire(buffer);
+}
+
+void EJHardwareBuffer::release (AHardwareBuffer* buffer) {
+	hardwareBuffer().release(buffer);
+}
+
+bool EJHardwareBuffer::describe (AHardwareBuffer* buffer, int* width, int* height) {
+	HardwareBufferDesc desc;
+	memset(&desc, 0, sizeof(desc));
+	hardwareBuffer().describe(buffer, &desc);
+	*width = desc.width;
+	*height = desc.height;
+	return desc.format == kHardwareBufferFormatRGBA8888 && desc.layers <= 1;
+}
+
+GLubyte* EJHardwareBuffer::readPixels (AHardwareBuffer* buffer) {
+	HardwareBufferDesc desc;
+	memset(&desc, 0, sizeof(desc));
+	hardwareBuffer().describe(buffer, &desc);
+	if( !(desc.usage & kHardwareBufferUsageCpuReadMask) ) {
+		LOGE("Hardware buffer of %ux%u can not be read by the cpu", desc.width, desc.height);
+		return NULL;
+	}
+
+	void* data = NULL;
+	if( hardwareBuffer().lock(buffer, kHardwareBufferUsageCpuReadOften, -1, NULL, &data) != 0 || !data ) {
+		LOGE("Hardware buffer of %ux%u could not be locked", desc.width, desc.height);
+		return NULL;
+	}
+	GLubyte* pixels = (GLubyte*)malloc((size_t)desc.width * desc.height * 4);
+	if( pixels ) {
+		for( uint32_t y = 0; y < desc.height; y++ ) {
+			memcpy(pixels + (size_t)y * desc.width * 4, (const GLubyte*)data + (size_t)y * desc.stride * 4, desc.width * 4);
+		}
+	}
+	hardwareBuffer().unlock(buffer, NULL);
+	return pixels;
+}
+
+void* EJHardwareBuffer::createImage (AHardwareBuffer* buffer) {
+	const EGLImageApi &api = eglImage();
+	if( !api.available ) { return NULL; }
+
+	EGLClientBuffer clientBuffer = api.getNativeClientBuffer(buffer);
+	const EGLint attributes[] = { kEGLImagePreserved, EGL_TRUE, EGL_NONE };
+	void* image = clientBuffer
+		? api.createImage(eglGetCurrentDisplay(), EGL_NO_CONTEXT, kEGLNativeBufferAndroid, clientBuffer, attributes)
+		: NULL;
+	if( !image ) {
+		LOGE("Hardware buffer could not be made an EGLImage: 0x%x", eglGetError());
+	}
+	return image;
+}
+
+void EJHardwareBuffer::destroyImage (void* image) {
+	eglImage().destroyImage(eglGetCurrentDisplay(), image);
+}
+
+void EJHardwareBuffer::bindImage (void* image) {
+	eglImage().imageTargetTexture(GL_TEXTURE_2D, image);
+}
@@ -0,0 +1,31 @@
+#ifndef __EJHARDWAREBUFFER_H
+#define __EJHARDWAREBUFFER_H	1
+
+#include "GLcompat.h"
+
+struct AHardwareBuffer;
+
+/**
+ * Images in AHardwareBuffers, which textures sample where they are instead of a copy of their pixels
+ * The functions of libandroid are looked up at runtime, since the library runs on api levels that do not have them,
+ * and so are the egl and gl extensions that turn a buffer into a texture. Only rgba8888 buffers can be images.
+ */
+class EJHardwareBuffer {
+public:
+	// false below api 26, where nothing else may be called
+	static bool available();
+	static void acquire (AHardwareBuffer* buffer);
+	static void release (AHardwareBuffer* buffer);
+	// false if buffer does not hold rgba8888 pixels
+	static bool describe (AHardwareBuffer* buffer, int* width, int* height);
+	// malloc'd copy of the pixels of a buffer the cpu may read, without its row padding; NULL if it may not
+	static GLubyte* readPixels (AHardwareBuffer* buffer);
+
+	// EGLImage of buffer on the current display, NULL where the extensions are missing
+	static void* createImage (AHardwareBuffer* buffer);
+	static void destroyImage (void* image);
+	// points the texture bound to GL_TEXTURE_2D at image
+	static void bindImage (void* image);
+};
+
+#endif
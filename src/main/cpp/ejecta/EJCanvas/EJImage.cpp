@@ -0,0 +1,248 @@
+#include "EJImage.h"
+#include "EJPNGDecoder.h"
+#include "EJTexture.h"
+#include "EJHardwareBuffer.h"
+#include "EJExternalTexture.h"
+#include "lodepng.h"
+#include "NdkMisc.h"
+
+#define LOG_TAG "EJImage"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <unordered_map>
+#include <stdlib.h>
+
+// decoding is bound by memory and the cpu; two threads keep a list of icons flowing without starving the ui
+#define EJ_IMAGE_DECODER_THREADS 2
+
+namespace {
+
+std::mutex registryMutex;
+std::unordered_map<std::string, EJImage*> registry;
+
+std::mutex queueMutex;
+std::condition_variable queueCondition;
+std::deque<EJImage*> queue;
+bool decodersStarted = false;
+
+}
+
+EJImage* EJImage::load (const char* path, EJImageLoader loader, void* loaderData) {
+	EJImage* image;
+	{
+		std::lock_guard<std::mutex> lock(registryMutex);
+		auto it = registry.find(path);
+		if (it != registry.end()) {
+			it->second->_refCount++;
+			return it->second;
+		}
+		image = new EJImage(path, loader, loaderData);
+		registry[image->_path] = image;
+	}
+
+	// the queue holds a reference until the image is decoded
+	image->retain();
+	std::lock_guard<std::mutex> lock(queueMutex);
+	if (!decodersStarted) {
+		for (int i = 0; i < EJ_IMAGE_DECODER_THREADS; i++) {
+			std::thread(EJImage::decoderThread).detach();
+		}
+		decodersStarted = true;
+	}
+	queue.push_back(image);
+	queueCondition.notify_one();
+	return image;
+}
+
+EJImage::EJImage (const char* path, EJImageLoader loader, void* loaderData) :
+	_path(path), _loader(loader), _loaderData(loaderData), _refCount(1), _state(kEJImageLoading),
+	_width(0), _height(0), _pixels(NULL), _compressed(NULL), _hardwareBuffer(NULL), _externalTexture(NULL), _fallbackDecoded(false), _opaque(false),
+	_premultiplied(EJTexture::premultipliedAlpha()) {
+}
+
+static bool isOpaque (const unsigned char* pixels, unsigned int width, unsigned int height) {
+	const unsigned char* end = pixels + (size_t)width * height * 4;
+	for (const unsigned char* alpha = pixels + 3; alpha < end; alpha += 4) {
+		if (*alpha != 0xff) {
+			return false;
+		}
+	}
+	return true;
+}
+
+EJImage* EJImage::initWithPixels (const char* path, int width, int height, GLubyte* pixels, bool premultiplied) {
+	EJImage* image = new EJImage(path, NULL, NULL);
+	image->_width = width;
+	image->_height = height;
+	image->_pixels = pixels;
+	image->_opaque = isOpaque(pixels, width, height);
+	image->_premultiplied = premultiplied;
+	return image->publish();
+}
+
+EJImage* EJImage::initWithHardwareBuffer (const char* path, AHardwareBuffer* buffer, int width, int height, bool premultiplied) {
+	EJImage* image = new EJImage(path, NULL, NULL);
+	EJHardwareBuffer::acquire(buffer);
+	image->_hardwareBuffer = buffer;
+	image->_width = width;
+	image->_height = height;
+	image->_premultiplied = premultiplied;
+	return image->publish();
+}
+
+EJImage* EJImage::initWithExternalTexture (const char* path, EJExternalTexture* texture) {
+	EJImage* image = new EJImage(path, NULL, NULL);
+	texture->retain();
+	image->_externalTexture = texture;
+	image->_width = texture->width();
+	image->_height = texture->height();
+	// frames of videos and cameras are opaque
+	image->_opaque = true;
+	image->_premultiplied = true;
+	return image->publish();
+}
+
+EJImage* EJImage::publish() {
+	_state = kEJImageDecoded;
+	std::lock_guard<std::mutex> lock(registryMutex);
+	registry[_path] = this;
+	return this;
+}
+
+EJImage::~EJImage() {
+	free(_pixels);
+	delete _compressed;
+	if (_hardwareBuffer) {
+		EJHardwareBuffer::release(_hardwareBuffer);
+	}
+	if (_externalTexture) {
+		_externalTexture->release();
+	}
+}
+
+void EJImage::retain() {
+	_refCount++;
+}
+
+void EJImage::release() {
+	// the registry lock keeps load from handing out the image while it is deleted
+	std::lock_guard<std::mutex> lock(registryMutex);
+	if (--_refCount == 0) {
+		// an image that was added for the path since has taken its place
+		auto it = registry.find(_path);
+		if (it != registry.end() && it->second == this) {
+			registry.erase(it);
+		}
+		delete this;
+	}
+}
+
+void EJImage::whenDone (EJImageCallback callback, void* data) {
+	{
+		std::lock_guard<std::mutex> lock(_callbackMutex);
+		if (_state.load() == kEJImageLoading) {
+			_callbacks.push_back(std::make_pair(callback, data));
+			return;
+		}
+	}
+	callback(this, data);
+}
+
+unsigned char* EJImage::loadFile (const std::string& path, size_t* length) {
+	if (!path.empty() && path[0] == '/') {
+		unsigned char* file = NULL;
+		if (lodepng_load_file(&file, length, path.c_str())) {
+			free(file);
+			return NULL;
+		}
+		return file;
+	}
+	return _loader ? _loader(path.c_str(), length, _loaderData) : NULL;
+}
+
+void EJImage::decode() {
+	unsigned char* pixels = NULL;
+	unsigned int w = 0, h = 0, error = 0;
+	size_t length = 0;
+	unsigned char* file = this->loadFile(_path, &length);
+	EJCompressedImage* compressed = file ? EJCompressedImage::initWithData(file, length) : NULL;
+	if (compressed) {
+		w = compressed->width();
+		h = compressed->height();
+	} else {
+		error = file ? EJPNGDecoder::decode(file, length, &pixels, &w, &h, NULL, NULL, _premultiplied) : 78;	// 78 is lodepng's "failed to open file"
+	}
+	free(file);
+
+	if (error) {
+		LOGE("Error loading image %s - %u: %s", _path.c_str(), error, EJPNGDecoder::errorText(error));
+		free(pixels);
+	} else {
+		_pixels = pixels;
+		_opaque = pixels && isOpaque(pixels, w, h);
+		_compressed = compressed;
+		_width = w;
+		_height = h;
+	}
+
+	std::vector<std::pair<EJImageCallback, void*> > callbacks;
+	{
+		std::lock_guard<std::mutex> lock(_callbackMutex);
+		_state = error ? kEJImageFailed : kEJImageDecoded;
+		callbacks.swap(_callbacks);
+	}
+	for (auto &callback : callbacks) {
+		callback.first(this, callback.second);
+	}
+}
+
+void EJImage::decoderThread() {
+	for (;;) {
+		EJImage* image;
+		{
+			std::unique_lock<std::mutex> lock(queueMutex);
+			queueCondition.wait(lock, [] { return !queue.empty(); });
+			image = queue.front();
+			queue.pop_front();
+		}
+		image->decode();
+		image->release();
+	}
+}
+
+bool EJImage::ensurePixels() {
+	std::lock_guard<std::mutex> lock(_callbackMutex);
+	if (_pixels || (!_compressed && !_hardwareBuffer) || _fallbackDecoded) {
+		return _pixels != NULL;
+	}
+	_fallbackDecoded = true;
+
+	if (_hardwareBuffer) {
+		_pixels = EJHardwareBuffer::readPixels(_hardwareBuffer);
+		_opaque = _pixels && isOpaque(_pixels, _width, _height);
+		return _pixels != NULL;
+	}
+
+	const std::string path = EJCompressedImage::fallbackPath(_path);
+	size_t length = 0;
+	unsigned char* file = path.empty() ? NULL : this->loadFile(path, &length);
+	unsigned char* pixels = NULL;
+	unsigned int w = 0, h = 0;
+	unsigned int error = file ? EJPNGDecoder::decode(file, length, &pixels, &w, &h, NULL, NULL, _premultiplied) : 78;
+	free(file);
+
+	if (error) {
+		LOGE("Error loading image %s - %u: %s", path.c_str(), error, EJPNGDecoder::errorText(error));
+		return false;
+	}
+	if (w != (unsigned)_width || h != (unsigned)_height) {
+		LOGE("Error loading image %s - its size differs from %s", path.c_str(), _path.c_str());
+		free(pixels);
+		return false;
+	}
+	_pixels = pixels;
+	_opaque = isOpaque(pixels, w, h);
+	return true;
+}
@@ -0,0 +1,103 @@
+#ifndef __EJIMAGE_H
+#define __EJIMAGE_H	1
+
+#include "GLcompat.h"
+#include "EJCompressedImage.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class EJImage;
+class EJExternalTexture;
+struct AHardwareBuffer;
+
+// returns the malloc'd contents of a file, or NULL; called on a decoder thread
+typedef unsigned char* (*EJImageLoader) (const char* path, size_t* length, void* data);
+// called once the image is decoded or failed to, on the decoder thread or the thread that asked
+typedef void (*EJImageCallback) (EJImage* image, void* data);
+
+typedef enum {
+	kEJImageLoading,
+	kEJImageDecoded,
+	kEJImageFailed
+} EJImageState;
+
+/**
+ * A png decoded into rgba pixels on a pool of decoder threads
+ * Images are shared by path while they are retained, so an image that is in use by several objects is only decoded once.
+ * The pixels stay in memory as long as the image; textures are made from them by the texture cache of each context.
+ * Images of ktx and pkm files keep their compressed data instead; the png of the same name is only decoded when a
+ * context can not sample the format, or something needs the pixels.
+ * Images that were decoded elsewhere can be added for a path, which load returns from then on instead of reading it;
+ * those of hardware buffers are sampled by textures without a copy of their pixels, those of external textures show
+ * whatever frame java streamed into them last.
+ */
+class EJImage {
+public:
+	// retained image for path; decoding starts when the image is not in use yet. Paths starting with '/' are files,
+	// all others are read with loader
+	static EJImage* load (const char* path, EJImageLoader loader, void* loaderData);
+	// retained decoded image of width x height rgba pixels for path, which takes over the malloc'd pixels; images
+	// that were loaded for path before keep theirs
+	static EJImage* initWithPixels (const char* path, int width, int height, GLubyte* pixels, bool premultiplied);
+	// likewise for the rgba8888 pixels in buffer, which the image acquires
+	static EJImage* initWithHardwareBuffer (const char* path, AHardwareBuffer* buffer, int width, int height, bool premultiplied);
+	// likewise for the frames of an external texture, which the image retains; it has no pixels
+	static EJImage* initWithExternalTexture (const char* path, EJExternalTexture* texture);
+
+	void retain();
+	void release();
+
+	// calls callback with data once the image is decoded or failed to; right away if that has already happened
+	void whenDone (EJImageCallback callback, void* data);
+
+	EJImageState state() const { return _state.load(); }
+	const std::string& path() const { return _path; }
+	// only valid once the image is decoded
+	int width() const { return _width; }
+	int height() const { return _height; }
+	const GLubyte* pixels() const { return _pixels; }
+	// all pixels have full alpha, so a texture without alpha can hold them
+	bool opaque() const { return _opaque; }
+	// the pixels are premultiplied by their alpha, as EJTexture::premultipliedAlpha asked for when the image was loaded
+	bool premultiplied() const { return _premultiplied; }
+	// data of a ktx or pkm image, NULL for pngs
+	const EJCompressedImage* compressed() const { return _compressed; }
+	// buffer of an image made with initWithHardwareBuffer, NULL for all others
+	AHardwareBuffer* hardwareBuffer() const { return _hardwareBuffer; }
+	// texture of an image made with initWithExternalTexture, NULL for all others
+	EJExternalTexture* externalTexture() const { return _externalTexture; }
+	// decodes the png of a compressed image, or copies the pixels of a hardware buffer, the first time it is called;
+	// false if the image has no pixels
+	bool ensurePixels();
+
+private:
+	EJImage (const char* path, EJImageLoader loader, void* loaderData);
+	~EJImage();
+	void decode();
+	// makes this the image of its path, for images that are decoded already
+	EJImage* publish();
+	unsigned char* loadFile (const std::string& path, size_t* length);
+	static void decoderThread();
+
+	std::string _path;
+	EJImageLoader _loader;
+	void* _loaderData;
+	std::atomic<int> _refCount;
+	std::atomic<EJImageState> _state;
+	int _width, _height;
+	GLubyte* _pixels;
+	EJCompressedImage* _compressed;
+	AHardwareBuffer* _hardwareBuffer;
+	EJExternalTexture* _externalTexture;
+	bool _fallbackDecoded;
+	bool _opaque;
+	bool _premultiplied;
+
+	std::mutex _callbackMutex;
+	std::vector<std::pair<EJImageCallback, void*> > _callbacks;
+};
+
+#endif
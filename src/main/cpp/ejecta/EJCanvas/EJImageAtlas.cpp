@@ -0,0 +1,79 @@
+#include "EJImageAtlas.h"
+#include "EJCanvasContext.h"
+
+#include <string.h>
+#include <algorithm>
+
+EJImageAtlas::EJImageAtlas (int pageSize, int maxPages) {
+	_pageSize = pageSize;
+	_maxPages = maxPages;
+	_clock = 0;
+}
+
+EJImageAtlas::~EJImageAtlas() {
+	for (auto page : _pages) {
+		delete page->texture;
+		delete page;
+	}
+}
+
+bool EJImageAtlas::add (EJCanvasContext* context, const GLubyte* pixels, int width, int height, bool premultiplied,
+		EJImageAtlasSlot* slot) {
+	const int paddedWidth = width + 2, paddedHeight = height + 2;
+	if (paddedWidth > _pageSize || paddedHeight > _pageSize) {
+		return false;
+	}
+
+	int index = -1, x = 0, y = 0;
+	for (size_t i = 0; i < _pages.size(); i++) {
+		if (_pages[i]->texture->isPremultiplied() == premultiplied &&
+				_pages[i]->skyline.pack(paddedWidth, paddedHeight, &x, &y)) {
+			index = (int)i;
+			break;
+		}
+	}
+
+	if (index < 0) {
+		if ((int)_pages.size() < _maxPages) {
+			index = (int)_pages.size();
+			// every texel that is ever sampled is written by an image, so the page does not have to be cleared
+			Page* page = new Page(_pageSize);
+			page->texture = EJTexture::initWithWidth(_pageSize, _pageSize, GL_RGBA);
+			page->generation = 0;
+			page->lastUse = 0;
+			_pages.push_back(page);
+		} else {
+			index = 0;
+			for (size_t i = 1; i < _pages.size(); i++) {
+				if (_pages[i]->lastUse < _pages[index]->lastUse) {
+					index = (int)i;
+				}
+			}
+			// queued vertices may still sample the page
+			context->flushBuffers();
+			_pages[index]->skyline.reset();
+			_pages[index]->generation++;
+		}
+		_pages[index]->texture->setPremultiplied(premultiplied);
+		_pages[index]->skyline.pack(paddedWidth, paddedHeight, &x, &y);
+	}
+
+	// the border repeats the outermost rows and columns
+	_upload.resize(paddedWidth * paddedHeight * 4);
+	for (int row = 0; row < paddedHeight; row++) {
+		const GLubyte* source = &pixels[std::min(std::max(row - 1, 0), height - 1) * width * 4];
+		GLubyte* target = &_upload[row * paddedWidth * 4];
+		memcpy(target, source, 4);
+		memcpy(target + 4, source, width * 4);
+		memcpy(target + (width + 1) * 4, source + (width - 1) * 4, 4);
+	}
+	Page* page = _pages[index];
+	page->texture->updateTextureWithPixels(_upload.data(), x, y, paddedWidth, paddedHeight);
+
+	slot->page = index;
+	slot->generation = page->generation;
+	slot->x = x + 1;
+	slot->y = y + 1;
+	page->lastUse = ++_clock;
+	return true;
+}
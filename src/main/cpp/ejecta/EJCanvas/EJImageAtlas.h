@@ -0,0 +1,64 @@
+#ifndef __EJIMAGEATLAS_H
+#define __EJIMAGEATLAS_H	1
+
+#include "EJTexture.h"
+#include "EJSkyline.h"
+
+#include <stdint.h>
+#include <vector>
+
+class EJCanvasContext;
+
+typedef struct
+{
+    int page;				// -1 if the image is not in the atlas
+    uint32_t generation;	// generation of the page the image was added in
+    int x, y;				// top left corner of the image in the page, in texels
+} EJImageAtlasSlot;
+
+/**
+ * Rgba textures that small images are packed into, so icons drawn next to each other end up in a single draw call
+ * Every image is surrounded by a copy of its edge texels, so filtering at its border does not pick up a neighbour.
+ * Once all pages are full, the least recently used page is reused; slots of a reused page become invalid.
+ */
+class EJImageAtlas {
+public:
+	EJImageAtlas (int pageSize, int maxPages);
+	~EJImageAtlas();
+
+	/**
+	 * copies the rgba pixels of a width x height image into a page; returns false if it is larger than a page
+	 * pending vertices of the context are flushed before a page in use is reused. Premultiplied and straight pixels
+	 * go into separate pages, since a page is blended as a whole
+	 */
+	bool add (EJCanvasContext* context, const GLubyte* pixels, int width, int height, bool premultiplied,
+		EJImageAtlasSlot* slot);
+
+	bool isValid (const EJImageAtlasSlot* slot) const {
+		return slot->page >= 0 && _pages[slot->page]->generation == slot->generation;
+	}
+
+	// marks the page of the slot as used and returns its texture
+	EJTexture* use (const EJImageAtlasSlot* slot) {
+		Page* page = _pages[slot->page];
+		page->lastUse = ++_clock;
+		return page->texture;
+	}
+private:
+	struct Page {
+		EJTexture* texture;
+		EJSkyline skyline;
+		uint32_t generation;
+		uint64_t lastUse;
+
+		Page (int size) : skyline(size, size) {}
+	};
+
+	int _pageSize;
+	int _maxPages;
+	uint64_t _clock;
+	std::vector<Page*> _pages;
+	std::vector<GLubyte> _upload;
+};
+
+#endif
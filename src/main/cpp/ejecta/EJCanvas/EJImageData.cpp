@@ -1,5 +1,9 @@
 #include "EJImageData.h"
 #include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+#include <vector>
 
  EJImageData* EJImageData::initWithWidth (int widthp, int heightp, GLubyte *pixelsp) {
 	EJImageData* self = new EJImageData();
@@ -21,3 +25,33 @@ EJTexture *EJImageData::getTexture () {
 	EJTexture *texture = EJTexture::initWithWidth(width, height, pixels);
 	return texture;
 }
+
+void EJImageData::copyFramebufferPixels (const GLubyte *source, const EJPixelRegion &region, GLubyte *pixels) {
+	const uint32_t *in = (const uint32_t *)source;
+	uint32_t *out = (uint32_t *)pixels;
+
+	// framebuffer column of every canvas column, -1 outside of the region
+	std::vector<int> columns(region.sw);
+	for( int x = 0; x < region.sw; x++ ) {
+		const int column = (int)floorf((region.sx + x) * region.scale) - region.x;
+		columns[x] = column >= 0 && column < region.width ? column : -1;
+	}
+	const bool contiguous = region.sw > 0 && columns[0] >= 0 && columns[region.sw - 1] == columns[0] + region.sw - 1;
+
+	for( int y = 0; y < region.sh; y++, out += region.sw ) {
+		const int row = region.framebufferHeight - 1 - (int)floorf((region.sy + y) * region.scale) - region.y;
+		if( row < 0 || row >= region.height ) {
+			memset(out, 0, region.sw * sizeof(uint32_t));
+			continue;
+		}
+
+		const uint32_t *line = in + row * region.width;
+		if( contiguous ) {
+			memcpy(out, line + columns[0], region.sw * sizeof(uint32_t));
+			continue;
+		}
+		for( int x = 0; x < region.sw; x++ ) {
+			out[x] = columns[x] >= 0 ? line[columns[x]] : 0;
+		}
+	}
+}
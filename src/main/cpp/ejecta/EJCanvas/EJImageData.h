@@ -3,6 +3,14 @@
 #ifndef __EJIMAGEDATA_H__
 #define __EJIMAGEDATA_H__ 1
 
+// sw x sh canvas pixels at sx, sy and the area of the framebuffer they are read from
+typedef struct {
+	float sx, sy;
+	int sw, sh;
+	float scale;				// framebuffer pixels per canvas unit
+	int framebufferHeight;
+	int x, y, width, height;	// from the bottom left of the framebuffer, clipped to it
+} EJPixelRegion;
 
 class EJImageData {
 public:
@@ -12,6 +20,13 @@ public:
 	static EJImageData* initWithWidth (int width, int height, GLubyte *pixels);
 	EJTexture* getTexture();
 	~EJImageData();
+
+	/*
+	 * copies the rgba pixels read from region.x, y, width, height of the framebuffer into the sw x sh canvas pixels
+	 * rows are flipped from bottom up to top down, and every canvas pixel takes the framebuffer pixel it starts on;
+	 * canvas pixels outside of the framebuffer are transparent black. Rows that need no scaling are copied with memcpy
+	 */
+	static void copyFramebufferPixels (const GLubyte *source, const EJPixelRegion &region, GLubyte *pixels);
 };
 
 #endif
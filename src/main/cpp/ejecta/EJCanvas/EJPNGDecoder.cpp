@@ -0,0 +1,212 @@
+#include "EJPNGDecoder.h"
+#include "EJPixelKernels.h"
+#include "lodepng.h"
+#include "NdkMisc.h"
+
+#define LOG_TAG "EJPNGDecoder"
+
+#include <dlfcn.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+namespace {
+
+// AImageDecoder is looked up at runtime, since the library runs on API levels that do not have it
+struct AImageDecoder;
+struct AImageDecoderHeaderInfo;
+
+const int kImageDecoderSuccess = 0;			// ANDROID_IMAGE_DECODER_SUCCESS
+const int32_t kBitmapFormatRGBA8888 = 1;	// ANDROID_BITMAP_FORMAT_RGBA_8888
+
+template <typename T> bool resolve (void *library, T &function, const char *name) {
+	function = (T)dlsym(library, name);
+	return function != NULL;
+}
+
+struct ImageDecoderApi {
+	int (*createFromBuffer) (const void*, size_t, AImageDecoder**);
+	void (*destroy) (AImageDecoder*);
+	int (*setAndroidBitmapFormat) (AImageDecoder*, int32_t);
+	int (*setUnpremultipliedRequired) (AImageDecoder*, bool);
+	const AImageDecoderHeaderInfo* (*getHeaderInfo) (const AImageDecoder*);
+	int32_t (*getWidth) (const AImageDecoderHeaderInfo*);
+	int32_t (*getHeight) (const AImageDecoderHeaderInfo*);
+	int (*decodeImage) (AImageDecoder*, void*, size_t, size_t);
+	bool available;
+
+	ImageDecoderApi() {
+		void *library = dlopen("libjnigraphics.so", RTLD_NOW);
+		available = library &&
+			resolve(library, createFromBuffer, "AImageDecoder_createFromBuffer") &&
+			resolve(library, destroy, "AImageDecoder_delete") &&
+			resolve(library, setAndroidBitmapFormat, "AImageDecoder_setAndroidBitmapFormat") &&
+			resolve(library, setUnpremultipliedRequired, "AImageDecoder_setUnpremultipliedRequired") &&
+			resolve(library, getHeaderInfo, "AImageDecoder_getHeaderInfo") &&
+			resolve(library, getWidth, "AImageDecoderHeaderInfo_getWidth") &&
+			resolve(library, getHeight, "AImageDecoderHeaderInfo_getHeight") &&
+			resolve(library, decodeImage, "AImageDecoder_decodeImage");
+		LOGI("Decoding pngs with %s", available ? "AImageDecoder" : "lodepng");
+	}
+};
+
+const ImageDecoderApi& imageDecoder() {
+	static ImageDecoderApi api;
+	return api;
+}
+
+bool isPNG (const unsigned char *data, size_t length) {
+	static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	return length >= sizeof(signature) && memcmp(data, signature, sizeof(signature)) == 0;
+}
+
+unsigned char* allocatePixels (unsigned width, unsigned height, unsigned bufferWidth, unsigned bufferHeight) {
+	const size_t bytes = (size_t)bufferWidth * bufferHeight * 4;
+	return (unsigned char*)(bufferWidth == width && bufferHeight == height ? malloc(bytes) : calloc(bytes, 1));
+}
+
+bool decodeWithPlatform (const unsigned char *data, size_t length, unsigned char **pixels, unsigned *width, unsigned *height,
+		EJPNGDecoder::Layout layout, void *layoutData, bool premultiply) {
+	const ImageDecoderApi &api = imageDecoder();
+	AImageDecoder *decoder = NULL;
+	if( !api.available || api.createFromBuffer(data, length, &decoder) != kImageDecoderSuccess ) {
+		return false;
+	}
+
+	bool ok = api.setAndroidBitmapFormat(decoder, kBitmapFormatRGBA8888) == kImageDecoderSuccess &&
+		api.setUnpremultipliedRequired(decoder, !premultiply) == kImageDecoderSuccess;
+	const AImageDecoderHeaderInfo *info = api.getHeaderInfo(decoder);
+	const unsigned w = (unsigned)api.getWidth(info), h = (unsigned)api.getHeight(info);
+	unsigned bufferWidth = w, bufferHeight = h;
+	if( layout ) { layout(w, h, &bufferWidth, &bufferHeight, layoutData); }
+
+	unsigned char *buffer = ok ? allocatePixels(w, h, bufferWidth, bufferHeight) : NULL;
+	ok = buffer && api.decodeImage(decoder, buffer, (size_t)bufferWidth * 4, (size_t)bufferWidth * bufferHeight * 4) == kImageDecoderSuccess;
+	api.destroy(decoder);
+
+	if( !ok ) {
+		free(buffer);
+		return false;
+	}
+	*pixels = buffer;
+	*width = w;
+	*height = h;
+	return true;
+}
+
+// lodepng makes no guess of the inflated size; the context is the size of the scanlines of a non-interlaced image
+unsigned inflateWithZlib (unsigned char **out, size_t *outsize, const unsigned char *in, size_t insize,
+		const LodePNGDecompressSettings *settings) {
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+	if( inflateInit(&stream) != Z_OK ) { return 83; }
+
+	size_t capacity = settings->custom_context ? *(const size_t*)settings->custom_context + 1 : insize * 4 + 64;
+	unsigned char *buffer = (unsigned char*)malloc(capacity);
+	stream.next_in = (Bytef*)in;
+	stream.avail_in = (uInt)insize;
+
+	int result = Z_OK;
+	while( buffer ) {
+		stream.next_out = buffer + stream.total_out;
+		stream.avail_out = (uInt)(capacity - stream.total_out);
+		result = inflate(&stream, Z_NO_FLUSH);
+		if( result != Z_OK || stream.avail_out > 0 ) { break; }
+
+		// interlaced images inflate to a bit more than the estimate
+		capacity *= 2;
+		unsigned char *grown = (unsigned char*)realloc(buffer, capacity);
+		if( !grown ) { free(buffer); }
+		buffer = grown;
+	}
+	const size_t size = stream.total_out;
+	inflateEnd(&stream);
+
+	if( !buffer ) { return 83; }
+	if( result != Z_STREAM_END ) {
+		free(buffer);
+		return result == Z_MEM_ERROR ? 83 : 52;
+	}
+	*out = buffer;
+	*outsize = size;
+	return 0;
+}
+
+unsigned decodeWithLodePNG (const unsigned char *data, size_t length, unsigned char **pixels, unsigned *width, unsigned *height,
+		EJPNGDecoder::Layout layout, void *layoutData, bool premultiply) {
+	LodePNGState state;
+	lodepng_state_init(&state);
+	state.info_raw.colortype = LCT_RGBA;
+	state.info_raw.bitdepth = 8;
+
+	unsigned w = 0, h = 0;
+	size_t scanlineBytes = 0;
+	unsigned error = lodepng_inspect(&w, &h, &state, data, length);
+	if( !error ) {
+		scanlineBytes = (size_t)h * (1 + ((size_t)w * lodepng_get_bpp(&state.info_png.color) + 7) / 8);
+		state.decoder.zlibsettings.custom_zlib = inflateWithZlib;
+		state.decoder.zlibsettings.custom_context = &scanlineBytes;
+	}
+
+	unsigned char *decoded = NULL;
+	if( !error ) {
+		error = lodepng_decode(&decoded, &w, &h, &state, data, length);
+	}
+	lodepng_state_cleanup(&state);
+	if( error ) {
+		free(decoded);
+		return error;
+	}
+
+	unsigned bufferWidth = w, bufferHeight = h;
+	if( layout ) { layout(w, h, &bufferWidth, &bufferHeight, layoutData); }
+	if( bufferWidth != w || bufferHeight != h ) {
+		// the padding is cleared by the copy, which premultiplies as well
+		unsigned char *buffer = (unsigned char*)malloc((size_t)bufferWidth * bufferHeight * 4);
+		if( !buffer ) {
+			free(decoded);
+			return 83;
+		}
+		EJCopyPixels(decoded, (int)w, (int)h, 4, buffer, (int)bufferWidth, (int)bufferHeight, premultiply);
+		free(decoded);
+		decoded = buffer;
+	}
+	else if( premultiply ) {
+		EJPremultiplyPixels(decoded, decoded, (size_t)w * h);
+	}
+	*pixels = decoded;
+	*width = w;
+	*height = h;
+	return 0;
+}
+
+}
+
+unsigned EJPNGDecoder::decode (const unsigned char *data, size_t length, unsigned char **pixels, unsigned *width, unsigned *height,
+		Layout layout, void *layoutData, bool premultiply) {
+	*pixels = NULL;
+	if( isPNG(data, length) && decodeWithPlatform(data, length, pixels, width, height, layout, layoutData, premultiply) ) {
+		return 0;
+	}
+	return decodeWithLodePNG(data, length, pixels, width, height, layout, layoutData, premultiply);
+}
+
+unsigned EJPNGDecoder::decodeFile (const char *path, unsigned char **pixels, unsigned *width, unsigned *height,
+		Layout layout, void *layoutData, bool premultiply) {
+	unsigned char *file = NULL;
+	size_t length = 0;
+	unsigned error = lodepng_load_file(&file, &length, path);
+	if( !error ) {
+		error = decode(file, length, pixels, width, height, layout, layoutData, premultiply);
+	}
+	else {
+		*pixels = NULL;
+	}
+	free(file);
+	return error;
+}
+
+const char* EJPNGDecoder::errorText (unsigned error) {
+	return lodepng_error_text(error);
+}
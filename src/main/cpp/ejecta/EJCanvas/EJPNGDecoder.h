@@ -0,0 +1,28 @@
+#ifndef __EJPNGDECODER_H
+#define __EJPNGDECODER_H	1
+
+#include <stddef.h>
+
+/**
+ * Decodes pngs into rgba pixels, premultiplied by their alpha if the caller asks for it
+ * From API 30 on the platform's AImageDecoder does that, whose inflate and unfiltering are vectorized, and writes the
+ * pixels straight into a buffer of the layout the caller asks for. Everywhere else, and for pngs it fails on, lodepng
+ * decodes them, inflating with the system zlib instead of its own; its pixels are premultiplied in the same pass that
+ * lays them out.
+ */
+class EJPNGDecoder {
+public:
+	// called with the size of the image before it is decoded; chooses the size of the buffer the pixels are decoded
+	// into, which is at least as large. pixels outside of the image are transparent
+	typedef void (*Layout) (unsigned width, unsigned height, unsigned *bufferWidth, unsigned *bufferHeight, void *data);
+
+	// malloc'd pixels of png data, rows of bufferWidth pixels without padding; returns 0 or an error code of lodepng
+	static unsigned decode (const unsigned char *data, size_t length, unsigned char **pixels, unsigned *width, unsigned *height,
+		Layout layout = NULL, void *layoutData = NULL, bool premultiply = false);
+	static unsigned decodeFile (const char *path, unsigned char **pixels, unsigned *width, unsigned *height,
+		Layout layout = NULL, void *layoutData = NULL, bool premultiply = false);
+
+	static const char* errorText (unsigned error);
+};
+
+#endif
@@ -1,6 +1,12 @@
 #include "stdlib.h"
 #include "EJPath.h"
 #include "EJCanvasContext.h"
+#include "EJGLBackend.h"
+#include "EJGLState.h"
+#include "EJTessellator.h"
+#include "EJPathIndex.h"
+#include "EJVertexTransform.h"
+#include "EJWorkerPool.h"
 #include "CGCompat.h"
 #include "stdlib.h"
 #include "NdkMisc.h"
@@ -8,62 +14,225 @@
 #include "mallocdebug.h"
 
 #include <stdlib.h>
+#include <algorithm>
+#include <climits>
+#include <string.h>
 #include <vector>
 
-EJPath::EJPath() {
+EJPath::EJPath() : EJPath(false) {
+}
+
+EJPath::EJPath (bool retainedp, EJFrameArena *arena) : points(arena), starts(arena), pathInfo(arena), corners(arena) {
+	retained = retainedp;
+	recording = retainedp;
+	flattenScale = 1;
 	transform = CGAffineTransformIdentity;
-	stencilMask = 0x1;
-	vertexBuffer = NULL;
-	vertexBufferLength = 0;
+	stencilMask = EJ_STENCIL_FILL_BIT;
+	meshValid = false;
+	index = NULL;
+	indexValid = false;
+	this->reset();
 }
 
 EJPath::~EJPath() {
-	if (vertexBuffer) {
-		free(vertexBuffer);
-	}
+	delete index;
+}
+
+void EJPath::leaveArena() {
+	points.leaveArena();
+	starts.leaveArena();
+	pathInfo.leaveArena();
+	corners.leaveArena();
+}
+
+EJSubPaths EJPath::getSubPaths (bool withOpen) const {
+	EJSubPaths subPaths = { points.data(), starts.data(), withOpen ? starts.size() : finishedCount(),
+		withOpen ? (uint32_t)points.size() : starts.back() };
+	return subPaths;
 }
 
 void EJPath::reset() {
 	longestSubPath = 0;
-	paths.clear();
-	currentPath.clear();
+	points.clear();
+	starts.clear();
+	starts.push_back(0);
+	pathInfo.clear();
+	meshValid = false;
+	indexValid = false;
+	if( recording ) {
+		commands.clear();
+	}
 
 	currentPos = EJVector2Make( 0, 0 );
 	startPos = EJVector2Make( 0, 0 );
 }
 
+void EJPath::record (EJPathCommandType type, float a0, float a1, float a2, float a3, float a4, float a5, bool antiClockwise) {
+	if( !recording ) { return; }
+	EJPathCommand command = { type, { a0, a1, a2, a3, a4, a5 }, antiClockwise };
+	commands.push_back(command);
+}
+
+void EJPath::replay (const std::vector<EJPathCommand> &recorded, float scale) {
+	for( std::vector<EJPathCommand>::const_iterator command = recorded.begin(); command != recorded.end(); ++command ) {
+		const float *a = command->args;
+		switch( command->type ) {
+			case kEJPathCommandMoveTo: this->moveToX(a[0], a[1]); break;
+			case kEJPathCommandLineTo: this->lineToX(a[0], a[1]); break;
+			case kEJPathCommandBezierCurveTo: this->bezierCurveToCpx1(a[0], a[1], a[2], a[3], a[4], a[5], scale); break;
+			case kEJPathCommandQuadraticCurveTo: this->quadraticCurveToCpx(a[0], a[1], a[2], a[3], scale); break;
+			case kEJPathCommandArc: this->arcX(a[0], a[1], a[2], a[3], a[4], command->antiClockwise); break;
+			case kEJPathCommandClose: this->close(); break;
+		}
+	}
+}
+
+void EJPath::addPath (const EJPath &other) {
+	this->replay(other.commands, flattenScale);
+}
+
+void EJPath::flattenForScale (float scale) {
+	// distanceTolerance keeps the flattened curves within a pixel at flattenScale; drawn at a larger scale,
+	// the error grows with it
+	if( !retained || scale <= 0 ) { return; }
+	const float ratio = scale / flattenScale;
+	if( ratio <= EJ_PATH_REFLATTEN_RATIO && ratio * 4 * EJ_PATH_REFLATTEN_RATIO >= 1 ) { return; }
+
+	std::vector<EJPathCommand> recorded;
+	recorded.swap(commands);
+
+	recording = false;
+	this->reset();
+	flattenScale = scale;
+	this->replay(recorded, scale);
+	recording = true;
+
+	commands.swap(recorded);
+}
+
 void EJPath::close() {
+	this->record(kEJPathCommandClose, 0, 0, 0, 0, 0, 0, false);
 	if( currentPos.x != startPos.x || currentPos.y != startPos.y ) {
-		currentPath.push_back(startPos);
+		points.push_back(startPos);
 		currentPos = startPos;
 	}
 	this->endSubPath();
 }
 
 void EJPath::endSubPath() {
-	if( currentPath.size() > 1 ) {
-		paths.push_back(currentPath);
-		if (longestSubPath < currentPath.size()) {
-			longestSubPath = currentPath.size();
+	const size_t size = this->openSize();
+	if( size > 1 ) {
+		pathInfo.push_back(this->analyzeSubPath(points.data() + starts.back(), size));
+		meshValid = false;
+		if (longestSubPath < size) {
+			longestSubPath = size;
 		}
 
-		currentPath.clear();
+		starts.push_back((uint32_t)points.size());
 		startPos = currentPos;
 	}
 }
 
+static inline bool EJPathPointsEqual (const EJVector2 &a, const EJVector2 &b) {
+	return fabsf(a.x - b.x) <= EJ_PATH_CONVEXITY_EPSILON && fabsf(a.y - b.y) <= EJ_PATH_CONVEXITY_EPSILON;
+}
+
+subpath_info_t EJPath::analyzeSubPath (const EJVector2 *path, size_t size) {
+	subpath_info_t info = { true, INFINITY, INFINITY, -INFINITY, -INFINITY };
+	for( const EJVector2 *vertex = path; vertex != path + size; ++vertex ) {
+		info.minX = MIN( info.minX, vertex->x );
+		info.minY = MIN( info.minY, vertex->y );
+		info.maxX = MAX( info.maxX, vertex->x );
+		info.maxY = MAX( info.maxY, vertex->y );
+	}
+
+	// distinct corners, without the point that closes the subpath; arcs rarely end exactly where they started
+	corners.clear();
+	for( const EJVector2 *vertex = path; vertex != path + size; ++vertex ) {
+		if( corners.empty() || !EJPathPointsEqual(*vertex, corners.back()) ) {
+			corners.push_back(*vertex);
+		}
+	}
+	while( corners.size() > 1 && EJPathPointsEqual(corners.back(), corners[0]) ) {
+		corners.pop_back();
+	}
+
+	// triangles and degenerate shapes are always convex
+	const size_t count = corners.size();
+	if( count < 4 ) { return info; }
+
+	// A polygon is convex if all its corners turn the same way and its edges change their direction
+	// along x and y at most twice each; the latter rules out self intersecting shapes like stars.
+	float lastDx = 0, lastDy = 0;
+	for( size_t i = count; i-- > 0 && (lastDx == 0 || lastDy == 0); ) {
+		const EJVector2 &from = corners[i], &to = corners[(i+1) % count];
+		if( lastDx == 0 && fabsf(to.x - from.x) > EJ_PATH_CONVEXITY_EPSILON ) { lastDx = to.x - from.x; }
+		if( lastDy == 0 && fabsf(to.y - from.y) > EJ_PATH_CONVEXITY_EPSILON ) { lastDy = to.y - from.y; }
+	}
+
+	float turn = 0;
+	int xFlips = 0, yFlips = 0;
+	EJVector2 edge = EJVector2Make(corners[0].x - corners[count-1].x, corners[0].y - corners[count-1].y);
+	for( size_t i = 0; i < count; i++ ) {
+		const EJVector2 &from = corners[i], &to = corners[(i+1) % count];
+		const EJVector2 next = EJVector2Make(to.x - from.x, to.y - from.y);
+
+		const float cross = edge.x * next.y - edge.y * next.x;
+		if( fabsf(cross) > EJ_PATH_COLLINEARITY_EPSILON ) {
+			if( turn * cross < 0 ) {
+				info.convex = false;
+				return info;
+			}
+			turn = cross;
+		}
+		edge = next;
+
+		// edges along an axis may be off by rounding errors; their direction does not count
+		if( fabsf(next.x) > EJ_PATH_CONVEXITY_EPSILON ) {
+			if( lastDx * next.x < 0 ) { xFlips++; }
+			lastDx = next.x;
+		}
+		if( fabsf(next.y) > EJ_PATH_CONVEXITY_EPSILON ) {
+			if( lastDy * next.y < 0 ) { yFlips++; }
+			lastDy = next.y;
+		}
+	}
+
+	info.convex = xFlips <= 2 && yFlips <= 2;
+	return info;
+}
+
+bool EJPath::canFillWithoutStencil() {
+	// with the even-odd stencil, overlapping subpaths cancel out each other; that only does not matter if none overlap
+	for( size_t i = 0; i < pathInfo.size(); i++ ) {
+		const subpath_info_t &a = pathInfo[i];
+		if( !a.convex ) { return false; }
+		for( size_t j = 0; j < i; j++ ) {
+			const subpath_info_t &b = pathInfo[j];
+			if( a.minX < b.maxX && b.minX < a.maxX && a.minY < b.maxY && b.minY < a.maxY ) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
 void EJPath::moveToX (float x, float y) {
+	this->record(kEJPathCommandMoveTo, x, y, 0, 0, 0, 0, false);
 	this->endSubPath();
 	currentPos = startPos = EJVector2ApplyTransform( EJVector2Make( x, y ), transform);
-	currentPath.push_back(currentPos);
+	points.push_back(currentPos);
 }
 
 void EJPath::lineToX (float x, float y) {
+	this->record(kEJPathCommandLineTo, x, y, 0, 0, 0, 0, false);
 	currentPos = EJVector2ApplyTransform( EJVector2Make(x, y), transform);
-	currentPath.push_back(currentPos);
+	points.push_back(currentPos);
 }
 
 void EJPath::bezierCurveToCpx1(float cpx1, float cpy1, float cpx2, float cpy2, float x, float y, float scale) {
+	this->record(kEJPathCommandBezierCurveTo, cpx1, cpy1, cpx2, cpy2, x, y, false);
+	if( retained ) { scale = flattenScale; }
 	distanceTolerance = EJ_PATH_DISTANCE_EPSILON / scale;
 	distanceTolerance *= distanceTolerance;
 
@@ -73,7 +242,7 @@ void EJPath::bezierCurveToCpx1(float cpx1, float cpy1, float cpx2, float cpy2, f
 
 	this->recursiveBezierX1(currentPos.x, currentPos.y, cp1.x, cp1.y, cp2.x, cp2.y, p.x, p.y, 0);
 	currentPos = p;
-	currentPath.push_back(currentPos);
+	points.push_back(currentPos);
 }
 
 void EJPath::recursiveBezierX1 (float x1, float y1, float x2, float y2, float x3, float y3, float x4, float y4, int level) {
@@ -107,7 +276,7 @@ void EJPath::recursiveBezierX1 (float x1, float y1, float x2, float y2, float x3
 			if((d2 + d3)*(d2 + d3) <= distanceTolerance * (dx*dx + dy*dy)) {
 				// If the curvature doesn't exceed the distance_tolerance value
 				// we tend to finish subdivisions.
-				currentPath.push_back(EJVector2Make(x1234, y1234));
+				points.push_back(EJVector2Make(x1234, y1234));
 				return;
 			}
 		}
@@ -115,14 +284,14 @@ void EJPath::recursiveBezierX1 (float x1, float y1, float x2, float y2, float x3
 			if( d2 > EJ_PATH_COLLINEARITY_EPSILON ) {
 				// p1,p3,p4 are collinear, p2 is considerable
 				if( d2 * d2 <= distanceTolerance * (dx*dx + dy*dy) ) {
-					currentPath.push_back(EJVector2Make(x1234, y1234));
+					points.push_back(EJVector2Make(x1234, y1234));
 					return;
 				}
 			}
 			else if( d3 > EJ_PATH_COLLINEARITY_EPSILON ) {
 				// p1,p2,p4 are collinear, p3 is considerable
 				if( d3 * d3 <= distanceTolerance * (dx*dx + dy*dy) ) {
-					currentPath.push_back(EJVector2Make(x1234, y1234));
+					points.push_back(EJVector2Make(x1234, y1234));
 					return;
 				}
 			}
@@ -131,7 +300,7 @@ void EJPath::recursiveBezierX1 (float x1, float y1, float x2, float y2, float x3
 				dx = x1234 - (x1 + x4) / 2;
 				dy = y1234 - (y1 + y4) / 2;
 				if( dx*dx + dy*dy <= distanceTolerance ) {
-					currentPath.push_back(EJVector2Make(x1234, y1234));
+					points.push_back(EJVector2Make(x1234, y1234));
 					return;
 				}
 			}
@@ -146,6 +315,8 @@ void EJPath::recursiveBezierX1 (float x1, float y1, float x2, float y2, float x3
 }
 
 void EJPath::quadraticCurveToCpx(float cpx, float cpy, float x, float y, float scale) {
+	this->record(kEJPathCommandQuadraticCurveTo, cpx, cpy, x, y, 0, 0, false);
+	if( retained ) { scale = flattenScale; }
 	distanceTolerance = EJ_PATH_DISTANCE_EPSILON / scale;
 	distanceTolerance *= distanceTolerance;
 
@@ -154,7 +325,7 @@ void EJPath::quadraticCurveToCpx(float cpx, float cpy, float x, float y, float s
 
 	this->recursiveQuadraticX1 (currentPos.x, currentPos.y, cp.x, cp.y, p.x, p.y, 0);
 	currentPos = p;
-	currentPath.push_back(currentPos);
+	points.push_back(currentPos);
 }
 
 void EJPath::recursiveQuadraticX1 (float x1, float y1, float x2, float y2, float x3, float y3, int level) {
@@ -175,7 +346,7 @@ void EJPath::recursiveQuadraticX1 (float x1, float y1, float x2, float y2, float
 	if( d > EJ_PATH_COLLINEARITY_EPSILON ) {
 		// Regular care
 		if( d * d <= distanceTolerance * (dx*dx + dy*dy) ) {
-			currentPath.push_back(EJVector2Make(x123, y123));
+			points.push_back(EJVector2Make(x123, y123));
 			return;
 		}
 	}
@@ -184,7 +355,7 @@ void EJPath::recursiveQuadraticX1 (float x1, float y1, float x2, float y2, float
 		dx = x123 - (x1 + x3) / 2;
 		dy = y123 - (y1 + y3) / 2;
 		if( dx*dx + dy*dy <= distanceTolerance ) {
-			currentPath.push_back(EJVector2Make(x123, y123));
+			points.push_back(EJVector2Make(x123, y123));
 			return;
 		}
 	}
@@ -197,6 +368,7 @@ void EJPath::recursiveQuadraticX1 (float x1, float y1, float x2, float y2, float
 }
 
 void EJPath::arcToX1(float x1, float y1, float x2, float y2, float radius) {
+	// not recorded by retained paths; the line or arc this turns into is
 
 	// Lifted from http://code.google.com/p/fxcanvas/
 	// I have no idea what this code is doing, but it seems to work.
@@ -235,7 +407,33 @@ void EJPath::arcToX1(float x1, float y1, float x2, float y2, float radius) {
 	}
 }
 
+// cosine and sine of EJ_PATH_MAX_STEPS_FOR_CIRCLE steps around the unit circle; coarser step counts take every nth
+static const EJVector2* EJPathUnitCircle() {
+	static const std::vector<EJVector2> points = [] {
+		std::vector<EJVector2> table(EJ_PATH_MAX_STEPS_FOR_CIRCLE);
+		for( int i = 0; i < EJ_PATH_MAX_STEPS_FOR_CIRCLE; i++ ) {
+			const double angle = 2 * M_PI * i / EJ_PATH_MAX_STEPS_FOR_CIRCLE;
+			table[i] = EJVector2Make( (float)cos(angle), (float)sin(angle) );
+		}
+		return table;
+	}();
+	return points.data();
+}
+
+// steps per circle of a circle drawn with a radius of projectedRadius pixels
+static int EJPathStepsForCircle (float projectedRadius) {
+	// the chords of n steps are at most r * (1 - cos(pi / n)) away from the circle
+	const EJVector2 *unitCircle = EJPathUnitCircle();
+	int steps = EJ_PATH_MIN_STEPS_FOR_CIRCLE;
+	while( steps < EJ_PATH_MAX_STEPS_FOR_CIRCLE &&
+			projectedRadius * (1 - unitCircle[EJ_PATH_MAX_STEPS_FOR_CIRCLE / (2 * steps)].x) > EJ_PATH_ARC_TOLERANCE ) {
+		steps *= 2;
+	}
+	return steps;
+}
+
 void EJPath::arcX(float x, float y, float radius, float startAngle, float endAngle, bool antiClockwise) {
+	this->record(kEJPathCommandArc, x, y, radius, startAngle, endAngle, 0, antiClockwise);
 	startAngle = fmodf(startAngle, 2 * M_PI);
     endAngle = fmodf(endAngle, 2 * M_PI);
 
@@ -250,40 +448,120 @@ void EJPath::arcX(float x, float y, float radius, float startAngle, float endAng
         ? (startAngle - endAngle) *-1
         : (endAngle - startAngle);
 
-	int steps = ceil(fabsf(span) * (EJ_PATH_STEPS_FOR_CIRCLE / (2 * M_PI)) );
-	float stepSize = span / (float)steps;
-
-	float angle = startAngle;
-	for( int i = 0; i <= steps; i++, angle += stepSize ) {
-		currentPos = EJVector2ApplyTransform( EJVector2Make( x + cosf(angle) * radius, y + sinf(angle) * radius ), transform);
-		currentPath.push_back( currentPos );
+	// points are rotated from the table of the step count, and the last one is at the end angle exactly
+	const float scale = retained ? flattenScale : CGAffineTransformGetMaxScale(transform);
+	const int circleSteps = EJPathStepsForCircle(fabsf(radius) * scale);
+	const int stride = EJ_PATH_MAX_STEPS_FOR_CIRCLE / circleSteps;
+	const int steps = MIN((int)ceilf(fabsf(span) * circleSteps / (2 * M_PI) - 0.01f), circleSteps);
+	const float direction = span < 0 ? -1 : 1;
+	const float startCos = cosf(startAngle), startSin = sinf(startAngle);
+
+	const EJVector2 *unitCircle = EJPathUnitCircle();
+	for( int i = 0; i < steps; i++ ) {
+		const EJVector2 unit = unitCircle[i * stride];
+		const float c = startCos * unit.x - direction * startSin * unit.y;
+		const float s = startSin * unit.x + direction * startCos * unit.y;
+		currentPos = EJVector2ApplyTransform( EJVector2Make( x + c * radius, y + s * radius ), transform);
+		points.push_back( currentPos );
 	}
+	currentPos = EJVector2ApplyTransform( EJVector2Make( x + cosf(endAngle) * radius, y + sinf(endAngle) * radius ), transform);
+	points.push_back( currentPos );
 }
 
-void EJPath::drawPolygonsToContext (EJCanvasContext *context) {
+void EJPath::drawPolygonsToContext (EJCanvasContext *context, EJFillRule fillRule, CGAffineTransform drawTransform) {
 	this->endSubPath();
-	if( longestSubPath < 3 && currentPath.size() < 3) { return; }
-
-	context->setTexture(NULL);
+	if( longestSubPath < 3 && this->openSize() < 3) { return; }
 
 	EJCanvasState * state = context->state;
-	EJColorRGBA color = state->fillColor;
-	color.rgba.a = (float)color.rgba.a * state->globalAlpha;
+	EJColorRGBA color = context->beginPaint(state->fillPaint, state->fillColor);
+
+	const bool transformed = !CGAffineTransformIsIdentity(drawTransform);
+	const int chunk = MIN(64, context->getVertexBufferSize() / 3);
+
+	// Convex subpaths that do not overlap each other are pushed as triangle fans, batched like any other draw.
+	// Both rules fill them the same way.
+	if( pathInfo.size() <= EJ_PATH_MAX_FAST_SUBPATHS && this->canFillWithoutStencil() ) {
+		const EJSubPaths subPaths = this->getSubPaths(false);
+		for( size_t sp = 0; sp < subPaths.count; sp++ ) {
+			const EJVector2 *path = subPaths.begin(sp);
+			const int size = (int)subPaths.size(sp);
+			const EJVector2 origin = transformed ? EJVector2ApplyTransform(path[0], drawTransform) : path[0];
+			for( int i = 1; i + 1 < size; ) {
+				const int triangles = MIN(chunk, size - 1 - i);
+				EJVertex * vb = context->pushVertices(triangles * 3);
+				for( int t = 0; t < triangles; t++, i++ ) {
+					EJVector2 p1 = path[i], p2 = path[i+1];
+					if( transformed ) {
+						p1 = EJVector2ApplyTransform(p1, drawTransform);
+						p2 = EJVector2ApplyTransform(p2, drawTransform);
+					}
+					vb[t*3+0] = (EJVertex) { origin, context->paintUV(origin), color };
+					vb[t*3+1] = (EJVertex) { p1, context->paintUV(p1), color };
+					vb[t*3+2] = (EJVertex) { p2, context->paintUV(p2), color };
+				}
+			}
+		}
+		context->endPaint();
+		return;
+	}
 
+	// Other paths are tessellated on the CPU; affine transforms keep the triangulation intact,
+	// so a retained path only has to be tessellated again when its points change.
+	const int pointCount = (int)starts.back();
+	if( pointCount <= EJ_PATH_TESSELLATION_LIMIT ) {
+		this->updateMesh(fillRule);
+
+		for( size_t i = 0; i < mesh.size(); ) {
+			const int count = MIN(chunk * 3, (int)(mesh.size() - i));
+			EJVertex * vb = context->pushVertices(count);
+			for( int v = 0; v < count; v++, i++ ) {
+				const EJVector2 p = transformed ? EJVector2ApplyTransform(mesh[i], drawTransform) : mesh[i];
+				vb[v] = (EJVertex) { p, context->paintUV(p), color };
+			}
+		}
+		context->endPaint();
+		return;
+	}
+
+	this->drawStencilToContext(context, color, drawTransform);
+	context->endPaint();
+}
+
+void EJPath::updateMesh (EJFillRule fillRule) {
+	if( !meshValid || meshFillRule != fillRule ) {
+		mesh.clear();
+		EJTessellator::tessellate(this->getSubPaths(false), fillRule, mesh);
+		meshValid = true;
+		meshFillRule = fillRule;
+	}
+}
+
+void EJPath::tessellate (EJFillRule fillRule, CGAffineTransform drawTransform, std::vector<EJVector2> &triangles) {
+	this->endSubPath();
+	this->updateMesh(fillRule);
 
-	// For potentially concave polygons (those with more than 3 unique vertices), we
-	// need to draw to the context twice: first to create a stencil mask, and then again
-	// to fill the created mask with the polygons color.
-	// TODO: add a fast path for polygons that only have 3 vertices
+	const bool transformed = !CGAffineTransformIsIdentity(drawTransform);
+	triangles.reserve(triangles.size() + mesh.size());
+	for( size_t i = 0; i < mesh.size(); i++ ) {
+		triangles.push_back(transformed ? EJVector2ApplyTransform(mesh[i], drawTransform) : mesh[i]);
+	}
+}
 
-	// Make sure the vertex buffer holds enough space for the longest subpath
-	const int size = currentPath.size();
-	if (vertexBufferLength < MAX(this->longestSubPath, size)) {
-		vertexBuffer = (EJVector2 *)realloc( vertexBuffer, sizeof(EJVector2) *  MAX(this->longestSubPath, size) );
-		vertexBufferLength =  MAX(longestSubPath, size);
+void EJPath::drawStencilToContext (EJCanvasContext *context, EJColorRGBA color, CGAffineTransform drawTransform) {
+	const bool transformed = !CGAffineTransformIsIdentity(drawTransform);
 
+	// Paths too large to tessellate are drawn to the context twice: first to create a stencil mask,
+	// and then again to fill the created mask with the polygons color.
+
+	// The vertex buffer holds the longest subpath; it is scratch of the frame, unless the arena is full
+	const int size = MAX(this->longestSubPath, (int)this->openSize());
+	EJVector2 *vertexBuffer = context->getFrameArena()->allocate<EJVector2>(size);
+	const bool vertexBufferOnHeap = !vertexBuffer;
+	if( vertexBufferOnHeap ) {
+		vertexBuffer = (EJVector2 *)malloc(sizeof(EJVector2) * size);
 	}
 
+	context->endShadow();
 	context->flushBuffers();
 	context->createStencilBufferOnce();
 	/*
@@ -294,54 +572,167 @@ void EJPath::drawPolygonsToContext (EJCanvasContext *context) {
 	// Enable drawing to the stencil buffer, disable drawing to the color buffer and
 	// draw the polygons to the stencil buffer as a triangle fan.
 
-	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
-	glDisableClientState(GL_COLOR_ARRAY);
-
-	glDisable(GL_BLEND);
-	glEnable(GL_STENCIL_TEST);
-	glStencilMask(0x01);
-	glStencilOp(GL_KEEP, GL_KEEP, GL_INVERT);
-	glStencilFunc(GL_ALWAYS, 0, ~0);
-	glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+	EJGLState::disable(GL_BLEND);
+	EJGLState::enable(GL_STENCIL_TEST);
+	EJGLState::stencilMask(EJ_STENCIL_FILL_BIT);
+	EJGLState::stencilOp(GL_KEEP, GL_KEEP, GL_INVERT);
+	EJGLState::stencilFunc(GL_ALWAYS, 0, ~0);
+	EJGLState::colorMask(false);
 
 	float minX = INFINITY, minY = INFINITY, maxX = -INFINITY, maxY = -INFINITY;
-	for( path_t::iterator sp = paths.begin(); sp != paths.end(); ++sp ) {
-		subpath_t &path = sp==paths.end()?currentPath:*sp;
+	const EJSubPaths subPaths = this->getSubPaths(false);
+	for( size_t sp = 0; sp < subPaths.count; sp++ ) {
+		const EJVector2 *path = subPaths.begin(sp);
+		const size_t pathSize = subPaths.size(sp);
 		int vertexIndex = 0;
-		for( subpath_t::iterator vertex = path.begin(); vertex != path.end(); ++vertex, ++vertexIndex ) {
-			minX = MIN( minX, vertex->x );
-			minY = MIN( minY, vertex->y );
-			maxX = MAX( maxX, vertex->x );
-			maxY = MAX( maxY, vertex->y );
-
-			vertexBuffer[vertexIndex] = *vertex;
+		for( const EJVector2 *vertex = path; vertex != path + pathSize; ++vertex, ++vertexIndex ) {
+			const EJVector2 v = transformed ? EJVector2ApplyTransform(*vertex, drawTransform) : *vertex;
+			minX = MIN( minX, v.x );
+			minY = MIN( minY, v.y );
+			maxX = MAX( maxX, v.x );
+			maxY = MAX( maxY, v.y );
+
+			vertexBuffer[vertexIndex] = v;
+		}
+		context->glBackend()->drawFan(vertexBuffer, vertexIndex);
+		if( context->frameStats ) {
+			context->frameStats->drawCalls++;
+			context->frameStats->vertices += vertexIndex;
 		}
-		glVertexPointer(2, GL_FLOAT, sizeof(EJVector2), vertexBuffer);
-		glDrawArrays(GL_TRIANGLE_FAN, 0, vertexIndex);
-
-		if(sp==paths.end()) break;
-
 	}
-	context->bindVertexBuffer();
+	if( context->frameStats ) { context->frameStats->stencilPasses++; }
+	if( vertexBufferOnHeap ) {
+		free(vertexBuffer);
+	}
 
 
 	// Disable drawing to the stencil buffer, enable drawing to the color buffer and push a rect
-	// with the correct size and color to the context.
+	// with the correct size and color to the context. Only pixels inside the clip are drawn,
+	// but the fill bit is cleared on all of them.
 
-	glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
-    glEnable(GL_BLEND);
-	glStencilFunc(GL_EQUAL, 0x01, 0x01);
-    glStencilOp(GL_ZERO, GL_ZERO, GL_ZERO);
+	EJGLState::colorMask(true);
+    EJGLState::enable(GL_BLEND);
+	EJGLState::stencilFunc(GL_EQUAL, EJ_STENCIL_FILL_BIT | context->state->clipDepth, EJ_STENCIL_FILL_BIT | EJ_STENCIL_CLIP_MASK);
+    EJGLState::stencilOp(GL_ZERO, GL_ZERO, GL_ZERO);
     context->pushRectX (minX, minY, maxX-minX, maxY-minY, 0, 0, 0, 0, color, CGAffineTransformIdentity);
 	// [context pushRectX:minX y:minY w:maxX-minX h:maxY-minY tx:0 ty:0 tw:0 th:0 color:color withTransform:CGAffineTransformIdentity];
     context->flushBuffers();
-	glDisable(GL_STENCIL_TEST);
+	context->applyClipStencil();
+}
+
+void EJPath::updateIndex() {
+	// points are only ever added until the path is reset, so the counts tell if the index is out of date
+	if( indexValid && indexedPaths == this->finishedCount() && indexedPoints == points.size() ) { return; }
+	if( !index ) { index = new EJPathIndex(); }
+	index->build(this->getSubPaths(true));
+	indexValid = true;
+	indexedPaths = this->finishedCount();
+	indexedPoints = points.size();
+}
+
+bool EJPath::containsPoint (EJVector2 point, EJFillRule fillRule) {
+	this->updateIndex();
+	return index->containsPoint(point, fillRule);
+}
+
+bool EJPath::strokeContainsPoint (EJVector2 point, float halfWidth) {
+	this->updateIndex();
+	return index->strokeContainsPoint(point, halfWidth);
 }
 
-void EJPath::drawArcToContext (EJCanvasContext *context, EJVector2 point, EJVector2 p1, EJVector2 p2, EJColorRGBA color) {
+// how a stroke is drawn, read from the state of the context before the subpaths are split across the workers
+typedef struct {
+	float width2, lineWidth, miterLimit;
+	float pxScale;						// pixels per unit of the line width, for the steps of round joins and caps
+	bool addCaps, addMiter;
+	EJLineCap lineCap;
+	EJLineJoin lineJoin;
+	CGAffineTransform inverseTransform, pushTransform;
+	EJColorRGBA color;
+} EJStrokeStyle;
+
+/*
+ * where the triangles of a stroke go: into the vertex buffer of the context, or, for subpaths stroked by the workers,
+ * into vertices that are pushed to the context in the order of the subpaths once all of them are done
+ * the vertices are the same either way; of the context only the paint is read, which does not change while stroking
+ */
+typedef struct EJStrokeSink {
+	EJCanvasContext *context;
+	std::vector<EJVertex> *vertices;
+
+	void pushTri (float x1, float y1, float x2, float y2, float x3, float y3, EJColorRGBA color, CGAffineTransform transform) {
+		if( !vertices ) {
+			context->pushTriX1(x1, y1, x2, y2, x3, y3, color, transform);
+			return;
+		}
+		float xs[4] = { x1, x2, x3, x3 };
+		float ys[4] = { y1, y2, y3, y3 };
+		if( !CGAffineTransformIsIdentity(transform) ) {
+			EJTransformPoints4(xs, ys, transform);
+		}
+		const bool paintActive = context->isPaintActive();
+		for( int i = 0; i < 3; i++ ) {
+			const EJVector2 pos = { xs[i], ys[i] };
+			const EJVector2 uv = paintActive ? context->paintUV(pos) : EJVector2Make(0.5, i == 1 ? 0.5 : 1);
+			vertices->push_back((EJVertex) { pos, uv, color });
+		}
+	}
+
+	void pushQuad (EJVector2 v1, EJVector2 v2, EJVector2 v3, EJVector2 v4, EJColorRGBA color, CGAffineTransform transform) {
+		const EJVector2 vecZero = { 0.0f, 0.0f };
+		if( !vertices ) {
+			context->pushQuadV1(v1, v2, v3, v4, vecZero, vecZero, vecZero, vecZero, color, transform);
+			return;
+		}
+		float xs[4] = { v1.x, v2.x, v3.x, v4.x };
+		float ys[4] = { v1.y, v2.y, v3.y, v4.y };
+		if( !CGAffineTransformIsIdentity(transform) ) {
+			EJTransformPoints4(xs, ys, transform);
+		}
+		EJVector2 uvs[4] = { vecZero, vecZero, vecZero, vecZero };
+		if( context->isPaintActive() ) {
+			for( int i = 0; i < 4; i++ ) {
+				uvs[i] = context->paintUV(EJVector2Make(xs[i], ys[i]));
+			}
+		}
+		const size_t first = vertices->size();
+		vertices->resize(first + 6);
+		EJWriteQuad(&(*vertices)[first], xs, ys, uvs, color);
+	}
+} EJStrokeSink;
 
+static EJStrokeStyle EJStrokeStyleOf (EJCanvasContext *context, EJColorRGBA color, CGAffineTransform inverseTransform, CGAffineTransform pushTransform) {
 	EJCanvasState * state = context->state;
-	float width2 = state->lineWidth/2;
+
+	// Find the width of the line as it is projected onto the screen.
+	float projectedLineWidth = CGAffineTransformGetScale( state->transform ) * state->lineWidth;
+
+	EJStrokeStyle style;
+	style.lineWidth = state->lineWidth;
+	style.width2 = state->lineWidth/2;
+	style.pxScale = CGAffineTransformGetScale(state->transform) * context->backingStoreRatio;
+	style.lineCap = state->lineCap;
+	style.lineJoin = state->lineJoin;
+
+	// Figure out if we need to add line caps and set the cap texture coord for square or round caps.
+	// For thin lines we disable texturing and line caps.
+	style.addCaps = (projectedLineWidth > 2 && (state->lineCap == kEJLineCapRound || state->lineCap == kEJLineCapSquare));
+
+	// The miter limit is the maximum allowed ratio of the miter length to half the line width.
+	// For thin lines we skip computing the miter completely.
+	style.addMiter = (projectedLineWidth >= 1 && state->lineJoin == kEJLineJoinMiter);
+	style.miterLimit = (state->miterLimit * style.width2);
+
+	style.inverseTransform = inverseTransform;
+	style.pushTransform = pushTransform;
+	style.color = color;
+	return style;
+}
+
+static void EJStrokeArc (const EJStrokeStyle &style, EJStrokeSink &sink, EJVector2 point, EJVector2 p1, EJVector2 p2) {
+	const float width2 = style.width2;
+	const EJColorRGBA color = style.color;
+	const CGAffineTransform pushTransform = style.pushTransform;
 
 	EJVector2
 		v1 = EJVector2Normalize(EJVector2Sub(p1, point)),
@@ -361,11 +752,10 @@ void EJPath::drawArcToContext (EJCanvasContext *context, EJVector2 point, EJVect
 	}
 
 	// 1 step per 5 pixel
-	float pxScale = CGAffineTransformGetScale(state->transform) * context->backingStoreRatio;
-	int numSteps = MAX( 1, (angle2 * width2 * pxScale) / 5.0f );
+	int numSteps = MAX( 1, (angle2 * width2 * style.pxScale) / 5.0f );
 
 	if(numSteps==1) {
-		context->pushTriX1 (p1.x, p1.y, point.x, point.y, p2.x, p2.y, color, transform);
+		sink.pushTri (p1.x, p1.y, point.x, point.y, p2.x, p2.y, color, pushTransform);
 		/* [context
 			pushTriX1:p1.x	y1:p1.y x2:point.x y2:point.y x3:p2.x y3:p2.y
 			color:color withTransform:transform]; */
@@ -388,7 +778,7 @@ void EJPath::drawArcToContext (EJCanvasContext *context, EJVector2 point, EJVect
 		angle += step;
 		arcP2 = EJVector2Make( point.x + cosf(angle) * width2, point.y - sinf(angle) * width2 );
 
-		context->pushTriX1 (arcP1.x, arcP1.y, point.x, point.y, arcP2.x, arcP2.y, color, transform);
+		sink.pushTri (arcP1.x, arcP1.y, point.x, point.y, arcP2.x, arcP2.y, color, pushTransform);
 		/* [context
 			pushTriX1:arcP1.x y1:arcP1.y x2:point.x y2:point.y x3:arcP2.x y3:arcP2.y
 			color:color withTransform:transform]; */
@@ -397,61 +787,136 @@ void EJPath::drawArcToContext (EJCanvasContext *context, EJVector2 point, EJVect
 	}
 }
 
-void EJPath::drawLinesToContext (EJCanvasContext *context) {
-	// this->endSubPath();
-
-	EJCanvasState * state = context->state;
-	EJVector2 vecZero = { 0.0f, 0.0f };
-
-	// Find the width of the line as it is projected onto the screen.
-	float projectedLineWidth = CGAffineTransformGetScale( state->transform ) * state->lineWidth;
-	context->setTexture(NULL);
-
-	// Figure out if we need to add line caps and set the cap texture coord for square or round caps.
-	// For thin lines we disable texturing and line caps.
-	float width2 = state->lineWidth/2;
-	bool addCaps = (projectedLineWidth > 2 && (state->lineCap == kEJLineCapRound || state->lineCap == kEJLineCapSquare));
-
-	// The miter limit is the maximum allowed ratio of the miter length to half the line width.
-	// For thin lines we skip computing the miter completely.
-	bool addMiter = (projectedLineWidth >= 1 && state->lineJoin == kEJLineJoinMiter);
-	float miterLimit = (state->miterLimit * width2);
-
-	EJColorRGBA color = state->strokeColor;
-	color.rgba.a = (float)color.rgba.a * state->globalAlpha;
-
-	// enable stencil test when drawing transparent lines
-	// cycle through the highest 7 bits, so that the stencil buffer only has to be cleared after seven stroke operations
-	// the lowest bit is reserved for drawPolygonsToContext
-	if(color.rgba.a < 0xff) {
-		stencilMask <<= 1;
-
-		context->flushBuffers();
-		context->createStencilBufferOnce();
+void EJPath::drawArcToContext (EJCanvasContext *context, EJVector2 point, EJVector2 p1, EJVector2 p2, EJColorRGBA color, CGAffineTransform pushTransform) {
+	EJStrokeSink sink = { context, NULL };
+	const EJStrokeStyle style = EJStrokeStyleOf(context, color, CGAffineTransformIdentity, pushTransform);
+	EJStrokeArc(style, sink, point, p1, p2);
+}
 
-		glEnable(GL_STENCIL_TEST);
+// the range of x a monotonic subpath covers
+typedef struct {
+	float minX, maxX;
+} EJHairlineRange;
 
-		glStencilMask(stencilMask);
+static bool EJHairlineRangeOrder (const EJHairlineRange &a, const EJHairlineRange &b) {
+	return a.minX < b.minX || (a.minX == b.minX && a.maxX < b.maxX);
+}
 
-		glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
-		glStencilFunc(GL_NOTEQUAL, stencilMask, stencilMask);
+bool EJPath::drawHairlinesToContext (EJCanvasContext *context, CGAffineTransform drawTransform, EJColorRGBA color, float pixelWidth, bool transparent) {
+	const bool transformed = !CGAffineTransformIsIdentity(drawTransform);
+	const float pixelScale = context->backingStoreRatio;
+
+	// subpaths whose x only ever grows or only ever shrinks, and whose ranges of x are apart, overlap only where
+	// their segments meet; every run of them within a column of pixels is drawn through its first, lowest,
+	// highest and last point, which looks the same for a line this thin
+	// the points, in the coordinates of the vertices, and where each subpath starts are scratch of the frame
+	EJFrameArena *arena = context->getFrameArena();
+	EJArenaVector<EJVector2> hairlinePoints(arena);
+	EJArenaVector<size_t> hairlineStarts(arena);
+	EJArenaVector<EJHairlineRange> ranges(arena);
+	bool monotonic = true;
+	const EJSubPaths subPaths = this->getSubPaths(true);
+	for( size_t sp = 0; sp < subPaths.count; sp++ ) {
+		const EJVector2 *path = subPaths.begin(sp);
+		const size_t pathSize = subPaths.size(sp);
+		if( pathSize > 1 ) {
+			const size_t start = hairlinePoints.size();
+			hairlineStarts.push_back(start);
+			EJVector2 first = transformed ? EJVector2ApplyTransform(path[0], drawTransform) : path[0];
+			EJVector2 last = transformed ? EJVector2ApplyTransform(path[1], drawTransform) : path[1];
+			const float direction = last.x - first.x;
+			bool pathMonotonic = direction != 0;
+
+			int column = INT_MIN;
+			size_t low = 0, high = 0;
+			for( size_t i = 0; i < pathSize; i++ ) {
+				const EJVector2 point = transformed ? EJVector2ApplyTransform(path[i], drawTransform) : path[i];
+				if( i > 0 && (point.x - last.x) * direction <= 0 ) { pathMonotonic = false; }
+				last = point;
+
+				const int pointColumn = (int)floorf(point.x * pixelScale);
+				if( pathMonotonic && pointColumn == column ) {
+					// the run so far is first, lowest, highest and last; the new point takes over the places it beats
+					EJVector2 &lowest = hairlinePoints[low], &highest = hairlinePoints[high];
+					if( point.y < lowest.y ) { lowest = point; }
+					if( point.y > highest.y ) { highest = point; }
+					hairlinePoints.back() = point;
+					continue;
+				}
+				column = pointColumn;
+				hairlinePoints.push_back(point);
+				hairlinePoints.push_back(point);
+				hairlinePoints.push_back(point);
+				hairlinePoints.push_back(point);
+				low = hairlinePoints.size() - 3;
+				high = hairlinePoints.size() - 2;
+			}
+			if( !pathMonotonic ) {
+				// the points of the subpath are drawn as they are
+				hairlinePoints.resize(start);
+				for( size_t i = 0; i < pathSize; i++ ) {
+					hairlinePoints.push_back(transformed ? EJVector2ApplyTransform(path[i], drawTransform) : path[i]);
+				}
+				monotonic = false;
+			}
+			const EJHairlineRange range = { MIN(first.x, last.x), MAX(first.x, last.x) };
+			ranges.push_back(range);
+		}
 	}
 
-	// To draw the line correctly with transformations, we need to construct the line
-	// vertices from the untransformed points and only apply the transformation in
-	// the last step (pushQuad) again.
-	CGAffineTransform inverseTransform = CGAffineTransformIsIdentity(transform)
-		? transform
-		: CGAffineTransformInvert(transform);
-
+	if( transparent ) {
+		if( !monotonic ) { return false; }
+		std::sort(ranges.data(), ranges.data() + ranges.size(), EJHairlineRangeOrder);
+		for( size_t i = 1; i < ranges.size(); i++ ) {
+			if( ranges[i].minX <= ranges[i-1].maxX ) { return false; }
+		}
+	}
+	hairlineStarts.push_back(hairlinePoints.size());
+
+	// lines thinner than a pixel are drawn a pixel wide and fainter; the quads reach half a pixel further, where
+	// the coverage of the ramp drops to zero
+	const float halfWidth = (MAX(pixelWidth, 1.0f) + 1) / 2;
+	color.rgba.a = (unsigned char)(color.rgba.a * MIN(1.0f, pixelWidth / halfWidth) + 0.5f);
+	const float extent = halfWidth / pixelScale;
+
+	float u0, u1, v;
+	context->setCoverageTexture(&u0, &u1, &v);
+	const EJVector2 uvs[4] = { { u0, v }, { u0, v }, { u1, v }, { u1, v } };
+
+	// a command per chunk keeps its bounds small enough to batch past other draws
+	const int chunk = MIN(64, context->getVertexBufferSize() / 6);
+	for( size_t sp = 0; sp + 1 < hairlineStarts.size(); sp++ ) {
+		const EJVector2 *points = &hairlinePoints[hairlineStarts[sp]];
+		int segments = (int)(hairlineStarts[sp + 1] - hairlineStarts[sp]) - 1;
+		while( segments > 0 ) {
+			const int count = MIN(segments, chunk);
+			EJVertex *vb = context->pushVertices(count * 6);
+			for( int i = 0; i < count; i++, points++, vb += 6 ) {
+				const EJVector2 a = points[0], b = points[1];
+				const float dx = b.x - a.x, dy = b.y - a.y;
+				const float length = sqrtf(dx * dx + dy * dy);
+				// repeated points make degenerate quads, which draw nothing
+				const float nx = length > 0 ? -dy / length * extent : 0, ny = length > 0 ? dx / length * extent : 0;
+				const float xs[4] = { a.x + nx, b.x + nx, a.x - nx, b.x - nx };
+				const float ys[4] = { a.y + ny, b.y + ny, a.y - ny, b.y - ny };
+				EJWriteQuad(vb, xs, ys, uvs, color);
+			}
+			segments -= count;
+		}
+	}
+	return true;
+}
 
+// strokes a subpath of two points or more; called on the workers for large strokes, so it may only touch what it is given
+static void EJStrokeSubPath (const EJStrokeStyle &style, const EJVector2 *path, size_t pathSize, EJStrokeSink &sink) {
 	// Oh god, I'm so sorry... This code sucks quite a bit. I'd be surprised if I
 	// will understand what I've written in 3 days :/
 	// Calculating line miters for potentially closed paths is serious business!
 	// And it doesn't even handle all the edge cases.
 
+	const EJVector2
+		*transCurrent, *transNext;	// Pointers to current and next vertices on the line
 	EJVector2
-		*transCurrent, *transNext,	// Pointers to current and next vertices on the line
 		current, next,				// Untransformed current and next points
 		firstMiter1, firstMiter2,	// First miter vertices (left, right) needed for closed paths
 		miter11, miter12,			// Current miter vertices (left, right)
@@ -459,241 +924,338 @@ void EJPath::drawLinesToContext (EJCanvasContext *context) {
 		currentEdge, currentExt,	// Current edge and its normal * width/2
 		nextEdge, nextExt;			// Next edge and its normal * width/2
 
-	for( path_t::iterator sp = paths.begin(); ; ++sp ) {
-		subpath_t &path = sp==paths.end() ? currentPath:*sp;
-		if(sp==paths.end()&&currentPath.size()<=1) break;
-
+	EJVector2
+		front = path[0],
+		back = path[pathSize-1];
 
-		EJVector2
-		front = path.front(),
-		back = path.back();
+	// If back and front are equal, this subpath is closed.
+	bool subPathIsClosed = (pathSize > 2 && front.x == back.x && front.y == back.y);
 
+	bool ignoreFirstSegment = style.addMiter && subPathIsClosed;
+	bool firstInSubPath = true;
+	bool miterLimitExceeded = NO, firstMiterLimitExceeded = NO;
 
-		// If back and front are equal, this subpath is closed.
-		bool subPathIsClosed = (path.size() > 2 && front.x == back.x && front.y == back.y);
+	transCurrent = transNext = NULL;
 
-		bool ignoreFirstSegment = addMiter && subPathIsClosed;
-		bool firstInSubPath = true;
-		bool miterLimitExceeded = NO, firstMiterLimitExceeded = NO;
+	// If this subpath is closed, initialize the first vertex for the loop ("next")
+	// to the last vertex in the subpath. This way, the miter between the last and
+	// the first segment will be computed and used to draw the first segment's first
+	// miter, as well as the last segment's last miter outside the loop.
+	if( style.addMiter && subPathIsClosed ) {
+		transNext = &path[pathSize-2];
+		next = EJVector2ApplyTransform( *transNext, style.inverseTransform );
+	}
 
-		transCurrent = transNext = NULL;
+	for( const EJVector2 *vertex = path; vertex != path + pathSize; ++vertex) {
+		transCurrent = transNext;
+		transNext = vertex;
+
+		current = next;
+		next = EJVector2ApplyTransform( *transNext, style.inverseTransform );
+
+		if( !transCurrent ) { continue; }
+
+		currentEdge	= nextEdge;
+		currentExt = nextExt;
+		nextEdge = EJVector2Normalize(EJVector2Sub(next, current));
+		nextExt = EJVector2Make( -nextEdge.y * style.width2, nextEdge.x * style.width2 );
+
+		if( firstInSubPath ) {
+			firstMiter1 = miter21 = EJVector2Add( current, nextExt );
+			firstMiter2 = miter22 = EJVector2Sub( current, nextExt );
+			firstInSubPath = false;
+
+			// Start cap
+			if( style.addCaps && !subPathIsClosed ) {
+				if( style.lineCap == kEJLineCapSquare ) {
+					EJVector2 capExt = { -nextExt.y, nextExt.x };
+					EJVector2 cap11 = EJVector2Add( miter21, capExt );
+					EJVector2 cap12 = EJVector2Add( miter22, capExt );
+
+					sink.pushQuad(cap11, cap12, miter21, miter22, style.color, style.pushTransform);
+					/* [context
+						 pushQuadV1:cap11 v2:cap12 v3:miter21 v4:miter22
+						 t1:vecZero t2:vecZero t3:vecZero t4:vecZero
+						 color:color withTransform:transform]; */
+				}
+				else {
+					EJStrokeArc(style, sink, current, miter22, miter21);
+					// [self drawArcToContext:context atPoint:current v1:miter22 v2:miter21 color:color];
+				}
+			}
 
-		// If this subpath is closed, initialize the first vertex for the loop ("next")
-		// to the last vertex in the subpath. This way, the miter between the last and
-		// the first segment will be computed and used to draw the first segment's first
-		// miter, as well as the last segment's last miter outside the loop.
-		if( addMiter && subPathIsClosed ) {
-			transNext = &path.at(path.size()-2);
-			next = EJVector2ApplyTransform( *transNext, inverseTransform );
+			continue;
 		}
 
-		for( subpath_t::iterator vertex = path.begin(); vertex != path.end(); ++vertex) {
-			transCurrent = transNext;
-			transNext = &(*vertex);
-
-			current = next;
-			next = EJVector2ApplyTransform( *transNext, inverseTransform );
 
-			if( !transCurrent ) { continue; }
+		miter11 = miter21;
+		miter12 = miter22;
 
-			currentEdge	= nextEdge;
-			currentExt = nextExt;
-			nextEdge = EJVector2Normalize(EJVector2Sub(next, current));
-			nextExt = EJVector2Make( -nextEdge.y * width2, nextEdge.x * width2 );
+		bool miterAdded = false;
+		if( style.addMiter ) {
+			EJVector2 miterEdge = EJVector2Add( currentEdge, nextEdge );
+			float miterExt = (1/EJVector2Dot(miterEdge, miterEdge)) * style.lineWidth;
 
-			if( firstInSubPath ) {
-				firstMiter1 = miter21 = EJVector2Add( current, nextExt );
-				firstMiter2 = miter22 = EJVector2Sub( current, nextExt );
-				firstInSubPath = false;
+			if( miterExt < style.miterLimit ) {
+				miterEdge.x *= miterExt;
+				miterEdge.y *= miterExt;
+				miter21 = EJVector2Make( current.x - miterEdge.y, current.y + miterEdge.x );
+				miter22 = EJVector2Make( current.x + miterEdge.y, current.y - miterEdge.x );
 
-				// Start cap
-				if( addCaps && !subPathIsClosed ) {
-					if( state->lineCap == kEJLineCapSquare ) {
-						EJVector2 capExt = { -nextExt.y, nextExt.x };
-						EJVector2 cap11 = EJVector2Add( miter21, capExt );
-						EJVector2 cap12 = EJVector2Add( miter22, capExt );
+				miterAdded = true;
+				miterLimitExceeded = NO;
+			}
+			else {
+				miterLimitExceeded = YES;
+			}
+		}
 
-						context->pushQuadV1 (cap11, cap12, miter21, miter22, vecZero, vecZero, vecZero, vecZero, color, transform);
-						/* [context
-							 pushQuadV1:cap11 v2:cap12 v3:miter21 v4:miter22
-							 t1:vecZero t2:vecZero t3:vecZero t4:vecZero
-							 color:color withTransform:transform]; */
-					}
-					else {
-						this->drawArcToContext (context, current, miter22, miter21, color);
-						// [self drawArcToContext:context atPoint:current v1:miter22 v2:miter21 color:color];
-					}
-				}
+		// No miter added? Calculate the butt for the current segment
+		if( !miterAdded ) {
+			miter21 = EJVector2Add(current, currentExt);
+			miter22 = EJVector2Sub(current, currentExt);
+		}
 
-				continue;
-			}
+		if( ignoreFirstSegment ) {
+			// True when starting from the back vertex of a closed path. This run was just
+			// to calculate the first miter.
+			firstMiter1 = miter21;
+			firstMiter2 = miter22;
+			firstMiterLimitExceeded = miterLimitExceeded;
+			ignoreFirstSegment = false;
+			continue;
+		}
 
+		if( !style.addMiter || miterLimitExceeded ) {
+			// previous point can be approximated, good enough for distance comparison
+			EJVector2 prev = EJVector2Sub(current, currentEdge);
+			EJVector2 p1, p2;
+			float d1, d2;
 
-			miter11 = miter21;
-			miter12 = miter22;
+			// calculate points to use for bevel
+			// two points are possible for each edge - the one farthest away from the other line has to be used
 
-			bool miterAdded = false;
-			if( addMiter ) {
-				EJVector2 miterEdge = EJVector2Add( currentEdge, nextEdge );
-				float miterExt = (1/EJVector2Dot(miterEdge, miterEdge)) * state->lineWidth;
+			// calculate point for current edge
+			d1 = EJDistanceToLineSegmentSquared(miter21, current, next);
+			d2 = EJDistanceToLineSegmentSquared(miter22, current, next);
+			p1 = ( d1 > d2 ) ? miter21 : miter22;
 
-				if( miterExt < miterLimit ) {
-					miterEdge.x *= miterExt;
-					miterEdge.y *= miterExt;
-					miter21 = EJVector2Make( current.x - miterEdge.y, current.y + miterEdge.x );
-					miter22 = EJVector2Make( current.x + miterEdge.y, current.y - miterEdge.x );
+			// calculate point for next edge
+			d1 = EJDistanceToLineSegmentSquared(EJVector2Add(current, nextExt), current, prev);
+			d2 = EJDistanceToLineSegmentSquared(EJVector2Sub(current, nextExt), current, prev);
+			p2 = ( d1 > d2 ) ? EJVector2Add(current, nextExt) : EJVector2Sub(current, nextExt);
 
-					miterAdded = true;
-					miterLimitExceeded = NO;
-				}
-				else {
-					miterLimitExceeded = YES;
-				}
+			if( style.lineJoin==kEJLineJoinRound ) {
+				EJStrokeArc(style, sink, current, p1, p2);
+				// [self drawArcToContext:context atPoint:current v1:p1 v2:p2 color:color];
 			}
-
-			// No miter added? Calculate the butt for the current segment
-			if( !miterAdded ) {
-				miter21 = EJVector2Add(current, currentExt);
-				miter22 = EJVector2Sub(current, currentExt);
+			else {
+				sink.pushTri(p1.x, p1.y, current.x, current.y, p2.x, p2.y, style.color, style.pushTransform);
+				/*[context
+				 pushTriX1:p1.x	y1:p1.y x2:current.x y2:current.y x3:p2.x y3:p2.y
+				 color:color withTransform:transform]; */
 			}
+		}
 
-			if( ignoreFirstSegment ) {
-				// True when starting from the back vertex of a closed path. This run was just
-				// to calculate the first miter.
-				firstMiter1 = miter21;
-				firstMiter2 = miter22;
-				firstMiterLimitExceeded = miterLimitExceeded;
-				ignoreFirstSegment = false;
-				continue;
-			}
+		sink.pushQuad(miter11, miter12, miter21, miter22, style.color, style.pushTransform);
+		/* [context
+			pushQuadV1:miter11 v2:miter12 v3:miter21 v4:miter22
+			t1:vecZero t2:vecZero t3:vecZero t4:vecZero
+			color:color withTransform:transform]; */
 
-			if( !addMiter || miterLimitExceeded ) {
-				// previous point can be approximated, good enough for distance comparison
-				EJVector2 prev = EJVector2Sub(current, currentEdge);
-				EJVector2 p1, p2;
-				float d1, d2;
+		// No miter added? The "miter" for the next segment needs to be the butt for the next segment,
+		// not the butt for the current one.
+		if( !miterAdded ) {
+			miter21 = EJVector2Add(current, nextExt);
+			miter22 = EJVector2Sub(current, nextExt);
+		}
+	} // for each vertex
 
-				// calculate points to use for bevel
-				// two points are possible for each edge - the one farthest away from the other line has to be used
 
-				// calculate point for current edge
-				d1 = EJDistanceToLineSegmentSquared(miter21, current, next);
-				d2 = EJDistanceToLineSegmentSquared(miter22, current, next);
-				p1 = ( d1 > d2 ) ? miter21 : miter22;
+	// The last segment, not handled in the loop
+	if( !firstMiterLimitExceeded && style.addMiter && subPathIsClosed ) {
+		miter11 = firstMiter1;
+		miter12 = firstMiter2;
+	}
+	else {
+		EJVector2 untransformedBack = EJVector2ApplyTransform(back, style.inverseTransform);
+		miter11 = EJVector2Add(untransformedBack, nextExt);
+		miter12 = EJVector2Sub(untransformedBack, nextExt);
+	}
 
-				// calculate point for next edge
-				d1 = EJDistanceToLineSegmentSquared(EJVector2Add(current, nextExt), current, prev);
-				d2 = EJDistanceToLineSegmentSquared(EJVector2Sub(current, nextExt), current, prev);
-				p2 = ( d1 > d2 ) ? EJVector2Add(current, nextExt) : EJVector2Sub(current, nextExt);
+	if( (!style.addMiter || firstMiterLimitExceeded) && subPathIsClosed ) {
+		float d1,d2;
+		EJVector2 p1,p2,
+		firstNormal = EJVector2Sub(firstMiter1,firstMiter2),							// unnormalized line normal for first edge
+		second		= EJVector2Add(next,EJVector2Make(firstNormal.y,-firstNormal.x));	// approximated second point
 
-				if( state->lineJoin==kEJLineJoinRound ) {
-					this->drawArcToContext(context, current, p1, p2, color);
-					// [self drawArcToContext:context atPoint:current v1:p1 v2:p2 color:color];
-				}
-				else {
-					context->pushTriX1(p1.x, p1.y, current.x, current.y, p2.x, p2.y, color, transform);
-					/*[context
-					 pushTriX1:p1.x	y1:p1.y x2:current.x y2:current.y x3:p2.x y3:p2.y
-					 color:color withTransform:transform]; */
-				}
-			}
+		// calculate points to use for bevel
+		// two points are possible for each edge - the one farthest away from the other line has to be used
+
+		// calculate point for current edge
+		d1 = EJDistanceToLineSegmentSquared(miter12, next, second);
+		d2 = EJDistanceToLineSegmentSquared(miter11, next, second);
+		p2 = (d1>d2)?miter12:miter11;
 
-			context->pushQuadV1 (miter11, miter12, miter21, miter22, vecZero, vecZero, vecZero, vecZero, color, transform);
+		// calculate point for next edge
+		d1 = EJDistanceToLineSegmentSquared(firstMiter1, current, next);
+		d2 = EJDistanceToLineSegmentSquared(firstMiter2, current, next);
+		p1 = (d1>d2)?firstMiter1:firstMiter2;
+
+		if( style.lineJoin==kEJLineJoinRound ) {
+			EJStrokeArc(style, sink, next, p1, p2);
+			// [self drawArcToContext:context atPoint:next v1:p1 v2:p2 color:color];
+		}
+		else {
+			sink.pushTri(p1.x, p1.y, next.x, next.y, p2.x, p2.y, style.color, style.pushTransform);
 			/* [context
-				pushQuadV1:miter11 v2:miter12 v3:miter21 v4:miter22
-				t1:vecZero t2:vecZero t3:vecZero t4:vecZero
-				color:color withTransform:transform]; */
+			 pushTriX1:p1.x	y1:p1.y x2:next.x y2:next.y x3:p2.x y3:p2.y
+			 color:color withTransform:transform]; */
+		}
+	}
 
-			// No miter added? The "miter" for the next segment needs to be the butt for the next segment,
-			// not the butt for the current one.
-			if( !miterAdded ) {
-				miter21 = EJVector2Add(current, nextExt);
-				miter22 = EJVector2Sub(current, nextExt);
-			}
-		} // for each subpath
+	sink.pushQuad(miter11, miter12, miter21, miter22, style.color, style.pushTransform);
+	/* [context
+		pushQuadV1:miter11 v2:miter12 v3:miter21 v4:miter22
+		t1:vecZero t2:vecZero t3:vecZero t4:vecZero
+		color:color withTransform:transform]; */
 
+	// End cap
+	if( style.addCaps && !subPathIsClosed ) {
+		if( style.lineCap == kEJLineCapSquare ) {
+			EJVector2 capExt = { nextExt.y, -nextExt.x };
+			EJVector2 cap11 = EJVector2Add( miter11, capExt );
+			EJVector2 cap12 = EJVector2Add( miter12, capExt );
 
-		// The last segment, not handled in the loop
-		if( !firstMiterLimitExceeded && addMiter && subPathIsClosed ) {
-			miter11 = firstMiter1;
-			miter12 = firstMiter2;
+			sink.pushQuad(cap11, cap12, miter11, miter12, style.color, style.pushTransform);
+			/* [context
+				pushQuadV1:cap11 v2:cap12 v3:miter11 v4:miter12
+				t1:vecZero t2:vecZero t3:vecZero t4:vecZero
+				color:color withTransform:transform]; */
 		}
 		else {
-			EJVector2 untransformedBack = EJVector2ApplyTransform(back, inverseTransform);
-			miter11 = EJVector2Add(untransformedBack, nextExt);
-			miter12 = EJVector2Sub(untransformedBack, nextExt);
+			EJStrokeArc(style, sink, next, miter11, miter12);
+			// [self drawArcToContext:context atPoint:next v1:miter11 v2:miter12 color:color];
 		}
+	}
+}
 
-		if( (!addMiter || firstMiterLimitExceeded) && subPathIsClosed ) {
-			float d1,d2;
-			EJVector2 p1,p2,
-			firstNormal = EJVector2Sub(firstMiter1,firstMiter2),							// unnormalized line normal for first edge
-			second		= EJVector2Add(next,EJVector2Make(firstNormal.y,-firstNormal.x));	// approximated second point
+// the subpaths of a stroke that is split across the workers, and the vertices of each of them
+typedef struct {
+	const EJStrokeStyle *style;
+	const EJSubPaths *subPaths;
+	EJCanvasContext *context;
+	std::vector< std::vector<EJVertex> > vertices;
+} EJStrokeJob;
+
+static void EJStrokeJobRun (int index, void *data) {
+	EJStrokeJob *job = (EJStrokeJob*)data;
+	std::vector<EJVertex> &vertices = job->vertices[index];
+	// a quad per segment, and as much again for joins
+	vertices.reserve(job->subPaths->size(index) * 12);
+	EJStrokeSink sink = { job->context, &vertices };
+	EJStrokeSubPath(*job->style, job->subPaths->begin(index), job->subPaths->size(index), sink);
+}
 
-			// calculate points to use for bevel
-			// two points are possible for each edge - the one farthest away from the other line has to be used
+void EJPath::drawLinesToContext (EJCanvasContext *context, CGAffineTransform drawTransform) {
+	// this->endSubPath();
 
-			// calculate point for current edge
-			d1 = EJDistanceToLineSegmentSquared(miter12, next, second);
-			d2 = EJDistanceToLineSegmentSquared(miter11, next, second);
-			p2 = (d1>d2)?miter12:miter11;
+	EJCanvasState * state = context->state;
 
-			// calculate point for next edge
-			d1 = EJDistanceToLineSegmentSquared(firstMiter1, current, next);
-			d2 = EJDistanceToLineSegmentSquared(firstMiter2, current, next);
-			p1 = (d1>d2)?firstMiter1:firstMiter2;
+	EJColorRGBA color = context->beginPaint(state->strokePaint, state->strokeColor);
+	const bool transparent = color.rgba.a < 0xff || (state->strokePaint && !state->strokePaint->isOpaque());
 
-			if( state->lineJoin==kEJLineJoinRound ) {
-				this->drawArcToContext (context, next, p1, p2, color);
-				// [self drawArcToContext:context atPoint:next v1:p1 v2:p2 color:color];
-			}
-			else {
-				context->pushTriX1 (p1.x, p1.y, next.x, next.y, p2.x, p2.y, color, transform);
-				/* [context
-				 pushTriX1:p1.x	y1:p1.y x2:next.x y2:next.y x3:p2.x y3:p2.y
-				 color:color withTransform:transform]; */
-			}
-		}
+	// charts are mostly hairlines, which do not need joins or caps and only need the stencil if they overlap themselves
+	const float pixelWidth = CGAffineTransformGetMaxScale( CGAffineTransformConcat(drawTransform, transform) ) * state->lineWidth * context->backingStoreRatio;
+	if( !state->strokePaint && pixelWidth <= EJ_PATH_HAIRLINE_WIDTH &&
+			this->drawHairlinesToContext(context, drawTransform, color, pixelWidth, transparent) ) {
+		context->endPaint();
+		return;
+	}
 
-		context->pushQuadV1 (miter11, miter12, miter21, miter22, vecZero, vecZero, vecZero, vecZero, color, transform);
-		/* [context
-			pushQuadV1:miter11 v2:miter12 v3:miter21 v4:miter22
-			t1:vecZero t2:vecZero t3:vecZero t4:vecZero
-			color:color withTransform:transform]; */
+	// enable stencil test when drawing transparent lines
+	// cycle through the highest 4 bits, so that the stencil buffer only has to be cleared after four stroke operations
+	// the lower bits are reserved for clips and drawPolygonsToContext
+	// a pixel is drawn once, if its bit is not set yet and it is inside the clip
+	if(transparent) {
+		stencilMask <<= 1;
 
-		// End cap
-		if( addCaps && !subPathIsClosed ) {
-			if( state->lineCap == kEJLineCapSquare ) {
-				EJVector2 capExt = { nextExt.y, -nextExt.x };
-				EJVector2 cap11 = EJVector2Add( miter11, capExt );
-				EJVector2 cap12 = EJVector2Add( miter12, capExt );
-
-				context->pushQuadV1 (cap11, cap12, miter11, miter12, vecZero, vecZero, vecZero, vecZero, color, transform);
-				/* [context
-					pushQuadV1:cap11 v2:cap12 v3:miter11 v4:miter12
-					t1:vecZero t2:vecZero t3:vecZero t4:vecZero
-					color:color withTransform:transform]; */
-			}
-			else {
-				this->drawArcToContext (context, next, miter11, miter12, color);
-				// [self drawArcToContext:context atPoint:next v1:miter11 v2:miter12 color:color];
+		context->endShadow();
+		context->flushBuffers();
+		context->createStencilBufferOnce();
+
+		EJGLState::enable(GL_STENCIL_TEST);
+
+		EJGLState::stencilMask(stencilMask);
+
+		EJGLState::stencilOp(GL_KEEP, GL_KEEP, GL_INVERT);
+		EJGLState::stencilFunc(GL_EQUAL, context->state->clipDepth, stencilMask | EJ_STENCIL_CLIP_MASK);
+		if( context->frameStats ) { context->frameStats->stencilPasses++; }
+	}
+
+	// To draw the line correctly with transformations, we need to construct the line
+	// vertices from the untransformed points and only apply the transformation in
+	// the last step (pushQuad) again.
+	CGAffineTransform inverseTransform = CGAffineTransformIsIdentity(transform)
+		? transform
+		: CGAffineTransformInvert(transform);
+	// retained paths are drawn with the transform of the context on top
+	CGAffineTransform pushTransform = CGAffineTransformIsIdentity(drawTransform)
+		? transform
+		: CGAffineTransformConcat(drawTransform, transform);
+	const EJStrokeStyle style = EJStrokeStyleOf(context, color, inverseTransform, pushTransform);
+
+	const EJSubPaths subPaths = this->getSubPaths(true);
+	// only the open subpath, which is the last one, can be a single point
+	size_t strokedCount = subPaths.count, strokedPoints = 0;
+	if( strokedCount && subPaths.size(strokedCount - 1) <= 1 ) { strokedCount--; }
+	for( size_t sp = 0; sp < strokedCount; sp++ ) {
+		strokedPoints += subPaths.size(sp);
+	}
+
+	EJWorkerPool *pool = EJWorkerPool::shared();
+	if( strokedCount > 1 && strokedPoints >= EJ_PATH_PARALLEL_STROKE_POINTS && pool->threadCount() > 0 ) {
+		// the subpaths do not share anything but the style, so the workers stroke them into vertices of their own,
+		// which go into the vertex buffer in the order of the subpaths, as if they had been pushed one by one
+		EJStrokeJob job = { &style, &subPaths, context, std::vector< std::vector<EJVertex> >(strokedCount) };
+		pool->run((int)strokedCount, EJStrokeJobRun, &job);
+
+		// a command per chunk keeps its bounds small enough to batch past other draws
+		const int chunk = MIN(64 * 6, context->getVertexBufferSize() / 6 * 6);
+		for( size_t sp = 0; sp < strokedCount; sp++ ) {
+			const std::vector<EJVertex> &vertices = job.vertices[sp];
+			for( size_t first = 0; first < vertices.size(); first += chunk ) {
+				const int count = (int)MIN((size_t)chunk, vertices.size() - first);
+				memcpy(context->pushVertices(count), &vertices[first], count * sizeof(EJVertex));
 			}
 		}
-		if(sp==paths.end()) break;
-	} // for each path
+	}
+	else {
+		EJStrokeSink sink = { context, NULL };
+		for( size_t sp = 0; sp < strokedCount; sp++ ) {
+			EJStrokeSubPath(style, subPaths.begin(sp), subPaths.size(sp), sink);
+		}
+	}
 
 	// disable stencil test when drawing transparent lines
-	if(color.rgba.a<0xff) {
+	if(transparent) {
 		context->flushBuffers();
-		glDisable(GL_STENCIL_TEST);
 
-		if(stencilMask == (1<<7)) {
-			stencilMask = (1<<0);
+		if(stencilMask == EJ_STENCIL_STROKE_LAST) {
+			stencilMask = EJ_STENCIL_FILL_BIT;
 
-			glStencilMask(0xff);
+			// the bits may have been set under a scissor that is not there any more; the others stay as they are
+			const bool scissored = EJGLState::isEnabled(GL_SCISSOR_TEST);
+			EJGLState::disable(GL_SCISSOR_TEST);
+			EJGLState::stencilMask(EJ_STENCIL_STROKE_MASK);
 			glClearStencil(0x0);
 			glClear(GL_STENCIL_BUFFER_BIT);
+			if(scissored) {
+				EJGLState::enable(GL_SCISSOR_TEST);
+			}
 		}
+		context->applyClipStencil();
 	}
+	context->endPaint();
 }
 
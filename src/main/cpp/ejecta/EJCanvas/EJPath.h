@@ -5,27 +5,86 @@
 #include "EJCanvasTypes.h"
 #include "CGCompat.h"
 #include "GLcompat.h"
+#include "EJFrameArena.h"
 #include <cmath>
 #include <cfloat>
+#include <stdint.h>
 
 #include <vector>
 
 #define EJ_PATH_RECURSION_LIMIT 8
 #define EJ_PATH_DISTANCE_EPSILON 1.0f
 #define EJ_PATH_COLLINEARITY_EPSILON FLT_EPSILON
-#define EJ_PATH_STEPS_FOR_CIRCLE 48.0f
+// arcs are flattened with a power of two of steps per circle in this range, as few as keep them within the tolerance
+#define EJ_PATH_MIN_STEPS_FOR_CIRCLE 8
+#define EJ_PATH_MAX_STEPS_FOR_CIRCLE 512
+#define EJ_PATH_ARC_TOLERANCE 0.25f
+#define EJ_PATH_MAX_FAST_SUBPATHS 16
+#define EJ_PATH_CONVEXITY_EPSILON 0.001f
+#define EJ_PATH_TESSELLATION_LIMIT 8192
+// strokes at most this many pixels wide are drawn as antialiased hairlines
+#define EJ_PATH_HAIRLINE_WIDTH 1.5f
+// strokes of several subpaths with at least this many points in all are split across the worker pool
+#define EJ_PATH_PARALLEL_STROKE_POINTS 16384
+// retained paths are flattened again once they are drawn this much larger, or four times this much smaller
+#define EJ_PATH_REFLATTEN_RATIO 1.5f
+
+typedef enum {
+	kEJFillRuleNonZero,
+	kEJFillRuleEvenOdd
+} EJFillRule;
 
 class EJCanvasContext;
+class EJPathIndex;
+
+typedef enum {
+	kEJPathCommandMoveTo,
+	kEJPathCommandLineTo,
+	kEJPathCommandBezierCurveTo,
+	kEJPathCommandQuadraticCurveTo,
+	kEJPathCommandArc,
+	kEJPathCommandClose
+} EJPathCommandType;
+
+// a call that built a retained path, with its arguments in the order of the call
+typedef struct {
+	EJPathCommandType type;
+	float args[6];
+	bool antiClockwise;
+} EJPathCommand;
+
+// subpaths as ranges of one flat array of points; each ends where the next starts, the last one at end
+struct EJSubPaths {
+	const EJVector2 *points;
+	const uint32_t *starts;
+	size_t count;
+	uint32_t end;
+
+	const EJVector2* begin (size_t i) const { return points + starts[i]; }
+	size_t size (size_t i) const { return (i + 1 < count ? starts[i + 1] : end) - starts[i]; }
+};
 
-// We're using the C++ std::vector here to store our points. Boxing and unboxing
-// so many EJVectors to NSValue types seemed wasteful.
-typedef std::vector<EJVector2> subpath_t;
-typedef std::vector<subpath_t> path_t;
+// what is known about a finished subpath, so fills can skip the stencil
+typedef struct {
+	bool convex;
+	float minX, minY, maxX, maxY;
+} subpath_info_t;
 
 class EJPath {
 public:
 	EJPath();
+	/*
+	 * retained paths record how they were built, so they can be flattened again for a different scale
+	 * the points of a path with an arena are kept in it; leaveArena has to be called before the arena is reset
+	 */
+	EJPath (bool retained, EJFrameArena *arena = NULL);
 	~EJPath();
+	// moves the points out of the arena, so the path stays as it is after the arena was reset
+	void leaveArena();
+	// appends the subpaths of a retained path
+	void addPath (const EJPath &other);
+	// flattens the curves of a retained path again, if they are too coarse or needlessly fine for scale
+	void flattenForScale (float scale);
 	void reset();
 	void close();
 	void endSubPath();
@@ -38,9 +97,23 @@ public:
 	void arcToX1 (float x1, float y1, float x2, float y2, float radius);
 	void arcX (float x, float y, float radius, float startAngle, float endAngle, bool antiClockwise);
 
-	void drawPolygonsToContext (EJCanvasContext *context);
-	void drawArcToContext (EJCanvasContext *context, EJVector2 point, EJVector2 p1, EJVector2 p2, EJColorRGBA color);
-	void drawLinesToContext (EJCanvasContext *context);
+	/**
+	 * fills the path, with drawTransform applied on top of the transform the points were added with
+	 * paths that are drawn again unchanged reuse their tessellation, so retained paths only pay for it once;
+	 * paths too large to tessellate fall back to the stencil buffer, which always fills even-odd
+	 */
+	void drawPolygonsToContext (EJCanvasContext *context, EJFillRule fillRule, CGAffineTransform drawTransform);
+	// appends triangles that cover the path under the fill rule, with drawTransform applied; for clips, whatever the size
+	void tessellate (EJFillRule fillRule, CGAffineTransform drawTransform, std::vector<EJVector2> &triangles);
+	void drawArcToContext (EJCanvasContext *context, EJVector2 point, EJVector2 p1, EJVector2 p2, EJColorRGBA color, CGAffineTransform pushTransform);
+	// strokes the path, with drawTransform applied on top of the transform the points were added with
+	void drawLinesToContext (EJCanvasContext *context, CGAffineTransform drawTransform);
+	/**
+	 * hit tests in the coordinates of the points, with open subpaths closed for fills
+	 * the first test after the path changed indexes its edges, so repeated tests of a path that stays are cheap
+	 */
+	bool containsPoint (EJVector2 point, EJFillRule fillRule);
+	bool strokeContainsPoint (EJVector2 point, float halfWidth);
 
 	CGAffineTransform transform;
 private:
@@ -49,15 +122,46 @@ private:
 	int longestSubPath;
 	GLubyte stencilMask;
 
-	EJVector2 *vertexBuffer;
-	int vertexBufferLength;
-
 	float distanceTolerance;
 
-	subpath_t currentPath;
-	path_t paths;
+	// the points of all finished subpaths, then those of the open one; where every subpath starts, the open one last
+	EJArenaVector<EJVector2> points;
+	EJArenaVector<uint32_t> starts;
+	EJArenaVector<subpath_info_t> pathInfo;	// one entry per finished subpath
+	EJArenaVector<EJVector2> corners;		// scratch of analyzeSubPath
+
+	bool retained;
+	bool recording;				// false while the commands of a retained path are replayed
+	float flattenScale;			// scale the curves of a retained path were flattened for
+	std::vector<EJPathCommand> commands;
+
+	// grid over the edges for hit tests, of the subpaths and points there were when it was built; null until the first
+	EJPathIndex *index;
+	bool indexValid;
+	size_t indexedPaths, indexedPoints;
+
+	// triangles of the last tessellation, valid until the path changes
+	std::vector<EJVector2> mesh;
+	bool meshValid;
+	EJFillRule meshFillRule;
 
 	// methods
+	size_t finishedCount() const { return starts.size() - 1; }
+	size_t openSize() const { return points.size() - starts.back(); }
+	// the finished subpaths, and the open one last if withOpen is set
+	EJSubPaths getSubPaths (bool withOpen) const;
+	void record (EJPathCommandType type, float a0, float a1, float a2, float a3, float a4, float a5, bool antiClockwise);
+	void replay (const std::vector<EJPathCommand> &recorded, float scale);
+	subpath_info_t analyzeSubPath (const EJVector2 *path, size_t size);
+	bool canFillWithoutStencil();
+	void updateMesh (EJFillRule fillRule);
+	void updateIndex();
+	void drawStencilToContext (EJCanvasContext *context, EJColorRGBA color, CGAffineTransform drawTransform);
+	/*
+	 * strokes a line of pixelWidth pixels or less with a quad of coverage per segment, without joins, caps or stencil
+	 * returns false without drawing for transparent strokes that can overlap themselves; those need the stencil
+	 */
+	bool drawHairlinesToContext (EJCanvasContext *context, CGAffineTransform drawTransform, EJColorRGBA color, float pixelWidth, bool transparent);
 
 };
 
@@ -0,0 +1,114 @@
+#include "EJPathIndex.h"
+#include "NdkMisc.h"
+
+#include <algorithm>
+
+void EJPathIndex::addSubPath (const EJVector2 *path, size_t size) {
+	if( size < 2 ) { return; }
+	for( size_t i = 0; i < size; i++ ) {
+		const bool closing = i + 1 == size;
+		const EJPathEdge edge = { path[i], path[closing ? 0 : i + 1], closing };
+		// zero length edges never cross a ray, and closed subpaths already end where they start
+		if( closing && edge.a.x == edge.b.x && edge.a.y == edge.b.y ) { continue; }
+		edges.push_back(edge);
+
+		minX = MIN(minX, path[i].x);
+		minY = MIN(minY, path[i].y);
+		maxX = MAX(maxX, path[i].x);
+		maxY = MAX(maxY, path[i].y);
+	}
+}
+
+int EJPathIndex::columnOf (float x) const {
+	return std::max(0, std::min(columns - 1, (int)((x - minX) / cellWidth)));
+}
+
+int EJPathIndex::rowOf (float y) const {
+	return std::max(0, std::min(rows - 1, (int)((y - minY) / cellHeight)));
+}
+
+void EJPathIndex::build (const EJSubPaths &paths) {
+	edges.clear();
+	minX = minY = INFINITY;
+	maxX = maxY = -INFINITY;
+	for( size_t sp = 0; sp < paths.count; sp++ ) {
+		this->addSubPath(paths.begin(sp), paths.size(sp));
+	}
+
+	// as many cells as rows and columns, whatever the aspect of the bounds; charts are indexed along their whole width
+	const int side = std::min(EJ_PATH_INDEX_MAX_CELLS,
+		std::max(1, (int)ceilf(sqrtf(edges.size() / (float)EJ_PATH_INDEX_EDGES_PER_CELL))));
+	columns = rows = side;
+	cellWidth = edges.empty() ? 1 : std::max((maxX - minX) / columns, FLT_MIN);
+	cellHeight = edges.empty() ? 1 : std::max((maxY - minY) / rows, FLT_MIN);
+
+	// count the edges of each cell, then fill them in behind the offsets that come of the counts
+	cellStarts.assign(columns * rows + 1, 0);
+	std::vector<int> next;
+	for( int pass = 0; pass < 2; pass++ ) {
+		if( pass == 1 ) {
+			for( size_t i = 1; i < cellStarts.size(); i++ ) { cellStarts[i] += cellStarts[i - 1]; }
+			cellEdges.resize(cellStarts.back());
+			next.assign(cellStarts.begin(), cellStarts.end() - 1);
+		}
+		for( size_t e = 0; e < edges.size(); e++ ) {
+			const EJPathEdge &edge = edges[e];
+			const int c0 = columnOf(MIN(edge.a.x, edge.b.x)), c1 = columnOf(MAX(edge.a.x, edge.b.x));
+			const int r0 = rowOf(MIN(edge.a.y, edge.b.y)), r1 = rowOf(MAX(edge.a.y, edge.b.y));
+			for( int r = r0; r <= r1; r++ ) {
+				for( int c = c0; c <= c1; c++ ) {
+					if( pass == 0 ) { cellStarts[r * columns + c + 1]++; }
+					else { cellEdges[next[r * columns + c]++] = (int)e; }
+				}
+			}
+		}
+	}
+}
+
+bool EJPathIndex::containsPoint (EJVector2 point, EJFillRule fillRule) const {
+	if( edges.empty() || point.x > maxX || point.y < minY || point.y > maxY ) { return false; }
+
+	int winding = 0;
+	const int row = rowOf(point.y);
+	for( int c = columnOf(point.x); c < columns; c++ ) {
+		const int cell = row * columns + c;
+		for( int i = cellStarts[cell]; i < cellStarts[cell + 1]; i++ ) {
+			const EJPathEdge &edge = edges[cellEdges[i]];
+			// half open in y, so a ray through a vertex crosses only one of its edges
+			if( (edge.a.y <= point.y) == (edge.b.y <= point.y) ) { continue; }
+			const float t = (point.y - edge.a.y) / (edge.b.y - edge.a.y);
+			const float x = std::max(MIN(edge.a.x, edge.b.x), std::min(MAX(edge.a.x, edge.b.x), edge.a.x + t * (edge.b.x - edge.a.x)));
+			// edges that span several cells are counted in the one they cross the ray in
+			if( x <= point.x || columnOf(x) != c ) { continue; }
+			winding += edge.a.y < edge.b.y ? 1 : -1;
+		}
+	}
+	return fillRule == kEJFillRuleEvenOdd ? (winding & 1) != 0 : winding != 0;
+}
+
+bool EJPathIndex::strokeContainsPoint (EJVector2 point, float halfWidth) const {
+	if( edges.empty() || point.x < minX - halfWidth || point.x > maxX + halfWidth ||
+			point.y < minY - halfWidth || point.y > maxY + halfWidth ) {
+		return false;
+	}
+
+	const int c0 = columnOf(point.x - halfWidth), c1 = columnOf(point.x + halfWidth);
+	const int r0 = rowOf(point.y - halfWidth), r1 = rowOf(point.y + halfWidth);
+	for( int r = r0; r <= r1; r++ ) {
+		for( int c = c0; c <= c1; c++ ) {
+			const int cell = r * columns + c;
+			for( int i = cellStarts[cell]; i < cellStarts[cell + 1]; i++ ) {
+				const EJPathEdge &edge = edges[cellEdges[i]];
+				if( edge.closing ) { continue; }
+				const float dx = edge.b.x - edge.a.x, dy = edge.b.y - edge.a.y;
+				const float length2 = dx * dx + dy * dy;
+				const float t = length2 > 0
+					? std::max(0.0f, std::min(1.0f, ((point.x - edge.a.x) * dx + (point.y - edge.a.y) * dy) / length2))
+					: 0;
+				const float ex = edge.a.x + t * dx - point.x, ey = edge.a.y + t * dy - point.y;
+				if( ex * ex + ey * ey <= halfWidth * halfWidth ) { return true; }
+			}
+		}
+	}
+	return false;
+}
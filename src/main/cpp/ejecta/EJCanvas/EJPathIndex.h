@@ -0,0 +1,44 @@
+#ifndef __EJPATHINDEX_H
+#define __EJPATHINDEX_H	1
+
+#include "EJPath.h"
+
+#include <vector>
+
+// the grid of an index gets about this many edges per cell, and at most this many cells along each side
+#define EJ_PATH_INDEX_EDGES_PER_CELL 4
+#define EJ_PATH_INDEX_MAX_CELLS 64
+
+// a segment of a subpath; the closing edge from the last point back to the first only counts for fills
+typedef struct {
+	EJVector2 a, b;
+	bool closing;
+} EJPathEdge;
+
+/**
+ * Uniform grid over the edges of a path, for hit tests that do not visit every edge
+ * Every edge is listed in each cell its bounds overlap. A point is inside the path if the edges that cross the ray
+ * from it to the right wind around it, so a fill test only looks at the cells of its row right of the point, and
+ * counts an edge in the cell it crosses the ray in. A stroke test only looks at the cells within half the line width.
+ */
+class EJPathIndex {
+public:
+	// indexes the subpaths that have more than one point
+	void build (const EJSubPaths &paths);
+	bool containsPoint (EJVector2 point, EJFillRule fillRule) const;
+	// whether point is within halfWidth of a segment; joins and caps are not looked at, so ends count as round
+	bool strokeContainsPoint (EJVector2 point, float halfWidth) const;
+private:
+	std::vector<EJPathEdge> edges;
+	std::vector<int> cellStarts;	// offsets into cellEdges, a row after another, with the end of the last cell last
+	std::vector<int> cellEdges;
+	float minX, minY, maxX, maxY;
+	float cellWidth, cellHeight;
+	int columns, rows;
+
+	void addSubPath (const EJVector2 *path, size_t size);
+	int columnOf (float x) const;
+	int rowOf (float y) const;
+};
+
+#endif
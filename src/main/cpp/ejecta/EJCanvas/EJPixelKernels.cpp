@@ -0,0 +1,84 @@
+#include "EJPixelKernels.h"
+
+#include <string.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define EJ_PIXEL_KERNELS_NEON	1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define EJ_PIXEL_KERNELS_SSE	1
+#endif
+
+#if defined(EJ_PIXEL_KERNELS_NEON)
+static inline uint8x8_t premultiply8 (uint8x8_t c, uint8x8_t a) {
+	const uint16x8_t x = vaddq_u16(vmull_u8(c, a), vdupq_n_u16(128));
+	return vaddhn_u16(x, vshrq_n_u16(x, 8));
+}
+
+static inline uint8x16_t premultiply16 (uint8x16_t c, uint8x16_t a) {
+	return vcombine_u8(premultiply8(vget_low_u8(c), vget_low_u8(a)), premultiply8(vget_high_u8(c), vget_high_u8(a)));
+}
+#elif defined(EJ_PIXEL_KERNELS_SSE)
+// two pixels widened to 16 bit channels
+static inline __m128i premultiply2 (__m128i pixels) {
+	// every channel is multiplied by the alpha of its pixel, alpha itself by 255
+	const __m128i alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+	__m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+	a = _mm_or_si128(_mm_andnot_si128(alphaMask, a), _mm_and_si128(alphaMask, _mm_set1_epi16(255)));
+	const __m128i x = _mm_add_epi16(_mm_mullo_epi16(pixels, a), _mm_set1_epi16(128));
+	return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+#endif
+
+void EJPremultiplyPixels (const GLubyte *src, GLubyte *dst, size_t count) {
+	size_t i = 0;
+#if defined(EJ_PIXEL_KERNELS_NEON)
+	for( ; i + 16 <= count; i += 16 ) {
+		uint8x16x4_t p = vld4q_u8(src + i * 4);
+		p.val[0] = premultiply16(p.val[0], p.val[3]);
+		p.val[1] = premultiply16(p.val[1], p.val[3]);
+		p.val[2] = premultiply16(p.val[2], p.val[3]);
+		vst4q_u8(dst + i * 4, p);
+	}
+#elif defined(EJ_PIXEL_KERNELS_SSE)
+	const __m128i zero = _mm_setzero_si128();
+	for( ; i + 4 <= count; i += 4 ) {
+		const __m128i p = _mm_loadu_si128((const __m128i*)(src + i * 4));
+		const __m128i lo = premultiply2(_mm_unpacklo_epi8(p, zero));
+		const __m128i hi = premultiply2(_mm_unpackhi_epi8(p, zero));
+		_mm_storeu_si128((__m128i*)(dst + i * 4), _mm_packus_epi16(lo, hi));
+	}
+#endif
+	for( ; i < count; i++ ) {
+		const GLubyte *s = src + i * 4;
+		GLubyte *d = dst + i * 4;
+		const unsigned a = s[3];
+		d[0] = EJPremultiply(s[0], a);
+		d[1] = EJPremultiply(s[1], a);
+		d[2] = EJPremultiply(s[2], a);
+		d[3] = (GLubyte)a;
+	}
+}
+
+void EJCopyPixels (const GLubyte *src, int width, int height, size_t bytesPerPixel,
+		GLubyte *dst, int dstWidth, int dstHeight, bool premultiply) {
+	const size_t rowBytes = (size_t)width * bytesPerPixel, dstRowBytes = (size_t)dstWidth * bytesPerPixel;
+	for( int y = 0; y < height; y++ ) {
+		const GLubyte *s = src + (size_t)y * rowBytes;
+		GLubyte *d = dst + (size_t)y * dstRowBytes;
+		if( premultiply ) {
+			EJPremultiplyPixels(s, d, (size_t)width);
+		}
+		else if( s != d ) {
+			memcpy(d, s, rowBytes);
+		}
+		// only the padding is cleared, the rest is written once
+		if( dstRowBytes > rowBytes ) {
+			memset(d + rowBytes, 0, dstRowBytes - rowBytes);
+		}
+	}
+	if( dstHeight > height ) {
+		memset(dst + (size_t)height * dstRowBytes, 0, (size_t)(dstHeight - height) * dstRowBytes);
+	}
+}
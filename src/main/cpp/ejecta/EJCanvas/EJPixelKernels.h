@@ -0,0 +1,28 @@
+#ifndef __EJPIXELKERNELS_H
+#define __EJPIXELKERNELS_H	1
+
+#include "GLcompat.h"
+
+#include <stddef.h>
+
+/*
+ * Kernels for the pixels of images on their way to a texture
+ * rgba pixels are premultiplied 16 at a time on NEON (armeabi-v7a, arm64-v8a) and 4 at a time on SSE2 (x86, x86_64);
+ * the pixels are converted in the pass that pads them to the size of their texture. Thread safe
+ */
+
+// c * a / 255 rounded to the nearest integer, exact for all 8 bit c and a
+static inline GLubyte EJPremultiply (unsigned c, unsigned a) {
+	const unsigned x = c * a + 128;
+	return (GLubyte)((x + (x >> 8)) >> 8);
+}
+
+// premultiplies count rgba pixels of src by their alpha into dst; src and dst may be the same
+void EJPremultiplyPixels (const GLubyte *src, GLubyte *dst, size_t count);
+
+// copies width x height pixels into the top left corner of dstWidth x dstHeight texels, whose others are set to zero;
+// rgba pixels are premultiplied on the way if premultiply is set. src and dst may only be the same if the sizes are
+void EJCopyPixels (const GLubyte *src, int width, int height, size_t bytesPerPixel,
+	GLubyte *dst, int dstWidth, int dstHeight, bool premultiply = false);
+
+#endif
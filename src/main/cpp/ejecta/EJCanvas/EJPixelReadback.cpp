@@ -0,0 +1,96 @@
+#include "EJPixelReadback.h"
+#include "GLcompat.h"
+
+#include <EGL/egl.h>
+#include <stdint.h>
+#include <string.h>
+
+// GLES3 names; the headers of GLES1 and 2 do not have them
+#define EJ_GL_PIXEL_PACK_BUFFER				0x88EB
+#define EJ_GL_STREAM_READ					0x88E1
+#define EJ_GL_MAP_READ_BIT					0x0001
+#define EJ_GL_SYNC_GPU_COMMANDS_COMPLETE	0x9117
+#define EJ_GL_ALREADY_SIGNALED				0x911A
+#define EJ_GL_TIMEOUT_EXPIRED				0x911B
+#define EJ_GL_CONDITION_SATISFIED			0x911C
+
+typedef void* (GL_APIENTRY *EJMapBufferRangeProc) (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+typedef GLboolean (GL_APIENTRY *EJUnmapBufferProc) (GLenum target);
+typedef void* (GL_APIENTRY *EJFenceSyncProc) (GLenum condition, GLbitfield flags);
+typedef GLenum (GL_APIENTRY *EJClientWaitSyncProc) (void* sync, GLbitfield flags, uint64_t timeout);
+typedef void (GL_APIENTRY *EJDeleteSyncProc) (void* sync);
+
+static EJMapBufferRangeProc ejMapBufferRange = NULL;
+static EJUnmapBufferProc ejUnmapBuffer = NULL;
+static EJFenceSyncProc ejFenceSync = NULL;
+static EJClientWaitSyncProc ejClientWaitSync = NULL;
+static EJDeleteSyncProc ejDeleteSync = NULL;
+
+bool EJPixelReadback::isSupported() {
+	// contexts report "OpenGL ES 3.x" and up; the version can differ between contexts, the functions do not
+	const char* version = (const char*)glGetString(GL_VERSION);
+	if (!version || strncmp(version, "OpenGL ES ", 10) != 0 || version[10] < '3' || version[10] > '9') {
+		return false;
+	}
+
+	static bool resolved = false;
+	if (!resolved) {
+		ejMapBufferRange = (EJMapBufferRangeProc)eglGetProcAddress("glMapBufferRange");
+		ejUnmapBuffer = (EJUnmapBufferProc)eglGetProcAddress("glUnmapBuffer");
+		ejFenceSync = (EJFenceSyncProc)eglGetProcAddress("glFenceSync");
+		ejClientWaitSync = (EJClientWaitSyncProc)eglGetProcAddress("glClientWaitSync");
+		ejDeleteSync = (EJDeleteSyncProc)eglGetProcAddress("glDeleteSync");
+		resolved = true;
+	}
+	return ejMapBufferRange && ejUnmapBuffer && ejFenceSync && ejClientWaitSync && ejDeleteSync;
+}
+
+EJPixelReadback::EJPixelReadback (const EJPixelRegion &regionp) : region(regionp), buffer(0), fence(NULL) {
+	if (region.width <= 0 || region.height <= 0) {
+		return;
+	}
+
+	// with a pack buffer bound, glReadPixels only queues the copy and the last argument is an offset into the buffer
+	glGenBuffers(1, &buffer);
+	glBindBuffer(EJ_GL_PIXEL_PACK_BUFFER, buffer);
+	glBufferData(EJ_GL_PIXEL_PACK_BUFFER, region.width * region.height * 4, NULL, EJ_GL_STREAM_READ);
+	glReadPixels(region.x, region.y, region.width, region.height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+	glBindBuffer(EJ_GL_PIXEL_PACK_BUFFER, 0);
+
+	fence = ejFenceSync(EJ_GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	// a fence that was never submitted would not signal
+	glFlush();
+}
+
+EJPixelReadback::~EJPixelReadback() {
+	if (fence) {
+		ejDeleteSync(fence);
+	}
+	if (buffer) {
+		glDeleteBuffers(1, &buffer);
+	}
+}
+
+bool EJPixelReadback::isComplete() {
+	if (!fence) {
+		return true;
+	}
+	// errors count as complete as well; the buffer then holds undefined pixels, but nobody waits forever
+	return ejClientWaitSync(fence, 0, 0) != EJ_GL_TIMEOUT_EXPIRED;
+}
+
+const GLubyte* EJPixelReadback::map() {
+	if (!buffer) {
+		return NULL;
+	}
+	glBindBuffer(EJ_GL_PIXEL_PACK_BUFFER, buffer);
+	return (const GLubyte*)ejMapBufferRange(EJ_GL_PIXEL_PACK_BUFFER, 0, region.width * region.height * 4, EJ_GL_MAP_READ_BIT);
+}
+
+void EJPixelReadback::unmap() {
+	if (!buffer) {
+		return;
+	}
+	ejUnmapBuffer(EJ_GL_PIXEL_PACK_BUFFER);
+	glBindBuffer(EJ_GL_PIXEL_PACK_BUFFER, 0);
+}
@@ -0,0 +1,32 @@
+#ifndef __EJPIXELREADBACK_H
+#define __EJPIXELREADBACK_H	1
+
+#include "EJImageData.h"
+
+/**
+ * Asynchronous glReadPixels for GLES3 contexts
+ * the pixels are copied into a pixel buffer object and a fence is inserted behind the copy; the buffer is only mapped
+ * once the fence has passed, so reading back never waits for the gpu. The GLES3 functions are looked up at runtime,
+ * since the library has to load on devices with GLES2 only. Readbacks have to be created and deleted on the gl thread
+ */
+class EJPixelReadback {
+public:
+	// true if the gl context that is current on the calling thread has pixel buffer objects and fences
+	static bool isSupported();
+
+	EJPixelReadback (const EJPixelRegion &region);
+	~EJPixelReadback();
+
+	// true once the pixels have arrived in the buffer; never blocks
+	bool isComplete();
+	// rgba pixels of the region, bottom row first; valid until unmap. NULL if the region is empty
+	const GLubyte* map();
+	void unmap();
+
+	const EJPixelRegion region;
+private:
+	GLuint buffer;
+	void *fence;
+};
+
+#endif
@@ -0,0 +1,69 @@
+#include "EJShadowCache.h"
+#include "EJGLBackend.h"
+
+#include "NdkMisc.h"
+#define LOG_TAG "EJShadowCache"
+
+#include <algorithm>
+
+EJShadowCache::EJShadowCache (EJGLBackend *backend) : _backend(backend) {
+	for( int i = 0; i < 2; i++ ) {
+		_scratch[i] = NULL;
+		_framebuffers[i] = _stencils[i] = 0;
+	}
+}
+
+EJShadowCache::~EJShadowCache() {
+	for( std::list<EJShadow>::iterator it = _shadows.begin(); it != _shadows.end(); ++it ) {
+		delete it->texture;
+	}
+	for( int i = 0; i < 2; i++ ) {
+		_backend->deleteFramebuffer(_framebuffers[i], _stencils[i]);
+		delete _scratch[i];
+	}
+}
+
+EJShadow* EJShadowCache::get (uint64_t key) {
+	for( std::list<EJShadow>::iterator it = _shadows.begin(); it != _shadows.end(); ++it ) {
+		if( it->key == key ) {
+			_shadows.splice(_shadows.begin(), _shadows, it);
+			return &_shadows.front();
+		}
+	}
+	return NULL;
+}
+
+EJShadow* EJShadowCache::add (uint64_t key, int width, int height) {
+	// shadows are drawn right away, so no batch refers to the texture of an evicted one
+	if( _shadows.size() >= EJ_CANVAS_SHADOW_TEXTURES ) {
+		delete _shadows.back().texture;
+		_shadows.pop_back();
+	}
+
+	EJShadow shadow = { key, EJTexture::initWithWidth(width, height), width, height, 0, 0, 0, 0 };
+	// shadows are drawn scaled up from fewer texels, which should never look blocky
+	shadow.texture->bind();
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	_shadows.push_front(shadow);
+	return &_shadows.front();
+}
+
+EJTexture* EJShadowCache::bindScratch (int index, int width, int height) {
+	EJTexture *&scratch = _scratch[index];
+	if( !scratch || scratch->realWidth < width || scratch->realHeight < height ) {
+		if( scratch ) {
+			width = std::max(width, (int)scratch->realWidth);
+			height = std::max(height, (int)scratch->realHeight);
+			_backend->deleteFramebuffer(_framebuffers[index], _stencils[index]);
+			delete scratch;
+		}
+		scratch = EJTexture::initWithWidth(width, height);
+		_framebuffers[index] = _backend->createFramebuffer(scratch->textureId, scratch->realWidth, scratch->realHeight, 0, &_stencils[index]);
+		if( !_framebuffers[index] ) {
+			LOGE("cannot create a framebuffer of %dx%d for shadows", width, height);
+		}
+	}
+	_backend->bindFramebuffer(_framebuffers[index]);
+	return _framebuffers[index] ? scratch : NULL;
+}
@@ -0,0 +1,48 @@
+#ifndef __EJSHADOWCACHE_H
+#define __EJSHADOWCACHE_H	1
+
+#include "EJTexture.h"
+
+#include <stdint.h>
+#include <list>
+
+class EJGLBackend;
+
+#define EJ_CANVAS_SHADOW_TEXTURES 8
+#define EJ_CANVAS_SHADOW_MAX_SIZE 1024
+
+// blurred silhouette of the vertices of a flush; the rect is relative to the top left corner of their bounds
+typedef struct {
+	uint64_t key;
+	EJTexture* texture;
+	int width, height;		// texels of the texture that are used
+	float x, y, w, h;		// in canvas units
+} EJShadow;
+
+/**
+ * Shadows a context has drawn recently, and the framebuffers they are drawn in
+ * A shadow is keyed by everything that makes up its pixels: the vertices relative to their bounds, their colors and
+ * textures and the blur. Drawing the same shape with the same blur again, anywhere on the canvas, only draws the
+ * cached texture. The silhouette and the horizontal pass of the blur go to two scratch framebuffers that only grow,
+ * and the result is copied into a texture of its own.
+ */
+class EJShadowCache {
+public:
+	EJShadowCache (EJGLBackend *backend);
+	~EJShadowCache();
+
+	// the shadow of key, which becomes the most recently used one; NULL if it is not cached
+	EJShadow* get (uint64_t key);
+	// adds a shadow of width x height texels, deleting the least recently used one if the cache is full
+	EJShadow* add (uint64_t key, int width, int height);
+
+	// binds scratch framebuffer 0 or 1, with room for at least width x height texels, and returns its texture
+	EJTexture* bindScratch (int index, int width, int height);
+private:
+	EJGLBackend *_backend;
+	std::list<EJShadow> _shadows;		// most recently used first
+	EJTexture *_scratch[2];
+	unsigned int _framebuffers[2], _stencils[2];
+};
+
+#endif
@@ -0,0 +1,86 @@
+#include "EJSkyline.h"
+
+#include <limits.h>
+#include <algorithm>
+
+EJSkyline::EJSkyline (int width, int height) {
+	_width = width;
+	_height = height;
+	reset();
+}
+
+void EJSkyline::reset() {
+	_segments.clear();
+	_segments.push_back((Segment) { 0, 0, _width });
+}
+
+// returns the y position a rect placed at the start of the segment would have, or -1 if it does not fit
+int EJSkyline::fit (size_t index, int width, int height) const {
+	if (_segments[index].x + width > _width) {
+		return -1;
+	}
+
+	int y = _segments[index].y;
+	int remaining = width;
+	for (size_t i = index; remaining > 0; i++) {
+		if (i >= _segments.size()) {
+			return -1;
+		}
+		y = std::max(y, _segments[i].y);
+		if (y + height > _height) {
+			return -1;
+		}
+		remaining -= _segments[i].width;
+	}
+	return y;
+}
+
+bool EJSkyline::pack (int width, int height, int* x, int* y) {
+	std::vector<Segment>& skyline = _segments;
+
+	int best = -1, bestTop = INT_MAX, bestWidth = INT_MAX;
+	for (size_t i = 0; i < skyline.size(); i++) {
+		const int top = fit(i, width, height);
+		if (top < 0) {
+			continue;
+		}
+		if (top + height < bestTop || (top + height == bestTop && skyline[i].width < bestWidth)) {
+			best = (int)i;
+			bestTop = top + height;
+			bestWidth = skyline[i].width;
+			*x = skyline[i].x;
+			*y = top;
+		}
+	}
+	if (best < 0) {
+		return false;
+	}
+
+	skyline.insert(skyline.begin() + best, (Segment) { *x, bestTop, width });
+
+	// cut away what the new segment covers of the following ones
+	for (size_t i = best + 1; i < skyline.size(); ) {
+		Segment& previous = skyline[i - 1];
+		Segment& segment = skyline[i];
+		const int overlap = previous.x + previous.width - segment.x;
+		if (overlap <= 0) {
+			break;
+		}
+		segment.x += overlap;
+		segment.width -= overlap;
+		if (segment.width > 0) {
+			break;
+		}
+		skyline.erase(skyline.begin() + i);
+	}
+
+	for (size_t i = 0; i + 1 < skyline.size(); ) {
+		if (skyline[i].y == skyline[i + 1].y) {
+			skyline[i].width += skyline[i + 1].width;
+			skyline.erase(skyline.begin() + i + 1);
+		} else {
+			i++;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,29 @@
+#ifndef __EJSKYLINE_H
+#define __EJSKYLINE_H	1
+
+#include <vector>
+
+/**
+ * Packs rects into a width x height area, keeping only the outline of the top edges of what was placed
+ * Rects are placed with the bottom-left rule: at the lowest resulting top edge, ties go to the narrowest segment.
+ */
+class EJSkyline {
+public:
+	EJSkyline (int width, int height);
+
+	// finds a place for a width x height rect; returns false if none is left
+	bool pack (int width, int height, int* x, int* y);
+	// forgets all rects
+	void reset();
+private:
+	struct Segment {
+		int x, y, width;
+	};
+
+	int fit (size_t index, int width, int height) const;
+
+	int _width, _height;
+	std::vector<Segment> _segments;
+};
+
+#endif
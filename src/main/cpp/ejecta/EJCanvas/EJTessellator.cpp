@@ -0,0 +1,146 @@
+#include "EJTessellator.h"
+
+#include <algorithm>
+#include <math.h>
+
+// slabs are never made thinner than this, so rounding errors at crossings can not stall the sweep; relative to y,
+// since far from the origin an absolute step is below the precision of a float and adding it does not move on
+#define EJ_TESSELLATOR_MIN_SLAB 0.0001f
+#define EJ_TESSELLATOR_MIN_SLAB_RELATIVE 0.000001f
+
+namespace {
+
+struct Edge {
+	float x0, y0, y1;	// y0 < y1
+	float dxdy;
+	int winding;		// +1 if the edge points down, -1 if it points up
+
+	float xAt (float y) const { return x0 + (y - y0) * dxdy; }
+};
+
+// area between two edges that is inside the path, from top down to where it is closed
+struct Span {
+	int left, right;
+	float top;
+};
+
+struct EdgeOrder {
+	const std::vector<Edge> &edges;
+	float y;
+
+	EdgeOrder (const std::vector<Edge> &e, float at) : edges(e), y(at) {}
+
+	// ties are broken by the slope, which is the order just below y
+	bool operator() (int a, int b) const {
+		const float xa = edges[a].xAt(y), xb = edges[b].xAt(y);
+		return xa < xb || (xa == xb && edges[a].dxdy < edges[b].dxdy);
+	}
+};
+
+void pushTrapezoid (const Edge &left, const Edge &right, float top, float bottom, std::vector<EJVector2> &triangles) {
+	if( bottom <= top ) { return; }
+
+	const EJVector2 tl = { left.xAt(top), top };
+	const EJVector2 tr = { right.xAt(top), top };
+	const EJVector2 bl = { left.xAt(bottom), bottom };
+	const EJVector2 br = { right.xAt(bottom), bottom };
+
+	triangles.push_back(tl); triangles.push_back(tr); triangles.push_back(bl);
+	triangles.push_back(tr); triangles.push_back(br); triangles.push_back(bl);
+}
+
+}
+
+void EJTessellator::tessellate (const EJSubPaths &paths, EJFillRule fillRule, std::vector<EJVector2> &triangles) {
+	// collect the edges of all subpaths, each closed back to its first point; horizontal ones never bound a span
+	std::vector<Edge> edges;
+	std::vector<float> ys;
+	for( size_t sp = 0; sp < paths.count; sp++ ) {
+		const EJVector2 *path = paths.begin(sp);
+		const size_t size = paths.size(sp);
+		for( size_t i = 0; i < size; i++ ) {
+			const EJVector2 &a = path[i], &b = path[(i + 1) % size];
+			if( a.y == b.y ) { continue; }
+
+			const EJVector2 &top = a.y < b.y ? a : b, &bottom = a.y < b.y ? b : a;
+			Edge edge = { top.x, top.y, bottom.y, (bottom.x - top.x) / (bottom.y - top.y), a.y < b.y ? 1 : -1 };
+			edges.push_back(edge);
+			ys.push_back(top.y);
+			ys.push_back(bottom.y);
+		}
+	}
+	if( edges.empty() ) { return; }
+
+	std::sort(ys.begin(), ys.end());
+	ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+	std::vector<int> byTop(edges.size());
+	for( size_t i = 0; i < edges.size(); i++ ) { byTop[i] = (int)i; }
+	std::sort(byTop.begin(), byTop.end(), [&edges](int a, int b) { return edges[a].y0 < edges[b].y0; });
+
+	std::vector<int> active;
+	std::vector<Span> open, spans;
+	size_t nextEdge = 0;
+
+	for( size_t k = 0; k + 1 < ys.size(); k++ ) {
+		const float slabTop = ys[k], slabBottom = ys[k + 1];
+
+		// edges ending at the top of the slab leave, the ones starting there enter
+		active.erase(std::remove_if(active.begin(), active.end(), [&edges, slabTop](int e) { return edges[e].y1 <= slabTop; }), active.end());
+		while( nextEdge < byTop.size() && edges[byTop[nextEdge]].y0 <= slabTop ) {
+			active.push_back(byTop[nextEdge++]);
+		}
+
+		for( float top = slabTop; top < slabBottom; ) {
+			std::sort(active.begin(), active.end(), EdgeOrder(edges, top));
+
+			// the first crossing below top is always between neighbours; stop the slab there
+			float bottom = slabBottom;
+			for( size_t i = 0; i + 1 < active.size(); i++ ) {
+				const Edge &a = edges[active[i]], &b = edges[active[i + 1]];
+				if( a.xAt(bottom) > b.xAt(bottom) && a.dxdy != b.dxdy ) {
+					const float crossing = top + (b.xAt(top) - a.xAt(top)) / (a.dxdy - b.dxdy);
+					bottom = std::min(bottom, crossing);
+				}
+			}
+			const float minSlab = std::max(EJ_TESSELLATOR_MIN_SLAB, fabsf(top) * EJ_TESSELLATOR_MIN_SLAB_RELATIVE);
+			bottom = std::min(slabBottom, std::max(bottom, top + minSlab));
+			if( !(bottom > top) ) {
+				// no step is small enough to move on, i.e. y is not finite; the rest of the slab is left out
+				break;
+			}
+
+			// spans inside the path; a span between the same edges as one above just continues it
+			spans.clear();
+			int winding = 0;
+			for( size_t i = 0; i + 1 < active.size(); i++ ) {
+				winding += edges[active[i]].winding;
+				const bool inside = fillRule == kEJFillRuleEvenOdd ? (winding & 1) != 0 : winding != 0;
+				if( !inside ) { continue; }
+
+				Span span = { active[i], active[i + 1], top };
+				for( size_t j = 0; j < open.size(); j++ ) {
+					if( open[j].left == span.left && open[j].right == span.right ) {
+						span.top = open[j].top;
+						open[j].left = -1;
+						break;
+					}
+				}
+				spans.push_back(span);
+			}
+
+			for( size_t j = 0; j < open.size(); j++ ) {
+				if( open[j].left >= 0 ) {
+					pushTrapezoid(edges[open[j].left], edges[open[j].right], open[j].top, top, triangles);
+				}
+			}
+			open.swap(spans);
+			top = bottom;
+		}
+	}
+
+	const float end = ys.back();
+	for( size_t j = 0; j < open.size(); j++ ) {
+		pushTrapezoid(edges[open[j].left], edges[open[j].right], open[j].top, end, triangles);
+	}
+}
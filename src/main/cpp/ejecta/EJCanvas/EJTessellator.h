@@ -0,0 +1,20 @@
+#ifndef __EJTESSELLATOR_H
+#define __EJTESSELLATOR_H	1
+
+#include "EJPath.h"
+
+#include <vector>
+
+/**
+ * Splits the area of a path into triangles on the CPU, so fills of complex paths batch with everything else
+ * The path is cut into horizontal slabs at every vertex and at every point where edges cross. Inside a slab the edges
+ * are in a fixed order, so the spans that are inside under the fill rule are trapezoids; trapezoids of consecutive slabs
+ * between the same two edges are merged.
+ */
+class EJTessellator {
+public:
+	// appends triangles, three points each, that cover the closed subpaths under the fill rule
+	static void tessellate (const EJSubPaths &paths, EJFillRule fillRule, std::vector<EJVector2> &triangles);
+};
+
+#endif
@@ -1,4 +1,10 @@
 #include "EJTexture.h"
+#include "EJTextureUploader.h"
+#include "EJGLState.h"
+#include "EJHardwareBuffer.h"
+#include "EJExternalTexture.h"
+#include "EJPNGDecoder.h"
+#include "EJPixelKernels.h"
 #include "lodepng.h"
 #include "stdlib.h"
 
@@ -12,8 +18,14 @@
 #include <GLES/gl.h>
 #include <GLES/glext.h>
 #include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <vector>
 
 static GLint textureFilter = GL_LINEAR;
+static EJImageTextureFormat imageTextureFormat = kEJImageTextureRGBA8888;
+// read by the decoder threads of images
+static std::atomic<bool> premultipliedImages(false);
 
 bool EJTexture::smoothScaling() {
 	return (textureFilter == GL_LINEAR);
@@ -23,11 +35,93 @@ void EJTexture::setSmoothScaling (bool smoothScaling) {
 	textureFilter = smoothScaling ? GL_LINEAR : GL_NEAREST;
 }
 
+void EJTexture::setImageTextureFormat (EJImageTextureFormat format) {
+	imageTextureFormat = format;
+}
+
+void EJTexture::setPremultipliedAlpha (bool premultiplied) {
+	premultipliedImages = premultiplied;
+}
+
+bool EJTexture::premultipliedAlpha() {
+	return premultipliedImages;
+}
+
+GLenum EJTexture::imageTextureType (bool opaque) {
+	switch( imageTextureFormat ) {
+		case kEJImageTextureRGB565: return opaque ? GL_UNSIGNED_SHORT_5_6_5 : GL_UNSIGNED_BYTE;
+		case kEJImageTextureRGBA4444: return opaque ? GL_UNSIGNED_SHORT_5_6_5 : GL_UNSIGNED_SHORT_4_4_4_4;
+		default: return GL_UNSIGNED_BYTE;
+	}
+}
+
+GLenum EJTexture::formatForType (GLenum type) {
+	return type == GL_UNSIGNED_SHORT_5_6_5 ? GL_RGB : GL_RGBA;
+}
+
+size_t EJTexture::bytesPerTexel (GLenum format, GLenum type) {
+	if( type == GL_UNSIGNED_SHORT_5_6_5 || type == GL_UNSIGNED_SHORT_4_4_4_4 ) { return 2; }
+	switch( format ) {
+		case GL_RGBA: return 4;
+		case GL_RGB: return 3;
+		case GL_LUMINANCE_ALPHA: return 2;
+		default: return 1;
+	}
+}
+
+// 4x4 ordered dither; spread over [0, 255) it is the fraction added to a channel before it is truncated
+static const GLubyte ditherMatrix[4][4] = {
+	{  8, 136,  40, 168 },
+	{ 200,  72, 232, 104 },
+	{  56, 184,  24, 152 },
+	{ 248, 120, 216,  88 }
+};
+
+// channel of 8 bits truncated to one of max + 1 levels after adding the dither, which averages to the exact value
+static inline GLushort quantize (GLubyte value, int max, int dither) {
+	return (GLushort)((value * max + dither) / 255);
+}
+
+void EJTexture::packPixels (const GLubyte* pixels, int widthp, int heightp, int realWidthp, int realHeightp, GLenum typep, GLushort* texels) {
+	memset(texels, 0, (size_t)realWidthp * realHeightp * sizeof(GLushort));
+	for( int y = 0; y < heightp; y++ ) {
+		const GLubyte *src = &pixels[(size_t)y * widthp * 4];
+		GLushort *dst = &texels[(size_t)y * realWidthp];
+		const GLubyte *row = ditherMatrix[y & 3];
+		if( typep == GL_UNSIGNED_SHORT_5_6_5 ) {
+			for( int x = 0; x < widthp; x++, src += 4 ) {
+				const int d = row[x & 3];
+				dst[x] = (quantize(src[0], 31, d) << 11) | (quantize(src[1], 63, d) << 5) | quantize(src[2], 31, d);
+			}
+		}
+		else {
+			// alpha is dithered as well, so translucent edges and shadows fade out smoothly
+			for( int x = 0; x < widthp; x++, src += 4 ) {
+				const int d = row[x & 3];
+				dst[x] = (quantize(src[0], 15, d) << 12) | (quantize(src[1], 15, d) << 8) |
+					(quantize(src[2], 15, d) << 4) | quantize(src[3], 15, d);
+			}
+		}
+	}
+}
+
 
 
 EJTexture* EJTexture::initWithPath(const char* path) {
+	// ktx and pkm files are uploaded as they are when the driver can sample them
+	if( !EJCompressedImage::fallbackPath(path).empty() ) {
+		unsigned char* file = NULL;
+		size_t length = 0;
+		EJCompressedImage* image = lodepng_load_file(&file, &length, path) ? NULL : EJCompressedImage::initWithData(file, length);
+		EJTexture* texture = image ? EJTexture::initWithCompressedImage(image) : NULL;
+		free(file);
+		delete image;
+		if( texture ) { return texture; }
+	}
+
 	// Load directly (blocking)
 	EJTexture* self = new EJTexture();
+	self->premultiplied = premultipliedImages;
 	GLubyte *pixels = self->loadPixelsFromPath(path);
 	self->createTextureWithPixels(pixels, GL_RGBA);
 
@@ -56,19 +150,7 @@ EJTexture* EJTexture::initWithWidth (int widthp, int heightp, GLubyte* pixels) {
 	EJTexture* self = new EJTexture();
 	self->fullPath = strdup("[From Pixels]");
 	self->setWidth(widthp, heightp);
-
-	if( widthp != self->realWidth || heightp != self->realHeight ) {
-		GLubyte * pixelsPow2 = (GLubyte *)malloc( self->realWidth * self->realHeight * 4 );
-		memset( pixelsPow2, 0, self->realWidth * self->realHeight * 4 );
-		for( int y = 0; y < heightp; y++ ) {
-			memcpy( &pixelsPow2[y*self->realWidth*4], &pixels[y*widthp*4], widthp * 4 );
-		}
-		self->createTextureWithPixels(pixelsPow2, GL_RGBA);
-		free(pixelsPow2);
-	}
-	else {
-		self->createTextureWithPixels(pixels, GL_RGBA);
-	}
+	self->createTextureWithPaddedPixels(pixels, GL_RGBA, 4);
 	return self;
 }
 
@@ -78,24 +160,85 @@ EJTexture* EJTexture::initWithWidth (int widthp, int heightp, GLubyte* pixels, G
 	EJTexture* self = new EJTexture();
 	self->fullPath = strdup("[From Pixels]");
 	self->setWidth(widthp, heightp);
+	self->createTextureWithPaddedPixels(pixels, format, bytePerPixel);
+	return self;
+}
 
-	if( widthp != self->realWidth || heightp != self->realHeight ) {
-		GLubyte * pixelsPow2 = (GLubyte *)malloc( self->realWidth * self->realHeight * bytePerPixel );
-		memset( pixelsPow2, 0, self->realWidth * self->realHeight * bytePerPixel );
-		for( int y = 0; y < heightp; y++ ) {
-			memcpy( &pixelsPow2[y*self->realWidth*bytePerPixel], &pixels[y*widthp*bytePerPixel], widthp * bytePerPixel );
-		}
-		self->createTextureWithPixels(pixelsPow2, format);
+EJTexture* EJTexture::initWithRGBAPixels (int widthp, int heightp, const GLubyte* pixels, GLenum typep) {
+	if( typep == GL_UNSIGNED_BYTE ) {
+		return EJTexture::initWithWidth(widthp, heightp, (GLubyte*)pixels);
+	}
+
+	EJTexture* self = new EJTexture();
+	self->fullPath = strdup("[From Pixels]");
+	self->setWidth(widthp, heightp);
+	std::vector<GLushort> texels((size_t)self->realWidth * self->realHeight);
+	EJTexture::packPixels(pixels, widthp, heightp, self->realWidth, self->realHeight, typep, texels.data());
+	self->createTextureWithPixels((GLubyte*)texels.data(), EJTexture::formatForType(typep), typep);
+	return self;
+}
+
+EJTexture* EJTexture::initWithUpload (int widthp, int heightp, EJTextureUpload* upload) {
+	EJTexture* self = new EJTexture();
+	self->fullPath = strdup("[Uploading]");
+	self->setWidth(widthp, heightp);
+	self->format = EJTexture::formatForType(upload->type);
+	self->type = upload->type;
+	self->upload = upload;
+	return self;
+}
+
+void EJTexture::createTextureWithPaddedPixels (const GLubyte* pixels, GLenum formatp, size_t bytePerPixel) {
+	if( width != realWidth || height != realHeight ) {
+		GLubyte * pixelsPow2 = (GLubyte *)malloc( realWidth * realHeight * bytePerPixel );
+		EJCopyPixels(pixels, width, height, bytePerPixel, pixelsPow2, realWidth, realHeight);
+		this->createTextureWithPixels(pixelsPow2, formatp);
 		free(pixelsPow2);
 	}
 	else {
-		self->createTextureWithPixels(pixels, format);
+		this->createTextureWithPixels((GLubyte*)pixels, formatp);
 	}
-	return self;
+}
+
+void EJTexture::finishUpload() {
+	// uploads the worker has not started yet are taken back and done here, rather than waiting behind the others
+	textureId = upload->uploader->finish(upload);
+	if( !textureId && type != GL_UNSIGNED_BYTE ) {
+		std::vector<GLushort> texels((size_t)realWidth * realHeight);
+		EJTexture::packPixels(upload->image->pixels(), width, height, realWidth, realHeight, type, texels.data());
+		this->createTextureWithPixels((GLubyte*)texels.data(), format, type);
+	}
+	else if( !textureId ) {
+		this->createTextureWithPaddedPixels(upload->image->pixels(), GL_RGBA, 4);
+	}
+	upload->image->release();
+	delete upload;
+	upload = NULL;
 }
 
 EJTexture::~EJTexture() {
-	glDeleteTextures (1, &textureId);
+	if( upload ) {
+		upload->uploader->cancel(upload);
+	}
+	if( external ) {
+		external->release();
+		return;
+	}
+	EJGLState::deleteTexture(textureId);
+	if( eglImage ) {
+		EJHardwareBuffer::destroyImage(eglImage);
+	}
+}
+
+// GLES2 and later allow npot textures without mipmaps and with clamped wrapping, which is all textures use here;
+// GLES1 contexts need an extension for that
+static bool npotSupported() {
+	const char* version = (const char*)glGetString(GL_VERSION);
+	if (version && strncmp(version, "OpenGL ES-C", 11) != 0) {
+		return true;
+	}
+	const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+	return extensions && (strstr(extensions, "GL_OES_texture_npot") || strstr(extensions, "GL_ARB_texture_non_power_of_two"));
 }
 
 static int findNextPot(int size) {
@@ -107,24 +250,107 @@ static int findNextPot(int size) {
 	return pot;
 }
 
-void EJTexture::setWidth (int heightp, int widthp) {
+void EJTexture::setWidth (int widthp, int heightp) {
 	width = widthp;
 	height = heightp;
 
 
 
-	// The internal (real) size of the texture needs to be a power of two
-	realWidth = findNextPot(width);
-	realHeight = findNextPot(height);
+	// The internal (real) size of the texture needs to be a power of two, unless the context supports npot textures
+	if( npotSupported() ) {
+		realWidth = width;
+		realHeight = height;
+	}
+	else {
+		realWidth = findNextPot(width);
+		realHeight = findNextPot(height);
+	}
 	/* realWidth = pow(2, ceil (log2 (width)));
 	realHeight = pow(2, ceil (log2 (height))); */
 }
 
+EJTexture* EJTexture::initWithCompressedImage (const EJCompressedImage* image) {
+	// compressed textures keep the size of their blocks, they are not padded to a power of two
+	const GLenum uploadFormat = EJCompressedImage::uploadFormat(image->format());
+	const int w = image->width(), h = image->height();
+	if( !uploadFormat || (!npotSupported() && (w != findNextPot(w) || h != findNextPot(h))) ) {
+		return NULL;
+	}
+
+	EJTexture* self = new EJTexture();
+	self->fullPath = strdup("[Compressed]");
+	self->width = self->realWidth = w;
+	self->height = self->realHeight = h;
+	self->format = uploadFormat;
+	self->type = GL_UNSIGNED_BYTE;
+	self->compressed = true;
+
+	GLuint boundTexture = EJGLState::boundTexture();
+
+	glGenTextures(1, &self->textureId);
+	EJGLState::bindTexture(self->textureId);
+	glCompressedTexImage2D(GL_TEXTURE_2D, 0, uploadFormat, w, h, 0, image->bytes(), image->data());
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, textureFilter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, textureFilter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	EJGLState::bindTexture(boundTexture);
+	return self;
+}
+
+
+EJTexture* EJTexture::initWithHardwareBuffer (AHardwareBuffer* buffer, int widthp, int heightp) {
+	// the buffer is sampled as it is, without padding to a power of two
+	if( !npotSupported() && (widthp != findNextPot(widthp) || heightp != findNextPot(heightp)) ) {
+		return NULL;
+	}
+	void* image = EJHardwareBuffer::createImage(buffer);
+	if( !image ) {
+		return NULL;
+	}
+
+	EJTexture* self = new EJTexture();
+	self->fullPath = strdup("[Hardware Buffer]");
+	self->width = self->realWidth = widthp;
+	self->height = self->realHeight = heightp;
+	self->format = GL_RGBA;
+	self->type = GL_UNSIGNED_BYTE;
+	self->eglImage = image;
+
+	GLuint boundTexture = EJGLState::boundTexture();
+
+	glGenTextures(1, &self->textureId);
+	EJGLState::bindTexture(self->textureId);
+	EJHardwareBuffer::bindImage(image);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, textureFilter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, textureFilter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	EJGLState::bindTexture(boundTexture);
+	return self;
+}
+
+EJTexture* EJTexture::initWithExternalTexture (EJExternalTexture* externalp) {
+	EJTexture* self = new EJTexture();
+	self->fullPath = strdup("[External Texture]");
+	self->width = self->realWidth = externalp->width();
+	self->height = self->realHeight = externalp->height();
+	self->format = GL_RGBA;
+	self->type = GL_UNSIGNED_BYTE;
+	self->premultiplied = true;
+	externalp->retain();
+	self->external = externalp;
+	return self;
+}
 
-void EJTexture::createTextureWithPixels (GLubyte *pixels, GLenum formatp) {
+void EJTexture::createTextureWithPixels (GLubyte *pixels, GLenum formatp, GLenum typep) {
 	// Release previous texture if we had one
 	if( textureId ) {
-		glDeleteTextures( 1, &textureId );
+		EJGLState::deleteTexture(textureId);
 		textureId = 0;
 	}
 
@@ -135,86 +361,92 @@ void EJTexture::createTextureWithPixels (GLubyte *pixels, GLenum formatp) {
 		LOGI("Warning: Image %s larger than MAX_TEXTURE_SIZE (%d)", fullPath, maxTextureSize);
 	}
 	format = formatp;
+	type = typep;
 
-	bool wasEnabled = true; // glIsEnabled(GL_TEXTURE_2D);
-	int boundTexture = 0;
-	glGetIntegerv(GL_TEXTURE_BINDING_2D, &boundTexture);
+	// GL_TEXTURE_2D only has to be enabled for drawing, and only on GLES1, where the backend does it in setFill;
+	// on GLES2 it is not a capability at all
+	GLuint boundTexture = EJGLState::boundTexture();
 
-	glEnable(GL_TEXTURE_2D);
 	glGenTextures(1, &textureId);
 
 	// LOGD ("new textureId %u", textureId);
-	glBindTexture(GL_TEXTURE_2D, textureId);
-	glTexImage2D(GL_TEXTURE_2D, 0, format, realWidth, realHeight, 0, format, GL_UNSIGNED_BYTE, pixels);
+	EJGLState::bindTexture(textureId);
+	// rows of npot textures with less than 4 bytes per pixel are not 4 byte aligned
+	const bool unaligned = EJTexture::bytesPerTexel(format, type) != 4;
+	if( unaligned ) { glPixelStorei(GL_UNPACK_ALIGNMENT, 1); }
+	glTexImage2D(GL_TEXTURE_2D, 0, format, realWidth, realHeight, 0, format, type, pixels);
+	if( unaligned ) { glPixelStorei(GL_UNPACK_ALIGNMENT, 4); }
 
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, textureFilter);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, textureFilter);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-	glBindTexture(GL_TEXTURE_2D, boundTexture);
-	if( !wasEnabled ) {	glDisable(GL_TEXTURE_2D); }
+	EJGLState::bindTexture(boundTexture);
 }
 
 void EJTexture::updateTextureWithPixels (GLubyte *pixels, int x, int y, int subWidth, int subHeight) {
 	if( !textureId ) { LOGI("No texture to update. Call createTexture... first");	return; }
+	if( compressed ) { LOGI("Compressed textures can not be updated"); return; }
 
-	bool wasEnabled = glIsEnabled(GL_TEXTURE_2D);
-	int boundTexture = 0;
-	glGetIntegerv(GL_TEXTURE_BINDING_2D, &boundTexture);
+	GLuint boundTexture = EJGLState::boundTexture();
 
-	glBindTexture(GL_TEXTURE_2D, textureId);
-	glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, subWidth, subHeight, format, GL_UNSIGNED_BYTE, pixels);
+	EJGLState::bindTexture(textureId);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, subWidth, subHeight, format, type, pixels);
 
-	glBindTexture(GL_TEXTURE_2D, boundTexture);
-	if( !wasEnabled ) {	glDisable(GL_TEXTURE_2D); }
+	EJGLState::bindTexture(boundTexture);
+}
+
+void EJTexture::setWrap (GLenum wrapS, GLenum wrapT) {
+	// external textures only clamp
+	if( external ) { return; }
+	this->ensureUploaded();
+	GLuint boundTexture = EJGLState::boundTexture();
+
+	EJGLState::bindTexture(textureId);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapS);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapT);
+
+	EJGLState::bindTexture(boundTexture);
 }
 
 GLubyte *EJTexture::loadPixelsFromPath (const char* path) {
 	// All CGImage functions return pixels with premultiplied alpha and there's no
 	// way to opt-out - thanks Apple, awesome idea.
 	// So, for PNG images we use the lodepng library instead.
-	return this->loadPixelsWithLodePNGFromPath(path);
+	std::string fallback = EJCompressedImage::fallbackPath(path);
+	return this->loadPixelsWithLodePNGFromPath(fallback.empty() ? path : fallback.c_str());
 
 	/* if (path.substr(path.length() - 4, 4).compare("png") == 0) {
 		this->loadPixelsWit
 	} */
 }
 
+static void layoutTexture (unsigned width, unsigned height, unsigned *bufferWidth, unsigned *bufferHeight, void *data) {
+	// the pixels are decoded into the upper left corner of the (power of 2) size of the texture
+	EJTexture *texture = (EJTexture*)data;
+	texture->setWidth(width, height);
+	*bufferWidth = texture->realWidth;
+	*bufferHeight = texture->realHeight;
+}
+
 GLubyte *EJTexture::loadPixelsWithLodePNGFromPath (const char* path) {
 	unsigned int w, h;
-	unsigned char * origPixels = NULL;
-	unsigned int error = lodepng_decode32_file(&origPixels, &w, &h, path);
+	unsigned char * pixels = NULL;
+	unsigned int error = EJPNGDecoder::decodeFile(path, &pixels, &w, &h, layoutTexture, this, premultiplied);
 
 	if( error ) {
-		LOGE("Error Loading image %s - %u: %s", path, error, lodepng_error_text(error));
-		return origPixels;
-	}
-
-	this->setWidth(w, h);
-
-	// If the image is already in the correct (power of 2) size, just return
-	// the original pixels unmodified
-	if( width == realWidth && height == realHeight ) {
-		return origPixels;
-	}
-
-	// Copy the original pixels into the upper left corner of a larger
-	// (power of 2) pixel buffer, free the original pixels and return
-	// the larger buffer
-	else {
-		GLubyte * pixels = (GLubyte*)malloc( realWidth * realHeight * 4 );
-		memset(pixels, 0x00, realWidth * realHeight * 4 );
-
-		for( int y = 0; y < height; y++ ) {
-			memcpy( &pixels[y*realWidth*4], &origPixels[y*width*4], width*4 );
-		}
-
-		free( origPixels );
-		return pixels;
+		LOGE("Error Loading image %s - %u: %s", path, error, EJPNGDecoder::errorText(error));
 	}
+	return pixels;
 }
 
 void EJTexture::bind() {
-	glBindTexture(GL_TEXTURE_2D, textureId);
+	// external textures have a target of their own, which leaves GL_TEXTURE_2D of the unit as it is
+	if( external ) {
+		glBindTexture(GL_TEXTURE_EXTERNAL_OES, external->textureId());
+		return;
+	}
+	this->ensureUploaded();
+	EJGLState::bindTexture(textureId);
 }
@@ -2,10 +2,22 @@
 #define __EJTEXTURE_H	1
 
 #include "GLcompat.h"
+#include "EJCompressedImage.h"
 
 
 using namespace std;
 
+struct EJTextureUpload;
+struct AHardwareBuffer;
+class EJExternalTexture;
+
+// texel formats of the textures of images; 16 bit textures take half the memory and bandwidth at the cost of precision
+typedef enum {
+	kEJImageTextureRGBA8888,	// all images in 32 bits
+	kEJImageTextureRGB565,		// opaque images in 16 bits, translucent ones in 32
+	kEJImageTextureRGBA4444		// opaque images in RGB565, translucent ones in RGBA4444
+} EJImageTextureFormat;
+
 class EJTexture {
 public:
 	// members
@@ -18,23 +30,71 @@ public:
 	static EJTexture* initWithWidth (int width, int height);
 	static EJTexture* initWithWidth (int width, int height, GLubyte* pixels);
 	static EJTexture* initWithWidth (int widthp, int heightp, GLubyte* pixels, GLenum format, size_t bytePerPixel);
+	// texture of rgba pixels stored as type: GL_UNSIGNED_BYTE, or dithered to GL_UNSIGNED_SHORT_5_6_5 or 4_4_4_4
+	static EJTexture* initWithRGBAPixels (int widthp, int heightp, const GLubyte* pixels, GLenum type);
+	// NULL if the driver can not sample the format of image, or its size without npot support
+	static EJTexture* initWithCompressedImage (const EJCompressedImage* image);
+	// texture of a background upload of widthp x heightp pixels, which has no texture id until it is bound
+	static EJTexture* initWithUpload (int widthp, int heightp, EJTextureUpload* upload);
+	// texture that samples the rgba8888 pixels of buffer where they are; NULL where that is not supported
+	static EJTexture* initWithHardwareBuffer (AHardwareBuffer* buffer, int widthp, int heightp);
+	// texture that samples the frames of external, which it retains; only backends that support external textures can
+	// draw it, and it can not repeat
+	static EJTexture* initWithExternalTexture (EJExternalTexture* external);
 
 	~EJTexture();
 
 	void setWidth (int width, int height);
-	void createTextureWithPixels (GLubyte *pixels, GLenum format);
+	void createTextureWithPixels (GLubyte *pixels, GLenum format, GLenum type = GL_UNSIGNED_BYTE);
 	void updateTextureWithPixels (GLubyte *pixels, int x, int y, int width, int height);
 
+	// pixels of a png; ktx and pkm paths load the png of the same name
 	GLubyte *loadPixelsFromPath (const char* path);
 	void bind();
+	// takes over the texture of a background upload, waiting for it if it is not done yet; bind does it as well
+	void ensureUploaded() { if( upload ) { this->finishUpload(); } }
+	// textures are created with clamped wrapping; repeating needs power of two sizes
+	void setWrap (GLenum wrapS, GLenum wrapT);
+	GLenum getFormat() const { return format; }
+	GLenum getType() const { return type; }
+	// the texels are premultiplied by their alpha, so they are blended with EJCompositeOperationFuncs' premultiplied factors
+	bool isPremultiplied() const { return premultiplied; }
+	// of a texture made with initWithExternalTexture, NULL for all others
+	EJExternalTexture* externalTexture() const { return external; }
+	void setPremultiplied (bool premultipliedp) { premultiplied = premultipliedp; }
+	size_t bytes() const { return (size_t)realWidth * realHeight * EJTexture::bytesPerTexel(format, type); }
 
 	static void setSmoothScaling(bool smoothScaling);
 	static bool smoothScaling();
 
+	// format the textures of images are made in from now on
+	static void setImageTextureFormat (EJImageTextureFormat format);
+	// whether images decoded from now on are premultiplied by their alpha; edges of premultiplied images stay clean
+	// when they are scaled, since filtering never mixes in the color of transparent texels. Off by default
+	static void setPremultipliedAlpha (bool premultiplied);
+	static bool premultipliedAlpha();
+	// type of the texture of an image, by whether all its pixels are opaque
+	static GLenum imageTextureType (bool opaque);
+	// GL_RGB for 565 and GL_RGBA for all other types of rgba pixels
+	static GLenum formatForType (GLenum type);
+	static size_t bytesPerTexel (GLenum format, GLenum type);
+	// converts width x height rgba pixels to realWidth x realHeight texels of a 16 bit type, with an ordered dither so
+	// gradients do not band; the texels beyond the pixels are zero. Thread safe
+	static void packPixels (const GLubyte* pixels, int width, int height, int realWidth, int realHeight, GLenum type, GLushort* texels);
+
 private:
 	const char* fullPath;
 	GLenum format;
+	GLenum type;
+	bool compressed;
+	bool premultiplied;
+	EJTextureUpload* upload;
+	void* eglImage;		// of the hardware buffer the texture samples
+	EJExternalTexture* external;	// whose texture id this one samples, without owning it
 	GLubyte *loadPixelsWithLodePNGFromPath (const char* path);
+	// creates the texture from pixels of width x height, padded to the real size if that is larger
+	void createTextureWithPaddedPixels (const GLubyte* pixels, GLenum format, size_t bytePerPixel);
+	void finishUpload();
 };
 
 #endif
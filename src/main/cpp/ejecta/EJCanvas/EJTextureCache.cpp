@@ -0,0 +1,108 @@
+#include "EJTextureCache.h"
+#include "EJCanvasContext.h"
+#include "EJGLBackend.h"
+
+std::atomic<size_t> EJTextureCache::_byteLimit(EJ_CANVAS_TEXTURE_CACHE_BYTES);
+std::atomic<size_t> EJTextureCache::_totalBytes(0);
+
+EJTextureCache::EJTextureCache (int atlasImageSize, int atlasPageSize, int atlasPages) :
+	_bytes(0), _atlasImageSize(atlasImageSize), _atlas(atlasPageSize, atlasPages), _uploader(NULL) {
+}
+
+EJTextureCache::~EJTextureCache() {
+	this->purge();
+}
+
+void EJTextureCache::purge() {
+	while( !_entries.empty() ) {
+		this->evict(--_entries.end());
+	}
+}
+
+EJImageTexture EJTextureCache::texture (EJImage* image, EJCanvasContext* context) {
+	auto it = _index.find(image);
+	if( it != _index.end() ) {
+		Entry &entry = *it->second;
+		_entries.splice(_entries.begin(), _entries, it->second);
+		if( entry.texture ) {
+			return (EJImageTexture) { entry.texture, 0, 0 };
+		}
+		// the page of the image was reused for others since it was drawn last
+		if( !_atlas.isValid(&entry.slot) ) {
+			_atlas.add(context, image->pixels(), image->width(), image->height(), image->premultiplied(), &entry.slot);
+		}
+		return (EJImageTexture) { _atlas.use(&entry.slot), (float)entry.slot.x, (float)entry.slot.y };
+	}
+
+	// compressed images get a texture of their own, unless the png of the same name has to be drawn instead
+	Entry entry = { image, NULL, { -1, 0, 0, 0 }, 0 };
+	if( image->externalTexture() ) {
+		// sampled where the SurfaceTexture put the frame, like hardware buffers; there are no pixels to fall back to
+		if( !context->glBackend()->supportsExternalTextures() ) {
+			return (EJImageTexture) { NULL, 0, 0 };
+		}
+		entry.texture = EJTexture::initWithExternalTexture(image->externalTexture());
+	}
+	else if( image->hardwareBuffer() ) {
+		// the buffer is sampled where it is, so the texture takes nothing from the budget; a copy of its pixels is
+		// drawn where that is not supported
+		entry.texture = EJTexture::initWithHardwareBuffer(image->hardwareBuffer(), image->width(), image->height());
+		if( entry.texture ) {
+			entry.texture->setPremultiplied(image->premultiplied());
+		}
+		else if( !image->ensurePixels() ) {
+			return (EJImageTexture) { NULL, 0, 0 };
+		}
+	}
+	else if( image->compressed() ) {
+		entry.texture = EJTexture::initWithCompressedImage(image->compressed());
+		if( entry.texture ) {
+			entry.bytes = image->compressed()->bytes();
+		}
+		else if( !image->ensurePixels() ) {
+			return (EJImageTexture) { NULL, 0, 0 };
+		}
+	}
+	if( !entry.texture && (image->width() > _atlasImageSize || image->height() > _atlasImageSize ||
+			!_atlas.add(context, image->pixels(), image->width(), image->height(), image->premultiplied(), &entry.slot)) ) {
+		const GLenum type = EJTexture::imageTextureType(image->opaque());
+		entry.texture = _uploader
+			? _uploader->upload(image, image->width(), image->height(), type)
+			: EJTexture::initWithRGBAPixels(image->width(), image->height(), image->pixels(), type);
+		entry.texture->setPremultiplied(image->premultiplied());
+		entry.bytes = entry.texture->bytes();
+	}
+	image->retain();
+	_entries.push_front(entry);
+	_index[image] = _entries.begin();
+	_bytes += entry.bytes;
+	_totalBytes += entry.bytes;
+
+	// the newest texture is always kept, even if it alone is over the limit; caches that are over the budget with the
+	// textures of others only evict their own
+	if( _totalBytes > _byteLimit && _entries.size() > 1 ) {
+		context->flushBuffers();
+		while( _totalBytes > _byteLimit && _entries.size() > 1 ) {
+			this->evict(--_entries.end());
+		}
+	}
+
+	if( entry.texture ) {
+		return (EJImageTexture) { entry.texture, 0, 0 };
+	}
+	return (EJImageTexture) { _atlas.use(&entry.slot), (float)entry.slot.x, (float)entry.slot.y };
+}
+
+void EJTextureCache::evict (std::list<Entry>::iterator entry) {
+	// images in the atlas stay there until their page is reused
+	_bytes -= entry->bytes;
+	_totalBytes -= entry->bytes;
+	delete entry->texture;
+	entry->image->release();
+	_index.erase(entry->image);
+	_entries.erase(entry);
+}
+
+void EJTextureCache::setByteLimit (size_t byteLimit) {
+	_byteLimit = byteLimit;
+}
@@ -0,0 +1,68 @@
+#ifndef __EJTEXTURECACHE_H
+#define __EJTEXTURECACHE_H	1
+
+#include "EJTexture.h"
+#include "EJImage.h"
+#include "EJImageAtlas.h"
+#include "EJTextureUploader.h"
+
+#include <list>
+#include <unordered_map>
+
+class EJCanvasContext;
+
+typedef struct
+{
+    EJTexture* texture;
+    float x, y;		// top left corner of the image in the texture, in texels
+} EJImageTexture;
+
+/**
+ * Textures of the images canvas contexts have drawn, made on the gl thread the first time an image is drawn
+ * Images of up to atlasImageSize pixels in both directions are packed into the pages of an atlas; larger ones and
+ * compressed images get a texture of their own. Those textures can always be made again, so they share one budget
+ * across all caches: once the textures of all caches exceed it, the cache that makes a texture deletes its least
+ * recently drawn ones. Pending draws of the drawing context are flushed before that, so no batch refers to a deleted
+ * texture. Every entry retains its image.
+ * With an uploader, the pixels of images too large for the atlas are uploaded in the background, between the draw call
+ * that needs them and the flush that binds their texture.
+ * Textures of their own are made in the image texture format of EJTexture; 16 bit ones take half the budget, while
+ * the atlas pages stay 32 bit, as they mix opaque and translucent images.
+ */
+class EJTextureCache {
+public:
+	EJTextureCache (int atlasImageSize, int atlasPageSize, int atlasPages);
+	~EJTextureCache();
+
+	// texture with the pixels of a decoded image, for drawing with context; NULL texture if the image has none
+	EJImageTexture texture (EJImage* image, EJCanvasContext* context);
+
+	size_t bytes() const { return _bytes; }
+	// deletes all textures; images in the atlas stay there until their page is reused. Nothing may be pending to draw
+	void purge();
+	// uploader for the textures of large images, or NULL to upload them right away; it has to outlive the cache
+	void setUploader (EJTextureUploader* uploader) { _uploader = uploader; }
+
+	// budget of the textures of all caches in bytes; lowering it takes effect with the next texture that is made
+	static void setByteLimit (size_t byteLimit);
+	static size_t byteLimit() { return _byteLimit; }
+	static size_t totalBytes() { return _totalBytes; }
+private:
+	struct Entry {
+		EJImage* image;
+		EJTexture* texture;		// null for images in the atlas
+		EJImageAtlasSlot slot;
+		size_t bytes;
+	};
+	void evict (std::list<Entry>::iterator entry);
+
+	std::list<Entry> _entries;		// most recently drawn first
+	std::unordered_map<EJImage*, std::list<Entry>::iterator> _index;
+	size_t _bytes;
+	static std::atomic<size_t> _byteLimit, _totalBytes;
+	int _atlasImageSize;
+	EJImageAtlas _atlas;
+	EJTextureUploader* _uploader;
+};
+
+#endif
@@ -0,0 +1,203 @@
+#include "EJTextureUploader.h"
+#include "EJTexture.h"
+#include "EJGLState.h"
+#include "EJPixelKernels.h"
+
+#include "NdkMisc.h"
+#define LOG_TAG "EJTextureUploader"
+
+#include <algorithm>
+#include <string.h>
+#include <vector>
+
+EJTextureUploader* EJTextureUploader::create() {
+	EGLDisplay display = eglGetCurrentDisplay();
+	EGLContext shared = eglGetCurrentContext();
+	if( display == EGL_NO_DISPLAY || shared == EGL_NO_CONTEXT ) { return NULL; }
+	const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+	if( !extensions || !strstr(extensions, "EGL_KHR_fence_sync") ) {
+		LOGI("EGL_KHR_fence_sync is not supported, textures are uploaded when they are drawn");
+		return NULL;
+	}
+
+	// the worker context has to be of the same config and version to share objects with the current one
+	EGLint configId = 0, version = 1, count = 0;
+	eglQueryContext(display, shared, EGL_CONFIG_ID, &configId);
+	eglQueryContext(display, shared, EGL_CONTEXT_CLIENT_VERSION, &version);
+	const EGLint configAttribs[] = { EGL_CONFIG_ID, configId, EGL_NONE };
+	EGLConfig config;
+	if( !eglChooseConfig(display, configAttribs, &config, 1, &count) || count < 1 ) { return NULL; }
+
+	const EGLint contextAttribs[] = { EGL_CONTEXT_CLIENT_VERSION, version, EGL_NONE };
+	EGLContext context = eglCreateContext(display, config, shared, contextAttribs);
+	if( context == EGL_NO_CONTEXT ) {
+		LOGE("cannot create a shared context for uploads - 0x%x", eglGetError());
+		return NULL;
+	}
+
+	// the worker never draws; without surfaceless contexts it needs a surface to be current anyway
+	EGLSurface surface = EGL_NO_SURFACE;
+	if( !strstr(extensions, "EGL_KHR_surfaceless_context") ) {
+		const EGLint surfaceAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+		surface = eglCreatePbufferSurface(display, config, surfaceAttribs);
+		if( surface == EGL_NO_SURFACE ) {
+			LOGE("cannot create a surface for uploads - 0x%x", eglGetError());
+			eglDestroyContext(display, context);
+			return NULL;
+		}
+	}
+	return new EJTextureUploader(display, context, surface);
+}
+
+EJTextureUploader::EJTextureUploader (EGLDisplay display, EGLContext context, EGLSurface surface) :
+	_display(display), _context(context), _surface(surface), _stopping(false) {
+	_createSync = (PFNEGLCREATESYNCKHRPROC)eglGetProcAddress("eglCreateSyncKHR");
+	_destroySync = (PFNEGLDESTROYSYNCKHRPROC)eglGetProcAddress("eglDestroySyncKHR");
+	_clientWaitSync = (PFNEGLCLIENTWAITSYNCKHRPROC)eglGetProcAddress("eglClientWaitSyncKHR");
+	_thread = std::thread(&EJTextureUploader::worker, this);
+}
+
+EJTextureUploader::~EJTextureUploader() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stopping = true;
+	}
+	_queued.notify_one();
+	_thread.join();
+
+	eglDestroyContext(_display, _context);
+	if( _surface != EGL_NO_SURFACE ) {
+		eglDestroySurface(_display, _surface);
+	}
+}
+
+EJTexture* EJTextureUploader::upload (EJImage *image, int width, int height, GLenum type) {
+	EJTextureUpload *upload = new EJTextureUpload();
+	upload->uploader = this;
+	upload->image = image;
+	upload->type = type;
+	upload->sync = EGL_NO_SYNC_KHR;
+	image->retain();
+
+	EJTexture *texture = EJTexture::initWithUpload(width, height, upload);
+	upload->width = texture->realWidth;
+	upload->height = texture->realHeight;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_queue.push_back(upload);
+	_queued.notify_one();
+	return texture;
+}
+
+GLuint EJTextureUploader::finish (EJTextureUpload *upload) {
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		auto queued = std::find(_queue.begin(), _queue.end(), upload);
+		if( queued != _queue.end() ) {
+			_queue.erase(queued);
+			return 0;
+		}
+		_done.wait(lock, [upload] { return upload->done; });
+	}
+
+	// the fence is usually signaled long before the texture is drawn
+	if( upload->sync != EGL_NO_SYNC_KHR ) {
+		_clientWaitSync(_display, upload->sync, EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, EGL_FOREVER_KHR);
+		_destroySync(_display, upload->sync);
+	}
+	return upload->textureId;
+}
+
+void EJTextureUploader::cancel (EJTextureUpload *upload) {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto queued = std::find(_queue.begin(), _queue.end(), upload);
+		if( queued != _queue.end() ) {
+			_queue.erase(queued);
+		}
+		else if( !upload->done ) {
+			// the worker is uploading it right now
+			upload->cancelled = true;
+			return;
+		}
+	}
+
+	if( upload->sync != EGL_NO_SYNC_KHR ) { _destroySync(_display, upload->sync); }
+	if( upload->textureId ) { glDeleteTextures(1, &upload->textureId); }
+	upload->image->release();
+	delete upload;
+}
+
+void EJTextureUploader::process (EJTextureUpload *upload) {
+	EJImage *image = upload->image;
+	const GLubyte *pixels = image->pixels();
+	std::vector<GLubyte> padded;
+	std::vector<GLushort> texels;
+	if( upload->type != GL_UNSIGNED_BYTE ) {
+		// converting is what takes the time of 16 bit uploads, which is why it is done here
+		texels.resize((size_t)upload->width * upload->height);
+		EJTexture::packPixels(pixels, image->width(), image->height(), upload->width, upload->height, upload->type, texels.data());
+		pixels = (const GLubyte*)texels.data();
+	}
+	else if( upload->width != image->width() || upload->height != image->height() ) {
+		padded.resize((size_t)upload->width * upload->height * 4);
+		EJCopyPixels(pixels, image->width(), image->height(), 4, padded.data(), upload->width, upload->height);
+		pixels = padded.data();
+	}
+
+	// nothing else is bound in this context, so there is no binding to restore
+	const GLint filter = EJTexture::smoothScaling() ? GL_LINEAR : GL_NEAREST;
+	glGenTextures(1, &upload->textureId);
+	EJGLState::bindTexture(upload->textureId);
+	const GLenum format = EJTexture::formatForType(upload->type);
+	if( upload->type != GL_UNSIGNED_BYTE ) { glPixelStorei(GL_UNPACK_ALIGNMENT, 2); }
+	glTexImage2D(GL_TEXTURE_2D, 0, format, upload->width, upload->height, 0, format, upload->type, pixels);
+	if( upload->type != GL_UNSIGNED_BYTE ) { glPixelStorei(GL_UNPACK_ALIGNMENT, 4); }
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	EJGLState::bindTexture(0);
+
+	// the fence is only signaled once the commands before it reach the gpu
+	upload->sync = _createSync(_display, EGL_SYNC_FENCE_KHR, NULL);
+	glFlush();
+}
+
+void EJTextureUploader::worker() {
+	// without a current context the uploads are only marked done, and their textures upload them when they are bound
+	const bool current = eglMakeCurrent(_display, _surface, _surface, _context);
+	if( !current ) {
+		LOGE("cannot make the upload context current - 0x%x", eglGetError());
+	}
+	EJGLState::invalidate();
+
+	for( ;; ) {
+		EJTextureUpload *upload;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_queued.wait(lock, [this] { return _stopping || !_queue.empty(); });
+			if( _queue.empty() ) { break; }
+			upload = _queue.front();
+			_queue.pop_front();
+		}
+		if( current ) {
+			this->process(upload);
+		}
+
+		bool cancelled;
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			upload->done = true;
+			cancelled = upload->cancelled;
+		}
+		if( cancelled ) {
+			this->cancel(upload);
+		}
+		_done.notify_all();
+	}
+
+	if( current ) {
+		eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	}
+}
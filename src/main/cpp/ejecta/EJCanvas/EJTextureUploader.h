@@ -0,0 +1,70 @@
+#ifndef __EJTEXTUREUPLOADER_H
+#define __EJTEXTUREUPLOADER_H	1
+
+#include "EJImage.h"
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+class EJTexture;
+class EJTextureUploader;
+
+// an image on its way into a texture of the worker; owned by the texture it is for
+typedef struct EJTextureUpload {
+	EJTextureUploader *uploader;
+	EJImage *image;			// retained until the pixels are uploaded
+	int width, height;		// of the texture, the image is in its upper left corner
+	GLenum type;			// of the texels the pixels are converted to
+	GLuint textureId;
+	EGLSyncKHR sync;		// signaled once the upload is done on the gpu
+	bool done;				// the worker has issued the upload and the fence
+	bool cancelled;			// the texture was deleted before the upload was done; the worker deletes it
+} EJTextureUpload;
+
+/**
+ * Uploads the pixels of images on a worker thread, with an egl context that shares the objects of the one it was created
+ * with, so large uploads do not hold up the frame that draws them
+ * An upload is pending in its texture until the texture is bound. By then the worker has usually uploaded the pixels and
+ * put a fence behind them; binding only waits for the fence if it is not signaled yet, and takes over the texture.
+ * Uploads are only used with EGL_KHR_fence_sync, without it nothing makes sure another context sees the pixels.
+ */
+class EJTextureUploader {
+public:
+	// uploader that shares with the current egl context; NULL if there is none, or it can not be shared or fenced
+	static EJTextureUploader* create();
+	// deletes the textures of cancelled uploads; all textures with pending uploads have to be deleted before
+	~EJTextureUploader();
+
+	// a texture of width x height texels of type for the pixels of a decoded image, for uploading in the background
+	EJTexture* upload (EJImage *image, int width, int height, GLenum type);
+
+	// waits for an upload to be done and returns its texture id; called by the texture, which deletes the upload
+	GLuint finish (EJTextureUpload *upload);
+	// gives up a pending upload, whose texture is deleted
+	void cancel (EJTextureUpload *upload);
+
+private:
+	EJTextureUploader (EGLDisplay display, EGLContext context, EGLSurface surface);
+	void worker();
+	void process (EJTextureUpload *upload);
+
+	EGLDisplay _display;
+	EGLContext _context;
+	EGLSurface _surface;	// a pbuffer, or EGL_NO_SURFACE with EGL_KHR_surfaceless_context
+	PFNEGLCREATESYNCKHRPROC _createSync;
+	PFNEGLDESTROYSYNCKHRPROC _destroySync;
+	PFNEGLCLIENTWAITSYNCKHRPROC _clientWaitSync;
+
+	std::mutex _mutex;
+	std::condition_variable _queued, _done;
+	std::deque<EJTextureUpload*> _queue;
+	bool _stopping;
+	std::thread _thread;
+};
+
+#endif
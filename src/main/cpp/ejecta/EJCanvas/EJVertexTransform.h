@@ -0,0 +1,49 @@
+#ifndef __EJVERTEXTRANSFORM_H
+#define __EJVERTEXTRANSFORM_H	1
+
+#include "EJCanvasTypes.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define EJ_VERTEX_TRANSFORM_NEON	1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define EJ_VERTEX_TRANSFORM_SSE	1
+#endif
+
+/*
+ * Kernels for the vertices of quads, which are pushed far more than anything else
+ * the corners are kept as four x and four y coordinates, so one transform is a few vector instructions on NEON
+ * (armeabi-v7a, arm64-v8a) and SSE2 (x86, x86_64); other targets transform them one by one
+ */
+
+// applies t to the four points of xs and ys, in place
+static inline void EJTransformPoints4 (float *xs, float *ys, const CGAffineTransform &t) {
+#if defined(EJ_VERTEX_TRANSFORM_NEON)
+	const float32x4_t x = vld1q_f32(xs), y = vld1q_f32(ys);
+	vst1q_f32(xs, vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(t.tx), x, t.a), y, t.c));
+	vst1q_f32(ys, vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(t.ty), x, t.b), y, t.d));
+#elif defined(EJ_VERTEX_TRANSFORM_SSE)
+	const __m128 x = _mm_loadu_ps(xs), y = _mm_loadu_ps(ys);
+	_mm_storeu_ps(xs, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(t.a)), _mm_mul_ps(y, _mm_set1_ps(t.c))), _mm_set1_ps(t.tx)));
+	_mm_storeu_ps(ys, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(t.b)), _mm_mul_ps(y, _mm_set1_ps(t.d))), _mm_set1_ps(t.ty)));
+#else
+	for( int i = 0; i < 4; i++ ) {
+		const float x = xs[i], y = ys[i];
+		xs[i] = t.a * x + t.c * y + t.tx;
+		ys[i] = t.b * x + t.d * y + t.ty;
+	}
+#endif
+}
+
+// writes the two triangles of a quad whose corners 0, 1, 2, 3 are top left, top right, bottom left and bottom right
+static inline void EJWriteQuad (EJVertex *vb, const float *xs, const float *ys, const EJVector2 *uvs, EJColorRGBA color) {
+	const EJVertex v0 = { { xs[0], ys[0] }, uvs[0], color };
+	const EJVertex v1 = { { xs[1], ys[1] }, uvs[1], color };
+	const EJVertex v2 = { { xs[2], ys[2] }, uvs[2], color };
+	const EJVertex v3 = { { xs[3], ys[3] }, uvs[3], color };
+	vb[0] = v0; vb[1] = v1; vb[2] = v2;
+	vb[3] = v1; vb[4] = v2; vb[5] = v3;
+}
+
+#endif
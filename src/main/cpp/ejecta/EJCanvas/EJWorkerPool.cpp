@@ -0,0 +1,87 @@
+#include "EJWorkerPool.h"
+
+#include <algorithm>
+
+EJWorkerPool* EJWorkerPool::shared() {
+	static EJWorkerPool *pool = new EJWorkerPool(std::max(0, std::min((int)std::thread::hardware_concurrency() - 1, EJ_WORKER_POOL_MAX_THREADS)));
+	return pool;
+}
+
+EJWorkerPool::EJWorkerPool (int threads) : _ranges(threads + 1), _generation(0), _active(0), _job(NULL), _data(NULL) {
+	for( int i = 0; i < threads; i++ ) {
+		_threads.push_back(std::thread(&EJWorkerPool::worker, this, i));
+	}
+}
+
+void EJWorkerPool::run (int count, Job job, void *data) {
+	if( count <= 0 ) { return; }
+	if( _threads.empty() || count == 1 ) {
+		for( int i = 0; i < count; i++ ) {
+			job(i, data);
+		}
+		return;
+	}
+
+	std::lock_guard<std::mutex> runLock(_runMutex);
+	const int slots = (int)_ranges.size();
+	for( int i = 0; i < slots; i++ ) {
+		std::lock_guard<std::mutex> lock(_ranges[i].mutex);
+		_ranges[i].begin = (int)((long long)count * i / slots);
+		_ranges[i].end = (int)((long long)count * (i + 1) / slots);
+	}
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_job = job;
+		_data = data;
+		_active = (int)_threads.size();
+		_generation++;
+	}
+	_started.notify_all();
+
+	this->work(slots - 1);
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_finished.wait(lock, [this] { return _active == 0; });
+	_job = NULL;
+	_data = NULL;
+}
+
+void EJWorkerPool::worker (int slot) {
+	unsigned int generation = 0;
+	while( true ) {
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_started.wait(lock, [this, generation] { return _generation != generation; });
+			generation = _generation;
+		}
+
+		this->work(slot);
+
+		std::lock_guard<std::mutex> lock(_mutex);
+		if( --_active == 0 ) {
+			_finished.notify_one();
+		}
+	}
+}
+
+void EJWorkerPool::work (int slot) {
+	const int slots = (int)_ranges.size();
+	int index;
+	while( this->take(_ranges[slot], false, &index) ) {
+		_job(index, _data);
+	}
+	// the others are probably still at the front of theirs
+	for( int i = 1; i < slots; i++ ) {
+		Range &victim = _ranges[(slot + i) % slots];
+		while( this->take(victim, true, &index) ) {
+			_job(index, _data);
+		}
+	}
+}
+
+bool EJWorkerPool::take (Range &range, bool fromBack, int *index) {
+	std::lock_guard<std::mutex> lock(range.mutex);
+	if( range.begin >= range.end ) { return false; }
+	*index = fromBack ? --range.end : range.begin++;
+	return true;
+}
@@ -0,0 +1,58 @@
+#ifndef __EJWORKERPOOL_H
+#define __EJWORKERPOOL_H	1
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// threads of the pool besides the one that runs a job; cores beyond that are left to the ui and the js threads
+#define EJ_WORKER_POOL_MAX_THREADS 3
+
+/**
+ * A few threads for the geometry of large draws, shared by all contexts
+ * A job is a number of items. Every thread, the calling one included, starts on its own contiguous range of them and
+ * takes them from the front; once its range is done it steals from the back of the ranges of the others, so items
+ * of very different cost still keep every thread busy until the end. Items are meant to be coarse, like a whole
+ * subpath, which is why the ranges are guarded by a lock each.
+ * run returns once all items are done; jobs of several contexts run one after the other.
+ */
+class EJWorkerPool {
+public:
+	typedef void (*Job) (int index, void *data);
+
+	// the pool of the process; its threads start with it and are never stopped
+	static EJWorkerPool* shared();
+
+	// threads that work on a job besides the calling one; 0 on single core devices, where run calls the job in place
+	int threadCount() const { return (int)_threads.size(); }
+	// calls job for every index below count, in no particular order and on any of the threads
+	void run (int count, Job job, void *data);
+
+private:
+	typedef struct {
+		std::mutex mutex;
+		int begin, end;
+	} Range;
+
+	explicit EJWorkerPool (int threads);
+	EJWorkerPool (const EJWorkerPool&) = delete;
+	EJWorkerPool& operator= (const EJWorkerPool&) = delete;
+
+	void worker (int slot);
+	void work (int slot);
+	bool take (Range &range, bool fromBack, int *index);
+
+	std::vector<std::thread> _threads;
+	std::vector<Range> _ranges;		// one per thread, the calling one last
+
+	std::mutex _runMutex;			// held for a whole job
+	std::mutex _mutex;
+	std::condition_variable _started, _finished;
+	unsigned int _generation;		// counts the jobs, so a worker starts each one once
+	int _active;					// workers that may still take items of the current job
+	Job _job;
+	void *_data;
+};
+
+#endif
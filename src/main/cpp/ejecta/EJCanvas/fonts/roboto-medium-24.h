@@ -1,2194 +0,0 @@
-/* ============================================================================
- * Freetype GL - A C OpenGL Freetype engine
- * Platform:    Any
- * WWW:         https://github.com/rougier/freetype-gl
- * ----------------------------------------------------------------------------
- * Copyright 2011,2012 Nicolas P. Rougier. All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *
- *  1. Redistributions of source code must retain the above copyright notice,
- *     this list of conditions and the following disclaimer.
- *
- *  2. Redistributions in binary form must reproduce the above copyright
- *     notice, this list of conditions and the following disclaimer in the
- *     documentation and/or other materials provided with the distribution.
- *
- * THIS SOFTWARE IS PROVIDED BY NICOLAS P. ROUGIER ''AS IS'' AND ANY EXPRESS OR
- * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
- * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
- * EVENT SHALL NICOLAS P. ROUGIER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
- * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
- * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *
- * The views and conclusions contained in the software and documentation are
- * those of the authors and should not be interpreted as representing official
- * policies, either expressed or implied, of Nicolas P. Rougier.
- * ============================================================================
- */
-#include <stddef.h>
-#include <stdint.h>
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include "../EJFont.h"
-
-texture_font_t font_roboto_medium_24 = {
- 256, 256, 1, 
- {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,255,255,255,255,0,0,0,248,255,40,0,104,255,64,64,255,104,0,0,0,0,0,0,132,255,43,0,0,189,241,1,
-  0,0,0,0,0,0,0,224,224,0,0,0,0,0,0,0,56,193,242,221,129,6,0,0,0,0,0,0,0,0,0,0,
-  0,0,3,115,213,248,229,174,43,0,0,0,0,0,0,204,212,0,0,0,0,0,0,5,27,0,14,18,0,0,0,0,
-  0,0,0,0,0,0,168,255,8,0,0,0,0,0,0,0,0,0,88,255,216,0,0,0,0,0,0,0,136,255,156,0,
-  112,200,200,200,200,200,31,0,10,177,183,17,0,0,0,0,0,0,0,0,216,242,11,0,0,0,26,149,222,248,239,193,
-  90,0,0,0,0,0,0,0,10,93,188,137,0,0,0,53,167,228,250,240,193,93,0,0,0,0,0,0,60,173,232,251,
-  235,182,75,0,0,0,0,0,0,0,0,0,0,29,242,255,148,0,0,0,0,0,197,255,255,255,255,255,255,255,255,8,
-  0,0,0,0,0,29,130,200,233,236,0,0,0,0,24,255,255,255,255,255,255,255,255,255,255,255,112,0,0,0,0,0,
-  0,255,255,255,255,0,0,0,248,255,40,0,104,255,62,64,255,102,0,0,0,0,0,0,181,245,3,0,0,238,193,0,
-  0,0,0,0,0,0,0,224,224,0,0,0,0,0,0,42,248,252,212,237,255,148,0,0,0,0,0,0,0,0,0,0,
-  0,0,163,255,254,217,230,255,248,59,0,0,0,0,0,204,212,0,0,0,0,0,22,202,150,0,99,229,48,0,0,0,
-  0,0,0,0,0,0,168,255,8,0,0,0,0,0,0,0,0,0,88,255,216,0,0,0,0,0,0,0,136,255,154,0,
-  144,255,255,255,255,255,40,0,70,255,255,89,0,0,0,0,0,0,0,60,255,156,0,0,0,36,232,255,246,207,228,255,
-  255,144,0,0,0,1,63,158,243,255,255,140,0,0,106,252,255,245,211,237,255,255,164,1,0,0,0,119,254,255,238,209,
-  235,255,255,133,0,0,0,0,0,0,0,0,0,182,255,255,148,0,0,0,0,0,224,255,206,200,200,200,200,200,200,6,
-  0,0,0,0,110,246,255,253,220,190,0,0,0,0,18,200,200,200,200,200,200,200,200,200,250,255,76,0,0,0,0,0,
-  0,255,255,255,255,0,0,0,248,255,40,0,104,255,45,64,255,85,0,0,0,0,0,0,230,199,0,0,32,255,143,0,
-  0,0,0,0,0,49,127,244,245,134,42,0,0,0,0,151,254,66,0,10,195,253,11,0,0,8,156,44,0,0,0,0,
-  0,45,255,255,82,0,2,140,255,189,0,0,0,0,0,204,212,0,0,0,0,11,207,248,80,0,36,230,235,35,0,0,
-  0,0,11,14,0,0,168,255,8,0,0,11,0,0,0,0,0,0,88,255,216,0,0,0,0,0,0,0,148,255,130,0,
-  0,0,0,0,0,0,0,0,22,220,226,33,0,0,0,0,0,0,0,159,255,57,0,0,0,187,255,179,14,0,0,91,
-  252,255,61,0,0,222,255,255,242,231,255,140,0,55,253,255,123,4,0,1,110,255,255,91,0,0,61,255,254,103,2,0,
-  1,96,254,255,54,0,0,0,0,0,0,0,93,255,255,255,148,0,0,0,0,0,249,255,12,0,0,0,0,0,0,0,
-  0,0,0,112,255,243,115,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,255,218,2,0,0,0,0,0,
-  0,255,255,255,255,0,0,0,248,255,40,0,104,255,24,64,255,64,0,0,0,0,0,23,255,150,0,0,82,255,94,0,
-  0,0,0,1,137,254,255,255,255,255,252,116,0,0,0,191,227,0,0,0,110,255,49,0,0,141,247,40,0,0,0,0,
-  0,98,255,211,0,0,0,35,255,223,0,0,0,0,0,204,212,0,0,0,0,156,255,97,0,0,0,55,253,206,3,0,
-  0,0,95,246,163,66,169,255,27,110,207,168,0,0,0,0,0,0,88,255,216,0,0,0,0,0,0,0,206,255,62,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,244,214,0,0,0,34,255,247,19,0,0,0,0,
-  159,255,163,0,0,252,184,90,10,164,255,140,0,165,255,169,0,0,0,0,0,171,255,177,0,0,158,255,164,0,0,0,
-  0,0,181,255,136,0,0,0,0,0,0,23,237,243,184,255,148,0,0,0,0,20,255,241,0,0,0,0,0,0,0,0,
-  0,0,38,248,240,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,168,255,106,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,248,255,40,0,104,254,4,64,255,43,0,0,0,0,0,72,255,100,0,0,131,255,44,0,
-  0,0,0,110,255,237,89,18,28,134,255,255,70,0,0,183,232,0,0,0,117,255,46,0,61,253,116,0,0,0,0,0,
-  0,90,255,220,0,0,0,88,255,180,0,0,0,0,0,204,212,0,0,0,55,254,182,0,0,0,0,0,147,255,108,0,
-  0,0,96,222,255,255,254,255,250,255,252,179,0,0,0,0,0,0,88,255,216,0,0,0,0,0,0,66,255,198,1,0,
-  0,0,38,157,225,250,241,194,95,1,0,0,0,0,0,0,0,0,100,255,117,0,0,0,97,255,188,0,0,0,0,0,
-  78,255,223,0,0,24,0,0,0,164,255,140,0,216,255,95,0,0,0,0,0,109,255,199,0,0,90,124,57,0,0,0,
-  0,0,143,255,159,0,0,0,0,0,0,171,255,108,156,255,148,0,0,0,0,46,255,214,0,0,0,0,0,0,0,0,
-  0,0,151,255,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,252,237,10,0,0,0,0,0,0,
-  0,39,229,209,12,0,0,0,248,255,40,0,104,238,0,64,255,22,0,0,184,255,255,255,255,255,255,255,255,255,255,255,
-  120,0,0,219,255,101,0,0,0,0,166,255,185,0,0,135,255,119,12,44,220,246,7,11,221,197,2,0,0,0,0,0,
-  0,20,245,255,81,0,80,241,248,53,0,0,0,0,0,204,212,0,0,0,199,255,49,0,0,0,0,0,28,250,237,14,
-  0,0,0,0,43,151,255,255,202,91,18,0,0,0,0,0,0,0,88,255,216,0,0,0,0,0,0,60,202,37,0,0,
-  0,64,246,255,247,212,232,255,255,169,1,0,0,0,0,0,0,0,198,251,23,0,0,0,136,255,151,0,0,0,0,0,
-  39,255,254,4,0,0,0,0,0,164,255,140,0,43,48,13,0,0,0,0,0,123,255,165,0,0,0,0,0,0,0,0,
-  0,0,189,255,118,0,0,0,0,0,82,255,196,1,156,255,148,0,0,0,0,72,255,187,0,0,0,0,0,0,0,0,
-  0,2,239,248,21,107,175,193,166,80,0,0,0,0,0,0,0,0,0,0,0,0,149,255,133,0,0,0,0,0,0,0,
-  0,102,255,255,57,0,0,0,248,255,40,0,0,0,0,0,0,0,0,0,117,164,164,231,250,164,164,164,252,230,164,164,
-  76,0,7,255,255,41,0,0,0,0,68,255,243,0,0,19,229,255,255,255,255,112,0,151,246,37,0,0,0,0,0,0,
-  0,0,111,255,236,166,255,239,71,0,0,0,0,0,0,0,0,0,0,50,255,197,0,0,0,0,0,0,0,168,255,101,
-  0,0,0,0,4,201,249,235,230,20,0,0,0,24,255,255,255,255,255,255,255,255,255,255,255,156,0,0,0,0,0,0,
-  3,225,255,177,18,0,0,93,253,255,91,0,0,0,0,0,0,41,255,176,0,0,0,0,152,255,138,0,0,0,0,0,
-  24,255,255,17,0,0,0,0,0,164,255,140,0,0,0,0,0,0,0,0,2,211,255,77,0,0,0,0,0,0,0,0,
-  8,128,255,227,15,0,0,0,0,17,231,248,40,0,156,255,148,0,0,0,0,99,255,202,169,228,249,227,155,31,0,0,
-  0,41,255,229,214,255,255,255,255,255,161,2,0,0,0,0,0,0,0,0,0,21,246,249,25,0,0,0,0,0,0,0,
-  0,26,190,171,6,0,0,0,248,255,40,0,0,0,0,0,0,0,0,0,0,0,0,226,201,0,0,30,255,145,0,0,
-  0,0,6,254,255,61,0,0,0,0,25,168,168,4,0,0,20,137,186,167,76,0,69,255,112,0,0,0,0,0,0,0,
-  0,0,0,193,255,255,199,33,0,0,0,0,0,0,0,0,0,0,0,147,255,110,0,0,0,0,0,0,0,87,255,196,
-  0,0,0,0,133,255,127,86,255,179,0,0,0,18,200,200,200,200,219,255,247,200,200,200,200,121,0,0,91,243,157,0,
-  52,255,253,17,0,0,0,0,157,255,170,0,0,0,0,0,0,140,255,77,0,0,0,0,159,255,136,0,0,0,0,0,
-  20,255,255,24,0,0,0,0,0,164,255,140,0,0,0,0,0,0,0,0,117,255,202,2,0,0,0,0,0,87,200,210,
-  244,255,197,36,0,0,0,0,0,160,255,123,0,0,156,255,148,0,0,0,0,125,255,255,248,214,226,255,255,236,46,0,
-  0,83,255,255,246,115,24,14,106,250,255,108,0,0,0,0,0,0,0,0,0,130,255,160,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,248,255,40,0,0,0,0,0,0,0,0,0,0,0,29,255,143,0,0,89,255,87,0,0,
-  0,0,0,208,255,188,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,227,194,1,0,0,0,0,0,0,0,
-  0,2,139,255,255,255,198,8,0,0,0,0,0,0,0,0,0,0,0,220,255,47,0,0,0,0,0,0,0,15,254,254,
-  14,0,0,56,253,214,6,0,177,255,108,0,0,0,0,0,0,0,88,255,216,0,0,0,0,0,0,0,170,255,245,0,
-  66,255,236,0,0,0,0,0,116,255,185,0,0,0,0,0,5,233,231,4,0,0,0,0,160,255,136,0,0,0,0,0,
-  20,255,255,24,0,0,0,0,0,164,255,140,0,0,0,0,0,0,0,69,251,247,44,0,0,0,0,0,0,112,255,255,
-  255,255,174,36,0,0,0,0,71,255,208,4,0,0,156,255,148,0,0,0,0,69,174,145,17,0,0,44,212,255,211,1,
-  0,101,255,255,73,0,0,0,0,127,255,228,2,0,0,0,0,0,0,0,11,237,255,46,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,248,255,40,0,0,0,0,0,0,0,0,0,0,0,87,255,85,0,0,147,255,29,0,0,
-  0,0,0,86,255,255,218,97,9,0,0,0,0,0,0,0,0,0,0,0,0,161,244,35,21,161,232,233,167,25,0,0,
-  0,164,255,229,72,216,255,169,1,0,39,255,211,0,0,0,0,0,18,255,251,4,0,0,0,0,0,0,0,0,223,255,
-  67,0,0,7,144,59,0,0,27,186,31,0,0,0,0,0,0,0,88,255,216,0,0,0,0,0,0,0,68,204,123,0,
-  24,250,255,40,0,0,0,0,176,255,137,0,0,0,0,0,81,255,137,0,0,0,0,0,160,255,136,0,0,0,0,0,
-  20,255,255,23,0,0,0,0,0,164,255,140,0,0,0,0,0,0,48,241,254,87,0,0,0,0,0,0,0,0,0,11,
-  49,164,255,233,31,0,0,13,225,252,51,0,0,0,156,255,148,0,0,0,0,0,0,0,0,0,0,0,42,251,255,61,
-  0,113,255,201,0,0,0,0,0,16,254,255,43,0,0,0,0,0,0,0,111,255,186,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,248,255,40,0,0,0,0,0,0,0,0,121,200,200,226,255,210,200,200,239,254,200,200,118,
-  0,0,0,0,115,251,255,255,240,150,36,0,0,0,0,0,0,0,0,0,79,255,107,3,206,255,225,222,255,214,6,0,
-  86,255,239,36,0,36,236,255,136,0,70,255,188,0,0,0,0,0,65,255,224,0,0,0,0,0,0,0,0,0,180,255,
-  115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,255,216,0,0,0,0,0,0,0,0,0,0,0,
-  0,138,255,214,66,11,30,140,255,230,25,0,0,0,0,0,179,255,39,0,0,0,0,0,154,255,140,0,0,0,0,0,
-  22,255,255,14,0,0,0,0,0,164,255,140,0,0,0,0,0,36,232,255,120,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,179,255,154,0,0,149,255,138,0,0,0,0,156,255,148,0,0,0,0,0,0,0,0,0,0,0,0,202,255,114,
-  0,112,255,195,0,0,0,0,0,0,228,255,74,0,0,0,0,0,0,4,225,255,72,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,248,255,40,0,0,0,0,0,0,0,0,156,255,255,255,255,255,255,255,255,255,255,255,152,
-  0,0,0,0,0,41,161,245,255,255,249,118,0,0,0,0,0,0,0,20,232,189,1,72,255,144,1,0,131,255,86,0,
-  177,255,132,0,0,0,61,249,255,100,148,255,134,0,0,0,0,0,86,255,210,0,0,0,0,0,0,0,0,0,161,255,
-  135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,255,216,0,0,0,0,0,0,0,0,0,0,0,
-  0,1,121,252,255,255,255,255,196,37,0,0,0,0,0,26,252,196,0,0,0,0,0,0,138,255,157,0,0,0,0,0,
-  37,255,251,2,0,0,0,0,0,164,255,140,0,0,0,0,25,222,255,136,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,94,255,212,0,54,254,255,208,200,200,200,200,234,255,232,200,187,0,0,0,0,0,0,0,0,0,0,173,255,131,
-  0,95,255,224,0,0,0,0,0,0,221,255,75,0,0,0,0,0,0,92,255,212,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,200,0,0,32,255,144,0,0,0,
-  0,0,0,0,0,0,0,11,97,217,255,255,103,0,0,0,0,0,0,170,243,32,0,113,255,48,0,0,32,255,127,0,
-  200,255,106,0,0,0,0,93,255,251,243,255,45,0,0,0,0,0,103,255,204,0,0,0,0,0,0,0,0,0,147,255,
-  152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,255,216,0,0,0,0,0,0,0,0,0,0,0,
-  0,23,186,255,249,213,235,255,232,82,0,0,0,0,0,121,255,98,0,0,0,0,0,0,101,255,200,0,0,0,0,0,
-  75,255,215,0,0,0,0,0,0,164,255,140,0,0,0,16,209,255,150,0,0,0,0,0,0,0,161,184,63,0,0,0,
-  0,0,85,255,221,0,96,255,255,255,255,255,255,255,255,255,255,255,240,0,22,164,155,0,0,0,0,0,0,201,255,115,
-  0,50,255,252,23,0,0,0,0,5,250,255,47,0,0,0,0,0,0,210,255,99,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,255,152,0,0,80,255,96,0,0,0,
-  0,0,0,0,0,0,0,0,0,6,180,255,228,2,0,0,0,0,89,255,103,0,0,112,255,48,0,0,32,255,129,0,
-  165,255,170,0,0,0,0,0,132,255,255,167,0,0,0,0,0,0,104,255,207,0,0,0,0,0,0,0,0,0,142,255,
-  157,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  5,206,255,162,14,0,0,80,240,252,71,0,0,0,0,218,243,12,0,0,0,0,0,0,37,255,252,32,0,0,0,0,
-  156,255,150,0,0,0,0,0,0,164,255,140,0,0,9,195,255,164,1,0,0,0,0,0,0,0,189,255,145,0,0,0,
-  0,0,145,255,179,0,0,0,0,0,0,0,0,0,156,255,148,0,0,0,5,242,255,58,0,0,0,0,34,250,255,62,
-  0,2,222,255,131,0,0,0,0,95,255,235,3,0,0,0,0,0,73,255,232,7,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,12,23,0,0,0,0,0,0,0,0,0,0,0,72,255,104,0,0,128,255,48,0,0,0,
-  0,0,78,112,54,0,0,0,0,0,35,255,255,31,0,0,0,0,171,186,0,0,0,71,255,146,1,0,126,255,87,0,
-  64,255,255,121,6,0,0,47,196,255,255,219,15,0,0,0,0,0,88,255,219,0,0,0,0,0,0,0,0,0,152,255,
-  140,0,0,0,46,163,227,249,225,150,24,0,0,0,0,0,0,0,0,0,0,0,20,128,93,0,0,0,0,0,0,0,
-  93,255,216,5,0,0,0,0,103,255,212,0,0,0,62,255,157,0,0,0,0,0,0,0,0,189,255,196,22,0,0,85,
-  251,254,50,0,0,0,0,0,0,164,255,140,0,4,179,255,176,4,0,0,0,0,0,0,0,0,91,255,252,99,1,0,
-  0,90,250,255,77,0,0,0,0,0,0,0,0,0,156,255,148,0,0,0,0,145,255,218,46,0,0,30,201,255,212,1,
-  0,0,95,255,249,81,0,0,47,230,255,122,0,0,0,0,0,0,192,255,126,0,0,0,0,0,0,0,0,0,0,0,
-  0,24,189,169,5,0,0,11,236,254,72,0,0,0,0,0,0,0,0,0,0,120,255,56,0,0,176,250,6,0,0,0,
-  0,0,165,255,150,0,0,0,0,0,12,255,255,39,0,0,0,0,0,13,0,0,0,3,203,255,226,220,255,215,7,0,
-  0,121,254,255,244,210,224,255,255,215,210,255,176,1,0,0,0,0,70,255,236,0,0,0,0,0,0,0,0,0,170,255,
-  122,0,0,81,247,255,237,207,243,255,233,40,0,0,0,0,0,0,0,0,32,146,245,255,112,0,0,0,0,0,0,0,
-  155,255,147,0,0,0,0,0,25,255,255,21,0,0,160,255,58,0,0,0,0,0,0,0,0,37,233,255,249,208,225,255,
-  255,133,0,0,0,0,0,0,0,164,255,140,0,125,255,255,207,200,200,200,200,200,200,200,121,0,0,150,255,255,238,209,
-  237,255,255,137,0,0,0,0,0,0,0,0,0,0,156,255,148,0,0,0,0,13,199,255,254,222,218,253,255,234,46,0,
-  0,0,0,149,255,255,221,213,254,255,181,4,0,0,0,0,0,54,255,246,20,0,0,0,0,0,0,0,0,0,0,0,
-  0,102,255,255,57,0,0,8,211,238,57,0,0,0,0,0,0,0,0,0,0,168,253,10,0,0,224,208,0,0,0,0,
-  0,0,111,255,228,11,0,0,0,0,84,255,247,8,0,0,0,0,0,0,0,0,0,0,20,159,231,235,169,25,0,0,
-  0,0,60,170,230,251,239,193,107,9,39,245,255,120,0,0,0,0,27,255,255,16,0,0,0,0,0,0,0,0,202,255,
-  78,0,26,240,255,135,5,0,13,174,255,208,3,0,0,0,0,0,47,165,251,255,255,192,50,0,0,0,0,0,0,0,
-  167,255,142,0,0,0,0,0,19,255,255,34,0,14,245,215,0,0,0,0,0,0,0,0,0,0,27,150,223,249,240,191,
-  85,0,0,0,0,0,0,0,0,164,255,140,0,148,255,255,255,255,255,255,255,255,255,255,156,0,0,0,76,181,236,251,
-  235,179,71,0,0,0,0,0,0,0,0,0,0,0,156,255,148,0,0,0,0,0,6,114,204,245,248,219,146,27,0,0,
-  0,0,0,0,86,194,243,245,205,108,4,0,0,0,0,0,0,173,255,153,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,43,231,213,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,18,237,255,194,56,11,26,101,238,255,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,229,255,59,0,0,0,0,0,0,0,4,246,255,
-  24,0,121,255,202,1,0,0,0,11,235,255,80,0,0,0,64,183,255,255,241,148,42,0,0,0,0,0,65,168,126,0,
-  126,255,206,2,0,0,0,0,86,255,243,6,0,102,255,118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,43,200,200,200,200,200,200,200,200,200,112,0,95,137,28,0,0,0,0,0,0,0,0,0,220,255,
-  100,0,0,63,239,255,255,255,255,255,255,174,11,0,0,0,0,29,152,224,250,239,186,70,0,0,0,0,0,0,0,0,
-  0,63,154,213,243,250,234,193,123,26,0,0,0,0,0,0,0,0,0,163,255,125,0,0,0,0,0,0,0,55,255,213,
-  0,0,182,255,115,0,0,0,0,0,135,255,159,0,20,201,255,255,210,105,12,0,0,0,0,0,0,0,100,255,192,0,
-  32,248,255,147,9,0,0,62,231,255,148,0,0,87,128,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,255,
-  244,12,0,0,0,0,0,0,0,4,255,255,255,255,255,254,241,206,133,20,0,0,0,0,0,0,13,107,196,231,249,228,
-  171,66,0,0,0,0,4,255,255,255,255,255,234,204,130,30,0,0,0,0,0,4,255,255,255,255,255,255,255,255,255,255,
-  184,0,4,255,255,255,255,255,255,255,255,255,255,144,0,0,0,0,16,126,203,238,250,231,181,88,1,0,0,0,0,0,
-  0,0,0,0,0,0,56,255,255,255,255,255,255,255,255,255,144,0,112,255,250,165,51,0,0,0,0,0,0,0,220,255,
-  100,0,0,0,22,124,188,255,235,151,76,0,0,0,0,0,45,238,255,246,211,234,255,254,101,0,0,0,0,0,0,34,
-  191,255,255,242,210,207,227,253,255,247,123,2,0,0,0,0,0,0,0,68,255,201,0,0,0,0,0,0,0,136,255,118,
-  0,0,205,255,88,0,0,0,0,0,93,255,205,0,40,255,255,169,16,0,0,0,0,0,0,0,0,0,105,255,177,0,
-  0,90,250,255,246,211,230,255,255,194,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,255,
-  255,99,0,0,0,0,0,0,0,4,255,255,213,200,200,202,227,254,255,232,38,0,0,0,0,43,222,255,255,220,210,244,
-  255,255,148,1,0,0,4,255,255,213,200,200,215,248,255,249,105,0,0,0,0,4,255,255,213,200,200,200,200,200,200,200,
-  143,0,4,255,255,213,200,200,200,200,200,200,200,112,0,0,0,56,235,255,255,220,209,240,255,255,187,12,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,167,248,255,255,193,79,2,0,0,0,0,220,255,
-  100,0,0,0,0,0,16,255,172,0,0,0,0,0,0,0,196,255,183,17,0,1,131,255,243,16,0,0,0,0,60,241,
-  254,165,57,2,0,0,0,17,89,212,255,164,2,0,0,0,0,0,0,2,220,255,47,0,0,0,0,0,5,230,247,24,
-  0,0,189,255,116,0,0,0,0,0,69,255,224,0,10,139,242,255,245,157,53,0,0,0,0,0,0,0,143,255,128,0,
-  0,0,47,162,227,250,242,197,106,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,254,253,
-  255,197,0,0,0,0,0,0,0,4,255,255,60,0,0,0,0,44,217,255,187,0,0,0,23,236,255,184,35,0,0,2,
-  99,244,255,120,0,0,4,255,255,60,0,0,0,12,110,246,255,120,0,0,0,4,255,255,60,0,0,0,0,0,0,0,
-  0,0,4,255,255,60,0,0,0,0,0,0,0,0,0,0,32,241,255,179,31,0,0,1,81,234,255,169,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,113,214,255,255,219,108,11,0,0,220,255,
-  100,0,0,0,0,0,16,255,172,0,0,0,0,0,0,12,255,255,42,0,0,0,3,236,255,76,0,0,0,40,242,241,
-  70,0,0,0,0,0,0,0,0,3,153,255,117,0,0,0,0,0,0,0,82,255,173,0,0,0,0,0,101,255,131,0,
-  0,0,134,255,202,0,0,0,0,0,142,255,230,0,0,0,15,121,232,255,255,205,101,11,0,0,0,8,231,249,34,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,255,156,
-  235,255,40,0,0,0,0,0,0,4,255,255,60,0,0,0,0,0,79,255,253,11,0,0,169,255,196,5,0,0,0,0,
-  0,98,255,244,13,0,4,255,255,60,0,0,0,0,0,66,253,250,48,0,0,4,255,255,60,0,0,0,0,0,0,0,
-  0,0,4,255,255,60,0,0,0,0,0,0,0,0,0,0,173,255,194,4,0,0,0,0,0,65,255,255,46,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,161,246,255,238,92,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,28,28,1,0,0,0,0,212,255,92,0,0,2,206,250,59,
-  0,0,0,0,0,0,0,0,0,0,0,181,244,21,0,0,0,0,0,0,0,187,255,72,0,0,0,22,233,226,11,0,
-  0,0,38,249,255,128,3,0,11,135,255,255,219,0,0,0,0,0,8,104,220,255,255,241,78,0,0,69,251,121,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,0,1,224,255,61,
-  149,255,138,0,0,0,0,0,0,4,255,255,60,0,0,0,0,0,44,255,255,28,0,20,251,255,57,0,0,0,0,0,
-  0,6,242,255,85,0,4,255,255,60,0,0,0,0,0,0,156,255,162,0,0,4,255,255,60,0,0,0,0,0,0,0,
-  0,0,4,255,255,60,0,0,0,0,0,0,0,0,0,23,252,255,59,0,0,0,0,0,0,0,197,236,110,0,0,0,
-  0,0,0,0,0,0,43,200,200,200,200,200,200,200,200,200,112,0,0,0,0,0,0,0,5,100,246,255,148,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,100,0,0,0,0,0,0,0,0,13,249,255,56,0,0,97,255,127,0,
-  0,0,0,75,201,247,227,140,12,0,0,31,252,121,0,0,0,0,0,0,0,25,229,237,44,0,12,195,248,58,0,0,
-  0,0,0,111,255,255,234,208,244,253,183,255,204,0,0,0,0,0,0,0,3,86,205,255,112,0,0,0,36,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,225,1,
-  58,255,231,4,0,0,0,0,0,4,255,255,60,0,0,0,0,0,95,255,242,3,0,94,255,231,0,0,0,0,0,0,
-  0,0,110,140,67,0,4,255,255,60,0,0,0,0,0,0,59,255,243,8,0,4,255,255,60,0,0,0,0,0,0,0,
-  0,0,4,255,255,60,0,0,0,0,0,0,0,0,0,83,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,56,255,255,255,255,255,255,255,255,255,144,0,0,0,0,0,37,137,233,255,254,179,51,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,100,0,0,0,0,0,0,0,0,151,255,214,1,0,0,208,238,10,0,
-  0,0,108,255,252,210,231,255,197,0,0,0,179,204,0,0,0,0,0,0,0,0,43,228,163,0,107,247,78,0,0,0,
-  0,0,0,0,77,192,240,241,183,57,111,255,169,0,0,0,0,0,0,0,0,0,0,68,67,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,0,166,255,135,0,
-  0,222,255,79,0,0,0,0,0,4,255,255,60,0,0,0,0,65,235,255,121,0,0,127,255,187,0,0,0,0,0,0,
-  0,0,0,0,0,0,4,255,255,60,0,0,0,0,0,0,8,253,255,40,0,4,255,255,60,0,0,0,0,0,0,0,
-  0,0,4,255,255,60,0,0,0,0,0,0,0,0,0,122,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,89,190,254,255,246,152,39,0,0,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,100,0,0,0,0,0,0,0,118,255,251,62,0,0,34,255,151,0,0,
-  0,47,252,227,42,0,1,236,209,0,0,0,110,252,12,0,0,0,0,0,0,0,0,22,48,0,25,45,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,157,255,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,16,247,255,45,0,
-  0,131,255,177,0,0,0,0,0,4,255,255,213,200,200,202,230,255,246,122,0,0,0,150,255,171,0,0,0,0,0,0,
-  0,0,0,0,0,0,4,255,255,60,0,0,0,0,0,0,0,239,255,67,0,4,255,255,213,200,200,200,200,200,200,128,
-  0,0,4,255,255,60,0,0,0,0,0,0,0,0,0,138,255,179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,4,255,255,60,0,0,0,0,0,1,162,255,237,40,0,0,0,74,236,255,255,231,124,19,0,0,0,0,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,100,0,0,0,0,0,0,102,255,254,98,0,0,0,94,255,84,0,0,
-  0,179,255,77,0,0,3,253,184,0,0,0,61,255,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,9,236,255,40,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,106,255,210,0,0,
-  0,40,255,251,23,0,0,0,0,4,255,255,255,255,255,255,255,255,245,144,8,0,0,156,255,168,0,0,0,0,0,0,
-  0,0,0,0,0,0,4,255,255,60,0,0,0,0,0,0,0,232,255,80,0,4,255,255,255,255,255,255,255,255,255,164,
-  0,0,4,255,255,255,255,255,255,255,255,255,104,0,0,144,255,176,0,0,0,0,121,200,200,200,200,200,115,0,0,0,
-  0,4,255,255,60,0,0,0,0,0,138,255,246,58,0,0,0,0,112,255,210,97,6,0,0,0,0,0,0,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,100,0,0,0,0,0,41,249,255,105,0,0,0,0,134,255,42,0,0,
-  20,251,217,1,0,0,25,255,159,0,0,0,38,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,151,255,188,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,205,255,119,0,0,
-  0,0,205,255,118,0,0,0,0,4,255,255,60,0,0,0,18,68,207,255,182,0,0,151,255,170,0,0,0,0,0,0,
-  0,0,0,0,0,0,4,255,255,60,0,0,0,0,0,0,0,241,255,67,0,4,255,255,60,0,0,0,0,0,0,0,
-  0,0,4,255,255,213,200,200,200,200,200,200,81,0,0,138,255,181,0,0,0,0,156,255,255,255,255,255,148,0,0,0,
-  0,4,255,255,60,0,0,0,0,113,255,252,79,0,0,0,0,0,66,69,0,0,0,0,0,0,0,0,0,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,100,0,0,0,0,0,146,255,194,0,0,0,0,0,152,255,22,0,0,
-  80,255,151,0,0,0,48,255,133,0,0,0,25,255,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,48,177,255,242,36,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,0,0,46,255,254,30,0,0,
-  0,0,114,255,215,0,0,0,0,4,255,255,60,0,0,0,0,0,27,244,255,70,0,135,255,186,0,0,0,0,0,0,
-  0,0,0,0,0,0,4,255,255,60,0,0,0,0,0,0,11,254,255,40,0,4,255,255,60,0,0,0,0,0,0,0,
-  0,0,4,255,255,60,0,0,0,0,0,0,0,0,0,114,255,202,0,0,0,0,0,0,0,0,168,255,148,0,0,0,
-  0,4,255,255,60,0,0,0,90,254,255,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,100,0,0,0,0,0,190,255,122,0,0,0,0,0,156,255,24,0,0,
-  122,255,105,0,0,0,72,255,108,0,0,0,45,255,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,84,208,235,255,255,223,48,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,213,200,200,200,200,200,200,200,209,255,255,24,0,0,0,0,0,0,0,0,0,0,0,145,255,255,255,255,255,
-  255,255,255,255,255,58,0,0,0,4,255,255,60,0,0,0,0,0,0,197,255,130,0,95,255,230,0,0,0,0,0,0,
-  0,0,97,124,59,0,4,255,255,60,0,0,0,0,0,0,66,255,244,8,0,4,255,255,60,0,0,0,0,0,0,0,
-  0,0,4,255,255,60,0,0,0,0,0,0,0,0,0,78,255,247,7,0,0,0,0,0,0,0,168,255,148,0,0,0,
-  0,4,255,255,60,0,0,68,250,255,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,100,0,0,0,0,0,75,96,36,0,0,0,0,0,145,255,44,0,0,
-  142,255,86,0,0,0,95,255,85,0,0,0,84,255,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,108,246,226,177,100,6,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,255,255,255,255,255,255,255,255,255,255,255,24,0,0,0,0,0,0,0,0,0,0,6,236,255,228,220,220,220,
-  220,220,220,240,255,157,0,0,0,4,255,255,60,0,0,0,0,0,0,189,255,142,0,31,254,255,56,0,0,0,0,0,
-  0,6,241,255,85,0,4,255,255,60,0,0,0,0,0,0,168,255,164,0,0,4,255,255,60,0,0,0,0,0,0,0,
-  0,0,4,255,255,60,0,0,0,0,0,0,0,0,0,9,243,255,92,0,0,0,0,0,0,0,168,255,148,0,0,0,
-  0,4,255,255,60,0,50,242,255,156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,100,0,0,0,0,0,0,0,0,0,0,0,0,0,118,255,66,0,0,
-  134,255,103,0,0,0,176,255,84,0,0,0,186,244,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,0,85,255,243,12,0,0,0,
-  0,0,0,88,255,243,11,0,0,4,255,255,60,0,0,0,0,0,17,239,255,102,0,0,178,255,191,3,0,0,0,0,
-  0,97,255,244,12,0,4,255,255,60,0,0,0,0,0,84,255,251,52,0,0,4,255,255,60,0,0,0,0,0,0,0,
-  0,0,4,255,255,60,0,0,0,0,0,0,0,0,0,0,145,255,228,22,0,0,0,0,0,0,168,255,148,0,0,0,
-  0,4,255,255,60,35,232,255,180,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,100,0,0,0,0,0,5,29,0,0,0,0,0,0,77,255,124,0,0,
-  88,255,200,8,0,109,255,255,160,0,1,112,255,148,0,0,4,255,255,253,29,0,0,0,0,0,0,0,0,0,36,254,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,0,183,255,158,0,0,0,0,
-  0,0,0,7,236,255,97,0,0,4,255,255,60,0,0,0,0,29,187,255,240,19,0,0,33,242,255,172,25,0,0,4,
-  99,243,255,118,0,0,4,255,255,60,0,0,0,20,130,251,255,125,0,0,0,4,255,255,60,0,0,0,0,0,0,0,
-  0,0,4,255,255,60,0,0,0,0,0,0,0,0,0,0,11,218,255,216,63,0,0,0,9,107,247,255,123,0,0,0,
-  0,4,255,255,82,220,255,246,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,100,0,0,0,0,0,192,255,126,0,0,0,0,0,19,253,194,0,0,
-  9,228,255,238,221,254,99,238,255,220,227,255,214,16,0,0,4,255,255,255,129,0,0,0,0,0,0,0,0,0,138,255,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,27,253,255,59,0,0,0,0,
-  0,0,0,0,143,255,196,0,0,4,255,255,213,200,200,200,220,252,255,245,75,0,0,0,0,58,236,255,252,214,214,245,
-  255,255,143,0,0,0,4,255,255,213,200,201,219,253,255,250,110,0,0,0,0,4,255,255,213,200,200,200,200,200,200,200,
-  165,0,4,255,255,60,0,0,0,0,0,0,0,0,0,0,0,26,199,255,255,232,204,215,250,255,254,152,2,0,0,0,
-  0,4,255,255,237,255,255,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,255,
-  100,0,0,0,0,0,0,0,0,0,0,228,255,99,0,0,0,0,0,165,246,103,0,0,0,0,0,0,188,254,51,0,
-  0,45,198,248,213,83,0,57,203,248,230,149,19,0,0,0,4,255,255,255,228,3,0,0,0,0,0,0,0,6,234,255,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,123,255,216,0,0,0,0,0,
-  0,0,0,0,42,255,255,39,0,4,255,255,255,255,255,255,247,217,149,36,0,0,0,0,0,0,18,131,209,243,248,224,
-  164,60,0,0,0,0,4,255,255,255,255,254,233,203,130,31,0,0,0,0,0,4,255,255,255,255,255,255,255,255,255,255,
-  212,0,4,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,4,86,182,225,249,237,209,145,50,0,0,0,0,0,
-  0,4,255,255,255,212,106,255,255,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,73,216,202,0,0,0,0,0,2,248,255,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,255,197,3,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,228,255,79,0,0,0,0,0,0,0,88,255,225,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,4,255,255,218,24,0,148,255,243,40,0,0,0,0,0,0,4,255,255,147,0,0,0,0,0,0,0,36,255,255,24,
-  0,0,54,255,255,39,0,0,0,0,62,255,255,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,179,255,176,
-  9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,130,255,182,0,0,0,0,0,0,0,191,255,126,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,0,9,100,194,231,245,215,156,47,0,0,0,0,0,
-  4,255,255,255,255,255,255,251,231,180,85,0,0,0,0,0,0,0,15,113,200,235,243,211,143,34,0,0,0,0,0,8,
-  255,255,255,255,255,254,242,207,138,28,0,0,0,0,0,0,0,19,129,205,242,248,224,165,66,0,0,0,0,108,255,255,
-  255,255,255,255,255,255,255,255,255,255,200,0,88,255,224,0,0,0,0,0,0,0,68,255,252,0,25,224,206,8,0,0,
-  0,4,255,255,67,0,0,6,202,255,212,10,0,0,0,0,0,4,255,255,254,60,0,0,0,0,0,0,36,255,255,24,
-  0,0,2,217,255,200,31,0,0,45,217,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,209,255,
-  211,87,10,0,0,0,5,65,69,0,0,0,0,0,0,0,4,255,255,42,241,253,31,0,0,0,0,0,39,255,231,48,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,0,33,214,255,255,219,208,242,255,254,124,0,0,0,0,
-  4,255,255,213,200,200,200,206,241,255,255,177,6,0,0,0,0,48,227,255,253,215,210,246,255,249,95,0,0,0,0,8,
-  255,255,213,200,200,201,229,254,255,241,68,0,0,0,0,0,54,233,255,252,224,210,242,255,255,155,1,0,0,84,200,200,
-  200,200,200,253,255,215,200,200,200,200,156,0,88,255,224,0,0,0,0,0,0,0,68,255,252,0,79,255,255,46,0,0,
-  0,4,255,255,60,0,0,0,32,238,255,162,0,0,0,0,0,4,255,255,255,217,8,0,0,0,0,0,36,255,255,24,
-  0,0,0,54,241,255,252,219,221,254,255,225,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,164,
-  255,255,252,218,204,226,252,255,178,0,0,0,0,0,0,0,4,255,255,32,150,255,132,0,0,0,0,0,141,255,133,44,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,44,255,255,24,0,0,15,227,255,184,34,0,0,6,101,246,255,118,0,0,0,
-  4,255,255,60,0,0,0,0,0,92,243,255,144,0,0,0,29,241,255,168,25,0,0,10,120,253,255,87,0,0,0,8,
-  255,255,60,0,0,0,0,39,195,255,238,18,0,0,0,15,232,255,181,31,0,0,1,88,239,255,128,0,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,88,255,224,0,0,0,0,0,0,0,68,255,252,0,17,186,170,4,0,0,
-  0,4,255,255,60,0,0,0,0,77,254,255,101,0,0,0,0,4,255,255,255,255,138,0,0,0,0,0,36,255,255,24,
-  0,0,0,0,31,147,218,248,247,213,133,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  47,142,205,240,252,236,189,109,12,0,0,0,0,0,0,0,4,255,255,32,48,255,230,4,0,0,0,7,236,254,32,44,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,255,197,5,0,0,0,0,0,83,255,246,33,0,0,
-  4,255,255,60,0,0,0,0,0,0,105,255,247,11,0,0,178,255,177,1,0,0,0,0,0,114,255,233,16,0,0,8,
-  255,255,60,0,0,0,0,0,22,242,255,101,0,0,0,98,255,241,10,0,0,0,0,0,91,255,243,13,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,88,255,224,0,0,0,0,0,0,0,68,255,252,0,0,0,0,0,0,0,
-  0,4,255,255,60,0,0,0,0,0,136,255,247,48,0,0,0,4,255,255,157,255,252,52,0,0,0,0,36,255,255,24,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,32,0,201,255,82,0,0,0,91,255,185,0,44,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,0,0,124,255,237,5,0,
-  0,0,0,0,0,0,0,172,255,200,0,0,0,0,0,0,10,246,255,57,0,0,0,0,0,0,0,195,255,129,0,0,
-  4,255,255,60,0,0,0,0,0,0,25,255,255,51,0,29,255,254,34,0,0,0,0,0,0,3,224,255,100,0,0,8,
-  255,255,60,0,0,0,0,0,0,192,255,143,0,0,0,129,255,206,0,0,0,0,0,0,15,251,252,56,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,88,255,224,0,0,0,0,0,0,0,68,255,252,0,44,255,255,0,0,0,
-  0,4,255,255,60,0,0,0,0,0,3,193,255,220,15,0,0,4,255,255,64,180,255,210,5,0,0,0,36,255,255,24,
-  0,41,255,255,22,0,0,0,0,0,76,255,226,0,0,0,0,0,0,153,255,168,0,8,217,255,190,0,0,0,0,0,
-  0,0,172,255,230,15,0,76,255,255,255,255,32,0,0,0,4,255,255,32,0,99,255,185,0,0,0,194,255,82,0,44,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,226,216,216,216,216,216,216,216,74,0,31,254,255,74,0,
-  0,0,0,0,0,0,13,247,255,104,0,0,0,0,0,0,80,255,227,0,0,0,0,0,0,0,0,111,255,209,0,0,
-  4,255,255,60,0,0,0,0,0,0,21,255,255,53,0,108,255,204,0,0,0,0,0,0,0,0,143,255,180,0,0,8,
-  255,255,60,0,0,0,0,0,0,190,255,139,0,0,0,99,255,247,34,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,88,255,224,0,0,0,0,0,0,0,68,255,252,0,44,255,255,0,0,0,
-  0,4,255,255,60,0,0,0,0,0,0,25,232,255,173,0,0,4,255,255,64,28,241,255,128,0,0,0,36,255,255,24,
-  0,0,234,255,80,0,0,0,0,0,149,255,255,41,0,0,0,0,0,212,255,106,0,0,63,254,255,95,0,0,0,0,
-  0,75,255,255,82,0,0,76,255,249,200,200,25,0,0,0,4,255,255,32,0,11,241,254,34,0,41,255,231,4,0,44,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,255,255,255,255,255,255,255,255,88,0,0,190,255,162,0,
-  0,0,0,0,0,0,93,255,248,17,0,0,0,0,0,0,121,255,181,0,0,0,0,0,0,0,0,65,255,247,0,0,
-  4,255,255,60,0,0,0,0,0,0,92,255,251,15,0,149,255,157,0,0,0,0,0,0,0,0,97,255,220,0,0,8,
-  255,255,60,0,0,0,0,0,26,243,255,91,0,0,0,15,231,255,224,79,2,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,88,255,224,0,0,0,0,0,0,0,68,255,252,0,44,255,255,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,64,0,101,255,250,45,0,0,36,255,255,24,
-  0,0,173,255,139,0,0,0,0,0,222,255,255,112,0,0,0,0,15,254,255,43,0,0,0,154,255,235,19,0,0,0,
-  10,223,255,174,0,0,0,76,255,228,0,0,0,0,0,0,4,255,255,32,0,0,151,255,135,0,144,255,134,0,0,44,
-  255,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,255,241,7,
-  0,0,0,0,0,0,181,255,170,0,0,0,0,0,0,0,144,255,164,0,0,0,0,0,0,0,0,46,255,255,16,0,
-  4,255,255,60,0,0,0,0,0,80,237,255,165,0,0,172,255,140,0,0,0,0,0,0,0,0,78,255,244,0,0,8,
-  255,255,60,0,0,0,0,46,203,255,221,5,0,0,0,0,49,226,255,255,226,146,65,3,0,0,0,0,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,88,255,224,0,0,0,0,0,0,0,68,255,252,0,44,255,255,0,0,0,
-  0,216,255,255,255,255,255,255,255,255,255,255,255,12,0,0,0,4,255,255,64,0,0,188,255,203,3,0,36,255,255,24,
-  0,0,111,255,198,0,0,0,0,39,255,230,255,183,0,0,0,0,72,255,235,1,0,0,0,15,230,255,159,0,0,0,
-  138,255,240,26,0,0,0,76,255,228,0,0,0,0,0,0,4,255,255,32,0,0,48,255,232,13,238,254,33,0,0,44,
-  255,248,0,137,255,242,19,0,0,0,0,0,0,0,158,255,227,9,0,228,255,255,255,136,0,0,0,0,12,244,255,81,
-  0,0,0,0,0,18,250,255,74,0,0,0,0,0,0,0,156,255,160,0,0,0,0,0,0,0,0,40,255,255,28,0,
-  4,255,255,213,200,200,200,208,239,255,255,202,17,0,0,184,255,136,0,0,0,0,0,0,0,0,72,255,255,0,0,8,
-  255,255,213,200,200,201,229,255,255,223,36,0,0,0,0,0,0,12,124,228,255,255,255,232,124,11,0,0,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,88,255,224,0,0,0,0,0,0,0,68,255,252,0,44,255,255,0,0,0,
-  0,168,200,200,200,200,200,200,200,200,240,255,245,7,0,0,0,4,255,255,64,0,0,32,244,255,119,0,36,255,255,24,
-  0,0,49,255,249,8,0,0,0,112,255,140,238,246,8,0,0,0,130,255,175,0,0,0,0,0,82,255,255,63,0,45,
-  251,255,103,0,0,0,0,76,255,228,0,0,0,0,0,0,4,255,255,32,0,0,0,202,255,176,255,185,0,0,0,44,
-  255,248,0,15,236,255,136,0,0,0,0,0,0,38,252,255,95,0,0,178,200,235,255,136,0,0,0,0,0,161,255,168,
-  0,0,0,0,0,101,255,231,3,0,0,0,0,0,0,0,147,255,166,0,0,0,0,0,0,0,0,44,255,255,16,0,
-  4,255,255,255,255,255,255,251,234,188,102,4,0,0,0,175,255,142,0,0,0,0,0,0,0,0,76,255,245,0,0,8,
-  255,255,255,255,255,255,255,255,163,8,0,0,0,0,0,0,0,0,0,2,60,140,224,255,255,217,32,0,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,88,255,224,0,0,0,0,0,0,0,68,255,252,0,44,255,255,0,0,0,
-  0,0,0,0,0,0,0,0,0,43,248,255,107,0,0,0,0,4,255,255,64,0,0,0,109,255,247,38,36,255,255,24,
-  0,0,2,240,255,60,0,0,0,185,255,67,170,255,69,0,0,0,188,255,112,0,0,0,0,0,0,174,255,216,8,198,
-  255,194,1,0,0,0,0,76,255,228,0,0,0,0,0,0,4,255,255,32,0,0,0,100,255,255,255,83,0,0,0,44,
-  255,248,0,0,111,255,244,22,0,0,0,0,0,167,255,207,2,0,0,0,0,164,255,136,0,0,0,0,0,66,255,245,
-  11,0,0,0,0,189,255,140,0,0,0,0,0,0,0,0,123,255,186,0,0,0,0,0,0,0,0,62,255,248,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,0,0,0,0,151,255,162,0,0,0,0,0,0,0,0,94,255,222,0,0,8,
-  255,255,60,0,0,0,128,255,216,4,0,0,0,0,0,0,0,0,0,0,0,0,1,81,231,255,203,0,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,88,255,224,0,0,0,0,0,0,0,68,255,252,0,44,255,255,0,0,0,
-  0,0,0,0,0,0,0,0,5,206,255,186,1,0,0,0,0,4,255,255,64,0,0,0,1,195,255,195,37,255,255,24,
-  0,0,0,181,255,119,0,0,10,248,242,6,98,255,139,0,0,3,243,255,50,0,0,0,0,0,0,25,240,255,202,255,
-  248,40,0,0,0,0,0,76,255,228,0,0,0,0,0,0,4,255,255,32,0,0,0,11,242,255,232,5,0,0,0,44,
-  255,248,0,0,6,220,255,142,0,0,0,0,44,253,255,68,0,0,0,0,0,164,255,136,0,0,0,0,0,1,225,255,
-  87,0,0,0,23,252,255,44,0,0,0,0,0,0,0,0,86,255,234,1,0,0,0,0,0,0,0,105,255,211,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,0,0,0,0,114,255,212,0,0,0,0,0,0,0,0,137,255,186,0,0,8,
-  255,255,60,0,0,0,13,235,255,102,0,0,0,0,0,8,8,1,0,0,0,0,0,0,59,255,255,48,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,84,255,227,0,0,0,0,0,0,0,71,255,247,0,44,255,255,0,0,0,
-  0,0,0,0,0,0,0,0,132,255,239,27,0,0,0,0,0,4,255,255,64,0,0,0,0,38,247,255,145,255,255,24,
-  0,0,0,119,255,178,0,0,75,255,173,0,26,255,210,0,0,49,255,241,2,0,0,0,0,0,0,0,102,255,255,255,
-  125,0,0,0,0,0,0,76,255,228,0,0,0,0,0,0,4,255,255,32,0,0,0,0,151,255,135,0,0,0,0,44,
-  255,248,0,0,0,85,255,247,26,0,0,0,175,255,182,0,0,0,0,0,0,164,255,136,0,0,0,0,0,0,132,255,
-  175,0,0,0,109,255,205,0,0,0,0,0,0,0,0,0,13,248,255,67,0,0,0,0,0,0,0,186,255,132,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,0,0,0,0,34,255,255,43,0,0,0,0,0,0,1,217,255,109,0,0,8,
-  255,255,60,0,0,0,0,114,255,229,10,0,0,0,2,248,255,68,0,0,0,0,0,0,1,248,255,80,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,63,255,249,8,0,0,0,0,0,0,102,255,222,0,44,255,255,0,0,0,
-  0,0,0,0,0,0,0,55,252,255,90,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,117,255,253,255,255,24,
-  0,0,0,56,255,236,1,0,148,255,98,0,0,209,255,26,0,107,255,181,0,0,0,0,0,0,0,0,6,239,255,251,
-  18,0,0,0,0,0,0,76,255,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,199,255,149,0,0,52,255,252,44,0,0,0,0,0,0,164,255,136,0,0,0,0,0,0,38,255,
-  248,14,0,0,197,255,110,0,0,0,0,0,0,0,0,0,0,156,255,206,8,0,0,0,0,0,70,255,248,36,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,184,255,187,3,0,0,0,0,0,102,255,240,21,0,0,8,
-  255,255,60,0,0,0,0,7,226,255,122,0,0,0,0,192,255,160,0,0,0,0,0,0,39,255,255,55,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,9,245,255,98,0,0,0,0,0,1,197,255,154,0,44,255,255,0,0,0,
-  0,0,0,0,0,0,10,218,255,170,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,3,201,255,255,255,24,
-  0,0,0,5,245,255,41,0,221,254,24,0,0,136,255,96,0,165,255,119,0,0,0,0,0,0,0,0,124,255,255,255,
-  147,0,0,0,0,0,0,76,255,228,0,0,0,0,87,255,185,0,0,0,0,0,0,0,0,16,126,128,56,0,0,0,
-  0,0,0,0,0,0,60,255,249,30,0,184,255,155,0,0,0,0,0,0,0,164,255,136,0,0,0,0,0,0,0,198,
-  255,94,0,30,254,250,20,0,0,0,0,0,0,0,0,0,0,17,230,255,192,38,0,0,4,91,242,255,123,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,32,243,255,175,29,0,0,7,110,250,255,103,0,0,0,8,
-  255,255,60,0,0,0,0,0,99,255,240,18,0,0,0,59,250,255,155,28,0,0,0,50,209,255,211,1,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,0,130,255,243,104,3,0,0,25,170,255,243,35,0,44,255,255,0,0,0,
-  0,0,0,0,0,0,149,255,230,19,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,43,249,255,255,24,
-  0,0,0,0,188,255,100,38,255,203,0,0,0,64,255,167,0,223,255,57,0,0,0,0,0,0,0,40,248,255,192,255,
-  253,58,0,0,0,0,0,76,255,228,0,0,0,0,7,237,253,29,0,0,0,0,0,0,0,0,120,255,225,13,0,0,
-  0,0,0,0,0,0,0,174,255,155,60,255,244,25,0,0,0,0,0,0,0,164,255,136,0,0,0,0,0,0,0,103,
-  255,181,0,117,255,175,0,0,0,0,0,0,0,0,0,0,0,0,36,215,255,255,220,207,239,255,255,132,1,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,51,229,255,253,216,208,243,255,255,119,0,0,0,0,8,
-  255,255,60,0,0,0,0,0,3,215,255,141,0,0,0,0,78,236,255,254,229,207,231,255,255,223,39,0,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,0,3,161,255,255,247,212,226,254,255,241,70,0,0,44,255,255,0,0,0,
-  0,0,0,0,0,70,255,255,73,0,0,0,0,0,0,0,0,4,255,255,64,0,0,0,0,0,0,0,124,255,255,24,
-  0,0,0,0,126,255,158,111,255,128,0,0,0,5,242,236,26,255,245,5,0,0,0,0,0,0,2,196,255,208,5,189,
-  255,214,7,0,0,0,0,76,255,228,0,0,0,0,0,146,255,126,0,0,0,0,0,0,0,0,0,155,255,149,0,0,
-  0,0,0,0,0,0,0,37,250,251,209,255,128,0,0,0,0,0,0,0,0,164,255,136,0,0,0,0,0,0,0,16,
-  248,250,18,205,255,80,0,0,0,0,0,0,0,0,0,0,0,0,0,10,103,195,232,246,217,160,52,0,0,0,0,0,
-  4,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,114,201,236,244,217,252,255,177,17,0,0,0,8,
-  255,255,60,0,0,0,0,0,0,84,255,248,30,0,0,0,0,17,118,195,234,251,238,195,115,11,0,0,0,0,0,0,
-  0,0,0,244,255,72,0,0,0,0,0,0,0,0,0,73,173,229,250,249,211,137,25,0,0,0,44,255,255,0,0,0,
-  0,0,0,0,17,228,255,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,64,255,200,176,255,53,0,0,0,0,175,255,114,255,188,0,0,0,0,0,0,0,108,255,252,52,0,36,
-  247,255,131,0,0,0,0,76,255,228,0,0,0,0,0,47,255,222,1,0,0,0,0,0,0,0,0,4,186,254,61,0,
-  0,0,0,0,0,0,0,0,147,255,255,231,11,0,0,0,0,0,0,0,0,164,255,136,0,0,0,0,0,0,0,0,
-  169,255,137,255,235,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,237,255,223,54,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,167,255,220,11,0,0,0,0,0,0,0,0,0,0,0,109,109,0,0,0,0,0,0,0,53,237,172,0,
-  0,0,0,0,8,249,238,236,232,1,0,0,0,0,102,255,213,255,126,0,0,0,0,0,0,30,243,255,142,0,0,0,
-  121,255,250,45,0,0,0,76,255,228,0,0,0,0,0,0,205,255,67,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,21,249,255,110,0,0,0,0,0,0,0,0,0,164,255,136,0,0,0,0,0,0,0,0,
-  74,255,253,255,145,0,0,0,0,0,0,190,200,200,200,200,200,200,200,200,200,156,0,0,0,50,163,227,249,237,182,67,
-  0,0,0,0,0,27,139,217,246,238,184,71,0,0,0,0,0,0,0,0,0,0,0,0,0,33,209,255,181,0,0,92,
-  255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,255,208,0,0,0,13,122,212,246,235,178,
-  59,0,0,0,0,0,0,3,105,206,242,234,66,0,0,0,51,179,239,246,206,105,47,255,216,0,44,255,255,0,0,0,
-  0,0,0,87,255,252,58,0,0,0,0,0,0,0,0,0,0,0,42,255,255,41,0,0,0,0,0,0,122,255,254,3,
-  0,0,0,0,0,196,255,255,159,0,0,0,0,0,30,255,255,255,63,0,0,0,0,0,0,182,255,224,11,0,0,0,
-  4,209,255,202,3,0,0,76,255,228,0,0,0,0,0,0,106,255,165,0,0,0,0,0,0,0,0,244,204,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,80,0,0,0,0,0,0,0,0,0,164,255,136,0,0,0,0,0,0,0,0,
-  3,231,255,255,50,0,0,0,0,0,0,244,255,255,255,255,255,255,255,255,255,200,0,0,107,254,255,235,208,238,255,254,
-  100,0,0,0,53,233,255,245,208,235,255,255,126,0,0,0,0,0,0,0,0,0,0,0,0,0,10,117,6,0,0,92,
-  255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,255,208,0,0,30,213,255,249,213,237,255,
-  253,94,0,0,0,0,0,156,255,255,224,208,69,0,0,72,249,255,245,208,230,255,206,255,216,0,44,255,255,0,0,0,
-  0,0,26,237,255,135,0,0,0,0,0,0,0,0,0,0,0,0,147,255,255,145,0,0,0,0,0,0,41,199,138,0,
-  0,0,0,0,0,134,255,255,84,0,0,0,0,0,0,213,255,248,8,0,0,0,0,0,92,255,255,72,0,0,0,0,
-  0,54,253,255,115,0,0,76,255,228,0,0,0,0,0,0,16,247,247,16,0,0,0,0,0,0,0,244,204,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,80,0,0,0,0,0,0,0,0,0,164,255,136,0,0,0,0,0,0,0,0,
-  0,140,255,211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,252,253,101,2,0,5,140,255,
-  242,10,0,12,223,255,158,11,0,1,103,254,255,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,
-  255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,255,208,0,2,198,255,175,18,0,1,110,
-  255,246,28,0,0,0,27,254,255,101,0,0,0,0,16,234,255,172,14,0,1,88,246,255,216,0,44,255,255,0,0,0,
-  0,0,183,255,208,6,0,0,0,0,0,0,0,0,0,0,0,11,241,231,232,239,10,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,71,255,250,14,0,0,0,0,0,0,140,255,195,0,0,0,0,0,21,236,255,165,0,0,0,0,0,
-  0,0,145,255,245,35,0,76,255,228,0,0,0,0,0,0,0,165,255,107,0,0,0,0,0,0,0,244,204,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,80,0,0,0,0,0,0,0,0,0,164,255,136,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,92,255,208,0,0,0,0,0,0,0,0,0,67,164,131,0,0,0,0,3,245,
-  255,58,0,106,255,211,3,0,0,0,0,153,255,149,0,88,255,212,0,0,0,0,0,0,0,0,0,0,0,0,0,92,
-  255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,255,208,0,82,255,221,9,0,0,0,0,
-  177,255,125,0,0,0,69,255,238,0,0,0,0,0,108,255,228,9,0,0,0,0,120,255,216,0,44,255,255,0,0,0,
-  0,105,255,248,45,0,0,0,0,0,0,0,0,0,0,0,0,102,255,136,137,255,99,0,0,0,0,0,76,255,224,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,76,255,228,0,0,0,0,0,0,0,66,255,205,0,0,0,0,0,0,0,244,204,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,80,0,0,0,0,0,0,0,0,0,164,255,136,0,92,255,188,18,143,223,249,
-  230,155,19,0,0,0,0,0,0,0,0,92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,220,
-  255,71,0,184,255,119,0,0,0,0,0,49,140,96,0,88,255,212,0,0,0,0,0,0,0,0,0,0,0,0,0,92,
-  255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,255,208,0,167,255,132,0,0,0,0,0,
-  114,255,183,0,0,0,76,255,224,0,0,0,0,0,175,255,143,0,0,0,0,0,88,255,216,0,44,255,255,0,0,0,
-  0,244,255,240,200,200,200,200,200,200,200,200,200,84,0,0,0,207,254,36,37,255,204,0,0,0,0,0,76,255,224,0,
-  0,96,255,177,33,158,229,249,226,146,13,0,68,184,237,248,215,121,3,0,0,0,0,16,124,211,244,239,192,92,1,0,
-  0,0,0,0,0,0,0,76,255,228,0,0,0,0,0,0,0,1,222,255,47,0,0,0,0,0,0,244,204,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,80,0,0,0,0,0,0,0,0,0,164,255,136,0,92,255,212,223,252,215,223,
-  255,255,204,3,0,0,0,0,0,0,0,92,255,208,0,0,0,0,0,0,0,0,0,0,0,74,172,225,248,255,255,255,
-  255,72,0,217,255,76,0,0,0,0,0,0,0,0,0,88,255,212,0,0,0,0,0,0,0,0,0,0,0,0,0,92,
-  255,208,31,160,230,249,221,134,11,0,0,0,0,0,51,179,239,246,206,105,93,255,208,0,208,255,219,200,200,200,200,200,
-  220,255,210,0,76,255,255,255,255,255,255,148,0,0,210,255,97,0,0,0,0,0,88,255,216,0,44,255,255,0,0,0,
-  0,255,255,255,255,255,255,255,255,255,255,255,255,108,0,0,57,255,191,0,0,192,255,53,0,0,0,0,76,255,224,0,
-  0,96,255,222,239,244,209,231,255,255,196,116,254,243,210,235,255,255,152,0,0,0,36,219,255,251,209,223,255,255,172,5,
-  0,0,0,0,0,0,0,76,255,228,0,0,0,0,0,0,0,0,125,255,146,0,0,0,0,0,0,244,204,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,80,0,0,0,0,0,0,0,0,0,164,255,136,0,92,255,255,206,37,0,0,
-  70,252,255,74,0,0,0,0,0,0,0,92,255,208,0,0,0,0,0,0,0,0,0,0,157,255,255,247,220,202,200,248,
-  255,72,0,234,255,65,0,0,0,0,0,0,0,0,0,88,255,212,0,0,0,0,0,0,0,0,0,0,0,0,0,92,
-  255,232,235,250,213,220,255,255,200,9,0,0,0,72,249,255,244,207,231,255,224,255,208,0,229,255,255,255,255,255,255,255,
-  255,255,219,0,59,200,216,255,249,200,200,115,0,0,220,255,84,0,0,0,0,0,88,255,216,0,44,255,255,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,162,255,90,0,0,91,255,158,0,0,0,0,76,255,224,0,
-  0,96,255,255,159,12,0,0,97,255,255,255,155,10,0,1,124,255,252,24,0,5,206,255,189,24,0,0,65,237,255,135,
-  0,0,0,0,0,0,0,76,255,228,0,0,0,0,0,0,0,0,29,253,237,7,0,0,0,0,0,244,204,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,255,136,0,92,255,241,24,0,0,0,
-  0,182,255,130,0,0,0,0,0,0,0,92,255,208,0,0,0,0,0,0,0,0,0,85,255,249,102,10,0,0,0,220,
-  255,72,0,221,255,86,0,0,0,0,0,0,0,0,0,88,255,212,0,0,0,0,0,0,0,0,0,0,0,0,0,92,
-  255,255,191,26,0,0,59,237,255,131,0,0,16,234,255,166,12,0,1,86,246,255,208,0,220,255,81,0,0,0,0,0,
-  0,0,0,0,0,0,76,255,224,0,0,0,0,0,206,255,104,0,0,0,0,0,88,255,216,0,44,255,255,0,0,0,
-  0,0,0,53,179,239,247,208,109,59,255,204,0,0,0,19,247,238,8,0,0,8,238,246,17,0,0,0,76,255,224,0,
-  0,96,255,227,5,0,0,0,0,198,255,222,4,0,0,0,2,233,255,77,0,91,255,231,14,0,0,0,0,86,255,247,
-  21,0,0,0,0,0,0,76,255,249,200,200,25,0,0,0,0,0,0,184,255,88,0,0,0,0,0,244,204,0,0,0,
-  92,255,168,40,166,233,249,219,130,9,0,0,0,0,0,0,0,0,0,0,0,164,255,136,0,92,255,208,0,0,0,0,
-  0,148,255,149,0,0,0,0,0,0,0,92,255,208,16,140,222,249,231,155,19,0,0,163,255,152,0,0,0,0,0,220,
-  255,72,0,184,255,121,0,0,0,0,0,14,48,34,0,88,255,212,0,0,0,0,135,255,240,47,0,0,0,0,0,92,
-  255,237,17,0,0,0,0,96,255,235,4,0,110,255,223,6,0,0,0,0,120,255,208,0,185,255,127,0,0,0,0,0,
-  0,0,0,0,0,0,76,255,224,0,0,0,0,0,168,255,142,0,0,0,0,0,88,255,216,0,44,255,255,0,0,0,
-  0,0,78,251,255,246,208,229,255,217,255,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,255,224,0,
-  0,96,255,204,0,0,0,0,0,158,255,159,0,0,0,0,0,200,255,94,0,177,255,137,0,0,0,0,0,1,220,255,
-  93,0,0,0,0,0,0,76,255,255,255,255,32,0,0,0,0,0,0,85,255,186,0,0,0,0,0,244,204,0,0,0,
-  92,255,223,243,247,210,226,255,255,196,8,0,0,0,0,0,0,0,0,0,0,164,255,136,0,92,255,208,0,0,0,0,
-  0,144,255,152,0,0,0,0,0,0,0,92,255,225,217,252,215,223,255,255,205,3,0,176,255,136,0,0,0,0,18,240,
-  255,72,0,110,255,220,3,0,0,0,0,130,255,157,0,88,255,212,0,0,0,116,255,248,63,0,0,0,0,0,0,92,
-  255,208,0,0,0,0,0,9,250,255,47,0,178,255,135,0,0,0,0,0,92,255,208,0,109,255,227,13,0,0,0,0,
-  1,69,0,0,0,0,76,255,224,0,0,0,0,0,100,255,235,9,0,0,0,0,123,255,216,0,44,255,255,0,0,0,
-  0,19,237,255,176,16,0,0,79,242,255,204,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,76,255,224,0,
-  0,96,255,204,0,0,0,0,0,152,255,152,0,0,0,0,0,196,255,96,0,217,255,84,0,0,0,0,0,0,174,255,
-  137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,236,253,30,0,0,0,0,244,204,0,0,0,
-  92,255,255,169,17,0,0,80,247,255,128,0,0,0,0,0,0,0,0,0,0,164,255,136,0,92,255,208,0,0,0,0,
-  0,144,255,152,0,0,0,0,0,0,0,92,255,255,206,37,0,0,70,252,255,75,0,122,255,232,41,0,0,45,203,255,
-  255,84,0,14,228,255,152,10,0,0,89,249,255,58,0,88,255,212,0,0,98,255,252,81,0,0,0,0,0,0,0,92,
-  255,208,0,0,0,0,0,0,218,255,81,0,213,255,89,0,0,0,0,0,92,255,208,0,11,223,255,193,31,0,0,22,
-  165,255,106,0,0,0,76,255,224,0,0,0,0,0,12,230,255,168,12,0,1,88,247,255,216,0,44,255,255,0,0,0,
-  0,113,255,227,9,0,0,0,0,114,255,204,0,92,255,194,69,200,247,200,0,0,0,0,0,0,0,0,76,255,224,0,
-  0,96,255,204,0,0,0,0,0,152,255,152,0,0,0,0,0,196,255,96,0,236,255,68,0,0,0,0,0,0,149,255,
-  152,0,0,0,85,192,241,250,222,150,27,0,0,0,0,0,0,0,0,0,144,255,127,0,0,0,0,244,204,0,0,0,
-  92,255,226,6,0,0,0,0,128,255,233,3,0,0,0,0,0,0,0,178,200,235,255,136,0,92,255,208,0,0,0,0,
-  0,144,255,152,0,0,0,0,0,0,0,92,255,241,24,0,0,0,0,182,255,130,0,14,214,255,252,214,221,255,237,232,
-  255,113,0,0,55,238,255,244,207,231,255,253,113,0,0,88,255,212,0,81,252,255,102,0,0,0,0,0,0,0,0,92,
-  255,208,0,0,0,0,0,0,207,255,93,0,225,255,76,0,0,0,0,0,92,255,208,0,0,45,229,255,253,213,213,250,
-  255,200,13,0,0,0,76,255,224,0,0,0,0,0,0,68,248,255,244,206,230,255,226,255,216,0,44,255,255,0,0,0,
-  0,180,255,138,0,0,0,0,0,96,255,204,0,92,255,238,252,245,208,166,0,0,0,0,0,0,0,0,76,255,224,0,
-  0,96,255,204,0,0,0,0,0,152,255,152,0,0,0,0,0,196,255,96,0,222,255,92,0,0,0,0,0,0,165,255,
-  132,0,0,144,255,255,224,212,249,255,237,45,0,0,0,0,0,0,0,0,45,255,224,1,0,0,0,244,204,0,0,0,
-  92,255,208,0,0,0,0,0,20,255,255,44,0,0,0,0,0,0,0,228,255,255,255,136,0,92,255,208,0,0,0,0,
-  0,144,255,152,0,0,0,0,0,0,0,92,255,208,0,0,0,0,0,148,255,149,0,0,17,145,226,251,230,155,30,131,
-  204,138,0,0,0,28,148,222,249,233,172,56,0,0,0,88,255,212,58,248,255,125,0,0,0,0,0,0,0,0,0,92,
-  255,208,0,0,0,0,0,0,221,255,82,0,212,255,97,0,0,0,0,0,92,255,208,0,0,0,19,134,214,247,241,202,
-  112,5,0,0,0,0,76,255,224,0,0,0,0,0,0,0,49,179,240,247,208,109,92,255,214,0,44,255,255,0,0,0,
-  0,214,255,90,0,0,0,0,0,96,255,204,0,92,255,255,164,13,0,0,0,0,0,0,0,0,0,0,76,255,224,0,
-  0,96,255,204,0,0,0,0,0,152,255,152,0,0,0,0,0,196,255,96,0,180,255,136,0,0,0,0,0,0,217,255,
-  94,0,54,255,250,73,0,0,27,201,255,196,0,0,0,0,0,0,0,0,0,203,255,69,0,0,0,244,204,0,0,0,
-  92,255,208,0,0,0,0,0,0,235,255,77,0,0,0,0,0,0,0,0,0,0,0,0,0,92,255,208,0,0,0,0,
-  0,144,255,152,0,0,0,0,0,0,0,92,255,208,0,0,0,0,0,144,255,152,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,255,229,231,255,214,0,0,0,0,0,0,0,0,0,0,92,
-  255,208,0,0,0,0,0,12,252,255,48,0,175,255,135,0,0,0,0,0,92,255,208,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,76,255,224,0,0,0,0,0,0,0,0,0,0,0,0,0,119,255,196,0,44,255,255,0,0,0,
-  0,225,255,76,0,0,0,0,0,96,255,204,0,92,255,232,8,0,0,0,0,0,0,0,0,0,0,0,76,255,224,0,
-  0,96,255,204,0,0,0,0,0,152,255,152,0,0,0,0,0,196,255,96,0,99,255,237,14,0,0,0,0,68,255,248,
-  16,0,108,255,198,0,0,0,0,53,240,239,7,0,0,0,0,0,0,0,0,64,128,71,0,0,0,244,204,0,0,0,
-  92,255,208,0,0,0,0,0,0,213,255,89,0,0,0,148,255,152,0,0,0,0,0,0,0,92,255,208,0,0,0,0,
-  0,144,255,152,0,0,0,0,0,0,0,92,255,208,0,0,0,0,0,144,255,152,0,111,255,198,0,0,0,0,0,49,
-  255,246,12,0,0,0,0,0,0,0,42,56,0,0,0,88,255,255,255,255,255,105,0,0,0,0,0,0,0,0,0,92,
-  255,237,18,0,0,0,0,100,255,233,4,0,104,255,231,7,0,0,0,0,126,255,208,0,104,255,196,0,0,0,0,0,
-  152,255,148,0,0,0,76,255,224,0,0,0,0,0,0,57,32,0,0,0,0,0,194,255,144,0,44,255,255,0,0,0,
-  0,213,255,98,0,0,0,0,0,96,255,204,0,92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,76,255,224,0,
-  0,96,255,204,0,0,0,0,0,152,255,152,0,0,0,0,0,196,255,96,0,7,214,255,184,22,0,0,57,231,255,129,
-  0,0,78,255,240,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,204,0,0,0,
-  92,255,208,0,0,0,0,0,0,227,255,78,0,0,0,148,255,152,0,0,0,0,0,0,0,92,255,208,0,0,0,0,
-  0,144,255,152,0,0,0,0,0,0,0,92,255,208,0,0,0,0,0,144,255,152,0,24,252,254,27,0,0,0,0,132,
-  255,169,0,0,0,0,0,0,13,164,254,184,0,0,0,88,255,255,180,121,255,246,44,0,0,0,0,0,0,0,0,92,
-  255,255,195,29,0,0,60,239,255,126,0,0,13,230,255,163,11,0,1,89,247,255,208,0,104,255,196,0,0,0,0,0,
-  152,255,148,0,0,0,76,255,224,0,0,0,0,0,16,232,224,66,0,0,7,141,255,251,41,0,44,255,255,0,0,0,
-  0,177,255,138,0,0,0,0,0,96,255,204,0,92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,76,255,224,0,
-  0,96,255,204,0,0,0,0,0,152,255,152,0,0,0,0,0,196,255,96,0,0,39,226,255,250,209,220,255,255,166,5,
-  0,0,4,189,255,253,190,120,52,1,0,0,0,0,30,243,255,108,0,0,0,0,153,255,222,10,0,244,204,0,0,0,
-  92,255,208,0,0,0,0,0,19,254,255,44,0,0,0,148,255,152,0,0,0,0,0,0,0,92,255,208,0,0,0,0,
-  0,144,255,152,0,0,0,0,0,0,0,92,255,208,0,0,0,0,0,144,255,152,0,0,186,255,110,0,0,0,0,214,
-  255,79,0,0,0,0,0,1,188,255,181,22,0,0,0,88,255,227,8,1,182,255,212,9,0,0,0,0,0,0,0,92,
-  255,218,238,251,212,218,255,255,196,7,0,0,0,65,248,255,243,207,231,255,217,255,208,0,104,255,196,0,0,0,0,0,
-  152,255,148,0,0,0,76,255,224,0,0,0,0,0,0,136,255,255,228,211,247,255,252,101,0,0,44,255,255,0,0,0,
-  0,109,255,235,10,0,0,0,0,117,255,204,0,92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,76,255,224,0,
-  0,96,255,204,0,0,0,0,0,152,255,152,0,0,0,0,0,196,255,96,0,0,0,17,134,215,247,235,190,87,0,0,
-  0,0,0,4,108,210,255,255,255,222,103,1,0,0,0,108,255,238,20,0,0,54,253,255,68,0,0,244,204,0,0,0,
-  92,255,225,5,0,0,0,0,115,255,231,3,0,228,255,255,255,255,255,244,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,92,255,208,0,0,0,0,0,144,255,152,0,0,96,255,194,0,0,0,39,255,
-  239,6,0,0,0,0,0,79,255,233,10,0,0,0,0,88,255,212,0,0,21,229,255,152,0,0,0,0,0,0,0,92,
-  255,171,34,161,231,250,222,131,10,0,0,0,0,0,47,178,240,247,207,108,59,255,208,0,104,255,196,0,0,0,0,0,
-  152,255,148,0,0,0,76,255,224,0,0,0,0,0,0,0,59,166,228,250,232,172,56,0,0,0,44,255,255,0,0,0,
-  0,16,235,255,173,15,0,0,82,244,255,204,0,92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,82,255,215,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,27,95,173,253,255,144,0,0,0,1,196,255,156,0,2,204,255,158,0,0,0,244,204,0,0,0,
-  92,255,255,166,16,0,0,79,246,255,122,0,0,178,200,232,255,233,200,190,0,0,92,255,200,0,0,0,0,16,250,247,
-  11,0,0,0,0,208,255,83,0,0,0,92,255,208,0,0,0,0,0,144,255,152,0,0,14,247,253,24,0,0,122,255,
-  156,0,0,0,0,0,0,155,255,150,0,0,0,0,0,88,255,212,0,0,0,64,253,255,82,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,255,196,0,0,0,0,0,
-  152,255,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,74,250,255,245,207,229,255,230,255,204,0,92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,149,255,184,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,24,28,8,0,0,0,0,81,255,252,17,0,0,0,40,248,254,53,105,255,232,17,0,0,0,244,204,0,0,0,
-  92,255,237,243,247,209,225,255,255,193,7,0,0,0,0,148,255,152,0,0,0,0,21,254,251,13,0,0,0,89,255,255,
-  82,0,0,0,18,254,251,15,0,0,0,92,255,208,0,0,0,0,0,144,255,152,0,0,0,171,255,106,0,0,204,255,
-  67,0,0,0,0,0,0,185,255,116,0,0,0,0,0,88,255,212,0,0,0,0,128,255,238,29,0,0,142,255,202,0,
-  0,0,0,0,104,255,226,1,0,220,255,255,255,255,255,255,255,255,192,0,0,0,0,0,104,255,196,0,0,0,0,0,
-  152,255,148,0,46,51,0,0,0,0,0,0,0,0,0,69,170,191,143,29,0,0,0,0,4,128,99,0,0,0,0,0,
-  0,0,0,52,180,239,248,209,108,98,255,204,0,92,255,208,0,0,0,0,0,0,0,0,0,0,179,233,255,255,90,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,204,255,110,0,0,0,0,12,255,255,39,0,0,0,0,123,255,207,238,255,84,0,0,0,0,244,204,0,0,0,
-  92,255,208,40,166,233,250,221,130,9,0,0,0,0,0,148,255,152,0,0,0,0,0,203,255,76,0,0,0,166,255,255,
-  161,0,0,0,80,255,194,0,0,0,0,92,255,208,0,0,0,0,0,144,255,152,0,0,0,80,255,190,0,30,255,230,
-  2,0,0,0,0,0,0,192,255,104,0,0,0,0,0,88,255,212,0,0,0,0,3,192,255,194,3,0,51,255,255,31,
-  0,0,0,0,183,255,139,0,0,171,200,200,200,200,200,202,255,255,171,0,0,0,0,0,104,255,196,0,0,0,0,0,
-  152,255,148,0,159,255,177,19,0,0,0,0,0,0,100,255,255,255,255,242,73,0,0,0,40,255,176,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,96,255,204,0,92,255,208,0,0,0,0,0,0,0,0,0,0,165,245,218,113,1,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,118,255,233,56,0,0,7,137,255,237,6,0,0,0,0,4,208,255,255,175,0,0,0,0,0,122,102,0,0,0,
-  92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,148,255,152,0,0,0,0,0,130,255,141,0,0,4,239,215,238,
-  236,3,0,0,144,255,121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,239,252,21,112,255,144,
-  0,0,0,0,0,0,0,192,255,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,216,255,115,
-  0,0,0,13,249,255,51,0,0,0,0,0,0,0,0,126,255,237,29,0,0,0,0,0,104,255,196,0,0,0,0,0,
-  152,255,148,0,16,164,255,204,5,0,0,0,0,19,245,242,67,18,111,250,251,107,1,2,168,255,103,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,96,255,204,0,92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,6,181,255,255,225,208,241,255,252,87,0,0,0,0,0,0,102,255,255,66,0,0,0,0,0,0,0,0,0,0,
-  92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,148,255,152,0,0,0,0,0,57,255,207,0,0,66,255,134,163,
-  255,63,0,0,208,255,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,255,102,194,255,54,
-  0,0,0,0,0,0,0,198,255,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,255,200,
-  0,0,0,85,255,218,0,0,0,0,0,0,0,0,60,252,255,80,0,0,0,0,0,0,100,255,203,0,0,0,0,0,
-  152,255,148,0,0,4,216,255,101,0,0,0,0,89,255,151,0,0,0,69,240,255,222,230,255,205,6,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,96,255,204,0,92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,2,97,191,237,247,217,160,42,0,0,0,0,0,0,13,226,255,255,200,2,0,0,0,0,0,0,0,0,0,
-  92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,148,255,152,0,0,0,0,0,3,237,254,18,0,143,255,56,83,
-  255,143,0,18,254,231,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,255,205,253,220,0,
-  0,0,0,0,0,0,3,233,255,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,255,254,
-  30,0,0,164,255,131,0,0,0,0,0,0,0,17,225,255,149,0,0,0,0,0,0,0,78,255,235,3,0,0,0,0,
-  186,255,148,0,0,0,127,255,177,0,0,0,0,69,156,70,0,0,0,0,36,173,242,241,161,19,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,96,255,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,255,185,212,255,113,0,0,0,0,0,0,0,0,0,
-  92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,148,255,152,0,0,0,0,0,0,168,255,83,0,220,232,1,11,
-  247,222,0,80,255,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,228,255,255,131,0,
-  0,0,0,0,0,0,124,255,234,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,198,255,
-  114,0,4,238,255,43,0,0,0,0,0,0,0,173,255,210,8,0,0,0,0,0,0,0,21,250,255,119,0,0,11,134,
-  255,255,148,0,0,0,93,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,96,255,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,254,248,36,63,255,245,34,0,0,0,0,0,0,0,0,
-  92,255,208,0,0,0,0,0,0,0,0,0,0,0,0,148,255,152,0,0,0,0,0,0,96,255,148,43,255,156,0,0,
-  178,255,45,144,255,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,255,255,42,0,
-  0,0,0,0,51,231,255,241,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,255,
-  199,0,66,255,211,0,0,0,0,0,0,0,104,255,246,42,0,0,0,0,0,0,0,0,0,141,255,255,227,210,245,255,
-  227,255,148,0,0,0,80,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,218,255,130,0,0,165,255,189,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,255,154,0,0,0,0,0,0,24,254,214,120,255,78,0,0,
-  98,255,124,208,252,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,255,208,0,0,
-  0,0,0,0,64,255,255,214,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,251,
-  254,29,145,255,122,0,0,0,0,0,0,44,246,255,101,0,0,0,0,0,0,0,0,0,0,1,115,216,250,241,191,81,
-  128,255,148,0,0,0,80,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,255,222,9,0,0,25,241,255,101,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,255,204,5,0,0,0,0,0,0,206,255,217,246,9,0,0,
-  20,252,217,254,197,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,1,33,173,255,211,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,
-  255,113,223,255,34,0,0,0,0,0,9,212,255,171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,75,255,221,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,252,255,77,0,0,0,0,113,255,240,27,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,254,255,239,234,3,0,0,0,0,134,255,255,178,0,0,0,
-  0,193,255,255,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,14,244,255,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,
-  255,230,255,202,0,0,0,0,0,0,152,255,224,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,45,255,249,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,93,218,245,215,3,0,0,0,0,61,255,255,100,0,0,0,
-  0,113,255,255,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,208,255,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,
-  243,255,255,114,0,0,0,0,0,82,255,251,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,213,255,142,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,240,254,24,0,0,0,
-  0,32,255,234,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,196,255,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  163,255,254,27,0,0,0,0,0,233,255,242,200,200,200,200,200,200,200,18,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,44,222,255,235,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,196,255,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  81,255,194,0,0,0,0,0,0,248,255,255,255,255,255,255,255,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,20,181,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,191,255,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  134,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,189,255,189,40,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,166,255,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,
-  232,251,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,43,255,254,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,100,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,161,
-  255,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,82,255,231,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,9,218,255,132,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,241,255,255,
-  232,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,92,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,35,213,255,169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,230,242,182,
-  40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,92,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,5,98,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,96,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,121,255,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,195,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,111,255,231,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,146,255,218,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,74,94,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 
- 24.000000f, 28.129999f, -0.000001f, 22.270000f, -5.860000f, 96, 
- {
-  {4294967295, 0, 0, 0, 0, 0.000000f, 0.000000f, 0.011719f, 0.011719f, 0.015625f, 0.015625f, 0, 0 },
-  {32, 1, 1, 0, 0, 5.937500f, 0.000000f, 0.023438f, 0.003906f, 0.027344f, 0.007812f, 0, 0 },
-  {33, 5, 18, 1, 17, 6.171875f, 0.000000f, 0.027344f, 0.003906f, 0.046875f, 0.074219f, 0, 0 },
-  {34, 7, 7, 1, 18, 7.671875f, 0.000000f, 0.046875f, 0.003906f, 0.074219f, 0.031250f, 0, 0 },
-  {35, 15, 18, 1, 17, 14.781250f, 0.000000f, 0.074219f, 0.003906f, 0.132812f, 0.074219f, 0, 0 },
-  {36, 13, 23, 1, 20, 13.484375f, 0.000000f, 0.132812f, 0.003906f, 0.183594f, 0.093750f, 0, 0 },
-  {37, 17, 18, 1, 17, 17.578125f, 0.000000f, 0.183594f, 0.003906f, 0.250000f, 0.074219f, 0, 0 },
-  {38, 15, 18, 1, 17, 14.921875f, 0.000000f, 0.250000f, 0.003906f, 0.308594f, 0.074219f, 0, 0 },
-  {39, 3, 7, 1, 18, 4.187500f, 0.000000f, 0.308594f, 0.003906f, 0.320312f, 0.031250f, 0, 0 },
-  {40, 8, 27, 1, 20, 8.203125f, 0.000000f, 0.320312f, 0.003906f, 0.351562f, 0.109375f, 0, 0 },
-  {41, 8, 27, 0, 20, 8.343750f, 0.000000f, 0.351562f, 0.003906f, 0.382812f, 0.109375f, 0, 0 },
-  {42, 11, 11, 0, 17, 10.343750f, 0.000000f, 0.382812f, 0.003906f, 0.425781f, 0.046875f, 0, 0 },
-  {43, 14, 14, 0, 15, 13.609375f, 0.000000f, 0.425781f, 0.003906f, 0.480469f, 0.058594f, 0, 0 },
-  {44, 5, 7, 0, 3, 4.718750f, 0.000000f, 0.480469f, 0.003906f, 0.500000f, 0.031250f, 0, 0 },
-  {45, 8, 3, 0, 8, 6.625000f, 0.000000f, 0.500000f, 0.003906f, 0.531250f, 0.015625f, 0, 0 },
-  {46, 5, 4, 1, 3, 6.312500f, 0.000000f, 0.531250f, 0.003906f, 0.550781f, 0.019531f, 0, 0 },
-  {47, 11, 20, 0, 17, 9.890625f, 0.000000f, 0.550781f, 0.003906f, 0.593750f, 0.082031f, 0, 0 },
-  {48, 13, 18, 1, 17, 13.484375f, 0.000000f, 0.593750f, 0.003906f, 0.644531f, 0.074219f, 0, 0 },
-  {49, 8, 18, 2, 17, 13.484375f, 0.000000f, 0.644531f, 0.003906f, 0.675781f, 0.074219f, 0, 0 },
-  {50, 13, 18, 1, 17, 13.484375f, 0.000000f, 0.675781f, 0.003906f, 0.726562f, 0.074219f, 0, 0 },
-  {51, 12, 18, 1, 17, 13.484375f, 0.000000f, 0.726562f, 0.003906f, 0.773438f, 0.074219f, 0, 0 },
-  {52, 14, 18, 0, 17, 13.484375f, 0.000000f, 0.773438f, 0.003906f, 0.828125f, 0.074219f, 0, 0 },
-  {53, 13, 18, 1, 17, 13.484375f, 0.000000f, 0.828125f, 0.003906f, 0.878906f, 0.074219f, 0, 0 },
-  {54, 13, 18, 1, 17, 13.484375f, 0.000000f, 0.878906f, 0.003906f, 0.929688f, 0.074219f, 0, 0 },
-  {55, 14, 18, 0, 17, 13.484375f, 0.000000f, 0.929688f, 0.003906f, 0.984375f, 0.074219f, 0, 0 },
-  {56, 13, 18, 1, 17, 13.484375f, 0.000000f, 0.500000f, 0.019531f, 0.550781f, 0.089844f, 0, 0 },
-  {57, 12, 18, 1, 17, 13.484375f, 0.000000f, 0.382812f, 0.058594f, 0.429688f, 0.128906f, 0, 0 },
-  {58, 5, 14, 1, 13, 5.812500f, 0.000000f, 0.003906f, 0.023438f, 0.023438f, 0.078125f, 0, 0 },
-  {59, 5, 18, 0, 13, 5.078125f, 0.000000f, 0.480469f, 0.031250f, 0.500000f, 0.101562f, 0, 0 },
-  {60, 12, 12, 0, 13, 12.203125f, 0.000000f, 0.429688f, 0.058594f, 0.476562f, 0.105469f, 0, 0 },
-  {61, 12, 8, 1, 12, 13.171875f, 0.000000f, 0.023438f, 0.074219f, 0.070312f, 0.105469f, 0, 0 },
-  {62, 12, 12, 1, 13, 12.546875f, 0.000000f, 0.070312f, 0.074219f, 0.117188f, 0.121094f, 0, 0 },
-  {63, 12, 18, 0, 17, 11.328125f, 0.000000f, 0.183594f, 0.074219f, 0.230469f, 0.144531f, 0, 0 },
-  {64, 21, 23, 1, 17, 21.546875f, 0.000000f, 0.230469f, 0.074219f, 0.312500f, 0.164062f, 0, 0 },
-  {65, 17, 18, 0, 17, 15.656250f, 0.000000f, 0.593750f, 0.074219f, 0.660156f, 0.144531f, 0, 0 },
-  {66, 14, 18, 1, 17, 14.937500f, 0.000000f, 0.660156f, 0.074219f, 0.714844f, 0.144531f, 0, 0 },
-  {67, 15, 18, 1, 17, 15.625000f, 0.000000f, 0.714844f, 0.074219f, 0.773438f, 0.144531f, 0, 0 },
-  {68, 15, 18, 1, 17, 15.734375f, 0.000000f, 0.773438f, 0.074219f, 0.832031f, 0.144531f, 0, 0 },
-  {69, 13, 18, 1, 17, 13.640625f, 0.000000f, 0.832031f, 0.074219f, 0.882812f, 0.144531f, 0, 0 },
-  {70, 13, 18, 1, 17, 13.265625f, 0.000000f, 0.882812f, 0.074219f, 0.933594f, 0.144531f, 0, 0 },
-  {71, 15, 18, 1, 17, 16.343750f, 0.000000f, 0.933594f, 0.074219f, 0.992188f, 0.144531f, 0, 0 },
-  {72, 16, 18, 1, 17, 17.109375f, 0.000000f, 0.500000f, 0.089844f, 0.562500f, 0.160156f, 0, 0 },
-  {73, 4, 18, 2, 17, 6.531250f, 0.000000f, 0.117188f, 0.074219f, 0.132812f, 0.144531f, 0, 0 },
-  {74, 13, 18, 0, 17, 13.250000f, 0.000000f, 0.132812f, 0.093750f, 0.183594f, 0.164062f, 0, 0 },
-  {75, 16, 18, 1, 17, 15.046875f, 0.000000f, 0.003906f, 0.105469f, 0.066406f, 0.175781f, 0, 0 },
-  {76, 13, 18, 1, 17, 12.921875f, 0.000000f, 0.429688f, 0.105469f, 0.480469f, 0.175781f, 0, 0 },
-  {77, 19, 18, 1, 17, 20.953125f, 0.000000f, 0.312500f, 0.128906f, 0.386719f, 0.199219f, 0, 0 },
-  {78, 16, 18, 1, 17, 17.109375f, 0.000000f, 0.066406f, 0.144531f, 0.128906f, 0.214844f, 0, 0 },
-  {79, 16, 18, 1, 17, 16.500000f, 0.000000f, 0.562500f, 0.144531f, 0.625000f, 0.214844f, 0, 0 },
-  {80, 15, 18, 1, 17, 15.140625f, 0.000000f, 0.625000f, 0.144531f, 0.683594f, 0.214844f, 0, 0 },
-  {81, 16, 21, 1, 17, 16.500000f, 0.000000f, 0.683594f, 0.144531f, 0.746094f, 0.226562f, 0, 0 },
-  {82, 15, 18, 1, 17, 14.781250f, 0.000000f, 0.746094f, 0.144531f, 0.804688f, 0.214844f, 0, 0 },
-  {83, 15, 18, 0, 17, 14.234375f, 0.000000f, 0.804688f, 0.144531f, 0.863281f, 0.214844f, 0, 0 },
-  {84, 15, 18, 0, 17, 14.328125f, 0.000000f, 0.863281f, 0.144531f, 0.921875f, 0.214844f, 0, 0 },
-  {85, 14, 18, 1, 17, 15.562500f, 0.000000f, 0.921875f, 0.144531f, 0.976562f, 0.214844f, 0, 0 },
-  {86, 16, 18, 0, 17, 15.265625f, 0.000000f, 0.480469f, 0.160156f, 0.542969f, 0.230469f, 0, 0 },
-  {87, 22, 18, 0, 17, 21.296875f, 0.000000f, 0.128906f, 0.164062f, 0.214844f, 0.234375f, 0, 0 },
-  {88, 16, 18, 0, 17, 15.046875f, 0.000000f, 0.214844f, 0.164062f, 0.277344f, 0.234375f, 0, 0 },
-  {89, 16, 18, 0, 17, 14.421875f, 0.000000f, 0.386719f, 0.175781f, 0.449219f, 0.246094f, 0, 0 },
-  {90, 14, 18, 1, 17, 14.375000f, 0.000000f, 0.003906f, 0.175781f, 0.058594f, 0.246094f, 0, 0 },
-  {91, 7, 24, 1, 19, 6.359375f, 0.000000f, 0.277344f, 0.164062f, 0.304688f, 0.257812f, 0, 0 },
-  {92, 11, 20, 0, 17, 9.843750f, 0.000000f, 0.304688f, 0.199219f, 0.347656f, 0.277344f, 0, 0 },
-  {93, 6, 24, 0, 19, 6.359375f, 0.000000f, 0.449219f, 0.175781f, 0.472656f, 0.269531f, 0, 0 },
-  {94, 11, 10, 0, 18, 10.031250f, 0.000000f, 0.058594f, 0.214844f, 0.101562f, 0.253906f, 0, 0 },
-  {95, 12, 3, 0, 0, 10.828125f, 0.000000f, 0.542969f, 0.214844f, 0.589844f, 0.226562f, 0, 0 },
-  {96, 7, 5, 0, 19, 7.421875f, 0.000000f, 0.347656f, 0.199219f, 0.375000f, 0.218750f, 0, 0 },
-  {97, 12, 14, 1, 13, 13.062500f, 0.000000f, 0.589844f, 0.214844f, 0.636719f, 0.269531f, 0, 0 },
-  {98, 13, 19, 1, 18, 13.468750f, 0.000000f, 0.746094f, 0.214844f, 0.796875f, 0.289062f, 0, 0 },
-  {99, 12, 14, 1, 13, 12.562500f, 0.000000f, 0.636719f, 0.214844f, 0.683594f, 0.269531f, 0, 0 },
-  {100, 12, 19, 1, 18, 13.531250f, 0.000000f, 0.796875f, 0.214844f, 0.843750f, 0.289062f, 0, 0 },
-  {101, 12, 14, 1, 13, 12.718750f, 0.000000f, 0.843750f, 0.214844f, 0.890625f, 0.269531f, 0, 0 },
-  {102, 10, 19, 0, 18, 8.328125f, 0.000000f, 0.890625f, 0.214844f, 0.929688f, 0.289062f, 0, 0 },
-  {103, 12, 19, 1, 13, 13.468750f, 0.000000f, 0.929688f, 0.214844f, 0.976562f, 0.289062f, 0, 0 },
-  {104, 12, 19, 1, 18, 13.218750f, 0.000000f, 0.542969f, 0.226562f, 0.589844f, 0.300781f, 0, 0 },
-  {105, 5, 18, 1, 17, 5.828125f, 0.000000f, 0.976562f, 0.144531f, 0.996094f, 0.214844f, 0, 0 },
-  {106, 7, 23, -1, 17, 5.734375f, 0.000000f, 0.101562f, 0.214844f, 0.128906f, 0.304688f, 0, 0 },
-  {107, 13, 19, 1, 18, 12.171875f, 0.000000f, 0.683594f, 0.226562f, 0.734375f, 0.300781f, 0, 0 },
-  {108, 4, 19, 1, 18, 5.828125f, 0.000000f, 0.976562f, 0.214844f, 0.992188f, 0.289062f, 0, 0 },
-  {109, 20, 14, 1, 13, 21.031250f, 0.000000f, 0.128906f, 0.234375f, 0.207031f, 0.289062f, 0, 0 },
-  {110, 12, 14, 1, 13, 13.250000f, 0.000000f, 0.472656f, 0.230469f, 0.519531f, 0.285156f, 0, 0 },
-  {111, 13, 14, 1, 13, 13.687500f, 0.000000f, 0.207031f, 0.234375f, 0.257812f, 0.289062f, 0, 0 },
-  {112, 13, 19, 1, 13, 13.468750f, 0.000000f, 0.375000f, 0.246094f, 0.425781f, 0.320312f, 0, 0 },
-  {113, 12, 19, 1, 13, 13.640625f, 0.000000f, 0.003906f, 0.246094f, 0.050781f, 0.320312f, 0, 0 },
-  {114, 8, 15, 1, 14, 8.125000f, 0.000000f, 0.050781f, 0.253906f, 0.082031f, 0.312500f, 0, 0 },
-  {115, 12, 14, 1, 13, 12.375000f, 0.000000f, 0.257812f, 0.257812f, 0.304688f, 0.312500f, 0, 0 },
-  {116, 9, 17, 0, 16, 7.843750f, 0.000000f, 0.425781f, 0.269531f, 0.460938f, 0.335938f, 0, 0 },
-  {117, 12, 14, 1, 13, 13.234375f, 0.000000f, 0.843750f, 0.269531f, 0.890625f, 0.324219f, 0, 0 },
-  {118, 13, 14, 0, 13, 11.625000f, 0.000000f, 0.589844f, 0.269531f, 0.640625f, 0.324219f, 0, 0 },
-  {119, 19, 14, 0, 13, 18.031250f, 0.000000f, 0.460938f, 0.285156f, 0.535156f, 0.339844f, 0, 0 },
-  {120, 13, 14, 0, 13, 11.890625f, 0.000000f, 0.304688f, 0.277344f, 0.355469f, 0.332031f, 0, 0 },
-  {121, 13, 19, 0, 13, 11.359375f, 0.000000f, 0.734375f, 0.289062f, 0.785156f, 0.363281f, 0, 0 },
-  {122, 12, 14, 1, 13, 11.890625f, 0.000000f, 0.785156f, 0.289062f, 0.832031f, 0.343750f, 0, 0 },
-  {123, 9, 25, 0, 19, 8.125000f, 0.000000f, 0.640625f, 0.269531f, 0.675781f, 0.367188f, 0, 0 },
-  {124, 3, 22, 2, 17, 5.843750f, 0.000000f, 0.355469f, 0.218750f, 0.367188f, 0.304688f, 0, 0 },
-  {125, 9, 25, 0, 19, 8.125000f, 0.000000f, 0.890625f, 0.289062f, 0.925781f, 0.386719f, 0, 0 },
-  {126, 15, 6, 1, 10, 16.328125f, 0.000000f, 0.925781f, 0.289062f, 0.984375f, 0.312500f, 0, 0 },
- }
-};
-#ifdef __cplusplus
-}
-#endif
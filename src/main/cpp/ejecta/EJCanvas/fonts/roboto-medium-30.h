@@ -1,2194 +0,0 @@
-/* ============================================================================
- * Freetype GL - A C OpenGL Freetype engine
- * Platform:    Any
- * WWW:         https://github.com/rougier/freetype-gl
- * ----------------------------------------------------------------------------
- * Copyright 2011,2012 Nicolas P. Rougier. All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *
- *  1. Redistributions of source code must retain the above copyright notice,
- *     this list of conditions and the following disclaimer.
- *
- *  2. Redistributions in binary form must reproduce the above copyright
- *     notice, this list of conditions and the following disclaimer in the
- *     documentation and/or other materials provided with the distribution.
- *
- * THIS SOFTWARE IS PROVIDED BY NICOLAS P. ROUGIER ''AS IS'' AND ANY EXPRESS OR
- * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
- * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
- * EVENT SHALL NICOLAS P. ROUGIER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
- * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
- * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *
- * The views and conclusions contained in the software and documentation are
- * those of the authors and should not be interpreted as representing official
- * policies, either expressed or implied, of Nicolas P. Rougier.
- * ============================================================================
- */
-#include <stddef.h>
-#include <stdint.h>
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include "../EJFont.h"
-
-texture_font_t font_roboto_medium_30 = {
- 256, 256, 1, 
- {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,255,255,255,255,0,0,120,255,255,48,0,4,255,255,12,16,255,255,0,0,0,0,0,0,0,0,222,255,58,0,0,
-  0,230,255,54,0,0,0,0,0,0,0,0,0,84,255,220,0,0,0,0,0,0,0,0,0,94,203,247,243,188,65,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,178,233,250,234,177,63,0,0,0,0,0,0,0,0,124,
-  255,140,0,0,0,0,0,0,0,1,116,56,0,11,150,13,0,0,0,0,0,0,0,0,0,0,0,0,144,255,140,0,
-  0,0,0,0,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,0,44,255,255,132,0,21,48,48,48,48,
-  48,48,33,0,110,243,214,33,0,0,0,0,0,0,0,0,0,15,246,255,74,0,0,0,0,8,114,195,235,250,233,188,
-  101,3,0,0,0,0,0,0,0,0,0,9,90,184,169,0,0,0,0,31,137,205,239,250,233,187,102,7,0,0,0,0,
-  0,0,0,41,148,214,244,249,228,177,85,1,0,0,0,0,0,242,255,255,255,255,255,255,255,255,255,255,8,0,0,0,
-  0,255,255,255,255,0,0,120,255,255,48,0,4,255,255,11,16,255,255,0,0,0,0,0,0,0,18,255,252,9,0,0,
-  26,255,250,7,0,0,0,0,0,0,0,0,0,84,255,220,0,0,0,0,0,0,0,0,137,255,255,255,255,255,253,85,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,255,255,255,255,255,255,254,119,0,0,0,0,0,0,0,124,
-  255,140,0,0,0,0,0,0,4,170,255,141,0,82,255,211,24,0,0,0,0,0,0,0,0,0,0,0,144,255,140,0,
-  0,0,0,0,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,0,44,255,255,132,0,116,255,255,255,255,
-  255,255,180,0,216,255,255,111,0,0,0,0,0,0,0,0,0,105,255,228,3,0,0,0,29,218,255,255,255,255,255,255,
-  255,202,18,0,0,0,0,0,1,63,157,242,255,255,172,0,0,0,104,248,255,255,255,255,255,255,255,211,31,0,0,0,
-  0,0,121,251,255,255,255,255,255,255,255,189,14,0,0,0,14,255,255,255,255,255,255,255,255,255,255,255,8,0,0,0,
-  0,255,255,255,255,0,0,120,255,255,48,0,4,255,252,2,16,255,243,0,0,0,0,0,0,0,69,255,210,0,0,0,
-  77,255,206,0,0,0,0,0,0,0,0,0,0,89,255,222,1,0,0,0,0,0,0,40,254,255,148,63,71,184,255,233,
-  5,0,0,0,0,41,1,0,0,0,0,0,0,0,59,255,255,238,109,58,93,218,255,254,52,0,0,0,0,0,0,124,
-  255,140,0,0,0,0,0,0,162,255,224,38,0,7,184,255,210,13,0,0,0,0,0,0,0,0,0,0,144,255,140,0,
-  0,0,0,0,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,0,47,255,255,119,0,116,255,255,255,255,
-  255,255,180,0,114,243,216,36,0,0,0,0,0,0,0,0,0,204,255,132,0,0,0,3,208,255,255,168,75,54,87,195,
-  255,255,183,0,0,0,29,130,223,255,255,255,255,255,172,0,0,96,255,255,238,130,67,54,91,204,255,255,214,6,0,0,
-  0,114,255,255,237,123,71,61,96,203,255,255,178,0,0,0,42,255,255,122,48,48,48,48,48,48,48,48,1,0,0,0,
-  0,255,255,255,255,0,0,120,255,255,48,0,4,255,233,0,16,255,221,0,0,0,0,0,0,0,121,255,159,0,0,0,
-  129,255,155,0,0,0,0,0,0,0,9,120,215,255,255,255,240,165,41,0,0,0,0,105,255,185,0,0,0,7,230,255,
-  50,0,0,0,47,249,171,0,0,0,0,0,0,0,152,255,255,76,0,0,0,30,253,255,136,0,0,0,0,0,0,124,
-  255,140,0,0,0,0,0,107,255,241,40,0,0,0,9,215,255,168,0,0,0,0,0,4,120,29,0,0,144,255,140,0,
-  0,17,90,0,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,0,75,255,255,81,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,255,254,34,0,0,0,94,255,255,137,0,0,0,0,2,
-  182,255,255,65,0,0,128,255,255,255,210,126,255,255,172,0,16,239,255,233,34,0,0,0,0,5,189,255,255,99,0,0,
-  16,246,255,223,22,0,0,0,0,1,193,255,255,51,0,0,70,255,255,65,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,48,0,4,255,211,0,16,255,199,0,0,0,0,0,0,0,173,255,107,0,0,0,
-  181,255,103,0,0,0,0,0,0,24,211,255,255,255,255,255,255,255,248,77,0,0,0,119,255,141,0,0,0,0,192,255,
-  67,0,0,6,210,252,53,0,0,0,0,0,0,0,188,255,250,4,0,0,0,0,234,255,148,0,0,0,0,0,0,124,
-  255,140,0,0,0,0,25,242,255,97,0,0,0,0,0,57,253,255,72,0,0,0,0,68,255,253,186,90,153,255,143,74,
-  170,248,255,36,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,0,147,255,241,10,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,255,190,0,0,0,0,185,255,241,11,0,0,0,0,0,
-  43,255,255,156,0,0,128,229,139,47,0,12,255,255,172,0,95,255,255,106,0,0,0,0,0,0,51,255,255,168,0,0,
-  83,255,255,107,0,0,0,0,0,0,79,255,255,116,0,0,98,255,255,36,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,48,0,4,255,189,0,16,255,177,0,0,1,8,8,8,8,224,255,62,8,8,8,
-  232,255,58,8,8,0,0,0,0,189,255,255,162,48,11,25,123,252,255,243,31,0,0,109,255,166,0,0,0,0,219,255,
-  59,0,0,137,255,132,0,0,0,0,0,0,0,0,175,255,254,19,0,0,0,45,255,255,98,0,0,0,0,0,0,124,
-  255,140,0,0,0,0,163,255,202,1,0,0,0,0,0,0,166,255,216,5,0,0,0,86,225,255,255,255,255,255,254,255,
-  255,255,241,77,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,24,242,255,128,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,237,255,91,0,0,0,1,245,255,176,0,0,0,0,0,0,
-  0,221,255,214,0,0,22,2,0,0,0,12,255,255,172,0,144,255,255,37,0,0,0,0,0,0,1,251,255,188,0,0,
-  49,120,120,34,0,0,0,0,0,0,45,255,255,135,0,0,126,255,255,8,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,48,0,4,255,167,0,16,255,155,0,0,36,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,24,0,0,56,255,255,169,0,0,0,0,0,122,255,255,145,0,0,55,255,251,100,15,21,136,255,247,
-  13,0,59,253,209,6,0,0,0,0,0,0,0,0,103,255,255,130,0,0,43,221,255,218,8,0,0,0,0,0,0,124,
-  255,140,0,0,0,42,254,255,79,0,0,0,0,0,0,0,49,255,255,103,0,0,0,0,0,45,120,200,255,255,255,218,
-  143,67,5,0,0,220,255,255,255,255,255,255,255,255,255,255,255,255,255,196,0,71,244,201,8,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,255,239,8,0,0,0,33,255,255,134,0,0,0,0,0,0,
-  0,179,255,251,3,0,0,0,0,0,0,12,255,255,172,0,62,100,100,7,0,0,0,0,0,0,10,255,255,156,0,0,
-  0,0,0,0,0,0,0,0,0,0,76,255,255,98,0,0,154,255,234,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,48,0,0,0,0,0,0,0,0,0,0,36,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,24,0,0,119,255,255,71,0,0,0,0,0,10,238,255,218,0,0,0,175,255,255,255,255,255,255,123,
-  0,11,220,250,48,0,0,0,0,0,0,0,0,0,6,215,255,249,61,118,247,255,224,37,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,141,255,229,2,0,0,0,0,0,0,0,0,197,255,202,0,0,0,0,0,0,0,161,255,255,255,94,
-  0,0,0,0,0,220,255,255,255,255,255,255,255,255,255,255,255,255,255,196,0,0,34,17,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,255,149,0,0,0,0,55,255,255,115,0,0,0,0,0,0,
-  0,158,255,255,17,0,0,0,0,0,0,12,255,255,172,0,0,0,0,0,0,0,0,0,0,0,74,255,255,90,0,0,
-  0,0,0,0,0,0,0,0,0,12,205,255,232,12,0,0,181,255,218,113,198,232,248,227,165,54,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,255,162,0,0,0,126,
-  255,158,0,0,0,0,0,0,139,255,255,47,0,0,0,0,0,0,197,255,254,2,0,0,8,142,244,255,255,234,111,0,
-  0,152,255,126,0,0,0,0,0,0,0,0,0,0,0,47,244,255,254,255,255,185,20,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,5,233,255,143,0,0,0,0,0,0,0,0,0,117,255,255,42,0,0,0,0,0,93,255,246,133,255,243,
-  38,0,0,0,0,41,48,48,48,48,48,236,255,217,48,48,48,48,48,36,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,254,255,50,0,0,0,0,67,255,255,108,0,0,0,0,0,0,
-  0,149,255,255,29,0,0,0,0,0,0,12,255,255,172,0,0,0,0,0,0,0,0,0,0,1,195,255,231,5,0,0,
-  0,0,0,0,14,48,49,72,119,230,255,244,63,0,0,0,209,255,255,255,255,255,255,255,255,254,123,0,0,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,170,255,110,0,0,0,178,
-  255,106,0,0,0,0,0,0,122,255,255,95,0,0,0,0,0,0,75,112,112,5,0,0,0,0,6,39,36,2,0,0,
-  72,255,205,4,0,0,0,0,0,0,0,0,0,0,0,3,174,255,255,255,127,1,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,64,255,255,76,0,0,0,0,0,0,0,0,0,38,255,255,125,0,0,0,0,38,243,255,117,0,188,255,
-  207,7,0,0,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,232,
-  255,255,56,0,0,0,0,0,0,0,0,0,0,0,130,255,207,0,0,0,0,0,72,255,255,108,0,0,0,0,0,0,
-  0,148,255,255,32,0,0,0,0,0,0,12,255,255,172,0,0,0,0,0,0,0,0,0,0,120,255,255,90,0,0,0,
-  0,0,0,0,76,255,255,255,255,255,189,41,0,0,0,0,237,255,255,177,87,57,71,148,250,255,255,94,0,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,222,255,58,0,0,0,230,
-  255,54,0,0,0,0,0,0,60,255,255,227,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,
-  229,248,43,0,0,0,0,0,0,0,0,0,0,0,19,191,255,255,255,255,203,10,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,119,255,255,20,0,0,0,0,0,0,0,0,0,0,240,255,180,0,0,0,3,206,255,204,3,0,33,245,
-  255,147,0,0,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,255,
-  255,255,56,0,0,0,0,0,0,0,0,0,0,2,226,255,108,0,0,0,0,0,72,255,255,108,0,0,0,0,0,0,
-  0,148,255,255,32,0,0,0,0,0,0,12,255,255,172,0,0,0,0,0,0,0,0,0,76,253,255,174,0,0,0,0,
-  0,0,0,0,76,255,255,255,255,255,243,137,5,0,0,0,41,102,76,0,0,0,0,0,71,252,255,232,7,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,48,0,0,0,0,0,0,0,0,0,0,0,0,0,18,255,252,9,0,0,26,255,
-  250,7,0,0,0,0,0,0,0,195,255,255,232,105,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,168,
-  255,120,0,32,164,235,249,212,109,1,0,0,0,22,215,255,255,139,132,255,255,176,2,0,0,47,255,255,75,0,0,0,
-  0,0,0,0,174,255,238,0,0,0,0,0,0,0,0,0,0,0,196,255,233,0,0,0,0,82,233,48,0,0,0,113,
-  230,64,0,0,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,255,255,
-  255,255,56,0,0,0,0,0,0,0,0,0,0,72,255,247,17,0,0,0,0,0,72,255,255,108,0,0,0,0,0,0,
-  0,148,255,255,32,0,0,0,0,0,0,12,255,255,172,0,0,0,0,0,0,0,0,57,244,255,210,14,0,0,0,0,
-  0,0,0,0,0,0,0,12,59,165,255,255,180,1,0,0,0,0,0,0,0,0,0,0,0,148,255,255,79,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,48,0,0,0,0,0,0,0,0,0,0,0,0,0,70,255,210,0,0,0,78,255,
-  206,0,0,0,0,0,0,0,0,28,216,255,255,255,241,158,61,0,0,0,0,0,0,0,0,0,0,0,0,0,87,255,
-  200,3,33,234,255,255,255,255,255,156,0,0,0,182,255,255,108,0,1,167,255,255,144,0,0,76,255,255,58,0,0,0,
-  0,0,0,0,216,255,209,0,0,0,0,0,0,0,0,0,0,0,155,255,255,22,0,0,0,0,10,0,0,0,0,2,
-  19,0,0,0,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,227,255,247,
-  255,255,56,0,0,0,0,0,0,0,0,0,0,171,255,166,0,0,0,0,0,0,69,255,255,109,0,0,0,0,0,0,
-  0,148,255,255,25,0,0,0,0,0,0,12,255,255,172,0,0,0,0,0,0,0,45,238,255,230,30,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,137,255,255,87,0,0,0,0,0,0,0,0,0,0,0,57,255,255,134,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,48,0,0,0,0,0,0,0,0,0,64,255,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,0,0,0,0,0,0,15,146,249,255,255,255,255,209,70,0,0,0,0,0,0,0,0,0,0,25,237,247,
-  39,0,174,255,220,88,60,135,254,255,61,0,51,255,255,170,0,0,0,8,198,255,255,109,0,127,255,254,16,0,0,0,
-  0,0,0,0,235,255,196,0,0,0,0,0,0,0,0,0,0,0,139,255,255,40,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,255,235,148,
-  255,255,56,0,0,0,0,0,0,0,0,0,20,249,255,67,0,0,0,0,0,0,57,255,255,119,0,0,0,0,0,0,
-  0,157,255,255,13,0,0,0,0,0,0,12,255,255,172,0,0,0,0,0,0,35,231,255,236,43,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,12,249,255,179,0,0,0,0,0,0,0,0,0,0,0,20,255,255,158,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,48,0,0,0,0,0,0,0,0,0,64,255,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,0,0,0,0,0,0,0,0,25,121,209,255,255,255,255,134,0,0,0,0,0,0,0,0,0,182,255,113,
-  0,3,247,255,48,0,0,0,159,255,139,0,109,255,255,72,0,0,0,0,22,223,255,253,79,222,255,207,0,0,0,0,
-  0,0,0,0,251,255,188,0,0,0,0,0,0,0,0,0,0,0,125,255,255,57,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,232,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,66,255,255,90,128,
-  255,255,56,0,0,0,0,0,0,0,0,0,113,255,222,1,0,0,0,0,0,0,38,255,255,144,0,0,0,0,0,0,
-  0,176,255,244,1,0,0,0,0,0,0,12,255,255,172,0,0,0,0,0,26,222,255,240,51,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,216,255,215,0,0,0,0,0,0,0,0,0,0,0,21,255,255,158,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,48,48,48,221,255,102,48,48,48,227,255,
-  99,48,48,48,0,0,0,0,0,0,0,0,0,0,0,49,171,255,255,255,98,0,0,0,0,0,0,0,103,255,195,2,
-  0,18,255,245,0,0,0,0,101,255,165,0,123,255,255,58,0,0,0,0,0,42,240,255,251,255,255,109,0,0,0,0,
-  0,0,0,7,255,255,188,0,0,0,0,0,0,0,0,0,0,0,113,255,255,71,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,222,255,180,0,128,
-  255,255,56,0,0,0,0,0,0,0,0,0,212,255,125,0,0,0,0,0,0,0,3,247,255,191,0,0,0,0,0,0,
-  0,219,255,203,0,0,0,0,0,0,0,12,255,255,172,0,0,0,0,18,212,255,244,59,0,0,0,0,0,0,0,0,
-  131,224,224,29,0,0,0,0,0,0,0,221,255,212,0,150,228,214,2,0,0,0,0,0,0,54,255,255,135,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,251,255,20,0,0,13,254,255,
-  16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,255,255,223,1,0,0,0,0,0,34,243,244,35,0,
-  0,17,255,245,0,0,0,0,102,255,165,0,88,255,255,117,0,0,0,0,0,0,70,251,255,255,219,8,0,0,0,0,
-  0,0,0,0,250,255,198,0,0,0,0,0,0,0,0,0,0,0,119,255,255,59,0,0,0,0,0,0,0,46,128,195,
-  225,246,104,0,0,0,0,0,139,245,200,16,0,0,19,205,244,132,0,0,0,0,0,0,0,0,145,255,242,29,0,128,
-  255,255,56,0,0,0,0,0,0,0,0,56,255,253,29,0,0,0,0,0,0,0,0,189,255,249,23,0,0,0,0,0,
-  41,255,255,140,0,0,0,0,0,0,0,12,255,255,172,0,0,0,12,201,255,248,67,0,0,0,0,0,0,0,0,0,
-  116,255,255,87,0,0,0,0,0,0,24,254,255,171,0,120,255,255,59,0,0,0,0,0,0,135,255,255,79,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,255,224,0,0,0,64,255,220,
-  0,0,0,0,0,0,0,18,48,48,15,0,0,0,0,0,0,0,184,255,255,35,0,0,0,0,0,189,255,107,0,0,
-  0,2,246,255,47,0,0,0,161,255,141,0,16,243,255,236,37,0,0,0,0,0,52,233,255,255,205,7,0,0,0,0,
-  0,0,0,0,234,255,210,0,0,0,0,0,0,0,0,0,0,0,129,255,255,42,0,0,0,0,0,23,165,254,255,255,
-  255,255,104,0,0,0,0,0,248,255,255,79,0,0,84,255,255,243,0,0,0,0,0,0,0,58,253,255,105,0,0,128,
-  255,255,56,0,0,0,0,0,0,0,0,155,255,183,0,0,0,0,0,0,0,0,0,97,255,255,163,0,0,0,0,2,
-  181,255,255,50,0,0,0,0,0,0,0,12,255,255,172,0,0,7,188,255,250,77,0,0,0,0,0,0,0,0,0,0,
-  36,252,255,218,21,0,0,0,0,1,162,255,255,83,0,32,251,255,209,10,0,0,0,0,47,246,255,232,8,0,0,0,
-  0,0,0,0,0,0,0,68,234,224,46,0,0,0,0,0,0,0,0,0,0,0,0,107,255,172,0,0,0,115,255,168,
-  0,0,0,0,0,0,0,88,255,255,93,0,0,0,0,0,0,0,127,255,255,57,0,0,0,0,0,42,141,1,0,0,
-  0,0,172,255,220,88,60,134,254,255,64,0,0,107,255,255,240,132,67,53,83,165,252,255,255,255,255,155,0,0,0,0,
-  0,0,0,0,215,255,228,0,0,0,0,0,0,0,0,0,0,0,149,255,255,23,0,0,0,0,31,219,255,255,220,131,
-  77,55,19,0,0,0,0,0,142,246,203,18,0,0,21,207,245,136,0,0,0,0,0,0,8,216,255,194,1,0,0,128,
-  255,255,56,0,0,0,0,0,0,0,11,242,255,84,0,0,0,0,0,0,0,0,0,3,208,255,255,184,81,54,84,192,
-  255,255,166,0,0,0,0,0,0,0,0,12,255,255,172,0,3,175,255,255,134,48,48,48,48,48,48,48,48,48,35,0,
-  0,138,255,255,238,123,72,54,90,192,255,255,186,1,0,0,133,255,255,223,108,63,62,128,241,255,255,92,0,0,0,0,
-  0,0,0,0,0,0,0,157,255,255,128,0,0,0,0,0,0,0,0,0,0,0,0,159,255,121,0,0,0,167,255,117,
-  0,0,0,0,0,0,0,55,255,255,146,0,0,0,0,0,0,0,148,255,255,42,0,0,0,0,0,0,0,0,0,0,
-  0,0,33,234,255,255,255,255,255,159,0,0,0,0,116,250,255,255,255,255,255,255,255,239,93,199,255,255,101,0,0,0,
-  0,0,0,0,172,255,254,10,0,0,0,0,0,0,0,0,0,0,182,255,234,0,0,0,0,6,211,255,249,111,2,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,255,247,38,0,0,0,128,
-  255,255,56,0,0,0,0,0,0,0,97,255,235,6,0,0,0,0,0,0,0,0,0,0,29,218,255,255,255,255,255,255,
-  255,191,11,0,0,0,0,0,0,0,0,12,255,255,172,0,59,255,255,255,255,255,255,255,255,255,255,255,255,255,188,0,
-  0,1,142,254,255,255,255,255,255,255,255,179,13,0,0,0,1,145,255,255,255,255,255,255,255,253,116,0,0,0,0,0,
-  0,0,0,0,0,0,0,70,235,226,49,0,0,0,0,0,0,0,0,0,0,0,0,210,255,69,0,0,0,218,255,65,
-  0,0,0,0,0,0,0,4,234,255,241,31,0,0,0,0,0,27,237,255,237,3,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,31,162,235,249,214,112,2,0,0,0,0,0,36,140,207,241,251,232,186,111,14,0,32,239,255,248,54,0,0,
-  0,0,0,0,118,255,255,49,0,0,0,0,0,0,0,0,0,0,225,255,180,0,0,0,0,126,255,255,86,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,252,255,121,0,0,0,0,128,
-  255,255,56,0,0,0,0,0,0,0,196,255,142,0,0,0,0,0,0,0,0,0,0,0,0,8,114,196,237,250,233,185,
-  94,2,0,0,0,0,0,0,0,0,0,12,255,255,172,0,60,255,255,255,255,255,255,255,255,255,255,255,255,255,188,0,
-  0,0,0,50,153,217,245,249,227,171,75,0,0,0,0,0,0,0,58,163,223,248,245,217,152,42,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,114,255,255,227,93,22,6,35,105,229,255,255,125,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,62,255,255,107,0,0,0,0,0,0,0,0,0,25,255,255,125,0,0,0,7,236,255,166,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,209,255,207,4,0,0,0,0,128,
-  255,255,56,0,0,0,0,0,0,39,255,255,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,224,255,255,255,255,255,255,255,255,255,255,255,255,255,140,0,0,0,0,16,120,198,239,251,235,187,
-  101,6,0,0,0,0,0,0,1,163,255,255,255,255,255,255,255,255,255,174,3,0,0,0,0,0,23,124,206,238,245,215,
-  141,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,177,7,0,37,48,48,48,48,48,48,48,48,48,48,48,
-  21,0,0,0,4,231,255,176,0,0,0,0,0,0,0,0,0,95,255,255,40,0,0,0,85,255,255,51,0,3,30,41,
-  16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,255,252,50,0,0,0,0,0,128,
-  255,255,56,0,0,0,0,0,0,138,255,201,0,0,0,0,0,0,0,0,0,0,7,184,71,1,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,33,143,212,244,248,224,162,52,0,0,0,0,0,0,0,0,0,0,0,35,123,184,228,246,249,
-  234,197,143,59,0,0,0,0,0,0,0,0,136,255,255,255,255,255,255,253,241,212,158,65,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,224,255,255,255,255,255,255,255,255,255,255,255,255,255,125,0,0,0,55,230,255,255,255,255,255,255,
-  255,208,27,0,0,0,0,0,0,1,94,211,255,255,255,255,255,211,100,1,0,0,0,0,0,63,235,255,255,255,255,255,
-  255,242,74,0,0,0,0,0,0,0,0,0,0,2,82,199,255,255,8,0,200,255,255,255,255,255,255,255,255,255,255,255,
-  112,0,0,0,0,138,255,244,14,0,0,0,0,0,0,0,0,178,255,198,0,0,0,0,150,255,231,25,153,239,255,255,
-  254,201,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,249,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,255,255,214,103,10,0,0,0,0,
-  0,0,0,0,0,0,87,245,255,255,255,255,255,255,253,112,0,0,0,0,0,0,0,0,34,170,254,255,255,255,255,255,
-  255,255,255,255,202,60,0,0,0,0,0,0,136,255,255,255,255,255,255,255,255,255,255,255,170,7,0,0,0,0,0,0,
-  0,0,0,0,0,0,42,48,48,48,48,48,48,48,48,48,48,156,255,250,28,0,0,22,237,255,255,176,85,58,95,207,
-  255,255,209,4,0,0,0,0,0,0,0,0,25,171,255,174,24,0,0,0,0,0,0,0,36,245,255,249,140,65,60,134,
-  249,255,248,49,0,0,0,0,0,0,0,8,103,218,255,255,255,254,7,0,200,255,255,255,255,255,255,255,255,255,255,255,
-  112,0,0,0,0,39,253,255,108,0,0,0,0,0,0,0,29,251,255,97,0,0,0,0,201,255,223,230,255,255,255,255,
-  255,255,255,117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,244,255,255,255,237,135,27,0,0,
-  0,0,0,0,0,49,252,255,246,137,71,64,120,242,255,254,62,0,0,0,0,0,0,90,243,255,255,200,124,77,56,58,
-  79,110,177,243,255,252,119,0,0,0,0,0,136,255,255,106,48,48,48,50,67,120,229,255,255,151,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,233,255,163,0,0,0,132,255,255,136,0,0,0,0,3,
-  178,255,255,89,0,0,0,0,0,0,0,0,0,148,255,152,0,0,0,0,0,0,0,0,183,255,253,72,0,0,0,0,
-  68,252,255,202,0,0,0,0,0,19,125,234,255,255,255,234,136,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,154,255,217,3,0,0,0,0,0,0,141,255,210,3,0,0,0,0,238,255,255,255,190,66,15,20,
-  105,242,255,254,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,48,48,48,48,48,48,48,48,48,152,
-  255,255,93,48,48,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,101,200,255,255,255,251,166,54,
-  0,0,0,0,0,165,255,255,79,0,0,0,0,68,255,255,175,0,0,0,0,0,109,254,255,194,52,0,0,0,0,0,
-  0,0,0,19,142,252,255,119,0,0,0,0,136,255,255,72,0,0,0,0,0,0,23,232,255,252,22,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,255,255,47,0,0,0,196,255,252,10,0,0,0,0,0,
-  43,255,255,155,0,0,0,0,0,0,0,0,0,148,255,152,0,0,0,0,0,0,0,26,253,255,163,0,0,0,0,0,
-  0,149,255,255,57,0,0,33,147,245,255,255,255,194,90,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,20,239,255,107,0,0,0,0,0,37,249,255,64,0,0,0,0,0,252,255,255,152,1,0,0,0,
-  0,68,254,255,200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,
-  255,255,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,143,236,255,255,255,
-  198,86,4,0,0,216,255,233,0,0,0,0,0,0,222,255,229,0,0,0,0,76,254,255,136,2,0,0,0,0,0,0,
-  0,0,0,0,0,81,248,252,58,0,0,0,136,255,255,72,0,0,0,0,0,0,0,139,255,255,81,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,222,255,187,0,0,0,0,212,255,227,0,0,0,0,0,0,
-  8,255,255,171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,255,255,79,0,0,0,0,0,
-  0,43,255,255,135,0,163,252,255,255,240,148,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,96,255,243,38,0,0,0,7,200,255,157,0,0,0,0,0,11,255,255,223,6,0,0,0,0,
-  0,0,180,255,255,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,
-  255,255,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,86,186,253,
-  255,255,226,71,0,3,4,3,0,0,0,0,0,0,196,255,239,0,0,0,18,236,255,139,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,101,255,201,0,0,0,136,255,255,72,0,0,0,0,0,0,0,109,255,255,100,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,255,255,71,0,0,0,0,180,255,252,10,0,0,0,0,0,
-  47,255,255,138,0,0,136,255,255,255,255,255,253,240,205,145,53,0,0,0,0,0,0,119,255,255,43,0,0,0,0,0,
-  0,0,240,255,185,0,244,255,253,127,11,0,0,0,0,0,0,0,0,0,37,48,48,48,48,48,48,48,48,48,48,48,
-  21,0,0,0,0,0,0,0,149,255,219,27,0,7,172,255,203,9,0,0,0,0,0,15,255,255,168,0,0,0,0,0,
-  0,0,105,255,255,81,0,0,0,0,0,0,0,0,0,128,128,88,0,0,0,0,0,0,0,0,0,0,0,0,0,128,
-  255,255,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,
-  213,255,255,124,0,0,0,0,0,0,0,0,0,3,235,255,206,0,0,0,148,255,199,3,0,0,0,0,11,131,222,250,
-  228,157,34,0,0,0,0,192,255,64,0,0,136,255,255,72,0,0,0,0,0,0,0,139,255,255,72,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,209,255,210,0,0,0,0,0,85,255,255,136,0,0,0,0,1,
-  178,255,253,43,0,0,136,255,255,255,255,255,255,255,255,255,255,179,28,0,0,0,0,126,255,255,44,0,0,0,0,0,
-  0,0,215,255,210,0,213,255,255,251,175,73,2,0,0,0,0,0,0,0,200,255,255,255,255,255,255,255,255,255,255,255,
-  112,0,0,0,0,0,0,0,2,157,255,141,0,81,255,205,20,0,0,0,0,0,0,4,255,255,175,0,0,0,0,0,
-  0,0,74,255,255,101,0,0,142,245,198,14,0,0,0,255,255,176,0,0,0,0,0,0,0,0,0,0,0,0,0,128,
-  255,255,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,151,241,
-  255,255,251,94,0,0,0,0,0,0,0,0,0,105,255,255,122,0,0,20,247,255,53,0,0,0,0,19,209,255,255,255,
-  255,255,244,78,0,0,0,80,255,155,0,0,136,255,255,72,0,0,0,0,0,0,26,235,255,231,10,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,255,255,95,0,0,0,0,0,1,164,255,255,175,84,57,91,199,
-  255,255,120,0,0,0,136,255,255,106,48,48,50,69,113,201,255,255,231,45,0,0,0,101,255,255,80,0,0,0,0,0,
-  0,0,208,255,225,0,3,87,204,255,255,255,224,123,25,0,0,0,0,0,200,255,255,255,255,255,255,255,255,255,255,255,
-  112,0,0,0,0,0,0,0,0,0,106,55,0,10,142,11,0,0,0,0,0,0,0,0,237,255,201,0,0,0,0,0,
-  0,0,77,255,255,94,0,1,251,255,255,75,0,0,0,255,255,173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,106,206,255,255,255,
-  237,135,27,0,0,0,0,0,0,0,0,0,63,246,255,229,13,0,0,112,255,194,0,0,0,0,3,200,255,241,115,57,
-  78,205,255,154,0,0,0,4,237,226,0,0,136,255,255,72,0,0,0,3,34,102,229,255,250,77,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,193,255,229,5,0,0,0,0,0,0,3,118,249,255,255,255,255,255,
-  235,90,0,0,0,0,136,255,255,72,0,0,0,0,0,0,98,251,255,225,18,0,0,46,255,255,165,0,0,0,0,0,
-  0,37,248,255,224,0,0,0,0,66,184,255,255,255,251,175,72,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,184,255,248,13,0,0,0,0,
-  0,0,113,255,255,67,0,0,146,246,201,16,0,0,13,255,255,147,0,0,0,0,0,0,0,0,0,162,255,255,53,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,162,246,255,255,255,215,104,
-  10,0,0,0,0,0,0,0,0,0,0,65,245,255,249,63,0,0,0,188,255,107,0,0,0,0,106,255,246,50,0,0,
-  0,166,255,129,0,0,0,0,184,255,29,0,136,255,255,255,255,255,255,255,255,255,255,212,64,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,56,255,255,119,0,0,0,0,0,0,0,29,177,255,255,255,255,255,255,
-  251,144,11,0,0,0,136,255,255,72,0,0,0,0,0,0,0,100,255,255,150,0,0,0,212,255,253,69,0,0,0,0,
-  27,212,255,255,211,0,0,0,0,0,0,45,163,250,255,255,255,224,5,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,46,144,208,242,250,234,193,123,22,0,0,0,0,0,0,0,0,104,255,255,111,0,0,0,0,
-  0,0,197,255,250,12,0,0,0,0,0,0,0,0,61,255,255,88,0,0,0,0,0,0,0,0,15,246,255,255,152,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,216,255,255,255,255,186,73,1,0,
-  0,0,0,0,0,0,0,0,0,0,52,245,255,250,84,0,0,0,1,244,255,41,0,0,0,2,230,255,129,0,0,0,
-  0,189,255,103,0,0,0,0,134,255,66,0,136,255,255,255,255,255,255,255,255,255,255,226,113,2,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,177,255,242,15,0,0,0,0,0,0,27,223,255,237,102,24,5,35,131,
-  251,255,188,8,0,0,136,255,255,72,0,0,0,0,0,0,0,0,198,255,249,23,0,0,67,255,255,247,133,61,67,128,
-  237,254,253,255,197,0,0,0,0,0,0,0,0,29,142,242,255,255,8,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,0,0,4,145,254,255,255,255,255,255,255,255,244,97,0,0,0,0,0,0,0,11,230,255,241,44,0,0,0,
-  0,97,255,255,160,0,0,0,0,0,0,0,0,0,156,255,233,8,0,0,0,0,0,0,0,0,105,255,255,255,241,10,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,255,255,246,155,43,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,11,227,255,249,73,0,0,0,0,31,255,250,4,0,0,0,68,255,252,24,0,0,0,
-  0,213,255,78,0,0,0,0,111,255,96,0,136,255,255,106,48,48,48,48,56,94,192,255,255,166,1,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,42,254,255,142,0,0,0,0,0,0,0,174,255,246,44,0,0,0,0,0,
-  85,255,255,125,0,0,136,255,255,72,0,0,0,0,0,0,0,0,95,255,255,105,0,0,0,106,252,255,255,255,255,255,
-  248,95,248,255,171,0,0,0,0,0,0,0,0,0,0,16,120,230,8,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,0,6,188,255,255,226,125,68,53,76,144,244,255,255,103,0,0,0,0,0,0,0,74,253,255,241,120,57,67,
-  149,252,255,235,27,0,0,0,0,0,0,0,0,44,251,255,93,0,0,0,0,0,0,0,0,0,204,255,216,255,255,95,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,230,124,20,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,108,255,255,127,0,0,0,0,0,53,255,229,0,0,0,0,142,255,201,0,0,0,0,
-  0,237,255,53,0,0,0,0,95,255,109,0,136,255,255,72,0,0,0,0,0,0,0,157,255,255,88,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,161,255,251,30,0,0,0,0,0,0,29,254,255,153,0,0,0,0,0,0,
-  0,197,255,238,1,0,136,255,255,72,0,0,0,0,0,0,0,0,33,255,255,166,0,0,0,0,51,165,223,248,226,156,
-  39,14,255,255,123,0,0,0,0,0,0,0,0,0,0,0,0,7,1,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,0,135,255,255,177,11,0,0,0,0,0,41,234,255,248,36,0,0,0,0,0,0,0,91,246,255,255,255,255,
-  255,255,231,51,0,0,0,0,0,0,0,0,0,3,121,132,0,0,0,0,0,0,0,0,0,47,255,255,90,202,255,195,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,5,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,167,255,255,30,0,0,0,0,0,64,255,218,0,0,0,0,186,255,149,0,0,0,0,
-  6,254,255,28,0,0,0,0,89,255,116,0,136,255,255,72,0,0,0,0,0,0,0,23,254,255,193,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,30,250,255,166,0,0,0,0,0,0,0,72,255,255,98,0,0,0,0,0,0,
-  0,139,255,255,30,0,136,255,255,72,0,0,0,0,0,0,0,0,0,249,255,203,0,0,0,0,0,0,0,0,0,0,
-  0,68,255,255,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,45,252,255,213,6,0,0,0,0,0,0,0,93,255,255,151,0,0,0,0,0,0,0,0,33,148,220,247,241,
-  204,125,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,255,240,9,105,255,255,
-  39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,188,255,248,0,0,0,0,0,0,60,255,224,0,0,0,0,224,255,117,0,0,0,0,
-  28,255,254,4,0,0,0,0,108,255,103,0,136,255,255,72,0,0,0,0,0,0,0,0,226,255,234,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,145,255,255,50,0,0,0,0,0,0,0,81,255,255,98,0,0,0,0,0,0,
-  0,140,255,255,40,0,136,255,255,72,0,0,0,0,0,0,0,0,0,233,255,219,0,0,0,0,0,0,0,0,0,0,
-  0,161,255,232,4,0,136,255,255,255,255,255,255,255,255,255,255,255,255,176,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,79,0,0,0,0,0,0,0,0,6,240,255,233,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,238,255,154,0,16,248,255,
-  138,0,0,0,0,0,0,0,136,255,255,255,255,255,255,255,255,255,255,255,255,224,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,3,4,3,0,0,0,0,0,0,47,255,239,0,0,0,0,238,255,111,0,0,0,0,
-  51,255,236,0,0,0,0,0,158,255,72,0,136,255,255,72,0,0,0,0,0,0,0,0,227,255,239,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,19,245,255,190,0,0,0,0,0,0,0,0,46,255,255,156,0,0,0,0,0,0,
-  0,199,255,249,11,0,136,255,255,72,0,0,0,0,0,0,0,0,0,228,255,224,0,0,0,0,0,0,0,0,0,0,
-  61,251,255,133,0,0,136,255,255,255,255,255,255,255,255,255,255,255,255,176,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,229,255,241,4,0,0,0,0,0,0,0,0,0,157,212,212,19,0,0,0,0,0,0,56,147,211,237,251,237,
-  201,140,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,255,255,59,0,0,168,255,
-  232,4,0,0,0,0,0,0,136,255,255,255,255,255,255,255,255,255,255,255,255,224,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,255,255,16,0,0,0,230,255,125,0,0,0,0,
-  130,255,235,0,0,0,0,13,238,252,19,0,136,255,255,72,0,0,0,0,0,0,0,31,255,255,204,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,129,255,255,74,0,0,0,0,0,0,0,0,0,217,255,248,55,0,0,0,0,0,
-  95,255,255,176,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,235,255,218,0,0,0,0,0,0,0,0,0,82,
-  239,255,220,11,0,0,136,255,255,106,48,48,48,48,48,48,48,48,48,33,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,23,255,255,191,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,170,255,255,255,255,255,255,
-  255,255,253,145,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,189,255,218,0,0,0,71,255,
-  255,80,0,0,0,0,0,0,136,255,255,106,48,48,48,48,48,48,48,48,48,42,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,255,65,0,0,0,195,255,199,0,0,0,43,
-  243,255,253,24,0,0,0,153,255,179,0,0,136,255,255,72,0,0,0,0,0,0,7,180,255,255,121,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,11,237,255,213,1,0,0,0,0,0,0,0,0,0,73,253,255,246,139,69,52,77,160,
-  254,255,241,40,0,0,136,255,255,72,0,0,0,0,0,0,0,0,1,251,255,203,0,0,0,0,24,55,74,123,205,255,
-  255,231,47,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,51,255,255,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,206,255,255,220,121,68,56,85,
-  141,243,255,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,254,255,123,0,0,0,2,228,
-  255,180,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,116,244,200,13,0,0,0,0,0,0,179,255,131,0,0,0,119,255,255,147,57,100,233,
-  222,242,255,187,66,72,175,255,250,45,0,0,136,255,255,106,48,48,48,48,68,110,222,255,255,218,11,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,113,255,255,98,0,0,0,0,0,0,0,0,0,0,0,90,244,255,255,255,255,255,255,
-  255,228,58,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,39,255,255,167,0,0,0,0,132,255,255,255,255,255,
-  182,31,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,62,255,255,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,255,255,163,7,0,0,0,0,
-  0,23,220,255,255,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,132,255,253,29,0,0,0,0,134,
-  255,252,26,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,217,255,255,68,0,0,0,0,0,0,107,255,220,2,0,0,14,221,255,255,255,255,239,
-  50,128,255,255,255,255,255,251,89,0,0,0,136,255,255,255,255,255,255,255,255,255,255,255,204,31,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,5,226,255,231,6,0,0,0,0,0,0,0,0,0,0,0,0,27,132,202,240,251,236,193,
-  114,14,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,106,255,255,107,0,0,0,0,132,247,228,198,134,53,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,64,255,255,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,255,255,206,3,0,0,0,0,0,
-  0,0,45,255,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,228,255,187,0,0,0,0,0,38,
-  255,255,123,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,119,244,202,14,0,0,0,0,0,0,20,249,255,87,0,0,0,29,171,240,239,171,38,
-  0,1,118,219,248,231,166,46,0,0,0,0,136,255,255,255,255,255,255,255,246,225,173,88,4,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,2,211,255,250,26,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,61,255,255,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,255,255,78,0,0,0,0,0,0,
-  0,0,0,199,255,255,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,255,255,91,0,0,0,0,0,0,
-  196,255,221,1,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,255,230,20,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,160,0,0,0,0,0,0,0,0,0,
-  0,240,255,220,0,0,136,255,255,72,0,0,0,0,0,0,0,125,255,255,157,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,46,255,255,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,255,244,5,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,174,255,255,255,255,255,255,255,255,255,
-  255,255,255,66,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,23,234,255,203,18,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,3,173,255,255,176,3,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,255,74,0,0,0,0,0,0,0,0,
-  0,240,255,220,0,0,136,255,255,72,0,0,0,0,0,5,128,255,255,229,21,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,23,255,255,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,254,255,198,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,250,255,255,255,255,255,255,255,255,255,
-  255,255,255,165,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,249,255,225,76,0,0,0,0,0,0,
-  0,0,7,2,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,154,255,255,195,8,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,255,228,15,0,0,0,0,0,0,0,
-  0,240,255,220,0,0,136,255,255,106,48,48,53,75,131,222,255,255,234,49,0,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,106,48,48,48,48,48,48,48,48,11,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,226,255,240,4,0,0,0,0,0,0,0,0,0,145,196,196,18,0,32,255,255,170,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,255,255,109,76,76,76,76,76,76,76,
-  76,188,255,247,16,0,0,0,136,255,255,255,255,255,255,255,255,255,255,255,136,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,241,255,255,214,133,82,58,52,67,
-  102,160,236,65,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,133,255,255,212,17,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,255,255,157,0,0,0,0,0,0,0,
-  0,240,255,220,0,0,136,255,255,255,255,255,255,255,255,255,255,186,32,0,0,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,255,255,255,255,255,255,255,255,255,60,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,77,0,0,0,0,0,0,0,0,6,240,255,233,0,0,48,255,255,158,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,216,255,226,1,0,0,0,0,0,0,0,
-  0,82,255,255,108,0,0,0,136,255,255,255,255,255,255,255,255,255,255,255,136,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,175,255,255,255,255,255,255,255,
-  255,255,246,82,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,110,255,255,226,27,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,253,255,255,71,0,0,0,0,0,0,
-  0,240,255,220,0,0,136,255,255,255,255,255,253,239,205,145,55,0,0,0,0,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,255,255,255,255,255,255,255,255,255,60,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,48,255,255,208,4,0,0,0,0,0,0,0,91,255,255,149,0,0,52,255,255,156,0,0,0,0,0,132,255,
-  255,255,255,255,255,255,56,0,0,0,0,0,0,0,0,0,0,0,0,0,60,255,255,138,0,0,0,0,0,0,0,0,
-  0,7,239,255,207,0,0,0,136,255,255,106,48,48,48,48,48,48,48,48,25,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,126,187,229,247,250,231,
-  186,117,24,0,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,89,254,255,237,41,0,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,141,254,255,226,14,0,0,0,0,0,
-  0,240,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,0,157,255,255,163,6,0,0,0,0,0,37,231,255,246,34,0,0,50,255,255,159,0,0,0,0,0,132,255,
-  255,255,255,255,255,255,56,0,0,0,0,0,0,0,0,0,0,0,0,0,160,255,255,48,0,0,0,0,0,0,0,0,
-  0,0,154,255,255,51,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,71,250,255,245,56,0,0,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,150,255,255,154,0,0,0,0,0,
-  0,240,255,220,0,136,255,255,255,255,255,255,255,252,235,197,130,28,0,0,0,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,0,11,202,255,255,214,110,62,53,79,146,244,255,254,97,0,0,0,39,255,255,175,0,0,0,0,0,24,48,
-  48,48,48,168,255,255,56,0,0,0,0,0,0,0,0,0,0,0,0,14,245,255,214,0,0,0,0,0,0,0,0,0,
-  0,0,62,255,255,150,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,136,255,255,255,80,0,0,0,0,0,0,0,0,0,0,0,0,41,255,255,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,0,0,54,244,255,251,75,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,12,223,255,255,68,0,0,0,0,
-  0,240,255,220,0,136,255,255,255,255,255,255,255,255,255,255,255,248,110,0,0,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,0,0,12,170,255,255,255,255,255,255,255,255,237,86,0,0,0,0,10,254,255,213,0,0,0,0,0,0,0,
-  0,0,0,148,255,255,56,0,0,0,0,0,0,0,0,0,0,0,0,102,255,255,124,0,0,0,0,0,0,0,0,0,
-  0,0,1,224,255,240,9,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,136,255,255,255,184,0,0,0,0,0,0,0,0,0,0,0,0,145,255,255,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,0,40,236,255,255,96,0,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,0,67,255,255,224,12,0,0,0,
-  0,240,255,220,0,136,255,255,106,48,48,48,48,50,73,144,246,255,255,115,0,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,80,255,255,128,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,60,154,217,243,249,230,185,112,16,0,0,0,0,0,0,211,255,253,22,0,0,0,0,0,0,
-  0,0,0,148,255,255,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,136,255,255,255,254,33,0,0,0,0,0,0,0,0,0,0,9,239,255,255,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,28,226,255,255,120,0,0,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,220,0,136,255,255,76,0,0,153,255,255,151,0,0,0,
-  0,240,255,220,0,136,255,255,72,0,0,0,0,0,0,0,48,241,255,249,33,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,255,255,121,0,0,0,0,0,0,
-  0,0,0,148,255,255,56,0,0,0,0,0,0,38,139,206,242,251,234,189,111,13,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,136,255,255,255,255,136,0,0,0,0,0,0,0,0,0,0,97,255,255,255,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,90,213,255,255,239,17,0,0,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,220,0,136,255,255,76,0,0,13,225,255,254,65,0,0,
-  0,240,255,220,0,136,255,255,72,0,0,0,0,0,0,0,0,111,255,255,128,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,151,213,244,249,228,
-  179,96,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,243,255,242,32,0,0,0,0,0,
-  0,0,0,148,255,255,56,0,0,0,0,5,139,252,255,255,255,255,255,255,255,236,82,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,136,255,255,207,255,233,6,0,0,0,0,0,0,0,0,0,201,255,207,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,238,255,255,255,255,178,1,0,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,106,48,48,48,48,48,48,48,48,48,48,249,255,220,0,136,255,255,76,0,0,0,69,255,255,222,11,0,
-  0,240,255,220,0,136,255,255,72,0,0,0,0,0,0,0,0,30,255,255,183,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,163,255,255,255,255,255,255,
-  255,255,222,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,255,255,219,36,0,0,0,0,
-  0,0,29,214,255,255,55,0,0,0,3,176,255,255,225,124,68,55,83,160,252,255,254,100,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,106,48,48,48,48,48,48,48,48,48,48,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,136,255,255,104,255,255,88,0,0,0,0,0,0,0,0,48,255,255,104,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,255,255,159,215,255,255,122,0,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,0,0,0,0,155,255,255,147,0,
-  0,240,255,220,0,136,255,255,72,0,0,0,0,0,0,0,0,5,255,255,202,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,13,202,255,255,213,112,65,57,90,
-  173,255,255,248,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,255,255,247,152,80,54,60,
-  89,151,244,255,255,177,5,0,0,0,128,255,255,178,12,0,0,0,0,0,53,237,255,250,49,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,255,255,255,255,255,255,255,255,255,255,255,4,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,136,255,255,37,219,255,192,0,0,0,0,0,0,0,0,153,255,243,13,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,255,163,2,42,244,255,252,66,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,0,0,0,0,14,227,255,254,62,
-  0,240,255,220,0,136,255,255,72,0,0,0,0,0,0,0,0,25,255,255,187,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,164,255,255,152,5,0,0,0,0,
-  0,73,247,255,238,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,246,255,255,255,255,255,
-  255,255,255,247,137,6,0,0,0,29,248,255,214,7,0,0,0,0,0,0,0,68,255,255,189,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,255,255,255,255,255,255,255,255,255,255,255,4,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,64,0,136,255,255,36,117,255,255,40,0,0,0,0,0,0,13,243,255,153,0,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,170,3,0,0,89,255,255,233,27,0,0,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,0,0,0,0,0,72,255,255,220,
-  10,240,255,220,0,136,255,255,72,0,0,0,0,0,0,0,0,98,255,255,140,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,255,255,188,1,0,0,0,0,0,
-  0,0,99,255,255,157,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,122,194,236,251,240,
-  220,179,111,27,0,0,0,0,0,132,255,255,80,0,0,0,0,0,0,0,0,0,183,255,255,42,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,152,255,255,62,0,136,255,255,36,21,249,255,144,0,0,0,0,0,0,105,255,255,49,0,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,147,255,255,197,5,0,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,0,0,0,0,0,0,158,255,255,
-  144,240,255,220,0,136,255,255,72,0,0,0,0,0,0,0,34,230,255,255,52,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,220,255,255,255,255,172,0,0,0,0,0,0,0,168,255,255,48,0,0,0,0,0,0,
-  0,0,1,215,255,248,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,212,255,239,5,0,0,0,0,0,0,0,0,0,92,255,255,121,0,140,255,255,255,255,
-  255,255,254,240,214,162,75,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,252,252,168,0,0,0,0,
-  0,0,0,169,255,255,45,0,136,255,255,36,0,166,255,238,9,0,0,0,0,0,208,255,202,0,0,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,5,199,255,255,144,0,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,0,0,0,0,0,0,15,228,255,
-  253,252,255,220,0,136,255,255,106,48,48,48,48,51,73,138,241,255,255,153,0,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,220,255,255,255,255,172,0,0,0,0,0,0,4,242,255,212,0,0,0,0,0,0,0,
-  0,0,0,126,255,255,88,0,0,0,0,4,85,171,222,245,245,220,175,91,7,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,12,255,255,188,0,0,0,0,0,0,0,0,0,0,37,255,255,175,0,140,255,255,255,255,
-  255,255,255,255,255,255,255,197,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,253,255,218,1,0,0,0,
-  0,0,4,228,255,248,10,0,136,255,255,36,0,63,255,255,96,0,0,0,0,57,255,255,98,0,0,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,28,234,255,255,86,0,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,0,0,0,0,0,0,0,75,255,
-  255,255,255,220,0,136,255,255,255,255,255,255,255,255,255,255,255,254,148,4,0,0,0,136,255,255,76,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,220,255,226,48,48,32,0,0,0,0,0,0,47,255,255,156,0,0,0,0,0,0,0,
-  0,0,0,72,255,255,143,0,0,0,40,207,255,255,255,255,255,255,255,255,216,58,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,45,255,255,156,0,0,0,0,0,0,0,0,0,0,3,255,255,209,0,140,255,255,106,48,
-  48,48,49,65,116,219,255,255,218,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,194,255,255,106,0,0,0,
-  0,0,125,255,255,172,0,0,136,255,255,36,0,0,215,255,200,0,0,0,0,161,255,240,10,0,0,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,68,253,255,243,40,0,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,0,0,0,0,0,0,0,0,161,
-  255,255,255,220,0,136,255,255,255,255,255,255,255,252,238,204,144,46,0,0,0,0,0,136,255,255,126,72,72,72,72,72,
-  72,72,72,72,29,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,81,255,255,124,0,0,0,0,0,0,0,
-  0,0,0,38,255,255,176,0,0,32,234,255,255,194,99,66,54,84,160,252,255,245,54,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,59,255,255,142,0,0,0,0,0,0,0,0,0,0,0,244,255,223,0,140,255,255,72,0,
-  0,0,0,0,0,8,187,255,255,122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,251,255,255,164,86,55,
-  78,172,255,255,240,37,0,0,136,255,255,36,0,0,112,255,255,48,0,0,18,247,255,147,0,0,0,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,123,255,255,213,11,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,0,0,0,0,0,0,0,0,17,
-  230,255,255,220,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,255,255,255,255,255,255,
-  255,255,255,255,104,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,95,255,255,110,0,0,0,0,0,0,0,
-  0,0,0,24,255,255,191,0,0,174,255,255,109,0,0,0,0,0,0,66,248,255,221,3,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,64,255,255,140,0,0,0,0,0,0,0,0,0,0,0,240,255,228,0,140,255,255,72,0,
-  0,0,0,0,0,0,35,255,255,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,244,255,255,255,255,
-  255,255,255,230,59,0,0,0,136,255,255,36,0,0,17,247,255,153,0,0,114,255,255,44,0,0,0,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,1,179,255,255,166,0,0,0,0,
-  0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,248,255,220,0,136,255,255,76,0,0,0,0,0,0,0,0,0,
-  77,255,255,220,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,255,255,255,255,255,255,
-  255,255,255,255,104,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,100,255,255,108,0,0,0,0,0,0,0,
-  0,0,0,20,255,255,196,0,9,250,255,218,0,0,0,0,0,0,0,0,141,255,255,83,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,61,255,255,145,0,0,0,0,0,0,0,0,0,0,0,243,255,223,0,140,255,255,72,0,
-  0,0,0,0,0,0,0,227,255,241,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,132,202,239,251,
-  237,196,118,15,0,0,0,0,136,255,255,36,0,0,0,161,255,243,13,0,216,255,196,0,0,0,0,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,17,222,255,255,109,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,97,255,255,113,0,0,0,0,0,0,0,
-  0,0,0,23,255,255,188,0,33,255,255,182,0,0,0,0,0,0,0,0,69,255,255,134,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,49,255,255,159,0,0,0,0,0,0,0,0,0,0,2,254,255,210,0,140,255,255,72,0,
-  0,0,0,0,0,0,0,221,255,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,36,0,0,0,57,255,255,105,66,255,255,93,0,0,0,0,252,255,180,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,6,246,255,210,0,0,0,0,0,0,0,0,213,255,208,0,0,0,0,0,0,0,4,245,255,216,0,0,0,0,0,
-  0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,56,0,220,255,220,0,0,0,0,0,0,0,0,0,85,255,255,127,0,0,0,0,0,0,0,
-  0,0,0,37,255,255,165,0,14,253,255,229,7,0,0,0,0,0,0,0,9,44,44,26,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,17,255,255,196,0,0,0,0,0,0,0,0,0,0,30,255,255,177,0,140,255,255,72,0,
-  0,0,0,0,0,0,23,253,255,212,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,36,0,0,0,0,209,255,208,170,255,237,8,0,0,0,0,252,255,180,0,104,
-  255,255,164,0,0,0,0,0,0,0,0,0,0,0,141,255,255,131,0,224,255,255,255,255,168,0,125,244,191,8,0,0,
-  0,0,190,255,253,16,0,0,0,0,0,0,31,255,255,254,24,0,0,0,0,0,0,53,255,255,152,0,0,0,0,0,
-  0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,56,0,220,255,220,0,0,0,0,0,0,0,0,0,53,255,255,164,0,0,0,0,0,0,0,
-  0,0,0,66,255,255,142,0,0,187,255,255,168,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,220,255,245,10,0,0,0,0,0,0,0,0,0,83,255,255,123,0,140,255,255,72,0,
-  0,0,0,0,0,1,168,255,255,124,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,36,0,0,0,0,106,255,255,253,255,142,0,0,0,0,0,252,255,180,0,16,
-  247,255,243,9,0,0,0,0,0,0,0,0,0,2,228,255,255,35,0,224,255,255,255,255,168,0,229,255,255,56,0,0,
-  0,0,127,255,255,74,0,0,0,0,0,0,105,255,255,255,96,0,0,0,0,0,0,112,255,255,89,0,0,0,0,0,
-  0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,13,48,48,48,48,48,48,139,255,255,
-  122,48,48,48,48,48,48,10,0,220,255,220,0,0,0,0,0,0,0,0,0,8,247,255,223,0,0,0,0,0,0,0,
-  0,0,0,119,255,255,89,0,0,44,241,255,255,230,122,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,141,255,255,95,0,0,0,0,0,0,0,0,0,171,255,255,45,0,140,255,255,72,0,
-  0,0,1,17,73,192,255,255,209,10,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,36,0,0,0,0,14,244,255,255,255,39,0,0,0,0,0,252,255,180,0,0,
-  167,255,255,86,0,0,0,0,0,0,0,0,0,64,255,255,194,0,0,42,48,57,255,255,168,0,130,245,195,10,0,0,
-  0,0,64,255,255,134,0,0,0,0,0,0,178,255,255,255,168,0,0,0,0,0,0,171,255,255,26,0,0,0,0,0,
-  0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,177,255,255,62,0,0,0,0,0,0,
-  0,0,0,207,255,250,15,0,0,0,51,220,255,255,255,255,208,132,47,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,35,248,255,226,14,0,0,0,0,0,0,0,53,253,255,193,0,0,140,255,255,255,255,
-  255,255,255,255,255,255,255,195,18,0,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,36,0,0,0,0,0,155,255,255,191,0,0,0,0,0,0,252,255,180,0,0,
-  71,255,255,175,0,0,0,0,0,0,0,0,0,153,255,255,98,0,0,0,0,12,255,255,168,0,0,0,0,0,0,0,
-  0,0,8,248,255,194,0,0,0,0,0,7,244,255,211,255,237,2,0,0,0,0,0,230,255,219,0,0,0,0,0,0,
-  0,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,64,255,255,201,4,0,0,0,0,0,
-  0,0,87,255,255,166,0,0,0,0,0,7,110,220,255,255,255,255,255,203,78,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,118,255,255,191,17,0,0,0,0,0,41,228,255,251,52,0,0,140,255,255,255,255,
-  255,255,255,255,255,254,83,0,0,0,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,0,0,
-  0,0,0,0,0,0,0,0,136,255,255,36,0,0,0,0,0,52,255,255,87,0,0,0,0,0,0,252,255,180,0,0,
-  2,228,255,248,15,0,0,0,0,0,0,0,5,237,255,245,13,0,0,0,0,12,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,194,255,247,6,0,0,0,0,70,255,255,102,255,255,56,0,0,0,0,33,255,255,156,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,0,154,255,255,164,7,0,0,0,0,
-  0,62,243,255,241,26,0,0,0,0,0,0,0,1,58,138,217,255,255,255,255,164,9,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,3,172,255,255,232,128,68,54,78,151,248,255,255,103,0,0,0,140,255,255,106,48,
-  48,48,48,149,255,255,101,0,0,0,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,134,255,255,97,0,0,0,0,0,0,0,76,255,255,161,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,131,255,255,58,0,0,0,0,143,255,234,4,234,255,128,0,0,0,0,92,255,255,93,0,0,0,173,255,255,
-  157,0,0,0,0,0,0,0,0,1,195,255,255,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,0,13,198,255,255,218,116,65,55,85,
-  165,253,255,249,80,0,0,0,0,0,0,0,0,0,0,0,0,45,147,247,255,255,170,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,1,131,252,255,255,255,255,255,255,255,237,86,0,0,0,0,140,255,255,72,0,
-  0,0,0,18,241,255,228,9,0,0,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,128,255,255,
-  182,0,0,0,0,0,0,0,0,0,0,183,255,255,120,0,54,255,255,93,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,38,255,255,186,0,0,0,0,0,0,0,166,255,255,65,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,69,255,255,118,0,0,0,0,217,255,161,0,163,255,200,0,0,0,0,151,255,255,30,0,0,0,24,238,255,
-  254,64,0,0,0,0,0,0,0,103,255,255,218,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,0,0,7,158,255,255,255,255,255,255,
-  255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,226,255,255,61,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,39,140,207,242,251,235,191,113,15,0,0,0,0,0,140,255,255,72,0,
-  0,0,0,0,126,255,255,118,0,0,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,11,230,255,
-  255,59,0,0,0,0,0,0,0,0,61,255,255,224,8,0,0,211,255,192,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,197,255,252,23,0,0,0,0,0,10,244,255,223,1,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,11,251,255,178,0,0,0,35,255,255,85,0,90,255,253,19,0,0,0,210,255,223,0,0,0,0,0,97,255,
-  255,217,7,0,0,0,0,0,24,239,255,254,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,152,214,246,250,229,
-  220,255,255,228,62,0,0,0,42,52,52,0,0,0,0,0,0,0,0,0,91,255,255,138,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,255,255,72,0,
-  0,0,0,0,12,234,255,238,16,0,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,98,255,
-  255,192,0,0,0,0,0,0,0,0,195,255,255,89,0,0,0,112,255,254,36,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,101,255,255,108,0,0,0,0,0,89,255,255,128,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,199,255,237,1,0,0,108,255,250,14,0,19,253,255,89,0,0,15,253,255,160,0,0,0,0,0,0,186,
-  255,255,132,0,0,0,0,0,170,255,255,151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  5,150,255,255,252,124,2,0,196,255,255,20,0,0,0,0,0,0,0,0,46,255,255,164,0,140,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,84,0,0,0,0,0,0,101,128,35,0,0,0,0,0,0,0,0,0,140,255,255,72,0,
-  0,0,0,0,0,113,255,255,136,0,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,2,209,
-  255,255,70,0,0,0,0,0,0,74,255,255,201,1,0,0,0,20,249,255,134,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,14,246,255,197,0,0,0,0,0,178,255,254,33,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,136,255,255,43,0,0,182,255,188,0,0,0,199,255,161,0,0,72,255,255,97,0,0,0,0,0,0,32,
-  244,255,250,44,0,0,0,76,255,255,227,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,95,247,255,255,137,0,139,255,255,106,0,0,0,0,0,0,0,0,82,255,255,141,0,140,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,83,0,0,0,0,0,30,252,255,150,0,0,0,0,0,0,0,0,0,140,255,255,72,0,
-  0,0,0,0,0,7,227,255,246,26,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,0,68,
-  255,255,203,0,0,0,0,0,1,206,255,255,60,0,0,0,0,0,170,255,229,3,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,164,255,254,31,0,0,0,18,249,255,191,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,73,255,255,103,0,9,246,255,112,0,0,0,126,255,231,1,0,131,255,255,34,0,0,0,0,0,0,0,
-  111,255,255,199,2,0,11,225,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,50,224,186,11,0,32,246,255,241,64,0,0,0,0,0,0,20,213,255,255,62,0,26,48,48,48,48,48,48,
-  48,48,48,48,116,255,255,226,15,0,0,0,0,0,133,255,255,243,13,0,0,0,0,0,0,0,0,140,255,255,72,0,
-  0,0,0,0,0,0,100,255,255,153,0,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,0,0,
-  181,255,255,81,0,0,0,0,87,255,255,172,0,0,0,0,0,0,71,255,255,76,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,68,255,255,119,0,0,0,101,255,255,95,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,14,252,255,163,0,73,255,255,36,0,0,0,52,255,255,49,0,190,255,227,0,0,0,0,0,0,0,0,
-  2,198,255,255,108,0,143,255,255,166,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,17,6,0,0,0,79,250,255,254,175,96,59,52,72,130,233,255,255,163,0,0,0,0,0,0,0,0,0,
-  0,0,0,17,228,255,254,66,0,0,0,0,0,6,233,255,255,255,107,0,0,0,0,0,0,0,0,140,255,255,72,0,
-  0,0,0,0,0,0,4,218,255,251,38,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,0,0,
-  42,252,255,212,2,0,0,3,217,255,249,35,0,0,0,0,0,0,2,226,255,175,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,2,226,255,208,0,0,0,191,255,243,11,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,0,203,255,223,0,147,255,215,0,0,0,0,1,233,255,121,4,244,255,164,0,0,0,0,0,0,0,0,
-  0,41,249,255,242,79,252,255,235,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,63,211,255,255,255,255,255,255,255,255,253,144,4,0,0,0,0,0,0,0,0,0,
-  0,0,0,167,255,255,142,0,0,0,0,0,0,91,255,247,162,255,213,0,0,0,0,0,0,0,0,140,255,255,72,0,
-  0,0,0,0,0,0,0,87,255,255,171,0,240,255,212,0,0,0,0,0,0,0,0,0,88,255,255,120,0,0,0,0,
-  0,151,255,255,92,0,0,99,255,255,142,0,0,0,0,0,0,0,0,129,255,251,23,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,131,255,255,41,0,26,253,255,158,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,0,141,255,255,22,220,255,139,0,0,0,0,0,161,255,192,48,255,255,101,0,0,0,0,0,0,0,0,
-  0,0,125,255,255,254,255,255,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,45,48,48,48,48,48,48,48,48,48,48,48,48,23,0,4,
-  118,128,128,34,0,0,0,0,0,0,0,3,79,157,214,239,251,237,200,138,41,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,90,255,255,211,7,0,0,0,0,0,0,197,255,163,43,255,255,65,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,231,255,219,0,0,0,0,0,0,0,0,0,96,255,255,111,0,0,0,0,
-  0,22,242,255,220,5,7,225,255,238,17,0,0,0,0,0,0,0,0,31,254,255,118,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,35,255,255,130,0,113,255,255,62,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,0,78,255,255,90,255,255,63,0,0,0,0,0,88,255,247,97,255,255,38,0,0,0,0,0,0,0,0,
-  0,0,5,209,255,255,255,181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,240,255,255,255,255,255,255,255,255,255,255,255,255,124,0,0,
-  86,254,255,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,28,239,255,249,47,0,0,0,0,0,0,48,255,255,61,0,197,255,171,0,0,0,0,0,0,30,134,206,238,250,230,
-  177,77,0,0,0,0,0,0,0,0,0,0,206,255,248,8,0,0,0,0,0,0,0,0,132,255,255,82,0,0,0,0,
-  0,0,121,255,255,103,111,255,255,112,0,0,0,0,0,0,0,0,0,0,186,255,216,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,194,255,219,0,203,255,220,1,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,0,17,253,255,190,255,238,4,0,0,0,0,0,18,252,255,188,255,231,0,0,0,0,0,0,0,0,0,
-  0,0,0,107,255,255,255,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,240,255,255,255,255,255,255,255,255,255,255,255,255,124,0,0,
-  0,126,255,255,93,0,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  1,188,255,255,119,0,0,0,0,0,0,0,155,255,215,0,0,94,255,251,26,0,0,0,0,108,247,255,255,255,255,255,
-  255,255,162,2,0,0,0,0,0,0,0,0,142,255,255,92,0,0,0,0,0,0,0,3,218,255,252,20,0,0,0,0,
-  0,0,8,225,255,228,233,255,219,5,0,0,0,0,0,0,0,0,0,0,87,255,255,60,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,98,255,255,89,255,255,125,0,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,0,0,208,255,254,255,166,0,0,0,0,0,0,0,197,255,254,255,168,0,0,0,0,0,0,0,0,0,
-  0,0,16,230,255,255,255,208,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,166,255,235,19,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  112,255,255,194,2,0,0,0,0,0,0,16,245,255,114,0,0,9,238,255,129,0,0,0,95,255,255,227,117,65,62,107,
-  225,255,255,117,0,0,0,0,0,0,0,0,39,251,255,235,43,0,0,0,0,0,2,148,255,255,156,0,0,0,0,0,
-  0,0,0,91,255,255,255,255,82,0,0,0,0,0,0,0,0,0,0,0,7,237,255,159,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,13,245,255,238,255,254,30,0,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,0,0,145,255,255,255,90,0,0,0,0,0,0,0,124,255,255,255,105,0,0,0,0,0,0,0,0,0,
-  0,0,158,255,255,250,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,220,0,0,0,0,0,0,0,9,99,191,227,249,232,179,81,0,0,0,0,0,
-  0,0,8,199,255,159,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,
-  247,255,242,32,0,0,0,0,0,0,0,112,255,248,19,0,0,0,146,255,230,5,0,0,227,255,233,24,0,0,0,0,
-  27,238,255,223,0,0,0,0,0,0,0,0,0,118,255,255,246,148,78,53,61,106,204,255,255,216,16,0,0,0,0,0,
-  0,0,0,1,203,255,255,195,0,0,0,0,0,0,0,0,0,0,0,0,0,145,255,244,13,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,161,255,255,255,188,0,0,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,0,0,82,255,255,252,17,0,0,0,0,0,0,0,50,255,255,255,42,0,0,0,0,0,0,0,0,0,
-  0,70,255,255,234,59,248,255,248,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,226,48,48,32,0,0,0,38,217,255,255,255,255,255,255,255,179,10,0,0,0,
-  0,0,0,0,0,0,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,206,
-  255,255,97,0,0,0,0,0,0,0,1,217,255,166,0,0,0,0,43,255,255,86,0,4,100,100,69,0,0,0,0,0,
-  0,172,255,255,12,0,0,0,0,0,0,0,0,0,108,247,255,255,255,255,255,255,255,255,187,22,0,0,0,0,0,0,
-  0,0,0,0,110,255,255,102,0,0,0,0,0,0,0,0,0,0,0,0,0,46,255,255,101,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,65,255,255,255,92,0,0,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,0,0,20,254,255,194,0,0,0,0,0,0,0,0,1,231,255,234,0,0,0,0,0,0,0,0,0,0,
-  12,224,255,255,88,0,124,255,255,198,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,255,
-  92,0,0,0,0,0,0,0,0,220,255,255,255,255,172,0,0,22,234,255,253,157,74,58,98,213,255,255,175,0,0,0,
-  0,1,171,245,147,0,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,255,
-  255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,152,255,255,23,0,0,0,0,0,0,0,0,0,0,24,125,193,234,251,251,219,161,70,0,0,0,0,0,0,0,0,
-  0,0,0,0,108,255,255,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,255,200,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,1,223,255,241,10,0,0,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  148,255,255,179,0,0,5,211,255,255,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,220,255,255,255,255,172,0,0,170,255,255,89,0,0,0,0,5,191,255,255,62,0,0,
-  0,25,255,255,253,3,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,252,255,
-  231,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,41,16,0,0,0,0,0,0,48,143,201,236,251,255,
-  255,255,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,108,255,255,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,255,255,44,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,255,255,168,0,0,0,0,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,
-  254,255,242,28,0,0,0,55,253,255,244,33,0,0,0,0,0,0,0,1,88,186,238,249,227,166,58,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,253,255,176,0,0,0,0,0,0,39,255,255,136,0,0,
-  0,1,176,246,153,0,0,244,255,196,2,97,192,237,248,221,149,29,0,0,0,0,0,0,0,0,0,0,12,221,255,255,
-  74,0,0,0,0,0,0,0,0,0,0,0,0,0,3,117,228,255,255,255,97,0,0,0,4,150,254,255,255,255,255,255,
-  255,255,255,255,24,0,0,0,0,30,150,222,248,236,189,92,1,181,255,204,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,108,255,255,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,245,255,143,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,196,0,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,217,
-  255,255,105,0,0,0,0,0,145,255,255,187,0,0,0,0,0,0,15,183,255,255,255,255,255,255,255,130,0,0,0,240,
-  255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,255,255,83,0,0,0,0,0,0,0,142,152,95,0,0,
-  0,0,0,0,0,0,0,244,255,206,185,255,255,255,255,255,255,242,63,0,0,0,0,0,0,0,0,0,156,255,255,152,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,161,255,255,255,255,255,100,0,0,0,147,255,255,233,137,81,56,48,
-  48,171,255,255,24,0,0,0,69,244,255,255,255,255,255,255,179,208,255,204,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,108,255,255,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,161,255,235,6,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,196,0,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,255,
-  255,194,1,0,0,0,0,0,12,225,255,255,99,0,0,0,0,6,204,255,255,173,76,54,96,215,255,255,100,0,0,240,
-  255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,255,255,34,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,244,255,255,255,189,89,56,76,168,255,255,240,25,0,0,0,0,0,0,0,78,255,255,218,11,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,56,255,255,226,75,14,12,9,0,0,25,253,255,212,18,0,0,0,0,
-  0,152,255,255,24,0,0,37,245,255,255,164,75,56,93,198,255,255,255,204,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,108,255,255,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,255,255,85,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,196,0,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,252,255,
-  248,39,0,0,0,0,0,0,0,74,255,255,239,25,0,0,0,131,255,255,135,0,0,0,0,13,212,255,238,9,0,240,
-  255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,162,255,255,16,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,220,255,216,0,0,244,255,255,145,0,0,0,0,0,125,255,255,154,0,0,0,0,0,0,22,233,255,251,55,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,129,255,255,82,0,0,0,0,0,0,84,255,255,99,0,0,0,0,0,
-  0,152,255,255,24,0,0,179,255,255,112,0,0,0,0,3,159,255,255,204,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,108,255,255,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,255,184,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,196,0,0,0,0,0,0,0,0,0,12,255,255,168,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,210,255,255,
-  122,0,0,0,0,0,0,0,0,0,166,255,255,176,0,0,8,241,255,215,6,0,0,0,0,0,81,255,255,89,0,240,
-  255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,161,255,255,15,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,220,255,216,0,0,244,255,223,6,0,0,0,0,0,3,218,255,243,9,0,0,0,0,0,177,255,255,129,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,152,255,255,30,0,0,0,0,0,0,96,255,255,94,0,0,0,0,0,
-  0,180,255,255,24,0,27,253,255,203,0,0,0,0,0,0,9,243,255,204,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,108,255,255,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,255,253,29,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,196,0,0,0,0,0,0,0,42,48,57,255,255,168,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,255,255,122,0,0,0,0,0,0,14,255,255,149,0,240,
-  255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,32,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,220,255,216,0,0,244,255,196,0,0,0,0,0,0,0,132,255,255,57,0,0,0,0,99,255,255,225,52,48,48,
-  48,48,48,48,48,48,48,48,38,0,0,0,0,156,255,255,24,0,0,0,0,0,0,58,255,255,182,0,0,0,0,0,
-  115,255,255,255,31,0,89,255,255,112,0,0,0,0,0,0,0,236,255,204,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,252,255,126,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,240,255,196,0,0,0,0,0,0,0,224,255,255,255,255,168,0,184,255,252,0,0,0,
-  0,244,255,196,0,68,174,231,250,232,171,50,0,0,0,244,255,168,0,74,177,232,250,231,170,49,0,0,0,0,0,0,
-  3,81,180,223,248,233,187,101,4,0,0,0,0,0,0,0,127,255,255,101,48,48,48,48,48,48,48,249,255,186,0,240,
-  255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,255,255,79,0,0,0,0,0,0,0,39,44,28,0,0,
-  0,0,220,255,216,0,0,244,255,196,0,0,0,0,0,0,0,84,255,255,96,0,0,0,0,188,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,204,0,32,255,255,255,255,255,255,255,255,120,0,0,0,2,207,255,255,182,80,57,93,191,
-  255,255,255,255,51,0,130,255,255,61,0,0,0,0,0,0,0,236,255,204,0,248,255,160,5,104,192,237,249,226,160,42,
-  0,0,23,132,212,243,246,214,137,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,178,255,223,1,0,0,0,
-  0,31,150,223,249,236,186,88,1,240,255,196,0,0,0,0,0,0,0,224,255,255,255,255,168,0,184,255,252,0,0,0,
-  0,244,255,197,148,255,255,255,255,255,255,249,70,0,0,244,255,171,158,255,255,255,255,255,255,248,69,0,0,0,0,21,
-  195,255,255,255,255,255,255,255,212,33,0,0,0,0,0,0,152,255,255,255,255,255,255,255,255,255,255,255,255,201,0,240,
-  255,196,0,0,0,0,0,83,252,255,225,28,0,0,0,0,32,253,255,169,0,0,0,0,0,0,19,252,255,138,0,0,
-  0,0,220,255,216,0,0,244,255,196,0,0,0,0,0,0,0,65,255,255,112,0,0,0,0,188,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,204,0,32,255,255,255,255,255,255,255,255,120,0,0,0,0,36,226,255,255,255,255,255,255,
-  222,165,255,255,97,0,146,255,255,39,0,0,0,0,0,0,0,236,255,204,0,248,255,183,204,255,255,255,255,255,255,245,
-  64,64,235,255,255,255,255,255,255,224,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  69,244,255,255,255,255,255,255,173,243,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,184,255,252,0,0,0,
-  0,244,255,254,255,205,95,58,81,176,255,255,224,2,0,244,255,252,255,204,95,58,81,176,255,255,224,2,0,0,10,215,
-  255,255,183,84,54,82,177,255,255,228,21,0,0,0,0,0,160,255,255,255,255,255,255,255,255,255,255,255,255,208,0,240,
-  255,196,0,0,0,0,71,249,255,234,38,0,0,0,0,0,0,174,255,254,80,0,0,0,0,1,165,255,255,61,0,0,
-  0,0,220,255,216,0,0,244,255,196,0,0,0,0,0,0,0,68,255,255,114,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,6,48,48,174,255,255,67,48,48,22,0,0,0,0,0,17,133,214,248,243,204,118,
-  11,54,192,192,121,0,143,255,255,36,0,0,0,0,0,0,0,236,255,204,0,248,255,255,253,156,75,57,90,199,255,255,
-  229,242,253,152,76,54,91,205,255,255,162,0,0,244,255,144,6,109,197,239,248,219,145,25,0,0,0,0,0,0,0,37,
-  246,255,254,160,74,56,93,197,255,255,255,196,0,244,255,180,28,155,228,252,184,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,255,166,4,0,0,0,0,183,255,255,59,0,244,255,255,164,3,0,0,0,0,183,255,255,59,0,0,145,255,
-  255,134,0,0,0,0,0,120,255,255,170,0,0,0,0,0,143,255,255,34,0,0,0,0,0,0,0,0,0,0,0,240,
-  255,196,0,0,0,59,245,255,242,51,0,0,0,0,0,0,0,28,236,255,252,153,73,56,93,202,255,255,162,0,0,0,
-  0,0,220,255,216,0,0,244,255,196,0,0,0,0,0,0,0,89,255,255,97,0,0,0,0,33,152,222,248,238,192,98,
-  3,197,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,125,255,255,56,0,0,0,0,0,0,0,236,255,204,0,248,255,255,94,0,0,0,0,2,203,255,
-  255,255,90,0,0,0,0,14,234,255,246,5,0,244,255,181,204,255,255,255,255,255,255,240,58,0,0,0,0,0,0,180,
-  255,255,104,0,0,0,0,2,157,255,255,196,0,244,255,212,234,255,255,255,184,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,229,11,0,0,0,0,0,90,255,255,104,0,244,255,226,9,0,0,0,0,0,90,255,255,104,0,14,247,255,
-  206,2,0,0,0,0,0,0,190,255,253,37,0,0,0,0,103,255,255,77,0,0,0,0,0,0,0,0,0,0,0,240,
-  255,196,0,0,48,240,255,248,64,0,0,0,0,0,0,0,0,0,44,224,255,255,255,255,255,255,255,156,5,0,0,0,
-  0,0,220,255,216,0,0,244,255,196,0,0,0,0,0,0,0,137,255,255,57,0,0,0,78,246,255,255,255,255,255,255,
-  188,223,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,0,0,0,64,168,227,250,243,209,138,
-  29,0,0,0,0,0,81,255,255,105,0,0,0,0,0,0,0,236,255,204,0,248,255,203,0,0,0,0,0,0,98,255,
-  255,198,0,0,0,0,0,0,152,255,255,39,0,244,255,255,255,167,79,55,87,192,255,255,238,23,0,0,0,0,29,253,
-  255,195,0,0,0,0,0,0,8,245,255,196,0,244,255,255,254,156,75,54,49,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,60,255,255,120,0,244,255,192,0,0,0,0,0,0,60,255,255,120,0,93,255,255,
-  104,0,0,0,0,0,0,0,80,255,255,112,0,0,0,0,32,253,255,180,0,0,0,0,0,0,0,4,2,0,0,240,
-  255,196,0,39,233,255,252,79,0,0,0,0,0,0,0,0,0,0,0,9,112,194,236,249,224,162,59,0,0,0,0,0,
-  0,0,220,255,216,0,0,244,255,223,6,0,0,0,0,0,4,221,255,242,8,0,0,44,249,255,255,170,77,56,90,191,
-  255,255,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,0,2,149,255,255,255,255,255,255,255,
-  243,81,0,0,0,0,20,250,255,197,0,0,0,0,0,0,11,244,255,204,0,248,255,188,0,0,0,0,0,0,63,255,
-  255,136,0,0,0,0,0,0,121,255,255,54,0,244,255,255,103,0,0,0,0,1,160,255,255,149,0,0,0,0,92,255,
-  255,104,0,0,0,0,0,0,0,240,255,196,0,244,255,255,99,0,0,0,0,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,56,255,255,124,0,244,255,192,0,0,0,0,0,0,56,255,255,124,0,136,255,255,
-  46,0,0,0,0,0,0,0,19,255,255,162,0,0,0,0,0,169,255,255,120,0,0,0,0,0,12,176,192,28,0,240,
-  255,196,23,225,255,255,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,220,255,216,0,0,244,255,255,149,1,0,0,0,0,128,255,255,151,0,0,0,187,255,255,117,0,0,0,0,1,
-  143,255,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,0,119,255,255,209,97,58,75,153,252,
-  255,250,46,0,0,0,0,168,255,255,104,0,0,0,0,3,161,255,255,204,0,248,255,188,0,0,0,0,0,0,56,255,
-  255,128,0,0,0,0,0,0,116,255,255,56,0,244,255,205,0,0,0,0,0,0,12,234,255,240,6,0,0,0,133,255,
-  255,53,0,0,0,0,0,0,0,240,255,196,0,244,255,210,0,0,0,0,0,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,56,255,255,124,0,244,255,192,0,0,0,0,0,0,56,255,255,124,0,162,255,255,
-  21,0,0,0,0,0,0,0,0,250,255,182,0,0,0,0,0,21,226,255,255,188,91,54,66,119,224,255,248,59,0,240,
-  255,202,197,255,255,136,0,0,0,0,0,0,0,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,220,255,216,0,0,244,255,255,255,193,90,55,75,169,255,255,237,23,0,0,32,254,255,202,1,0,0,0,0,0,
-  2,246,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,0,231,255,228,14,0,0,0,0,101,
-  255,255,159,0,0,0,0,30,242,255,254,159,73,56,92,198,255,255,255,204,0,248,255,188,0,0,0,0,0,0,56,255,
-  255,128,0,0,0,0,0,0,116,255,255,56,0,244,255,196,0,0,0,0,0,0,0,147,255,255,50,0,0,0,150,255,
-  255,31,0,0,0,0,0,0,0,240,255,196,0,244,255,192,0,0,0,0,0,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,56,255,255,124,0,244,255,192,0,0,0,0,0,0,56,255,255,124,0,163,255,255,
-  17,0,0,0,0,0,0,0,1,253,255,182,0,0,0,0,0,0,32,207,255,255,255,255,255,255,255,233,73,0,0,240,
-  255,255,255,255,255,214,10,0,0,0,0,0,0,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,220,255,216,0,0,244,255,177,193,255,255,255,255,255,255,240,57,0,0,0,94,255,255,108,0,0,0,0,0,0,
-  0,244,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,8,255,255,178,0,0,0,0,0,2,
-  203,212,169,0,0,0,0,0,63,242,255,255,255,255,255,255,182,241,255,204,0,248,255,188,0,0,0,0,0,0,56,255,
-  255,128,0,0,0,0,0,0,116,255,255,56,0,244,255,196,0,0,0,0,0,0,0,94,255,255,89,0,0,0,148,255,
-  255,28,0,0,0,0,0,0,0,240,255,196,0,244,255,192,0,0,0,0,0,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,56,255,255,124,0,244,255,192,0,0,0,0,0,0,56,255,255,124,0,143,255,255,
-  40,0,0,0,0,0,0,0,23,255,255,155,0,0,0,0,0,0,0,3,94,181,231,250,234,201,120,20,0,0,0,240,
-  255,255,255,222,255,255,159,0,0,0,0,0,0,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,220,255,216,0,0,244,255,148,3,101,193,238,249,222,147,26,0,0,0,0,134,255,255,55,0,0,0,0,0,0,
-  0,244,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,0,229,255,237,36,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,29,149,223,249,238,190,94,2,237,255,200,0,248,255,188,0,0,0,0,0,0,56,255,
-  255,128,0,0,0,0,0,0,116,255,255,56,0,244,255,196,0,0,0,0,0,0,0,73,255,255,104,0,0,0,131,255,
-  255,47,0,0,0,0,0,0,0,240,255,196,0,244,255,192,0,0,0,0,0,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,56,255,255,124,0,244,255,192,0,0,0,0,0,0,56,255,255,124,0,93,255,255,
-  97,0,0,0,0,0,0,0,81,255,255,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,
-  255,255,154,11,212,255,255,92,0,0,0,0,0,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,220,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,255,255,32,0,0,0,0,0,0,
-  0,244,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,0,105,255,255,246,165,91,28,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,252,255,180,0,248,255,188,0,0,0,0,0,0,56,255,
-  255,128,0,0,0,0,0,0,116,255,255,56,0,244,255,196,0,0,0,0,0,0,0,77,255,255,106,0,0,0,87,255,
-  255,98,0,0,0,0,0,0,0,240,255,196,0,244,255,192,0,0,0,0,0,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,56,255,255,124,0,244,255,192,0,0,0,0,0,0,56,255,255,124,0,22,248,255,
-  200,1,0,0,0,0,0,0,186,255,254,28,0,4,255,255,176,0,0,0,0,0,0,60,255,255,120,0,0,0,0,240,
-  255,211,2,0,41,244,255,243,37,0,0,0,0,0,224,255,255,255,255,255,255,255,176,0,0,0,0,0,0,0,0,0,
-  0,0,220,255,216,0,0,86,255,255,106,0,0,0,0,0,0,6,239,255,202,0,148,255,255,29,0,0,0,0,0,0,
-  0,244,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,0,0,100,239,255,255,255,255,217,134,
-  33,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,72,255,255,130,0,248,255,188,0,0,0,0,0,0,56,255,
-  255,128,0,0,0,0,0,0,116,255,255,56,0,244,255,196,0,0,0,0,0,0,0,100,255,255,89,0,0,0,23,251,
-  255,191,0,0,0,0,0,0,11,246,255,196,0,244,255,192,0,0,0,0,0,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,56,255,255,124,0,244,255,192,0,0,0,0,0,0,56,255,255,124,0,0,151,255,
-  255,127,0,0,0,0,0,109,255,255,166,0,0,4,255,255,176,0,0,0,0,0,0,60,255,255,120,0,0,0,0,240,
-  255,196,0,0,0,94,255,255,207,7,0,0,0,0,224,255,255,255,255,255,255,255,176,0,0,0,0,0,0,0,0,0,
-  0,0,220,255,216,0,0,9,241,255,191,0,0,0,0,0,0,73,255,255,111,0,132,255,255,49,0,0,0,0,0,0,
-  0,244,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,0,0,0,10,94,168,231,255,255,255,
-  249,124,0,0,0,0,0,48,244,127,2,0,0,0,0,16,212,255,253,42,0,248,255,188,0,0,0,0,0,0,56,255,
-  255,128,0,0,0,0,0,0,116,255,255,56,0,244,255,196,0,0,0,0,0,0,0,152,255,255,50,0,0,0,0,170,
-  255,255,101,0,0,0,0,3,162,255,255,196,0,244,255,192,0,0,0,0,0,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,56,255,255,124,0,244,255,192,0,0,0,0,0,0,56,255,255,124,0,0,13,216,
-  255,255,181,83,54,78,170,255,255,229,19,0,0,4,255,255,176,0,0,0,0,0,0,60,255,255,120,0,0,0,0,240,
-  255,196,0,0,0,0,159,255,255,148,0,0,0,0,42,48,48,252,255,197,48,48,33,0,0,0,0,0,0,0,0,0,
-  0,0,220,255,216,0,0,0,159,255,253,23,0,0,0,0,0,156,255,252,23,0,90,255,255,102,0,0,0,0,0,0,
-  0,244,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,38,119,233,
-  255,255,107,0,0,0,0,133,255,255,203,102,59,60,113,224,255,255,144,0,0,248,255,188,0,0,0,0,0,0,56,255,
-  255,128,0,0,0,0,0,0,116,255,255,56,0,244,255,204,0,0,0,0,0,0,12,235,255,238,5,0,0,0,0,30,
-  241,255,254,158,72,56,93,198,255,255,255,196,0,244,255,192,0,0,0,0,0,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,56,255,255,124,0,244,255,192,0,0,0,0,0,0,56,255,255,124,0,0,0,24,
-  201,255,255,255,255,255,255,255,208,30,0,0,0,4,255,255,176,0,0,0,0,0,0,60,255,255,120,0,0,0,0,240,
-  255,196,0,0,0,0,10,213,255,255,82,0,0,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,223,255,213,0,0,0,67,255,255,106,0,0,0,0,3,235,255,186,0,0,27,253,255,198,0,0,0,0,0,0,
-  4,246,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,7,12,12,1,0,0,0,0,0,35,
-  245,255,215,0,0,0,0,1,137,251,255,255,255,255,255,255,255,153,4,0,0,248,255,188,0,0,0,0,0,0,56,255,
-  255,128,0,0,0,0,0,0,116,255,255,56,0,244,255,255,100,0,0,0,0,0,157,255,255,143,0,0,0,0,0,0,
-  61,241,255,255,255,255,255,255,180,220,255,196,0,244,255,192,0,0,0,0,0,0,112,255,192,0,184,255,252,0,0,0,
-  0,244,255,196,0,0,0,0,0,0,56,255,255,124,0,244,255,192,0,0,0,0,0,0,56,255,255,124,0,0,0,0,
-  2,92,182,232,249,226,186,90,5,0,0,0,0,4,255,255,176,0,0,0,0,0,0,60,255,255,120,0,0,0,0,240,
-  255,196,0,0,0,0,0,42,245,255,239,31,0,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,11,248,255,195,0,0,0,2,229,255,192,0,0,0,0,66,255,255,95,0,0,0,178,255,255,113,0,0,0,0,1,
-  148,255,255,192,0,0,0,0,0,0,0,0,0,156,255,255,24,0,0,0,0,0,135,255,255,51,0,0,0,0,0,0,
-  199,255,243,0,0,0,0,0,0,40,137,209,240,248,223,164,61,0,0,0,0,248,255,188,0,0,0,0,0,0,56,255,
-  255,128,0,0,0,0,0,0,116,255,255,56,0,244,255,255,255,166,78,54,85,190,255,255,234,19,0,0,0,0,0,0,
-  0,28,149,223,249,237,189,93,2,194,255,196,0,244,255,192,0,0,0,0,0,0,112,255,192,0,184,255,252,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,4,255,255,176,0,0,0,0,0,0,60,255,255,120,0,0,0,0,240,
-  255,196,0,0,0,0,0,0,96,255,255,199,5,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,83,
-  85,181,255,255,139,0,0,0,0,140,255,253,24,0,0,0,149,255,246,13,0,0,0,37,246,255,255,166,75,55,90,193,
-  255,255,255,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,255,255,164,0,0,0,0,0,24,
-  241,255,210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,213,202,255,255,255,255,255,255,238,53,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,192,0,0,0,0,0,0,112,255,192,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,35,27,0,20,41,0,0,0,0,0,0,0,0,0,0,0,2,108,212,248,227,148,22,
-  0,0,0,0,0,0,130,168,79,0,0,0,0,4,255,255,176,0,0,0,0,0,0,60,255,255,120,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,244,
-  255,255,255,240,30,0,0,0,0,48,255,255,107,0,0,1,230,255,169,0,0,0,0,0,72,245,255,255,255,255,255,255,
-  184,247,255,192,0,125,255,255,114,0,0,0,0,0,0,56,255,255,166,0,0,0,0,186,255,255,199,96,59,65,114,224,
-  255,255,103,0,59,255,255,117,0,0,0,0,0,11,247,255,120,0,0,0,0,0,8,248,255,179,0,152,255,255,255,255,
-  255,255,255,255,255,255,255,108,0,0,0,0,0,244,255,196,6,106,195,239,249,221,146,24,0,0,0,0,10,221,255,253,
-  51,0,0,0,0,0,106,255,255,183,0,0,0,244,255,192,0,0,0,0,0,0,112,255,192,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,38,181,255,136,0,115,255,191,47,0,0,0,0,0,0,0,0,0,162,255,255,255,255,255,236,
-  59,0,0,0,0,0,227,255,100,0,0,0,0,4,255,255,176,0,0,0,0,0,0,60,255,255,120,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,207,
-  250,238,177,44,0,0,0,0,0,0,212,255,192,0,0,60,255,255,79,0,0,0,0,0,0,32,152,224,249,239,191,95,
-  2,244,255,192,0,33,254,255,200,0,0,0,0,0,0,137,255,255,76,0,0,0,0,13,183,255,255,255,255,255,255,255,
-  254,138,0,0,3,238,255,183,0,0,0,0,0,82,255,255,200,0,0,0,0,0,65,255,255,105,0,152,255,255,255,255,
-  255,255,255,255,255,255,255,106,0,0,0,0,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,66,254,255,
-  202,2,0,0,0,23,239,255,242,29,0,0,0,0,0,0,0,0,0,0,0,0,112,255,192,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,63,244,255,232,95,0,80,224,255,248,77,0,0,0,0,0,0,0,90,255,255,150,62,96,230,255,
-  246,75,0,0,0,70,255,255,38,0,0,0,0,4,255,255,176,0,0,0,0,0,0,60,255,255,120,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,120,255,253,24,0,143,255,238,6,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,244,255,192,0,0,195,255,255,30,0,0,0,0,0,217,255,236,5,0,0,0,0,0,0,76,167,223,247,247,218,157,
-  53,0,0,0,0,168,255,244,5,0,0,0,0,161,255,255,254,25,0,0,0,0,130,255,255,31,0,28,48,48,48,48,
-  48,48,48,107,255,255,226,18,0,0,0,0,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,153,255,
-  255,103,0,0,0,164,255,255,104,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,192,0,0,0,0,0,0,0,
-  0,0,0,0,0,20,235,255,225,26,0,0,0,16,213,255,244,31,0,0,0,0,0,0,197,255,183,0,0,0,26,210,
-  255,252,136,53,97,236,255,179,0,0,0,0,0,4,255,255,176,0,0,0,0,0,0,60,255,255,120,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,30,254,255,107,0,225,255,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,244,255,192,0,0,101,255,255,116,0,0,0,0,42,255,255,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,94,255,255,61,0,0,0,3,236,255,254,255,104,0,0,0,0,195,255,213,0,0,0,0,0,0,0,
-  0,0,18,226,255,252,60,0,0,0,0,0,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,226,
-  255,237,20,0,65,255,255,190,1,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,192,0,0,0,0,0,0,0,
-  0,0,0,0,0,124,255,255,84,0,0,0,0,0,61,255,255,145,0,0,0,0,0,3,251,255,102,0,0,0,0,15,
-  186,255,255,255,255,255,223,26,0,0,0,0,0,1,253,255,184,0,0,0,0,0,0,60,255,255,120,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,252,255,184,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,193,255,192,53,255,255,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,244,255,192,0,0,16,247,255,202,0,0,0,0,122,255,255,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,22,254,255,128,0,0,0,63,255,242,168,255,184,0,0,0,10,249,255,140,0,0,0,0,0,0,0,
-  0,0,176,255,255,122,0,0,0,0,0,0,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,
-  255,255,157,5,214,255,245,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,192,0,0,0,0,0,0,0,
-  0,0,0,0,0,197,255,243,5,0,0,0,0,0,0,225,255,218,0,0,0,0,0,8,140,140,43,0,0,0,0,0,
-  2,105,207,248,233,155,23,0,0,0,0,0,0,0,236,255,216,0,0,0,0,0,0,80,255,255,120,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,251,255,184,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,101,255,253,161,255,226,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,244,255,192,0,0,0,170,255,255,32,0,0,0,203,255,225,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,203,255,194,0,0,0,141,255,170,80,255,249,14,0,0,69,255,255,66,0,0,0,0,0,0,0,
-  0,109,255,255,187,2,0,0,0,0,0,0,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  161,255,254,169,255,255,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,192,0,0,0,0,0,0,0,
-  0,0,0,0,0,231,255,214,0,0,0,0,0,0,0,191,255,253,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,186,255,255,56,0,0,0,0,25,218,255,255,120,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,230,255,210,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,16,248,255,255,255,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,244,255,192,0,0,0,77,255,255,118,0,0,28,254,255,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,129,255,250,11,0,0,220,255,91,9,245,255,89,0,0,134,255,242,5,0,0,0,0,0,0,0,
-  49,248,255,232,23,0,0,0,0,0,0,0,0,244,255,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  17,231,255,255,255,197,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,192,0,0,0,0,0,0,0,
-  0,0,0,0,0,243,255,193,0,0,0,0,0,0,0,169,255,255,11,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,255,255,235,105,58,70,127,232,255,255,255,120,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,255,255,141,82,77,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,174,255,255,255,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,244,255,192,0,0,0,5,234,255,204,0,0,108,255,255,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,55,255,255,72,0,43,255,251,17,0,173,255,169,0,0,199,255,174,0,0,0,0,0,0,0,12,
-  218,255,253,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,82,255,255,249,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,192,0,0,0,0,0,0,0,
-  0,0,0,0,0,244,255,192,0,0,0,0,0,0,0,168,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,171,255,255,255,255,255,255,255,180,255,255,120,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,255,192,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,82,255,255,211,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,146,255,255,34,0,188,255,213,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,2,235,255,139,0,122,255,189,0,0,91,255,242,7,12,251,255,101,0,0,0,0,0,0,0,164,
-  255,255,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,113,255,255,254,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,192,0,0,0,0,0,0,0,
-  0,0,0,0,0,244,255,192,0,0,0,0,0,0,0,168,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,104,200,243,249,228,172,70,36,255,255,120,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,215,250,239,150,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,7,239,255,121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,53,255,255,119,17,251,255,123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,164,255,205,0,200,255,110,0,0,15,250,255,74,73,255,255,27,0,0,0,0,0,0,97,255,
-  255,196,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  36,246,255,255,255,221,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,255,192,0,0,0,0,0,0,0,
-  0,0,0,0,1,250,255,185,0,0,0,0,0,0,0,161,255,255,18,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,215,255,205,93,255,255,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,90,255,253,43,254,255,31,0,0,0,184,255,154,138,255,209,0,0,0,0,0,0,40,244,255,
-  237,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-  193,255,248,112,255,255,145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,28,255,255,160,0,0,0,0,0,0,0,136,255,255,50,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,122,255,255,205,255,198,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,19,253,255,185,255,207,0,0,0,0,103,255,231,205,255,135,0,0,0,0,0,8,209,255,255,
-  78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,109,
-  255,255,127,0,175,255,253,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,129,255,255,91,0,0,0,0,0,0,0,65,255,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,30,254,255,255,255,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,198,255,255,255,128,0,0,0,0,23,253,255,255,255,62,0,0,0,0,0,151,255,255,144,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,244,
-  255,219,7,0,30,244,255,218,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,3,70,144,253,255,208,7,0,0,0,0,0,0,0,1,181,255,255,157,74,8,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,191,255,255,251,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,125,255,255,255,49,0,0,0,0,0,196,255,255,239,4,0,0,0,0,84,255,255,227,54,
-  48,48,48,48,48,48,48,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,190,255,
-  255,70,0,0,0,117,255,255,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,16,255,255,255,195,27,0,0,0,0,0,0,0,0,0,12,153,255,255,255,44,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,98,255,255,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,51,255,255,225,0,0,0,0,0,0,114,255,255,170,0,0,0,0,0,183,255,255,255,255,
-  255,255,255,255,255,255,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,255,255,
-  170,0,0,0,0,4,211,255,253,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,16,255,255,255,224,50,0,0,0,0,0,0,0,0,0,31,196,255,255,255,44,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,28,255,255,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,1,231,255,147,0,0,0,0,0,0,33,255,255,96,0,0,0,0,0,184,255,255,255,255,
-  255,255,255,255,255,255,255,220,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,243,255,242,
-  27,0,0,0,0,0,60,254,255,214,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,24,99,241,255,227,15,0,0,0,0,0,0,0,7,212,255,248,113,28,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,102,255,246,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,107,255,255,104,0,0,0,0,0,0,0,91,255,255,131,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,207,255,169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,26,255,255,164,0,0,0,0,0,0,0,153,255,255,48,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,95,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,1,251,255,187,0,0,0,0,0,0,0,176,255,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,73,102,159,250,255,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,248,255,192,0,0,0,0,0,0,0,180,255,255,16,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,196,255,255,255,228,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,248,255,192,0,0,0,0,0,0,0,180,255,255,16,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,164,247,226,156,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,245,255,194,0,0,0,0,0,0,0,181,255,255,13,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,229,255,216,0,0,0,0,0,0,0,202,255,252,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,185,255,246,10,0,0,0,0,0,3,236,255,209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,102,255,255,100,0,0,0,0,0,82,255,255,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,6,213,255,241,50,0,0,0,39,233,255,228,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,32,218,255,251,126,0,109,248,255,228,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,12,133,237,120,0,101,242,143,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,5,11,0,8,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 
- 30.000000f, 35.160000f, 0.010000f, 27.830000f, -7.320000f, 96, 
- {
-  {4294967295, 0, 0, 0, 0, 0.000000f, 0.000000f, 0.011719f, 0.011719f, 0.015625f, 0.015625f, 0, 0 },
-  {32, 1, 1, 0, 0, 7.421875f, 0.000000f, 0.023438f, 0.003906f, 0.027344f, 0.007812f, 0, 0 },
-  {33, 5, 22, 2, 21, 7.718750f, 0.000000f, 0.027344f, 0.003906f, 0.046875f, 0.089844f, 0, 0 },
-  {34, 8, 8, 1, 22, 9.593750f, 0.000000f, 0.046875f, 0.003906f, 0.078125f, 0.035156f, 0, 0 },
-  {35, 19, 22, 1, 21, 18.468750f, 0.000000f, 0.078125f, 0.003906f, 0.152344f, 0.089844f, 0, 0 },
-  {36, 16, 28, 1, 24, 16.843750f, 0.000000f, 0.152344f, 0.003906f, 0.214844f, 0.113281f, 0, 0 },
-  {37, 21, 22, 1, 21, 21.968750f, 0.000000f, 0.214844f, 0.003906f, 0.296875f, 0.089844f, 0, 0 },
-  {38, 19, 22, 1, 21, 18.640625f, 0.000000f, 0.296875f, 0.003906f, 0.371094f, 0.089844f, 0, 0 },
-  {39, 4, 8, 1, 22, 5.234375f, 0.000000f, 0.371094f, 0.003906f, 0.386719f, 0.035156f, 0, 0 },
-  {40, 10, 32, 1, 24, 10.250000f, 0.000000f, 0.386719f, 0.003906f, 0.425781f, 0.128906f, 0, 0 },
-  {41, 10, 32, 0, 24, 10.437500f, 0.000000f, 0.425781f, 0.003906f, 0.464844f, 0.128906f, 0, 0 },
-  {42, 14, 14, 0, 21, 12.921875f, 0.000000f, 0.464844f, 0.003906f, 0.519531f, 0.058594f, 0, 0 },
-  {43, 16, 16, 1, 17, 17.000000f, 0.000000f, 0.519531f, 0.003906f, 0.582031f, 0.066406f, 0, 0 },
-  {44, 6, 9, 0, 3, 5.890625f, 0.000000f, 0.582031f, 0.003906f, 0.605469f, 0.039062f, 0, 0 },
-  {45, 9, 4, 0, 11, 8.281250f, 0.000000f, 0.605469f, 0.003906f, 0.640625f, 0.019531f, 0, 0 },
-  {46, 5, 4, 2, 3, 7.890625f, 0.000000f, 0.640625f, 0.003906f, 0.660156f, 0.019531f, 0, 0 },
-  {47, 13, 24, 0, 21, 12.359375f, 0.000000f, 0.660156f, 0.003906f, 0.710938f, 0.097656f, 0, 0 },
-  {48, 16, 22, 1, 21, 16.843750f, 0.000000f, 0.710938f, 0.003906f, 0.773438f, 0.089844f, 0, 0 },
-  {49, 10, 22, 2, 21, 16.843750f, 0.000000f, 0.773438f, 0.003906f, 0.812500f, 0.089844f, 0, 0 },
-  {50, 16, 22, 1, 21, 16.843750f, 0.000000f, 0.812500f, 0.003906f, 0.875000f, 0.089844f, 0, 0 },
-  {51, 15, 22, 1, 21, 16.843750f, 0.000000f, 0.875000f, 0.003906f, 0.933594f, 0.089844f, 0, 0 },
-  {52, 18, 22, 0, 21, 16.843750f, 0.000000f, 0.582031f, 0.039062f, 0.652344f, 0.125000f, 0, 0 },
-  {53, 15, 22, 2, 21, 16.843750f, 0.000000f, 0.933594f, 0.003906f, 0.992188f, 0.089844f, 0, 0 },
-  {54, 16, 22, 1, 21, 16.843750f, 0.000000f, 0.464844f, 0.066406f, 0.527344f, 0.152344f, 0, 0 },
-  {55, 16, 22, 1, 21, 16.843750f, 0.000000f, 0.023438f, 0.089844f, 0.085938f, 0.175781f, 0, 0 },
-  {56, 16, 22, 1, 21, 16.843750f, 0.000000f, 0.085938f, 0.089844f, 0.148438f, 0.175781f, 0, 0 },
-  {57, 15, 22, 1, 21, 16.843750f, 0.000000f, 0.214844f, 0.089844f, 0.273438f, 0.175781f, 0, 0 },
-  {58, 6, 17, 1, 16, 7.265625f, 0.000000f, 0.527344f, 0.066406f, 0.550781f, 0.132812f, 0, 0 },
-  {59, 6, 21, 0, 16, 6.343750f, 0.000000f, 0.550781f, 0.066406f, 0.574219f, 0.148438f, 0, 0 },
-  {60, 14, 15, 1, 16, 15.250000f, 0.000000f, 0.273438f, 0.089844f, 0.328125f, 0.148438f, 0, 0 },
-  {61, 14, 10, 2, 15, 16.468750f, 0.000000f, 0.328125f, 0.089844f, 0.382812f, 0.128906f, 0, 0 },
-  {62, 15, 15, 1, 16, 15.671875f, 0.000000f, 0.710938f, 0.089844f, 0.769531f, 0.148438f, 0, 0 },
-  {63, 13, 22, 1, 21, 14.171875f, 0.000000f, 0.769531f, 0.089844f, 0.820312f, 0.175781f, 0, 0 },
-  {64, 26, 28, 1, 21, 26.937500f, 0.000000f, 0.820312f, 0.089844f, 0.921875f, 0.199219f, 0, 0 },
-  {65, 21, 22, 0, 21, 19.578125f, 0.000000f, 0.574219f, 0.125000f, 0.656250f, 0.210938f, 0, 0 },
-  {66, 16, 22, 2, 21, 18.671875f, 0.000000f, 0.921875f, 0.089844f, 0.984375f, 0.175781f, 0, 0 },
-  {67, 19, 22, 1, 21, 19.531250f, 0.000000f, 0.382812f, 0.128906f, 0.457031f, 0.214844f, 0, 0 },
-  {68, 17, 22, 2, 21, 19.671875f, 0.000000f, 0.148438f, 0.113281f, 0.214844f, 0.199219f, 0, 0 },
-  {69, 16, 22, 2, 21, 17.046875f, 0.000000f, 0.656250f, 0.148438f, 0.718750f, 0.234375f, 0, 0 },
-  {70, 15, 22, 2, 21, 16.578125f, 0.000000f, 0.273438f, 0.148438f, 0.332031f, 0.234375f, 0, 0 },
-  {71, 19, 22, 1, 21, 20.437500f, 0.000000f, 0.457031f, 0.152344f, 0.531250f, 0.238281f, 0, 0 },
-  {72, 18, 22, 2, 21, 21.390625f, 0.000000f, 0.003906f, 0.175781f, 0.074219f, 0.261719f, 0, 0 },
-  {73, 5, 22, 2, 21, 8.156250f, 0.000000f, 0.332031f, 0.128906f, 0.351562f, 0.214844f, 0, 0 },
-  {74, 16, 22, 0, 21, 16.546875f, 0.000000f, 0.718750f, 0.175781f, 0.781250f, 0.261719f, 0, 0 },
-  {75, 18, 22, 2, 21, 18.812500f, 0.000000f, 0.921875f, 0.175781f, 0.992188f, 0.261719f, 0, 0 },
-  {76, 15, 22, 2, 21, 16.140625f, 0.000000f, 0.214844f, 0.175781f, 0.273438f, 0.261719f, 0, 0 },
-  {77, 23, 22, 2, 21, 26.187500f, 0.000000f, 0.781250f, 0.199219f, 0.871094f, 0.285156f, 0, 0 },
-  {78, 18, 22, 2, 21, 21.390625f, 0.000000f, 0.074219f, 0.175781f, 0.144531f, 0.261719f, 0, 0 },
-  {79, 19, 22, 1, 21, 20.625000f, 0.000000f, 0.531250f, 0.210938f, 0.605469f, 0.296875f, 0, 0 },
-  {80, 17, 22, 2, 21, 18.921875f, 0.000000f, 0.144531f, 0.199219f, 0.210938f, 0.285156f, 0, 0 },
-  {81, 19, 26, 1, 21, 20.625000f, 0.000000f, 0.332031f, 0.214844f, 0.406250f, 0.316406f, 0, 0 },
-  {82, 17, 22, 2, 21, 18.468750f, 0.000000f, 0.605469f, 0.234375f, 0.671875f, 0.320312f, 0, 0 },
-  {83, 17, 22, 1, 21, 17.796875f, 0.000000f, 0.406250f, 0.238281f, 0.472656f, 0.324219f, 0, 0 },
-  {84, 19, 22, 0, 21, 17.906250f, 0.000000f, 0.210938f, 0.261719f, 0.285156f, 0.347656f, 0, 0 },
-  {85, 17, 22, 2, 21, 19.453125f, 0.000000f, 0.671875f, 0.261719f, 0.738281f, 0.347656f, 0, 0 },
-  {86, 20, 22, 0, 21, 19.093750f, 0.000000f, 0.871094f, 0.261719f, 0.949219f, 0.347656f, 0, 0 },
-  {87, 27, 22, 0, 21, 26.609375f, 0.000000f, 0.003906f, 0.261719f, 0.109375f, 0.347656f, 0, 0 },
-  {88, 20, 22, 0, 21, 18.812500f, 0.000000f, 0.109375f, 0.285156f, 0.187500f, 0.371094f, 0, 0 },
-  {89, 19, 22, 0, 21, 18.015625f, 0.000000f, 0.738281f, 0.285156f, 0.812500f, 0.371094f, 0, 0 },
-  {90, 17, 22, 1, 21, 17.953125f, 0.000000f, 0.472656f, 0.296875f, 0.539062f, 0.382812f, 0, 0 },
-  {91, 7, 30, 2, 24, 7.953125f, 0.000000f, 0.285156f, 0.234375f, 0.312500f, 0.351562f, 0, 0 },
-  {92, 14, 24, 0, 21, 12.312500f, 0.000000f, 0.812500f, 0.285156f, 0.867188f, 0.378906f, 0, 0 },
-  {93, 7, 30, 0, 24, 7.953125f, 0.000000f, 0.949219f, 0.261719f, 0.976562f, 0.378906f, 0, 0 },
-  {94, 13, 12, 0, 22, 12.546875f, 0.000000f, 0.539062f, 0.296875f, 0.589844f, 0.343750f, 0, 0 },
-  {95, 15, 4, 0, 1, 13.531250f, 0.000000f, 0.312500f, 0.316406f, 0.371094f, 0.332031f, 0, 0 },
-  {96, 8, 6, 0, 23, 9.265625f, 0.000000f, 0.371094f, 0.316406f, 0.402344f, 0.339844f, 0, 0 },
-  {97, 15, 17, 1, 16, 16.312500f, 0.000000f, 0.589844f, 0.320312f, 0.648438f, 0.386719f, 0, 0 },
-  {98, 15, 23, 2, 22, 16.828125f, 0.000000f, 0.402344f, 0.324219f, 0.460938f, 0.414062f, 0, 0 },
-  {99, 15, 17, 1, 16, 15.703125f, 0.000000f, 0.312500f, 0.332031f, 0.371094f, 0.398438f, 0, 0 },
-  {100, 15, 23, 1, 22, 16.921875f, 0.000000f, 0.867188f, 0.347656f, 0.925781f, 0.437500f, 0, 0 },
-  {101, 15, 17, 1, 16, 15.890625f, 0.000000f, 0.187500f, 0.347656f, 0.246094f, 0.414062f, 0, 0 },
-  {102, 12, 24, 0, 23, 10.421875f, 0.000000f, 0.539062f, 0.343750f, 0.585938f, 0.437500f, 0, 0 },
-  {103, 15, 23, 1, 16, 16.828125f, 0.000000f, 0.648438f, 0.347656f, 0.707031f, 0.437500f, 0, 0 },
-  {104, 14, 23, 2, 22, 16.531250f, 0.000000f, 0.003906f, 0.347656f, 0.058594f, 0.437500f, 0, 0 },
-  {105, 5, 22, 2, 21, 7.281250f, 0.000000f, 0.976562f, 0.261719f, 0.996094f, 0.347656f, 0, 0 },
-  {106, 8, 28, -1, 21, 7.156250f, 0.000000f, 0.371094f, 0.339844f, 0.402344f, 0.449219f, 0, 0 },
-  {107, 15, 23, 2, 22, 15.203125f, 0.000000f, 0.246094f, 0.351562f, 0.304688f, 0.441406f, 0, 0 },
-  {108, 4, 23, 2, 22, 7.281250f, 0.000000f, 0.976562f, 0.347656f, 0.992188f, 0.437500f, 0, 0 },
-  {109, 24, 17, 2, 16, 26.296875f, 0.000000f, 0.707031f, 0.371094f, 0.800781f, 0.437500f, 0, 0 },
-  {110, 14, 17, 2, 16, 16.546875f, 0.000000f, 0.058594f, 0.371094f, 0.113281f, 0.437500f, 0, 0 },
-  {111, 16, 17, 1, 16, 17.109375f, 0.000000f, 0.113281f, 0.371094f, 0.175781f, 0.437500f, 0, 0 },
-  {112, 15, 23, 2, 16, 16.828125f, 0.000000f, 0.800781f, 0.378906f, 0.859375f, 0.468750f, 0, 0 },
-  {113, 15, 23, 1, 16, 17.046875f, 0.000000f, 0.460938f, 0.382812f, 0.519531f, 0.472656f, 0, 0 },
-  {114, 9, 17, 2, 16, 10.156250f, 0.000000f, 0.925781f, 0.378906f, 0.960938f, 0.445312f, 0, 0 },
-  {115, 14, 17, 1, 16, 15.468750f, 0.000000f, 0.585938f, 0.386719f, 0.640625f, 0.453125f, 0, 0 },
-  {116, 10, 21, 0, 20, 9.796875f, 0.000000f, 0.304688f, 0.398438f, 0.343750f, 0.480469f, 0, 0 },
-  {117, 15, 17, 1, 16, 16.531250f, 0.000000f, 0.175781f, 0.414062f, 0.234375f, 0.480469f, 0, 0 },
-  {118, 15, 17, 0, 16, 14.531250f, 0.000000f, 0.402344f, 0.414062f, 0.460938f, 0.480469f, 0, 0 },
-  {119, 23, 17, 0, 16, 22.546875f, 0.000000f, 0.640625f, 0.437500f, 0.730469f, 0.503906f, 0, 0 },
-  {120, 16, 17, 0, 16, 14.875000f, 0.000000f, 0.859375f, 0.437500f, 0.921875f, 0.503906f, 0, 0 },
-  {121, 15, 23, 0, 16, 14.187500f, 0.000000f, 0.519531f, 0.437500f, 0.578125f, 0.527344f, 0, 0 },
-  {122, 14, 17, 1, 16, 14.875000f, 0.000000f, 0.730469f, 0.437500f, 0.785156f, 0.503906f, 0, 0 },
-  {123, 11, 31, 0, 24, 10.156250f, 0.000000f, 0.003906f, 0.437500f, 0.046875f, 0.558594f, 0, 0 },
-  {124, 4, 26, 2, 21, 7.312500f, 0.000000f, 0.960938f, 0.378906f, 0.976562f, 0.480469f, 0, 0 },
-  {125, 11, 31, 0, 24, 10.156250f, 0.000000f, 0.046875f, 0.437500f, 0.089844f, 0.558594f, 0, 0 },
-  {126, 19, 7, 1, 12, 20.406250f, 0.000000f, 0.089844f, 0.437500f, 0.164062f, 0.464844f, 0, 0 },
- }
-};
-#ifdef __cplusplus
-}
-#endif
@@ -1,2194 +0,0 @@
-/* ============================================================================
- * Freetype GL - A C OpenGL Freetype engine
- * Platform:    Any
- * WWW:         https://github.com/rougier/freetype-gl
- * ----------------------------------------------------------------------------
- * Copyright 2011,2012 Nicolas P. Rougier. All rights reserved.
- *
- * Redistribution and use in source and binary forms, with or without
- * modification, are permitted provided that the following conditions are met:
- *
- *  1. Redistributions of source code must retain the above copyright notice,
- *     this list of conditions and the following disclaimer.
- *
- *  2. Redistributions in binary form must reproduce the above copyright
- *     notice, this list of conditions and the following disclaimer in the
- *     documentation and/or other materials provided with the distribution.
- *
- * THIS SOFTWARE IS PROVIDED BY NICOLAS P. ROUGIER ''AS IS'' AND ANY EXPRESS OR
- * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
- * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
- * EVENT SHALL NICOLAS P. ROUGIER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
- * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
- * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
- * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
- * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
- * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
- * THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
- *
- * The views and conclusions contained in the software and documentation are
- * those of the authors and should not be interpreted as representing official
- * policies, either expressed or implied, of Nicolas P. Rougier.
- * ============================================================================
- */
-#include <stddef.h>
-#include <stdint.h>
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include "../EJFont.h"
-
-texture_font_t font_roboto_medium_40 = {
- 256, 256, 1, 
- {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,255,255,255,255,0,0,160,255,255,232,0,0,88,255,255,104,0,16,255,255,176,0,0,0,0,0,0,0,0,0,29,
-  255,255,171,0,0,0,0,45,255,255,163,0,0,0,0,0,0,0,0,0,0,0,0,196,255,255,36,0,0,0,0,0,
-  0,0,0,0,0,31,146,218,247,243,204,121,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,24,131,202,238,250,233,182,92,4,0,0,0,0,0,0,0,0,0,0,252,255,188,0,0,0,0,0,0,
-  0,0,0,0,87,55,0,0,104,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,144,255,
-  255,255,4,0,1,4,4,4,4,4,4,4,4,4,1,0,0,113,234,237,133,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,7,237,255,254,33,0,0,0,0,0,2,81,161,216,239,248,228,195,123,32,0,0,0,0,0,0,0,0,0,0,
-  0,255,255,255,255,0,0,160,255,255,232,0,0,88,255,255,104,0,16,255,255,176,0,0,0,0,0,0,0,0,0,80,
-  255,255,121,0,0,0,0,95,255,255,113,0,0,0,0,0,0,0,0,0,0,0,0,196,255,255,36,0,0,0,0,0,
-  0,0,0,0,74,242,255,255,255,255,255,255,218,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,90,245,255,255,255,255,255,255,255,201,29,0,0,0,0,0,0,0,0,0,252,255,188,0,0,0,0,0,0,
-  0,0,3,151,255,145,0,3,234,245,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,144,255,
-  255,255,4,0,72,255,255,255,255,255,255,255,255,255,64,0,23,253,255,255,255,51,0,0,0,0,0,0,0,0,0,0,
-  0,0,85,255,255,191,0,0,0,0,0,42,202,255,255,255,255,255,255,255,255,247,125,1,0,0,0,0,0,0,0,0,
-  0,255,255,255,255,0,0,160,255,255,232,0,0,88,255,255,103,0,16,255,255,175,0,0,0,0,0,0,0,0,0,130,
-  255,255,71,0,0,0,0,144,255,255,63,0,0,0,0,0,0,0,0,0,0,0,0,196,255,255,36,0,0,0,0,0,
-  0,0,0,37,245,255,255,255,255,255,255,255,255,210,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,80,254,255,255,255,255,255,255,255,255,255,216,15,0,0,0,0,0,0,0,0,252,255,188,0,0,0,0,0,0,
-  0,2,167,255,255,201,0,28,244,255,252,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,144,255,
-  255,255,3,0,72,255,255,255,255,255,255,255,255,255,64,0,25,254,255,255,255,55,0,0,0,0,0,0,0,0,0,0,
-  0,0,182,255,255,94,0,0,0,0,39,234,255,255,255,255,255,255,255,255,255,255,255,147,0,0,0,0,0,0,0,0,
-  0,255,255,255,255,0,0,160,255,255,232,0,0,88,255,255,88,0,16,255,255,160,0,0,0,0,0,0,0,0,0,180,
-  255,255,22,0,0,0,0,194,255,254,15,0,0,0,0,0,0,0,0,0,0,0,0,196,255,255,36,0,0,0,0,0,
-  0,0,0,156,255,255,220,78,19,30,112,245,255,255,85,0,0,0,0,0,0,30,1,0,0,0,0,0,0,0,0,0,
-  0,8,230,255,255,255,147,35,14,55,181,255,255,255,140,0,0,0,0,0,0,0,0,252,255,188,0,0,0,0,0,0,
-  0,142,255,255,219,32,0,0,61,248,255,248,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,148,255,
-  255,240,0,0,72,255,255,255,255,255,255,255,255,255,64,0,0,119,236,239,139,0,0,0,0,0,0,0,0,0,0,0,
-  0,25,252,255,243,11,0,0,0,2,208,255,255,255,188,72,22,13,47,136,250,255,255,255,80,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,88,255,255,68,0,16,255,255,140,0,0,0,0,0,0,0,0,0,230,
-  255,228,0,0,0,0,1,241,255,220,0,0,0,0,0,0,0,0,0,0,0,8,55,216,255,255,86,10,0,0,0,0,
-  0,0,0,221,255,251,41,0,0,0,0,106,255,255,150,0,0,0,0,0,16,230,210,60,0,0,0,0,0,0,0,0,
-  0,84,255,255,255,162,0,0,0,0,1,186,255,255,233,2,0,0,0,0,0,0,0,252,255,188,0,0,0,0,0,0,
-  83,255,255,237,34,0,0,0,0,94,255,255,227,19,0,0,0,0,0,0,0,40,7,0,0,0,0,192,255,255,16,0,
-  0,0,0,17,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,171,255,
-  255,209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,119,255,255,158,0,0,0,0,94,255,255,255,156,1,0,0,0,0,0,66,251,255,255,220,2,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,88,255,255,47,0,16,255,255,119,0,0,0,0,0,0,0,0,23,255,
-  255,179,0,0,0,0,37,255,255,171,0,0,0,0,0,0,0,0,0,27,154,242,255,255,255,255,255,248,161,33,0,0,
-  0,0,0,242,255,212,0,0,0,0,0,23,255,255,172,0,0,0,0,0,155,255,250,43,0,0,0,0,0,0,0,0,
-  0,144,255,255,255,38,0,0,0,0,0,81,255,255,255,24,0,0,0,0,0,0,0,252,255,188,0,0,0,0,0,22,
-  238,255,255,73,0,0,0,0,0,0,172,255,255,168,0,0,0,0,0,0,0,206,237,145,46,0,0,192,255,255,16,0,
-  8,89,187,241,7,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,226,255,
-  255,143,0,0,0,0,0,0,0,0,0,0,44,141,233,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,215,255,255,61,0,0,0,0,192,255,255,231,8,0,0,0,0,0,0,0,143,255,255,255,61,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,88,255,255,27,0,16,255,255,99,0,0,0,0,0,0,0,0,74,255,
-  255,129,0,0,0,0,86,255,255,121,0,0,0,0,0,0,0,0,72,242,255,255,255,255,255,255,255,255,255,242,77,0,
-  0,0,0,242,255,192,0,0,0,0,0,4,255,255,175,0,0,0,0,64,254,255,130,0,0,0,0,0,0,0,0,0,
-  0,170,255,255,246,1,0,0,0,0,0,58,255,255,255,26,0,0,0,0,0,0,0,252,255,188,0,0,0,0,0,165,
-  255,255,168,0,0,0,0,0,0,0,29,245,255,255,73,0,0,0,0,0,28,255,255,255,255,204,105,203,255,255,66,149,
-  239,255,255,255,71,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,56,255,255,
-  255,50,0,0,0,0,0,0,0,16,105,203,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  56,255,255,220,0,0,0,0,20,252,255,255,133,0,0,0,0,0,0,0,0,34,255,255,255,143,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,88,255,255,6,0,16,255,255,78,0,0,0,0,0,0,0,0,124,255,
-  255,80,0,0,0,0,136,255,255,72,0,0,0,0,0,0,0,54,250,255,255,255,255,255,255,255,255,255,255,255,248,57,
-  0,0,0,225,255,210,0,0,0,0,0,23,255,255,158,0,0,0,9,219,255,216,7,0,0,0,0,0,0,0,0,0,
-  0,167,255,255,249,2,0,0,0,0,0,103,255,255,246,1,0,0,0,0,0,0,0,252,255,188,0,0,0,0,51,255,
-  255,249,28,0,0,0,0,0,0,0,0,146,255,255,212,2,0,0,0,0,67,238,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,131,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,177,255,255,
-  178,0,0,0,0,0,2,70,167,247,255,255,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  152,255,255,124,0,0,0,0,73,255,255,255,63,0,0,0,0,0,0,0,0,0,219,255,255,194,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,88,255,242,0,0,16,255,255,58,0,0,36,196,196,196,196,196,232,255,
-  255,207,196,196,196,196,235,255,255,205,196,196,196,24,0,0,2,214,255,255,255,217,93,27,5,24,98,228,255,255,255,213,
-  4,0,0,168,255,251,41,0,0,0,0,100,255,255,103,0,0,0,137,255,254,62,0,0,0,0,0,0,0,0,0,0,
-  0,130,255,255,255,67,0,0,0,0,12,216,255,255,164,0,0,0,0,0,0,0,0,252,255,188,0,0,0,0,180,255,
-  255,158,0,0,0,0,0,0,0,0,0,34,253,255,255,91,0,0,0,0,0,4,65,143,220,255,255,255,255,255,255,255,
-  253,197,120,43,0,0,1,4,4,4,4,4,4,4,145,255,255,255,23,4,4,4,4,4,4,4,0,0,56,255,255,244,
-  33,0,0,0,33,131,226,255,255,255,255,255,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,
-  240,255,253,30,0,0,0,0,115,255,255,255,19,0,0,0,0,0,0,0,0,0,174,255,255,236,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,88,255,222,0,0,16,255,255,38,0,0,48,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,32,0,0,72,255,255,255,207,13,0,0,0,0,0,26,224,255,255,255,
-  78,0,0,55,254,255,222,78,16,23,103,242,255,231,12,0,0,49,251,255,154,0,0,0,0,0,0,0,0,0,0,0,
-  0,50,255,255,255,185,0,0,0,19,192,255,255,251,47,0,0,0,0,0,0,0,0,252,255,188,0,0,0,38,254,255,
-  255,44,0,0,0,0,0,0,0,0,0,0,172,255,255,203,0,0,0,0,0,0,0,0,0,42,211,255,255,255,233,96,
-  21,0,0,0,0,0,124,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,4,0,0,97,234,66,
-  0,0,0,0,176,255,255,255,255,255,240,206,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,
-  255,255,188,0,0,0,0,0,150,255,255,245,0,0,0,0,0,0,0,0,0,0,141,255,255,255,10,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,0,0,0,0,0,0,0,0,0,0,0,48,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,32,0,0,142,255,255,255,62,0,0,0,0,0,0,0,74,255,255,255,
-  164,0,0,0,107,253,255,255,255,255,255,255,240,57,0,0,4,206,255,231,16,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,191,255,255,255,84,0,60,224,255,255,255,109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,141,255,255,
-  208,0,0,0,0,0,0,0,0,0,0,0,77,255,255,255,52,0,0,0,0,0,0,0,0,75,255,255,255,255,255,75,
-  0,0,0,0,0,0,124,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,4,0,0,0,7,0,
-  0,0,0,0,176,255,255,252,184,88,8,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,186,
-  255,255,91,0,0,0,0,0,164,255,255,233,0,0,0,0,0,0,0,0,0,0,128,255,255,255,22,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,255,255,
-  139,0,0,0,0,77,255,255,131,0,0,0,0,0,0,0,179,255,255,241,1,0,0,0,0,0,0,0,1,224,255,255,
-  217,0,0,0,0,60,184,249,255,255,242,162,32,0,0,0,119,255,255,85,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,42,248,255,255,238,141,252,255,255,253,110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,227,255,255,
-  120,0,0,0,0,0,0,0,0,0,0,0,9,246,255,255,139,0,0,0,0,0,0,0,23,234,255,255,141,255,255,234,
-  24,0,0,0,0,0,124,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,4,0,0,0,0,0,
-  0,0,0,0,176,214,119,26,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,253,
-  255,241,9,0,0,0,0,0,175,255,255,224,0,0,0,0,0,0,0,0,0,0,118,255,255,255,34,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,255,255,
-  89,0,0,0,0,126,255,255,81,0,0,0,0,0,0,0,191,255,255,220,0,0,0,0,0,0,0,0,0,166,255,255,
-  251,0,0,0,0,0,0,7,32,29,3,0,0,0,0,36,246,255,178,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,109,255,255,255,255,255,255,236,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,255,255,255,
-  51,0,0,0,0,0,0,0,0,0,0,0,0,179,255,255,221,0,0,0,0,0,0,1,183,255,255,164,0,171,255,255,
-  183,1,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,1,152,241,
-  228,94,0,0,26,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,123,255,
-  255,155,0,0,0,0,0,0,183,255,255,224,0,0,0,0,0,0,0,0,0,0,116,255,255,255,40,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,255,255,
-  40,0,0,0,0,175,255,255,32,0,0,0,0,0,0,0,175,255,255,239,1,0,0,0,0,0,0,0,0,141,255,255,
-  255,11,0,0,0,0,0,0,0,0,0,0,0,0,1,191,255,243,29,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,196,255,255,255,255,196,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,255,255,243,
-  4,0,0,0,0,0,0,0,0,0,0,0,0,109,255,255,255,31,0,0,0,0,0,111,255,255,237,21,0,25,240,255,
-  255,111,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,69,255,255,
-  255,249,9,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,255,
-  255,58,0,0,0,0,0,0,184,255,255,224,0,0,0,0,0,0,0,0,0,0,116,255,255,255,40,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,213,255,244,
-  2,0,0,0,0,225,255,238,0,0,0,0,0,0,0,0,130,255,255,255,64,0,0,0,0,0,0,0,0,2,4,4,
-  4,0,0,0,0,0,0,0,0,0,0,0,0,0,101,255,255,109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,10,157,255,255,255,255,255,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,255,255,194,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,63,255,255,255,93,0,0,0,0,44,248,255,255,99,0,0,0,105,255,
-  255,248,45,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,72,255,255,
-  255,251,11,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,60,255,255,
-  217,0,0,0,0,0,0,0,184,255,255,224,0,0,0,0,0,0,0,0,0,0,116,255,255,255,40,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,252,255,197,
-  0,0,0,0,18,255,255,189,0,0,0,0,0,0,0,0,51,255,255,255,214,20,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,25,239,255,200,2,0,28,147,221,248,237,185,81,0,0,0,0,0,0,
-  0,27,205,255,255,255,255,255,255,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,229,255,255,159,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,19,255,255,255,141,0,0,0,0,15,172,255,193,1,0,0,0,1,197,
-  255,204,32,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,2,158,242,
-  230,100,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,156,255,255,
-  121,0,0,0,0,0,0,0,184,255,255,224,0,0,0,0,0,0,0,0,0,0,116,255,255,255,40,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,255,255,148,
-  0,0,0,0,67,255,255,140,0,0,0,0,0,0,0,0,0,182,255,255,255,226,79,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,174,255,250,45,0,63,240,255,255,255,255,255,255,159,2,0,0,0,0,
-  29,221,255,255,255,196,79,243,255,255,252,76,0,0,0,0,56,255,255,255,11,0,0,0,0,0,0,16,255,255,255,125,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,231,255,255,184,0,0,0,0,0,0,106,40,0,0,0,0,0,43,
-  151,7,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,10,242,255,253,
-  27,0,0,0,0,0,0,0,184,255,255,224,0,0,0,0,0,0,0,0,0,0,116,255,255,255,38,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,0,0,0,0,0,0,0,0,0,0,2,4,4,4,4,106,255,255,102,
-  4,4,4,4,118,255,255,94,4,4,4,2,0,0,0,0,0,24,227,255,255,255,255,208,104,18,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,83,255,255,133,0,28,238,255,255,255,255,255,255,255,255,125,0,0,0,4,
-  205,255,255,255,157,5,0,71,251,255,255,244,51,0,0,0,76,255,255,249,0,0,0,0,0,0,0,48,255,255,255,103,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,198,255,255,216,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,93,255,255,185,
-  0,0,0,0,0,0,0,0,178,255,255,227,0,0,0,0,0,0,0,0,0,0,117,255,255,255,28,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,0,0,0,0,0,0,0,0,0,0,172,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,168,0,0,0,0,0,0,29,207,255,255,255,255,255,250,177,76,2,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,16,230,255,218,8,0,149,255,255,229,80,18,33,157,255,255,244,18,0,0,104,
-  255,255,255,173,2,0,0,0,96,255,255,255,231,31,0,0,119,255,255,221,0,0,0,0,0,0,0,73,255,255,255,92,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,185,255,255,241,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,190,255,255,88,
-  0,0,0,0,0,0,0,0,166,255,255,237,0,0,0,0,0,0,0,0,0,0,126,255,255,255,17,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,0,0,0,0,0,0,0,0,0,0,172,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,168,0,0,0,0,0,0,0,5,119,237,255,255,255,255,255,255,213,75,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,156,255,255,65,0,0,231,255,254,49,0,0,0,0,192,255,255,86,0,0,200,
-  255,255,244,22,0,0,0,0,0,125,255,255,255,212,15,0,191,255,255,167,0,0,0,0,0,0,0,91,255,255,255,82,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,171,255,255,255,4,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,32,254,255,239,8,
-  0,0,0,0,0,0,0,0,153,255,255,251,3,0,0,0,0,0,0,0,0,0,139,255,255,253,4,0,0,0,0,0,
-  0,0,0,0,0,0,0,160,255,255,232,0,0,0,0,0,0,0,0,0,0,0,0,172,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,168,0,0,0,0,0,0,0,0,0,11,106,200,255,255,255,255,255,255,144,2,
-  0,0,0,0,0,0,0,0,0,0,65,255,255,157,0,0,15,255,255,197,0,0,0,0,0,84,255,255,127,0,0,249,
-  255,255,178,0,0,0,0,0,0,0,154,255,255,255,189,41,252,255,255,99,0,0,0,0,0,0,0,99,255,255,255,80,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,157,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,127,255,255,152,0,
-  0,0,0,0,0,0,0,0,121,255,255,255,33,0,0,0,0,0,0,0,0,0,171,255,255,220,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,255,255,175,0,
-  0,0,0,41,255,255,167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,135,239,255,255,255,255,157,
-  0,0,0,0,0,0,0,0,0,9,219,255,232,17,0,0,27,255,255,160,0,0,0,0,0,47,255,255,142,0,2,253,
-  255,255,156,0,0,0,0,0,0,0,3,181,255,255,255,237,255,255,241,11,0,0,0,0,0,0,0,101,255,255,255,81,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,255,255,255,17,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,1,222,255,255,55,0,
-  0,0,0,0,0,0,0,0,77,255,255,255,83,0,0,0,0,0,0,0,0,0,214,255,255,179,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,255,255,125,0,
-  0,0,0,91,255,255,117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,145,255,255,255,255,
-  82,0,0,0,0,0,0,0,0,138,255,255,88,0,0,0,27,255,255,152,0,0,0,0,0,40,255,255,143,0,0,233,
-  255,255,193,0,0,0,0,0,0,0,0,11,203,255,255,255,255,255,128,0,0,0,0,0,0,0,0,94,255,255,255,92,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,156,255,255,255,10,0,0,0,0,0,0,15,109,176,223,243,248,230,
-  191,128,29,0,0,0,0,0,0,0,0,0,0,0,27,125,190,230,249,244,226,180,114,19,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,64,255,255,214,0,0,
-  0,0,0,0,0,0,0,0,24,254,255,255,157,0,0,0,0,0,0,0,0,30,255,255,255,121,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,255,255,75,0,
-  0,0,0,141,255,255,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,101,255,255,255,
-  199,0,0,0,0,0,0,0,51,252,255,181,0,0,0,0,12,255,255,163,0,0,0,0,0,53,255,255,129,0,0,174,
-  255,255,252,41,0,0,0,0,0,0,0,0,22,223,255,255,255,222,7,0,0,0,0,0,0,0,0,84,255,255,255,103,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,166,255,255,254,2,0,0,0,0,0,111,240,255,255,255,255,255,255,
-  255,255,251,138,5,0,0,0,0,0,0,0,6,139,250,255,255,255,255,255,255,255,255,246,114,1,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,160,255,255,118,0,0,
-  0,0,0,0,0,0,0,0,0,195,255,255,246,24,0,0,0,0,0,0,0,139,255,255,255,40,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,255,255,25,0,
-  0,0,0,191,255,255,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,182,255,255,
-  255,26,0,0,0,0,0,4,207,255,243,30,0,0,0,0,0,228,255,206,0,0,0,0,0,94,255,255,90,0,0,79,
-  255,255,255,212,25,0,0,0,0,0,0,1,103,246,255,255,255,250,58,0,0,0,0,0,0,0,0,62,255,255,255,115,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,255,255,234,0,0,0,0,2,164,255,255,255,255,255,255,255,255,
-  255,255,255,255,183,4,0,0,0,0,0,11,195,255,255,255,255,255,255,255,255,255,255,255,255,151,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,12,244,255,252,25,0,0,
-  0,0,0,0,0,0,0,0,0,95,255,255,255,188,7,0,0,0,0,0,63,250,255,255,196,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,58,217,243,160,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,225,255,231,0,0,
-  0,0,0,239,255,223,0,0,0,0,0,0,0,0,0,140,168,168,129,0,0,0,0,0,0,0,0,0,0,98,255,255,
-  255,59,0,0,0,0,0,26,205,255,112,0,0,0,0,0,0,147,255,255,70,0,0,0,4,207,255,245,19,0,0,0,
-  185,255,255,255,236,125,49,14,12,39,105,210,255,255,255,255,255,255,229,23,0,0,0,0,0,0,0,36,255,255,255,135,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,201,255,255,208,0,0,0,0,136,255,255,255,241,132,51,16,13,51,
-  146,252,255,255,255,135,0,0,0,0,0,171,255,255,255,226,108,38,10,15,50,130,245,255,255,255,90,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,97,255,255,182,0,0,0,
-  0,0,0,0,0,0,0,0,0,2,206,255,255,255,208,84,24,11,43,132,249,255,255,255,57,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,198,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,255,255,181,0,0,
-  0,0,35,255,255,173,0,0,0,0,0,0,0,0,0,200,255,255,214,0,0,0,0,0,0,0,0,0,0,78,255,255,
-  255,77,0,0,0,0,0,0,3,97,2,0,0,0,0,0,0,29,238,255,239,108,48,76,193,255,255,126,0,0,0,0,
-  15,203,255,255,255,255,255,255,255,255,255,255,255,255,242,159,255,255,255,193,4,0,0,0,0,0,0,5,250,255,255,172,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,233,255,255,170,0,0,0,42,253,255,255,225,36,0,0,0,0,0,
-  0,79,253,255,255,248,24,0,0,0,66,255,255,255,201,15,0,0,0,0,0,0,50,246,255,255,220,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,194,255,255,85,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,38,233,255,255,255,255,255,255,255,255,255,255,255,118,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,200,255,255,255,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,255,255,131,0,0,
-  0,0,85,255,255,123,0,0,0,0,0,0,0,0,0,168,255,255,252,15,0,0,0,0,0,0,0,0,0,109,255,255,
-  255,61,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,239,255,255,255,255,255,255,161,2,0,0,0,0,
-  0,8,142,250,255,255,255,255,255,255,255,255,254,176,34,0,173,255,255,255,143,0,0,0,0,0,0,0,212,255,255,210,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,11,255,255,255,127,0,0,0,157,255,255,255,60,0,0,0,0,0,0,
-  0,0,148,255,255,255,101,0,0,0,161,255,255,253,37,0,0,0,0,0,0,0,0,144,255,255,255,42,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,35,254,255,237,7,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,42,201,255,255,255,255,255,255,255,255,242,106,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,63,220,244,165,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,119,255,255,81,0,0,
-  0,0,135,255,255,73,0,0,0,0,0,0,0,0,0,108,255,255,255,115,0,0,0,0,0,0,0,0,1,200,255,255,
-  254,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,145,220,249,239,189,84,0,0,0,0,0,0,
-  0,0,0,25,119,183,226,245,248,228,190,125,39,0,0,0,17,226,255,255,255,87,0,0,0,0,0,0,158,255,255,246,
-  3,0,0,0,0,0,0,0,0,0,0,0,0,61,255,255,255,72,0,0,0,230,255,255,200,0,0,0,0,0,0,0,
-  0,0,46,255,255,255,150,0,0,0,212,255,255,204,0,0,0,0,0,0,0,0,0,74,255,255,255,84,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,131,255,255,148,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,2,81,163,217,240,248,227,192,116,25,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,247,255,255,245,57,0,0,0,0,0,0,1,134,255,255,255,
-  195,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,255,255,255,
-  54,0,0,0,0,0,0,0,0,0,0,0,0,116,255,255,252,13,0,0,20,255,255,255,137,0,0,0,0,0,0,0,
-  0,0,3,253,255,255,169,0,0,0,104,116,116,82,0,0,0,0,0,0,0,0,0,53,255,255,255,102,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,2,225,255,255,52,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,146,255,255,255,156,0,0,0,0,0,0,0,149,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,12,0,0,136,255,255,255,248,142,54,13,5,27,85,194,255,255,255,255,
-  70,0,0,128,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,184,0,0,0,0,0,4,88,166,219,
-  242,249,232,194,130,31,0,0,0,0,0,0,0,0,48,209,245,189,24,0,0,0,0,0,0,0,0,0,24,253,255,255,
-  121,0,0,0,0,0,0,0,0,0,0,0,0,178,255,255,192,0,0,0,32,212,212,212,95,0,0,0,0,0,0,0,
-  0,0,4,252,255,255,156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,255,255,255,80,0,2,155,241,
-  227,91,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,68,255,255,211,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,109,170,212,240,251,140,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,253,255,255,255,156,0,0,0,0,0,0,0,176,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,12,0,0,5,193,255,255,255,255,255,255,255,255,255,255,255,255,255,135,
-  0,0,0,128,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,184,0,0,0,0,60,221,255,255,255,
-  255,255,255,255,255,252,139,6,0,0,0,0,0,0,185,255,255,255,143,0,0,0,0,0,0,0,0,0,0,195,255,255,
-  189,0,0,0,0,0,0,0,0,0,0,0,11,247,255,255,109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,35,255,255,255,109,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,255,255,245,16,0,73,255,255,
-  255,247,7,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,70,128,128,70,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,169,253,255,255,255,255,255,140,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,212,255,255,255,255,156,0,0,0,0,0,0,0,202,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,12,0,0,0,9,162,255,255,255,255,255,255,255,255,255,255,245,112,0,
-  0,0,0,128,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,134,0,0,0,78,251,255,255,255,255,
-  255,255,255,255,255,255,255,184,5,0,0,0,0,0,188,255,255,255,147,0,0,0,0,0,0,0,0,0,0,100,255,255,
-  252,26,0,0,0,0,0,0,0,0,0,0,83,255,255,248,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,116,255,255,254,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,254,255,255,131,0,0,76,255,255,
-  255,249,9,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,97,246,255,255,255,255,255,255,255,140,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,255,255,255,255,255,156,0,0,0,0,0,0,0,228,255,
-  255,124,4,4,4,4,4,4,4,4,4,4,4,0,0,0,0,0,0,57,160,234,255,255,255,255,253,213,131,26,0,0,
-  0,0,0,2,4,4,4,4,4,4,4,4,4,4,4,4,4,4,87,255,255,251,27,0,0,29,245,255,255,255,187,72,
-  19,11,45,134,248,255,255,255,135,0,0,0,0,0,53,213,246,193,27,0,0,0,0,0,0,0,0,0,0,10,238,255,
-  255,125,0,0,0,0,0,0,0,0,0,0,183,255,255,163,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,6,220,255,255,182,0,0,0,0,0,0,0,0,0,0,0,0,3,22,73,173,255,255,255,173,4,0,0,3,161,243,
-  229,97,0,0,0,0,0,0,0,0,0,104,255,255,255,60,0,0,0,0,0,0,17,113,189,233,250,237,209,141,48,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,115,255,255,255,255,230,136,69,32,11,2,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,249,255,255,255,255,255,156,0,0,0,0,0,0,2,251,255,
-  255,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,255,255,207,10,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,199,255,255,167,0,0,0,150,255,255,255,143,0,0,
-  0,0,0,0,58,245,255,255,248,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,255,
-  255,224,3,0,0,0,0,0,0,0,0,37,254,255,253,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,131,255,255,254,54,0,0,0,0,0,0,0,0,0,100,255,255,255,255,255,255,255,250,144,5,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,240,255,255,255,255,255,255,255,254,148,
-  10,0,0,0,0,0,0,0,0,0,0,70,254,255,255,251,119,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,197,255,255,181,255,255,255,156,0,0,0,0,0,0,24,255,255,
-  255,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,255,255,200,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,255,255,255,55,0,0,0,230,255,255,224,5,0,0,
-  0,0,0,0,0,122,255,255,255,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,235,
-  255,255,97,0,0,0,0,0,0,0,0,159,255,255,163,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  66,252,255,255,156,0,0,0,0,0,0,0,0,0,0,100,255,255,255,255,255,255,255,127,5,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,17,124,81,0,0,0,0,0,0,125,255,255,255,255,255,255,255,255,255,255,255,
-  185,6,0,0,0,0,0,0,0,0,9,221,255,255,247,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,255,255,243,38,255,255,255,156,0,0,0,0,0,0,50,255,255,
-  255,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,255,255,200,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,255,255,199,0,0,0,16,255,255,255,149,0,0,0,
-  0,0,0,0,0,33,255,255,255,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,
-  255,255,227,12,0,0,0,0,0,0,51,254,255,240,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,
-  235,255,255,224,14,0,0,0,0,0,0,0,0,0,0,100,255,255,255,255,255,255,255,255,216,51,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,25,139,242,255,100,0,0,0,0,0,77,255,255,255,251,144,49,12,26,99,228,255,255,
-  255,151,0,0,0,0,0,0,0,0,128,255,255,255,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,28,242,255,255,110,8,255,255,255,156,0,0,0,0,0,0,76,255,255,
-  255,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,255,255,200,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,253,255,255,87,0,0,0,31,255,255,255,125,0,0,0,
-  0,0,0,0,0,6,255,255,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-  188,255,255,151,0,0,0,0,0,8,206,255,255,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,215,
-  255,255,248,54,0,0,0,0,0,0,0,0,0,0,0,1,4,4,8,26,73,164,253,255,255,244,52,0,0,0,0,0,
-  0,0,0,0,0,0,0,36,154,248,255,255,255,100,0,0,0,0,4,222,255,255,249,72,0,0,0,0,0,21,215,255,
-  255,253,55,0,0,0,0,0,0,3,230,255,255,186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,178,255,255,201,2,8,255,255,255,156,0,0,0,0,0,0,102,255,255,
-  242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,255,255,226,4,0,0,0,12,254,255,255,146,0,0,0,
-  0,0,0,0,0,27,255,255,255,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  24,233,255,255,91,0,0,0,0,156,255,255,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,197,255,
-  255,255,94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,248,255,255,218,6,0,0,0,0,
-  0,0,0,0,0,48,168,253,255,255,255,255,255,100,0,0,0,0,82,255,255,255,127,0,0,0,0,0,0,0,40,250,
-  255,255,176,0,0,0,0,0,0,73,255,255,255,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,87,255,255,251,46,0,8,255,255,255,156,0,0,0,0,0,0,128,255,255,
-  215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
-  1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,246,255,255,119,0,0,0,0,0,203,255,255,222,4,0,0,
-  0,0,0,0,0,108,255,255,255,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,58,246,255,248,76,0,1,148,255,255,205,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,177,255,255,
-  255,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,255,255,255,91,0,0,0,0,
-  0,0,0,62,183,255,255,255,255,255,255,203,96,8,0,0,0,0,163,255,255,245,15,0,0,0,0,0,0,0,0,153,
-  255,255,250,22,0,0,0,0,0,157,255,255,227,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,18,232,255,255,134,0,0,8,255,255,255,156,0,0,0,0,0,0,154,255,255,
-  188,63,154,213,245,253,235,198,125,23,0,0,0,0,0,8,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,255,255,245,17,0,0,0,0,0,89,255,255,255,140,0,0,
-  0,0,0,0,40,237,255,255,205,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,72,245,255,201,0,30,255,255,211,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,153,255,255,255,
-  148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,250,255,255,166,0,0,0,0,
-  1,77,198,255,255,255,255,255,248,163,55,0,0,0,0,0,0,0,218,255,255,187,0,0,0,0,0,0,0,0,0,58,
-  255,255,255,87,0,0,0,0,0,209,255,255,155,0,38,137,207,238,252,233,190,108,8,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,159,255,255,219,8,0,0,8,255,255,255,156,0,0,0,0,0,0,180,255,255,
-  251,255,255,255,255,255,255,255,255,242,104,0,0,0,0,8,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  68,0,0,0,0,0,0,0,0,0,0,0,0,0,7,233,255,255,151,0,0,0,0,0,0,0,154,255,255,255,180,66,
-  14,5,35,117,240,255,255,232,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,54,224,118,0,0,203,178,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,255,255,255,167,
-  2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,211,255,255,205,0,0,4,92,
-  212,255,255,255,255,255,226,122,21,0,0,0,0,0,0,0,0,0,251,255,255,148,0,0,0,0,0,0,0,0,0,5,
-  249,255,255,138,0,0,0,0,7,251,255,255,113,132,250,255,255,255,255,255,255,255,223,57,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,67,255,255,255,66,0,0,0,8,255,255,255,156,0,0,0,0,0,0,206,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,124,0,0,0,8,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  68,0,0,0,0,0,0,0,0,0,0,0,0,0,101,255,255,254,40,0,0,0,0,0,0,0,2,145,253,255,255,255,
-  255,255,255,255,255,255,215,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,13,20,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,255,255,255,185,6,
-  0,0,0,0,0,0,0,0,0,8,52,52,52,24,0,0,0,0,0,0,0,0,0,0,197,255,255,214,0,78,223,255,
-  255,255,255,255,188,81,3,0,0,0,0,0,0,0,0,0,0,8,255,255,255,136,0,0,0,0,0,0,0,0,0,0,
-  216,255,255,179,0,0,0,0,48,255,255,255,218,255,255,255,255,255,255,255,255,255,255,243,59,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,10,221,255,255,158,0,0,0,0,8,255,255,255,156,0,0,0,0,0,0,233,255,255,
-  255,173,71,20,4,23,83,200,255,255,255,254,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,1,215,255,255,183,0,0,0,0,0,0,0,0,0,0,119,255,255,255,
-  255,255,255,255,255,208,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,252,255,255,200,11,0,
-  0,0,0,0,0,0,0,0,0,28,255,255,255,134,0,0,0,0,0,0,0,0,0,0,213,255,255,195,0,152,255,255,
-  255,241,147,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,255,255,148,0,0,0,0,0,0,0,0,0,0,
-  201,255,255,195,0,0,0,0,69,255,255,255,255,255,241,127,42,6,18,80,208,255,255,255,225,15,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,140,255,255,233,18,0,0,0,0,8,255,255,255,156,0,0,0,0,0,0,58,124,188,
-  93,0,0,0,0,0,0,2,151,255,255,255,210,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,76,255,255,255,71,0,0,0,0,0,0,0,0,13,161,255,255,255,255,
-  255,255,255,255,255,255,210,52,0,0,0,0,0,0,0,0,0,0,0,0,84,136,26,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,246,255,255,214,19,0,0,
-  0,0,0,0,0,0,0,0,0,5,250,255,255,184,0,0,0,0,0,0,0,0,0,12,251,255,255,159,0,152,255,255,
-  255,193,77,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,223,255,255,189,0,0,0,0,0,0,0,0,0,0,
-  196,255,255,210,0,0,0,0,83,255,255,255,255,219,32,0,0,0,0,0,6,184,255,255,255,130,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,51,252,255,255,89,0,0,0,0,0,8,255,255,255,156,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,2,196,255,255,255,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,192,255,255,214,1,0,0,0,0,0,0,0,6,189,255,255,255,168,67,
-  19,11,43,123,238,255,255,241,49,0,0,0,0,0,0,0,0,0,0,0,100,255,249,160,45,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,237,255,255,226,28,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,188,255,255,252,39,0,0,0,0,0,0,0,0,110,255,255,255,89,0,104,248,255,
-  255,255,255,224,121,22,0,0,0,0,0,0,0,0,0,0,0,0,178,255,255,247,16,0,0,0,0,0,0,0,0,11,
-  230,255,255,215,0,0,0,0,97,255,255,255,236,25,0,0,0,0,0,0,0,21,237,255,255,234,3,0,0,0,0,0,
-  0,0,0,0,0,0,0,4,207,255,255,182,0,0,0,0,0,0,8,255,255,255,156,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,68,255,255,255,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,51,255,255,255,103,0,0,0,0,0,0,0,0,153,255,255,255,97,0,0,
-  0,0,0,0,32,220,255,255,233,21,0,0,0,0,0,0,0,0,0,0,100,255,255,255,255,185,69,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,225,255,255,235,40,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,86,255,255,255,210,22,0,0,0,0,0,0,52,243,255,255,228,8,0,0,24,138,
-  242,255,255,255,255,249,165,59,0,0,0,0,0,0,0,0,0,0,96,255,255,255,128,0,0,0,0,0,0,0,0,146,
-  255,255,255,211,0,0,0,0,107,255,255,255,112,0,0,0,0,0,0,0,0,0,138,255,255,255,51,0,0,0,0,0,
-  0,0,0,0,0,0,0,120,255,255,244,31,0,0,0,0,0,0,8,255,255,255,156,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,3,242,255,255,184,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
-  1,0,0,0,0,0,0,0,0,0,0,0,167,255,255,237,9,0,0,0,0,0,0,0,39,253,255,255,151,0,0,0,
-  0,0,0,0,0,49,253,255,255,145,0,0,0,0,84,255,255,255,64,0,93,255,255,255,255,255,255,208,93,5,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,210,255,255,245,58,4,4,4,4,4,
-  4,4,4,4,4,4,4,4,0,0,0,190,255,255,255,231,115,40,11,15,53,138,246,255,255,255,87,0,0,0,0,0,
-  16,124,235,255,255,255,255,255,209,103,12,0,0,0,0,0,0,0,17,241,255,255,249,66,0,0,0,0,0,1,138,255,
-  255,255,255,204,0,0,0,0,107,255,255,255,56,0,0,0,0,0,0,0,0,0,65,255,255,255,103,0,0,0,0,0,
-  0,0,0,0,0,0,36,247,255,255,113,0,0,0,0,0,0,0,8,255,255,255,156,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,204,255,255,205,0,8,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  68,0,0,0,0,0,0,0,0,0,0,30,251,255,255,135,0,0,0,0,0,0,0,0,129,255,255,255,35,0,0,0,
-  0,0,0,0,0,0,180,255,255,239,2,0,0,0,84,255,255,255,64,0,0,56,158,245,255,255,255,255,255,228,118,15,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,0,0,0,17,208,255,255,255,255,255,255,255,255,255,255,255,255,123,0,0,0,0,0,0,
-  0,0,10,110,226,255,255,255,255,255,241,147,42,0,0,0,0,0,0,109,255,255,255,249,133,39,6,20,82,198,255,255,
-  255,255,255,190,0,0,0,0,94,255,255,255,60,0,0,0,0,0,0,0,0,0,25,255,255,255,124,0,0,0,0,0,
-  0,0,0,0,0,0,189,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,144,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,192,255,255,219,0,8,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  68,0,0,0,0,0,0,0,0,0,0,142,255,255,251,27,0,0,0,0,0,0,0,0,182,255,255,229,0,0,0,0,
-  0,0,0,0,0,0,116,255,255,255,41,0,0,0,84,255,255,255,63,0,0,0,0,15,108,209,255,255,255,255,255,242,
-  142,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,0,0,0,0,10,151,252,255,255,255,255,255,255,255,255,231,82,0,0,0,0,0,0,0,
-  0,0,0,0,5,97,215,255,255,255,255,255,255,87,0,0,0,0,0,2,180,255,255,255,255,255,255,255,255,255,255,149,
-  241,255,255,169,0,0,0,0,78,255,255,255,75,0,0,0,0,0,0,0,0,0,12,255,255,255,134,0,0,0,0,0,
-  0,0,0,0,0,0,248,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,144,0,3,4,4,1,
-  0,0,0,0,0,0,0,0,0,0,205,255,255,206,0,8,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  68,0,0,0,0,0,0,0,0,0,15,242,255,255,167,0,0,0,0,0,0,0,0,0,203,255,255,208,0,0,0,0,
-  0,0,0,0,0,0,93,255,255,255,62,0,0,0,88,255,255,255,44,0,0,0,0,0,0,0,57,159,245,255,255,255,
-  255,251,167,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,0,0,0,0,0,0,32,128,192,231,249,243,222,171,98,7,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,2,83,203,255,255,255,255,100,0,0,0,0,0,0,4,155,255,255,255,255,255,255,255,247,118,3,
-  254,255,255,137,0,0,0,0,43,255,255,255,111,0,0,0,0,0,0,0,0,0,25,255,255,255,118,0,0,0,0,0,
-  0,0,0,0,0,0,248,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,144,0,231,255,255,134,
-  0,0,0,0,0,0,0,0,0,2,242,255,255,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,117,255,255,255,55,0,0,0,0,0,0,0,0,0,190,255,255,222,0,0,0,0,
-  0,0,0,0,0,0,107,255,255,255,49,0,0,0,111,255,255,255,14,0,0,0,0,0,0,0,0,0,15,108,210,255,
-  255,255,255,255,192,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,69,190,255,255,100,0,0,0,0,0,0,0,0,61,163,224,251,244,213,137,34,0,23,
-  255,255,255,97,0,0,0,0,2,241,255,255,171,0,0,0,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,0,0,0,0,3,4,4,4,4,4,4,4,4,4,4,4,11,255,255,255,157,4,4,4,2,0,187,255,255,202,
-  0,0,0,0,0,0,0,0,0,60,255,255,255,130,0,180,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  236,0,0,0,0,0,0,0,0,5,227,255,255,199,0,0,0,0,0,0,0,0,0,0,161,255,255,254,19,0,0,0,
-  0,0,0,0,0,0,159,255,255,255,21,0,0,0,166,255,255,203,0,0,0,0,0,0,0,0,0,0,0,0,0,58,
-  160,246,255,255,255,76,0,0,0,0,0,47,145,206,237,251,237,205,143,42,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,27,109,165,213,234,250,243,227,196,145,82,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,55,177,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,
-  255,255,255,43,0,0,0,0,0,171,255,255,247,18,0,0,0,0,0,0,0,0,136,255,255,255,35,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,255,255,255,156,0,0,0,0,0,112,255,255,255,
-  60,0,0,0,0,0,0,0,0,178,255,255,255,61,0,180,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  236,0,0,0,0,0,0,0,0,92,255,255,255,87,0,0,0,0,0,0,0,0,0,0,93,255,255,255,124,0,0,0,
-  0,0,0,0,0,23,244,255,255,209,0,0,0,11,239,255,255,110,0,0,0,0,0,0,0,0,0,0,0,0,0,40,
-  142,238,255,255,255,76,0,0,0,14,163,255,255,255,255,255,255,255,255,254,147,6,0,0,0,0,0,0,0,0,0,0,
-  0,0,56,183,253,255,255,255,255,255,255,255,255,255,255,239,140,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,139,
-  255,255,232,1,0,0,0,0,0,68,255,255,255,149,0,0,0,0,0,0,0,19,236,255,255,216,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,255,255,255,156,0,0,0,0,0,21,243,255,255,
-  223,30,0,0,0,0,0,0,116,255,255,255,205,0,0,180,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  236,0,0,0,0,0,0,0,0,207,255,255,226,4,0,0,0,0,0,0,0,0,0,0,13,234,255,255,249,68,0,0,
-  0,0,0,0,13,192,255,255,255,108,0,0,0,115,255,255,227,11,0,0,0,0,0,0,0,0,0,0,6,88,191,255,
-  255,255,255,255,224,45,0,0,13,202,255,255,255,255,255,255,255,255,255,255,255,168,0,0,0,0,0,0,0,0,0,0,
-  17,167,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,237,87,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,235,
-  255,255,151,0,0,0,0,0,0,1,195,255,255,255,98,0,0,0,0,0,6,181,255,255,255,102,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,255,255,255,156,0,0,0,0,0,0,115,255,255,
-  255,237,120,42,11,18,66,174,255,255,255,252,61,0,0,180,255,255,255,15,4,4,4,4,4,4,4,4,4,4,4,4,
-  3,0,0,0,0,0,0,0,68,255,255,255,119,0,0,0,0,0,0,0,0,0,0,0,0,98,255,255,255,251,152,60,
-  17,9,35,104,221,255,255,255,209,5,0,0,10,238,255,255,82,0,0,0,0,0,0,0,0,0,35,137,234,255,255,255,
-  255,255,204,89,4,0,0,0,152,255,255,255,222,96,28,9,31,108,239,255,255,255,90,0,0,0,0,0,0,0,0,50,
-  223,255,255,255,246,168,99,49,23,8,14,31,67,123,198,255,255,255,255,137,0,0,0,0,0,0,180,255,255,255,255,255,
-  255,255,255,254,242,227,189,137,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,255,
-  255,255,47,0,0,0,0,0,0,0,38,246,255,255,255,160,53,12,22,83,208,255,255,255,198,4,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,255,255,255,156,0,0,0,0,0,0,0,157,255,
-  255,255,255,255,255,255,255,255,255,255,254,108,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,183,255,255,245,17,0,0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,255,255,255,
-  255,255,255,255,255,255,255,224,28,0,0,0,0,56,219,121,0,0,0,0,0,0,0,4,82,186,254,255,255,255,255,254,
-  181,65,0,0,0,0,0,22,252,255,255,217,17,0,0,0,0,0,50,249,255,255,207,0,0,0,0,0,0,0,54,240,
-  255,255,245,132,15,0,0,0,0,0,0,0,0,0,0,44,179,255,255,255,132,0,0,0,0,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,192,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,253,255,
-  255,174,0,0,0,0,0,0,0,0,0,70,248,255,255,255,255,255,255,255,255,255,255,221,30,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,255,255,255,156,0,0,0,0,0,0,0,1,113,
-  245,255,255,255,255,255,255,255,255,230,82,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,43,255,255,255,151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,235,255,255,255,
-  255,255,255,255,255,254,169,18,0,0,0,0,0,0,7,0,0,0,0,0,0,30,131,230,255,255,255,255,255,248,157,41,
-  0,0,0,0,0,0,0,91,255,255,255,86,0,0,0,0,0,0,0,163,255,255,255,22,0,0,0,0,0,39,239,255,
-  255,207,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,250,255,255,85,0,0,0,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,238,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,130,253,255,255,
-  238,30,0,0,0,0,0,0,0,0,0,0,59,216,255,255,255,255,255,255,255,255,183,22,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,255,255,255,156,0,0,0,0,0,0,0,0,0,
-  19,117,186,230,248,244,223,174,101,9,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,158,255,255,254,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,101,172,222,
-  243,250,233,199,137,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,253,255,255,255,255,255,237,133,24,0,0,
-  0,0,0,0,0,0,0,113,240,240,240,28,0,0,0,0,0,0,0,101,255,255,255,57,0,0,0,0,8,209,255,255,
-  190,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,253,255,233,19,0,0,0,180,255,255,255,15,4,
-  4,4,4,5,16,48,114,226,255,255,255,218,5,0,0,0,0,0,0,0,0,0,4,17,35,81,145,237,255,255,255,240,
-  61,0,0,0,0,0,0,0,0,0,0,0,0,7,94,179,225,248,240,214,151,63,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,255,255,255,255,221,109,11,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,255,255,255,68,0,0,0,0,137,255,255,207,
-  11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,255,255,138,0,0,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,14,204,255,255,255,94,0,0,0,0,0,0,0,0,8,255,255,255,255,255,255,255,255,228,46,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,255,255,255,255,252,237,210,162,89,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,68,142,
-  202,226,247,244,227,189,133,46,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,200,255,255,222,1,0,0,0,0,0,0,0,0,0,0,0,180,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,44,0,0,0,0,100,255,255,200,85,3,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,113,255,255,255,43,0,0,0,34,248,255,244,38,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,223,255,241,15,0,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,59,255,255,255,168,0,0,0,0,0,0,0,0,8,255,255,255,255,255,255,240,123,11,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,58,143,199,235,250,242,223,179,116,25,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,255,255,255,255,255,255,255,255,255,240,127,9,0,0,0,0,0,0,0,0,0,0,0,71,212,255,255,
-  255,255,255,255,255,255,255,255,189,38,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,40,255,255,255,255,64,0,0,0,0,0,0,0,0,0,0,0,180,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,44,0,0,0,0,98,177,61,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,191,255,255,240,6,0,0,0,161,255,255,122,0,
-  0,0,0,0,0,0,0,66,179,240,252,230,169,64,0,0,0,0,0,0,85,255,255,102,0,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,2,245,255,255,206,0,0,0,0,0,0,0,0,8,255,240,220,199,144,75,11,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,56,199,255,255,255,255,255,255,255,255,255,249,150,11,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,255,255,255,255,255,255,255,255,255,255,255,216,46,0,0,0,0,0,0,0,0,0,132,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,247,79,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,255,255,160,0,0,0,0,0,0,0,0,0,0,0,180,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,44,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,255,255,255,157,0,0,0,21,248,255,230,9,0,
-  0,0,0,0,0,4,151,255,255,255,255,255,255,255,163,9,0,0,0,0,4,235,255,186,0,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,229,255,255,222,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,115,251,255,255,255,255,255,255,255,255,255,255,255,255,216,32,0,0,0,0,0,0,0,
-  0,180,255,255,255,15,4,4,4,8,29,61,134,227,255,255,255,240,57,0,0,0,0,0,0,0,140,255,255,255,255,183,
-  92,36,12,16,44,107,212,255,255,255,250,67,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,3,229,255,255,255,255,244,12,0,0,0,0,0,0,0,0,0,0,180,255,255,
-  255,15,4,4,4,4,4,4,4,4,4,4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,232,255,255,248,34,0,0,0,117,255,255,130,0,0,
-  0,0,0,0,1,169,255,255,255,255,255,255,255,255,255,184,0,0,0,0,0,150,255,251,11,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,7,249,255,255,202,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,121,255,255,255,255,190,95,36,12,18,50,119,228,255,255,255,216,18,0,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,10,138,255,255,255,234,29,0,0,0,0,0,71,255,255,255,244,79,0,
-  0,0,0,0,0,0,4,138,255,255,255,226,13,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,72,255,255,253,246,255,255,96,0,0,0,0,0,0,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,221,255,255,255,125,0,0,0,0,193,255,255,32,0,0,
-  0,0,0,0,118,255,255,255,158,45,8,32,125,255,255,200,0,0,0,0,0,67,255,255,62,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,91,255,255,255,136,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,69,253,255,255,248,90,0,0,0,0,0,0,0,14,182,255,255,255,159,0,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,112,255,255,255,183,0,0,0,0,6,227,255,255,253,69,0,0,
-  0,0,0,0,0,0,0,0,163,255,255,255,113,0,0,180,255,255,255,255,255,255,255,255,255,255,255,255,255,255,252,0,
-  0,0,0,0,0,0,0,0,0,0,0,168,255,255,188,164,255,255,192,0,0,0,0,0,0,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,216,255,255,255,176,1,0,0,0,13,250,255,214,0,0,0,
-  0,0,0,32,247,255,255,120,0,0,0,0,49,255,255,178,0,0,0,0,0,18,255,255,117,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,46,235,255,255,243,27,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,6,220,255,255,254,77,0,0,0,0,0,0,0,0,0,11,219,255,255,254,46,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,170,255,255,255,72,0,0,0,89,255,255,255,154,0,0,0,
-  0,0,0,0,0,0,0,0,24,249,255,255,214,0,0,180,255,255,255,255,255,255,255,255,255,255,255,255,255,255,252,0,
-  0,0,0,0,0,0,0,0,0,0,16,247,255,255,95,72,255,255,254,33,0,0,0,0,0,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,202,255,255,255,194,11,0,0,0,0,63,255,255,148,0,0,0,
-  0,0,0,153,255,255,186,0,0,0,0,0,71,255,255,155,0,0,0,0,0,0,227,255,154,0,180,255,255,255,12,0,
-  0,0,0,0,12,53,139,247,255,255,248,72,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,99,255,255,255,156,0,0,0,0,0,0,0,0,0,0,0,90,255,255,255,141,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,24,249,255,255,185,0,0,0,191,255,255,254,30,0,0,0,
-  0,0,0,0,0,0,0,0,0,177,255,255,255,23,0,180,255,255,255,255,255,255,255,255,255,255,255,255,255,255,252,0,
-  0,0,0,0,0,0,0,0,0,0,103,255,255,246,13,3,231,255,255,128,0,0,0,0,0,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,255,255,255,193,11,0,0,0,0,0,104,255,255,105,0,0,0,
-  0,0,8,242,255,255,51,0,0,0,0,0,94,255,255,133,0,0,0,0,0,0,182,255,185,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,217,64,0,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,200,255,255,253,27,0,0,0,0,0,0,0,0,0,0,0,9,243,255,255,222,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,169,255,255,254,24,0,8,250,255,255,197,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,48,96,96,96,24,0,180,255,255,255,15,4,4,4,4,4,4,4,4,4,4,3,0,
-  0,0,0,0,0,0,0,0,0,0,199,255,255,166,0,0,142,255,255,222,1,0,0,0,0,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,50,254,255,255,211,11,0,0,0,0,0,0,142,255,255,67,0,0,0,
-  0,0,80,255,255,207,0,0,0,0,0,0,117,255,255,110,0,0,0,0,0,0,161,255,211,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,242,91,2,0,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,22,254,255,255,187,0,0,0,0,0,0,0,0,0,0,0,0,0,188,255,255,255,14,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,86,255,255,255,94,0,57,255,255,255,135,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,39,255,255,255,74,0,0,49,255,255,255,64,0,0,0,0,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,153,255,255,255,64,0,0,0,0,0,0,0,159,255,255,47,0,0,0,
-  0,0,162,255,255,126,0,0,0,0,0,0,140,255,255,88,0,0,0,0,0,0,147,255,223,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,204,31,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,83,255,255,255,122,0,0,0,0,0,0,0,0,0,0,0,0,0,63,108,108,108,19,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,34,255,255,255,145,0,104,255,255,255,90,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,135,255,255,233,4,0,0,0,212,255,255,160,0,0,0,0,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,210,255,255,227,0,0,0,0,0,0,0,0,171,255,255,35,0,0,0,
-  0,0,213,255,255,67,0,0,0,0,0,0,162,255,255,65,0,0,0,0,0,0,134,255,232,0,180,255,255,255,15,4,
-  4,4,4,4,8,28,80,183,255,255,255,225,23,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,124,255,255,255,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,248,255,255,183,0,123,255,255,255,63,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,2,228,255,255,145,0,0,0,0,119,255,255,244,12,0,0,0,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,236,255,255,176,0,0,0,0,0,0,0,0,177,255,255,31,0,0,0,
-  0,3,249,255,255,21,0,0,0,0,0,0,185,255,255,43,0,0,0,0,0,0,123,255,234,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,120,255,255,255,169,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,153,255,255,255,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,233,255,255,201,0,138,255,255,255,49,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,71,255,255,255,52,0,0,0,0,29,254,255,255,96,0,0,0,0,0,0,0,180,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,207,212,212,131,0,0,0,0,0,0,0,0,168,255,255,40,0,0,0,
-  0,36,255,255,244,0,0,0,0,0,0,0,208,255,255,20,0,0,0,0,0,0,133,255,220,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,192,255,255,254,35,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,165,255,255,255,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,218,255,255,213,0,150,255,255,255,40,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,167,255,255,215,0,0,0,0,0,0,190,255,255,192,0,0,0,0,0,0,0,180,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,157,255,255,52,0,0,0,
-  0,58,255,255,221,0,0,0,0,0,0,0,230,255,252,1,0,0,0,0,0,0,154,255,202,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,96,255,255,255,110,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,171,255,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,216,255,255,216,0,152,255,255,255,40,0,0,0,0,
-  0,0,4,255,255,255,255,255,255,255,255,255,255,76,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,15,247,255,255,123,0,0,0,0,0,0,97,255,255,254,33,0,0,0,0,0,0,180,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,255,255,80,0,0,0,
-  0,67,255,255,213,0,0,0,0,0,0,1,251,255,231,0,0,0,0,0,0,0,196,255,159,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,47,255,255,255,151,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,172,255,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,220,255,255,213,0,151,255,255,255,41,0,0,0,0,
-  0,0,4,255,255,255,255,255,255,255,255,255,255,76,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,102,255,255,254,32,0,0,0,0,0,0,14,246,255,255,128,0,0,0,0,0,0,180,255,255,
-  255,15,4,4,4,4,4,4,4,4,4,4,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,255,255,111,0,0,0,
-  0,60,255,255,228,0,0,0,0,0,0,70,255,255,215,0,0,0,0,0,0,13,248,255,108,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,33,255,255,255,162,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,171,255,255,255,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,236,255,255,201,0,145,255,255,255,53,0,0,0,0,
-  0,0,4,255,255,255,255,255,255,255,255,255,255,76,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,198,255,255,194,0,0,0,0,0,0,0,0,167,255,255,222,1,0,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,255,255,160,0,0,0,
-  0,35,255,255,255,19,0,0,0,0,0,192,255,255,214,0,0,0,0,0,0,98,255,253,27,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,49,255,255,255,144,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,161,255,255,255,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,2,251,255,255,184,0,131,255,255,255,69,0,0,0,0,
-  0,0,0,4,4,4,4,4,4,114,255,255,255,76,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,38,255,255,255,102,0,0,0,0,0,0,0,0,74,255,255,255,64,0,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,117,237,231,95,0,0,0,0,0,0,0,0,18,254,255,216,0,0,0,
-  0,1,238,255,255,119,0,0,0,0,120,255,255,255,241,1,0,0,0,0,10,221,255,180,0,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,105,255,255,255,112,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,144,255,255,255,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,42,255,255,255,145,0,100,255,255,255,108,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,112,255,255,255,76,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,134,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,160,0,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,24,254,255,255,247,5,0,0,0,0,0,0,0,0,215,255,255,35,0,0,
-  0,0,163,255,255,248,104,17,27,138,254,253,218,255,255,69,0,0,0,4,166,255,250,41,0,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,5,213,255,255,255,43,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,125,255,255,255,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,97,255,255,255,96,0,56,255,255,255,160,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,112,255,255,255,76,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,2,227,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,244,12,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,25,255,255,255,249,7,0,0,0,0,0,0,0,0,143,255,255,121,0,0,
-  0,0,47,251,255,255,255,255,255,255,255,133,72,255,255,228,85,48,86,199,255,255,107,0,0,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,5,161,255,255,255,196,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,77,255,255,255,120,0,0,0,0,0,0,0,0,0,0,0,0,0,51,88,88,88,16,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,186,255,255,255,26,0,5,242,255,255,235,6,0,0,0,
-  0,0,0,0,0,0,0,0,0,112,255,255,255,76,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,70,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,96,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,123,238,233,101,0,0,0,0,0,0,0,0,0,56,255,255,227,5,0,
-  0,0,0,112,255,255,255,255,255,255,148,3,0,153,255,255,255,255,255,255,247,108,0,0,0,0,180,255,255,255,15,4,
-  4,4,4,4,8,32,96,209,255,255,255,249,54,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,20,255,255,255,187,0,0,0,0,0,0,0,0,0,0,0,0,0,186,255,255,254,14,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,40,254,255,255,190,0,0,0,166,255,255,255,88,0,0,0,
-  0,0,0,0,0,0,0,0,0,112,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,165,255,255,234,7,4,4,4,4,4,4,4,4,4,4,4,214,255,255,192,0,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,212,255,255,109,0,
-  0,0,0,0,73,190,240,238,188,75,0,0,0,2,96,200,238,243,214,141,37,0,0,0,0,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,251,91,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,203,255,255,252,25,0,0,0,0,0,0,0,0,0,0,0,7,241,255,255,218,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,3,197,255,255,255,78,0,0,0,59,255,255,255,224,11,0,0,
-  0,0,0,0,0,0,0,0,0,112,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,0,0,14,246,255,255,152,0,0,0,0,0,0,0,0,0,0,0,0,127,255,255,254,33,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,255,255,243,33,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,214,57,0,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,97,255,255,255,151,0,0,0,0,0,0,0,0,0,0,0,87,255,255,255,136,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,0,2,150,255,255,255,190,0,0,0,0,0,180,255,255,255,167,2,0,
-  0,0,0,0,0,0,0,0,0,118,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,0,0,101,255,255,255,67,0,0,0,0,0,0,0,0,0,0,0,0,40,255,255,255,128,0,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,201,255,255,214,
-  18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,255,255,
-  255,255,255,255,250,233,206,150,73,1,0,0,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,8,227,255,255,252,67,0,0,0,0,0,0,0,0,0,8,216,255,255,253,40,0,0,0,0,0,
-  0,180,255,255,255,12,0,0,0,0,0,0,0,28,174,255,255,255,238,34,0,0,0,0,0,31,237,255,255,255,169,17,
-  0,0,0,0,0,0,0,0,79,244,255,255,255,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,0,0,197,255,255,233,3,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,222,1,0,0,180,255,255,
-  255,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,247,255,255,
-  213,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,70,255,255,255,241,70,0,0,0,0,0,0,0,13,177,255,255,255,149,0,0,0,0,0,0,
-  0,180,255,255,255,15,4,4,4,14,36,81,156,246,255,255,255,243,63,0,0,0,0,0,0,0,66,246,255,255,255,233,
-  133,55,22,9,24,52,107,198,255,255,255,255,191,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,0,37,255,255,255,151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,255,255,255,64,0,0,180,255,255,
-  255,15,4,4,4,4,4,4,4,4,4,4,4,4,4,1,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,252,255,
-  255,243,123,10,0,0,0,0,0,0,0,0,0,0,26,4,0,0,0,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,134,255,255,255,255,169,75,28,8,19,56,125,228,255,255,255,209,14,0,0,0,0,0,0,
-  0,180,255,255,255,255,255,255,255,255,255,255,255,255,255,255,220,52,0,0,0,0,0,0,0,0,0,62,232,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,176,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,0,133,255,255,255,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,255,255,255,160,0,0,180,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,96,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,248,
-  255,255,255,242,160,93,44,21,7,14,32,68,117,185,252,71,0,0,0,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,131,255,255,255,255,255,255,255,255,255,255,255,255,255,207,23,0,0,0,0,0,0,0,
-  0,180,255,255,255,255,255,255,255,255,255,255,255,255,240,132,11,0,0,0,0,0,0,0,0,0,0,0,21,155,251,255,
-  255,255,255,255,255,255,255,255,255,215,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,2,226,255,255,232,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,255,255,244,12,0,180,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,96,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,
-  218,255,255,255,255,255,255,255,255,255,255,255,255,255,255,152,0,0,0,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,72,216,255,255,255,255,255,255,255,255,255,243,133,6,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,255,255,255,255,251,238,207,160,89,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,113,
-  179,224,245,252,243,221,185,131,57,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,68,255,255,255,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,255,255,255,96,0,180,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,96,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  5,108,224,255,255,255,255,255,255,255,255,255,255,248,154,19,0,0,0,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,5,75,156,209,234,251,238,217,167,104,15,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,1,61,133,184,224,240,252,238,215,164,102,17,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,255,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,255,255,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,97,0,0,0,0,0,0,0,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,255,255,
-  255,255,255,255,255,242,224,184,123,34,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,255,255,255,84,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,0,0,0,5,187,255,255,255,193,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,255,186,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,218,255,255,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,237,22,0,0,0,0,0,0,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,252,165,18,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,0,0,0,50,139,197,234,250,243,220,173,100,16,0,0,0,0,0,0,
-  0,0,184,255,255,255,255,255,255,255,255,255,243,227,190,137,56,0,0,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,255,255,255,84,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,0,0,0,161,255,255,255,214,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,255,254,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,255,255,255,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,255,169,0,0,0,0,0,0,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,226,42,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,0,42,186,255,255,255,255,255,255,255,255,255,241,123,5,0,0,0,0,
-  0,0,184,255,255,255,255,255,255,255,255,255,255,255,255,255,255,204,51,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,0,0,132,255,255,255,232,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,255,255,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,255,255,255,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,15,4,
-  4,4,4,4,4,14,45,117,230,255,255,255,223,22,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,0,0,0,90,246,255,255,255,255,255,255,255,255,255,255,255,255,199,22,0,0,0,
-  0,0,184,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,251,90,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,0,102,255,255,255,244,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,255,255,255,228,3,0,0,0,0,0,0,0,0,0,0,0,0,0,17,247,255,255,255,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,255,255,226,13,0,0,0,0,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,18,193,255,255,255,157,0,0,0,180,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,40,0,0,0,0,90,253,255,255,255,190,93,35,11,25,60,140,242,255,255,255,211,17,0,0,
-  0,0,184,255,255,255,15,4,4,4,4,4,16,45,110,218,255,255,255,250,59,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,75,252,255,255,252,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,247,255,255,255,77,0,0,0,0,0,0,0,0,0,0,0,0,0,110,255,255,246,254,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,255,255,255,148,0,0,0,0,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,18,231,255,255,252,30,0,0,180,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,40,0,0,0,41,246,255,255,249,94,0,0,0,0,0,0,0,28,195,255,255,255,172,0,0,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,8,167,255,255,255,202,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  52,244,255,255,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,200,255,255,177,0,0,0,0,0,0,0,0,0,0,0,0,0,210,255,255,161,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,246,255,255,253,57,0,0,0,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,117,255,255,255,104,0,0,180,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,40,0,0,0,192,255,255,255,84,0,0,0,0,0,0,0,0,0,13,206,255,255,255,73,0,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,6,215,255,255,255,47,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,33,
-  232,255,255,255,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,100,255,255,252,25,0,0,0,0,0,0,0,0,0,0,0,55,255,255,255,61,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,118,255,255,255,213,6,0,0,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,43,255,255,255,157,0,0,180,255,255,255,15,4,4,4,4,4,4,4,4,4,4,
-  4,4,4,157,255,255,255,40,0,0,66,255,255,255,163,0,0,0,0,0,0,0,0,0,0,0,48,253,255,255,203,0,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,0,106,255,255,255,116,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,19,217,
-  255,255,255,169,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,13,244,255,255,122,0,0,0,0,0,0,0,0,0,0,0,155,255,255,217,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,17,193,255,255,255,127,0,0,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,11,255,255,255,179,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,0,169,255,255,254,30,0,0,0,0,0,0,0,0,0,0,0,0,167,255,255,255,46,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,0,48,255,255,255,147,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,8,197,255,
-  255,255,195,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,157,255,255,221,1,0,0,0,0,0,0,0,0,0,12,243,255,255,118,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,16,38,247,255,255,249,41,0,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,9,255,255,255,182,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,6,246,255,255,190,0,0,0,0,0,0,0,0,0,0,0,0,0,76,255,255,255,128,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,0,29,255,255,255,166,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,2,173,255,255,
-  255,217,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,57,255,255,255,68,0,0,0,0,0,0,0,0,0,101,255,255,250,23,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,16,0,121,255,255,255,196,1,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,36,255,255,255,161,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,61,255,255,255,121,0,0,0,0,0,0,0,0,0,0,0,0,0,8,252,255,255,192,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,0,46,255,255,255,156,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,145,255,255,255,
-  234,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,212,255,255,168,0,0,0,0,0,0,0,0,0,201,255,255,174,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,255,
-  252,0,180,255,255,255,16,0,4,208,255,255,255,106,0,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,101,255,255,255,120,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,107,255,255,255,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,215,255,255,236,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,0,108,255,255,255,115,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,115,255,255,255,246,
-  55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,113,255,255,249,19,0,0,0,0,0,0,0,45,255,255,255,74,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,60,60,47,0,0,0,0,0,0,0,0,0,0,211,255,255,
-  246,0,180,255,255,255,16,0,0,52,252,255,255,241,27,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,7,215,255,255,255,50,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,142,255,255,255,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,
-  14,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,10,222,255,255,255,41,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,86,254,255,255,255,84,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,19,249,255,255,113,0,0,0,0,0,0,0,146,255,255,227,2,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,234,255,255,213,0,0,0,0,0,0,0,0,0,0,231,255,255,
-  226,0,180,255,255,255,16,0,0,0,141,255,255,255,177,0,0,0,0,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,9,171,255,255,255,195,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,160,255,255,255,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,167,255,255,255,
-  30,0,184,255,255,255,12,0,0,0,0,0,0,0,0,14,183,255,255,255,179,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,73,248,255,255,255,255,138,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,169,255,255,213,0,0,0,0,0,0,8,238,255,255,131,0,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,209,255,255,248,8,0,0,0,0,0,0,0,0,31,255,255,255,
-  190,0,180,255,255,255,16,0,0,0,10,222,255,255,255,85,0,0,0,0,148,255,255,255,40,0,180,255,255,255,15,4,
-  4,4,4,4,4,15,45,112,221,255,255,255,247,52,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,170,255,255,255,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,255,255,255,
-  41,0,184,255,255,255,12,0,0,0,0,0,11,44,116,227,255,255,255,234,31,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,242,255,255,255,255,255,254,
-  74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,69,255,255,255,59,0,0,0,0,0,92,255,255,254,32,0,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,255,255,255,94,0,0,0,0,0,0,0,0,138,255,255,255,
-  122,0,180,255,255,255,16,0,0,0,0,69,255,255,255,231,17,0,0,0,148,255,255,255,40,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,248,83,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,172,255,255,255,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,255,255,255,
-  44,0,184,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,231,50,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,255,255,255,202,255,255,255,
-  236,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,1,223,255,255,159,0,0,0,0,0,192,255,255,187,0,0,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,59,255,255,255,234,37,0,0,0,0,0,0,77,252,255,255,247,
-  26,0,180,255,255,255,16,0,0,0,0,0,160,255,255,255,157,0,0,0,148,255,255,255,40,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,200,46,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,171,255,255,255,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,255,255,255,
-  41,0,184,255,255,255,255,255,255,255,255,255,255,255,255,255,252,162,22,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,255,255,150,2,184,255,255,
-  255,195,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,125,255,255,245,14,0,0,0,37,255,255,255,87,0,0,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,177,255,255,255,239,124,45,13,14,55,152,252,255,255,255,127,
-  0,0,180,255,255,255,16,0,0,0,0,0,18,233,255,255,255,65,0,0,148,255,255,255,40,0,180,255,255,255,255,255,
-  255,255,255,255,255,244,228,192,137,55,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,162,255,255,255,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,255,255,255,
-  31,0,184,255,255,255,255,255,255,255,255,255,255,255,255,255,118,0,0,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,255,163,1,0,21,229,255,
-  255,255,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,28,253,255,255,104,0,0,0,137,255,255,236,6,0,0,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,211,255,255,255,255,255,255,255,255,255,255,255,255,168,1,
-  0,0,180,255,255,255,16,0,0,0,0,0,0,88,255,255,255,219,8,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,148,255,255,255,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,177,255,255,255,
-  15,0,184,255,255,255,15,4,4,4,4,4,21,241,255,255,225,7,0,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,176,4,0,0,0,62,252,
-  255,255,254,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,0,182,255,255,205,0,0,5,233,255,255,144,0,0,0,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,160,254,255,255,255,255,255,255,255,255,244,119,1,0,
-  0,0,180,255,255,255,16,0,0,0,0,0,0,0,180,255,255,255,136,0,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,115,255,255,255,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,206,255,255,238,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,129,255,255,255,111,0,0,0,0,0,0,0,0,180,255,255,255,16,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,16,0,0,0,0,0,124,
-  255,255,255,233,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,0,82,255,255,255,50,0,83,255,255,255,44,0,0,0,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,131,192,231,248,246,227,183,116,19,0,0,0,
-  0,0,180,255,255,255,16,0,0,0,0,0,0,0,29,242,255,255,251,48,148,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,156,255,255,255,40,0,71,255,255,255,133,0,0,0,0,0,0,0,0,0,0,0,0,0,4,248,255,255,195,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,15,238,255,255,232,11,0,0,0,0,0,0,0,180,255,255,255,19,4,
-  4,4,4,4,4,4,4,4,4,4,4,2,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,2,
-  186,255,255,255,190,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,0,5,232,255,255,150,0,183,255,255,200,0,0,0,0,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,180,255,255,255,16,0,0,0,0,0,0,0,0,108,255,255,255,203,151,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,12,250,255,255,209,0,0,0,0,0,0,0,0,0,0,0,0,0,62,255,255,255,131,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,121,255,255,255,122,0,0,0,0,0,0,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,140,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  22,230,255,255,255,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,0,0,138,255,255,240,40,253,255,255,100,0,0,0,0,0,0,252,255,255,152,0,0,
-  0,0,0,0,0,39,129,187,227,244,250,235,199,141,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,180,255,255,255,16,0,0,0,0,0,0,0,0,2,197,255,255,255,239,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,68,152,206,238,251,240,213,163,84,
-  7,0,0,0,0,0,0,0,0,0,181,255,255,255,48,0,0,0,0,0,0,0,0,0,0,0,0,153,255,255,255,52,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,11,233,255,255,239,16,0,0,0,0,0,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,140,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,65,253,255,255,253,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,0,0,38,255,255,255,212,255,255,243,12,0,0,0,0,0,0,252,255,255,152,0,0,
-  0,0,0,28,177,254,255,255,255,255,255,255,255,255,255,200,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,180,255,255,255,16,0,0,0,0,0,0,0,0,0,41,249,255,255,255,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,209,255,255,255,255,255,255,255,255,255,
-  228,96,0,0,0,0,0,0,0,0,77,255,255,255,186,0,0,0,0,0,0,0,0,0,0,0,35,248,255,255,208,0,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,113,255,255,255,134,0,0,0,0,0,0,180,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,140,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,0,127,255,255,255,231,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,0,0,0,194,255,255,255,255,255,157,0,0,0,0,0,0,0,252,255,255,152,0,0,
-  0,0,58,239,255,255,255,255,255,255,255,255,255,255,255,255,251,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,180,255,255,255,16,0,0,0,0,0,0,0,0,0,0,127,255,255,255,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,254,255,255,255,255,255,255,255,255,255,255,
-  255,255,168,7,0,0,0,0,0,0,0,200,255,255,255,109,0,0,0,0,0,0,0,0,0,7,191,255,255,255,79,0,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,8,229,255,255,244,23,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,0,2,189,255,255,255,186,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,0,0,0,94,255,255,255,255,255,57,0,0,0,0,0,0,0,252,255,255,152,0,0,
-  0,41,243,255,255,255,205,100,40,14,10,31,83,177,255,255,255,255,93,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,180,255,255,255,16,0,0,0,0,0,0,0,0,0,0,6,213,255,255,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,255,255,255,254,168,77,31,10,29,71,157,251,
-  255,255,255,180,3,0,0,0,0,0,0,48,248,255,255,253,113,1,0,0,0,0,0,0,19,180,255,255,255,178,0,0,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,106,255,255,255,145,0,0,0,12,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,255,244,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,0,0,24,233,255,255,255,123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,0,0,0,9,240,255,255,255,212,0,0,0,0,0,0,0,0,252,255,255,152,0,0,
-  0,194,255,255,255,136,2,0,0,0,0,0,0,0,79,248,255,255,244,25,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,180,255,255,255,16,0,0,0,0,0,0,0,0,0,0,0,57,253,255,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,255,255,255,235,63,0,0,0,0,0,0,0,47,
-  220,255,255,255,128,0,0,0,0,0,0,0,94,254,255,255,255,201,100,37,12,20,53,130,234,255,255,255,216,19,0,0,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,6,224,255,255,248,30,0,0,12,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,255,244,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,0,0,0,68,253,255,255,252,61,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,0,0,0,0,150,255,255,255,113,0,0,0,0,0,0,0,0,252,255,255,152,0,0,
-  43,255,255,255,194,0,0,0,0,0,0,0,0,0,0,106,255,255,255,142,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,180,255,255,255,16,0,0,0,0,0,0,0,0,0,0,0,0,147,255,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,230,255,255,244,50,0,0,0,0,0,0,0,0,0,
-  33,232,255,255,250,36,0,0,0,0,0,0,0,93,247,255,255,255,255,255,255,255,255,255,255,255,255,206,26,0,0,0,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,0,98,255,255,255,157,0,0,12,255,255,255,255,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,255,244,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,0,0,0,0,131,255,255,255,228,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,180,255,255,220,0,0,0,0,0,0,0,0,50,255,255,249,20,0,0,0,0,0,0,0,0,252,255,255,152,0,0,
-  107,255,255,255,99,0,0,0,0,0,0,0,0,0,0,3,235,255,255,229,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,180,255,255,255,16,0,0,0,0,0,0,0,0,0,0,0,0,12,225,255,255,255,40,0,180,255,255,255,12,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,255,255,255,119,0,0,0,0,0,0,0,0,0,0,
-  0,92,255,255,255,161,0,0,0,0,0,0,0,0,43,188,255,255,255,255,255,255,255,255,255,245,132,7,0,0,0,0,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,0,3,218,255,255,252,38,0,0,4,4,4,4,4,4,4,
-  4,4,236,255,255,208,4,4,4,4,4,4,4,4,3,0,0,0,0,0,0,180,255,255,255,12,0,0,0,0,0,0,
-  0,0,0,0,0,3,192,255,255,255,182,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  132,255,255,255,70,0,0,0,0,0,0,0,0,0,0,0,177,255,255,255,22,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,216,255,255,234,6,0,0,0,0,0,0,0,0,0,0,
-  0,1,213,255,255,246,15,0,0,0,0,0,0,0,0,0,51,139,198,235,251,245,223,176,106,20,0,0,0,0,0,0,
-  0,0,184,255,255,255,12,0,0,0,0,0,0,0,0,0,0,0,90,255,255,255,169,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,92,255,255,255,239,22,0,0,0,0,0,0,0,0,0,0,0,10,223,255,255,255,128,0,0,0,0,0,0,0,0,
-  120,255,255,255,99,0,0,0,0,0,0,0,0,0,0,0,81,132,132,132,20,0,70,255,255,255,203,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,83,255,255,255,193,0,111,255,255,255,213,2,0,0,0,0,0,0,0,0,0,0,
-  0,0,3,217,255,255,255,98,0,0,0,0,0,0,0,0,45,255,255,255,146,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,123,255,255,255,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,20,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,192,0,0,0,0,
-  0,0,187,255,255,255,164,0,0,0,0,0,0,0,0,0,0,0,135,255,255,255,216,7,0,0,0,0,0,0,0,0,
-  73,255,255,255,206,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,230,255,255,255,33,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,170,255,255,255,99,0,6,223,255,255,255,89,0,0,0,0,0,0,0,0,0,0,
-  0,0,96,255,255,255,212,3,0,0,0,0,0,0,0,0,109,255,255,255,77,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,52,255,255,255,151,0,0,178,255,255,253,15,0,0,0,0,0,0,0,0,0,0,188,255,255,182,0,0,0,0,
-  0,0,0,0,0,0,64,255,255,255,129,0,0,4,4,4,4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,20,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,192,0,0,0,0,
-  0,0,36,247,255,255,255,65,0,0,0,0,0,0,0,0,0,41,250,255,255,255,64,0,0,0,0,0,0,0,0,0,
-  7,230,255,255,255,173,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,255,255,255,119,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,11,245,255,255,247,15,0,0,92,255,255,255,215,3,0,0,0,0,0,0,0,0,0,
-  0,4,221,255,255,255,78,0,0,0,0,0,0,0,0,0,155,255,255,255,28,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,9,253,255,255,196,0,0,117,255,255,255,71,0,0,0,0,0,0,0,0,0,10,248,255,255,244,6,0,0,0,
-  0,0,0,0,0,0,121,255,255,255,68,0,40,255,255,255,255,255,255,255,56,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,20,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,183,0,0,0,0,
-  0,0,0,123,255,255,255,216,6,0,0,0,0,0,0,0,0,191,255,255,255,160,0,0,0,0,0,0,0,0,0,0,
-  0,89,255,255,255,255,230,112,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,255,255,255,206,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,88,255,255,255,169,0,0,0,1,208,255,255,255,92,0,0,0,0,0,0,0,0,0,
-  0,100,255,255,255,195,0,0,0,0,0,0,0,0,0,0,190,255,255,252,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,228,255,255,230,0,0,56,255,255,255,129,0,0,0,0,0,0,0,0,0,74,255,255,255,255,65,0,0,0,
-  0,0,0,0,0,0,178,255,255,251,11,0,40,255,255,255,255,255,255,255,56,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,36,244,255,255,252,55,0,0,0,0,
-  0,0,0,5,213,255,255,255,125,0,0,0,0,0,0,0,93,255,255,255,236,20,0,0,0,0,0,0,0,0,0,0,
-  0,0,123,255,255,255,255,255,247,172,94,19,0,0,0,0,0,0,0,0,0,0,0,0,210,255,255,255,36,0,0,0,
-  0,0,0,0,0,0,0,0,0,175,255,255,255,76,0,0,0,0,72,255,255,255,217,3,0,0,0,0,0,0,0,0,
-  5,224,255,255,255,58,0,0,0,0,0,0,0,0,0,0,208,255,255,239,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,214,255,255,246,0,0,5,246,255,255,187,0,0,0,0,0,0,0,0,0,145,255,255,255,255,134,0,0,0,
-  0,0,0,0,0,0,234,255,255,202,0,0,40,255,255,255,255,255,255,255,56,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,190,255,255,255,136,0,0,0,0,0,
-  0,0,0,0,60,254,255,255,247,35,0,0,0,0,0,16,232,255,255,255,96,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,80,231,255,255,255,255,255,255,252,192,101,13,0,0,0,0,0,0,0,0,0,117,255,255,255,123,0,0,0,
-  0,0,0,0,0,0,0,0,13,247,255,255,234,4,0,0,0,0,0,190,255,255,255,95,0,0,0,0,0,0,0,0,
-  104,255,255,255,176,0,0,0,0,0,0,0,0,0,0,0,218,255,255,228,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,202,255,255,255,2,0,0,191,255,255,242,2,0,0,0,0,0,0,0,0,216,255,255,255,255,203,0,0,0,
-  0,0,0,0,0,36,255,255,255,141,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,255,255,255,212,7,0,0,0,0,0,
-  0,0,0,0,0,155,255,255,255,183,0,0,0,0,0,150,255,255,255,191,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,12,125,231,255,255,255,255,255,255,255,241,134,15,0,0,0,0,0,0,0,27,253,255,255,209,0,0,0,
-  0,0,0,0,0,0,0,0,92,255,255,255,146,0,0,0,0,0,0,53,254,255,255,220,4,0,0,0,0,0,0,7,
-  227,255,255,252,41,0,0,0,0,0,0,0,0,0,0,0,220,255,255,228,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,200,255,255,255,4,0,0,130,255,255,255,47,0,0,0,0,0,0,0,31,255,255,254,251,255,253,19,0,0,
-  0,0,0,0,0,93,255,255,255,81,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,244,255,255,251,52,0,0,0,0,0,0,
-  0,0,0,0,0,17,233,255,255,255,85,0,0,0,52,253,255,255,248,39,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,5,85,171,244,255,255,255,255,255,255,229,67,0,0,0,0,0,0,0,187,255,255,255,40,0,0,
-  0,0,0,0,0,0,0,0,179,255,255,255,53,0,0,0,0,0,0,0,170,255,255,255,97,0,0,0,0,0,0,109,
-  255,255,255,156,0,0,0,0,0,0,0,0,0,0,0,0,219,255,255,230,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,200,255,255,255,2,0,0,70,255,255,255,105,0,0,0,0,0,0,0,103,255,255,215,210,255,255,86,0,0,
-  0,0,0,0,0,150,255,255,255,21,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,1,193,255,255,255,132,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,90,255,255,255,229,13,0,2,204,255,255,255,128,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,9,79,162,244,255,255,255,255,251,85,0,0,0,0,0,0,94,255,255,255,126,0,0,
-  0,0,0,0,0,0,0,16,249,255,255,216,0,0,0,0,0,0,0,0,37,251,255,255,221,4,0,0,0,0,8,230,
-  255,255,246,27,0,0,0,0,0,0,0,0,0,0,0,0,210,255,255,242,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,212,255,255,248,0,0,0,13,252,255,255,163,0,0,0,0,0,0,0,174,255,255,163,159,255,255,156,0,0,
-  0,0,0,0,0,207,255,255,215,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,110,255,255,255,210,6,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,185,255,255,255,145,0,107,255,255,255,216,7,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,12,113,233,255,255,255,246,37,0,0,0,0,0,12,245,255,255,213,0,0,
-  0,0,0,0,0,0,0,97,255,255,255,123,0,0,0,0,0,0,0,0,0,150,255,255,255,100,0,0,0,0,113,255,
-  255,255,135,0,0,0,0,0,0,0,0,0,0,0,0,0,196,255,255,254,3,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,225,255,255,234,0,0,0,0,204,255,255,221,0,0,0,0,0,0,4,241,255,255,97,96,255,255,225,0,0,
-  0,0,0,0,11,252,255,255,154,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,36,245,255,255,251,49,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,34,246,255,255,252,73,240,255,255,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,194,255,255,255,152,0,0,0,0,0,0,164,255,255,255,43,0,
-  0,0,0,0,0,0,0,183,255,255,254,31,0,0,0,0,0,0,0,0,0,24,244,255,255,224,5,0,0,10,232,255,
-  255,237,15,0,0,0,0,0,0,0,0,0,0,0,0,0,163,255,255,255,39,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,5,249,255,255,202,0,0,0,0,144,255,255,255,23,0,0,0,0,0,60,255,255,254,25,26,255,255,255,38,0,
-  0,0,0,0,64,255,255,255,93,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,2,195,255,255,255,129,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,121,255,255,255,252,255,255,255,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,242,255,255,244,2,0,0,0,0,0,71,255,255,255,129,0,
-  0,0,0,0,0,0,19,251,255,255,192,0,0,0,0,0,0,0,0,0,0,0,131,255,255,255,103,0,0,118,255,255,
-  255,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,119,255,255,255,87,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,45,255,255,255,161,0,0,0,0,83,255,255,255,81,0,0,0,0,0,131,255,255,206,0,0,210,255,255,108,0,
-  0,0,0,0,121,255,255,255,32,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,114,255,255,255,207,5,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,5,211,255,255,255,255,255,236,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,
-  144,144,144,50,0,0,0,0,0,0,0,0,0,0,0,0,172,255,255,255,27,0,0,0,0,0,3,231,255,255,215,0,
-  0,0,0,0,0,0,101,255,255,255,99,0,0,0,0,0,0,0,0,0,0,0,14,235,255,255,225,6,12,235,255,255,
-  225,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,255,255,255,164,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,110,255,255,255,101,0,0,0,0,23,255,255,255,139,0,0,0,0,0,202,255,255,132,0,0,139,255,255,177,0,
-  0,0,0,0,178,255,255,228,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,0,0,38,246,255,255,250,47,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,58,254,255,255,255,255,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,
-  255,255,255,113,0,0,0,0,0,0,0,0,0,0,0,0,146,255,255,255,48,0,0,0,0,0,0,141,255,255,255,46,
-  0,0,0,0,0,0,188,255,255,247,15,0,0,0,0,0,0,0,0,0,0,0,0,111,255,255,255,106,122,255,255,255,
-  95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,226,255,255,243,14,0,0,0,0,0,0,0,0,0,0,
-  0,0,201,255,255,252,25,0,0,0,0,0,218,255,255,197,0,0,0,0,20,253,255,255,59,0,0,68,255,255,242,4,
-  0,0,0,0,234,255,255,167,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,0,2,198,255,255,255,125,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,213,255,255,255,243,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,
-  255,255,255,187,0,0,0,0,0,0,0,0,0,0,0,0,174,255,255,255,26,0,0,0,0,0,0,48,255,255,255,133,
-  0,0,0,0,0,22,252,255,255,169,0,0,0,0,0,0,0,0,0,0,0,0,0,6,222,255,255,228,237,255,255,210,
-  2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,255,255,255,138,0,0,0,0,0,0,0,0,0,0,
-  0,75,255,255,255,180,0,0,0,0,0,0,157,255,255,248,6,0,0,0,89,255,255,237,3,0,0,7,245,255,255,60,
-  0,0,0,36,255,255,255,106,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,0,117,255,255,255,204,4,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,98,255,255,255,255,255,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  203,255,255,255,76,0,0,0,0,0,0,0,0,0,0,25,244,255,255,226,1,0,0,0,0,0,0,0,211,255,255,219,
-  0,0,0,0,0,105,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,255,255,255,255,255,255,75,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,235,255,255,250,65,0,0,0,0,0,0,0,0,0,
-  23,223,255,255,255,54,0,0,0,0,0,0,96,255,255,255,57,0,0,0,160,255,255,167,0,0,0,0,182,255,255,129,
-  0,0,0,93,255,255,255,45,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,0,41,247,255,255,249,44,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,21,237,255,255,255,255,255,251,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  66,255,255,255,245,86,0,0,0,0,0,0,0,0,19,197,255,255,255,129,0,0,0,0,0,0,0,0,118,255,255,255,
-  50,0,0,0,0,192,255,255,234,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,207,255,255,255,255,193,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,255,255,255,241,76,0,0,0,0,0,0,0,37,
-  210,255,255,255,152,0,0,0,0,0,0,0,35,255,255,255,115,0,0,0,230,255,255,94,0,0,0,0,111,255,255,199,
-  0,0,0,150,255,255,238,1,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,3,200,255,255,255,122,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,164,255,255,255,240,255,255,255,199,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,127,255,255,255,255,195,101,44,16,7,21,59,131,235,255,255,255,216,9,0,0,0,0,0,0,0,0,27,253,255,255,
-  136,0,0,0,25,253,255,255,146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,255,255,255,255,55,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,141,255,255,255,255,177,83,32,10,25,64,147,247,
-  255,255,255,202,11,0,0,0,0,0,0,0,0,230,255,255,173,0,0,46,255,255,254,22,0,0,0,0,40,255,255,252,
-  15,0,0,207,255,255,179,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,0,120,255,255,255,202,3,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,70,255,255,255,244,41,225,255,255,255,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,116,250,255,255,255,255,255,255,255,255,255,255,255,255,255,216,28,0,0,0,0,0,0,0,0,0,0,188,255,255,
-  222,0,0,0,110,255,255,255,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,234,255,255,218,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,133,254,255,255,255,255,255,255,255,255,255,255,
-  255,255,195,19,0,0,0,0,0,0,0,0,0,170,255,255,230,0,0,117,255,255,202,0,0,0,0,0,0,225,255,255,
-  81,0,11,252,255,255,119,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,64,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,
-  0,116,255,255,255,76,0,0,0,0,0,0,43,248,255,255,248,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,9,221,255,255,255,115,0,77,255,255,255,241,27,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,47,182,255,255,255,255,255,255,255,255,255,255,248,141,11,0,0,0,0,0,0,0,0,0,0,0,95,255,255,
-  255,53,0,0,196,255,255,215,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,255,255,216,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,211,255,255,255,255,255,255,255,255,255,
-  255,255,124,1,0,0,0,0,0,0,0,0,0,109,255,255,255,33,0,189,255,255,129,0,0,0,0,0,0,154,255,255,
-  151,0,64,255,255,255,58,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,61,255,255,255,114,0,0,0,0,0,0,0,0,0,0,0,
-  0,119,255,255,255,73,0,0,0,0,0,4,203,255,255,255,118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,137,255,255,255,208,4,0,0,175,255,255,255,174,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,36,120,182,224,247,252,238,216,169,107,18,0,0,0,0,0,0,0,0,0,0,0,0,0,12,245,255,
-  255,139,0,28,254,255,255,122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,255,255,216,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,69,152,207,239,252,242,214,192,255,
-  255,255,255,176,15,0,0,0,0,0,0,0,0,49,255,255,255,90,11,249,255,255,55,0,0,0,0,0,0,83,255,255,
-  220,0,121,255,255,247,6,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,43,255,255,255,131,0,0,0,0,0,0,0,0,0,0,0,
-  0,135,255,255,255,54,0,0,0,0,0,123,255,255,255,199,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,46,251,255,255,253,54,0,0,0,29,243,255,255,255,79,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,165,255,
-  255,224,0,114,255,255,254,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,255,255,216,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,
-  250,255,255,255,219,47,0,0,0,0,0,0,0,2,241,255,255,135,71,255,255,235,2,0,0,0,0,0,0,16,252,255,
-  255,30,167,255,255,192,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,18,255,255,255,176,0,0,0,0,0,0,0,0,0,0,0,
-  0,179,255,255,255,25,0,0,0,0,45,249,255,255,246,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,2,200,255,255,255,149,0,0,0,0,0,114,255,255,255,227,13,0,0,0,0,0,16,247,255,255,104,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,3,4,4,4,4,4,4,2,0,0,0,0,0,0,0,0,0,0,72,255,
-  255,255,56,201,255,255,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,255,255,216,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  62,234,255,255,255,246,95,0,0,0,0,0,0,0,183,255,255,171,131,255,255,164,0,0,0,0,0,0,0,0,197,255,
-  255,87,207,255,255,131,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,0,211,255,255,242,15,0,0,0,0,0,0,0,0,0,0,
-  16,243,255,255,216,0,0,0,0,4,206,255,255,255,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,109,255,255,255,231,15,0,0,0,0,0,3,208,255,255,255,145,0,0,0,0,0,0,167,255,255,200,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,212,255,255,255,255,255,255,140,0,0,0,0,0,0,0,0,0,0,3,231,
-  255,255,175,255,255,255,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,255,255,216,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,30,206,255,255,255,167,2,0,0,0,0,0,0,123,255,255,208,190,255,255,90,0,0,0,0,0,0,0,0,126,255,
-  255,146,245,255,255,70,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,236,255,255,208,0,0,0,0,0,0,0,0,0,0,0,128,255,255,255,141,0,0,0,0,0,0,0,0,0,0,
-  140,255,255,255,126,0,0,0,0,127,255,255,255,196,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,28,242,255,255,255,87,0,0,0,0,0,0,0,55,253,255,255,253,53,0,0,0,0,0,71,255,255,255,41,
-  0,0,0,0,0,0,0,0,0,0,0,0,212,255,255,255,255,255,255,140,0,0,0,0,0,0,0,0,0,0,0,142,
-  255,255,255,255,255,247,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,255,255,216,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,9,167,255,153,2,0,0,0,0,0,0,0,62,255,255,244,244,255,253,19,0,0,0,0,0,0,0,0,55,255,
-  255,229,255,255,252,13,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,238,255,255,255,115,0,0,0,0,0,0,0,0,112,
-  254,255,255,236,15,0,0,0,47,250,255,255,245,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,175,255,255,255,184,0,0,0,0,0,0,0,0,0,151,255,255,255,207,4,0,0,0,0,2,227,255,255,137,
-  0,0,0,0,0,0,0,0,0,0,0,0,212,255,255,255,255,255,255,140,0,0,0,0,0,0,0,0,0,0,0,49,
-  255,255,255,255,255,169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,255,255,216,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,72,0,0,0,0,0,0,0,0,0,8,249,255,255,255,255,199,0,0,0,0,0,0,0,0,0,2,237,
-  255,255,255,255,205,0,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,3,125,128,86,0,
-  0,0,0,0,0,0,120,255,255,255,198,2,0,0,0,0,0,0,83,254,255,255,255,199,96,36,12,13,37,95,197,255,
-  255,255,253,71,0,0,0,5,208,255,255,255,114,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,1,0,0,0,
-  0,0,81,255,255,255,246,34,0,0,0,0,0,0,0,0,0,16,232,255,255,255,116,0,0,0,0,0,134,255,255,230,
-  3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,0,0,0,0,0,0,0,0,0,0,
-  212,255,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,255,255,216,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,197,255,255,255,255,125,0,0,0,0,0,0,0,0,0,0,169,
-  255,255,255,255,144,0,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,79,255,255,239,9,
-  0,0,0,0,0,0,0,161,255,255,255,107,0,0,0,0,0,0,0,101,250,255,255,255,255,255,255,255,255,255,255,255,
-  255,247,89,0,0,0,0,79,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,96,0,0,0,
-  0,13,228,255,255,255,122,0,0,0,0,0,0,0,0,0,0,0,90,255,255,255,245,32,0,0,0,0,38,255,255,255,
-  74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,0,0,0,0,0,0,0,0,0,0,
-  119,255,255,255,234,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,255,255,216,0,0,
-  0,0,0,0,0,0,0,0,0,3,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,3,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,255,255,255,255,51,0,0,0,0,0,0,0,0,0,0,98,
-  255,255,255,255,83,0,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,0,182,255,255,255,96,
-  0,0,0,0,0,0,0,6,195,255,255,241,27,0,0,0,0,0,0,0,52,201,255,255,255,255,255,255,255,255,255,255,
-  193,49,0,0,0,0,0,84,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,96,0,0,0,
-  0,147,255,255,255,213,5,0,0,0,0,0,0,0,0,0,0,0,0,187,255,255,255,182,0,0,0,0,0,197,255,255,
-  171,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,0,0,0,0,0,0,0,0,0,0,
-  28,253,255,255,146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,255,255,216,0,0,
-  0,0,0,0,0,0,0,0,0,236,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,248,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,255,255,255,232,1,0,0,0,0,0,0,0,0,0,0,28,
-  255,255,255,255,23,0,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,32,253,255,255,255,199,
-  0,0,0,0,0,0,0,0,20,221,255,255,175,0,0,0,0,0,0,0,0,0,60,138,198,230,247,255,237,200,140,57,
-  0,0,0,0,0,0,0,84,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,96,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,255,255,
-  248,18,0,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,236,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,248,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,253,255,255,160,0,0,0,0,0,0,0,0,0,0,0,0,
-  212,255,255,218,0,0,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,0,133,255,255,255,255,255,
-  46,0,0,0,0,0,0,0,0,42,241,255,255,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,0,14,245,255,
-  255,108,0,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,0,0,0,24,107,182,221,244,246,227,
-  180,107,12,0,0,0,0,0,0,0,0,0,0,1,78,164,217,244,249,229,183,111,13,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,236,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,248,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,4,231,255,255,217,255,255,
-  148,0,0,0,0,0,0,0,0,0,71,252,255,228,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,0,0,0,0,0,51,150,214,245,245,222,173,94,5,0,0,0,0,0,0,131,239,227,83,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,0,0,163,255,
-  255,204,0,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,0,8,132,246,255,255,255,255,255,255,
-  255,255,234,78,0,0,0,0,0,0,0,0,48,208,255,255,255,255,255,255,255,255,238,88,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,127,205,237,247,225,177,94,3,0,156,255,255,188,0,0,0,
-  0,0,11,180,245,204,37,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,83,255,255,226,63,255,255,
-  240,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,0,0,0,16,166,255,255,255,255,255,255,255,255,216,55,0,0,0,0,38,255,255,255,236,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,0,0,67,255,
-  255,255,45,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,12,191,255,255,255,255,255,255,255,255,
-  255,255,255,253,80,0,0,0,0,0,0,70,247,255,255,255,255,255,255,255,255,255,255,255,121,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,68,3,102,191,235,254,244,0,0,0,0,0,0,
-  0,0,29,138,208,242,254,238,170,0,0,0,0,0,100,242,255,255,255,255,255,255,255,210,42,173,255,255,188,0,0,0,
-  0,0,106,255,255,255,165,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,0,186,255,255,129,0,217,255,
-  255,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,0,0,28,219,255,255,255,255,255,255,255,255,255,255,244,63,0,0,0,40,255,255,255,238,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,0,0,1,224,
-  255,255,141,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,171,255,255,255,220,109,42,13,17,59,
-  160,255,255,255,235,14,0,0,0,0,40,243,255,255,255,173,68,21,11,48,142,251,255,255,255,76,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,87,202,255,255,255,255,244,0,0,0,0,0,0,
-  0,88,246,255,255,255,255,255,220,0,0,0,0,111,255,255,255,255,255,255,255,255,255,255,234,219,255,255,188,0,0,0,
-  0,0,108,255,255,255,167,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,35,254,255,254,32,0,119,255,
-  255,200,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,0,9,211,255,255,255,187,71,18,13,53,152,254,255,255,230,17,0,0,0,137,240,230,88,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,0,0,0,130,
-  255,255,233,4,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,46,255,255,255,190,9,0,0,0,0,0,
-  0,122,255,255,255,102,0,0,0,0,192,255,255,255,105,0,0,0,0,0,0,66,248,255,255,218,1,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,238,255,255,255,255,255,244,0,0,0,0,0,0,
-  65,252,255,255,255,255,255,255,220,0,0,0,55,253,255,255,255,185,72,21,16,52,144,247,255,255,255,255,188,0,0,0,
-  0,0,13,184,246,207,41,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,0,137,255,255,187,0,0,24,251,
-  255,255,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,0,139,255,255,255,135,0,0,0,0,0,0,93,255,255,255,140,0,0,0,0,0,0,0,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,0,0,0,34,
-  254,255,255,78,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,91,224,224,224,59,0,0,0,0,0,0,
-  0,4,239,255,255,165,0,0,0,60,255,255,255,158,0,0,0,0,0,0,0,0,120,255,255,255,53,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,255,255,175,68,25,11,29,0,0,0,0,0,0,
-  207,255,255,255,189,59,15,15,30,0,0,0,206,255,255,255,138,0,0,0,0,0,0,56,236,255,255,255,188,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,6,234,255,255,88,0,0,0,177,
-  255,255,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,24,249,255,255,184,0,0,0,0,0,0,0,0,168,255,255,236,7,0,0,0,0,0,0,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  193,255,255,175,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,204,255,255,191,0,0,0,155,255,255,254,30,0,0,0,0,0,0,0,0,17,251,255,255,107,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,255,118,0,0,0,0,0,0,0,0,0,0,43,
-  255,255,255,200,1,0,0,0,0,0,0,58,255,255,255,196,0,0,0,0,0,0,0,0,79,255,255,255,188,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,40,255,255,255,124,0,0,0,0,0,0,87,255,255,237,7,0,0,0,78,
-  255,255,241,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,121,255,255,255,51,0,0,0,0,0,0,0,0,65,255,255,255,66,0,0,0,0,0,0,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  96,255,255,250,21,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,200,255,255,200,0,0,0,223,255,255,200,0,0,0,0,0,0,0,0,0,0,152,176,176,87,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,188,0,0,0,0,0,0,0,0,0,0,0,96,
-  255,255,255,84,0,0,0,0,0,0,0,146,255,255,255,70,0,0,0,0,0,0,0,0,0,232,255,255,188,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,40,255,255,255,126,4,4,4,0,0,0,190,255,255,146,0,0,0,0,4,
-  231,255,255,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,197,255,255,219,0,0,0,0,0,0,0,0,0,12,255,255,255,119,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  12,244,255,255,112,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,0,0,0,26,114,173,218,238,252,255,
-  255,255,255,255,255,200,0,0,13,255,255,255,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,90,0,0,0,0,0,0,0,0,0,0,0,116,
-  255,255,255,45,0,0,0,0,0,0,0,202,255,255,238,4,0,0,0,0,0,0,0,0,0,232,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,40,255,255,255,255,255,255,255,56,0,38,255,255,255,47,0,0,0,0,0,
-  136,255,255,201,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,2,247,255,255,164,4,4,4,4,4,4,4,4,4,4,248,255,255,156,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,88,0,28,128,202,235,249,226,181,94,4,0,0,0,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,159,255,255,208,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,0,17,152,253,255,255,255,255,255,255,
-  255,255,255,255,255,200,0,0,39,255,255,255,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,248,255,255,190,0,0,0,0,0,0,0,0,0,0,232,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,40,255,255,255,255,255,255,255,56,0,140,255,255,205,0,0,0,0,0,0,
-  38,255,255,255,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,125,204,236,247,225,174,89,2,0,236,
-  255,255,176,0,28,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,172,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,88,106,244,255,255,255,255,255,255,255,206,39,0,0,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,63,255,255,255,49,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,0,26,216,255,255,255,255,255,255,255,255,
-  255,255,255,255,255,200,0,0,50,255,255,255,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,12,255,255,255,154,0,0,0,0,0,0,0,0,0,0,232,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,40,255,255,255,255,255,255,255,56,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,93,240,255,255,255,255,255,255,255,206,33,236,
-  255,255,176,0,42,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,186,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,196,255,255,255,255,255,255,255,255,255,255,228,32,0,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,1,221,255,255,145,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,1,197,255,255,255,240,143,73,33,14,4,
-  4,4,200,255,255,200,0,0,46,255,255,255,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,8,101,184,227,249,238,201,127,17,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,212,255,255,255,
-  255,255,255,255,255,255,255,164,0,0,26,255,255,255,140,0,0,0,0,0,0,0,0,0,0,232,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,255,255,255,255,255,255,255,255,255,255,230,246,
-  255,255,176,0,46,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,188,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,255,255,211,96,36,11,32,104,229,255,255,255,195,1,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,126,255,255,235,5,0,0,0,0,0,0,0,0,16,255,255,255,140,0,80,255,255,255,200,21,0,0,0,0,0,
-  0,0,200,255,255,200,0,0,30,255,255,255,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,61,220,255,255,255,255,255,255,255,235,57,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,212,255,255,255,
-  255,255,255,255,255,255,255,164,0,0,22,255,255,255,136,0,0,0,0,0,0,0,0,0,0,232,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,252,255,255,255,179,69,20,17,52,142,247,255,255,
-  255,255,176,0,30,255,255,255,129,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,255,172,7,0,0,0,0,0,19,214,255,255,255,88,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,31,254,255,255,82,0,0,0,0,0,0,0,0,16,255,255,255,140,0,163,255,255,252,31,0,0,0,0,0,0,
-  0,0,200,255,255,200,0,0,10,254,255,255,146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  157,247,255,255,255,255,255,255,255,255,255,236,23,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,212,255,255,255,
-  255,255,255,255,255,255,255,164,0,0,8,255,255,255,148,0,0,0,0,0,0,0,0,0,0,232,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,200,255,255,255,126,0,0,0,0,0,0,54,235,255,
-  255,255,176,0,10,255,255,255,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,218,7,0,0,0,0,0,0,0,46,253,255,255,191,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,189,255,255,179,0,0,0,0,0,0,0,0,16,255,255,255,140,0,203,255,255,206,0,0,0,0,0,0,0,
-  0,0,200,255,255,200,0,0,0,214,255,255,197,0,0,0,0,0,0,0,0,0,0,26,32,32,17,0,68,255,255,255,
-  255,255,231,113,42,11,27,95,227,255,255,255,142,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,3,4,4,126,
-  255,255,255,35,4,4,4,2,0,0,0,239,255,255,180,0,0,0,0,0,0,0,0,0,0,232,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,255,255,255,185,0,0,0,0,0,0,0,0,78,255,
-  255,255,176,0,0,218,255,255,212,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,99,0,0,0,0,0,0,0,0,0,175,255,255,254,23,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,92,255,255,251,23,0,0,0,0,0,0,0,16,255,255,255,140,0,217,255,255,195,0,0,0,0,0,0,0,
-  0,0,211,255,255,200,0,0,0,153,255,255,253,27,0,0,0,0,0,0,0,0,2,238,255,255,129,0,68,255,255,255,
-  255,204,19,0,0,0,0,0,32,242,255,255,232,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,190,255,255,230,1,0,0,0,0,0,0,0,0,0,232,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,255,255,255,58,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,153,255,255,255,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,94,255,255,255,73,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,10,241,255,255,116,0,0,0,0,0,0,0,16,255,255,255,140,0,196,255,255,238,5,0,0,0,0,0,0,
-  0,92,255,255,255,200,0,0,0,56,255,255,255,152,0,0,0,0,0,0,0,0,86,255,255,255,77,0,68,255,255,255,
-  233,19,0,0,0,0,0,0,0,151,255,255,255,31,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,132,255,255,255,60,0,0,0,0,0,0,0,0,0,234,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,255,255,229,1,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,52,255,255,255,201,5,0,0,0,0,0,0,0,0,43,159,14,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,44,255,255,255,119,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,155,255,255,212,0,0,0,0,0,0,0,16,255,255,255,140,0,134,255,255,255,121,0,0,0,0,0,0,
-  89,246,255,255,255,206,0,0,0,0,194,255,255,254,98,0,0,0,0,0,0,48,236,255,255,225,5,0,68,255,255,255,
-  109,0,0,0,0,0,0,0,0,94,255,255,255,61,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,41,255,255,255,186,0,0,0,0,0,0,0,0,88,255,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,212,255,255,255,255,255,255,255,255,255,255,148,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,249,255,255,178,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,0,181,255,255,255,172,8,0,0,0,0,0,0,59,229,255,217,38,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,13,255,255,255,138,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,59,255,255,255,53,0,0,0,0,0,0,16,255,255,255,140,0,32,248,255,255,255,153,48,10,29,77,183,
-  255,255,255,255,255,225,0,0,0,0,35,243,255,255,255,170,67,20,10,45,135,247,255,255,252,72,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,75,255,255,255,76,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,189,255,255,255,125,0,0,0,0,0,0,58,238,255,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,212,255,255,255,255,255,255,255,255,255,255,148,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,142,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,0,25,232,255,255,255,221,105,35,10,27,66,161,252,255,255,231,22,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,1,254,255,255,153,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,218,255,255,149,0,0,0,0,0,0,16,255,255,255,140,0,0,107,255,255,255,255,255,255,255,255,255,
-  255,242,222,255,255,252,10,0,0,0,0,70,244,255,255,255,255,255,255,255,255,255,255,254,98,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,41,249,255,255,255,178,67,19,16,52,145,247,255,255,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,212,255,255,255,255,255,255,255,255,255,255,148,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,255,255,255,128,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,0,0,50,230,255,255,255,255,255,255,255,255,255,255,255,235,48,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,5,255,255,255,154,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,122,255,255,238,7,0,0,0,0,0,16,255,255,255,140,0,0,0,105,248,255,255,255,255,255,255,255,
-  209,44,141,255,255,255,69,0,0,0,0,0,50,204,255,255,255,255,255,255,255,255,218,61,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,0,93,254,255,255,255,255,255,255,255,255,255,236,246,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,3,4,4,4,252,255,255,161,4,4,4,2,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,147,255,255,255,201,11,0,0,0,0,0,0,0,0,29,255,255,255,124,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,0,0,0,29,179,255,255,255,255,255,255,255,255,255,190,33,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,18,255,255,255,139,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,28,253,255,255,86,0,0,0,0,0,16,255,255,255,140,0,0,0,0,29,137,207,241,249,226,173,87,
-  2,0,53,164,164,164,87,0,0,0,0,0,0,1,78,159,216,240,246,218,173,82,5,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,0,0,89,239,255,255,255,255,255,255,255,212,40,232,255,255,188,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,125,255,255,255,218,21,0,0,0,0,0,0,0,0,0,14,255,255,255,136,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,0,0,0,0,0,55,141,207,235,252,243,210,153,62,0,0,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,52,255,255,255,120,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,185,255,255,183,0,0,0,0,0,16,255,255,255,140,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,0,0,0,25,126,205,238,248,226,176,93,3,0,236,255,255,178,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  102,255,255,255,232,34,0,0,0,0,0,0,0,0,0,0,1,246,255,255,168,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,100,255,255,255,74,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,56,128,128,124,2,0,0,0,0,16,255,255,255,140,0,72,255,255,255,44,0,33,130,201,233,249,
-  228,194,109,15,0,0,0,0,38,134,205,233,249,232,189,113,12,0,0,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,252,255,255,158,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,82,
-  253,255,255,242,49,0,0,0,0,0,0,0,0,0,0,0,0,197,255,255,221,0,0,0,0,0,0,0,0,0,0,236,
-  255,255,176,0,68,255,255,255,56,0,11,104,187,228,249,237,200,125,17,0,0,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,99,0,0,0,0,0,0,0,0,0,181,255,255,253,21,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,72,255,255,255,45,130,249,255,255,255,255,
-  255,255,255,222,48,0,5,134,252,255,255,255,255,255,255,255,228,50,0,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,255,255,255,114,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,0,0,0,63,248,
-  255,255,250,69,0,0,0,0,0,0,0,0,0,0,0,0,0,137,255,255,255,50,0,0,0,0,0,0,0,0,0,237,
-  255,255,176,0,68,255,255,255,56,68,225,255,255,255,255,255,255,255,234,56,0,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,221,10,0,0,0,0,0,0,0,49,254,255,255,186,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,72,255,255,255,198,255,255,255,255,255,255,
-  255,255,255,255,230,20,174,255,255,255,255,255,255,255,255,255,255,232,22,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,0,122,63,0,0,0,0,0,0,0,0,0,169,255,255,255,46,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,0,0,47,240,255,
-  255,254,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,255,255,255,179,0,0,0,0,0,0,0,0,89,255,
-  255,255,176,0,68,255,255,255,134,250,255,255,255,255,255,255,255,255,255,235,22,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,255,180,10,0,0,0,0,0,21,217,255,255,255,80,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,72,255,255,255,255,255,172,67,25,10,40,
-  122,245,255,255,255,230,255,255,201,79,20,10,34,103,230,255,255,255,140,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,95,255,243,86,0,0,0,0,0,0,0,110,255,255,255,191,0,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,0,33,231,255,255,
-  255,116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,188,255,255,255,120,0,0,0,0,0,0,58,238,255,
-  255,255,176,0,68,255,255,255,255,255,231,113,42,11,27,95,227,255,255,255,141,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,255,255,217,101,37,11,31,104,230,255,255,255,185,0,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,255,255,255,140,0,72,255,255,255,255,110,0,0,0,0,0,
-  0,59,252,255,255,255,255,170,4,0,0,0,0,0,34,243,255,255,232,0,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,207,255,255,255,186,87,32,9,23,75,179,255,255,255,248,51,0,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,92,15,217,255,255,255,
-  142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,249,255,255,255,175,65,18,17,53,145,248,255,255,
-  255,255,176,0,68,255,255,255,255,204,19,0,0,0,0,0,32,242,255,255,232,0,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,179,255,255,255,255,255,255,255,255,255,255,222,25,0,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,3,4,4,19,255,255,255,140,0,72,255,255,255,177,0,0,0,0,0,0,
-  0,0,172,255,255,255,233,13,0,0,0,0,0,0,0,150,255,255,255,32,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,31,219,255,255,255,255,255,255,255,255,255,255,255,251,90,0,0,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,94,181,255,255,255,168,
-  1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,254,255,255,255,255,255,255,255,255,255,238,230,
-  255,255,176,0,68,255,255,255,233,19,0,0,0,0,0,0,0,151,255,255,255,31,0,0,0,244,255,255,168,0,0,0,
-  0,68,255,255,255,40,115,246,255,255,255,255,255,255,255,200,32,0,0,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,212,255,255,255,255,255,255,140,0,72,255,255,255,85,0,0,0,0,0,0,
-  0,0,105,255,255,255,144,0,0,0,0,0,0,0,0,92,255,255,255,59,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,0,14,151,251,255,255,255,255,255,255,255,255,221,63,0,0,0,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,212,255,255,255,255,76,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,238,255,255,255,255,255,255,255,215,45,186,
-  255,255,176,0,68,255,255,255,109,0,0,0,0,0,0,0,0,94,255,255,255,61,0,0,0,0,0,0,0,0,0,0,
-  0,68,255,255,255,24,0,31,130,203,235,249,228,181,91,2,0,0,0,0,0,244,255,255,168,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,212,255,255,255,255,255,255,140,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,80,255,255,255,95,0,0,0,0,0,0,0,0,71,255,255,255,73,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,0,0,0,24,107,185,221,247,242,220,166,90,4,0,0,0,0,0,0,0,
-  0,0,36,255,255,255,120,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,255,255,255,255,255,231,
-  21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,126,205,238,248,226,177,95,4,0,169,
-  255,255,176,0,68,255,255,255,88,0,0,0,0,0,0,0,0,75,255,255,255,76,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,212,255,255,255,255,255,255,140,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,36,255,255,255,119,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,255,255,251,255,255,255,
-  179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,28,127,203,235,248,228,181,102,6,0,172,255,255,172,0,0,0,0,0,0,57,152,210,240,251,236,
-  202,141,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,0,0,0,0,0,0,0,68,255,255,255,
-  88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,
-  255,255,255,32,0,0,0,0,0,0,68,255,255,255,17,0,39,136,206,236,249,226,178,91,2,0,0,0,0,0,0,0,
-  0,0,50,255,255,255,109,0,0,0,0,0,252,255,255,160,0,0,0,0,0,0,64,255,255,255,255,229,46,219,255,255,
-  255,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,146,207,241,250,229,196,124,34,0,0,0,0,0,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,104,243,255,255,255,255,255,255,255,221,52,189,255,255,172,0,0,0,0,22,177,255,255,255,255,255,255,
-  255,255,255,159,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,68,255,255,255,36,133,250,255,255,255,255,255,255,255,202,35,0,0,0,0,0,0,
-  0,0,97,255,255,255,84,0,0,0,0,0,248,255,255,165,0,0,0,0,0,0,64,255,255,255,236,42,0,52,250,255,
-  255,247,43,0,0,0,0,0,0,0,0,0,0,0,22,174,255,255,255,255,255,255,255,255,249,139,7,0,0,0,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,117,255,255,255,255,255,255,255,255,255,255,243,233,255,255,172,0,0,0,22,216,255,255,255,255,255,255,255,
-  255,255,255,255,201,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,47,255,255,255,129,0,0,0,0,0,0,0,0,0,56,255,255,255,119,0,0,0,0,0,
-  0,0,0,0,0,0,0,9,0,0,68,255,255,255,197,255,255,255,255,255,255,255,255,255,255,225,29,0,0,0,10,16,
-  12,66,226,255,255,254,28,0,0,0,0,0,231,255,255,203,0,0,0,0,0,0,64,255,255,255,101,0,0,0,117,255,
-  255,255,210,8,0,0,0,0,0,0,0,0,0,38,227,255,255,255,255,255,255,255,255,255,255,255,190,13,0,0,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,61,254,255,255,255,192,77,23,14,48,133,243,255,255,255,255,172,0,0,0,173,255,255,255,201,81,32,10,35,
-  115,239,255,255,255,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,214,255,255,211,0,0,0,0,0,0,0,0,0,137,255,255,255,32,0,0,0,0,0,
-  0,0,0,0,9,115,217,145,0,0,68,255,255,255,255,255,187,77,28,12,44,130,246,255,255,255,188,0,0,0,68,255,
-  255,255,255,255,255,180,0,0,0,0,0,0,183,255,255,255,114,21,15,33,0,0,64,255,255,255,92,0,0,0,1,185,
-  255,255,255,146,0,0,0,0,0,0,0,0,17,222,255,255,255,211,92,28,11,37,113,234,255,255,255,179,0,0,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,0,1,212,255,255,255,145,1,0,0,0,0,0,41,225,255,255,255,172,0,0,33,255,255,255,183,3,0,0,0,0,
-  0,37,234,255,255,252,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,125,255,255,255,38,0,0,0,0,0,0,0,0,218,255,255,199,0,0,0,0,0,0,
-  0,0,0,64,228,255,255,226,0,0,68,255,255,255,255,125,0,0,0,0,0,0,47,239,255,255,255,81,0,0,68,255,
-  255,255,255,255,223,29,0,0,0,0,0,0,91,255,255,255,255,255,255,176,0,0,64,255,255,255,92,0,0,0,0,23,
-  232,255,255,255,74,0,0,0,0,0,0,0,155,255,255,255,168,5,0,0,0,0,0,21,209,255,255,255,103,0,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,0,64,255,255,255,197,1,0,0,0,0,0,0,0,52,252,255,255,172,0,0,89,255,255,255,71,0,0,0,0,0,
-  0,0,106,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,36,255,255,255,121,0,0,0,0,0,0,0,43,255,255,255,111,0,0,0,0,0,0,
-  0,0,83,252,255,255,229,101,3,0,68,255,255,255,169,0,0,0,0,0,0,0,0,83,255,255,255,183,0,0,46,214,
-  247,246,213,135,19,0,0,0,0,0,0,0,1,181,255,255,255,255,255,176,0,0,64,255,255,255,92,0,0,0,0,0,
-  71,254,255,255,233,23,0,0,0,0,0,35,253,255,255,211,5,0,0,0,0,0,0,0,27,241,255,255,226,4,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,0,151,255,255,255,66,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,96,255,255,255,60,0,0,0,0,0,
-  0,0,34,164,164,164,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,0,203,255,255,204,0,0,0,0,0,0,0,124,255,255,253,25,0,0,0,0,0,0,
-  0,37,247,255,255,205,18,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,205,255,255,252,15,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,6,120,212,247,246,219,122,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,140,255,255,255,183,1,0,0,0,0,135,255,255,255,74,0,0,0,0,0,0,0,0,0,121,255,255,255,83,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,0,207,255,255,233,2,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,59,255,255,255,163,1,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,0,114,255,255,255,31,0,0,0,0,0,0,205,255,255,190,0,0,0,0,0,0,0,
-  0,175,255,255,246,31,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,115,255,255,255,63,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,5,204,255,255,255,112,0,0,0,0,210,255,255,232,3,0,0,0,0,0,0,0,0,0,22,253,255,255,149,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,2,250,255,255,180,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,1,214,255,255,255,194,82,9,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,0,27,253,255,255,113,0,0,0,0,0,30,255,255,255,102,0,0,0,0,0,0,0,
-  23,252,255,255,152,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,61,255,255,255,108,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,37,243,255,255,248,47,0,0,8,253,255,255,175,0,0,0,0,0,0,0,0,0,0,0,213,255,255,207,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,16,255,255,255,143,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,44,237,255,255,255,255,246,189,126,
-  60,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,0,0,192,255,255,196,0,0,0,0,0,110,255,255,250,19,0,0,0,0,0,0,0,
-  84,255,255,255,73,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,27,255,255,255,126,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,255,255,255,92,0,0,0,0,0,
-  0,0,0,93,255,255,255,214,9,0,39,255,255,255,134,0,0,0,0,0,0,0,0,0,0,0,173,255,255,233,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,31,255,255,255,128,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,30,180,255,255,255,255,255,255,
-  255,234,142,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,0,0,103,255,255,253,24,0,0,0,0,191,255,255,182,0,0,0,0,0,0,0,0,
-  127,255,255,255,27,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,13,255,255,255,141,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,52,255,255,255,118,0,0,0,0,0,0,0,0,0,0,0,157,255,255,250,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,29,255,255,255,124,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,50,145,223,255,255,255,
-  255,255,255,245,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,0,0,19,250,255,255,105,0,0,0,20,252,255,255,94,0,0,0,0,0,0,0,0,
-  144,255,255,255,7,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,18,255,255,255,142,0,11,249,
-  255,255,144,0,0,0,0,0,0,0,0,162,255,255,147,0,0,0,0,0,0,0,0,156,255,255,244,7,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,48,255,255,255,113,0,0,0,0,0,0,0,0,0,0,0,163,255,255,254,1,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,14,255,255,255,137,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,0,0,0,33,94,159,
-  235,255,255,255,255,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,255,255,255,84,0,0,0,0,0,0,
-  0,0,76,255,255,255,88,0,0,0,0,0,0,0,0,68,255,255,255,76,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,0,0,0,181,255,255,188,0,0,0,97,255,255,247,14,0,0,0,0,0,0,0,0,
-  152,255,255,255,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,32,255,255,255,127,0,0,189,
-  255,255,208,0,0,0,0,0,0,0,3,236,255,255,224,0,0,0,0,0,0,0,0,219,255,255,180,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,31,255,255,255,128,0,0,0,0,0,0,0,0,0,0,0,179,255,255,242,0,0,
-  0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,72,255,255,255,80,0,148,255,255,84,0,0,0,0,0,
-  0,1,247,255,255,171,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,0,0,0,0,0,0,
-  6,103,244,255,255,253,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,0,0,0,91,255,255,251,19,0,0,178,255,255,173,0,0,0,0,0,0,0,0,0,
-  152,255,255,255,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,69,255,255,255,108,0,0,118,
-  255,255,254,18,0,0,0,0,0,0,60,255,255,255,255,47,0,0,0,0,0,0,26,255,255,255,108,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,8,252,255,255,165,0,0,0,0,0,0,0,0,0,0,0,221,255,255,210,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,200,255,255,225,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,87,255,255,255,125,0,0,171,255,255,255,127,0,0,0,0,0,0,0,1,199,255,255,255,106,0,28,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,232,0,0,0,0,0,0,0,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,0,0,0,12,246,255,255,98,0,11,247,255,255,85,0,0,0,0,0,0,0,0,0,
-  152,255,255,255,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,122,255,255,255,62,0,0,47,
-  255,255,255,81,0,0,0,0,0,0,136,255,255,255,255,125,0,0,0,0,0,0,89,255,255,255,37,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,204,255,255,225,1,0,0,0,0,0,0,0,0,0,27,254,255,255,159,0,0,
-  99,255,255,255,137,0,0,0,0,0,0,0,0,0,147,255,255,255,67,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,143,255,255,255,58,0,0,0,0,0,0,0,0,0,240,255,255,172,0,25,244,244,244,137,0,0,0,0,0,0,
-  0,0,4,252,255,255,157,0,0,24,239,255,255,246,30,0,0,0,0,0,0,97,255,255,255,197,1,0,28,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,232,0,0,0,0,0,0,0,0,88,255,255,255,68,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,0,0,0,0,169,255,255,180,0,83,255,255,243,9,0,0,0,0,0,0,0,0,0,
-  152,255,255,255,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,208,255,255,251,13,0,0,0,
-  230,255,255,146,0,0,0,0,0,0,213,255,255,255,255,203,0,0,0,0,0,0,152,255,255,221,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,136,255,255,255,67,0,0,0,0,0,0,0,0,0,121,255,255,255,86,0,0,
-  16,248,255,255,220,0,0,0,0,0,0,0,0,0,224,255,255,232,3,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,53,255,255,255,191,0,0,0,0,0,0,0,0,59,253,255,255,172,0,2,240,255,255,207,0,0,0,0,0,0,
-  0,0,13,254,255,255,146,0,0,0,101,255,255,255,171,0,0,0,0,0,15,233,255,255,249,42,0,0,28,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,215,0,0,0,0,0,0,0,0,81,255,255,255,73,0,0,0,0,0,0,
-  0,0,80,255,255,255,76,0,0,0,0,0,0,80,255,255,249,14,164,255,255,165,0,0,0,0,0,0,0,0,0,0,
-  157,255,255,247,0,0,0,0,0,0,68,255,255,255,166,0,0,0,0,0,0,0,0,82,255,255,255,176,0,0,0,0,
-  160,255,255,211,0,0,0,0,0,33,255,255,226,250,255,254,26,0,0,0,0,0,215,255,255,149,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,33,253,255,255,207,4,0,0,0,0,0,0,0,23,239,255,255,234,7,0,0,
-  0,174,255,255,255,48,0,0,0,0,0,0,0,47,255,255,255,147,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,201,255,255,255,138,0,0,0,0,0,0,45,228,255,255,255,172,0,0,156,255,255,255,119,0,0,0,0,0,
-  0,0,136,255,255,255,92,0,0,0,1,193,255,255,255,65,0,0,0,0,145,255,255,255,129,0,0,0,0,4,4,4,
-  4,4,4,4,4,4,4,23,230,255,255,253,64,0,0,0,0,0,0,0,0,66,255,255,255,97,0,0,0,0,0,0,
-  0,0,82,255,255,255,76,0,0,0,0,0,0,7,240,255,255,96,239,255,255,77,0,0,0,0,0,0,0,0,0,0,
-  181,255,255,222,0,0,0,0,0,0,68,255,255,255,255,122,0,0,0,0,0,0,45,237,255,255,255,71,0,0,0,0,
-  89,255,255,254,20,0,0,0,0,110,255,255,141,188,255,255,103,0,0,0,0,23,255,255,255,78,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,158,255,255,255,166,5,0,0,0,0,0,16,202,255,255,255,110,0,0,0,
-  0,83,255,255,255,132,0,0,0,0,0,0,0,125,255,255,255,59,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,52,253,255,255,255,188,73,20,14,48,136,245,255,255,255,255,172,0,0,30,238,255,255,255,179,74,22,9,32,
-  78,185,255,255,255,227,11,0,0,0,0,39,248,255,255,211,3,0,0,45,251,255,255,215,7,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,176,255,255,255,134,0,0,0,0,0,0,0,0,0,28,255,255,255,157,0,0,0,0,0,0,
-  0,0,188,255,255,255,76,0,0,0,0,0,0,0,158,255,255,228,255,255,238,6,0,0,0,0,0,0,0,0,0,6,
-  237,255,255,180,0,0,0,0,0,0,68,255,255,255,255,255,186,77,27,11,42,128,245,255,255,255,179,0,0,0,0,0,
-  20,253,255,255,84,0,0,0,0,186,255,255,64,109,255,255,181,0,0,0,0,85,255,255,249,12,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,14,222,255,255,255,210,92,28,10,34,107,229,255,255,255,191,3,0,0,0,
-  0,8,241,255,255,215,0,0,0,0,0,0,0,203,255,255,225,1,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,108,255,255,255,255,255,255,255,255,255,255,239,250,255,255,172,0,0,0,59,246,255,255,255,255,255,255,255,
-  255,255,255,255,244,62,0,0,0,0,0,0,124,255,255,255,109,0,0,192,255,255,254,61,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,104,255,255,255,201,4,0,0,0,0,0,0,0,0,0,0,225,255,255,245,35,0,0,0,0,0,
-  2,138,255,255,255,255,76,0,0,0,0,0,0,0,69,255,255,255,255,255,156,0,0,0,0,0,0,0,0,0,0,117,
-  255,255,255,93,0,0,0,0,0,0,68,255,255,255,221,255,255,255,255,255,255,255,255,255,255,220,24,0,0,0,0,0,
-  0,202,255,255,148,0,0,0,13,249,255,239,4,31,255,255,247,11,0,0,0,148,255,255,190,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,37,223,255,255,255,255,255,255,255,255,255,255,255,203,17,0,0,0,0,
-  0,0,158,255,255,255,43,0,0,0,0,0,26,254,255,255,138,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,100,242,255,255,255,255,255,255,255,215,43,240,255,255,172,0,0,0,0,43,196,255,255,255,255,255,255,
-  255,255,255,208,50,0,0,0,0,0,0,0,5,211,255,255,238,20,89,255,255,255,152,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,41,246,255,255,243,35,0,0,0,0,0,0,0,0,0,0,0,128,255,255,255,225,87,19,12,38,96,
-  200,255,255,255,255,255,76,0,0,0,0,0,0,0,3,233,255,255,255,255,68,0,0,0,0,0,0,0,8,43,141,254,
-  255,255,207,7,0,0,0,0,0,0,68,255,255,255,89,132,250,255,255,255,255,255,255,255,198,31,0,0,0,0,0,0,
-  0,131,255,255,213,0,0,0,83,255,255,167,0,0,207,255,255,81,0,0,0,211,255,255,119,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,172,255,255,255,255,255,255,255,255,251,146,8,0,0,0,0,0,
-  0,0,67,255,255,255,126,0,0,0,0,0,102,255,255,255,50,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,28,128,206,237,249,228,178,96,4,0,240,255,255,172,0,0,0,0,0,1,64,147,207,232,251,241,
-  214,160,76,3,0,0,0,0,0,0,0,0,0,56,253,255,255,163,228,255,255,230,15,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,6,207,255,255,255,95,0,0,0,0,0,0,0,0,0,0,0,0,13,222,255,255,255,255,255,255,255,255,
-  255,255,236,255,255,255,76,0,0,0,0,0,0,0,0,147,255,255,255,232,3,0,0,0,0,0,0,0,192,255,255,255,
-  255,222,38,0,0,0,0,0,0,0,68,255,255,255,88,0,36,136,205,237,249,228,180,90,2,0,0,0,0,0,0,0,
-  0,60,255,255,255,22,0,0,160,255,255,90,0,0,128,255,255,159,0,0,19,254,255,255,47,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,141,208,235,251,238,198,131,35,0,0,0,0,0,0,0,
-  0,0,2,230,255,255,210,0,0,0,0,0,180,255,255,217,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,255,255,255,255,255,255,82,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,142,255,255,255,167,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,220,255,255,255,255,255,255,255,
-  255,185,63,255,255,255,76,0,0,0,0,0,0,0,0,58,255,255,255,148,0,0,0,0,0,0,0,0,192,255,255,255,
-  242,31,0,0,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,4,240,255,255,86,0,2,234,255,251,17,0,0,49,255,255,234,2,0,81,255,255,231,1,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,142,255,255,255,37,0,0,0,10,247,255,255,130,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,227,255,255,255,255,175,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,71,254,255,255,223,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,109,190,235,251,239,214,153,
-  65,0,44,255,255,255,76,0,0,0,0,0,0,0,0,1,223,255,255,60,0,0,0,0,0,0,0,0,192,255,255,255,
-  255,221,38,0,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,173,255,255,151,0,57,255,255,192,0,0,0,0,225,255,255,59,0,144,255,255,160,0,0,0,0,0,0,9,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,52,255,255,255,121,0,0,0,80,255,255,255,42,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,255,255,255,244,27,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,21,231,255,255,252,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,40,141,254,
-  255,255,209,7,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,102,255,255,215,0,133,255,255,116,0,0,0,0,147,255,255,137,0,207,255,255,88,0,0,0,0,0,24,245,169,
-  48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,217,255,255,204,0,0,0,158,255,255,209,0,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,119,255,255,255,253,56,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,180,255,255,255,127,0,0,0,0,0,0,0,0,0,0,0,12,127,210,245,237,193,101,6,0,0,0,0,0,0,
-  0,0,45,132,132,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,
-  255,255,255,97,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,31,255,255,255,24,210,255,255,39,0,0,0,0,68,255,255,215,16,253,255,253,19,0,0,0,0,0,104,255,255,
-  254,149,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,126,255,255,255,32,0,2,233,255,255,121,0,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,246,255,255,255,255,212,6,0,0,0,0,0,0,0,0,0,0,
-  0,108,255,255,255,196,3,0,0,0,0,0,0,0,0,0,0,37,224,255,255,255,255,255,255,213,44,0,0,0,0,0,
-  0,0,113,255,255,151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,
-  240,255,255,185,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,215,255,255,119,255,255,218,0,0,0,0,0,5,240,255,255,114,255,255,201,0,0,0,0,0,0,41,169,255,
-  255,255,189,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,36,255,255,255,115,0,57,255,255,255,33,0,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,190,255,255,247,255,255,255,127,0,0,0,0,0,0,0,0,0,0,
-  44,247,255,255,240,31,0,0,0,0,0,0,0,0,0,0,16,224,255,255,255,255,255,255,255,255,242,67,0,0,0,0,
-  0,0,167,255,255,110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  185,255,255,228,0,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,144,255,255,240,255,255,141,0,0,0,0,0,0,166,255,255,238,255,255,129,0,0,0,0,0,0,0,0,104,
-  255,255,255,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,201,255,255,199,0,135,255,255,201,0,0,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,100,255,255,255,116,173,255,255,249,41,0,0,0,0,0,0,0,0,8,
-  211,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,145,255,255,240,91,15,26,120,248,255,255,248,82,0,0,0,
-  0,39,252,255,255,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  161,255,255,251,2,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,73,255,255,255,255,255,65,0,0,0,0,0,0,87,255,255,255,255,255,58,0,0,0,0,0,0,0,0,0,
-  158,255,255,253,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,111,255,255,254,27,213,255,255,113,0,0,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,255,255,172,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,25,239,255,255,214,5,31,246,255,255,197,2,0,0,0,0,0,0,0,147,
-  255,255,255,160,0,0,0,0,0,0,0,0,0,0,0,8,244,255,255,96,0,0,0,0,55,234,255,255,254,146,28,9,
-  69,221,255,255,180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  156,255,255,255,8,0,0,0,0,0,68,255,255,255,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,10,248,255,255,255,239,4,0,0,0,0,0,0,14,249,255,255,255,238,3,0,0,0,0,0,0,0,0,0,
-  34,255,255,255,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,23,252,255,255,144,255,255,253,26,0,0,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,173,255,255,255,68,0,0,126,255,255,255,108,0,0,0,0,0,0,75,255,
-  255,255,219,12,0,0,0,0,0,0,0,0,0,0,0,63,255,255,239,6,0,0,0,0,0,38,219,255,255,255,255,255,
-  255,255,255,240,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  156,255,255,255,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,186,255,255,255,167,0,0,0,0,0,0,0,0,185,255,255,255,170,0,0,0,0,0,0,0,0,0,0,
-  0,211,255,255,202,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,185,255,255,253,255,255,192,0,0,0,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,80,255,255,255,172,0,0,0,8,222,255,255,242,29,0,0,0,0,23,233,255,
-  255,250,53,0,0,0,0,0,0,0,0,0,0,0,0,97,255,255,204,0,0,0,0,0,0,0,18,182,255,255,255,255,
-  255,255,237,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  156,255,255,255,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,115,255,255,255,90,0,0,0,0,0,0,0,0,106,255,255,255,99,0,0,0,0,0,0,0,0,0,0,
-  0,165,255,255,245,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,95,255,255,255,255,255,104,0,0,0,0,0,0,0,0,0,0,148,255,255,84,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,15,229,255,255,245,30,0,0,0,0,79,255,255,255,180,0,0,0,1,183,255,255,
-  255,124,4,4,4,4,4,4,4,4,4,4,4,2,0,39,92,92,66,0,0,0,0,0,0,0,0,0,80,180,234,248,
-  221,142,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  155,255,255,255,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,44,255,255,252,17,0,0,0,0,0,0,0,0,28,255,255,255,28,0,0,0,0,0,0,0,0,0,0,
-  0,144,255,255,255,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,13,246,255,255,255,251,20,0,0,0,0,0,0,0,0,0,0,74,128,128,42,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,154,255,255,255,124,0,0,0,0,0,0,183,255,255,255,89,0,0,64,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  146,255,255,255,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,255,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,170,255,255,255,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,63,254,255,255,220,7,0,0,0,0,0,0,38,249,255,255,233,18,0,72,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  127,255,255,255,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,255,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,79,255,255,255,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,8,217,255,255,255,76,0,0,0,0,0,0,0,0,136,255,255,255,161,0,72,255,255,255,
-  255,255,255,255,255,255,255,255,255,255,255,255,255,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  82,255,255,255,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,255,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,36,255,255,248,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  20,250,255,255,153,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,136,255,255,255,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,122,255,255,175,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,169,255,255,246,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,127,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,215,255,255,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,33,245,255,255,204,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,102,255,255,255,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,65,255,255,243,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,77,251,255,255,228,99,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,60,255,255,255,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,9,207,255,255,149,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,60,226,255,255,225,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,1,223,255,255,220,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,7,9,29,84,207,255,255,247,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,9,114,216,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,85,255,255,255,209,78,19,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,92,255,255,255,255,255,255,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,118,251,255,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,92,255,255,255,255,255,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,98,255,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,67,218,249,237,179,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,122,251,255,255,255,255,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,95,255,255,255,211,78,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,5,233,255,255,224,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,78,255,255,255,110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,121,255,255,255,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,147,255,255,255,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,156,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,156,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,156,255,255,255,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,156,255,255,255,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,164,255,255,255,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,191,255,255,247,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,222,255,255,203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  52,255,255,255,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  166,255,255,253,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,
-  255,255,255,145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,187,255,
-  255,255,185,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,255,255,
-  253,144,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,243,165,
-  45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 
- 40.000000f, 46.880001f, 0.000000f, 37.110001f, -9.770000f, 96, 
- {
-  {4294967295, 0, 0, 0, 0, 0.000000f, 0.000000f, 0.011719f, 0.011719f, 0.015625f, 0.015625f, 0, 0 },
-  {32, 1, 1, 0, 0, 9.906250f, 0.000000f, 0.023438f, 0.003906f, 0.027344f, 0.007812f, 0, 0 },
-  {33, 6, 30, 3, 29, 10.296875f, 0.000000f, 0.027344f, 0.003906f, 0.050781f, 0.121094f, 0, 0 },
-  {34, 10, 11, 2, 31, 12.796875f, 0.000000f, 0.050781f, 0.003906f, 0.089844f, 0.046875f, 0, 0 },
-  {35, 24, 30, 2, 29, 24.625000f, 0.000000f, 0.089844f, 0.003906f, 0.183594f, 0.121094f, 0, 0 },
-  {36, 20, 39, 2, 34, 22.468750f, 0.000000f, 0.183594f, 0.003906f, 0.261719f, 0.156250f, 0, 0 },
-  {37, 27, 30, 2, 29, 29.296875f, 0.000000f, 0.261719f, 0.003906f, 0.367188f, 0.121094f, 0, 0 },
-  {38, 25, 30, 1, 29, 24.859375f, 0.000000f, 0.367188f, 0.003906f, 0.464844f, 0.121094f, 0, 0 },
-  {39, 4, 11, 2, 31, 6.968750f, 0.000000f, 0.464844f, 0.003906f, 0.480469f, 0.046875f, 0, 0 },
-  {40, 12, 44, 2, 33, 13.671875f, 0.000000f, 0.480469f, 0.003906f, 0.527344f, 0.175781f, 0, 0 },
-  {41, 13, 44, 0, 33, 13.906250f, 0.000000f, 0.527344f, 0.003906f, 0.578125f, 0.175781f, 0, 0 },
-  {42, 18, 18, 0, 29, 17.234375f, 0.000000f, 0.578125f, 0.003906f, 0.648438f, 0.074219f, 0, 0 },
-  {43, 22, 22, 1, 24, 22.671875f, 0.000000f, 0.648438f, 0.003906f, 0.734375f, 0.089844f, 0, 0 },
-  {44, 8, 12, 0, 4, 7.859375f, 0.000000f, 0.734375f, 0.003906f, 0.765625f, 0.050781f, 0, 0 },
-  {45, 12, 5, 0, 15, 11.031250f, 0.000000f, 0.765625f, 0.003906f, 0.812500f, 0.023438f, 0, 0 },
-  {46, 7, 5, 2, 4, 10.531250f, 0.000000f, 0.812500f, 0.003906f, 0.839844f, 0.023438f, 0, 0 },
-  {47, 17, 33, 0, 29, 16.484375f, 0.000000f, 0.839844f, 0.003906f, 0.906250f, 0.132812f, 0, 0 },
-  {48, 20, 30, 2, 29, 22.468750f, 0.000000f, 0.906250f, 0.003906f, 0.984375f, 0.121094f, 0, 0 },
-  {49, 13, 30, 3, 29, 22.468750f, 0.000000f, 0.765625f, 0.023438f, 0.816406f, 0.140625f, 0, 0 },
-  {50, 21, 30, 1, 29, 22.468750f, 0.000000f, 0.578125f, 0.089844f, 0.660156f, 0.207031f, 0, 0 },
-  {51, 20, 30, 1, 29, 22.468750f, 0.000000f, 0.660156f, 0.089844f, 0.738281f, 0.207031f, 0, 0 },
-  {52, 22, 30, 1, 29, 22.468750f, 0.000000f, 0.023438f, 0.121094f, 0.109375f, 0.238281f, 0, 0 },
-  {53, 19, 30, 3, 29, 22.468750f, 0.000000f, 0.109375f, 0.121094f, 0.183594f, 0.238281f, 0, 0 },
-  {54, 20, 30, 2, 29, 22.468750f, 0.000000f, 0.906250f, 0.121094f, 0.984375f, 0.238281f, 0, 0 },
-  {55, 21, 30, 1, 29, 22.468750f, 0.000000f, 0.261719f, 0.121094f, 0.343750f, 0.238281f, 0, 0 },
-  {56, 20, 30, 2, 29, 22.468750f, 0.000000f, 0.343750f, 0.121094f, 0.421875f, 0.238281f, 0, 0 },
-  {57, 20, 30, 1, 29, 22.468750f, 0.000000f, 0.816406f, 0.132812f, 0.894531f, 0.250000f, 0, 0 },
-  {58, 7, 23, 2, 22, 9.687500f, 0.000000f, 0.738281f, 0.050781f, 0.765625f, 0.140625f, 0, 0 },
-  {59, 8, 29, 0, 22, 8.453125f, 0.000000f, 0.421875f, 0.121094f, 0.453125f, 0.234375f, 0, 0 },
-  {60, 18, 20, 1, 22, 20.328125f, 0.000000f, 0.738281f, 0.140625f, 0.808594f, 0.218750f, 0, 0 },
-  {61, 19, 13, 2, 20, 21.953125f, 0.000000f, 0.183594f, 0.156250f, 0.257812f, 0.207031f, 0, 0 },
-  {62, 19, 20, 2, 22, 20.906250f, 0.000000f, 0.453125f, 0.175781f, 0.527344f, 0.253906f, 0, 0 },
-  {63, 18, 30, 1, 29, 18.890625f, 0.000000f, 0.527344f, 0.207031f, 0.597656f, 0.324219f, 0, 0 },
-  {64, 33, 39, 2, 30, 35.921875f, 0.000000f, 0.597656f, 0.207031f, 0.726562f, 0.359375f, 0, 0 },
-  {65, 27, 30, 0, 29, 26.093750f, 0.000000f, 0.257812f, 0.238281f, 0.363281f, 0.355469f, 0, 0 },
-  {66, 21, 30, 3, 29, 24.906250f, 0.000000f, 0.726562f, 0.218750f, 0.808594f, 0.335938f, 0, 0 },
-  {67, 24, 30, 2, 29, 26.031250f, 0.000000f, 0.894531f, 0.238281f, 0.988281f, 0.355469f, 0, 0 },
-  {68, 22, 30, 3, 29, 26.234375f, 0.000000f, 0.003906f, 0.238281f, 0.089844f, 0.355469f, 0, 0 },
-  {69, 20, 30, 3, 29, 22.734375f, 0.000000f, 0.363281f, 0.238281f, 0.441406f, 0.355469f, 0, 0 },
-  {70, 19, 30, 3, 29, 22.109375f, 0.000000f, 0.183594f, 0.207031f, 0.257812f, 0.324219f, 0, 0 },
-  {71, 24, 30, 2, 29, 27.250000f, 0.000000f, 0.089844f, 0.238281f, 0.183594f, 0.355469f, 0, 0 },
-  {72, 24, 30, 3, 29, 28.515625f, 0.000000f, 0.441406f, 0.324219f, 0.535156f, 0.441406f, 0, 0 },
-  {73, 6, 30, 3, 29, 10.875000f, 0.000000f, 0.808594f, 0.250000f, 0.832031f, 0.367188f, 0, 0 },
-  {74, 19, 30, 1, 29, 22.078125f, 0.000000f, 0.183594f, 0.324219f, 0.257812f, 0.441406f, 0, 0 },
-  {75, 24, 30, 3, 29, 25.078125f, 0.000000f, 0.832031f, 0.355469f, 0.925781f, 0.472656f, 0, 0 },
-  {76, 19, 30, 3, 29, 21.531250f, 0.000000f, 0.726562f, 0.335938f, 0.800781f, 0.453125f, 0, 0 },
-  {77, 30, 30, 3, 29, 34.921875f, 0.000000f, 0.003906f, 0.355469f, 0.121094f, 0.472656f, 0, 0 },
-  {78, 24, 30, 3, 29, 28.515625f, 0.000000f, 0.257812f, 0.355469f, 0.351562f, 0.472656f, 0, 0 },
-  {79, 25, 30, 2, 29, 27.500000f, 0.000000f, 0.535156f, 0.359375f, 0.632812f, 0.476562f, 0, 0 },
-  {80, 22, 30, 3, 29, 25.234375f, 0.000000f, 0.351562f, 0.355469f, 0.437500f, 0.472656f, 0, 0 },
-  {81, 25, 35, 2, 29, 27.500000f, 0.000000f, 0.437500f, 0.441406f, 0.535156f, 0.578125f, 0, 0 },
-  {82, 22, 30, 3, 29, 24.625000f, 0.000000f, 0.632812f, 0.359375f, 0.718750f, 0.476562f, 0, 0 },
-  {83, 23, 30, 1, 29, 23.734375f, 0.000000f, 0.121094f, 0.441406f, 0.210938f, 0.558594f, 0, 0 },
-  {84, 24, 30, 0, 29, 23.875000f, 0.000000f, 0.718750f, 0.453125f, 0.812500f, 0.570312f, 0, 0 },
-  {85, 23, 30, 2, 29, 25.937500f, 0.000000f, 0.812500f, 0.472656f, 0.902344f, 0.589844f, 0, 0 },
-  {86, 26, 30, 0, 29, 25.453125f, 0.000000f, 0.210938f, 0.472656f, 0.312500f, 0.589844f, 0, 0 },
-  {87, 35, 30, 1, 29, 35.484375f, 0.000000f, 0.535156f, 0.476562f, 0.671875f, 0.593750f, 0, 0 },
-  {88, 25, 30, 1, 29, 25.078125f, 0.000000f, 0.003906f, 0.472656f, 0.101562f, 0.589844f, 0, 0 },
-  {89, 25, 30, 0, 29, 24.031250f, 0.000000f, 0.312500f, 0.472656f, 0.410156f, 0.589844f, 0, 0 },
-  {90, 23, 30, 1, 29, 23.953125f, 0.000000f, 0.902344f, 0.472656f, 0.992188f, 0.589844f, 0, 0 },
-  {91, 10, 41, 2, 34, 10.609375f, 0.000000f, 0.671875f, 0.476562f, 0.710938f, 0.636719f, 0, 0 },
-  {92, 18, 33, 0, 29, 16.406250f, 0.000000f, 0.101562f, 0.558594f, 0.171875f, 0.687500f, 0, 0 },
-  {93, 9, 41, 0, 34, 10.609375f, 0.000000f, 0.171875f, 0.558594f, 0.207031f, 0.718750f, 0, 0 },
-  {94, 16, 16, 1, 30, 16.718750f, 0.000000f, 0.710938f, 0.570312f, 0.773438f, 0.632812f, 0, 0 },
-  {95, 19, 5, 0, 1, 18.046875f, 0.000000f, 0.410156f, 0.578125f, 0.484375f, 0.597656f, 0, 0 },
-  {96, 10, 7, 1, 31, 12.359375f, 0.000000f, 0.773438f, 0.570312f, 0.812500f, 0.597656f, 0, 0 },
-  {97, 19, 23, 2, 22, 21.765625f, 0.000000f, 0.207031f, 0.589844f, 0.281250f, 0.679688f, 0, 0 },
-  {98, 20, 32, 2, 31, 22.437500f, 0.000000f, 0.003906f, 0.589844f, 0.082031f, 0.714844f, 0, 0 },
-  {99, 20, 23, 1, 22, 20.937500f, 0.000000f, 0.281250f, 0.589844f, 0.359375f, 0.679688f, 0, 0 },
-  {100, 20, 32, 1, 31, 22.562500f, 0.000000f, 0.812500f, 0.589844f, 0.890625f, 0.714844f, 0, 0 },
-  {101, 20, 23, 1, 22, 21.187500f, 0.000000f, 0.890625f, 0.589844f, 0.968750f, 0.679688f, 0, 0 },
-  {102, 14, 33, 1, 32, 13.890625f, 0.000000f, 0.484375f, 0.593750f, 0.539062f, 0.722656f, 0, 0 },
-  {103, 20, 31, 1, 22, 22.437500f, 0.000000f, 0.539062f, 0.593750f, 0.617188f, 0.714844f, 0, 0 },
-  {104, 19, 32, 2, 31, 22.031250f, 0.000000f, 0.359375f, 0.597656f, 0.433594f, 0.722656f, 0, 0 },
-  {105, 7, 30, 2, 29, 9.703125f, 0.000000f, 0.968750f, 0.589844f, 0.996094f, 0.707031f, 0, 0 },
-  {106, 10, 38, -2, 29, 9.546875f, 0.000000f, 0.617188f, 0.593750f, 0.656250f, 0.742188f, 0, 0 },
-  {107, 20, 32, 2, 31, 20.281250f, 0.000000f, 0.710938f, 0.632812f, 0.789062f, 0.757812f, 0, 0 },
-  {108, 5, 32, 3, 31, 9.703125f, 0.000000f, 0.082031f, 0.589844f, 0.101562f, 0.714844f, 0, 0 },
-  {109, 32, 23, 2, 22, 35.062500f, 0.000000f, 0.207031f, 0.679688f, 0.332031f, 0.769531f, 0, 0 },
-  {110, 19, 23, 2, 22, 22.078125f, 0.000000f, 0.890625f, 0.679688f, 0.964844f, 0.769531f, 0, 0 },
-  {111, 22, 23, 1, 22, 22.812500f, 0.000000f, 0.789062f, 0.714844f, 0.875000f, 0.804688f, 0, 0 },
-  {112, 20, 31, 2, 22, 22.437500f, 0.000000f, 0.539062f, 0.714844f, 0.617188f, 0.835938f, 0, 0 },
-  {113, 20, 31, 1, 22, 22.734375f, 0.000000f, 0.003906f, 0.714844f, 0.082031f, 0.835938f, 0, 0 },
-  {114, 12, 23, 2, 22, 13.531250f, 0.000000f, 0.433594f, 0.597656f, 0.480469f, 0.687500f, 0, 0 },
-  {115, 19, 23, 1, 22, 20.625000f, 0.000000f, 0.082031f, 0.714844f, 0.156250f, 0.804688f, 0, 0 },
-  {116, 13, 28, 0, 27, 13.062500f, 0.000000f, 0.656250f, 0.636719f, 0.707031f, 0.746094f, 0, 0 },
-  {117, 19, 23, 2, 22, 22.046875f, 0.000000f, 0.332031f, 0.722656f, 0.406250f, 0.812500f, 0, 0 },
-  {118, 20, 23, 0, 22, 19.375000f, 0.000000f, 0.406250f, 0.722656f, 0.484375f, 0.812500f, 0, 0 },
-  {119, 31, 23, 0, 22, 30.062500f, 0.000000f, 0.617188f, 0.757812f, 0.738281f, 0.847656f, 0, 0 },
-  {120, 20, 23, 0, 22, 19.828125f, 0.000000f, 0.156250f, 0.769531f, 0.234375f, 0.859375f, 0, 0 },
-  {121, 20, 31, 0, 22, 18.921875f, 0.000000f, 0.875000f, 0.769531f, 0.953125f, 0.890625f, 0, 0 },
-  {122, 19, 23, 1, 22, 19.828125f, 0.000000f, 0.234375f, 0.769531f, 0.308594f, 0.859375f, 0, 0 },
-  {123, 14, 42, 1, 33, 13.531250f, 0.000000f, 0.484375f, 0.722656f, 0.539062f, 0.886719f, 0, 0 },
-  {124, 5, 36, 3, 29, 9.750000f, 0.000000f, 0.964844f, 0.707031f, 0.984375f, 0.847656f, 0, 0 },
-  {125, 14, 42, 0, 33, 13.531250f, 0.000000f, 0.738281f, 0.804688f, 0.792969f, 0.968750f, 0, 0 },
-  {126, 24, 9, 2, 16, 27.203125f, 0.000000f, 0.308594f, 0.812500f, 0.402344f, 0.847656f, 0, 0 },
- }
-};
-#ifdef __cplusplus
-}
-#endif
@@ -329,9 +329,23 @@ EJColorRGBA bufferToColorRBGA(const char *jsc, size_t length) {
 }
 
 
+static EJColorRGBA NumberToColorRGBA(double number) {
+    const unsigned int rgba = (unsigned int)(long long)number;
+    EJColorRGBA color = {.rgba = {
+            .r = (unsigned char)(rgba >> 24),
+            .g = (unsigned char)(rgba >> 16),
+            .b = (unsigned char)(rgba >> 8),
+            .a = (unsigned char)rgba
+    }};
+    return color;
+}
+
 EJColorRGBA JSValueToColorRGBA(v8::Local<v8::Value> value) {
     EJColorRGBA color;
     color.hex = 0xff000000;
+    if (value->IsNumber()) {
+        return NumberToColorRGBA(Local<Number>::Cast(value)->Value());
+    }
     if (!value->IsString()) {
         return color;
     }
@@ -344,6 +358,21 @@ EJColorRGBA JSValueToColorRGBA(v8::Local<v8::Value> value) {
     return color;
 }
 
+EJColorRGBA EJColorCache::get(Isolate* isolate, Local<Value> value) {
+    if (!value->IsString()) {
+        return JSValueToColorRGBA(value);
+    }
+
+    Local<String> string = Local<String>::Cast(value);
+    Entry &entry = _entries[(unsigned int)string->GetIdentityHash() % kSize];
+    if (!entry.string.IsEmpty() && Local<String>::New(isolate, entry.string)->StrictEquals(string)) {
+        return entry.color;
+    }
+    entry.color = JSValueToColorRGBA(value);
+    entry.string.Reset(isolate, string);
+    return entry.color;
+}
+
 Local<String> ColorRGBAToJSValue (Isolate* isolate, EJColorRGBA c) {
     EscapableHandleScope scope(isolate);
     static char buffer[32];
@@ -8,6 +8,8 @@
 // ColorRGBAToJSValue always converts the color to an rgba string, because I'm
 // lazy.
 
+// Numbers are colors in 0xRRGGBBAA format and skip parsing altogether.
+
 #include <v8.h>
 #import "EJCanvas/EJCanvasTypes.h"
 
@@ -23,3 +25,22 @@ EJColorRGBA bufferToColorRBGA(const char *jsc, size_t length);
 #ifdef __cplusplus
 }
 #endif
+
+#ifdef __cplusplus
+// Colors a canvas context was assigned recently, so setting the same few
+// strings again and again does not parse them every time. Entries are found
+// by the hash v8 keeps with every string and compared by identity first,
+// which is all it takes for literals, since v8 interns them.
+class EJColorCache {
+public:
+	EJColorRGBA get (v8::Isolate* isolate, v8::Local<v8::Value> value);
+
+private:
+	static const int kSize = 64;
+	struct Entry {
+		v8::Global<v8::String> string;
+		EJColorRGBA color;
+	};
+	Entry _entries[kSize];
+};
+#endif
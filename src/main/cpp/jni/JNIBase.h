@@ -13,6 +13,17 @@ class JNIClassInfo;
 class JNIWrapper;
 template<class ScopeClass, class BaseClass> class JNIScope;
 
+const size_t kJNIUnregisteredTypeId = (size_t)-1;
+
+/**
+ * id of a native type linked with BGJS_JNI_LINK; assigned when the type is registered with JNIWrapper
+ * ids index the class registries of JNIWrapper and JNIV8Wrapper, so looking up a type needs neither its name nor a map
+ */
+template <typename T> struct JNITypeId {
+    static size_t value;
+};
+template <typename T> size_t JNITypeId<T>::value = kJNIUnregisteredTypeId;
+
 class JNIBase {
     template<class ScopeClass, class BaseClass> friend class JNIScope;
 public:
@@ -23,12 +34,15 @@ public:
      * returns the canonical name of the java class associated with the specified native object
      */
     template <typename T> static
-    const std::string getCanonicalName() {
+    const std::string& getCanonicalName() {
         JNI_ASSERT(0, "JNIBase::getCanonicalName called for unregistered class");
-        return "<unknown>";
+        static const std::string unknown("<unknown>");
+        return unknown;
     }
 
     const std::string& getCanonicalName() const;
+    // id of the java class of this object in the class registries, see JNITypeId
+    size_t getTypeId() const;
     const jclass getJClass() const;
     const std::string getSignature() const;
 
@@ -43,7 +57,7 @@ protected:
  * specify the native class, and the full canonical name of the associated java class
  * BGJS_JNI_LINK has to be implemented in the native classes .cpp file, and BGJS_JNI_LINK_DEF goes into the header to make the link known
  */
-#define BGJS_JNI_LINK(type, canonicalName) template<> const std::string JNIBase::getCanonicalName<type>() { return canonicalName; };
-#define BGJS_JNI_LINK_DEF(type) template<> const std::string JNIBase::getCanonicalName<type>();
+#define BGJS_JNI_LINK(type, canonicalName) template<> const std::string& JNIBase::getCanonicalName<type>() { static const std::string name(canonicalName); return name; };
+#define BGJS_JNI_LINK_DEF(type) template<> const std::string& JNIBase::getCanonicalName<type>();
 
 #endif //ANDROID_TRADINGLIB_SAMPLE_JNIBASE_H
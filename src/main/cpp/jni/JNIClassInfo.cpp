@@ -3,6 +3,8 @@
 //
 
 #include <jni.h>
+#include <stdlib.h>
+#include <sys/system_properties.h>
 
 #include "jni_assert.h"
 
@@ -10,7 +12,7 @@
 #include "JNIClassInfo.h"
 
 JNIClassInfo::JNIClassInfo(size_t hashCode, JNIObjectType  type, jclass clazz, const std::string& canonicalName, ObjectInitializer i, ObjectConstructor c, JNIClassInfo *baseClassInfo) :
-        hashCode(hashCode), type(type), canonicalName(canonicalName), initializer(i), constructor(c), baseClassInfo(baseClassInfo) {
+        hashCode(hashCode), typeId(kJNIUnregisteredTypeId), type(type), canonicalName(canonicalName), initializer(i), constructor(c), baseClassInfo(baseClassInfo) {
     // cache class
     // if we wanted to allow dynamic class unloading we could use a weak global ref and check it every time before creating/wrapping an object
     // but because that might happen from another thread we would have to make sure to use the correct class loader to reaquire it..
@@ -64,6 +66,21 @@ void JNIClassInfo::registerNativeMethod(const std::string &name, const std::stri
     methods.push_back({strdup(name.c_str()), strdup(signature.c_str()), fnPtr}); // freed after calling registerNatives
 }
 
+// @CriticalNative is honored from API 26 (O) on
+static bool supportsCriticalNatives() {
+    static const bool supported = [] {
+        char sdk[PROP_VALUE_MAX] = {0};
+        __system_property_get("ro.build.version.sdk", sdk);
+        return atoi(sdk) >= 26;
+    }();
+    return supported;
+}
+
+void JNIClassInfo::registerCriticalNativeMethod(const std::string &name, const std::string &signature, void* fnPtr, void* criticalFnPtr) {
+    JNI_ASSERTF(getMethodID(name, signature, true), "No matching static method '%s' with signature '%s'", name.c_str(), signature.c_str());
+    registerNativeMethod(name, signature, supportsCriticalNatives() ? criticalFnPtr : fnPtr);
+}
+
 void JNIClassInfo::registerConstructor(const std::string& signature, const std::string& alias) {
     registerMethod("<init>", signature, alias);
 }
@@ -5,6 +5,8 @@
 #ifndef __JNICLASSINFO_H
 #define __JNICLASSINFO_H
 
+#include <atomic>
+#include <stdint.h>
 #include <string>
 #include <vector>
 #include <map>
@@ -14,6 +16,8 @@ class JNIObject;
 class JNIWrapper;
 
 template<class ScopeClass, class BaseClass> class JNIScope;
+template<typename Signature> class JNIMethodHandle;
+template<typename Signature> class JNIStaticMethodHandle;
 
 enum class JNIObjectType {
     /**
@@ -50,12 +54,29 @@ struct JNIFieldInfo {
     jfieldID id;
 };
 
+/**
+ * always-on counters of the native objects of exactly one class, not including subclasses
+ * every counter is updated on its own with relaxed atomics, so a snapshot is only consistent per counter
+ */
+struct JNIClassStats {
+    std::atomic<int64_t> liveObjects{0};
+    std::atomic<int64_t> createdObjects{0};
+    // global references that keep the java objects alive
+    std::atomic<int64_t> strongRefs{0};
+    // persistents of js objects linked to JNIV8Objects
+    std::atomic<int64_t> jsObjects{0};
+    // bytes reported to v8 with AdjustAmountOfExternalAllocatedMemory for objects whose js object is alive
+    std::atomic<int64_t> externalMemory{0};
+};
+
 struct JNIClassInfo {
     friend class JNIBase;
     friend class JNIClass;
     friend class JNIObject;
     friend class JNIWrapper;
     template<class ScopeClass, class BaseClass> friend class JNIScope;
+    template<typename Signature> friend class JNIMethodHandle;
+    template<typename Signature> friend class JNIStaticMethodHandle;
 public:
     /**
      * register the callback for a native method
@@ -63,6 +84,17 @@ public:
      */
     void registerNativeMethod(const std::string &name, const std::string &signature, void* fnPtr);
 
+    /**
+     * register the callbacks for a static native method that is annotated with @CriticalNative in java
+     * from API 26 on ART calls criticalFnPtr, which takes neither JNIEnv nor jclass. Older versions ignore the annotation
+     * and call fnPtr with the regular signature.
+     * critical natives can only take and return primitives, and must neither use jni nor block
+     *
+     * Note: methods annotated with @FastNative need no special registration; they keep the regular signature, but must
+     * not block either: a thread waiting for a v8::Locker in a fast native can deadlock with the garbage collector
+     */
+    void registerCriticalNativeMethod(const std::string &name, const std::string &signature, void* fnPtr, void* criticalFnPtr);
+
     /**
      * register a constructor to be used with JNIWrapper::createObject later
      */
@@ -101,6 +133,10 @@ public:
     void registerField(const std::string& fieldName, const std::string& signature, const std::string& alias = "");
     void registerStaticField(const std::string& fieldName, const std::string& signature, const std::string& alias = "");
 
+    const std::string& getCanonicalName() const { return canonicalName; }
+
+    JNIClassStats stats;
+
 private:
     JNIClassInfo(size_t hashCode, JNIObjectType type, jclass clazz, const std::string& canonicalName, ObjectInitializer i, ObjectConstructor c, JNIClassInfo *baseClassInfo);
     void inherit();
@@ -121,6 +157,8 @@ private:
     jclass jniClassRef;
     std::string canonicalName;
     size_t hashCode;
+    // index in the class registry of JNIWrapper
+    size_t typeId;
     std::map<std::string, JNIMethodInfo> methodMap;
     std::map<std::string, JNIFieldInfo> fieldMap;
 };
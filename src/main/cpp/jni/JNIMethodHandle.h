@@ -0,0 +1,154 @@
+#ifndef __JNIMETHODHANDLE_H
+#define __JNIMETHODHANDLE_H
+
+#include <jni.h>
+#include "jni_assert.h"
+#include "JNIClassInfo.h"
+#include "JNIObject.h"
+#include "JNIWrapper.h"
+
+/**
+ * conversion of the argument types of java methods to jvalue
+ * jstring, jclass and all other references are passed as jobject
+ */
+inline jvalue JNIValue(jboolean value) { jvalue v; v.z = value; return v; }
+inline jvalue JNIValue(jbyte value) { jvalue v; v.b = value; return v; }
+inline jvalue JNIValue(jchar value) { jvalue v; v.c = value; return v; }
+inline jvalue JNIValue(jshort value) { jvalue v; v.s = value; return v; }
+inline jvalue JNIValue(jint value) { jvalue v; v.i = value; return v; }
+inline jvalue JNIValue(jlong value) { jvalue v; v.j = value; return v; }
+inline jvalue JNIValue(jfloat value) { jvalue v; v.f = value; return v; }
+inline jvalue JNIValue(jdouble value) { jvalue v; v.d = value; return v; }
+inline jvalue JNIValue(jobject value) { jvalue v; v.l = value; return v; }
+
+/**
+ * calls a method with the Call<Type>MethodA variant matching its return type
+ */
+template <typename ReturnType> struct JNIMethodInvoker;
+
+#define JNI_METHOD_INVOKER(JNITypeName, TypeName) \
+template <> struct JNIMethodInvoker<JNITypeName> {\
+    static JNITypeName call(JNIEnv *env, jobject object, jmethodID methodId, const jvalue *args) {\
+        return env->Call##TypeName##MethodA(object, methodId, args);\
+    }\
+    static JNITypeName callStatic(JNIEnv *env, jclass clazz, jmethodID methodId, const jvalue *args) {\
+        return env->CallStatic##TypeName##MethodA(clazz, methodId, args);\
+    }\
+};
+
+JNI_METHOD_INVOKER(void, Void)
+JNI_METHOD_INVOKER(jboolean, Boolean)
+JNI_METHOD_INVOKER(jbyte, Byte)
+JNI_METHOD_INVOKER(jchar, Char)
+JNI_METHOD_INVOKER(jshort, Short)
+JNI_METHOD_INVOKER(jint, Int)
+JNI_METHOD_INVOKER(jlong, Long)
+JNI_METHOD_INVOKER(jfloat, Float)
+JNI_METHOD_INVOKER(jdouble, Double)
+JNI_METHOD_INVOKER(jobject, Object)
+
+#undef JNI_METHOD_INVOKER
+
+/**
+ * deletes the local reference returned by JNIObject::getJObject once a call is done
+ */
+struct JNIObjectLocalRef {
+    JNIEnv *env;
+    jobject object;
+
+    JNIObjectLocalRef(JNIEnv *env, jobject object) : env(env), object(object) {}
+    ~JNIObjectLocalRef() {
+        env->DeleteLocalRef(object);
+    }
+};
+
+template <typename Signature> class JNIMethodHandle;
+template <typename Signature> class JNIStaticMethodHandle;
+
+/**
+ * typed handle for calling a java instance method
+ * resolved once (usually in initializeJNIBindings, and stored statically), so calling it needs neither a lookup by name
+ * nor varargs. The signature has to match the C++ types, e.g.
+ * JNIMethodHandle<jint(jobject)> requestAnimationFrame;
+ * requestAnimationFrame.resolve(info, "requestAnimationFrame", "(Lag/boersego/bgjs/JNIV8Function;)I");
+ */
+template <typename ReturnType, typename... ArgumentTypes>
+class JNIMethodHandle<ReturnType(ArgumentTypes...)> {
+public:
+    JNIMethodHandle() : _methodId(nullptr) {}
+
+    /**
+     * resolves the method on a class registered with JNIWrapper
+     */
+    void resolve(JNIClassInfo *info, const std::string &name, const std::string &signature) {
+        _methodId = info->getMethodID(name, signature, false);
+        JNI_ASSERTF(_methodId, "Method '%s' with signature '%s' does not exist on Java class", name.c_str(), signature.c_str());
+    }
+    /**
+     * resolves the method on any java class
+     */
+    void resolve(JNIEnv *env, jclass clazz, const char *name, const char *signature) {
+        _methodId = env->GetMethodID(clazz, name, signature);
+        JNI_ASSERTF(_methodId, "Method '%s' with signature '%s' does not exist on Java class", name, signature);
+    }
+
+    bool isResolved() const {
+        return _methodId != nullptr;
+    }
+
+    ReturnType call(JNIEnv *env, jobject object, ArgumentTypes... args) const {
+        // one more element than needed, so methods without arguments do not declare an empty array
+        const jvalue values[sizeof...(ArgumentTypes) + 1] = {JNIValue(args)...};
+        return JNIMethodInvoker<ReturnType>::call(env, object, _methodId, values);
+    }
+
+    /**
+     * calls the method on the java object of a native object
+     */
+    ReturnType call(JNIObject *object, ArgumentTypes... args) const {
+        JNIEnv *env = JNIWrapper::getEnvironment();
+        JNIObjectLocalRef javaObject(env, object->getJObject());
+        return call(env, javaObject.object, args...);
+    }
+
+private:
+    jmethodID _methodId;
+};
+
+/**
+ * typed handle for calling a static java method, see JNIMethodHandle
+ */
+template <typename ReturnType, typename... ArgumentTypes>
+class JNIStaticMethodHandle<ReturnType(ArgumentTypes...)> {
+public:
+    JNIStaticMethodHandle() : _clazz(nullptr), _methodId(nullptr) {}
+
+    void resolve(JNIClassInfo *info, const std::string &name, const std::string &signature) {
+        _clazz = info->jniClassRef;
+        _methodId = info->getMethodID(name, signature, true);
+        JNI_ASSERTF(_methodId, "Static method '%s' with signature '%s' does not exist on Java class", name.c_str(), signature.c_str());
+    }
+    /**
+     * resolves the method on any java class; clazz has to be a global reference
+     */
+    void resolve(JNIEnv *env, jclass clazz, const char *name, const char *signature) {
+        _clazz = clazz;
+        _methodId = env->GetStaticMethodID(clazz, name, signature);
+        JNI_ASSERTF(_methodId, "Static method '%s' with signature '%s' does not exist on Java class", name, signature);
+    }
+
+    bool isResolved() const {
+        return _methodId != nullptr;
+    }
+
+    ReturnType call(JNIEnv *env, ArgumentTypes... args) const {
+        const jvalue values[sizeof...(ArgumentTypes) + 1] = {JNIValue(args)...};
+        return JNIMethodInvoker<ReturnType>::callStatic(env, _clazz, _methodId, values);
+    }
+
+private:
+    jclass _clazz;
+    jmethodID _methodId;
+};
+
+#endif //__JNIMETHODHANDLE_H
@@ -4,11 +4,48 @@
 
 #include "jni_assert.h"
 
+#include <algorithm>
+#include <thread>
+#include <time.h>
+
 #include "JNIObject.h"
 #include "JNIWrapper.h"
 
 BGJS_JNI_LINK(JNIObject, "ag/boersego/bgjs/JNIObject");
 
+namespace {
+    // states of the strong reference of persistent objects
+    const uint8_t kGlobalRefWeak = 0;
+    const uint8_t kGlobalRefCreating = 1;
+    const uint8_t kGlobalRefStrong = 2;
+    const uint8_t kGlobalRefDeleting = 3;
+
+    // states of persistent objects in the queue of the finalizing daemon
+    const uint8_t kReleaseIdle = 0;
+    const uint8_t kReleaseQueued = 1;
+    const uint8_t kReleaseDisposed = 2;         // queued, and disposed from java: the daemon deletes it
+    const uint8_t kReleaseSweeping = 3;
+    const uint8_t kReleaseSweepingDirty = 4;    // released again while the daemon was looking at it
+
+    // strong references are kept at least this long after the last release
+    const int64_t kReleaseGracePeriodMs = 1000;
+    const int64_t kIdleSweepIntervalMs = 5000;
+
+    std::atomic<int64_t> _strongRefs(0), _weakRefs(0), _queuedReleases(0);
+    std::atomic<int64_t> _createdRefs(0), _deletedRefs(0), _reusedRefs(0);
+
+    // only accessed by the finalizing daemon
+    int64_t _nextSweepTime = 0;
+
+    int64_t currentTimeMs() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+    }
+}
+
+std::atomic<JNIObject*> JNIObject::_pendingReleases(nullptr);
+
 JNIObject::JNIObject(jobject obj, JNIClassInfo *info) : JNIBase(info) {
     JNIEnv* env = JNIWrapper::getEnvironment();
     if(info->type == JNIObjectType::kPersistent) {
@@ -16,14 +53,24 @@ JNIObject::JNIObject(jobject obj, JNIClassInfo *info) : JNIBase(info) {
         // => as long as there are no references to the c object, the java reference is weak.
         _jniObjectWeak = env->NewWeakGlobalRef(obj);
         _jniObject = nullptr;
+        _globalRefState = kGlobalRefWeak;
+        _weakRefs++;
     } else {
         // non-persistent objects are owned by the c side. they do not exist in this form on the java side
         // => as long as the object exists, the java reference should always be strong
         // theoretically we could use the same logic here, and make it non-weak on demand, but it simply is not necessary
         _jniObject = env->NewGlobalRef(obj);
         _jniObjectWeak = nullptr;
+        _globalRefState = kGlobalRefStrong;
+        _strongRefs++;
+        info->stats.strongRefs.fetch_add(1, std::memory_order_relaxed);
     }
+    info->stats.liveObjects.fetch_add(1, std::memory_order_relaxed);
+    info->stats.createdObjects.fetch_add(1, std::memory_order_relaxed);
     _atomicJniObjectRefCount = 0;
+    _releaseState = kReleaseIdle;
+    _releaseTime = 0;
+    _nextPendingRelease = nullptr;
 
     // store pointer to native instance in "nativeHandle" field
     // actually type will never be kAbstract here, because JNIClassInfo will be provided for the subclass!
@@ -39,18 +86,24 @@ JNIObject::JNIObject(jobject obj, JNIClassInfo *info) : JNIBase(info) {
 JNIObject::~JNIObject() {
     JNI_ASSERTF(_atomicJniObjectRefCount==0, "JNIObject (%s) was deleted while retaining java object (ref count: %d)", getCanonicalName().c_str(), _atomicJniObjectRefCount.load());
     if(_jniObject) {
-        // this should/can never happen for persistent objects
-        // if there is a strong ref to the JObject, then the native object must not be deleted!
-        // it can however happen for non-persistent objects!
+        // for persistent objects this only happens if they were disposed manually while the strong reference
+        // was still kept after the last release; it always happens for non-persistent objects
         JNIWrapper::getEnvironment()->DeleteGlobalRef(_jniObject);
-    } else if(_jniObjectWeak) {
+        _strongRefs--;
+        _jniClassInfo->stats.strongRefs.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if(_jniObjectWeak) {
         JNIWrapper::getEnvironment()->DeleteWeakGlobalRef(_jniObjectWeak);
+        _weakRefs--;
     }
+    _jniClassInfo->stats.liveObjects.fetch_sub(1, std::memory_order_relaxed);
     _jniObjectWeak = _jniObject = nullptr;
 }
 
 void JNIObject::initializeJNIBindings(JNIClassInfo *info, bool isReload) {
     info->registerNativeMethod("RegisterClass", "(Ljava/lang/String;Ljava/lang/String;)V", (void*)JNIObject::jniRegisterClass);
+    info->registerNativeMethod("ReleasePendingGlobalRefs", "()J", (void*)JNIObject::jniReleasePendingGlobalRefs);
+    info->registerNativeMethod("GetGlobalRefStats", "([J)V", (void*)JNIObject::jniGetGlobalRefStats);
 }
 
 bool JNIObject::isRetained() const {
@@ -70,65 +123,171 @@ const jobject JNIObject::getJObject() {
 }
 
 void JNIObject::retainJObject() {
-    // optimized for the case where an object is likely to be retained for longer times
-    // => just update the atomic counter, no locking
-    // if retain counter never rises above one it could be faster to always use a mutex and non-atomic counters
+    // optimized for objects that are retained and released over and over again:
+    // the strong reference is kept for a while after the last release, retaining the object again within that time
+    // only updates the atomic counter. No locking either way
 
     JNI_ASSERT(isPersistent(), "Attempt to retain non-persistent native object");
-    if(++_atomicJniObjectRefCount == 1) {
-        std::lock_guard<std::mutex> guard(_mutex);
-
-        // while this thread A was waiting for the mutex, the counter might have changed
-        // or another thread B could possible even already have created the object
-        // e.g. (0->1(A)->0->1(B), executed as 1->0->1 (B)(A)
-        // => check state here, guarded by mutex, and possibly do nothing
-        if(_atomicJniObjectRefCount==0 || _jniObject) {
+    if(_atomicJniObjectRefCount++ != 0) {
+        return;
+    }
+
+    // the first thread to get here creates the strong reference; any other just waits for it to be done,
+    // or for the finalizing daemon to finish deleting it
+    while(true) {
+        uint8_t state = kGlobalRefWeak;
+        if(_globalRefState.compare_exchange_weak(state, kGlobalRefCreating)) {
+            _jniObject = JNIWrapper::getEnvironment()->NewGlobalRef(_jniObjectWeak);
+            _globalRefState = kGlobalRefStrong;
+            _strongRefs++;
+            _createdRefs++;
+            _jniClassInfo->stats.strongRefs.fetch_add(1, std::memory_order_relaxed);
             return;
         }
-
-        JNIEnv *env = JNIWrapper::getEnvironment();
-        _jniObject = env->NewGlobalRef(_jniObjectWeak);
+        if(state == kGlobalRefStrong) {
+            _reusedRefs++;
+            return;
+        }
+        if(state != kGlobalRefWeak) {
+            std::this_thread::yield();
+        }
     }
 }
 
 void JNIObject::releaseJObject() {
-    // optimized for the case where an object is likely to be retained for longer times
-    // => just update the atomic counter, no locking
-    // if retain counter never rises above one it could be faster to always use a mutex and non-atomic counters
+    // the strong reference is not deleted here, but by the finalizing daemon once the object was not retained again
+    // for kReleaseGracePeriodMs; this also means that no jni functions are called here, even if an exception is pending
 
     JNI_ASSERT(isPersistent(), "Attempt to release non-persistent native object");
-    if(--_atomicJniObjectRefCount == 0) {
-        std::lock_guard<std::mutex> guard(_mutex);
-
-        // while this thread A was waiting for the mutex, the counter might have changed
-        // or another thread B could possible even already have released the object
-        // e.g. (1->0(A)->1->0(B), executed as 1->0->1 (B)(A)
-        // => check state here, guarded by mutex, and possibly do nothing
-        if(_atomicJniObjectRefCount > 0 || !_jniObject) {
+    if(--_atomicJniObjectRefCount != 0) {
+        return;
+    }
+    _releaseTime = currentTimeMs();
+    queueRelease();
+}
+
+void JNIObject::queueRelease() {
+    while(true) {
+        uint8_t state = _releaseState;
+        if(state == kReleaseIdle) {
+            if(!_releaseState.compare_exchange_weak(state, kReleaseQueued)) continue;
+            _queuedReleases++;
+            JNIObject *head = _pendingReleases;
+            do {
+                _nextPendingRelease = head;
+            } while(!_pendingReleases.compare_exchange_weak(head, this));
             return;
         }
+        if(state == kReleaseSweeping) {
+            // the daemon is looking at the object right now => it has to queue it again when done
+            if(!_releaseState.compare_exchange_weak(state, kReleaseSweepingDirty)) continue;
+            return;
+        }
+        // already queued
+        return;
+    }
+}
+
+bool JNIObject::sweepRelease(JNIEnv *env, int64_t time) {
+    uint8_t state = kReleaseQueued;
+    if(!_releaseState.compare_exchange_strong(state, kReleaseSweeping)) {
+        // the java object was disposed while the strong reference was kept: ownership was passed on to the daemon
+        JNI_ASSERT(state == kReleaseDisposed, "Invalid release state of queued JNIObject");
+        _queuedReleases--;
+        dispose();
+        return false;
+    }
+
+    if(_atomicJniObjectRefCount == 0) {
+        if(time - _releaseTime < kReleaseGracePeriodMs) {
+            _releaseState = kReleaseQueued;
+            return true;
+        }
+        uint8_t refState = kGlobalRefStrong;
+        if(_globalRefState.compare_exchange_strong(refState, kGlobalRefDeleting)) {
+            // the object might have been retained again in the meantime, which then waits for the state to change
+            if(_atomicJniObjectRefCount == 0) {
+                env->DeleteGlobalRef(_jniObject);
+                _jniObject = nullptr;
+                _globalRefState = kGlobalRefWeak;
+                _strongRefs--;
+                _deletedRefs++;
+                _jniClassInfo->stats.strongRefs.fetch_sub(1, std::memory_order_relaxed);
+            } else {
+                _globalRefState = kGlobalRefStrong;
+            }
+        }
+    }
+
+    // if the object was released while being looked at it has to stay queued
+    // NOTE: object might be deleted by another thread once it is idle
+    state = kReleaseSweeping;
+    if(_releaseState.compare_exchange_strong(state, kReleaseIdle)) {
+        _queuedReleases--;
+        return false;
+    }
+    _releaseState = kReleaseQueued;
+    return true;
+}
 
-        JNIEnv *env = JNIWrapper::getEnvironment();
-
-        // this method is executed automatically if a shared_ptr falls of the stack
-        // if an exception was thrown after the shared_ptr was created, we can
-        // not call any JNI functions without clearing the exception first and then rethrowing it
-        // In most cases this could be done in the method itself, but it is tedious and likely to be forgotten
-        // also, there are cases
-        // e.g. when an exception is thrown in a method that is not immediately called from Java/JNI, but the shared_ptr is used in a method further upp the call stack
-        // when it is very hard or even impossible to do this
-        // => handle this here!
-        jthrowable exc = nullptr;
-        if(env->ExceptionCheck()) {
-            exc = env->ExceptionOccurred();
-            env->ExceptionClear();
+bool JNIObject::deferDisposal() {
+    while(true) {
+        uint8_t state = _releaseState;
+        if(state == kReleaseIdle) {
+            return false;
         }
+        if(state == kReleaseQueued) {
+            if(_releaseState.compare_exchange_weak(state, kReleaseDisposed)) return true;
+        } else {
+            // the daemon is looking at the object right now
+            std::this_thread::yield();
+        }
+    }
+}
 
-        env->DeleteGlobalRef(_jniObject);
-        _jniObject = nullptr;
+void JNIObject::dispose() {
+    delete this;
+}
+
+jlong JNIObject::jniReleasePendingGlobalRefs(JNIEnv *env, jclass clazz) {
+    // only ever called by the finalizing daemon; it calls this after each finalized object, so sweeps are rate limited
+    const int64_t time = currentTimeMs();
+    if(time < _nextSweepTime) {
+        return _nextSweepTime - time;
+    }
+
+    JNIObject *requeued = nullptr, *requeuedTail = nullptr;
+    JNIObject *object = _pendingReleases.exchange(nullptr);
+    while(object) {
+        JNIObject *next = object->_nextPendingRelease;
+        if(object->sweepRelease(env, time)) {
+            object->_nextPendingRelease = requeued;
+            requeued = object;
+            if(!requeuedTail) requeuedTail = object;
+        }
+        object = next;
+    }
 
-        if(exc) env->Throw(exc);
+    if(requeued) {
+        JNIObject *head = _pendingReleases;
+        do {
+            requeuedTail->_nextPendingRelease = head;
+        } while(!_pendingReleases.compare_exchange_weak(head, requeued));
     }
+
+    _nextSweepTime = time + (requeued ? kReleaseGracePeriodMs : kIdleSweepIntervalMs);
+    return _nextSweepTime - time;
+}
+
+JNIGlobalRefStats JNIObject::getGlobalRefStats() {
+    return {_strongRefs, _weakRefs, _queuedReleases, _createdRefs, _deletedRefs, _reusedRefs};
+}
+
+void JNIObject::jniGetGlobalRefStats(JNIEnv *env, jclass clazz, jlongArray stats) {
+    const JNIGlobalRefStats refStats = getGlobalRefStats();
+    const jlong values[6] = { refStats.strongRefs, refStats.weakRefs, refStats.queuedReleases, refStats.createdRefs,
+                              refStats.deletedRefs, refStats.reusedRefs };
+    env->SetLongArrayRegion(stats, 0, std::min(env->GetArrayLength(stats), 6), values);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -190,8 +349,26 @@ extern "C" {
     JNIEXPORT bool JNICALL Java_ag_boersego_bgjs_JNIObjectReference_disposeNative(JNIEnv *env, jobject obj, jlong nativeHandle) {
         JNIObject *jniObject = reinterpret_cast<JNIObject*>(nativeHandle);
         if(jniObject->isRetained()) return false;
-        delete jniObject;
+        // objects waiting for the daemon to delete their strong reference are deleted by it
+        if(!jniObject->deferDisposal()) {
+            delete jniObject;
+        }
         return true;
     }
+
+    JNIEXPORT void JNICALL Java_ag_boersego_bgjs_JNIObjectReference_disposeNatives(JNIEnv *env, jclass clazz, jlongArray handles, jint count) {
+        // disposal of objects that need the isolate is deferred to the js thread, so this never waits for js
+        // handles of disposed objects are set to 0
+        jlong *nativeHandles = env->GetLongArrayElements(handles, nullptr);
+        for(jint i = 0; i < count; i++) {
+            JNIObject *jniObject = reinterpret_cast<JNIObject*>(nativeHandles[i]);
+            if(jniObject->isRetained()) continue;
+            if(!jniObject->deferDisposal()) {
+                jniObject->dispose();
+            }
+            nativeHandles[i] = 0;
+        }
+        env->ReleaseLongArrayElements(handles, nativeHandles, 0);
+    }
 }
 
@@ -7,9 +7,22 @@
 
 #import <string>
 #include <jni.h>
-#include <mutex>
+#include <atomic>
+#include <memory>
 #include "JNIBase.h"
 
+/**
+ * global references held by JNIObjects, see JNIObject::getGlobalRefStats
+ */
+struct JNIGlobalRefStats {
+    int64_t strongRefs;         // strong global references currently held
+    int64_t weakRefs;           // weak global references currently held
+    int64_t queuedReleases;     // objects waiting for the finalizing daemon to delete their strong reference
+    int64_t createdRefs;        // strong references created by retainJObject so far
+    int64_t deletedRefs;        // strong references deleted by the finalizing daemon so far
+    int64_t reusedRefs;         // retains that found the strong reference still kept from the last release
+};
+
 /**
  * Base class for all native classes associated with a java object
  * constructor should never be called manually; if you want to create a new instance
@@ -46,6 +59,23 @@ public:
     jshort callJavaShortMethod(const char* name, ...);
     jobject callJavaObjectMethod(const char* name, ...);
 
+    /**
+     * returns the number of global references held by all JNIObjects
+     */
+    static JNIGlobalRefStats getGlobalRefStats();
+
+    /**
+     * called when the java object was disposed or garbage collected, and the object is not retained
+     * returns true if the finalizing daemon still references the object; it is deleted by the daemon then
+     */
+    bool deferDisposal();
+
+    /**
+     * called once the java object was garbage collected and the object can be destroyed; deletes it by default
+     * objects whose destructors need locks held by other threads can hand themselves off to those threads instead
+     */
+    virtual void dispose();
+
 protected:
     void retainJObject();
     void releaseJObject();
@@ -53,13 +83,23 @@ protected:
 private:
     static void initializeJNIBindings(JNIClassInfo *info, bool isReload);
     static void jniRegisterClass(JNIEnv *env, jobject obj, jstring derivedClass, jstring baseClass);
+    static jlong jniReleasePendingGlobalRefs(JNIEnv *env, jclass clazz);
+    static void jniGetGlobalRefStats(JNIEnv *env, jclass clazz, jlongArray stats);
+
+    void queueRelease();
+    bool sweepRelease(JNIEnv *env, int64_t time);
 
-    std::mutex _mutex;
-    //pthread_mutex_t _mutex;
     jobject _jniObject;
     jweak _jniObjectWeak;
-    std::atomic<uint8_t> _atomicJniObjectRefCount;
+    std::atomic<uint32_t> _atomicJniObjectRefCount;
     std::weak_ptr<JNIObject> _weakPtr;
+
+    // state of _jniObject, and of the queue of the finalizing daemon
+    std::atomic<uint8_t> _globalRefState;
+    std::atomic<uint8_t> _releaseState;
+    std::atomic<int64_t> _releaseTime;
+    JNIObject *_nextPendingRelease;
+    static std::atomic<JNIObject*> _pendingReleases;
 };
 
 BGJS_JNI_LINK_DEF(JNIObject)
@@ -6,6 +6,7 @@
 #define ANDROID_GUIDANTS_JNIREF_H
 
 #include <jni.h>
+#include <atomic>
 
 class JNILocalFrame {
 private:
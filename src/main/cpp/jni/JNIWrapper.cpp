@@ -7,18 +7,25 @@
 #include <cstdlib>
 #include "JNIWrapper.h"
 
-pthread_key_t JNIWrapper::_jniEnvKey = NULL;
-pthread_key_t JNIWrapper::_jniDetachThreadKey = NULL;
+#include <vector>
 
-void JNIWrapper::detachThread(void* _) {
-    _jniVM->DetachCurrentThread();
+thread_local JNIEnv* JNIWrapper::_threadEnv = nullptr;
+
+namespace {
+    // true if getEnvironment attached the current thread to the vm
+    thread_local bool _isAttachedThread = false;
+
+    // constructed by the first attach of a thread; detaches it when the thread exits
+    struct JNIThreadAttachment {
+        ~JNIThreadAttachment() {
+            JNIWrapper::detachCurrentThread();
+        }
+    };
 }
 
 void JNIWrapper::init(JavaVM *vm) {
     _jniVM = vm;
 
-    pthread_key_create(&_jniEnvKey, NULL);
-    pthread_key_create(&_jniDetachThreadKey, &detachThread);
     JNIEnv *env = JNIWrapper::getEnvironment();
 
     _jniStringClass = (jclass)env->NewGlobalRef(env->FindClass("java/lang/String"));
@@ -27,7 +34,7 @@ void JNIWrapper::init(JavaVM *vm) {
                                           "(Ljava/lang/String;)[B");
     _jniCharsetName = (jstring)env->NewGlobalRef(env->NewStringUTF("UTF-8"));
 
-    _registerObject(typeid(JNIObject).hash_code(), JNIObjectType::kAbstract,
+    JNITypeId<JNIObject>::value = _registerObject(typeid(JNIObject).hash_code(), JNIObjectType::kAbstract,
                     JNIBase::getCanonicalName<JNIObject>(), "", initialize<JNIObject>, nullptr);
 }
 
@@ -38,7 +45,11 @@ bool JNIWrapper::isInitialized() {
 bool JNIWrapper::isObjectInstanceOf(JNIObject *obj, const std::string &canonicalName) {
     auto it = _objmap.find(canonicalName);
     if(it == _objmap.end()) return false;
-    JNIClassInfo *info = it->second;
+    return _isObjectInstanceOf(obj, it->second);
+}
+
+bool JNIWrapper::_isObjectInstanceOf(JNIObject *obj, JNIClassInfo *info) {
+    if(!info) return false;
     JNIClassInfo *info2 = obj->_jniClassInfo;
     while(info2 != info) {
         info2 = info2->baseClassInfo;
@@ -49,13 +60,14 @@ bool JNIWrapper::isObjectInstanceOf(JNIObject *obj, const std::string &canonical
     return true;
 }
 
-void JNIWrapper::_registerObject(size_t hashCode, JNIObjectType type,
+size_t JNIWrapper::_registerObject(size_t hashCode, JNIObjectType type,
                                  const std::string &canonicalName, const std::string &baseCanonicalName,
                                  ObjectInitializer i, ObjectConstructor c) {
     // canonicalName may be already registered
     // (e.g. when called from JNI_OnLoad; when using multiple linked libraries it is called once for each library)
-    if(_objmap.find(canonicalName) != _objmap.end()) {
-        return;
+    auto registered = _objmap.find(canonicalName);
+    if(registered != _objmap.end()) {
+        return registered->second->typeId;
     }
 
     JNI_ASSERT(baseCanonicalName != "<unknown>" && canonicalName != "<unknown>", "Could not resolve canonicalnames; missing BGJS_JNI_LINK_DEF?");
@@ -68,19 +80,19 @@ void JNIWrapper::_registerObject(size_t hashCode, JNIObjectType type,
         it = _objmap.find(baseCanonicalName);
         if (it == _objmap.end()) {
             JNI_ASSERT(0, "Attempt to register objects with unknown super class");
-            return;
+            return kJNIUnregisteredTypeId;
         }
         baseInfo = it->second;
 
         // pure java objects can not directly extend JNIObject
         if(JNIBase::getCanonicalName<JNIObject>() == baseCanonicalName && !i) {
             JNI_ASSERT(0, "Pure java objects must not directly extend JNIObject");
-            return;
+            return kJNIUnregisteredTypeId;
         }
     } else if(canonicalName != JNIBase::getCanonicalName<JNIObject>()) {
         // an empty base class is only allowed here for internally registering JNIObject itself
         JNI_ASSERT(0, "Attempt to register an object without super class");
-        return;
+        return kJNIUnregisteredTypeId;
     }
 
     if(baseInfo) {
@@ -90,7 +102,7 @@ void JNIWrapper::_registerObject(size_t hashCode, JNIObjectType type,
             do {
                 if (baseInfo2->type != JNIObjectType::kTemporary && baseInfo2->baseClassInfo) {
                     JNI_ASSERT(0, "Temporary classes can only extend JNIObject or other temporary classes");
-                    return;
+                    return kJNIUnregisteredTypeId;
                 }
                 baseInfo2 = baseInfo->baseClassInfo;
             } while (baseInfo2);
@@ -98,7 +110,7 @@ void JNIWrapper::_registerObject(size_t hashCode, JNIObjectType type,
                    baseInfo->type != type) {
             // temporary classes can only be extended by other temporary classes!
             JNI_ASSERT(0, "Temporary classes can only be extended by other temporary classes");
-            return;
+            return kJNIUnregisteredTypeId;
         }
     }
 
@@ -111,6 +123,8 @@ void JNIWrapper::_registerObject(size_t hashCode, JNIObjectType type,
     JNI_ASSERTF(clazz != NULL, "Class '%s' not found", canonicalName.c_str());
 
     JNIClassInfo *info = new JNIClassInfo(hashCode, type, clazz, canonicalName, i, c, baseInfo);
+    info->typeId = _classInfos.size();
+    _classInfos.push_back(info);
     _objmap[canonicalName] = info;
 
     info->inherit();
@@ -143,23 +157,31 @@ void JNIWrapper::_registerObject(size_t hashCode, JNIObjectType type,
             info->methods.clear();
         }
     }
+
+    return info->typeId;
 }
 
-JNIEnv* JNIWrapper::getEnvironment() {
-    JNIEnv* env = static_cast<JNIEnv*>(pthread_getspecific(_jniEnvKey));
-    if (!env) {
-        int r = _jniVM->GetEnv((void **) &env, JNI_VERSION_1_6);
-        if (r != JNI_OK) {
-            int r = _jniVM->AttachCurrentThread(&env, nullptr);
-            JNI_ASSERT(r == JNI_OK, "Failed to attach thread to JVM");
-            pthread_setspecific(_jniDetachThreadKey, (void*)(r < 0 ? 1 : r+1));   // Actual value doesn't matter as long as its non-NULL
-        }
-        pthread_setspecific(_jniEnvKey, (void*)env);
+JNIEnv* JNIWrapper::attachCurrentThread() {
+    JNIEnv* env = nullptr;
+    if (_jniVM->GetEnv((void **) &env, JNI_VERSION_1_6) != JNI_OK) {
+        int r = _jniVM->AttachCurrentThread(&env, nullptr);
+        JNI_ASSERT(r == JNI_OK, "Failed to attach thread to JVM");
+        static thread_local JNIThreadAttachment attachment;
+        _isAttachedThread = true;
     }
+    _threadEnv = env;
 
     return env;
 }
 
+void JNIWrapper::detachCurrentThread() {
+    if (_isAttachedThread) {
+        _isAttachedThread = false;
+        _jniVM->DetachCurrentThread();
+    }
+    _threadEnv = nullptr;
+}
+
 void JNIWrapper::initializeNativeObject(jobject object, jstring className) {
     JNIEnv* env = JNIWrapper::getEnvironment();
 
@@ -180,21 +202,22 @@ jobject JNIWrapper::_createObject(const std::string& canonicalName, const char*
     auto it = _objmap.find(canonicalName);
     if (it == _objmap.end()) {
         return nullptr;
-    } else {
-        JNIClassInfo *info = it->second;
+    }
+    return _createObject(it->second, constructorAlias, constructorArgs);
+}
 
-        if(info->type == JNIObjectType::kAbstract) return nullptr;
+jobject JNIWrapper::_createObject(JNIClassInfo *info, const char* constructorAlias, va_list constructorArgs) {
+    if(!info || info->type == JNIObjectType::kAbstract) return nullptr;
 
-        JNIEnv *env = JNIWrapper::getEnvironment();
+    JNIEnv *env = JNIWrapper::getEnvironment();
 
-        jmethodID constructor;
-        if (!constructorAlias) {
-            constructor = info->methodMap.at("<init>").id;
-            return env->NewObject(info->jniClassRef, constructor);
-        } else {
-            constructor = info->methodMap.at(constructorAlias).id;
-            return env->NewObjectV(info->jniClassRef, constructor, constructorArgs);
-        }
+    jmethodID constructor;
+    if (!constructorAlias) {
+        constructor = info->methodMap.at("<init>").id;
+        return env->NewObject(info->jniClassRef, constructor);
+    } else {
+        constructor = info->methodMap.at(constructorAlias).id;
+        return env->NewObjectV(info->jniClassRef, constructor, constructorArgs);
     }
 }
 
@@ -220,14 +243,44 @@ std::string JNIWrapper::jstring2string(jstring string) {
         return "";
     }
 
-    const jbyteArray stringJbytes = (jbyteArray) env->CallObjectMethod(string, _jniStringGetBytes, _jniCharsetName);
-    const jsize length = env->GetArrayLength(stringJbytes);
-    jbyte* pBytes = env->GetByteArrayElements(stringJbytes, NULL);
-
-    std::string ret = std::string((char *)pBytes, (unsigned long)length);
+    // copy the utf-16 contents and encode them here instead of having java create a byte array
+    const jsize length = env->GetStringLength(string);
+    jchar stackChars[256];
+    jchar *chars = length <= 256 ? stackChars : new jchar[length];
+    env->GetStringRegion(string, 0, length, chars);
+
+    std::string ret;
+    ret.reserve((size_t)length);
+    for(jsize i = 0; i < length; i++) {
+        uint32_t c = chars[i];
+        if(c >= 0xD800 && c <= 0xDFFF) {
+            if(c <= 0xDBFF && i + 1 < length && chars[i + 1] >= 0xDC00 && chars[i + 1] <= 0xDFFF) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (chars[++i] - 0xDC00);
+            } else {
+                // unpaired surrogates are replaced just like String.getBytes does
+                c = '?';
+            }
+        }
+        if(c < 0x80) {
+            ret += (char)c;
+        } else if(c < 0x800) {
+            ret += (char)(0xC0 | (c >> 6));
+            ret += (char)(0x80 | (c & 0x3F));
+        } else if(c < 0x10000) {
+            ret += (char)(0xE0 | (c >> 12));
+            ret += (char)(0x80 | ((c >> 6) & 0x3F));
+            ret += (char)(0x80 | (c & 0x3F));
+        } else {
+            ret += (char)(0xF0 | (c >> 18));
+            ret += (char)(0x80 | ((c >> 12) & 0x3F));
+            ret += (char)(0x80 | ((c >> 6) & 0x3F));
+            ret += (char)(0x80 | (c & 0x3F));
+        }
+    }
 
-    env->ReleaseByteArrayElements(stringJbytes, pBytes, JNI_ABORT);
-    env->DeleteLocalRef(stringJbytes);
+    if(chars != stackChars) {
+        delete[] chars;
+    }
 
     return ret;
 }
@@ -239,6 +292,18 @@ jstring JNIWrapper::string2jstring(const std::string& string) {
     JNIEnv *env = JNIWrapper::getEnvironment();
     JNI_ASSERT(env, "JNI Environment not initialized");
 
+    // plain ascii is valid modified utf-8, so it can be passed to the vm directly
+    bool isAscii = true;
+    for(const char c : string) {
+        if(!c || (unsigned char)c >= 0x80) {
+            isAscii = false;
+            break;
+        }
+    }
+    if(isAscii) {
+        return env->NewStringUTF(string.c_str());
+    }
+
     jsize len =  (jsize)string.length();
 
     const jbyteArray bytes = env->NewByteArray(len);
@@ -251,7 +316,46 @@ jstring JNIWrapper::string2jstring(const std::string& string) {
     return javaString;
 }
 
+jstring JNIWrapper::utf82jstring(JNIEnv *env, const char *utf8, size_t length) {
+    // never more utf-16 units than bytes
+    std::vector<jchar> chars(length);
+    size_t count = 0;
+    const unsigned char *s = (const unsigned char*)utf8;
+    for(size_t i = 0; i < length;) {
+        const unsigned char c = s[i];
+        uint32_t cp;
+        size_t n;
+        if(c < 0x80) { cp = c; n = 1; }
+        else if((c & 0xe0) == 0xc0) { cp = c & 0x1f; n = 2; }
+        else if((c & 0xf0) == 0xe0) { cp = c & 0x0f; n = 3; }
+        else if((c & 0xf8) == 0xf0) { cp = c & 0x07; n = 4; }
+        else { chars[count++] = 0xfffd; i++; continue; }
+
+        size_t j = 1;
+        for(; j < n && i + j < length && (s[i + j] & 0xc0) == 0x80; j++) {
+            cp = (cp << 6) | (s[i + j] & 0x3f);
+        }
+        // truncated, overlong and out of range sequences and surrogates are replaced as a whole
+        static const uint32_t kMin[] = { 0, 0, 0x80, 0x800, 0x10000 };
+        if(j < n || cp < kMin[n] || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff)) {
+            chars[count++] = 0xfffd;
+            i += j;
+            continue;
+        }
+        if(cp >= 0x10000) {
+            cp -= 0x10000;
+            chars[count++] = (jchar)(0xd800 + (cp >> 10));
+            chars[count++] = (jchar)(0xdc00 + (cp & 0x3ff));
+        } else {
+            chars[count++] = (jchar)cp;
+        }
+        i += n;
+    }
+    return env->NewString(chars.data(), (jsize)count);
+}
+
 std::map<std::string, JNIClassInfo*> JNIWrapper::_objmap;
+std::vector<JNIClassInfo*> JNIWrapper::_classInfos;
 jfieldID JNIWrapper::_jniNativeHandleFieldID = nullptr;
 JavaVM* JNIWrapper::_jniVM = nullptr;
 jstring JNIWrapper::_jniCharsetName = nullptr;
@@ -21,7 +21,19 @@
 class JNIWrapper {
 public:
     static void init(JavaVM *vm);
-    static JNIEnv* getEnvironment();
+    /**
+     * returns the environment of the current thread
+     * threads that are not known to the vm yet are attached on the first call, and detached again when they exit
+     */
+    static inline JNIEnv* getEnvironment() {
+        JNIEnv *env = _threadEnv;
+        return env ? env : attachCurrentThread();
+    }
+    /**
+     * detaches the current thread if it was attached by getEnvironment
+     * only needed by threads that keep running after they are done with java
+     */
+    static void detachCurrentThread();
     static bool isInitialized();
 
     /**
@@ -29,7 +41,7 @@ public:
      */
     static bool isObjectInstanceOf(JNIObject *obj, const std::string &canonicalName);
     template<class ObjectType> static bool isObjectInstanceOf(JNIObject *obj) {
-        return isObjectInstanceOf(obj, JNIBase::getCanonicalName<ObjectType>());
+        return _isObjectInstanceOf(obj, _getClassInfo<ObjectType>());
     }
 
     /**
@@ -44,10 +56,11 @@ public:
      * register a Java+Native object tuple
      * E.g. if there is a Java class "MyObject" with native class "MyObjectNative" you would call
      * registerObject<MyObjectNative>()
+     * all register methods return the type id of the java class (kJNIUnregisteredTypeId if it could not be registered)
      */
     template<class ObjectType> static
-    void registerObject(JNIObjectType type = JNIObjectType::kPersistent) {
-        _registerObject(typeid(ObjectType).hash_code(), type, JNIBase::getCanonicalName<ObjectType>(), JNIBase::getCanonicalName<JNIObject>(),
+    size_t registerObject(JNIObjectType type = JNIObjectType::kPersistent) {
+        return JNITypeId<ObjectType>::value = _registerObject(typeid(ObjectType).hash_code(), type, JNIBase::getCanonicalName<ObjectType>(), JNIBase::getCanonicalName<JNIObject>(),
                         initialize<ObjectType>, type != JNIObjectType::kTemporary ? instantiate<ObjectType> : nullptr);
     };
 
@@ -58,8 +71,8 @@ public:
      * registerObject<MySubclassNative, MyObjectNative>()
      */
     template<class ObjectType, class BaseObjectType> static
-    void registerObject(JNIObjectType type = JNIObjectType::kPersistent) {
-        _registerObject(typeid(ObjectType).hash_code(), type, JNIBase::getCanonicalName<ObjectType>(), JNIBase::getCanonicalName<BaseObjectType>(),
+    size_t registerObject(JNIObjectType type = JNIObjectType::kPersistent) {
+        return JNITypeId<ObjectType>::value = _registerObject(typeid(ObjectType).hash_code(), type, JNIBase::getCanonicalName<ObjectType>(), JNIBase::getCanonicalName<BaseObjectType>(),
                         initialize<ObjectType>, type != JNIObjectType::kTemporary ? instantiate<ObjectType> : nullptr);
     };
 
@@ -69,8 +82,8 @@ public:
      * registerJavaObject<MyObjectNative>("com/example/MyJavaSubclass")
      */
     template<class ObjectType> static
-    void registerJavaObject(const std::string &canonicalName, JNIObjectType type = JNIObjectType::kPersistent) {
-        _registerObject(typeid(void).hash_code(), type, canonicalName, JNIBase::getCanonicalName<ObjectType>(), nullptr, nullptr);
+    size_t registerJavaObject(const std::string &canonicalName, JNIObjectType type = JNIObjectType::kPersistent) {
+        return _registerObject(typeid(void).hash_code(), type, canonicalName, JNIBase::getCanonicalName<ObjectType>(), nullptr, nullptr);
     };
     /**
      * this overload is primarily used for registering java classes directly from java where the template version above can not be used
@@ -78,8 +91,8 @@ public:
      * The base class MUST have been registered as a Java+Native tuple previously!
      */
     static
-    void registerJavaObject(const std::string &canonicalName, const std::string &baseCanonicalName, JNIObjectType type = JNIObjectType::kPersistent) {
-        _registerObject(typeid(void).hash_code(), type, canonicalName, baseCanonicalName, nullptr, nullptr);
+    size_t registerJavaObject(const std::string &canonicalName, const std::string &baseCanonicalName, JNIObjectType type = JNIObjectType::kPersistent) {
+        return _registerObject(typeid(void).hash_code(), type, canonicalName, baseCanonicalName, nullptr, nullptr);
     };
 
     /**
@@ -91,7 +104,7 @@ public:
     JNIRetainedRef<ObjectType> createObject(const char *constructorAlias = nullptr, ...) {
         va_list args;
         va_start(args, constructorAlias);
-        jobject obj = _createObject(JNIBase::getCanonicalName<ObjectType>(), constructorAlias, args);
+        jobject obj = _createObject(_getClassInfo<ObjectType>(), constructorAlias, args);
         va_end(args);
         JNIRetainedRef<ObjectType> ptr = JNIRetainedRef<ObjectType>::New(JNIWrapper::wrapObject<ObjectType>(obj));
         JNIWrapper::getEnvironment()->DeleteLocalRef(obj);
@@ -100,7 +113,7 @@ public:
 
     template <typename ObjectType> static
     JNIRetainedRef<ObjectType> createObject(const char *constructorAlias, va_list args) {
-        jobject obj = _createObject(JNIBase::getCanonicalName<ObjectType>(), constructorAlias, args);
+        jobject obj = _createObject(_getClassInfo<ObjectType>(), constructorAlias, args);
         JNIRetainedRef<ObjectType> ptr = JNIRetainedRef<ObjectType>::New(JNIWrapper::wrapObject<ObjectType>(obj));
         JNIWrapper::getEnvironment()->DeleteLocalRef(obj);
         return ptr;
@@ -140,11 +153,10 @@ public:
      */
     template <typename ObjectType> static
     JNILocalRef<ObjectType> wrapObject(jobject object) {
-        auto it = _objmap.find(JNIBase::getCanonicalName<ObjectType>());
-        if (!object || it == _objmap.end()){
+        JNIClassInfo *info = _getClassInfo<ObjectType>();
+        if (!object || !info){
             return nullptr;
         } else {
-            JNIClassInfo *info = it->second;
             JNIObject *jniObject;
             JNIEnv* env = JNIWrapper::getEnvironment();
             if(info->type == JNIObjectType::kPersistent || info->type == JNIObjectType::kAbstract) {
@@ -193,6 +205,11 @@ public:
      * convert a std::string to a jstring
      */
     static jstring string2jstring(const std::string& string);
+    /**
+     * convert standard utf-8, which may contain 4 byte sequences and nul characters, to a jstring through utf-16;
+     * invalid sequences become U+FFFD. Unlike string2jstring it calls no java code, so it is safe everywhere
+     */
+    static jstring utf82jstring(JNIEnv *env, const char *utf8, size_t length);
 
     /**
      * creates a native object based on the specified class name
@@ -201,16 +218,30 @@ public:
      * - createObject<NativeType>() if you want to create a new Java+Native object tuple
      */
     static void initializeNativeObject(jobject object, jstring canonicalName);
+
+    /**
+     * returns all registered classes, e.g. for their stats
+     * classes are registered while the library is initialized; this must not be called concurrently with that
+     */
+    static std::vector<JNIClassInfo*> getClassInfos() { return _classInfos; }
 private:
-    static void detachThread(void* _);
+    static JNIEnv* attachCurrentThread();
     // Factory method for creating objects
     static jobject _createObject(const std::string& canonicalName, const char* constructorAlias, va_list constructorArgs);
+    static jobject _createObject(JNIClassInfo *info, const char* constructorAlias, va_list constructorArgs);
     static std::shared_ptr<JNIClass> _wrapClass(const std::string& canonicalName);
 
-    static void _registerObject(size_t hashCode, JNIObjectType type, const std::string& canonicalName, const std::string& baseCanonicalName, ObjectInitializer i, ObjectConstructor c);
+    static size_t _registerObject(size_t hashCode, JNIObjectType type, const std::string& canonicalName, const std::string& baseCanonicalName, ObjectInitializer i, ObjectConstructor c);
+    static bool _isObjectInstanceOf(JNIObject *obj, JNIClassInfo *info);
+
+    template <typename ObjectType> static
+    JNIClassInfo* _getClassInfo() {
+        const size_t typeId = JNITypeId<ObjectType>::value;
+        return typeId < _classInfos.size() ? _classInfos[typeId] : nullptr;
+    }
 
     static JavaVM *_jniVM;
-    static pthread_key_t _jniEnvKey, _jniDetachThreadKey;
+    static thread_local JNIEnv *_threadEnv;
     static jfieldID _jniNativeHandleFieldID;
 
     static jclass _jniStringClass;
@@ -219,6 +250,8 @@ private:
     static jstring _jniCharsetName;
 
     static std::map<std::string, JNIClassInfo*> _objmap;
+    // indexed by type id
+    static std::vector<JNIClassInfo*> _classInfos;
 
     template<class ObjectType>
     static JNIObject* instantiate(jobject obj, JNIClassInfo *info) {
@@ -11,5 +11,6 @@
 #include "JNIObject.h"
 #include "JNIWrapper.h"
 #include "JNIScope.h"
+#include "JNIMethodHandle.h"
 
 #endif //ANDROID_TRADINGLIB_SAMPLE_JNI_H
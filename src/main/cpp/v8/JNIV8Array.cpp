@@ -4,11 +4,15 @@
 
 #include "JNIV8Array.h"
 #include "JNIV8Wrapper.h"
+#include "JNIV8Record.h"
 #include "../bgjs/BGJSV8Engine.h"
 
+#include <vector>
+
 BGJS_JNI_LINK(JNIV8Array, "ag/boersego/bgjs/JNIV8Array");
 
 decltype(JNIV8Array::_jniObject) JNIV8Array::_jniObject = {0};
+decltype(JNIV8Array::_jniElementCallback) JNIV8Array::_jniElementCallback = {0};
 
 /**
  * cache JNI class references
@@ -16,6 +20,9 @@ decltype(JNIV8Array::_jniObject) JNIV8Array::_jniObject = {0};
 void JNIV8Array::initJNICache() {
     JNIEnv *env = JNIWrapper::getEnvironment();
     _jniObject.clazz = (jclass)env->NewGlobalRef(env->FindClass("java/lang/Object"));
+
+    _jniElementCallback.clazz = (jclass)env->NewGlobalRef(env->FindClass("ag/boersego/bgjs/JNIV8Array$ElementCallback"));
+    _jniElementCallback.onElementId = env->GetMethodID(_jniElementCallback.clazz, "onElement", "(ILjava/lang/Object;)V");
 }
 
 bool JNIV8Array::isWrappableV8Object(v8::Local<v8::Object> object) {
@@ -29,6 +36,62 @@ void JNIV8Array::initializeJNIBindings(JNIClassInfo *info, bool isReload) {
     info->registerNativeMethod("getV8Length", "()I", (void*)JNIV8Array::jniGetV8Length);
     info->registerNativeMethod("_getV8Elements", "(IILjava/lang/Class;II)[Ljava/lang/Object;", (void*)JNIV8Array::jniGetV8ElementsInRange);
     info->registerNativeMethod("_getV8Element", "(IILjava/lang/Class;I)Ljava/lang/Object;", (void*)JNIV8Array::jniGetV8Element);
+    info->registerNativeMethod("CreateWithDoubles", "(Lag/boersego/bgjs/V8Engine;[D)Lag/boersego/bgjs/JNIV8Array;", (void*)JNIV8Array::jniCreateWithDoubles);
+    info->registerNativeMethod("CreateWithInts", "(Lag/boersego/bgjs/V8Engine;[I)Lag/boersego/bgjs/JNIV8Array;", (void*)JNIV8Array::jniCreateWithInts);
+    info->registerNativeMethod("CreateWithRecords", "(Lag/boersego/bgjs/V8Engine;Ljava/lang/Class;[Ljava/lang/Object;)Lag/boersego/bgjs/JNIV8Array;", (void*)JNIV8Array::jniCreateWithRecords);
+    info->registerNativeMethod("_getV8Doubles", "(III)[D", (void*)JNIV8Array::jniGetV8DoublesInRange);
+    info->registerNativeMethod("_getV8Ints", "(III)[I", (void*)JNIV8Array::jniGetV8IntsInRange);
+    info->registerNativeMethod("_forEach", "(IILjava/lang/Class;Lag/boersego/bgjs/JNIV8Array$ElementCallback;)V", (void*)JNIV8Array::jniForEach);
+}
+
+/**
+ * converts the elements [from, from+size) of the array to the primitive type described by arg
+ * the values are collected natively, so the caller can copy them into a java array in one go
+ * returns false and throws a java exception if an element could not be converted
+ */
+template <typename T>
+static bool convertElementsInRange(JNIEnv *env, v8::Local<v8::Context> context, v8::Local<v8::Array> array,
+                                   const JNIV8JavaValue &arg, T jvalue::*member, uint32_t from, uint32_t size, std::vector<T> &target) {
+    v8::Isolate *isolate = context->GetIsolate();
+    jvalue jval;
+    target.resize(size);
+
+    for(uint32_t i = 0; i < size; i++) {
+        v8::Local<v8::Value> value;
+        if(!array->Get(context, from + i).ToLocal(&value)) {
+            value = v8::Undefined(isolate);
+        }
+
+        JNIV8MarshallingError res = JNIV8Marshalling::convertV8ValueToJavaValue(env, value, arg, &jval);
+        if(res != JNIV8MarshallingError::kOk) {
+            const std::string index = std::to_string(from + i);
+            switch(res) {
+                default:
+                case JNIV8MarshallingError::kWrongType:
+                    ThrowJNICastError("wrong type for value of element #" + index);
+                    break;
+                case JNIV8MarshallingError::kNoNaN:
+                    ThrowJNICastError("value of element #" + index + " must not be NaN");
+                    break;
+                case JNIV8MarshallingError::kOutOfRange:
+                    ThrowJNICastError("value '" + JNIV8Marshalling::v8string2string(value->ToString(isolate)) + "' is out of range for element #" + index);
+                    break;
+            }
+            return false;
+        }
+        target[i] = jval.*member;
+    }
+    return true;
+}
+
+/**
+ * clamps the range [from, to] to the array and returns the number of elements inside of it
+ */
+static uint32_t clampRange(v8::Local<v8::Array> array, jint &from, jint &to) {
+    uint32_t len = array->Length();
+    if(to>=len) to = len - 1;
+    if(from<0) from = 0;
+    return (from < len && from <= to) ? (uint32_t)((to-from)+1) : 0;
 }
 
 /**
@@ -111,6 +174,43 @@ jobjectArray JNIV8Array::jniGetV8ElementsInRange(JNIEnv *env, jobject obj, jint
     return elements;
 }
 
+/**
+ * Returns all elements from a specified range inside of the array as unboxed primitives
+ */
+jdoubleArray JNIV8Array::jniGetV8DoublesInRange(JNIEnv *env, jobject obj, jint flags, jint from, jint to) {
+    JNIV8Object_PrepareJNICall(JNIV8Array, v8::Array, nullptr);
+
+    uint32_t size = clampRange(localRef, from, to);
+    std::vector<jdouble> values;
+    if(!convertElementsInRange(env, context, localRef, JNIV8Marshalling::valueWithType(JNIV8JavaValueType::kDouble, false, (JNIV8MarshallingFlags)flags),
+                               &jvalue::d, (uint32_t)from, size, values)) {
+        return nullptr;
+    }
+
+    jdoubleArray elements = env->NewDoubleArray(size);
+    if(size) {
+        env->SetDoubleArrayRegion(elements, 0, size, values.data());
+    }
+    return elements;
+}
+
+jintArray JNIV8Array::jniGetV8IntsInRange(JNIEnv *env, jobject obj, jint flags, jint from, jint to) {
+    JNIV8Object_PrepareJNICall(JNIV8Array, v8::Array, nullptr);
+
+    uint32_t size = clampRange(localRef, from, to);
+    std::vector<jint> values;
+    if(!convertElementsInRange(env, context, localRef, JNIV8Marshalling::valueWithType(JNIV8JavaValueType::kInteger, false, (JNIV8MarshallingFlags)flags),
+                               &jvalue::i, (uint32_t)from, size, values)) {
+        return nullptr;
+    }
+
+    jintArray elements = env->NewIntArray(size);
+    if(size) {
+        env->SetIntArrayRegion(elements, 0, size, values.data());
+    }
+    return elements;
+}
+
 /**
  * Returns the object at the specified index
  * if index is out of bounds, returns JNIV8Undefined
@@ -159,6 +259,65 @@ jobject JNIV8Array::jniGetV8Element(JNIEnv *env, jobject obj, jint flags, jint t
     return jval.l;
 }
 
+/**
+ * Passes all elements of the array to a java callback
+ * the array is only looked up and the scopes are only opened once for all elements
+ */
+void JNIV8Array::jniForEach(JNIEnv *env, jobject obj, jint flags, jint type, jclass returnType, jobject callback) {
+    JNIV8Object_PrepareJNICall(JNIV8Array, v8::Array, );
+
+    JNIV8JavaValue arg = JNIV8Marshalling::valueWithClass(type, returnType, (JNIV8MarshallingFlags)flags);
+
+    jvalue jval = {0};
+    memset(&jval, 0, sizeof(jvalue));
+
+    // the callback might change the length of the array
+    for(uint32_t i=0; i<localRef->Length(); i++) {
+        // handles of one element are not needed anymore once the callback returned
+        v8::HandleScope elementScope(isolate);
+
+        v8::Local<v8::Value> value;
+        if(!localRef->Get(context, i).ToLocal(&value)) {
+            engine->forwardV8ExceptionToJNI(&try_catch);
+            return;
+        }
+
+        JNIV8MarshallingError res = JNIV8Marshalling::convertV8ValueToJavaValue(env, value, arg, &jval);
+        if(res != JNIV8MarshallingError::kOk) {
+            const std::string index = std::to_string(i);
+            switch(res) {
+                default:
+                case JNIV8MarshallingError::kWrongType:
+                    ThrowJNICastError("wrong type for value of element #" + index);
+                    break;
+                case JNIV8MarshallingError::kUndefined:
+                    ThrowJNICastError("value of element #" + index + " must not be undefined");
+                    break;
+                case JNIV8MarshallingError::kNotNullable:
+                    ThrowJNICastError("value of element #" + index + " is not nullable");
+                    break;
+                case JNIV8MarshallingError::kNoNaN:
+                    ThrowJNICastError("value of element #" + index + " must not be NaN");
+                    break;
+                case JNIV8MarshallingError::kVoidNotNull:
+                    ThrowJNICastError("value of element #" + index + " can only be null or undefined");
+                    break;
+                case JNIV8MarshallingError::kOutOfRange:
+                    ThrowJNICastError("value '" + JNIV8Marshalling::v8string2string(value->ToString(isolate)) + "' is out of range for element #" + index);
+                    break;
+            }
+            return;
+        }
+
+        env->CallVoidMethod(callback, _jniElementCallback.onElementId, (jint)i, jval.l);
+        env->DeleteLocalRef(jval.l);
+        if(env->ExceptionCheck()) {
+            // stops the iteration; the exception is rethrown once the call returns to java
+            return;
+        }
+    }
+}
+
 jobject JNIV8Array::jniCreate(JNIEnv *env, jobject obj, jobject engineObj) {
     return jniCreateWithLength(env, obj, engineObj, 0);
 }
@@ -192,10 +351,74 @@ jobject JNIV8Array::jniCreateWithArray(JNIEnv *env, jobject obj, jobject engineO
         jobject obj;
         for(jsize i=0; i<numArgs; i++) {
             obj = env->GetObjectArrayElement(elements, i);
-            objRef->Set(i, JNIV8Marshalling::jobject2v8value(obj));
+            objRef->Set(i, JNIV8Marshalling::jobject2v8value(env, obj));
             env->DeleteLocalRef(obj);
         }
     }
 
     return JNIV8Wrapper::wrapObject<JNIV8Array>(objRef)->getJObject();
 }
+
+jobject JNIV8Array::jniCreateWithDoubles(JNIEnv *env, jobject obj, jobject engineObj, jdoubleArray elements) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(engineObj);
+
+    v8::Isolate* isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Context::Scope ctxScope(engine->getContext());
+
+    // copy all values in one go, then create the array from the complete list of elements
+    jsize numElements = env->GetArrayLength(elements);
+    std::vector<jdouble> values((size_t)numElements);
+    std::vector<v8::Local<v8::Value>> values8((size_t)numElements);
+    if(numElements) {
+        env->GetDoubleArrayRegion(elements, 0, numElements, values.data());
+    }
+    for(jsize i=0; i<numElements; i++) {
+        values8[i] = v8::Number::New(isolate, values[i]);
+    }
+    v8::Local<v8::Object> objRef = v8::Array::New(isolate, values8.data(), values8.size());
+
+    return JNIV8Wrapper::wrapObject<JNIV8Array>(objRef)->getJObject();
+}
+
+jobject JNIV8Array::jniCreateWithInts(JNIEnv *env, jobject obj, jobject engineObj, jintArray elements) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(engineObj);
+
+    v8::Isolate* isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Context::Scope ctxScope(engine->getContext());
+
+    jsize numElements = env->GetArrayLength(elements);
+    std::vector<jint> values((size_t)numElements);
+    std::vector<v8::Local<v8::Value>> values8((size_t)numElements);
+    if(numElements) {
+        env->GetIntArrayRegion(elements, 0, numElements, values.data());
+    }
+    for(jsize i=0; i<numElements; i++) {
+        values8[i] = v8::Integer::New(isolate, values[i]);
+    }
+    v8::Local<v8::Object> objRef = v8::Array::New(isolate, values8.data(), values8.size());
+
+    return JNIV8Wrapper::wrapObject<JNIV8Array>(objRef)->getJObject();
+}
+
+jobject JNIV8Array::jniCreateWithRecords(JNIEnv *env, jobject obj, jobject engineObj, jclass recordClass, jobjectArray records) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(engineObj);
+
+    v8::Isolate* isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Context::Scope ctxScope(engine->getContext());
+
+    v8::Local<v8::Array> objRef;
+    if(!JNIV8Record::createArray(engine.get(), env, recordClass, records).ToLocal(&objRef)) {
+        return nullptr;
+    }
+
+    return JNIV8Wrapper::wrapObject<JNIV8Array>(objRef)->getJObject();
+}
@@ -17,6 +17,9 @@ public:
     static jobject jniCreate(JNIEnv *env, jobject obj, jobject engineObj);
     static jobject jniCreateWithLength(JNIEnv *env, jobject obj, jobject engineObj, jint length);
     static jobject jniCreateWithArray(JNIEnv *env, jobject obj, jobject engineObj, jobjectArray elements);
+    static jobject jniCreateWithDoubles(JNIEnv *env, jobject obj, jobject engineObj, jdoubleArray elements);
+    static jobject jniCreateWithInts(JNIEnv *env, jobject obj, jobject engineObj, jintArray elements);
+    static jobject jniCreateWithRecords(JNIEnv *env, jobject obj, jobject engineObj, jclass recordClass, jobjectArray records);
 
     /**
      * returns the length of the array
@@ -28,12 +31,24 @@ public:
      */
     static jobjectArray jniGetV8ElementsInRange(JNIEnv *env, jobject obj, jint flags, jint type, jclass returnType, jint from, jint to);
 
+    /**
+     * Returns all elements from a specified range inside of the array as unboxed primitives
+     */
+    static jdoubleArray jniGetV8DoublesInRange(JNIEnv *env, jobject obj, jint flags, jint from, jint to);
+    static jintArray jniGetV8IntsInRange(JNIEnv *env, jobject obj, jint flags, jint from, jint to);
+
     /**
      * Returns the object at the specified index
      * if index is out of bounds, returns JNIV8Undefined
      */
     static jobject jniGetV8Element(JNIEnv *env, jobject obj, jint flags, jint type, jclass returnType, jint index);
 
+    /**
+     * Passes all elements of the array to a java callback
+     * the array is only looked up and the scopes are only opened once for all elements
+     */
+    static void jniForEach(JNIEnv *env, jobject obj, jint flags, jint type, jclass returnType, jobject callback);
+
     /**
      * cache JNI class references
      */
@@ -42,6 +57,10 @@ private:
     static struct {
         jclass clazz;
     } _jniObject;
+    static struct {
+        jclass clazz;
+        jmethodID onElementId;
+    } _jniElementCallback;
 };
 
 BGJS_JNI_LINK_DEF(JNIV8Array)
@@ -0,0 +1,108 @@
+//
+// Wrapper for ArrayBuffers that can share memory with direct java.nio.ByteBuffers
+//
+
+#include "JNIV8ArrayBuffer.h"
+#include "../bgjs/BGJSV8Engine.h"
+
+BGJS_JNI_LINK(JNIV8ArrayBuffer, "ag/boersego/bgjs/JNIV8ArrayBuffer");
+
+/**
+ * internal struct for keeping the java buffer alive as long as the ArrayBuffer using its memory exists
+ */
+struct JNIV8ArrayBufferHolder {
+    v8::Persistent<v8::ArrayBuffer> persistent;
+    jobject jBufferRef;
+};
+
+bool JNIV8ArrayBuffer::isWrappableV8Object(v8::Local<v8::Object> object) {
+    return object->IsArrayBuffer();
+}
+
+void JNIV8ArrayBuffer::initializeJNIBindings(JNIClassInfo *info, bool isReload) {
+    info->registerNativeMethod("Create", "(Lag/boersego/bgjs/V8Engine;Ljava/nio/ByteBuffer;)Lag/boersego/bgjs/JNIV8ArrayBuffer;", (void*)JNIV8ArrayBuffer::jniCreate);
+    info->registerNativeMethod("CreateWithLength", "(Lag/boersego/bgjs/V8Engine;I)Lag/boersego/bgjs/JNIV8ArrayBuffer;", (void*)JNIV8ArrayBuffer::jniCreateWithLength);
+    info->registerNativeMethod("getV8ByteLength", "()I", (void*)JNIV8ArrayBuffer::jniGetV8ByteLength);
+    info->registerNativeMethod("_getByteBuffer", "()Ljava/nio/ByteBuffer;", (void*)JNIV8ArrayBuffer::jniGetByteBuffer);
+}
+
+void JNIV8ArrayBufferWeakPersistentCallback(const v8::WeakCallbackInfo<void>& data) {
+    JNIEnv *env = JNIWrapper::getEnvironment();
+
+    JNIV8ArrayBufferHolder *holder = reinterpret_cast<JNIV8ArrayBufferHolder*>(data.GetParameter());
+    env->DeleteGlobalRef(holder->jBufferRef);
+
+    holder->persistent.Reset();
+    delete holder;
+}
+
+v8::Local<v8::ArrayBuffer> JNIV8ArrayBuffer::newArrayBuffer(JNIEnv *env, v8::Isolate *isolate, jobject byteBuffer) {
+    v8::EscapableHandleScope scope(isolate);
+
+    void *data = env->GetDirectBufferAddress(byteBuffer);
+    if(!data) {
+        return v8::Local<v8::ArrayBuffer>();
+    }
+    jlong capacity = env->GetDirectBufferCapacity(byteBuffer);
+
+    // the memory is owned by the java buffer; v8 must not free it, so the buffer is created as externalized
+    // and the java buffer is referenced until the v8 object was collected
+    v8::Local<v8::ArrayBuffer> bufferRef = v8::ArrayBuffer::New(isolate, data, (size_t)capacity, v8::ArrayBufferCreationMode::kExternalized);
+
+    JNIV8ArrayBufferHolder *holder = new JNIV8ArrayBufferHolder();
+    holder->jBufferRef = env->NewGlobalRef(byteBuffer);
+    holder->persistent.Reset(isolate, bufferRef);
+    holder->persistent.SetWeak((void*)holder, JNIV8ArrayBufferWeakPersistentCallback, v8::WeakCallbackType::kParameter);
+
+    return scope.Escape(bufferRef);
+}
+
+jobject JNIV8ArrayBuffer::jniCreate(JNIEnv *env, jobject obj, jobject engineObj, jobject byteBuffer) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(engineObj);
+
+    v8::Isolate* isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Context::Scope ctxScope(engine->getContext());
+
+    v8::Local<v8::ArrayBuffer> bufferRef = newArrayBuffer(env, isolate, byteBuffer);
+    if(bufferRef.IsEmpty()) {
+        env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"), "ByteBuffer must be direct");
+        return nullptr;
+    }
+
+    return JNIV8Wrapper::wrapObject<JNIV8ArrayBuffer>(bufferRef)->getJObject();
+}
+
+jobject JNIV8ArrayBuffer::jniCreateWithLength(JNIEnv *env, jobject obj, jobject engineObj, jint length) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(engineObj);
+
+    v8::Isolate* isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Context::Scope ctxScope(engine->getContext());
+
+    v8::Local<v8::Object> objRef = v8::ArrayBuffer::New(isolate, (size_t)length);
+
+    return JNIV8Wrapper::wrapObject<JNIV8ArrayBuffer>(objRef)->getJObject();
+}
+
+jint JNIV8ArrayBuffer::jniGetV8ByteLength(JNIEnv *env, jobject obj) {
+    JNIV8Object_PrepareJNICall(JNIV8ArrayBuffer, v8::ArrayBuffer, 0);
+
+    return (jint)localRef->ByteLength();
+}
+
+/**
+ * the memory of the returned ByteBuffer stays owned by v8, the ByteBuffer does not reference the v8 object by itself;
+ * the java wrapper keeps the ArrayBuffer alive, and JNIV8ArrayBuffer.getByteBuffer keeps the wrapper alive until the
+ * ByteBuffer was collected
+ */
+jobject JNIV8ArrayBuffer::jniGetByteBuffer(JNIEnv *env, jobject obj) {
+    JNIV8Object_PrepareJNICall(JNIV8ArrayBuffer, v8::ArrayBuffer, nullptr);
+
+    v8::ArrayBuffer::Contents contents = localRef->GetContents();
+    return env->NewDirectByteBuffer(contents.Data(), (jlong)contents.ByteLength());
+}
@@ -0,0 +1,44 @@
+//
+// Wrapper for ArrayBuffers that can share memory with direct java.nio.ByteBuffers
+//
+
+#ifndef ANDROID_TRADINGLIB_SAMPLE_JNIV8ARRAYBUFFER_H
+#define ANDROID_TRADINGLIB_SAMPLE_JNIV8ARRAYBUFFER_H
+
+#include "JNIV8Wrapper.h"
+
+/**
+ * Wrapper for ArrayBuffers
+ * buffers created from java are backed by the memory of a direct java.nio.ByteBuffer, no data is copied in either direction
+ */
+class JNIV8ArrayBuffer : public JNIScope<JNIV8ArrayBuffer, JNIV8Object> {
+public:
+    JNIV8ArrayBuffer(jobject obj, JNIClassInfo *info) : JNIScope(obj, info) {};
+
+    static bool isWrappableV8Object(v8::Local<v8::Object> object);
+    static void initializeJNIBindings(JNIClassInfo *info, bool isReload);
+
+    static jobject jniCreate(JNIEnv *env, jobject obj, jobject engineObj, jobject byteBuffer);
+    static jobject jniCreateWithLength(JNIEnv *env, jobject obj, jobject engineObj, jint length);
+
+    /**
+     * returns the length of the buffer in bytes
+     */
+    static jint jniGetV8ByteLength(JNIEnv *env, jobject obj);
+
+    /**
+     * returns a direct ByteBuffer referencing the contents of the array buffer
+     */
+    static jobject jniGetByteBuffer(JNIEnv *env, jobject obj);
+
+    /**
+     * creates an ArrayBuffer using the memory of the specified direct ByteBuffer
+     * the ByteBuffer is kept alive until the ArrayBuffer has been collected
+     * returns an empty handle if the buffer is not direct
+     */
+    static v8::Local<v8::ArrayBuffer> newArrayBuffer(JNIEnv *env, v8::Isolate *isolate, jobject byteBuffer);
+};
+
+BGJS_JNI_LINK_DEF(JNIV8ArrayBuffer)
+
+#endif //ANDROID_TRADINGLIB_SAMPLE_JNIV8ARRAYBUFFER_H
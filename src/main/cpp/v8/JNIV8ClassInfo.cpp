@@ -6,6 +6,8 @@
 #include "../bgjs/BGJSV8Engine.h"
 #include "JNIV8Object.h"
 #include "JNIV8Wrapper.h"
+#include "JNIV8JavaThunks.h"
+#include "../bgjs/BGJSTrace.h"
 
 #include <cassert>
 #include <stdlib.h>
@@ -37,8 +39,7 @@ void JNIV8ClassInfo::v8JavaAccessorGetterCallback(Local<Name> property, const Pr
         jobject jobj = nullptr;
 
         if (!cb->isStatic) {
-            ext = info.This()->GetInternalField(0).As<v8::External>();
-            JNIV8Object *v8Object = reinterpret_cast<JNIV8Object *>(ext->Value());
+            JNIV8Object *v8Object = JNIV8Object::fromJSObject(info.This());
 
             jobj = v8Object->getJObject();
         }
@@ -76,8 +77,7 @@ void JNIV8ClassInfo::v8JavaAccessorSetterCallback(Local<Name> property, Local<Va
         memset(&jval, 0, sizeof(jvalue));
 
         if (!cb->isStatic) {
-            ext = info.This()->GetInternalField(0).As<v8::External>();
-            JNIV8Object *v8Object = reinterpret_cast<JNIV8Object *>(ext->Value());
+            JNIV8Object *v8Object = JNIV8Object::fromJSObject(info.This());
 
             jobj = v8Object->getJObject();
         }
@@ -136,37 +136,39 @@ void JNIV8ClassInfo::v8JavaMethodCallback(const v8::FunctionCallbackInfo<v8::Val
     v8::Local<v8::External> ext;
     ext = args.Data().As<v8::External>();
     JNIV8ObjectJavaCallbackHolder* cb = static_cast<JNIV8ObjectJavaCallbackHolder*>(ext->Value());
+    // time spent in java shows up in system traces; cpu profiles attribute it to the function named after the method
+    BGJSTraceScope trace(cb->traceName.c_str());
 
     // we only check the "this" for non-static methods
     // otherwise "this" can be anything, we do not care..
     if(!cb->isStatic) {
-        v8::Local<v8::Object> thisArg = args.This();
-        v8::Local<v8::Value> internalField = thisArg->GetInternalField(0);
         // this is not really "safe".. but how could it be? another part of the program could store arbitrary stuff in internal fields
-        ext = internalField.As<v8::External>();
-        JNIV8Object *v8Object = reinterpret_cast<JNIV8Object *>(ext->Value());
+        JNIV8Object *v8Object = JNIV8Object::fromJSObject(args.This());
         jobj = v8Object->getJObject();
     }
 
-    // try to find a matching signature
-    JNIV8ObjectJavaSignatureInfo *signature = nullptr;
-
-    for (auto& sig : cb->signatures) {
-        if (!sig.arguments) {
-            if (!signature) {
-                signature = &sig;
-            }
-        } else if (sig.arguments->size() == args.Length()) {
-            signature = &sig;
-            break;
-        }
+    // overloads with a matching number of arguments take precedence over the generic one
+    const size_t numArgs = (size_t)args.Length();
+    int signatureIndex = numArgs < cb->signaturesByArity.size() ? cb->signaturesByArity[numArgs] : -1;
+    if(signatureIndex < 0) {
+        signatureIndex = cb->genericSignature;
     }
 
-    if(!signature) {
+    if(signatureIndex < 0) {
         isolate->ThrowException(v8::Exception::TypeError(String::NewFromUtf8(isolate, ("invalid number of arguments (" + std::to_string(args.Length()) + ") supplied to " + cb->methodName).c_str())));
         return;
     }
+    JNIV8ObjectJavaSignatureInfo *signature = &cb->signatures[signatureIndex];
+
+    // common signatures have a specialized call that converts the arguments without going through the generic code
+    if(signature->thunk) {
+        signature->thunk(args, env, cb, signature, jobj);
+        return;
+    }
 
+    // arguments are converted into a buffer on the stack; only calls with lots of arguments need the heap
+    static const size_t kMaxStackArguments = 16;
+    jvalue stackArgs[kMaxStackArguments];
     jvalue *jargs;
     jobject obj;
     size_t numJArgs;
@@ -175,11 +177,11 @@ void JNIV8ClassInfo::v8JavaMethodCallback(const v8::FunctionCallbackInfo<v8::Val
         // generic case: an array of objects!
         // nothing to validate here, this always works
         numJArgs = 1;
-        jargs = (jvalue*)malloc(sizeof(jvalue)*numJArgs);
+        jargs = stackArgs;
         memset(jargs, 0, sizeof(jvalue)*numJArgs);
         jobjectArray jArray = env->NewObjectArray(args.Length(), _jniObject.clazz, nullptr);
         for (int idx = 0, n = args.Length(); idx < n; idx++) {
-            obj = JNIV8Marshalling::v8value2jobject(args[idx]);
+            obj = JNIV8Marshalling::v8value2jobject(env, args[idx]);
             env->SetObjectArrayElement(jArray, idx, obj);
             env->DeleteLocalRef(obj);
         }
@@ -189,7 +191,7 @@ void JNIV8ClassInfo::v8JavaMethodCallback(const v8::FunctionCallbackInfo<v8::Val
         // arguments might have to be of a certain type, so we need to validate!
         numJArgs = (size_t)args.Length();
         if(numJArgs) {
-            jargs = (jvalue *) malloc(sizeof(jvalue) * numJArgs);
+            jargs = numJArgs > kMaxStackArguments ? (jvalue *) malloc(sizeof(jvalue) * numJArgs) : stackArgs;
             memset(jargs, 0, sizeof(jvalue) * numJArgs);
 
             for(int idx = 0, n = args.Length(); idx < n; idx++) {
@@ -199,29 +201,10 @@ void JNIV8ClassInfo::v8JavaMethodCallback(const v8::FunctionCallbackInfo<v8::Val
                 JNIV8MarshallingError res = JNIV8Marshalling::convertV8ValueToJavaValue(env, value, arg, &(jargs[idx]));
                 if(res != JNIV8MarshallingError::kOk) {
                     // conversion failed => simply clean up & throw an exception
-                    free(jargs);
-                    switch(res) {
-                        default:
-                        case JNIV8MarshallingError::kWrongType:
-                            ThrowV8TypeError("wrong type for argument #" + std::to_string(idx) + " of '" + cb->methodName + "'");
-                            break;
-                        case JNIV8MarshallingError::kUndefined:
-                            ThrowV8TypeError("argument #" + std::to_string(idx) + " of '" + cb->methodName + "' does not accept undefined");
-                            break;
-                        case JNIV8MarshallingError::kNotNullable:
-                            ThrowV8TypeError("argument #" + std::to_string(idx) + " of '" + cb->methodName + "' is not nullable");
-                            break;
-                        case JNIV8MarshallingError::kNoNaN:
-                            ThrowV8TypeError("argument #" + std::to_string(idx) + " of '" + cb->methodName + "' must not be NaN");
-                            break;
-                        case JNIV8MarshallingError::kVoidNotNull:
-                            ThrowV8TypeError("argument #" + std::to_string(idx) + " of '" + cb->methodName + "' must be null or undefined");
-                            break;
-                        case JNIV8MarshallingError::kOutOfRange:
-                            ThrowV8RangeError("value '"+
-                                              JNIV8Marshalling::v8string2string(value->ToString(isolate))+"' is out of range for argument #" + std::to_string(idx) + " of '" + cb->methodName + "'");
-                            break;
+                    if(jargs != stackArgs) {
+                        free(jargs);
                     }
+                    JNIV8JavaThunks::throwArgumentError(isolate, res, idx, cb->methodName, value);
                     return;
                 }
             }
@@ -234,7 +217,7 @@ void JNIV8ClassInfo::v8JavaMethodCallback(const v8::FunctionCallbackInfo<v8::Val
 
     result = JNIV8Marshalling::callJavaMethod(env, cb->returnType, cb->javaClass, signature->javaMethodId, jobj, jargs);
 
-    if(jargs) {
+    if(jargs && jargs != stackArgs) {
         free(jargs);
     }
 
@@ -261,8 +244,7 @@ void JNIV8ClassInfo::v8AccessorGetterCallback(Local<Name> property, const Proper
     if(cb->isStatic) {
         (cb->getterCallback.s)(cb->propertyName, info);
     } else {
-        ext = info.This()->GetInternalField(0).As<v8::External>();
-        JNIV8Object *v8Object = reinterpret_cast<JNIV8Object *>(ext->Value());
+        JNIV8Object *v8Object = JNIV8Object::fromJSObject(info.This());
 
         (v8Object->*(cb->getterCallback.i))(cb->propertyName, info);
     }
@@ -283,8 +265,7 @@ void JNIV8ClassInfo::v8AccessorSetterCallback(Local<Name> property, Local<Value>
     if(cb->isStatic) {
         (cb->setterCallback.s)(cb->propertyName, value, info);
     } else {
-        ext = info.This()->GetInternalField(0).As<v8::External>();
-        JNIV8Object *v8Object = reinterpret_cast<JNIV8Object *>(ext->Value());
+        JNIV8Object *v8Object = JNIV8Object::fromJSObject(info.This());
 
         (v8Object->*(cb->setterCallback.i))(cb->propertyName, value, info);
     }
@@ -305,16 +286,15 @@ void JNIV8ClassInfo::v8MethodCallback(const v8::FunctionCallbackInfo<v8::Value>&
         // we do NOT check how this function was invoked.. if a this was supplied, we just ignore it!
         (cb->callback.s)(cb->methodName, args);
     } else {
-        ext = args.This()->GetInternalField(0).As<v8::External>();
-        JNIV8Object *v8Object = reinterpret_cast<JNIV8Object *>(ext->Value());
+        JNIV8Object *v8Object = JNIV8Object::fromJSObject(args.This());
 
         (v8Object->*(cb->callback.i))(cb->methodName, args);
     }
 }
 
-JNIV8ClassInfoContainer::JNIV8ClassInfoContainer(JNIV8ObjectType type, const std::string& canonicalName, JNIV8ObjectInitializer i,
+JNIV8ClassInfoContainer::JNIV8ClassInfoContainer(size_t index, JNIV8ObjectType type, const std::string& canonicalName, JNIV8ObjectInitializer i,
                                            JNIV8ObjectCreator c, size_t s, JNIV8ClassInfoContainer *baseClassInfo) :
-        type(type), canonicalName(canonicalName), initializer(i), creator(c), size(s), baseClassInfo(baseClassInfo) {
+        type(type), canonicalName(canonicalName), initializer(i), creator(c), index(index), size(s), baseClassInfo(baseClassInfo) {
     if(baseClassInfo) {
         if (!creator) {
             creator = baseClassInfo->creator;
@@ -400,7 +380,7 @@ void JNIV8ClassInfo::registerStaticMethod(const std::string& methodName, JNIV8Ob
     _registerMethod(holder);
 }
 
-void JNIV8ClassInfo::registerJavaMethod(const std::string& methodName, jmethodID methodId, const JNIV8JavaValue& returnType, std::vector<JNIV8JavaValue> *arguments) {
+void JNIV8ClassInfo::registerJavaMethod(const std::string& methodName, jmethodID methodId, const JNIV8JavaValue& returnType, std::vector<JNIV8JavaValue> *arguments, JNIV8JavaThunk thunk) {
     // check if this is an overload for a method that is already registered
     for(auto &it : javaCallbackHolders) {
         if(it->methodName == methodName) {
@@ -408,7 +388,7 @@ void JNIV8ClassInfo::registerJavaMethod(const std::string& methodName, jmethodID
             JNI_ASSERTF(returnType.valueType == it->returnType.valueType && JNIWrapper::getEnvironment()->IsSameObject(returnType.clazz, it->returnType.clazz),
                         "Overload for method '%s' of class '%s' has a different return type", methodName.c_str(), container->canonicalName.c_str());
             // register overload
-            it->signatures.push_back({methodId, arguments});
+            _addJavaSignature(it, methodId, arguments, thunk);
             return;
         }
     }
@@ -417,11 +397,11 @@ void JNIV8ClassInfo::registerJavaMethod(const std::string& methodName, jmethodID
     JNIV8ObjectJavaCallbackHolder *holder = new JNIV8ObjectJavaCallbackHolder(returnType);
     holder->methodName = methodName;
     holder->isStatic = false;
-    holder->signatures.push_back({methodId, arguments});
+    _addJavaSignature(holder, methodId, arguments, thunk);
     _registerJavaMethod(holder);
 }
 
-void JNIV8ClassInfo::registerStaticJavaMethod(const std::string &methodName, jmethodID methodId, const JNIV8JavaValue& returnType, std::vector<JNIV8JavaValue> *arguments) {
+void JNIV8ClassInfo::registerStaticJavaMethod(const std::string &methodName, jmethodID methodId, const JNIV8JavaValue& returnType, std::vector<JNIV8JavaValue> *arguments, JNIV8JavaThunk thunk) {
     // check if this is an overload for a method that is already registered
     for(auto &it : javaCallbackHolders) {
         if(it->methodName == methodName) {
@@ -429,7 +409,7 @@ void JNIV8ClassInfo::registerStaticJavaMethod(const std::string &methodName, jme
             JNI_ASSERTF(returnType.valueType == it->returnType.valueType && JNIWrapper::getEnvironment()->IsSameObject(returnType.clazz, it->returnType.clazz),
                         "Overload for method '%s' of class '%s' has a different return type", methodName.c_str(), container->canonicalName.c_str());
             // register overload
-            it->signatures.push_back({methodId, arguments});
+            _addJavaSignature(it, methodId, arguments, thunk);
             return;
         }
     }
@@ -438,7 +418,7 @@ void JNIV8ClassInfo::registerStaticJavaMethod(const std::string &methodName, jme
     JNIV8ObjectJavaCallbackHolder *holder = new JNIV8ObjectJavaCallbackHolder(returnType);
     holder->methodName = methodName;
     holder->isStatic = true;
-    holder->signatures.push_back({methodId, arguments});
+    _addJavaSignature(holder, methodId, arguments, thunk);
     _registerJavaMethod(holder);
 }
 
@@ -485,6 +465,26 @@ void JNIV8ClassInfo::registerStaticAccessor(const std::string &propertyName,
     _registerAccessor(holder);
 }
 
+void JNIV8ClassInfo::_addJavaSignature(JNIV8ObjectJavaCallbackHolder *holder, jmethodID methodId, std::vector<JNIV8JavaValue> *arguments, JNIV8JavaThunk thunk) {
+    const int index = (int)holder->signatures.size();
+    holder->signatures.push_back({methodId, arguments, thunk});
+
+    // resolve overloads once here instead of on every call; the first overload registered for an arity wins
+    if(!arguments) {
+        if(holder->genericSignature < 0) {
+            holder->genericSignature = index;
+        }
+        return;
+    }
+    const size_t arity = arguments->size();
+    if(holder->signaturesByArity.size() <= arity) {
+        holder->signaturesByArity.resize(arity + 1, -1);
+    }
+    if(holder->signaturesByArity[arity] < 0) {
+        holder->signaturesByArity[arity] = index;
+    }
+}
+
 void JNIV8ClassInfo::_registerJavaMethod(JNIV8ObjectJavaCallbackHolder *holder) {
     Isolate* isolate = engine->getIsolate();
     HandleScope scope(isolate);
@@ -495,11 +495,18 @@ void JNIV8ClassInfo::_registerJavaMethod(JNIV8ObjectJavaCallbackHolder *holder)
     holder->javaClass = (jclass)env->NewGlobalRef(env->FindClass(container->canonicalName.c_str()));;
     javaCallbackHolders.push_back(holder);
 
+    const size_t slash = container->canonicalName.find_last_of('/');
+    holder->traceName = container->canonicalName.substr(slash == std::string::npos ? 0 : slash + 1) + "." + holder->methodName;
+
     Local<External> data = External::New(isolate, (void*)holder);
 
     if(holder->isStatic) {
         Local<Function> f = ft->GetFunction();
-        f->Set(String::NewFromUtf8(isolate, holder->methodName.c_str()), FunctionTemplate::New(isolate, v8JavaMethodCallback, data, Local<Signature>(), 0, ConstructorBehavior::kThrow)->GetFunction());
+        Local<String> name = String::NewFromUtf8(isolate, holder->methodName.c_str());
+        Local<Function> method = FunctionTemplate::New(isolate, v8JavaMethodCallback, data, Local<Signature>(), 0, ConstructorBehavior::kThrow)->GetFunction();
+        // functions of templates on prototypes are named after their property; this one would be anonymous
+        method->SetName(name);
+        f->Set(name, method);
     } else {
         // ofc functions belong on the prototype, and not on the actual instance for performance/memory reasons
         // but interestingly enough, we MUST store them there because they simply are not "copied" from the InstanceTemplate when using inherit later
@@ -610,9 +617,9 @@ v8::Local<v8::Object> JNIV8ClassInfo::newInstance() const {
     EscapableHandleScope handleScope(isolate);
     Context::Scope ctxScope(engine->getContext());
 
-    Local<FunctionTemplate> ft = Local<FunctionTemplate>::New(isolate, functionTemplate);
+    Local<ObjectTemplate> tpl = Local<ObjectTemplate>::New(isolate, instanceTemplate);
 
-    return handleScope.Escape(ft->InstanceTemplate()->NewInstance());
+    return handleScope.Escape(tpl->NewInstance(engine->getContext()).ToLocalChecked());
 }
 
 v8::Local<v8::Function> JNIV8ClassInfo::getConstructor() const {
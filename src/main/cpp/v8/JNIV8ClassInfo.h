@@ -42,12 +42,18 @@ struct JNIV8ObjectJavaAccessorHolder {
  */
 struct JNIV8ObjectJavaCallbackHolder {
     std::string methodName;
+    // name of the trace section of calls, e.g. "V8Engine.require"
+    std::string traceName;
     JNIV8JavaValue returnType;
     std::vector<JNIV8ObjectJavaSignatureInfo> signatures;
+    // index into signatures for every number of arguments; -1 if there is no overload with that arity
+    std::vector<int> signaturesByArity;
+    // index of the overload receiving all arguments as an array; -1 if there is none
+    int genericSignature;
     jclass javaClass;
     bool isStatic;
 
-    JNIV8ObjectJavaCallbackHolder(JNIV8JavaValue returnType) : returnType(returnType) {};
+    JNIV8ObjectJavaCallbackHolder(JNIV8JavaValue returnType) : returnType(returnType), genericSignature(-1) {};
 };
 
 /**
@@ -92,7 +98,8 @@ enum class JNIV8ObjectType {
     /**
      * Tuple of Java+native class acts as a wrapper for an existing v8 object
      * this can be used to write utility methods for working with existing JavaScript classes, e.g. you could wrap Object, or Array
-     * wrapping the same javascript object will always yield a new instance of a Java + native tuple!
+     * wrapping the same javascript object yields the same Java + native tuple as long as the java object is alive;
+     * once it was collected, a new instance is created
      */
     kWrapper
 };
@@ -139,11 +146,12 @@ private:
     JNIV8ClassInfo(JNIV8ClassInfoContainer *container, BGJSV8Engine *engine);
     ~JNIV8ClassInfo();
 
-    void registerJavaMethod(const std::string& methodName, jmethodID methodId, const JNIV8JavaValue& returnType, std::vector<JNIV8JavaValue> *arguments);
-    void registerStaticJavaMethod(const std::string& methodName, jmethodID methodId, const JNIV8JavaValue& returnType, std::vector<JNIV8JavaValue> *arguments);
+    void registerJavaMethod(const std::string& methodName, jmethodID methodId, const JNIV8JavaValue& returnType, std::vector<JNIV8JavaValue> *arguments, JNIV8JavaThunk thunk = nullptr);
+    void registerStaticJavaMethod(const std::string& methodName, jmethodID methodId, const JNIV8JavaValue& returnType, std::vector<JNIV8JavaValue> *arguments, JNIV8JavaThunk thunk = nullptr);
     void registerJavaAccessor(const std::string& propertyName, const JNIV8JavaValue& propertyType, jmethodID getterId, jmethodID setterId);
     void registerStaticJavaAccessor(const std::string& propertyName, const JNIV8JavaValue& propertyType, jmethodID getterId, jmethodID setterId);
 
+    static void _addJavaSignature(JNIV8ObjectJavaCallbackHolder *holder, jmethodID methodId, std::vector<JNIV8JavaValue> *arguments, JNIV8JavaThunk thunk);
     void _registerJavaMethod(JNIV8ObjectJavaCallbackHolder *holder);
     void _registerJavaAccessor(JNIV8ObjectJavaAccessorHolder *holder);
     void _registerMethod(JNIV8ObjectCallbackHolder *holder);
@@ -157,6 +165,8 @@ private:
     BGJSV8Engine *engine;
     JNIV8ClassInfoContainer *container;
     v8::Persistent<v8::FunctionTemplate> functionTemplate;
+    // instance template of functionTemplate, kept so instances are created without looking it up every time
+    v8::Persistent<v8::ObjectTemplate> instanceTemplate;
     JNIV8ObjectConstructorCallback constructorCallback;
     bool createFromJavaOnly;
 
@@ -185,7 +195,7 @@ struct JNIV8ClassInfoContainer {
     friend class JNIV8Wrapper;
     friend class JNIV8ClassInfo;
 private:
-    JNIV8ClassInfoContainer(JNIV8ObjectType type, const std::string& canonicalName, JNIV8ObjectInitializer i, JNIV8ObjectCreator c, size_t size, JNIV8ClassInfoContainer *baseClassInfo);
+    JNIV8ClassInfoContainer(size_t index, JNIV8ObjectType type, const std::string& canonicalName, JNIV8ObjectInitializer i, JNIV8ObjectCreator c, size_t size, JNIV8ClassInfoContainer *baseClassInfo);
 
     JNIV8ObjectType type;
     JNIV8ClassInfoContainer *baseClassInfo;
@@ -193,7 +203,8 @@ private:
     std::string canonicalName;
     JNIV8ObjectInitializer initializer;
     JNIV8ObjectCreator creator;
-    std::vector<JNIV8ClassInfo*> classInfos;
+    // of the class info in the JNIV8ClassInfoTable of every engine
+    size_t index;
 
     jclass clsObject, clsBinding;
 };
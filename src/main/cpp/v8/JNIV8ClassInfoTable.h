@@ -0,0 +1,97 @@
+//
+// Per engine table of class infos, indexed by the index of their JNIV8ClassInfoContainer
+//
+
+#ifndef TRADINGLIB_SAMPLE_JNIV8CLASSINFOTABLE_H
+#define TRADINGLIB_SAMPLE_JNIV8CLASSINFOTABLE_H
+
+#include <atomic>
+#include <stddef.h>
+
+class JNIV8ClassInfo;
+
+/**
+ * Slots live in chunks that are never moved or freed before the table, so get() needs neither a lock nor a check
+ * against concurrent growth: a slot is either still null or points to a class info that has been published with set().
+ * set() and clear() have to be serialized by the caller (JNIV8Wrapper does so with its mutex).
+ */
+class JNIV8ClassInfoTable {
+public:
+    static const size_t kChunkSize = 64;
+    static const size_t kMaxChunks = 256;
+
+    JNIV8ClassInfoTable() {
+        for (size_t i = 0; i < kMaxChunks; i++) {
+            _chunks[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~JNIV8ClassInfoTable() {
+        for (size_t i = 0; i < kMaxChunks; i++) {
+            delete[] _chunks[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    JNIV8ClassInfoTable(const JNIV8ClassInfoTable&) = delete;
+    JNIV8ClassInfoTable& operator=(const JNIV8ClassInfoTable&) = delete;
+
+    /**
+     * allocates the chunks for the first count slots up front, so classes that are already registered never grow the table
+     */
+    void reserve(size_t count) {
+        for (size_t i = 0; i < count && i / kChunkSize < kMaxChunks; i += kChunkSize) {
+            _chunk(i / kChunkSize);
+        }
+    }
+
+    JNIV8ClassInfo* get(size_t index) const {
+        if (index >= kChunkSize * kMaxChunks) {
+            return nullptr;
+        }
+        std::atomic<JNIV8ClassInfo*> *chunk = _chunks[index / kChunkSize].load(std::memory_order_acquire);
+        return chunk ? chunk[index % kChunkSize].load(std::memory_order_acquire) : nullptr;
+    }
+
+    /**
+     * publishes info for lock free readers; returns false if index is out of range
+     */
+    bool set(size_t index, JNIV8ClassInfo *info) {
+        if (index >= kChunkSize * kMaxChunks) {
+            return false;
+        }
+        _chunk(index / kChunkSize)[index % kChunkSize].store(info, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * calls fn for every class info in the table and empties it
+     */
+    template<typename Fn>
+    void clear(Fn fn) {
+        for (size_t i = 0; i < kMaxChunks; i++) {
+            std::atomic<JNIV8ClassInfo*> *chunk = _chunks[i].load(std::memory_order_relaxed);
+            if (!chunk) continue;
+            for (size_t j = 0; j < kChunkSize; j++) {
+                JNIV8ClassInfo *info = chunk[j].exchange(nullptr, std::memory_order_acq_rel);
+                if (info) fn(info);
+            }
+        }
+    }
+
+private:
+    std::atomic<JNIV8ClassInfo*>* _chunk(size_t chunkIndex) {
+        std::atomic<JNIV8ClassInfo*> *chunk = _chunks[chunkIndex].load(std::memory_order_relaxed);
+        if (!chunk) {
+            chunk = new std::atomic<JNIV8ClassInfo*>[kChunkSize];
+            for (size_t j = 0; j < kChunkSize; j++) {
+                chunk[j].store(nullptr, std::memory_order_relaxed);
+            }
+            _chunks[chunkIndex].store(chunk, std::memory_order_release);
+        }
+        return chunk;
+    }
+
+    std::atomic<std::atomic<JNIV8ClassInfo*>*> _chunks[kMaxChunks];
+};
+
+#endif //TRADINGLIB_SAMPLE_JNIV8CLASSINFOTABLE_H
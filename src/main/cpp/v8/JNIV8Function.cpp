@@ -5,6 +5,7 @@
 #include "JNIV8Function.h"
 
 #include <stdlib.h>
+#include <vector>
 
 BGJS_JNI_LINK(JNIV8Function, "ag/boersego/bgjs/JNIV8Function");
 
@@ -51,13 +52,13 @@ void JNIV8Function::v8FunctionCallback(const v8::FunctionCallbackInfo<v8::Value>
 
     JNIV8FunctionCallbackHolder *holder = static_cast<JNIV8FunctionCallbackHolder*>(ext->Value());
 
-    jobject receiver = JNIV8Marshalling::v8value2jobject(args.This());
+    jobject receiver = JNIV8Marshalling::v8value2jobject(env, args.This());
     jobjectArray arguments = nullptr;
     jobject value;
 
     arguments = env->NewObjectArray(numArgs - 1, _jniObject.clazz, nullptr);
     for (int i = 1, n = numArgs; i < n; i++) {
-        value = JNIV8Marshalling::v8value2jobject(args[i]);
+        value = JNIV8Marshalling::v8value2jobject(env, args[i]);
         env->SetObjectArrayElement(arguments, i - 1, value);
         env->DeleteLocalRef(value);
     }
@@ -69,7 +70,7 @@ void JNIV8Function::v8FunctionCallback(const v8::FunctionCallbackInfo<v8::Value>
         return;
     }
 
-    args.GetReturnValue().Set(JNIV8Marshalling::jobject2v8value(result));
+    args.GetReturnValue().Set(JNIV8Marshalling::jobject2v8value(env, result));
 }
 
 bool JNIV8Function::isWrappableV8Object(v8::Local<v8::Object> object) {
@@ -79,6 +80,65 @@ bool JNIV8Function::isWrappableV8Object(v8::Local<v8::Object> object) {
 void JNIV8Function::initializeJNIBindings(JNIClassInfo *info, bool isReload) {
     info->registerNativeMethod("Create", "(Lag/boersego/bgjs/V8Engine;Lag/boersego/bgjs/JNIV8Function$Handler;)Lag/boersego/bgjs/JNIV8Function;", (void*)JNIV8Function::jniCreate);
     info->registerNativeMethod("_callAsV8Function", "(ZIILjava/lang/Class;Ljava/lang/Object;[Ljava/lang/Object;)Ljava/lang/Object;", (void*)JNIV8Function::jniCallAsV8Function);
+    info->registerNativeMethod("_call", "(ZILjava/lang/Object;Ljava/lang/Object;Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;", (void*)JNIV8Function::jniCall);
+    info->registerNativeMethod("_callWithDoubles", "(Z[D)Ljava/lang/Object;", (void*)JNIV8Function::jniCallWithDoubles);
+}
+
+jobject JNIV8Function::callWithArguments(JNIEnv *env, BGJSV8Engine *engine, v8::Local<v8::Function> function,
+                                         v8::TryCatch &try_catch, int numArgs, v8::Local<v8::Value> *args,
+                                         bool discardResult) {
+    v8::Local<v8::Context> context = engine->getContext();
+    v8::Local<v8::Value> resultRef;
+    // same receiver as a call of callAsV8Function
+    v8::MaybeLocal<v8::Value> maybeLocal = function->Call(context, v8::Null(context->GetIsolate()), numArgs, args);
+    if (!maybeLocal.ToLocal<v8::Value>(&resultRef)) {
+        engine->forwardV8ExceptionToJNI(&try_catch);
+        return nullptr;
+    }
+    if (discardResult) {
+        return nullptr;
+    }
+    // results are not typed, so they never fail to convert
+    return JNIV8Marshalling::v8value2jobject(env, resultRef);
+}
+
+jobject JNIV8Function::jniCall(JNIEnv *env, jobject obj, jboolean discardResult, jint numArgs, jobject arg0, jobject arg1, jobject arg2, jobject arg3) {
+    JNIV8Object_PrepareJNICall(JNIV8Function, v8::Function, nullptr);
+
+    JNI_ASSERT(numArgs >= 0 && numArgs <= 4, "invalid number of arguments");
+    const jobject arguments[] = {arg0, arg1, arg2, arg3};
+    v8::Local<v8::Value> args[4];
+    for (jint i = 0; i < numArgs; i++) {
+        args[i] = JNIV8Marshalling::jobject2v8value(env, arguments[i]);
+    }
+    return callWithArguments(env, engine, localRef, try_catch, numArgs, args, discardResult);
+}
+
+// arrays of up to this many doubles do not allocate
+#define JNIV8FUNCTION_MAX_STACK_ARGUMENTS 16
+
+jobject JNIV8Function::jniCallWithDoubles(JNIEnv *env, jobject obj, jboolean discardResult, jdoubleArray arguments) {
+    JNIV8Object_PrepareJNICall(JNIV8Function, v8::Function, nullptr);
+
+    const jsize numArgs = env->GetArrayLength(arguments);
+    jdouble stackValues[JNIV8FUNCTION_MAX_STACK_ARGUMENTS];
+    v8::Local<v8::Value> stackArgs[JNIV8FUNCTION_MAX_STACK_ARGUMENTS];
+    std::vector<jdouble> heapValues;
+    std::vector<v8::Local<v8::Value>> heapArgs;
+    jdouble *values = stackValues;
+    v8::Local<v8::Value> *args = stackArgs;
+    if (numArgs > JNIV8FUNCTION_MAX_STACK_ARGUMENTS) {
+        heapValues.resize(numArgs);
+        heapArgs.resize(numArgs);
+        values = heapValues.data();
+        args = heapArgs.data();
+    }
+
+    env->GetDoubleArrayRegion(arguments, 0, numArgs, values);
+    for (jsize i = 0; i < numArgs; i++) {
+        args[i] = v8::Number::New(isolate, values[i]);
+    }
+    return callWithArguments(env, engine, localRef, try_catch, numArgs, args, discardResult);
 }
 
 jobject JNIV8Function::jniCallAsV8Function(JNIEnv *env, jobject obj, jboolean asConstructor, jint flags, jint type, jclass returnType, jobject receiver, jobjectArray arguments) {
@@ -109,7 +169,7 @@ jobject JNIV8Function::jniCallAsV8Function(JNIEnv *env, jobject obj, jboolean as
         args = (v8::Local<v8::Value>*)malloc(sizeof(v8::Local<v8::Value>)*numArgs);
         for(jsize i=0; i<numArgs; i++) {
             tempObj = env->GetObjectArrayElement(arguments, i);
-            args[i] = JNIV8Marshalling::jobject2v8value(tempObj);
+            args[i] = JNIV8Marshalling::jobject2v8value(env, tempObj);
             env->DeleteLocalRef(tempObj);
         }
     } else {
@@ -127,7 +187,7 @@ jobject JNIV8Function::jniCallAsV8Function(JNIEnv *env, jobject obj, jboolean as
     } else {
         v8::MaybeLocal<v8::Value> maybeLocal;
         maybeLocal = ptr->getJSObject().As<v8::Function>()->Call(context,
-                                                        JNIV8Marshalling::jobject2v8value(receiver),
+                                                        JNIV8Marshalling::jobject2v8value(env, receiver),
                                                         numArgs, args);
         if (!maybeLocal.ToLocal<v8::Value>(&resultRef)) {
             ptr->getEngine()->forwardV8ExceptionToJNI(&try_catch);
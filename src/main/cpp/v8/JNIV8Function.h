@@ -16,6 +16,9 @@ public:
 
     static jobject jniCreate(JNIEnv *env, jobject obj, jobject engineObj, jobject handler);
     static jobject jniCallAsV8Function(JNIEnv *env, jobject obj, jboolean asConstructor, jint flags, jint type, jclass returnType, jobject receiver, jobjectArray arguments);
+    // calls without an array of boxed arguments; the result is only converted if discardResult is not set
+    static jobject jniCall(JNIEnv *env, jobject obj, jboolean discardResult, jint numArgs, jobject arg0, jobject arg1, jobject arg2, jobject arg3);
+    static jobject jniCallWithDoubles(JNIEnv *env, jobject obj, jboolean discardResult, jdoubleArray arguments);
 
     /**
      * cache JNI class references
@@ -26,6 +29,10 @@ private:
         jclass clazz;
     } _jniObject;
     static v8::MaybeLocal<v8::Function> getJNIV8FunctionBaseFunction();
+    // has to be called with the isolate locked and the context entered
+    static jobject callWithArguments(JNIEnv *env, BGJSV8Engine *engine, v8::Local<v8::Function> function,
+                                     v8::TryCatch &try_catch, int numArgs, v8::Local<v8::Value> *args,
+                                     bool discardResult);
     static void v8FunctionCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
 };
 
@@ -13,6 +13,11 @@ bool JNIV8GenericObject::isWrappableV8Object(v8::Local<v8::Object> object) {
 
 void JNIV8GenericObject::initializeJNIBindings(JNIClassInfo *info, bool isReload) {
     info->registerNativeMethod("Create", "(Lag/boersego/bgjs/V8Engine;)Lag/boersego/bgjs/JNIV8GenericObject;", (void*)JNIV8GenericObject::jniCreate);
+    info->registerNativeMethod("CreateFloat64Array", "(Lag/boersego/bgjs/V8Engine;[D)Lag/boersego/bgjs/JNIV8GenericObject;", (void*)JNIV8GenericObject::jniCreateFloat64Array);
+    info->registerNativeMethod("CreateInt32Array", "(Lag/boersego/bgjs/V8Engine;[I)Lag/boersego/bgjs/JNIV8GenericObject;", (void*)JNIV8GenericObject::jniCreateInt32Array);
+    info->registerNativeMethod("toDoubleArray", "()[D", (void*)JNIV8GenericObject::jniToDoubleArray);
+    info->registerNativeMethod("toIntArray", "()[I", (void*)JNIV8GenericObject::jniToIntArray);
+    info->registerNativeMethod("toByteArray", "()[B", (void*)JNIV8GenericObject::jniToByteArray);
 }
 
 jobject JNIV8GenericObject::jniCreate(JNIEnv *env, jobject obj, jobject engineObj) {
@@ -30,4 +35,100 @@ jobject JNIV8GenericObject::jniCreate(JNIEnv *env, jobject obj, jobject engineOb
     objRef = v8::Object::New(isolate);
 
     return JNIV8Wrapper::wrapObject<JNIV8GenericObject>(objRef)->getJObject();
-}
\ No newline at end of file
+}
+
+jobject JNIV8GenericObject::jniCreateFloat64Array(JNIEnv *env, jobject obj, jobject engineObj, jdoubleArray elements) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(engineObj);
+
+    v8::Isolate* isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = engine->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    // the java array is copied straight into the backing store of the new buffer, so it does not need to be zeroed
+    jsize length = env->GetArrayLength(elements);
+    v8::Local<v8::ArrayBuffer> buffer = engine->newUninitializedArrayBuffer(length * sizeof(jdouble));
+    if(length) {
+        env->GetDoubleArrayRegion(elements, 0, length, (jdouble*)buffer->GetContents().Data());
+    }
+
+    v8::Local<v8::Object> objRef = v8::Float64Array::New(buffer, 0, (size_t)length);
+
+    return JNIV8Wrapper::wrapObject<JNIV8GenericObject>(objRef)->getJObject();
+}
+
+jobject JNIV8GenericObject::jniCreateInt32Array(JNIEnv *env, jobject obj, jobject engineObj, jintArray elements) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(engineObj);
+
+    v8::Isolate* isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = engine->getContext();
+    v8::Context::Scope ctxScope(context);
+
+    jsize length = env->GetArrayLength(elements);
+    v8::Local<v8::ArrayBuffer> buffer = engine->newUninitializedArrayBuffer(length * sizeof(jint));
+    if(length) {
+        env->GetIntArrayRegion(elements, 0, length, (jint*)buffer->GetContents().Data());
+    }
+
+    v8::Local<v8::Object> objRef = v8::Int32Array::New(buffer, 0, (size_t)length);
+
+    return JNIV8Wrapper::wrapObject<JNIV8GenericObject>(objRef)->getJObject();
+}
+
+jdoubleArray JNIV8GenericObject::jniToDoubleArray(JNIEnv *env, jobject obj) {
+    JNIV8Object_PrepareJNICall(JNIV8GenericObject, v8::Object, nullptr);
+
+    if(!localRef->IsFloat64Array()) {
+        ThrowJNICastError(std::string("object is not a Float64Array"));
+        return nullptr;
+    }
+
+    v8::Local<v8::Float64Array> array = localRef.As<v8::Float64Array>();
+    jsize length = (jsize)array->Length();
+    jdoubleArray result = env->NewDoubleArray(length);
+    if(length) {
+        const uint8_t *data = (const uint8_t*)array->Buffer()->GetContents().Data() + array->ByteOffset();
+        env->SetDoubleArrayRegion(result, 0, length, (const jdouble*)data);
+    }
+    return result;
+}
+
+jintArray JNIV8GenericObject::jniToIntArray(JNIEnv *env, jobject obj) {
+    JNIV8Object_PrepareJNICall(JNIV8GenericObject, v8::Object, nullptr);
+
+    if(!localRef->IsInt32Array()) {
+        ThrowJNICastError(std::string("object is not an Int32Array"));
+        return nullptr;
+    }
+
+    v8::Local<v8::Int32Array> array = localRef.As<v8::Int32Array>();
+    jsize length = (jsize)array->Length();
+    jintArray result = env->NewIntArray(length);
+    if(length) {
+        const uint8_t *data = (const uint8_t*)array->Buffer()->GetContents().Data() + array->ByteOffset();
+        env->SetIntArrayRegion(result, 0, length, (const jint*)data);
+    }
+    return result;
+}
+
+jbyteArray JNIV8GenericObject::jniToByteArray(JNIEnv *env, jobject obj) {
+    JNIV8Object_PrepareJNICall(JNIV8GenericObject, v8::Object, nullptr);
+
+    if(!localRef->IsArrayBufferView()) {
+        return nullptr;
+    }
+
+    v8::Local<v8::ArrayBufferView> view = localRef.As<v8::ArrayBufferView>();
+    jsize length = (jsize)view->ByteLength();
+    jbyteArray result = env->NewByteArray(length);
+    if(length) {
+        const uint8_t *data = (const uint8_t*)view->Buffer()->GetContents().Data() + view->ByteOffset();
+        env->SetByteArrayRegion(result, 0, length, (const jbyte*)data);
+    }
+    return result;
+}
@@ -15,6 +15,16 @@ public:
     static void initializeJNIBindings(JNIClassInfo *info, bool isReload);
 
     static jobject jniCreate(JNIEnv *env, jobject obj, jobject engineObj);
+
+    /**
+     * typed arrays are created from and copied into java primitive arrays in one go
+     */
+    static jobject jniCreateFloat64Array(JNIEnv *env, jobject obj, jobject engineObj, jdoubleArray elements);
+    static jobject jniCreateInt32Array(JNIEnv *env, jobject obj, jobject engineObj, jintArray elements);
+    static jdoubleArray jniToDoubleArray(JNIEnv *env, jobject obj);
+    static jintArray jniToIntArray(JNIEnv *env, jobject obj);
+    // bytes of any typed array or DataView, nullptr for all other objects
+    static jbyteArray jniToByteArray(JNIEnv *env, jobject obj);
 };
 
 BGJS_JNI_LINK_DEF(JNIV8GenericObject)
@@ -0,0 +1,277 @@
+//
+// Specialized calls of java methods with common signatures
+//
+
+#include "JNIV8JavaThunks.h"
+#include "JNIV8ClassInfo.h"
+#include "JNIV8Object.h"
+#include "../bgjs/BGJSV8Engine.h"
+
+#include <cmath>
+#include <unordered_map>
+
+using namespace v8;
+
+/**
+ * conversion of one argument; mirrors the cases of JNIV8Marshalling::convertV8ValueToJavaValue for unboxed values
+ */
+template<typename T> struct JNIV8ThunkArgument;
+
+template<> struct JNIV8ThunkArgument<jboolean> {
+    static inline JNIV8MarshallingError convert(JNIEnv *env, Isolate *isolate, Local<Value> value, const JNIV8JavaValue &arg, jvalue *target) {
+        target->z = (jboolean) value->BooleanValue(isolate);
+        return JNIV8MarshallingError::kOk;
+    }
+};
+
+static inline double numberValue(Isolate *isolate, Local<Value> value) {
+    return value->IsNumber() ? value.As<Number>()->Value() : value->NumberValue(isolate->GetCurrentContext()).FromMaybe(FP_NAN);
+}
+
+template<> struct JNIV8ThunkArgument<jint> {
+    static inline JNIV8MarshallingError convert(JNIEnv *env, Isolate *isolate, Local<Value> value, const JNIV8JavaValue &arg, jvalue *target) {
+        if (value->IsInt32()) {
+            target->i = value.As<Int32>()->Value();
+            return JNIV8MarshallingError::kOk;
+        }
+        const double number = numberValue(isolate, value);
+        if (std::isnan(number)) return JNIV8MarshallingError::kNoNaN;
+        target->i = (jint) number;
+        return target->i != number ? JNIV8MarshallingError::kOutOfRange : JNIV8MarshallingError::kOk;
+    }
+};
+
+template<> struct JNIV8ThunkArgument<jlong> {
+    static inline JNIV8MarshallingError convert(JNIEnv *env, Isolate *isolate, Local<Value> value, const JNIV8JavaValue &arg, jvalue *target) {
+        const double number = numberValue(isolate, value);
+        if (std::isnan(number)) return JNIV8MarshallingError::kNoNaN;
+        target->j = (jlong) number;
+        return target->j != number ? JNIV8MarshallingError::kOutOfRange : JNIV8MarshallingError::kOk;
+    }
+};
+
+template<> struct JNIV8ThunkArgument<jfloat> {
+    static inline JNIV8MarshallingError convert(JNIEnv *env, Isolate *isolate, Local<Value> value, const JNIV8JavaValue &arg, jvalue *target) {
+        target->f = (jfloat) numberValue(isolate, value);
+        return JNIV8MarshallingError::kOk;
+    }
+};
+
+template<> struct JNIV8ThunkArgument<jdouble> {
+    static inline JNIV8MarshallingError convert(JNIEnv *env, Isolate *isolate, Local<Value> value, const JNIV8JavaValue &arg, jvalue *target) {
+        target->d = numberValue(isolate, value);
+        return JNIV8MarshallingError::kOk;
+    }
+};
+
+template<> struct JNIV8ThunkArgument<jstring> {
+    static inline JNIV8MarshallingError convert(JNIEnv *env, Isolate *isolate, Local<Value> value, const JNIV8JavaValue &arg, jvalue *target) {
+        if (!(arg.flags & JNIV8MarshallingFlags::kCoerceNull) &&
+            (value->IsNull() || (value->IsUndefined() && (arg.flags & JNIV8MarshallingFlags::kUndefinedIsNull)))) {
+            target->l = nullptr;
+            return (arg.flags & JNIV8MarshallingFlags::kNonNull) ? JNIV8MarshallingError::kNotNullable : JNIV8MarshallingError::kOk;
+        }
+        target->l = JNIV8Marshalling::v8value2jobject(env, value->IsString() ? value : Local<Value>(value->ToString(isolate)));
+        return JNIV8MarshallingError::kOk;
+    }
+};
+
+/**
+ * call with one return type; the result is only set if the method did not throw
+ */
+template<typename R> struct JNIV8ThunkResult;
+
+template<> struct JNIV8ThunkResult<void> {
+    static inline void call(const FunctionCallbackInfo<Value>& args, JNIEnv *env, jclass clazz, jmethodID methodId, jobject object, const jvalue *jargs) {
+        if (object) {
+            env->CallVoidMethodA(object, methodId, jargs);
+        } else {
+            env->CallStaticVoidMethodA(clazz, methodId, jargs);
+        }
+    }
+};
+
+template<> struct JNIV8ThunkResult<jboolean> {
+    static inline void call(const FunctionCallbackInfo<Value>& args, JNIEnv *env, jclass clazz, jmethodID methodId, jobject object, const jvalue *jargs) {
+        const jboolean result = object ? env->CallBooleanMethodA(object, methodId, jargs) : env->CallStaticBooleanMethodA(clazz, methodId, jargs);
+        if (!env->ExceptionCheck()) args.GetReturnValue().Set(result != JNI_FALSE);
+    }
+};
+
+template<> struct JNIV8ThunkResult<jint> {
+    static inline void call(const FunctionCallbackInfo<Value>& args, JNIEnv *env, jclass clazz, jmethodID methodId, jobject object, const jvalue *jargs) {
+        const jint result = object ? env->CallIntMethodA(object, methodId, jargs) : env->CallStaticIntMethodA(clazz, methodId, jargs);
+        if (!env->ExceptionCheck()) args.GetReturnValue().Set((int32_t) result);
+    }
+};
+
+template<> struct JNIV8ThunkResult<jlong> {
+    static inline void call(const FunctionCallbackInfo<Value>& args, JNIEnv *env, jclass clazz, jmethodID methodId, jobject object, const jvalue *jargs) {
+        const jlong result = object ? env->CallLongMethodA(object, methodId, jargs) : env->CallStaticLongMethodA(clazz, methodId, jargs);
+        if (!env->ExceptionCheck()) args.GetReturnValue().Set((double) result);
+    }
+};
+
+template<> struct JNIV8ThunkResult<jfloat> {
+    static inline void call(const FunctionCallbackInfo<Value>& args, JNIEnv *env, jclass clazz, jmethodID methodId, jobject object, const jvalue *jargs) {
+        const jfloat result = object ? env->CallFloatMethodA(object, methodId, jargs) : env->CallStaticFloatMethodA(clazz, methodId, jargs);
+        if (!env->ExceptionCheck()) args.GetReturnValue().Set((double) result);
+    }
+};
+
+template<> struct JNIV8ThunkResult<jdouble> {
+    static inline void call(const FunctionCallbackInfo<Value>& args, JNIEnv *env, jclass clazz, jmethodID methodId, jobject object, const jvalue *jargs) {
+        const jdouble result = object ? env->CallDoubleMethodA(object, methodId, jargs) : env->CallStaticDoubleMethodA(clazz, methodId, jargs);
+        if (!env->ExceptionCheck()) args.GetReturnValue().Set(result);
+    }
+};
+
+template<> struct JNIV8ThunkResult<jstring> {
+    static inline void call(const FunctionCallbackInfo<Value>& args, JNIEnv *env, jclass clazz, jmethodID methodId, jobject object, const jvalue *jargs) {
+        jobject result = object ? env->CallObjectMethodA(object, methodId, jargs) : env->CallStaticObjectMethodA(clazz, methodId, jargs);
+        if (env->ExceptionCheck()) return;
+        if (result) {
+            args.GetReturnValue().Set(JNIV8Marshalling::jstring2v8string(env, (jstring) result));
+            env->DeleteLocalRef(result);
+        } else {
+            args.GetReturnValue().SetNull();
+        }
+    }
+};
+
+template<typename A>
+static inline bool convertArgument(const FunctionCallbackInfo<Value>& args, JNIEnv *env, JNIV8ObjectJavaCallbackHolder *cb,
+                                   const JNIV8ObjectJavaSignatureInfo *signature, int index, jvalue *jargs) {
+    Isolate *isolate = args.GetIsolate();
+    Local<Value> value = args[index];
+    const JNIV8MarshallingError res = JNIV8ThunkArgument<A>::convert(env, isolate, value, (*signature->arguments)[index], &jargs[index]);
+    if (res != JNIV8MarshallingError::kOk) {
+        JNIV8JavaThunks::throwArgumentError(isolate, res, index, cb->methodName, value);
+        return false;
+    }
+    return true;
+}
+
+template<typename R>
+static inline void finishCall(const FunctionCallbackInfo<Value>& args, JNIEnv *env, JNIV8ObjectJavaCallbackHolder *cb,
+                              const JNIV8ObjectJavaSignatureInfo *signature, jobject object, const jvalue *jargs) {
+    JNIV8ThunkResult<R>::call(args, env, cb->javaClass, signature->javaMethodId, object, jargs);
+    // java method could have thrown an exception; if so forward it to v8
+    if (env->ExceptionCheck()) {
+        BGJSV8Engine::GetInstance(args.GetIsolate())->forwardJNIExceptionToV8();
+    }
+}
+
+template<typename R>
+static void thunk(const FunctionCallbackInfo<Value>& args, JNIEnv *env, JNIV8ObjectJavaCallbackHolder *cb,
+                  const JNIV8ObjectJavaSignatureInfo *signature, jobject object) {
+    finishCall<R>(args, env, cb, signature, object, nullptr);
+}
+
+template<typename R, typename A0>
+static void thunk(const FunctionCallbackInfo<Value>& args, JNIEnv *env, JNIV8ObjectJavaCallbackHolder *cb,
+                  const JNIV8ObjectJavaSignatureInfo *signature, jobject object) {
+    jvalue jargs[1];
+    if (!convertArgument<A0>(args, env, cb, signature, 0, jargs)) return;
+    finishCall<R>(args, env, cb, signature, object, jargs);
+}
+
+template<typename R, typename A0, typename A1>
+static void thunk(const FunctionCallbackInfo<Value>& args, JNIEnv *env, JNIV8ObjectJavaCallbackHolder *cb,
+                  const JNIV8ObjectJavaSignatureInfo *signature, jobject object) {
+    jvalue jargs[2];
+    if (!convertArgument<A0>(args, env, cb, signature, 0, jargs) ||
+        !convertArgument<A1>(args, env, cb, signature, 1, jargs)) return;
+    finishCall<R>(args, env, cb, signature, object, jargs);
+}
+
+template<typename R, typename A0, typename A1, typename A2>
+static void thunk(const FunctionCallbackInfo<Value>& args, JNIEnv *env, JNIV8ObjectJavaCallbackHolder *cb,
+                  const JNIV8ObjectJavaSignatureInfo *signature, jobject object) {
+    jvalue jargs[3];
+    if (!convertArgument<A0>(args, env, cb, signature, 0, jargs) ||
+        !convertArgument<A1>(args, env, cb, signature, 1, jargs) ||
+        !convertArgument<A2>(args, env, cb, signature, 2, jargs)) return;
+    finishCall<R>(args, env, cb, signature, object, jargs);
+}
+
+#define JNIV8_STRING "Ljava/lang/String;"
+
+JNIV8JavaThunk JNIV8JavaThunks::get(const std::string &signature, const std::vector<JNIV8JavaValue> *arguments) {
+    // signatures used by the bound methods of the app; add more here when they show up in traces
+    static const std::unordered_map<std::string, JNIV8JavaThunk> thunks = {
+        {"()V", thunk<void>},
+        {"()Z", thunk<jboolean>},
+        {"()I", thunk<jint>},
+        {"()J", thunk<jlong>},
+        {"()F", thunk<jfloat>},
+        {"()D", thunk<jdouble>},
+        {"()" JNIV8_STRING, thunk<jstring>},
+        {"(Z)V", thunk<void, jboolean>},
+        {"(I)V", thunk<void, jint>},
+        {"(J)V", thunk<void, jlong>},
+        {"(D)V", thunk<void, jdouble>},
+        {"(" JNIV8_STRING ")V", thunk<void, jstring>},
+        {"(I)Z", thunk<jboolean, jint>},
+        {"(" JNIV8_STRING ")Z", thunk<jboolean, jstring>},
+        {"(I)I", thunk<jint, jint>},
+        {"(" JNIV8_STRING ")I", thunk<jint, jstring>},
+        {"(I)D", thunk<jdouble, jint>},
+        {"(D)D", thunk<jdouble, jdouble>},
+        {"(" JNIV8_STRING ")D", thunk<jdouble, jstring>},
+        {"(I)" JNIV8_STRING, thunk<jstring, jint>},
+        {"(" JNIV8_STRING ")" JNIV8_STRING, thunk<jstring, jstring>},
+        {"(II)V", thunk<void, jint, jint>},
+        {"(DD)V", thunk<void, jdouble, jdouble>},
+        {"(I" JNIV8_STRING ")V", thunk<void, jint, jstring>},
+        {"(" JNIV8_STRING "Z)V", thunk<void, jstring, jboolean>},
+        {"(" JNIV8_STRING "I)V", thunk<void, jstring, jint>},
+        {"(" JNIV8_STRING "D)V", thunk<void, jstring, jdouble>},
+        {"(" JNIV8_STRING JNIV8_STRING ")V", thunk<void, jstring, jstring>},
+        {"(II)I", thunk<jint, jint, jint>},
+        {"(II)D", thunk<jdouble, jint, jint>},
+        {"(DD)Z", thunk<jboolean, jdouble, jdouble>},
+        {"(DD)D", thunk<jdouble, jdouble, jdouble>},
+        {"(" JNIV8_STRING JNIV8_STRING ")" JNIV8_STRING, thunk<jstring, jstring, jstring>},
+        {"(III)V", thunk<void, jint, jint, jint>},
+        {"(DDD)V", thunk<void, jdouble, jdouble, jdouble>},
+        {"(DDD)D", thunk<jdouble, jdouble, jdouble, jdouble>},
+    };
+
+    if (!arguments) {
+        return nullptr;
+    }
+    for (auto &arg : *arguments) {
+        if (arg.flags & JNIV8MarshallingFlags::kStrict) {
+            return nullptr;
+        }
+    }
+    auto it = thunks.find(signature);
+    return it != thunks.end() ? it->second : nullptr;
+}
+
+void JNIV8JavaThunks::throwArgumentError(Isolate *isolate, JNIV8MarshallingError error, int index,
+                                         const std::string &methodName, Local<Value> value) {
+    switch(error) {
+        default:
+        case JNIV8MarshallingError::kWrongType:
+            ThrowV8TypeError("wrong type for argument #" + std::to_string(index) + " of '" + methodName + "'");
+            break;
+        case JNIV8MarshallingError::kUndefined:
+            ThrowV8TypeError("argument #" + std::to_string(index) + " of '" + methodName + "' does not accept undefined");
+            break;
+        case JNIV8MarshallingError::kNotNullable:
+            ThrowV8TypeError("argument #" + std::to_string(index) + " of '" + methodName + "' is not nullable");
+            break;
+        case JNIV8MarshallingError::kNoNaN:
+            ThrowV8TypeError("argument #" + std::to_string(index) + " of '" + methodName + "' must not be NaN");
+            break;
+        case JNIV8MarshallingError::kVoidNotNull:
+            ThrowV8TypeError("argument #" + std::to_string(index) + " of '" + methodName + "' must be null or undefined");
+            break;
+        case JNIV8MarshallingError::kOutOfRange:
+            ThrowV8RangeError("value '"+
+                              JNIV8Marshalling::v8string2string(value->ToString(isolate))+"' is out of range for argument #" + std::to_string(index) + " of '" + methodName + "'");
+            break;
+    }
+}
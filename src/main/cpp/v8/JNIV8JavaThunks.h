@@ -0,0 +1,36 @@
+//
+// Specialized calls of java methods with common signatures
+//
+
+#ifndef TRADINGLIB_SAMPLE_JNIV8JAVATHUNKS_H
+#define TRADINGLIB_SAMPLE_JNIV8JAVATHUNKS_H
+
+#include "JNIV8Marshalling.h"
+
+#include <string>
+
+/**
+ * Java methods bound to js with @V8Function are called through JNIV8ClassInfo::v8JavaMethodCallback, which converts
+ * every argument and the result with a switch over its JNIV8JavaValue. For signatures of primitives and strings that
+ * are used a lot there are thunks instead: instantiations of templates that convert each argument directly to its
+ * jvalue member and call the typed JNI method, without the switch and without allocating anything.
+ *
+ * The annotation processor stores the JNI signature of every bound method, e.g. "(DD)D"; JNIV8Wrapper looks up the
+ * thunk for it once per engine when the class is initialized.
+ */
+class JNIV8JavaThunks {
+public:
+    /**
+     * thunk for the JNI signature of a method, or null if calls with this signature go through the generic marshalling
+     * arguments are the type infos of the arguments of the method; thunks do not implement JNIV8MarshallingFlags::kStrict
+     */
+    static JNIV8JavaThunk get(const std::string &signature, const std::vector<JNIV8JavaValue> *arguments);
+
+    /**
+     * throws the js exception for an argument that could not be converted
+     */
+    static void throwArgumentError(v8::Isolate *isolate, JNIV8MarshallingError error, int index,
+                                   const std::string &methodName, v8::Local<v8::Value> value);
+};
+
+#endif //TRADINGLIB_SAMPLE_JNIV8JAVATHUNKS_H
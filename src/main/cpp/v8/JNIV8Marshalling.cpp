@@ -10,7 +10,10 @@
 
 #include "JNIV8Function.h"
 #include "JNIV8Array.h"
+#include "JNIV8ArrayBuffer.h"
 #include "JNIV8GenericObject.h"
+#include "../bgjs/BGJSV8Engine.h"
+#include "../bgjs/BGJSTrace.h"
 
 JNIV8JavaValueType getArgumentType(const std::string& type) {
     if(type == "Z" || type == "Ljava/lang/Boolean;") {
@@ -153,11 +156,16 @@ decltype(JNIV8Marshalling::_jniFloat) JNIV8Marshalling::_jniFloat = {0};
 decltype(JNIV8Marshalling::_jniDouble) JNIV8Marshalling::_jniDouble = {0};
 decltype(JNIV8Marshalling::_jniNumber) JNIV8Marshalling::_jniNumber = {0};
 decltype(JNIV8Marshalling::_jniV8Object) JNIV8Marshalling::_jniV8Object = {0};
+decltype(JNIV8Marshalling::_jniByteBuffer) JNIV8Marshalling::_jniByteBuffer = {0};
 decltype(JNIV8Marshalling::_jniObject) JNIV8Marshalling::_jniObject = {0};
 decltype(JNIV8Marshalling::_jniString) JNIV8Marshalling::_jniString = {0};
 decltype(JNIV8Marshalling::_jniVoid) JNIV8Marshalling::_jniVoid = {0};
 jobject JNIV8Marshalling::_undefined = nullptr;
 std::unordered_map<int, JNIV8JavaValueType> JNIV8Marshalling::_typeMap;
+decltype(JNIV8Marshalling::_finalClasses) JNIV8Marshalling::_finalClasses = {};
+jobject JNIV8Marshalling::_smallNumbers[];
+jobject JNIV8Marshalling::_true = nullptr;
+jobject JNIV8Marshalling::_false = nullptr;
 
 /**
  * register an alias for a primitive type
@@ -195,10 +203,35 @@ void JNIV8Marshalling::initJNICache() {
     _jniNumber.clazz = (jclass)env->NewGlobalRef(env->FindClass("java/lang/Number"));
     _jniNumber.doubleValueId = env->GetMethodID(_jniNumber.clazz, "doubleValue","()D");
     _jniV8Object.clazz = (jclass)env->NewGlobalRef(env->FindClass("ag/boersego/bgjs/JNIV8Object"));
+    _jniByteBuffer.clazz = (jclass)env->NewGlobalRef(env->FindClass("java/nio/ByteBuffer"));
     _jniString.clazz = (jclass)env->NewGlobalRef(env->FindClass("java/lang/String"));
     _typeMap[env->CallIntMethod(_jniString.clazz, hashCodeId)] = JNIV8JavaValueType::kString;
     _jniVoid.clazz = (jclass)env->NewGlobalRef(env->FindClass("java/lang/Void"));
     _typeMap[env->CallIntMethod(_jniVoid.clazz, hashCodeId)] = JNIV8JavaValueType::kVoid;
+
+    // most frequently converted classes first
+    _finalClasses[0] = {_jniString.clazz, JNIV8JavaValueType::kString};
+    _finalClasses[1] = {_jniDouble.clazz, JNIV8JavaValueType::kDouble};
+    _finalClasses[2] = {_jniInteger.clazz, JNIV8JavaValueType::kInteger};
+    _finalClasses[3] = {_jniBoolean.clazz, JNIV8JavaValueType::kBoolean};
+    _finalClasses[4] = {_jniLong.clazz, JNIV8JavaValueType::kLong};
+    _finalClasses[5] = {_jniFloat.clazz, JNIV8JavaValueType::kFloat};
+    _finalClasses[6] = {_jniCharacter.clazz, JNIV8JavaValueType::kCharacter};
+    _finalClasses[7] = {_jniShort.clazz, JNIV8JavaValueType::kShort};
+    _finalClasses[8] = {_jniByte.clazz, JNIV8JavaValueType::kByte};
+
+    jobject tempObj;
+    for(int i = kSmallNumberMin; i <= kSmallNumberMax; i++) {
+        tempObj = env->CallStaticObjectMethod(_jniDouble.clazz, _jniDouble.valueOfId, (jdouble)i);
+        _smallNumbers[i - kSmallNumberMin] = env->NewGlobalRef(tempObj);
+        env->DeleteLocalRef(tempObj);
+    }
+    tempObj = env->CallStaticObjectMethod(_jniBoolean.clazz, _jniBoolean.valueOfId, JNI_TRUE);
+    _true = env->NewGlobalRef(tempObj);
+    env->DeleteLocalRef(tempObj);
+    tempObj = env->CallStaticObjectMethod(_jniBoolean.clazz, _jniBoolean.valueOfId, JNI_FALSE);
+    _false = env->NewGlobalRef(tempObj);
+    env->DeleteLocalRef(tempObj);
 }
 
 /**
@@ -218,7 +251,7 @@ JNIV8MarshallingError JNIV8Marshalling::convertV8ValueToJavaValue(JNIEnv *env, v
         v8::Isolate* isolate = v8::Isolate::GetCurrent();
         switch (arg.valueType) {
             case JNIV8JavaValueType::kObject:
-                target->l = JNIV8Marshalling::v8value2jobject(v8Value);
+                target->l = JNIV8Marshalling::v8value2jobject(env, v8Value);
                 if (!target->l) {
                     // check nullability
                     if ((arg.flags & JNIV8MarshallingFlags::kNonNull)) {
@@ -307,7 +340,7 @@ JNIV8MarshallingError JNIV8Marshalling::convertV8ValueToJavaValue(JNIEnv *env, v
             case JNIV8JavaValueType::kString: {
                 if((arg.flags & JNIV8MarshallingFlags::kStrict) && !v8Value->IsString())
                     return JNIV8MarshallingError::kWrongType;
-                target->l = JNIV8Marshalling::v8value2jobject(v8Value->ToString(isolate));
+                target->l = JNIV8Marshalling::v8value2jobject(env, v8Value->ToString(isolate));
                 break;
             }
             case JNIV8JavaValueType::kVoid: {
@@ -327,6 +360,7 @@ JNIV8MarshallingError JNIV8Marshalling::convertV8ValueToJavaValue(JNIEnv *env, v
  * if object is null, the method is assumed to be static
  */
 v8::Local<v8::Value> JNIV8Marshalling::callJavaMethod(JNIEnv *env, JNIV8JavaValue returnType, jclass clazz, jmethodID methodId, jobject object, jvalue *args) {
+    BGJSTraceScope trace("JNIV8Marshalling.callJavaMethod");
     JNILocalFrame localFrame(env, 1);
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
     v8::EscapableHandleScope handleScope(isolate);
@@ -348,7 +382,7 @@ v8::Local<v8::Value> JNIV8Marshalling::callJavaMethod(JNIEnv *env, JNIV8JavaValu
                 jresult = env->CallStaticObjectMethodA(clazz, methodId, args);
             }
             if(!env->ExceptionCheck()) {
-                result = JNIV8Marshalling::jobject2v8value(jresult);
+                result = JNIV8Marshalling::jobject2v8value(env, jresult);
             } else {
                 result = v8::Undefined(isolate);
             }
@@ -427,14 +461,18 @@ v8::Local<v8::Value> JNIV8Marshalling::callJavaMethod(JNIEnv *env, JNIV8JavaValu
 
 
 /**
- * convert a jstring to a std::string
+ * convert a jstring to a v8::String
+ * short strings are copied onto the stack instead of pinning or copying them on the heap
  */
 v8::Local<v8::String> JNIV8Marshalling::jstring2v8string(jstring string) {
+    return jstring2v8string(JNIWrapper::getEnvironment(), string);
+}
+
+v8::Local<v8::String> JNIV8Marshalling::jstring2v8string(JNIEnv *env, jstring string) {
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
     // because this method returns a local, we can assume that the correct v8 scopes are active around it already
     // we still need a handle scope however...
     v8::EscapableHandleScope scope(isolate);
-    JNIEnv *env = JNIWrapper::getEnvironment();
 
     v8::MaybeLocal<v8::String> maybeLocal;
     jsize len;
@@ -446,36 +484,110 @@ v8::Local<v8::String> JNIV8Marshalling::jstring2v8string(jstring string) {
 
     len = env->GetStringLength(string);
 
-    if(len > 0) {
-        const jchar *chars = env->GetStringChars(string, nullptr);
+    if(len > 0 && len <= kStringBufferLength) {
+        jchar chars[kStringBufferLength];
+        env->GetStringRegion(string, 0, len, chars);
         maybeLocal = v8::String::NewFromTwoByte(isolate, chars, v8::NewStringType::kNormal, len);
-        env->ReleaseStringChars(string, chars);
+    } else if(len > 0) {
+        // not using GetStringCritical here: allocating the v8 string can trigger a gc, and weak callbacks use jni
+        jchar *chars = new jchar[len];
+        env->GetStringRegion(string, 0, len, chars);
+        maybeLocal = v8::String::NewFromTwoByte(isolate, chars, v8::NewStringType::kNormal, len);
+        delete[] chars;
     }
 
     // if string is empty or if conversion failed we return an empty string
     if(!len || maybeLocal.IsEmpty()) {
-        maybeLocal = v8::String::NewFromOneByte(isolate, (uint8_t*)"", v8::NewStringType::kInternalized);
-        if(maybeLocal.IsEmpty()) {
-            return scope.Escape(v8::Undefined(isolate).As<v8::String>());
-        }
+        return scope.Escape(v8::String::Empty(isolate));
     }
 
     return scope.Escape(maybeLocal.ToLocalChecked());
 }
 
+/**
+ * convert a jstring that is used as a property name to an internalized v8::String
+ */
+v8::Local<v8::String> JNIV8Marshalling::jstring2v8propertyname(jstring string) {
+    return jstring2v8propertyname(JNIWrapper::getEnvironment(), string);
+}
+
+v8::Local<v8::String> JNIV8Marshalling::jstring2v8propertyname(JNIEnv *env, jstring string) {
+    v8::Isolate* isolate = v8::Isolate::GetCurrent();
+
+    jsize len = env->IsSameObject(string, NULL) ? -1 : env->GetStringLength(string);
+    if(len < 0 || len > BGJSStringCache::kMaxLength) {
+        return jstring2v8string(env, string);
+    }
+
+    jchar chars[BGJSStringCache::kMaxLength];
+    env->GetStringRegion(string, 0, len, chars);
+    return BGJSV8Engine::GetInstance(isolate)->getPropertyName(chars, len);
+}
+
 /**
  * convert a v8 string to a jstring
+ * one byte strings consisting only of ascii characters are created via NewStringUTF, which lets the vm skip widening them
  */
 jstring JNIV8Marshalling::v8string2jstring(v8::Local<v8::String> string) {
-    JNIEnv *env = JNIWrapper::getEnvironment();
-    return env->NewString(*v8::String::Value(v8::Isolate::GetCurrent(), string), string->Length()); // returns "" when called with NULL,0
+    return v8string2jstring(JNIWrapper::getEnvironment(), string);
+}
+
+jstring JNIV8Marshalling::v8string2jstring(JNIEnv *env, v8::Local<v8::String> string) {
+    v8::Isolate* isolate = v8::Isolate::GetCurrent();
+
+    const int len = string->Length();
+    if(!len) {
+        return env->NewString(nullptr, 0);
+    }
+
+    jchar stackChars[kStringBufferLength];
+    jchar *chars = len <= kStringBufferLength ? stackChars : new jchar[len];
+
+    if(string->IsOneByte()) {
+        uint8_t stackBytes[kStringBufferLength + 1];
+        uint8_t *bytes = len <= kStringBufferLength ? stackBytes : new uint8_t[len + 1];
+        string->WriteOneByte(isolate, bytes, 0, len, v8::String::NO_NULL_TERMINATION);
+
+        bool isAscii = true;
+        for(int i = 0; i < len; i++) {
+            if(bytes[i] >= 0x80 || !bytes[i]) {
+                isAscii = false;
+                break;
+            }
+        }
+
+        jstring result = nullptr;
+        if(isAscii) {
+            bytes[len] = 0;
+            result = env->NewStringUTF((const char*)bytes);
+        } else {
+            // latin1 maps directly to the first 256 code points
+            for(int i = 0; i < len; i++) {
+                chars[i] = bytes[i];
+            }
+        }
+        if(bytes != stackBytes) delete[] bytes;
+        if(result) {
+            if(chars != stackChars) delete[] chars;
+            return result;
+        }
+    } else {
+        string->Write(isolate, chars, 0, len, v8::String::NO_NULL_TERMINATION);
+    }
+
+    jstring result = env->NewString(chars, len);
+    if(chars != stackChars) delete[] chars;
+    return result;
 }
 
 /**
  * convert an instance of V8Value to a jobject
  */
 jobject JNIV8Marshalling::v8value2jobject(v8::Local<v8::Value> valueRef) {
-    JNIEnv *env = JNIWrapper::getEnvironment();
+    return v8value2jobject(JNIWrapper::getEnvironment(), valueRef);
+}
+
+jobject JNIV8Marshalling::v8value2jobject(JNIEnv *env, v8::Local<v8::Value> valueRef) {
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
     v8::HandleScope scope(isolate);
 
@@ -487,6 +599,8 @@ jobject JNIV8Marshalling::v8value2jobject(v8::Local<v8::Value> valueRef) {
             return JNIV8Wrapper::wrapObject<JNIV8Function>(objectRef)->getJObject();
         } else if (valueRef->IsArray()) {
             return JNIV8Wrapper::wrapObject<JNIV8Array>(objectRef)->getJObject();
+        } else if (valueRef->IsArrayBuffer()) {
+            return JNIV8Wrapper::wrapObject<JNIV8ArrayBuffer>(objectRef)->getJObject();
         }
         auto ptr = JNIV8Wrapper::wrapObject<JNIV8Object>(objectRef);
         if (ptr) {
@@ -495,11 +609,18 @@ jobject JNIV8Marshalling::v8value2jobject(v8::Local<v8::Value> valueRef) {
             return JNIV8Wrapper::wrapObject<JNIV8GenericObject>(objectRef)->getJObject();
         }
     } else if(valueRef->IsNumber()) {
-        return env->CallStaticObjectMethod(_jniDouble.clazz, _jniDouble.valueOfId, valueRef->NumberValue(isolate->GetCurrentContext()).FromJust());
+        // small integers are shared (IsInt32 is false for -0, which keeps its own box)
+        if(valueRef->IsInt32()) {
+            int32_t value = valueRef.As<v8::Int32>()->Value();
+            if(value >= kSmallNumberMin && value <= kSmallNumberMax) {
+                return env->NewLocalRef(_smallNumbers[value - kSmallNumberMin]);
+            }
+        }
+        return env->CallStaticObjectMethod(_jniDouble.clazz, _jniDouble.valueOfId, valueRef.As<v8::Number>()->Value());
     } else if(valueRef->IsString()) {
-        return JNIV8Marshalling::v8string2jstring(valueRef.As<v8::String>());
+        return JNIV8Marshalling::v8string2jstring(env, valueRef.As<v8::String>());
     } else if(valueRef->IsBoolean()) {
-        return env->CallStaticObjectMethod(_jniBoolean.clazz, _jniBoolean.valueOfId, valueRef->BooleanValue(isolate));
+        return env->NewLocalRef(valueRef->IsTrue() ? _true : _false);
     } else if(valueRef->IsUndefined()) {
         return env->NewLocalRef(_undefined);
     } else if(valueRef->IsSymbol()) {
@@ -514,6 +635,10 @@ jobject JNIV8Marshalling::v8value2jobject(v8::Local<v8::Value> valueRef) {
  * convert an instance of Object to a v8value
  */
 v8::Local<v8::Value> JNIV8Marshalling::jobject2v8value(jobject object) {
+    return jobject2v8value(JNIWrapper::getEnvironment(), object);
+}
+
+v8::Local<v8::Value> JNIV8Marshalling::jobject2v8value(JNIEnv *env, jobject object) {
     v8::Isolate* isolate = v8::Isolate::GetCurrent();
     // because this method returns a local, we can assume that the correct v8 scopes are active around it already
     // we still need a handle scope however...
@@ -521,27 +646,56 @@ v8::Local<v8::Value> JNIV8Marshalling::jobject2v8value(jobject object) {
 
     v8::Local<v8::Value> resultRef;
 
-    JNIEnv *env = JNIWrapper::getEnvironment();
-
     // jobject referencing "null" can actually be non-null..
     if(env->IsSameObject(object, NULL) || !object) {
-        resultRef = v8::Null(isolate);
-    } else if(env->IsInstanceOf(object, _jniString.clazz)) {
-        resultRef = JNIV8Marshalling::jstring2v8string((jstring)object);
-    } else if(env->IsInstanceOf(object, _jniCharacter.clazz)) {
-        jchar c = env->CallCharMethod(object, _jniCharacter.charValueId);
-        v8::MaybeLocal<v8::String> maybeLocal = v8::String::NewFromTwoByte(isolate, &c, v8::NewStringType::kNormal, 1);
-        if(!maybeLocal.IsEmpty()) {
-            resultRef = maybeLocal.ToLocalChecked();
-        }
-    } else if(env->IsInstanceOf(object, _jniNumber.clazz)) {
-        jdouble n = env->CallDoubleMethod(object, _jniNumber.doubleValueId);
-        resultRef = v8::Number::New(isolate, n);
-    } else if(env->IsInstanceOf(object, _jniBoolean.clazz)) {
-        jboolean b = env->CallBooleanMethod(object, _jniBoolean.booleanValueId);
-        resultRef = v8::Boolean::New(isolate, b);
-    } else if(env->IsInstanceOf(object, _jniV8Object.clazz)) {
-        resultRef = JNIV8Wrapper::wrapObject<JNIV8Object>(object)->getJSObject();
+        return scope.Escape(v8::Null(isolate));
+    }
+
+    // strings and boxed primitives are final, so the exact class identifies them
+    JNIV8JavaValueType type = JNIV8JavaValueType::kObject;
+    jclass clazz = env->GetObjectClass(object);
+    for(auto &it : _finalClasses) {
+        if(env->IsSameObject(clazz, it.clazz)) {
+            type = it.type;
+            break;
+        }
+    }
+    env->DeleteLocalRef(clazz);
+
+    switch(type) {
+        case JNIV8JavaValueType::kString:
+            resultRef = JNIV8Marshalling::jstring2v8string(env, (jstring)object);
+            break;
+        case JNIV8JavaValueType::kCharacter: {
+            jchar c = env->CallCharMethod(object, _jniCharacter.charValueId);
+            v8::MaybeLocal<v8::String> maybeLocal = v8::String::NewFromTwoByte(isolate, &c, v8::NewStringType::kNormal, 1);
+            if(!maybeLocal.IsEmpty()) {
+                resultRef = maybeLocal.ToLocalChecked();
+            }
+            break;
+        }
+        case JNIV8JavaValueType::kBoolean: {
+            jboolean b = env->CallBooleanMethod(object, _jniBoolean.booleanValueId);
+            resultRef = v8::Boolean::New(isolate, b);
+            break;
+        }
+        case JNIV8JavaValueType::kObject:
+            if(env->IsInstanceOf(object, _jniV8Object.clazz)) {
+                resultRef = JNIV8Wrapper::wrapObject<JNIV8Object>(object)->getJSObject();
+                break;
+            } else if(env->IsInstanceOf(object, _jniByteBuffer.clazz)) {
+                // direct buffers are shared with js without copying; others are not supported
+                resultRef = JNIV8ArrayBuffer::newArrayBuffer(env, isolate, object);
+                break;
+            } else if(!env->IsInstanceOf(object, _jniNumber.clazz)) {
+                break;
+            }
+            // other subclasses of Number are converted like the boxed primitives
+        default: {
+            jdouble n = env->CallDoubleMethod(object, _jniNumber.doubleValueId);
+            resultRef = v8::Number::New(isolate, n);
+            break;
+        }
     }
     if(resultRef.IsEmpty()) {
         resultRef = v8::Undefined(isolate);
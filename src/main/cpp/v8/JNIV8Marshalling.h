@@ -9,6 +9,7 @@
 #include <jni.h>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 /**
  * structs for describing java method signatures and arguments
@@ -71,9 +72,18 @@ struct JNIV8JavaValue {
     JNIV8JavaValue(JNIV8JavaValueType type, jclass clazz, JNIV8MarshallingFlags flags = JNIV8MarshallingFlags::kDefault);
 };
 
+struct JNIV8ObjectJavaCallbackHolder;
+struct JNIV8ObjectJavaSignatureInfo;
+
+// call of a java method with one fixed signature, see JNIV8JavaThunks
+typedef void(*JNIV8JavaThunk)(const v8::FunctionCallbackInfo<v8::Value>& args, JNIEnv *env, JNIV8ObjectJavaCallbackHolder *cb,
+                             const JNIV8ObjectJavaSignatureInfo *signature, jobject object);
+
 struct JNIV8ObjectJavaSignatureInfo {
     jmethodID javaMethodId;
     std::vector<JNIV8JavaValue>* arguments;
+    // null if calls are marshalled generically
+    JNIV8JavaThunk thunk;
 };
 
 class JNIV8Marshalling {
@@ -108,22 +118,34 @@ public:
 
     /**
      * convert a v8 value to an instance of Object
+     * the variants without env look up the environment of the current thread
      */
+    static jobject v8value2jobject(JNIEnv *env, v8::Local<v8::Value> valueRef);
     static jobject v8value2jobject(v8::Local<v8::Value> valueRef);
 
     /**
      * convert an instance of Object to a v8value
      */
+    static v8::Local<v8::Value> jobject2v8value(JNIEnv *env, jobject object);
     static v8::Local<v8::Value> jobject2v8value(jobject object);
 
     /**
      * convert a jstring to a v8::String
      */
+    static v8::Local<v8::String> jstring2v8string(JNIEnv *env, jstring string);
     static v8::Local<v8::String> jstring2v8string(jstring string);
 
+    /**
+     * convert a jstring that is used as a property name to an internalized v8::String
+     * short names are cached per engine
+     */
+    static v8::Local<v8::String> jstring2v8propertyname(JNIEnv *env, jstring string);
+    static v8::Local<v8::String> jstring2v8propertyname(jstring string);
+
     /**
      * convert a v8::String to a jstring
      */
+    static jstring v8string2jstring(JNIEnv *env, v8::Local<v8::String> string);
     static jstring v8string2jstring(v8::Local<v8::String> string);
 
     /**
@@ -146,9 +168,24 @@ public:
      */
     static void registerAliasForPrimitive(jint aliasType, jint primitiveType);
 private:
+    // strings up to this length are converted using buffers on the stack
+    static const int kStringBufferLength = 256;
+
     static jobject _undefined;
     static std::unordered_map<int, JNIV8JavaValueType> _typeMap;
 
+    // final classes that can be identified by comparing the class of an object instead of walking IsInstanceOf checks
+    static struct FinalClassInfo {
+        jclass clazz;
+        JNIV8JavaValueType type;
+    } _finalClasses[9];
+
+    // boxes for integral numbers in this range are created once and shared
+    static const int kSmallNumberMin = -128;
+    static const int kSmallNumberMax = 1023;
+    static jobject _smallNumbers[kSmallNumberMax - kSmallNumberMin + 1];
+    static jobject _true, _false;
+
     static struct {
         jclass clazz;
         jmethodID valueOfId;
@@ -169,7 +206,7 @@ private:
     } _jniNumber;
     static struct {
         jclass clazz;
-    } _jniObject, _jniV8Object, _jniString, _jniVoid;
+    } _jniObject, _jniV8Object, _jniString, _jniVoid, _jniByteBuffer;
 };
 
 
@@ -4,6 +4,7 @@
 
 #include "JNIV8Object.h"
 #include "JNIV8Wrapper.h"
+#include "JNIV8ObjectStats.h"
 #include "../bgjs/BGJSV8Engine.h"
 
 #include <stdlib.h>
@@ -54,6 +55,7 @@ void JNIV8Object::initJNICache() {
 
 JNIV8Object::JNIV8Object(jobject obj, JNIClassInfo *info) : JNIObject(obj, info) {
     _externalMemory = 0;
+    _allocationSite = JNIV8ObjectStats::sample(info);
     // __android_log_print(ANDROID_LOG_INFO, "JNIV8Object", "created v8 object: %s", getCanonicalName().c_str());
 }
 
@@ -63,10 +65,26 @@ JNIV8Object::~JNIV8Object() {
     if(!_jsObject.IsEmpty()) {
         // adjust external memory counter if required
         JNI_ASSERT(!_jsObject.IsWeak(), "JNIV8Object deleted while still referenced by JavaScript");
+        if(_v8ClassInfo->container->type == JNIV8ObjectType::kWrapper) {
+            // the js object must not hand out this instance anymore
+            Isolate* isolate = _bgjsEngine->getIsolate();
+            Isolate::Scope isolateScope(isolate);
+            HandleScope scope(isolate);
+            Context::Scope ctxScope(_bgjsEngine->getContext());
+            JNIV8Wrapper::removeCachedWrapper(_bgjsEngine, Local<Object>::New(isolate, _jsObject), this);
+        }
         _jsObject.Reset();
+        _jniClassInfo->stats.jsObjects.fetch_sub(1, std::memory_order_relaxed);
+    }
+    if(_allocationSite >= 0) {
+        JNIV8ObjectStats::release(_allocationSite);
     }
 }
 
+void JNIV8Object::dispose() {
+    _bgjsEngine->disposeLater(this);
+}
+
 void JNIV8Object::weakPersistentCallback(const WeakCallbackInfo<void>& data) {
     // never use the raw pointer directly; this way we are retaining the object until this method finishes!
     auto jniV8Object = reinterpret_cast<JNIV8Object*>(data.GetParameter());
@@ -81,6 +99,7 @@ void JNIV8Object::weakPersistentCallback(const WeakCallbackInfo<void>& data) {
     // we are only holding the object because java/native is still alive, v8 can not gc it anymore
     // => adjust external memory counter
     jniV8Object->_bgjsEngine->getIsolate()->AdjustAmountOfExternalAllocatedMemory(-jniV8Object->_externalMemory);
+    jniV8Object->_jniClassInfo->stats.externalMemory.fetch_sub(jniV8Object->_externalMemory, std::memory_order_relaxed);
 
     // finally: the js object is no longer being used => release the strong reference to the java object
     // NOTE: object might be deleted by another thread after calling this
@@ -99,6 +118,7 @@ void JNIV8Object::makeWeak() {
 
     // object can be gc'd by v8 => adjust external memory counter
     _bgjsEngine->getIsolate()->AdjustAmountOfExternalAllocatedMemory(_externalMemory);
+    _jniClassInfo->stats.externalMemory.fetch_add(_externalMemory, std::memory_order_relaxed);
 }
 
 void JNIV8Object::linkJSObject(v8::Handle<v8::Object> jsObject) {
@@ -107,10 +127,13 @@ void JNIV8Object::linkJSObject(v8::Handle<v8::Object> jsObject) {
     // store reference to native object in JS object
     if(_v8ClassInfo->container->type != JNIV8ObjectType::kWrapper) {
         JNI_ASSERT(jsObject->GetInternalField(0)->IsUndefined(), "failed to link js object");
-        jsObject->SetInternalField(0, External::New(isolate, (void *) this));
+        jsObject->SetAlignedPointerInInternalField(0, this);
     }
 
     // store reference in persistent
+    if(_jsObject.IsEmpty()) {
+        _jniClassInfo->stats.jsObjects.fetch_add(1, std::memory_order_relaxed);
+    }
     _jsObject.Reset(isolate, jsObject);
 }
 
@@ -121,6 +144,7 @@ void JNIV8Object::adjustJSExternalMemory(int64_t change) {
     // - is still referenced from JS
     if(!_jsObject.IsEmpty() && _jsObject.IsWeak()) {
         _bgjsEngine->getIsolate()->AdjustAmountOfExternalAllocatedMemory(change);
+        _jniClassInfo->stats.externalMemory.fetch_add(change, std::memory_order_relaxed);
     }
 }
 
@@ -182,18 +206,30 @@ void JNIV8Object::initializeJNIBindings(JNIClassInfo *info, bool isReload) {
     info->registerNativeMethod("adjustJSExternalMemory", "(J)V", (void*)JNIV8Object::jniAdjustJSExternalMemory);
     info->registerNativeMethod("_applyV8Method", "(Ljava/lang/String;IILjava/lang/Class;[Ljava/lang/Object;)Ljava/lang/Object;", (void*)JNIV8Object::jniCallV8MethodWithReturnType);
     info->registerNativeMethod("_getV8Field", "(Ljava/lang/String;IILjava/lang/Class;)Ljava/lang/Object;", (void*)JNIV8Object::jniGetV8FieldWithReturnType);
+    info->registerNativeMethod("_applyV8MethodDouble", "(Ljava/lang/String;I[Ljava/lang/Object;)D", (void*)JNIV8Object::jniCallV8MethodDouble);
+    info->registerNativeMethod("_applyV8MethodInt", "(Ljava/lang/String;I[Ljava/lang/Object;)I", (void*)JNIV8Object::jniCallV8MethodInt);
+    info->registerNativeMethod("_applyV8MethodBoolean", "(Ljava/lang/String;I[Ljava/lang/Object;)Z", (void*)JNIV8Object::jniCallV8MethodBoolean);
+    info->registerNativeMethod("_getV8FieldDouble", "(Ljava/lang/String;I)D", (void*)JNIV8Object::jniGetV8FieldDouble);
+    info->registerNativeMethod("_getV8FieldInt", "(Ljava/lang/String;I)I", (void*)JNIV8Object::jniGetV8FieldInt);
+    info->registerNativeMethod("_getV8FieldBoolean", "(Ljava/lang/String;I)Z", (void*)JNIV8Object::jniGetV8FieldBoolean);
     info->registerNativeMethod("setV8Field", "(Ljava/lang/String;Ljava/lang/Object;)V", (void*)JNIV8Object::jniSetV8Field);
     info->registerNativeMethod("setV8Fields", "(Ljava/util/Map;)V", (void*)JNIV8Object::jniSetV8Fields);
 
     info->registerNativeMethod("hasV8Field", "(Ljava/lang/String;Z)Z", (void*)JNIV8Object::jniHasV8Field);
+    info->registerNativeMethod("_getV8FieldWithKey", "(IIILjava/lang/Class;)Ljava/lang/Object;", (void*)JNIV8Object::jniGetV8FieldWithKey);
+    info->registerNativeMethod("_setV8FieldWithKey", "(ILjava/lang/Object;)V", (void*)JNIV8Object::jniSetV8FieldWithKey);
+    info->registerNativeMethod("_applyV8MethodWithKey", "(IIILjava/lang/Class;[Ljava/lang/Object;)Ljava/lang/Object;", (void*)JNIV8Object::jniCallV8MethodWithKey);
+    info->registerNativeMethod("_hasV8FieldWithKey", "(IZ)Z", (void*)JNIV8Object::jniHasV8FieldWithKey);
     info->registerNativeMethod("getV8Keys", "(Z)[Ljava/lang/String;", (void*)JNIV8Object::jniGetV8Keys);
     info->registerNativeMethod("getV8Fields", "(ZIILjava/lang/Class;)Ljava/util/Map;", (void*)JNIV8Object::jniGetV8Fields);
+    info->registerNativeMethod("_getV8FieldsByName", "([Ljava/lang/String;IILjava/lang/Class;)[Ljava/lang/Object;", (void*)JNIV8Object::jniGetV8FieldsByName);
 
     info->registerNativeMethod("toNumber", "()D", (void*)JNIV8Object::jniToNumber);
     info->registerNativeMethod("toString", "()Ljava/lang/String;", (void*)JNIV8Object::jniToString);
     info->registerNativeMethod("toJSON", "()Ljava/lang/String;", (void*)JNIV8Object::jniToJSON);
 
     info->registerNativeMethod("RegisterV8Class", "(Ljava/lang/String;Ljava/lang/String;)V", (void*)JNIV8Object::jniRegisterV8Class);
+    info->registerNativeMethod("CreateMany", "(Lag/boersego/bgjs/V8Engine;Ljava/lang/String;I)[Lag/boersego/bgjs/JNIV8Object;", (void*)JNIV8Object::jniCreateMany);
     info->registerNativeMethod("RegisterAliasForPrimitive", "(II)V", (void*)JNIV8Object::jniRegisterAliasForPrimitive);
 }
 
@@ -203,21 +239,52 @@ void JNIV8Object::jniAdjustJSExternalMemory(JNIEnv *env, jobject obj, jlong chan
 }
 
 jobject JNIV8Object::jniGetV8FieldWithReturnType(JNIEnv *env, jobject obj, jstring name, jint flags, jint type, jclass returnType) {
-    JNIV8Object_PrepareJNICall(JNIV8Object, Object, nullptr);
+    jvalue jval;
+    if(!getV8FieldValue(env, obj, name, -1, JNIV8Marshalling::valueWithClass(type, returnType, (JNIV8MarshallingFlags)flags), &jval)) {
+        return nullptr;
+    }
+    return jval.l;
+}
 
-    JNIV8JavaValue arg = JNIV8Marshalling::valueWithClass(type, returnType, (JNIV8MarshallingFlags)flags);
+jdouble JNIV8Object::jniGetV8FieldDouble(JNIEnv *env, jobject obj, jstring name, jint flags) {
+    jvalue jval;
+    if(!getV8FieldValue(env, obj, name, -1, JNIV8Marshalling::valueWithType(JNIV8JavaValueType::kDouble, false, (JNIV8MarshallingFlags)flags), &jval)) {
+        return 0;
+    }
+    return jval.d;
+}
+
+jint JNIV8Object::jniGetV8FieldInt(JNIEnv *env, jobject obj, jstring name, jint flags) {
+    jvalue jval;
+    if(!getV8FieldValue(env, obj, name, -1, JNIV8Marshalling::valueWithType(JNIV8JavaValueType::kInteger, false, (JNIV8MarshallingFlags)flags), &jval)) {
+        return 0;
+    }
+    return jval.i;
+}
+
+jboolean JNIV8Object::jniGetV8FieldBoolean(JNIEnv *env, jobject obj, jstring name, jint flags) {
+    jvalue jval;
+    if(!getV8FieldValue(env, obj, name, -1, JNIV8Marshalling::valueWithType(JNIV8JavaValueType::kBoolean, false, (JNIV8MarshallingFlags)flags), &jval)) {
+        return JNI_FALSE;
+    }
+    return jval.z;
+}
+
+bool JNIV8Object::getV8FieldValue(JNIEnv *env, jobject obj, jstring name, jint key, const JNIV8JavaValue &arg, jvalue *target) {
+    JNIV8Object_PrepareJNICall(JNIV8Object, Object, false);
 
-    MaybeLocal<Value> valueRef = localRef->Get(context, JNIV8Marshalling::jstring2v8string(name));
+    Local<String> nameRef = key >= 0 ? engine->getPropertyKey(key) : JNIV8Marshalling::jstring2v8propertyname(env, name);
+    MaybeLocal<Value> valueRef = localRef->Get(context, nameRef);
     if(valueRef.IsEmpty()) {
         ptr->getEngine()->forwardV8ExceptionToJNI(&try_catch);
-        return nullptr;
+        return false;
     }
 
-    jvalue jval;
+    jvalue &jval = *target;
     memset(&jval, 0, sizeof(jvalue));
     JNIV8MarshallingError res = JNIV8Marshalling::convertV8ValueToJavaValue(env, valueRef.ToLocalChecked(), arg, &jval);
     if(res != JNIV8MarshallingError::kOk) {
-        std::string strFieldName = JNIWrapper::jstring2string(name);
+        std::string strFieldName = JNIV8Marshalling::v8string2string(nameRef);
         switch(res) {
             default:
             case JNIV8MarshallingError::kWrongType:
@@ -240,19 +307,50 @@ jobject JNIV8Object::jniGetV8FieldWithReturnType(JNIEnv *env, jobject obj, jstri
                                   JNIV8Marshalling::v8string2string(valueRef.ToLocalChecked()->ToString(context).ToLocalChecked())+"' is out of range for field '" + strFieldName + "'");
                 break;
         }
-        return nullptr;
+        return false;
     }
 
-    return jval.l;
+    return true;
 }
 
 void JNIV8Object::jniSetV8Field(JNIEnv *env, jobject obj, jstring name, jobject value) {
-    JNIV8Object_PrepareJNICall(JNIV8Object, Object, void());
+    setV8FieldValue(env, obj, name, -1, value);
+}
+
+bool JNIV8Object::setV8FieldValue(JNIEnv *env, jobject obj, jstring name, jint key, jobject value) {
+    JNIV8Object_PrepareJNICall(JNIV8Object, Object, false);
 
-    Maybe<bool> res = localRef->Set(context, JNIV8Marshalling::jstring2v8string(name), JNIV8Marshalling::jobject2v8value(value));
+    Local<String> nameRef = key >= 0 ? engine->getPropertyKey(key) : JNIV8Marshalling::jstring2v8propertyname(env, name);
+    Maybe<bool> res = localRef->Set(context, nameRef, JNIV8Marshalling::jobject2v8value(env, value));
     if(res.IsNothing()) {
         ptr->getEngine()->forwardV8ExceptionToJNI(&try_catch);
+        return false;
+    }
+    return true;
+}
+
+jobject JNIV8Object::jniGetV8FieldWithKey(JNIEnv *env, jobject obj, jint key, jint flags, jint type, jclass returnType) {
+    jvalue jval;
+    if(!getV8FieldValue(env, obj, nullptr, key, JNIV8Marshalling::valueWithClass(type, returnType, (JNIV8MarshallingFlags)flags), &jval)) {
+        return nullptr;
+    }
+    return jval.l;
+}
+
+void JNIV8Object::jniSetV8FieldWithKey(JNIEnv *env, jobject obj, jint key, jobject value) {
+    setV8FieldValue(env, obj, nullptr, key, value);
+}
+
+jobject JNIV8Object::jniCallV8MethodWithKey(JNIEnv *env, jobject obj, jint key, jint flags, jint type, jclass returnType, jobjectArray arguments) {
+    jvalue jval;
+    if(!callV8MethodValue(env, obj, nullptr, key, JNIV8Marshalling::valueWithClass(type, returnType, (JNIV8MarshallingFlags)flags), arguments, &jval)) {
+        return nullptr;
     }
+    return jval.l;
+}
+
+jboolean JNIV8Object::jniHasV8FieldWithKey(JNIEnv *env, jobject obj, jint key, jboolean ownOnly) {
+    return hasV8FieldValue(env, obj, nullptr, key, ownOnly);
 }
 
 void JNIV8Object::jniSetV8Fields(JNIEnv *env, jobject obj, jobject map) {
@@ -273,7 +371,7 @@ void JNIV8Object::jniSetV8Fields(JNIEnv *env, jobject obj, jobject map) {
         jstring key = (jstring) env->CallObjectMethod(entry, _jniMapEntry.getKeyId);
         jobject value = env->CallObjectMethod(entry, _jniMapEntry.getValueId);
 
-        Maybe<bool> res = localRef->Set(context, JNIV8Marshalling::jstring2v8string(key), JNIV8Marshalling::jobject2v8value(value));
+        Maybe<bool> res = localRef->Set(context, JNIV8Marshalling::jstring2v8propertyname(env, key), JNIV8Marshalling::jobject2v8value(env, value));
         if(res.IsNothing()) {
             ptr->getEngine()->forwardV8ExceptionToJNI(&try_catch);
             break;
@@ -286,22 +384,53 @@ void JNIV8Object::jniSetV8Fields(JNIEnv *env, jobject obj, jobject map) {
 }
 
 jobject JNIV8Object::jniCallV8MethodWithReturnType(JNIEnv *env, jobject obj, jstring name, jint flags, jint type, jclass returnType, jobjectArray arguments) {
-    JNIV8Object_PrepareJNICall(JNIV8Object, Object, nullptr);
+    jvalue jval;
+    if(!callV8MethodValue(env, obj, name, -1, JNIV8Marshalling::valueWithClass(type, returnType, (JNIV8MarshallingFlags)flags), arguments, &jval)) {
+        return nullptr;
+    }
+    return jval.l;
+}
 
-    JNIV8JavaValue arg = JNIV8Marshalling::valueWithClass(type, returnType, (JNIV8MarshallingFlags)flags);
+jdouble JNIV8Object::jniCallV8MethodDouble(JNIEnv *env, jobject obj, jstring name, jint flags, jobjectArray arguments) {
+    jvalue jval;
+    if(!callV8MethodValue(env, obj, name, -1, JNIV8Marshalling::valueWithType(JNIV8JavaValueType::kDouble, false, (JNIV8MarshallingFlags)flags), arguments, &jval)) {
+        return 0;
+    }
+    return jval.d;
+}
+
+jint JNIV8Object::jniCallV8MethodInt(JNIEnv *env, jobject obj, jstring name, jint flags, jobjectArray arguments) {
+    jvalue jval;
+    if(!callV8MethodValue(env, obj, name, -1, JNIV8Marshalling::valueWithType(JNIV8JavaValueType::kInteger, false, (JNIV8MarshallingFlags)flags), arguments, &jval)) {
+        return 0;
+    }
+    return jval.i;
+}
+
+jboolean JNIV8Object::jniCallV8MethodBoolean(JNIEnv *env, jobject obj, jstring name, jint flags, jobjectArray arguments) {
+    jvalue jval;
+    if(!callV8MethodValue(env, obj, name, -1, JNIV8Marshalling::valueWithType(JNIV8JavaValueType::kBoolean, false, (JNIV8MarshallingFlags)flags), arguments, &jval)) {
+        return JNI_FALSE;
+    }
+    return jval.z;
+}
+
+bool JNIV8Object::callV8MethodValue(JNIEnv *env, jobject obj, jstring name, jint key, const JNIV8JavaValue &arg, jobjectArray arguments, jvalue *target) {
+    JNIV8Object_PrepareJNICall(JNIV8Object, Object, false);
 
     MaybeLocal<Value> maybeLocal;
     Local<Value> funcRef;
-    maybeLocal = localRef->Get(context, JNIV8Marshalling::jstring2v8string(name));
+    Local<String> nameRef = key >= 0 ? engine->getPropertyKey(key) : JNIV8Marshalling::jstring2v8propertyname(env, name);
+    maybeLocal = localRef->Get(context, nameRef);
     if (!maybeLocal.ToLocal<Value>(&funcRef)) {
         ptr->getEngine()->forwardV8ExceptionToJNI(&try_catch);
-        return nullptr;
+        return false;
     }
     if(!funcRef->IsFunction()) {
         ptr = nullptr; // release shared_ptr before throwing an exception!
         env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"),
                       "Called v8 field is not a function");
-        return nullptr;
+        return false;
     }
 
     jsize numArgs;
@@ -313,7 +442,7 @@ jobject JNIV8Object::jniCallV8MethodWithReturnType(JNIEnv *env, jobject obj, jst
         args = (Local<Value>*)malloc(sizeof(Local<Value>)*numArgs);
         for(jsize i=0; i<numArgs; i++) {
             tempObj = env->GetObjectArrayElement(arguments, i);
-            args[i] = JNIV8Marshalling::jobject2v8value(tempObj);
+            args[i] = JNIV8Marshalling::jobject2v8value(env, tempObj);
             env->DeleteLocalRef(tempObj);
         }
     } else {
@@ -324,18 +453,18 @@ jobject JNIV8Object::jniCallV8MethodWithReturnType(JNIEnv *env, jobject obj, jst
     maybeLocal = Local<Object>::Cast(funcRef)->CallAsFunction(context, localRef, numArgs, args);
     if (!maybeLocal.ToLocal<Value>(&resultRef)) {
         ptr->getEngine()->forwardV8ExceptionToJNI(&try_catch);
-        return nullptr;
+        return false;
     }
 
     if(args) {
         free(args);
     }
 
-    jvalue jval;
+    jvalue &jval = *target;
     memset(&jval, 0, sizeof(jvalue));
     JNIV8MarshallingError res = JNIV8Marshalling::convertV8ValueToJavaValue(env, resultRef, arg, &jval);
     if(res != JNIV8MarshallingError::kOk) {
-        std::string strMethodName = JNIWrapper::jstring2string(name);
+        std::string strMethodName = JNIV8Marshalling::v8string2string(nameRef);
         switch(res) {
             default:
             case JNIV8MarshallingError::kWrongType:
@@ -358,16 +487,20 @@ jobject JNIV8Object::jniCallV8MethodWithReturnType(JNIEnv *env, jobject obj, jst
                                   JNIV8Marshalling::v8string2string(resultRef->ToString(context).ToLocalChecked())+"' is out of range for method '" + strMethodName + "'");
                 break;
         }
-        return nullptr;
+        return false;
     }
 
-    return jval.l;
+    return true;
 }
 
 jboolean JNIV8Object::jniHasV8Field(JNIEnv *env, jobject obj, jstring name, jboolean ownOnly) {
+    return hasV8FieldValue(env, obj, name, -1, ownOnly);
+}
+
+jboolean JNIV8Object::hasV8FieldValue(JNIEnv *env, jobject obj, jstring name, jint key, jboolean ownOnly) {
     JNIV8Object_PrepareJNICall(JNIV8Object, Object, false);
 
-    Local<String> keyRef = JNIV8Marshalling::jstring2v8string(name);
+    Local<String> keyRef = key >= 0 ? engine->getPropertyKey(key) : JNIV8Marshalling::jstring2v8propertyname(env, name);
     Maybe<bool> res = ownOnly ? localRef->HasOwnProperty(context, keyRef) : localRef->Has(context, keyRef);
     if(res.IsNothing()) {
         ptr->getEngine()->forwardV8ExceptionToJNI(&try_catch);
@@ -399,7 +532,7 @@ jobjectArray JNIV8Object::jniGetV8Keys(JNIEnv *env, jobject obj, jboolean ownOnl
             ptr->getEngine()->forwardV8ExceptionToJNI(&try_catch);
             return nullptr;
         }
-        string = JNIV8Marshalling::v8string2jstring(valueRef->ToString(isolate));
+        string = JNIV8Marshalling::v8string2jstring(env, valueRef->ToString(isolate));
         if(!result) {
             result = env->NewObjectArray(n, _jniString.clazz, string);
         } else {
@@ -474,7 +607,7 @@ jobject JNIV8Object::jniGetV8Fields(JNIEnv *env, jobject obj, jboolean ownOnly,
             return nullptr;
         }
 
-        strObj = JNIV8Marshalling::v8string2jstring(keyRef);
+        strObj = JNIV8Marshalling::v8string2jstring(env, keyRef);
         env->CallObjectMethod(result,
                               _jniHashMap.putId,
                               strObj,
@@ -487,6 +620,67 @@ jobject JNIV8Object::jniGetV8Fields(JNIEnv *env, jobject obj, jboolean ownOnly,
     return result;
 }
 
+jobjectArray JNIV8Object::jniGetV8FieldsByName(JNIEnv *env, jobject obj, jobjectArray names, jint flags, jint type, jclass returnType) {
+    JNIV8Object_PrepareJNICall(JNIV8Object, Object, nullptr);
+
+    JNIV8JavaValue arg = JNIV8Marshalling::valueWithClass(type, returnType, (JNIV8MarshallingFlags)flags);
+
+    const jsize numNames = env->GetArrayLength(names);
+    jobjectArray result = env->NewObjectArray(numNames, _jniObject.clazz, nullptr);
+
+    // we are only using the .l member of the jvalue; so one memset is enough!
+    jvalue jval = {0};
+    memset(&jval, 0, sizeof(jvalue));
+
+    for(jsize i=0; i<numNames; i++) {
+        // handles of one field are not needed anymore once its value was stored
+        HandleScope fieldScope(isolate);
+
+        jstring name = (jstring)env->GetObjectArrayElement(names, i);
+        Local<String> keyRef = JNIV8Marshalling::jstring2v8propertyname(env, name);
+        env->DeleteLocalRef(name);
+
+        Local<Value> valueRef;
+        if(!localRef->Get(context, keyRef).ToLocal(&valueRef)) {
+            ptr->getEngine()->forwardV8ExceptionToJNI(&try_catch);
+            return nullptr;
+        }
+
+        JNIV8MarshallingError res = JNIV8Marshalling::convertV8ValueToJavaValue(env, valueRef, arg, &jval);
+        if(res != JNIV8MarshallingError::kOk) {
+            std::string strFieldName = JNIV8Marshalling::v8string2string(keyRef);
+            switch(res) {
+                default:
+                case JNIV8MarshallingError::kWrongType:
+                    ThrowJNICastError("wrong type for field '" + strFieldName + "'");
+                    break;
+                case JNIV8MarshallingError::kUndefined:
+                    ThrowJNICastError("field '" + strFieldName + "' must not be undefined");
+                    break;
+                case JNIV8MarshallingError::kNotNullable:
+                    ThrowJNICastError("field '" + strFieldName + "' is not nullable");
+                    break;
+                case JNIV8MarshallingError::kNoNaN:
+                    ThrowJNICastError("field '" + strFieldName + "' must not be NaN");
+                    break;
+                case JNIV8MarshallingError::kVoidNotNull:
+                    ThrowJNICastError("field '" + strFieldName + "' can only be null or undefined");
+                    break;
+                case JNIV8MarshallingError::kOutOfRange:
+                    ThrowJNICastError("assigned value '"+
+                                      JNIV8Marshalling::v8string2string(valueRef->ToString(context).ToLocalChecked())+"' is out of range for field '" + strFieldName + "'");
+                    break;
+            }
+            return nullptr;
+        }
+
+        env->SetObjectArrayElement(result, i, jval.l);
+        env->DeleteLocalRef(jval.l);
+    }
+
+    return result;
+}
+
 jdouble JNIV8Object::jniToNumber(JNIEnv *env, jobject obj) {
     JNIV8Object_PrepareJNICall(JNIV8Object, Object, 0);
     v8::Maybe<double> numberValue = localRef->NumberValue(context);
@@ -504,7 +698,7 @@ jstring JNIV8Object::jniToJSON(JNIEnv *env, jobject obj) {
         engine->forwardV8ExceptionToJNI(&try_catch);
         return nullptr;
     }
-    return JNIV8Marshalling::v8string2jstring(stringValue.ToLocalChecked().As<v8::String>());
+    return JNIV8Marshalling::v8string2jstring(env, stringValue.ToLocalChecked().As<v8::String>());
 }
 
 jstring JNIV8Object::jniToString(JNIEnv *env, jobject obj) {
@@ -514,7 +708,7 @@ jstring JNIV8Object::jniToString(JNIEnv *env, jobject obj) {
         engine->forwardV8ExceptionToJNI(&try_catch);
         return nullptr;
     }
-    return JNIV8Marshalling::v8string2jstring(maybeLocal.ToLocalChecked());
+    return JNIV8Marshalling::v8string2jstring(env, maybeLocal.ToLocalChecked());
 }
 
 void JNIV8Object::jniRegisterV8Class(JNIEnv *env, jobject obj, jstring derivedClass, jstring baseClass) {
@@ -527,6 +721,16 @@ void JNIV8Object::jniRegisterV8Class(JNIEnv *env, jobject obj, jstring derivedCl
     JNIV8Wrapper::registerJavaObject(strDerivedClass, strBaseClass);
 }
 
+jobjectArray JNIV8Object::jniCreateMany(JNIEnv *env, jobject obj, jobject engineObj, jstring canonicalName, jint count) {
+    auto engine = JNIWrapper::wrapObject<BGJSV8Engine>(engineObj);
+    JNI_ASSERT(engine, "Invalid engine parameter");
+
+    std::string strCanonicalName = JNIWrapper::jstring2string(canonicalName);
+    std::replace(strCanonicalName.begin(), strCanonicalName.end(), '.', '/');
+
+    return JNIV8Wrapper::createObjects(engine.get(), strCanonicalName, count);
+}
+
 void JNIV8Object::jniRegisterAliasForPrimitive(JNIEnv *env, jobject obj, jint aliasType, jint primitiveType) {
     JNIV8Marshalling::registerAliasForPrimitive(aliasType, primitiveType);
 }
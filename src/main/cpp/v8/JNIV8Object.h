@@ -55,6 +55,14 @@ public:
      */
     v8::Local<v8::Object> getJSObject();
 
+    /**
+     * returns the native object of a js object created from the template of a JNIV8Object class
+     * it is stored as an aligned pointer in the first internal field, so no External has to be allocated or read
+     */
+    static JNIV8Object* fromJSObject(v8::Local<v8::Object> object) {
+        return reinterpret_cast<JNIV8Object*>(object->GetAlignedPointerFromInternalField(0));
+    }
+
     /**
      * returns the referenced engine
      */
@@ -64,6 +72,11 @@ public:
      * cache JNI class references
      */
     static void initJNICache();
+
+    /**
+     * the destructor needs the isolate => garbage collected objects are deleted on the js thread
+     */
+    void dispose() override;
 protected:
     /**
      * can be used to tell the javascript engine about the amount of memory used by the
@@ -88,18 +101,41 @@ private:
     static void jniSetV8Field(JNIEnv *env, jobject obj, jstring name, jobject value);
     static void jniSetV8Fields(JNIEnv *env, jobject obj, jobject map);
     static jobject jniCallV8MethodWithReturnType(JNIEnv *env, jobject obj, jstring name, jint flags, jint type, jclass returnType, jobjectArray arguments);
+    // unboxed variants for primitive results
+    static jdouble jniGetV8FieldDouble(JNIEnv *env, jobject obj, jstring name, jint flags);
+    static jint jniGetV8FieldInt(JNIEnv *env, jobject obj, jstring name, jint flags);
+    static jboolean jniGetV8FieldBoolean(JNIEnv *env, jobject obj, jstring name, jint flags);
+    static jdouble jniCallV8MethodDouble(JNIEnv *env, jobject obj, jstring name, jint flags, jobjectArray arguments);
+    static jint jniCallV8MethodInt(JNIEnv *env, jobject obj, jstring name, jint flags, jobjectArray arguments);
+    static jboolean jniCallV8MethodBoolean(JNIEnv *env, jobject obj, jstring name, jint flags, jobjectArray arguments);
+    // variants taking a property key created by V8Engine.createPropertyKey instead of a name
+    static jobject jniGetV8FieldWithKey(JNIEnv *env, jobject obj, jint key, jint flags, jint type, jclass returnType);
+    static void jniSetV8FieldWithKey(JNIEnv *env, jobject obj, jint key, jobject value);
+    static jobject jniCallV8MethodWithKey(JNIEnv *env, jobject obj, jint key, jint flags, jint type, jclass returnType, jobjectArray arguments);
+    static jboolean jniHasV8FieldWithKey(JNIEnv *env, jobject obj, jint key, jboolean ownOnly);
+    // shared implementation; the property is looked up by key if it is >= 0, by name otherwise
+    // returns false if a java exception is pending
+    static bool getV8FieldValue(JNIEnv *env, jobject obj, jstring name, jint key, const JNIV8JavaValue &arg, jvalue *target);
+    static bool callV8MethodValue(JNIEnv *env, jobject obj, jstring name, jint key, const JNIV8JavaValue &arg, jobjectArray arguments, jvalue *target);
+    static bool setV8FieldValue(JNIEnv *env, jobject obj, jstring name, jint key, jobject value);
+    static jboolean hasV8FieldValue(JNIEnv *env, jobject obj, jstring name, jint key, jboolean ownOnly);
     static jboolean jniHasV8Field(JNIEnv *env, jobject obj, jstring name, jboolean ownOnly);
     static jobjectArray jniGetV8Keys(JNIEnv *env, jobject obj, jboolean ownOnly);
     static jobject jniGetV8Fields(JNIEnv *env, jobject obj, jboolean ownOnly, jint flags, jint type, jclass returnType);
+    static jobjectArray jniGetV8FieldsByName(JNIEnv *env, jobject obj, jobjectArray names, jint flags, jint type, jclass returnType);
     static jdouble jniToNumber(JNIEnv *env, jobject obj);
     static jstring jniToString(JNIEnv *env, jobject obj);
     static jstring jniToJSON(JNIEnv *env, jobject obj);
     static void jniRegisterV8Class(JNIEnv *env, jobject obj, jstring derivedClass, jstring baseClass);
+    static jobjectArray jniCreateMany(JNIEnv *env, jobject obj, jobject engineObj, jstring canonicalName, jint count);
     static void jniRegisterAliasForPrimitive(JNIEnv *env, jobject obj, jint aliasType, jint primitiveType);
 
     // v8 callbacks
     static void weakPersistentCallback(const v8::WeakCallbackInfo<void>& data);
 
+    // site the object was sampled at by JNIV8ObjectStats, or -1
+    int32_t _allocationSite;
+
     // cached classes + ids
     static struct {
         jclass clazz;
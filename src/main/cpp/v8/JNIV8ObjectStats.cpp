@@ -0,0 +1,162 @@
+//
+// Live object counters and sampled allocation sites of JNIObject classes
+//
+
+#include "JNIV8ObjectStats.h"
+#include "../jni/JNIWrapper.h"
+
+#include <v8.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <stdio.h>
+#include <unordered_map>
+#include <vector>
+
+using namespace v8;
+
+namespace {
+    const int kSiteFrames = 4;
+    // distinct sites that are kept; objects sampled after that count towards one site for all of them
+    const size_t kMaxSites = 1024;
+    const size_t kReportedSites = 100;
+
+    struct Site {
+        const JNIClassInfo *info;
+        std::string stack;
+        int64_t live, sampled;
+    };
+
+    std::atomic<uint32_t> sampleInterval(0);
+    std::atomic<uint32_t> sampleCounter(0);
+    std::mutex sitesMutex;
+    std::vector<Site> sites;
+    std::unordered_map<std::string, int32_t> siteIndex;
+
+    std::string currentStack() {
+        // objects created by java code without an engine on the thread have no js stack
+        Isolate *isolate = Isolate::GetCurrent();
+        if(!isolate || !Locker::IsLocked(isolate) || !isolate->InContext()) {
+            return "<java>";
+        }
+        HandleScope scope(isolate);
+        Local<StackTrace> stackTrace = StackTrace::CurrentStackTrace(isolate, kSiteFrames, StackTrace::kOverview);
+        std::stringstream str;
+        const int frames = stackTrace->GetFrameCount();
+        for(int i = 0; i < frames; i++) {
+            const Local<StackFrame> frame = stackTrace->GetFrame(isolate, i);
+            const String::Utf8Value scriptName(isolate, frame->GetScriptName());
+            const String::Utf8Value functionName(isolate, frame->GetFunctionName());
+            str << (i ? "\n" : "") << (*functionName && **functionName ? *functionName : "<anonymous>") << " ("
+                << (*scriptName ? *scriptName : "<unknown>") << ":" << frame->GetLineNumber() << ":"
+                << frame->GetColumn() << ")";
+        }
+        return frames ? str.str() : "<native>";
+    }
+
+    void appendString(std::ostringstream &json, const std::string &text) {
+        json << '"';
+        for(const char c : text) {
+            if(c == '"' || c == '\\') {
+                json << '\\' << c;
+            } else if((unsigned char)c < 0x20) {
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char)c);
+                json << escaped;
+            } else {
+                json << c;
+            }
+        }
+        json << '"';
+    }
+}
+
+void JNIV8ObjectStats::setSampleInterval(uint32_t interval) {
+    sampleInterval.store(interval, std::memory_order_relaxed);
+}
+
+int32_t JNIV8ObjectStats::sample(JNIClassInfo *info) {
+    const uint32_t interval = sampleInterval.load(std::memory_order_relaxed);
+    if(!interval || sampleCounter.fetch_add(1, std::memory_order_relaxed) % interval != 0) {
+        return -1;
+    }
+
+    const std::string stack = currentStack();
+    std::string key = info->getCanonicalName();
+    key += '\n';
+    key += stack;
+
+    std::lock_guard<std::mutex> lock(sitesMutex);
+    auto it = siteIndex.find(key);
+    int32_t site;
+    if(it != siteIndex.end()) {
+        site = it->second;
+    } else if(sites.size() < kMaxSites) {
+        site = (int32_t)sites.size();
+        sites.push_back({info, stack, 0, 0});
+        siteIndex[key] = site;
+    } else {
+        auto other = siteIndex.find("");
+        if(other == siteIndex.end()) {
+            site = (int32_t)sites.size();
+            sites.push_back({nullptr, "<other sites>", 0, 0});
+            siteIndex[""] = site;
+        } else {
+            site = other->second;
+        }
+    }
+    sites[site].live++;
+    sites[site].sampled++;
+    return site;
+}
+
+void JNIV8ObjectStats::release(int32_t site) {
+    std::lock_guard<std::mutex> lock(sitesMutex);
+    sites[site].live--;
+}
+
+std::string JNIV8ObjectStats::getJSON() {
+    std::ostringstream json;
+    json << "{\"classes\":[";
+    bool first = true;
+    for(const JNIClassInfo *info : JNIWrapper::getClassInfos()) {
+        const JNIClassStats &stats = info->stats;
+        const int64_t created = stats.createdObjects.load(std::memory_order_relaxed);
+        if(!created) {
+            continue;
+        }
+        json << (first ? "" : ",") << "{\"name\":";
+        appendString(json, info->getCanonicalName());
+        json << ",\"live\":" << stats.liveObjects.load(std::memory_order_relaxed) << ",\"created\":" << created
+             << ",\"strongRefs\":" << stats.strongRefs.load(std::memory_order_relaxed)
+             << ",\"jsObjects\":" << stats.jsObjects.load(std::memory_order_relaxed)
+             << ",\"externalMemory\":" << stats.externalMemory.load(std::memory_order_relaxed) << "}";
+        first = false;
+    }
+    json << "],\"sampleInterval\":" << sampleInterval.load(std::memory_order_relaxed) << ",\"sites\":[";
+
+    std::vector<Site> reported;
+    {
+        std::lock_guard<std::mutex> lock(sitesMutex);
+        for(const Site &site : sites) {
+            if(site.live > 0) {
+                reported.push_back(site);
+            }
+        }
+    }
+    std::sort(reported.begin(), reported.end(), [](const Site &a, const Site &b) { return a.live > b.live; });
+    if(reported.size() > kReportedSites) {
+        reported.resize(kReportedSites);
+    }
+    for(size_t i = 0; i < reported.size(); i++) {
+        json << (i ? "," : "") << "{\"name\":";
+        appendString(json, reported[i].info ? reported[i].info->getCanonicalName() : std::string());
+        json << ",\"stack\":";
+        appendString(json, reported[i].stack);
+        json << ",\"live\":" << reported[i].live << ",\"sampled\":" << reported[i].sampled << "}";
+    }
+    json << "]}";
+    return json.str();
+}
@@ -0,0 +1,35 @@
+//
+// Live object counters and sampled allocation sites of JNIObject classes
+//
+
+#ifndef TRADINGLIB_SAMPLE_JNIV8OBJECTSTATS_H
+#define TRADINGLIB_SAMPLE_JNIV8OBJECTSTATS_H
+
+#include <stdint.h>
+#include <string>
+
+struct JNIClassInfo;
+
+/**
+ * Snapshot of the JNIClassStats that every class keeps, for spotting leaked wrappers in production builds
+ * Optionally every n-th JNIV8Object records the top frames of the js stack it was created from. Sites are counted
+ * while their objects are alive, so the sites of a leak keep growing and stand out from those of short lived objects.
+ * Stats are kept per process, not per engine.
+ */
+class JNIV8ObjectStats {
+public:
+    // 0 turns sampling off, which is the default
+    static void setSampleInterval(uint32_t interval);
+
+    // called when a JNIV8Object is created; returns the site it was sampled at, or -1
+    static int32_t sample(JNIClassInfo *info);
+    static void release(int32_t site);
+
+    /**
+     * returns { classes: [{ name, live, created, strongRefs, jsObjects, externalMemory }], sampleInterval,
+     * sites: [{ name, stack, live, sampled }] } of the classes that had objects, and the sites with the most live objects
+     */
+    static std::string getJSON();
+};
+
+#endif //TRADINGLIB_SAMPLE_JNIV8OBJECTSTATS_H
@@ -0,0 +1,177 @@
+//
+// Conversion of java data objects to plain js objects
+//
+
+#include "JNIV8Record.h"
+#include "../bgjs/BGJSV8Engine.h"
+
+using namespace v8;
+
+// java.lang.reflect.Modifier
+#define JNIV8_MODIFIER_STATIC 0x0008
+#define JNIV8_MODIFIER_TRANSIENT 0x0080
+
+std::mutex JNIV8Record::_mutex;
+std::vector<JNIV8Record::Layout*> JNIV8Record::_layouts;
+
+const JNIV8Record::Layout* JNIV8Record::getLayout(JNIEnv *env, jclass recordClass) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto layout : _layouts) {
+        if (env->IsSameObject(layout->clazz, recordClass)) {
+            return layout;
+        }
+    }
+
+    // reflection is only used once per class, so its classes and methods are not cached
+    jclass clsClass = env->FindClass("java/lang/Class");
+    jclass clsField = env->FindClass("java/lang/reflect/Field");
+    jmethodID getDeclaredFieldsId = env->GetMethodID(clsClass, "getDeclaredFields", "()[Ljava/lang/reflect/Field;");
+    jmethodID getSuperclassId = env->GetMethodID(clsClass, "getSuperclass", "()Ljava/lang/Class;");
+    jmethodID getClassNameId = env->GetMethodID(clsClass, "getName", "()Ljava/lang/String;");
+    jmethodID getNameId = env->GetMethodID(clsField, "getName", "()Ljava/lang/String;");
+    jmethodID getTypeId = env->GetMethodID(clsField, "getType", "()Ljava/lang/Class;");
+    jmethodID getModifiersId = env->GetMethodID(clsField, "getModifiers", "()I");
+    jmethodID isSyntheticId = env->GetMethodID(clsField, "isSynthetic", "()Z");
+
+    Layout *layout = new Layout();
+    layout->clazz = (jclass) env->NewGlobalRef(recordClass);
+
+    // fields of super classes come first, so the properties of subclasses extend the shape of their base class
+    std::vector<jclass> classes;
+    for (jclass clazz = (jclass) env->NewLocalRef(recordClass); clazz; clazz = (jclass) env->CallObjectMethod(clazz, getSuperclassId)) {
+        classes.insert(classes.begin(), clazz);
+    }
+    for (jclass clazz : classes) {
+        jobjectArray fields = (jobjectArray) env->CallObjectMethod(clazz, getDeclaredFieldsId);
+        for (jsize i = 0, n = fields ? env->GetArrayLength(fields) : 0; i < n; i++) {
+            jobject field = env->GetObjectArrayElement(fields, i);
+            const jint modifiers = env->CallIntMethod(field, getModifiersId);
+            if ((modifiers & (JNIV8_MODIFIER_STATIC | JNIV8_MODIFIER_TRANSIENT)) || env->CallBooleanMethod(field, isSyntheticId)) {
+                env->DeleteLocalRef(field);
+                continue;
+            }
+
+            Field info;
+            jstring name = (jstring) env->CallObjectMethod(field, getNameId);
+            const jchar *chars = env->GetStringChars(name, nullptr);
+            info.name.assign((const char16_t *) chars, (size_t) env->GetStringLength(name));
+            env->ReleaseStringChars(name, chars);
+            env->DeleteLocalRef(name);
+
+            jobject type = env->CallObjectMethod(field, getTypeId);
+            const std::string typeName = JNIWrapper::jstring2string((jstring) env->CallObjectMethod(type, getClassNameId));
+            static const char *primitives[] = {"boolean", "Z", "byte", "B", "char", "C", "short", "S", "int", "I",
+                                               "long", "J", "float", "F", "double", "D"};
+            info.type = 'L';
+            for (size_t p = 0; p < sizeof(primitives) / sizeof(primitives[0]); p += 2) {
+                if (typeName == primitives[p]) {
+                    info.type = primitives[p + 1][0];
+                    break;
+                }
+            }
+            info.isString = typeName == "java.lang.String";
+            info.fieldId = env->FromReflectedField(field);
+            layout->fields.push_back(info);
+
+            env->DeleteLocalRef(type);
+            env->DeleteLocalRef(field);
+        }
+        if (fields) {
+            env->DeleteLocalRef(fields);
+        }
+        env->DeleteLocalRef(clazz);
+    }
+    env->DeleteLocalRef(clsClass);
+    env->DeleteLocalRef(clsField);
+
+    _layouts.push_back(layout);
+    return layout;
+}
+
+Local<Value> JNIV8Record::readField(JNIEnv *env, Isolate *isolate, jobject record, const Field &field) {
+    switch (field.type) {
+        case 'Z':
+            return Boolean::New(isolate, env->GetBooleanField(record, field.fieldId));
+        case 'B':
+            return Integer::New(isolate, env->GetByteField(record, field.fieldId));
+        case 'C': {
+            const jchar value = env->GetCharField(record, field.fieldId);
+            return String::NewFromTwoByte(isolate, &value, NewStringType::kNormal, 1).ToLocalChecked();
+        }
+        case 'S':
+            return Integer::New(isolate, env->GetShortField(record, field.fieldId));
+        case 'I':
+            return Integer::New(isolate, env->GetIntField(record, field.fieldId));
+        case 'J':
+            return Number::New(isolate, env->GetLongField(record, field.fieldId));
+        case 'F':
+            return Number::New(isolate, env->GetFloatField(record, field.fieldId));
+        case 'D':
+            return Number::New(isolate, env->GetDoubleField(record, field.fieldId));
+        default: {
+            jobject value = env->GetObjectField(record, field.fieldId);
+            if (!value) {
+                return Null(isolate);
+            }
+            Local<Value> result = field.isString ? JNIV8Marshalling::jstring2v8string(env, (jstring) value).As<Value>() :
+                                  JNIV8Marshalling::jobject2v8value(env, value);
+            env->DeleteLocalRef(value);
+            return result;
+        }
+    }
+}
+
+MaybeLocal<Array> JNIV8Record::createArray(BGJSV8Engine *engine, JNIEnv *env, jclass recordClass, jobjectArray records) {
+    Isolate *isolate = engine->getIsolate();
+    EscapableHandleScope scope(isolate);
+    Local<Context> context = engine->getContext();
+
+    const Layout *layout = getLayout(env, recordClass);
+    const size_t numFields = layout->fields.size();
+
+    // the keys are internalized once per engine; looking them up is a hash lookup per field, not per record
+    std::vector<Local<String>> keys(numFields);
+    for (size_t i = 0; i < numFields; i++) {
+        const std::u16string &name = layout->fields[i].name;
+        keys[i] = engine->getPropertyKey(engine->createPropertyKey((const uint16_t *) name.data(), (int) name.size()));
+    }
+
+    Local<ObjectTemplate> tpl = engine->getRecordTemplate(layout);
+    if (tpl.IsEmpty()) {
+        tpl = ObjectTemplate::New(isolate);
+        for (size_t i = 0; i < numFields; i++) {
+            tpl->Set(keys[i], Undefined(isolate));
+        }
+        engine->setRecordTemplate(layout, tpl);
+    }
+
+    const jsize count = env->GetArrayLength(records);
+    Local<Array> result = Array::New(isolate, count);
+    for (jsize i = 0; i < count; i++) {
+        HandleScope recordScope(isolate);
+        jobject record = env->GetObjectArrayElement(records, i);
+        if (!record) {
+            result->Set(context, (uint32_t) i, Null(isolate));
+            continue;
+        }
+        if (!env->IsInstanceOf(record, layout->clazz)) {
+            env->DeleteLocalRef(record);
+            env->ThrowNew(env->FindClass("java/lang/IllegalArgumentException"),
+                          ("record #" + std::to_string(i) + " has a different class").c_str());
+            return MaybeLocal<Array>();
+        }
+
+        Local<Object> object;
+        if (!tpl->NewInstance(context).ToLocal(&object)) {
+            env->DeleteLocalRef(record);
+            return MaybeLocal<Array>();
+        }
+        for (size_t f = 0; f < numFields; f++) {
+            object->Set(context, keys[f], readField(env, isolate, record, layout->fields[f]));
+        }
+        env->DeleteLocalRef(record);
+        result->Set(context, (uint32_t) i, object);
+    }
+
+    return scope.Escape(result);
+}
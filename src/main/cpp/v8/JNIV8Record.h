@@ -0,0 +1,54 @@
+//
+// Conversion of java data objects to plain js objects
+//
+
+#ifndef TRADINGLIB_SAMPLE_JNIV8RECORD_H
+#define TRADINGLIB_SAMPLE_JNIV8RECORD_H
+
+#include "JNIV8Marshalling.h"
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+class BGJSV8Engine;
+
+/**
+ * Converts instances of a java class (usually annotated with @V8Record) to js objects with one property per instance
+ * field. The fields of a class are looked up once per process, and every engine keeps an ObjectTemplate with all of
+ * its properties, so the objects created for one class share a single hidden class and setting a property never
+ * transitions it. Fields are read with the cached jfieldIDs, which makes converting a whole array one native call.
+ */
+class JNIV8Record {
+public:
+    /**
+     * creates a js array with one object for every element of records; null elements stay null
+     * returns an empty handle and throws an IllegalArgumentException if an element is not an instance of recordClass
+     * has to be called with the isolate locked and the context of engine entered
+     */
+    static v8::MaybeLocal<v8::Array> createArray(BGJSV8Engine *engine, JNIEnv *env, jclass recordClass, jobjectArray records);
+
+private:
+    struct Field {
+        std::u16string name;
+        jfieldID fieldId;
+        // JNI type code of the field
+        char type;
+        // only set for object fields; strings are converted without the generic marshalling
+        bool isString;
+    };
+
+    struct Layout {
+        jclass clazz;
+        std::vector<Field> fields;
+    };
+
+    static const Layout* getLayout(JNIEnv *env, jclass recordClass);
+    static v8::Local<v8::Value> readField(JNIEnv *env, v8::Isolate *isolate, jobject record, const Field &field);
+
+    // layouts are never freed, their addresses identify the templates of the engines
+    static std::mutex _mutex;
+    static std::vector<Layout*> _layouts;
+};
+
+#endif //TRADINGLIB_SAMPLE_JNIV8RECORD_H
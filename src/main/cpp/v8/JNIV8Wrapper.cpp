@@ -7,18 +7,20 @@ using namespace v8;
 
 #include "JNIV8Wrapper.h"
 #include "JNIV8Array.h"
+#include "JNIV8ArrayBuffer.h"
 #include "JNIV8GenericObject.h"
 #include "JNIV8Function.h"
+#include "JNIV8JavaThunks.h"
 #include "v8.h"
 
 #include <string>
 #include <algorithm>
 
 std::map<std::string, JNIV8ClassInfoContainer*> JNIV8Wrapper::_objmap;
-
-//const char* JNIV8Wrapper::_v8PrivateKey = "JNIV8WrapperPrivate";
+std::vector<JNIV8ClassInfoContainer*> JNIV8Wrapper::_containers;
 
 decltype(JNIV8Wrapper::_jniObject) JNIV8Wrapper::_jniObject = {0};
+jobjectArray JNIV8Wrapper::_emptyArguments = nullptr;
 decltype(JNIV8Wrapper::_jniV8FunctionInfo) JNIV8Wrapper::_jniV8FunctionInfo = {0};
 decltype(JNIV8Wrapper::_jniV8AccessorInfo) JNIV8Wrapper::_jniV8AccessorInfo = {0};
 decltype(JNIV8Wrapper::_jniV8FunctionArgumentInfo) JNIV8Wrapper::_jniV8FunctionArgumentInfo = {0};
@@ -31,17 +33,21 @@ void JNIV8Wrapper::init() {
     pthread_mutexattr_settype(&Attr, PTHREAD_MUTEX_RECURSIVE);
     pthread_mutex_init(&_mutexEnv, &Attr);
 
-    JNIWrapper::registerObject<JNIV8Object>(JNIObjectType::kAbstract);
-    _registerObject(JNIV8ObjectType::kAbstract, JNIBase::getCanonicalName<JNIV8Object>(), "",
+    size_t typeId = JNIWrapper::registerObject<JNIV8Object>(JNIObjectType::kAbstract);
+    _registerObject(typeId, JNIV8ObjectType::kAbstract, JNIBase::getCanonicalName<JNIV8Object>(), "",
                     nullptr, createJavaClass<JNIV8Object>, sizeof(JNIV8Object));
 
     JNIV8Wrapper::registerObject<JNIV8Array>(JNIV8ObjectType::kWrapper);
+    JNIV8Wrapper::registerObject<JNIV8ArrayBuffer>(JNIV8ObjectType::kWrapper);
     JNIV8Wrapper::registerObject<JNIV8GenericObject>(JNIV8ObjectType::kWrapper);
     JNIV8Wrapper::registerObject<JNIV8Function>(JNIV8ObjectType::kWrapper);
 
     JNIEnv *env = JNIWrapper::getEnvironment();
 
     _jniObject.clazz = (jclass)env->NewGlobalRef(env->FindClass("java/lang/Object"));
+    jobjectArray emptyArguments = env->NewObjectArray(0, _jniObject.clazz, nullptr);
+    _emptyArguments = (jobjectArray)env->NewGlobalRef(emptyArguments);
+    env->DeleteLocalRef(emptyArguments);
 
     _jniV8FunctionInfo.clazz = (jclass)env->NewGlobalRef(env->FindClass("ag/boersego/v8annotations/generated/V8FunctionInfo"));
     _jniV8FunctionInfo.propertyId = env->GetFieldID(_jniV8FunctionInfo.clazz, "property", "Ljava/lang/String;");
@@ -49,6 +55,7 @@ void JNIV8Wrapper::init() {
     _jniV8FunctionInfo.isStaticId = env->GetFieldID(_jniV8FunctionInfo.clazz, "isStatic", "Z");
     _jniV8FunctionInfo.returnTypeId = env->GetFieldID(_jniV8FunctionInfo.clazz, "returnType", "Ljava/lang/String;");
     _jniV8FunctionInfo.argumentsId = env->GetFieldID(_jniV8FunctionInfo.clazz, "arguments", "[Lag/boersego/v8annotations/generated/V8FunctionInfo$V8FunctionArgumentInfo;");
+    _jniV8FunctionInfo.signatureId = env->GetFieldID(_jniV8FunctionInfo.clazz, "signature", "Ljava/lang/String;");
 
     _jniV8FunctionArgumentInfo.clazz = (jclass)env->NewGlobalRef(env->FindClass("ag/boersego/v8annotations/generated/V8FunctionInfo$V8FunctionArgumentInfo"));
     _jniV8FunctionArgumentInfo.typeId = env->GetFieldID(_jniV8FunctionArgumentInfo.clazz, "type", "Ljava/lang/String;");
@@ -94,25 +101,29 @@ void JNIV8Wrapper::v8ConstructorCallback(const v8::FunctionCallbackInfo<v8::Valu
     // check that `this` has expected type
     JNI_ASSERT(Local<FunctionTemplate>::New(isolate, info->functionTemplate)->HasInstance(args.This()), "created object has unexpected class");
 
-    // convert arguments
-    jobjectArray arguments = nullptr;
+    // convert arguments; constructors called without any share one empty array
+    jobjectArray arguments = _emptyArguments;
     jobject value;
     int numArgs = args.Length();
 
     JNIEnv *env = JNIWrapper::getEnvironment();
 
-    arguments = env->NewObjectArray(numArgs, _jniObject.clazz, nullptr);
-    for (int i = 0, n = numArgs; i < n; i++) {
-        value = JNIV8Marshalling::v8value2jobject(args[i]);
-        env->SetObjectArrayElement(arguments, i, value);
-        env->DeleteLocalRef(value);
+    if (numArgs) {
+        arguments = env->NewObjectArray(numArgs, _jniObject.clazz, nullptr);
+        for (int i = 0, n = numArgs; i < n; i++) {
+            value = JNIV8Marshalling::v8value2jobject(env, args[i]);
+            env->SetObjectArrayElement(arguments, i, value);
+            env->DeleteLocalRef(value);
+        }
     }
 
     // create temporary persistent for the js object and then call the constructor
     v8::Persistent<Object>* jsObj = new v8::Persistent<v8::Object>(isolate, args.This());
     auto ptr = info->container->creator(info, jsObj, arguments);
 
-    env->DeleteLocalRef(arguments);
+    if (numArgs) {
+        env->DeleteLocalRef(arguments);
+    }
 
     // also forward arguments to optional native constructor handler (if one was registered)
     if(info->constructorCallback) {
@@ -121,22 +132,37 @@ void JNIV8Wrapper::v8ConstructorCallback(const v8::FunctionCallbackInfo<v8::Valu
 }
 
 JNIV8ClassInfo* JNIV8Wrapper::_getV8ClassInfo(const std::string& canonicalName, BGJSV8Engine *engine) {
-    pthread_mutex_lock(&_mutexEnv);
-
     // find class info container
     auto it = _objmap.find(canonicalName);
     JNI_ASSERTF(it != _objmap.end(), "Attempt to retrieve class info for unregistered class: %s", canonicalName.c_str());
+    return _getV8ClassInfo(it->second, engine);
+}
 
-    // check if class info object already exists for this engine!
-    for(auto &it2 : it->second->classInfos) {
-        if(it2->engine == engine) {
-            pthread_mutex_unlock(&_mutexEnv);
-            return it2;
-        }
+JNIV8ClassInfo* JNIV8Wrapper::_getV8ClassInfo(JNIV8ClassInfoContainer *container, BGJSV8Engine *engine) {
+    JNI_ASSERT(container, "Attempt to retrieve class info for unregistered class");
+
+    // once created, class infos are looked up without taking the lock
+    JNIV8ClassInfoTable &classInfos = engine->getClassInfoTable();
+    JNIV8ClassInfo *v8ClassInfo = classInfos.get(container->index);
+    if(v8ClassInfo) {
+        return v8ClassInfo;
+    }
+
+    pthread_mutex_lock(&_mutexEnv);
+
+    // check again, another thread might have created it while we were waiting for the lock
+    v8ClassInfo = classInfos.get(container->index);
+    if(v8ClassInfo) {
+        pthread_mutex_unlock(&_mutexEnv);
+        return v8ClassInfo;
+    }
+    // if it was not found we have to create it now & link it with the engine
+    // it is published before it is initialized, so that the (recursive) lock holder finds it; other threads only
+    // ever call into an engine while holding its isolate's locker, which is held here as well
+    v8ClassInfo = new JNIV8ClassInfo(container, engine);
+    if(!classInfos.set(container->index, v8ClassInfo)) {
+        JNI_ASSERTF(0, "Too many registered classes to store class info for %s", container->canonicalName.c_str());
     }
-    // if it was not found we have to create it now & link it with the container
-    auto v8ClassInfo = new JNIV8ClassInfo(it->second, engine);
-    it->second->classInfos.push_back(v8ClassInfo);
 
     // initialize class info: template with constructor and general setup created here
     // individual methods and accessors handled by static method on subclass
@@ -145,7 +171,7 @@ JNIV8ClassInfo* JNIV8Wrapper::_getV8ClassInfo(const std::string& canonicalName,
 
     // v8 class name: canonical name with underscores instead of slashes
     // e.g. ag/boersego/bgjs/Test becomes ag_boersego_bgjs_Test
-    std::string strV8ClassName = canonicalName;
+    std::string strV8ClassName = container->canonicalName;
     std::replace(strV8ClassName.begin(), strV8ClassName.end(), '/', '_');
 
     Local<External> data = External::New(isolate, (void*)v8ClassInfo);
@@ -154,15 +180,8 @@ JNIV8ClassInfo* JNIV8Wrapper::_getV8ClassInfo(const std::string& canonicalName,
 
     // inherit from baseclass
     if(v8ClassInfo->container->baseClassInfo) {
-        JNIV8ClassInfo *baseInfo = nullptr;
         // base classinfo might not have been initialized yet => do so now!
-        _getV8ClassInfo(v8ClassInfo->container->baseClassInfo->canonicalName, engine);
-        for(auto &it2 : v8ClassInfo->container->baseClassInfo->classInfos) {
-            if(it2->engine == engine) {
-                baseInfo = it2;
-                break;
-            }
-        }
+        JNIV8ClassInfo *baseInfo = _getV8ClassInfo(v8ClassInfo->container->baseClassInfo, engine);
         JNI_ASSERT(baseInfo, "Failed to retrieve baseclass info");
         Local<FunctionTemplate> baseFT = Local<FunctionTemplate>::New(isolate, baseInfo->functionTemplate);
         ft->Inherit(baseFT);
@@ -173,17 +192,18 @@ JNIV8ClassInfo* JNIV8Wrapper::_getV8ClassInfo(const std::string& canonicalName,
 
     // store
     v8ClassInfo->functionTemplate.Reset(isolate, ft);
+    v8ClassInfo->instanceTemplate.Reset(isolate, tpl);
 
     // if this is a pure java class it might not have an initializer
-    if(it->second->initializer) {
-        it->second->initializer(v8ClassInfo);
+    if(container->initializer) {
+        container->initializer(v8ClassInfo);
     }
 
     // but it might have bindings on java that need to be processed
     // binding classes + methods do not need to be cached here, because they are only used once per Engine upon initialization!
     JNIEnv *env = JNIWrapper::getEnvironment();
-    jclass clsObject = it->second->clsObject;
-    jclass clsBinding = it->second->clsBinding;
+    jclass clsObject = container->clsObject;
+    jclass clsBinding = container->clsBinding;
     if(clsBinding && clsObject) {
         jfieldID createFromJavaOnlyId = env->GetStaticFieldID(clsBinding, "createFromJavaOnly", "Z");
         v8ClassInfo->createFromJavaOnly = env->GetStaticBooleanField(clsBinding, createFromJavaOnlyId);
@@ -202,6 +222,8 @@ JNIV8ClassInfo* JNIV8Wrapper::_getV8ClassInfo(const std::string& canonicalName,
             const std::string strMethodName = JNIWrapper::jstring2string((jstring)env->GetObjectField(functionInfo, _jniV8FunctionInfo.methodId));
             const std::string strReturnType = JNIWrapper::jstring2string((jstring)env->GetObjectField(functionInfo, _jniV8FunctionInfo.returnTypeId));
             jobjectArray argumentInfos = (jobjectArray)env->GetObjectField(functionInfo, _jniV8FunctionInfo.argumentsId);
+            // bindings generated by older versions of the annotation processor do not contain the signature
+            jstring jSignature = (jstring)env->GetObjectField(functionInfo, _jniV8FunctionInfo.signatureId);
             std::vector<JNIV8JavaValue>* arguments = nullptr;
 
             // return type information
@@ -230,6 +252,11 @@ JNIV8ClassInfo* JNIV8Wrapper::_getV8ClassInfo(const std::string& canonicalName,
                 }
                 strSignature += ")" + strReturnType;
             }
+            if(jSignature) {
+                JNI_ASSERTF(JNIWrapper::jstring2string(jSignature) == strSignature, "Signature of method '%s' does not match its arguments", strMethodName.c_str());
+                env->DeleteLocalRef(jSignature);
+            }
+            JNIV8JavaThunk thunk = JNIV8JavaThunks::get(strSignature, arguments);
 
             // finally register the method
             jmethodID javaMethodId;
@@ -238,13 +265,13 @@ JNIV8ClassInfo* JNIV8Wrapper::_getV8ClassInfo(const std::string& canonicalName,
                                                 strSignature.c_str());
                 v8ClassInfo->registerStaticJavaMethod(strFunctionName, javaMethodId,
                                                       returnType,
-                                                      arguments);
+                                                      arguments, thunk);
             } else {
                 javaMethodId = env->GetMethodID(clsObject, strMethodName.c_str(),
                                                 strSignature.c_str());
                 v8ClassInfo->registerJavaMethod(strFunctionName, javaMethodId,
                                                 returnType,
-                                                arguments);
+                                                arguments, thunk);
             }
         }
 
@@ -307,7 +334,7 @@ void JNIV8Wrapper::initializeNativeJNIV8Object(jobject obj, jobject engineObj, j
     v8::Persistent<Object>* persistentPtr;
     v8::Local<Object> jsObj;
 
-    JNIV8ClassInfo *classInfo = JNIV8Wrapper::_getV8ClassInfo(v8Object->getCanonicalName(), engine.get());
+    JNIV8ClassInfo *classInfo = JNIV8Wrapper::_getV8ClassInfo(_getContainer(v8Object->getTypeId()), engine.get());
 
     // if an object was already supplied we just need to extract it and store it
     if(jsObjPtr) {
@@ -325,7 +352,40 @@ void JNIV8Wrapper::initializeNativeJNIV8Object(jobject obj, jobject engineObj, j
     v8Object->setJSObject(engine.get(), classInfo, jsObj);
 }
 
-void JNIV8Wrapper::_registerObject(JNIV8ObjectType type, const std::string& canonicalName, const std::string& baseCanonicalName, JNIV8ObjectInitializer i, JNIV8ObjectCreator c, size_t size) {
+jobjectArray JNIV8Wrapper::createObjects(BGJSV8Engine *engine, const std::string& canonicalName, jint count) {
+    auto it = _objmap.find(canonicalName);
+    JNI_ASSERTF(it != _objmap.end(), "Attempt to create objects of unregistered class: %s", canonicalName.c_str());
+    JNIV8ClassInfoContainer *container = it->second;
+    JNI_ASSERTF(container->type == JNIV8ObjectType::kPersistent, "Only persistent classes can be created in bulk: %s", canonicalName.c_str());
+
+    JNIEnv *env = JNIWrapper::getEnvironment();
+    v8::Isolate* isolate = engine->getIsolate();
+    v8::Locker l(isolate);
+    Isolate::Scope isolateScope(isolate);
+    HandleScope scope(isolate);
+    Context::Scope ctxScope(engine->getContext());
+
+    JNIV8ClassInfo *classInfo = _getV8ClassInfo(container, engine);
+
+    jobjectArray result = env->NewObjectArray(count, container->clsObject, nullptr);
+    for (jint i = 0; i < count; i++) {
+        HandleScope objectScope(isolate);
+
+        // the persistent is deleted again once the java constructor initialized the native object
+        v8::Persistent<Object>* jsObj = new v8::Persistent<v8::Object>(isolate, classInfo->newInstance());
+        auto ptr = container->creator(classInfo, jsObj, _emptyArguments);
+        if (env->ExceptionCheck() || !ptr) {
+            return nullptr;
+        }
+        jobject javaObject = ptr->getJObject();
+        env->SetObjectArrayElement(result, i, javaObject);
+        env->DeleteLocalRef(javaObject);
+    }
+
+    return result;
+}
+
+void JNIV8Wrapper::_registerObject(size_t typeId, JNIV8ObjectType type, const std::string& canonicalName, const std::string& baseCanonicalName, JNIV8ObjectInitializer i, JNIV8ObjectCreator c, size_t size) {
     // canonicalName may be already registered
     // (e.g. when called from JNI_OnLoad; when using multiple linked libraries it is called once for each library)
     auto it = _objmap.find(canonicalName);
@@ -365,41 +425,55 @@ void JNIV8Wrapper::_registerObject(JNIV8ObjectType type, const std::string& cano
         }
     }
 
-    JNIV8ClassInfoContainer *info = new JNIV8ClassInfoContainer(type, canonicalName, i, c, size, baseInfo);
+    JNIV8ClassInfoContainer *info = new JNIV8ClassInfoContainer(_objmap.size(), type, canonicalName, i, c, size, baseInfo);
     _objmap[canonicalName] = info;
+    if (typeId != kJNIUnregisteredTypeId) {
+        if (typeId >= _containers.size()) {
+            _containers.resize(typeId + 1, nullptr);
+        }
+        _containers[typeId] = info;
+    }
 }
 
 // persistent classes can also be accessed as JNIV8Object directly!
 template<> JNILocalRef<JNIV8Object> JNIV8Wrapper::wrapObject<JNIV8Object>(
         v8::Local<v8::Object> object) {
-    v8::Local<v8::External> ext;
-    v8::Isolate* isolate = v8::Isolate::GetCurrent();
     // because this method takes a local, we can be sure that the correct v8 scopes are active around it already
-    // we still need a handle scope however...
-    v8::HandleScope scope(isolate);
-
-    if (object->InternalFieldCount() >= 1) {
-        // does the object have internal fields? if so use it!
-        ext = object->GetInternalField(0).As<v8::External>();
-    } else {
+    if (object->InternalFieldCount() < 1) {
         return nullptr;
     }
-    return JNILocalRef<JNIV8Object>(reinterpret_cast<JNIV8Object*>(ext->Value()));
+    // does the object have internal fields? if so use it!
+    return JNILocalRef<JNIV8Object>(JNIV8Object::fromJSObject(object));
 };
 
+/**
+ * wrapper stored in a private of object by an earlier wrap of the same object, or nullptr if there is none
+ */
+JNIV8Object* JNIV8Wrapper::_getCachedWrapper(BGJSV8Engine *engine, v8::Local<v8::Object> object) {
+    v8::Local<v8::Value> value;
+    if(!object->GetPrivate(engine->getContext(), engine->getWrapperCacheKey()).ToLocal(&value) || !value->IsExternal()) {
+        return nullptr;
+    }
+    return reinterpret_cast<JNIV8Object*>(value.As<v8::External>()->Value());
+}
+
+void JNIV8Wrapper::_setCachedWrapper(BGJSV8Engine *engine, v8::Local<v8::Object> object, JNIV8Object *wrapper) {
+    object->SetPrivate(engine->getContext(), engine->getWrapperCacheKey(), v8::External::New(engine->getIsolate(), wrapper));
+}
+
+void JNIV8Wrapper::removeCachedWrapper(BGJSV8Engine *engine, v8::Local<v8::Object> object, JNIV8Object *wrapper) {
+    if(_getCachedWrapper(engine, object) == wrapper) {
+        object->DeletePrivate(engine->getContext(), engine->getWrapperCacheKey());
+    }
+}
+
 /**
  * internal helper function called by V8Engine on destruction
  */
 void JNIV8Wrapper::cleanupV8Engine(BGJSV8Engine *engine) {
     pthread_mutex_lock(&_mutexEnv);
-    for(auto it : _objmap) {
-        for (auto it2 = it.second->classInfos.begin(); it2 != it.second->classInfos.end(); ++it2) {
-            if((*it2)->engine == engine) {
-                delete *it2;
-                it.second->classInfos.erase(it2);
-                break;
-            }
-        }
-    }
+    engine->getClassInfoTable().clear([](JNIV8ClassInfo *info) {
+        delete info;
+    });
     pthread_mutex_unlock(&_mutexEnv);
 }
\ No newline at end of file
@@ -20,7 +20,7 @@ public:
      * returns the canonical name of the v8 enabled java class associated with the specified native object
      */
     template <typename ObjectType> static
-    const std::string getCanonicalName() {
+    const std::string& getCanonicalName() {
         return JNIBase::getCanonicalName<ObjectType>();
     }
 
@@ -39,8 +39,8 @@ public:
      */
     template<class ObjectType> static
     void registerObject(JNIV8ObjectType type = JNIV8ObjectType::kPersistent) {
-        JNIWrapper::registerObject<ObjectType, JNIV8Object>(type == JNIV8ObjectType::kAbstract ? JNIObjectType::kAbstract : JNIObjectType::kPersistent);
-        _registerObject(type, JNIBase::getCanonicalName<ObjectType>(), JNIBase::getCanonicalName<JNIV8Object>(),
+        size_t typeId = JNIWrapper::registerObject<ObjectType, JNIV8Object>(type == JNIV8ObjectType::kAbstract ? JNIObjectType::kAbstract : JNIObjectType::kPersistent);
+        _registerObject(typeId, type, JNIBase::getCanonicalName<ObjectType>(), JNIBase::getCanonicalName<JNIV8Object>(),
                         type == JNIV8ObjectType::kWrapper ? nullptr : initialize<ObjectType>, createJavaClass<ObjectType>, sizeof(ObjectType));
     };
 
@@ -52,8 +52,8 @@ public:
      */
     template<class ObjectType, class BaseObjectType> static
     void registerObject(JNIV8ObjectType type = JNIV8ObjectType::kPersistent) {
-        JNIWrapper::registerObject<ObjectType, BaseObjectType>(type == JNIV8ObjectType::kAbstract ? JNIObjectType::kAbstract : JNIObjectType::kPersistent);
-        _registerObject(type, JNIBase::getCanonicalName<ObjectType>(), JNIBase::getCanonicalName<BaseObjectType>(),
+        size_t typeId = JNIWrapper::registerObject<ObjectType, BaseObjectType>(type == JNIV8ObjectType::kAbstract ? JNIObjectType::kAbstract : JNIObjectType::kPersistent);
+        _registerObject(typeId, type, JNIBase::getCanonicalName<ObjectType>(), JNIBase::getCanonicalName<BaseObjectType>(),
                         type == JNIV8ObjectType::kWrapper ? nullptr : initialize<ObjectType>, createJavaClass<ObjectType>, sizeof(ObjectType));
     };
 
@@ -64,8 +64,8 @@ public:
      */
     template<class ObjectType> static
     void registerJavaObject(const std::string &canonicalName, JNIV8ObjectType type = JNIV8ObjectType::kPersistent) {
-        JNIWrapper::registerJavaObject<ObjectType>(canonicalName, type == JNIV8ObjectType::kAbstract ? JNIObjectType::kAbstract : JNIObjectType::kPersistent);
-        _registerObject(type, canonicalName, JNIBase::getCanonicalName<ObjectType>(), nullptr, nullptr, 0);
+        size_t typeId = JNIWrapper::registerJavaObject<ObjectType>(canonicalName, type == JNIV8ObjectType::kAbstract ? JNIObjectType::kAbstract : JNIObjectType::kPersistent);
+        _registerObject(typeId, type, canonicalName, JNIBase::getCanonicalName<ObjectType>(), nullptr, nullptr, 0);
     };
     /**
      * this overload is primarily used for registering java classes directly from java where the template version above can not be used
@@ -74,8 +74,8 @@ public:
      */
     static
     void registerJavaObject(const std::string &canonicalName, const std::string &baseCanonicalName, JNIV8ObjectType type = JNIV8ObjectType::kPersistent) {
-        JNIWrapper::registerJavaObject(canonicalName, baseCanonicalName, type == JNIV8ObjectType::kAbstract ? JNIObjectType::kAbstract : JNIObjectType::kPersistent);
-        _registerObject(type, canonicalName, baseCanonicalName, nullptr, nullptr, 0);
+        size_t typeId = JNIWrapper::registerJavaObject(canonicalName, baseCanonicalName, type == JNIV8ObjectType::kAbstract ? JNIObjectType::kAbstract : JNIObjectType::kPersistent);
+        _registerObject(typeId, type, canonicalName, baseCanonicalName, nullptr, nullptr, 0);
     };
 
     /**
@@ -113,61 +113,50 @@ public:
      */
     template <typename ObjectType> static
     JNILocalRef<ObjectType> wrapObject(v8::Local<v8::Object> object) {
-        auto it = _objmap.find(JNIBase::getCanonicalName<ObjectType>());
-        if (it == _objmap.end()) {
+        JNIV8ClassInfoContainer *info = _getContainer(JNITypeId<ObjectType>::value);
+        if (!info) {
             return nullptr;
         }
 
         JNIV8Object* ptr;
-        v8::Local<v8::External> ext;
 
         v8::Isolate* isolate = v8::Isolate::GetCurrent();
         // because this method takes a local, we can be sure that the correct v8 scopes are active
         // we still need a handle scope however...
         v8::HandleScope scope(isolate);
 
-        JNIV8ClassInfoContainer *info = it->second;
-
         if(info->type == JNIV8ObjectType::kWrapper) {
             // make sure the object is actually supported by the specified type
             if(!ObjectType::isWrappableV8Object(object)) {
                 return nullptr;
             }
-            /*
-            // does the object have a native object stored in a private key?
-            auto privateKey = v8::Private::ForApi(isolate, v8::String::NewFromUtf8(isolate, _v8PrivateKey));
-            auto privateValue = object->GetPrivate(isolate->GetCurrentContext(), privateKey);
-            if (!privateValue.IsEmpty()) {
-                ext = privateValue.ToLocalChecked().As<v8::External>();
-            } else {
-                // the private key was empty so we have to create a new object
-                v8::Persistent<v8::Object>* persistent = new v8::Persistent<v8::Object>(isolate, object);
-                auto sharedPtr = info->creator(_getV8ClassInfo(JNIBase::getCanonicalName<ObjectType>(), BGJSV8Engine::GetInstance(isolate)), persistent);
-
-                // store in private
-                object->SetPrivate(isolate->GetCurrentContext(), privateKey, v8::External::New(isolate, sharedPtr.get()));
-
-                return std::static_pointer_cast<ObjectType>(sharedPtr);
+            BGJSV8Engine *engine = BGJSV8Engine::GetInstance(isolate);
+
+            // reuse the wrapper created for this object before, as long as its java object has not been collected yet
+            ptr = _getCachedWrapper(engine, object);
+            if(ptr && JNIWrapper::isObjectInstanceOf<ObjectType>(ptr)) {
+                JNIEnv *env = JNIWrapper::getEnvironment();
+                jobject javaObject = ptr->getJObject();
+                if(javaObject) {
+                    JNIRetainedRef<ObjectType> retainedRef(reinterpret_cast<ObjectType*>(ptr));
+                    env->DeleteLocalRef(javaObject);
+                    return JNILocalRef<ObjectType>::New(retainedRef);
+                }
             }
-             */
-            // a new wrapper object is created every time!
+
             v8::Persistent<v8::Object>* persistent = new v8::Persistent<v8::Object>(isolate, object);
-            JNIEnv *env = JNIWrapper::getEnvironment();
-            jobjectArray arguments = env->NewObjectArray(0, _jniObject.clazz, nullptr);
             // __android_log_print(ANDROID_LOG_WARN, "JNIV8Wrapper", "Creating %s", JNIBase::getCanonicalName<ObjectType>().c_str());
-            auto retainedRef = JNIRetainedRef<ObjectType>::Cast(info->creator(_getV8ClassInfo(JNIBase::getCanonicalName<ObjectType>(), BGJSV8Engine::GetInstance(isolate)), persistent, arguments));
-            env->DeleteLocalRef(arguments);
+            auto retainedRef = JNIRetainedRef<ObjectType>::Cast(info->creator(_getV8ClassInfo(info, engine), persistent, _emptyArguments));
+            _setCachedWrapper(engine, object, retainedRef.get());
             return JNILocalRef<ObjectType>::New(retainedRef);
         } else {
-            if (object->InternalFieldCount() >= 1) {
-                // does the object have internal fields? if so use it!
-                ext = object->GetInternalField(0).As<v8::External>();
-            } else {
+            if (object->InternalFieldCount() < 1) {
                 return nullptr;
             }
+            // does the object have internal fields? if so use it!
+            ptr = JNIV8Object::fromJSObject(object);
         }
 
-        ptr = reinterpret_cast<JNIV8Object*>(ext->Value());
         if(!JNIWrapper::isObjectInstanceOf<ObjectType>(ptr)) {
             return nullptr;
         }
@@ -179,7 +168,7 @@ public:
      */
     template <typename ObjectType> static
     v8::Local<v8::Function> getJSConstructor(BGJSV8Engine *engine) {
-        return _getV8ClassInfo(JNIBase::getCanonicalName<ObjectType>(), engine)->getConstructor();
+        return _getV8ClassInfo(_getContainer(JNITypeId<ObjectType>::value), engine)->getConstructor();
     }
     static v8::Local<v8::Function> getJSConstructor(BGJSV8Engine *engine, const std::string &canonicalName) {
         return _getV8ClassInfo(canonicalName, engine)->getConstructor();
@@ -192,6 +181,20 @@ public:
      */
     static void initializeNativeJNIV8Object(jobject obj, jobject engineObj, jlong jsObjPtr);
 
+    /**
+     * creates count java+native+js object tuples of a persistent class at once
+     * the class info is resolved and the engine is locked only once; every js object is created from the cached
+     * instance template, and the java objects are created without an array of constructor arguments
+     * returns an array of the java class, or nullptr if a java constructor threw
+     */
+    static jobjectArray createObjects(BGJSV8Engine *engine, const std::string& canonicalName, jint count);
+
+    /**
+     * internal utility method called when a wrapper object is destroyed
+     * removes the wrapper from the identity cache of the js object, unless it was replaced by a newer wrapper already
+     */
+    static void removeCachedWrapper(BGJSV8Engine *engine, v8::Local<v8::Object> object, JNIV8Object *wrapper);
+
     /**
      * internal constructor callback for objects created from javascript
      */
@@ -201,13 +204,29 @@ public:
      * internal helper function called by V8Engine on destruction
      */
     static void cleanupV8Engine(BGJSV8Engine *engine);
-private:
-    //static const char* _v8PrivateKey;
 
-    static void _registerObject(JNIV8ObjectType type, const std::string& canonicalName, const std::string& baseCanonicalName, JNIV8ObjectInitializer i, JNIV8ObjectCreator c, size_t size);
+    /**
+     * number of registered classes; new engines reserve this many slots for their class infos
+     */
+    static size_t getClassCount() {
+        return _objmap.size();
+    }
+private:
+    static void _registerObject(size_t typeId, JNIV8ObjectType type, const std::string& canonicalName, const std::string& baseCanonicalName, JNIV8ObjectInitializer i, JNIV8ObjectCreator c, size_t size);
     static JNIV8ClassInfo* _getV8ClassInfo(const std::string& canonicalName, BGJSV8Engine *engine);
+    static JNIV8ClassInfo* _getV8ClassInfo(JNIV8ClassInfoContainer *container, BGJSV8Engine *engine);
+
+    static JNIV8ClassInfoContainer* _getContainer(size_t typeId) {
+        return typeId < _containers.size() ? _containers[typeId] : nullptr;
+    }
+
+    // identity cache for wrapper objects; the native pointer is stored in a private property of the js object
+    static JNIV8Object* _getCachedWrapper(BGJSV8Engine *engine, v8::Local<v8::Object> object);
+    static void _setCachedWrapper(BGJSV8Engine *engine, v8::Local<v8::Object> object, JNIV8Object *wrapper);
 
     static std::map<std::string, JNIV8ClassInfoContainer*> _objmap;
+    // indexed by the type ids of JNIWrapper; null for classes that are not v8 enabled
+    static std::vector<JNIV8ClassInfoContainer*> _containers;
 
     static pthread_mutex_t _mutexEnv;
 
@@ -228,6 +247,8 @@ private:
     static struct {
         jclass clazz;
     } _jniObject;
+    // wrappers are always created without arguments; shared instead of allocated on every call
+    static jobjectArray _emptyArguments;
     static struct {
         jclass clazz;
         jfieldID propertyId;
@@ -235,6 +256,7 @@ private:
         jfieldID isStaticId;
         jfieldID returnTypeId;
         jfieldID argumentsId;
+        jfieldID signatureId;
     } _jniV8FunctionInfo;
     static struct {
         jclass clazz;
@@ -4,9 +4,11 @@ import ag.boersego.v8annotations.V8Class
 import ag.boersego.v8annotations.V8ClassCreationPolicy
 import ag.boersego.v8annotations.V8Function
 import ag.boersego.v8annotations.V8Getter
+import android.graphics.Bitmap
+import android.hardware.HardwareBuffer
+import android.support.annotation.RequiresApi
 import android.util.Log
-import java.util.*
-import java.util.concurrent.atomic.AtomicInteger
+import dalvik.annotation.optimization.FastNative
 import kotlin.collections.ArrayList
 
 /**
@@ -21,11 +23,6 @@ open class BGJSGLView(engine: V8Engine, private var textureView: V8TextureView?)
     private val callbacksRedraw = ArrayList<JNIV8Function>(2)
     private val callbacksEvent = ArrayList<JNIV8Function>(3)
 
-    class AnimationFrameRequest (val cb: JNIV8Function, val id: Int)
-
-    private val queuedAnimationRequests = Stack<AnimationFrameRequest>()
-    private val nextAnimationRequestId = AtomicInteger(0)
-
     val devicePixelRatio: Float
         @V8Getter get() = textureView?.resources?.displayMetrics?.density ?: 1f
 
@@ -39,12 +36,64 @@ open class BGJSGLView(engine: V8Engine, private var textureView: V8TextureView?)
 
     private external fun endRedraw()
 
+    /**
+     * Called for every touch event, with the position in logical pixels; tests it against the hit regions of the 2d
+     * context. Native subclasses overriding onSetTouchPosition must neither block nor lock the isolate, since this is a
+     * fast native
+     */
+    @FastNative
     external fun setTouchPosition(x: Int, y: Int)
 
+    /**
+     * Id of the hit region that contained the position of the latest setTouchPosition, null if none did
+     */
+    @FastNative
+    external fun getTouchRegion(): String?
+
+    /**
+     * Tells the native view that its gl context shares objects with the contexts of other views; has to be called before
+     * setViewData
+     */
+    @FastNative
+    external fun setSharesContext(sharesContext: Boolean)
+
     external fun setViewData(devicePixelRatio: Float, dontClearOnFlip: Boolean, x: Int, y: Int)
 
     private external fun viewWasResized(x: Int, y: Int)
 
+    private external fun runFrameCallbacks(frameTimeNanos: Long, frameBudgetNanos: Long): Boolean
+
+    private external fun clearFrameCallbacks()
+
+    /**
+     * Tells the native view that the back buffer was cleared, so the next frame can not be redrawn partially
+     */
+    @FastNative
+    external fun backBufferCleared()
+
+    /**
+     * Counts draw calls, vertices, texture binds, stencil passes and flushes of every frame, and measures its gpu time
+     * where GL_EXT_disjoint_timer_query is available. Off by default; takes effect with the next frame
+     */
+    @FastNative
+    external fun setFrameStatsEnabled(enabled: Boolean)
+
+    /**
+     * Fills stats with draw calls, vertices, texture binds, stencil passes, flushes and gpu time in ns of the last
+     * frame; the gpu time is that of the latest frame measured, or -1. An array of eight also gets the frames that were
+     * still on the gpu when the last one was swapped, and the present latency in ns of the latest frame the gpu
+     * finished, or -1. Returns false while frame stats are off
+     */
+    @FastNative
+    external fun getFrameStats(stats: LongArray): Boolean
+
+    /**
+     * Frames the gpu may still draw while the next one is recorded, 1 to 3; 1 by default, which keeps the latency from
+     * the frame callbacks to the screen lowest. Needs EGL_KHR_fence_sync, without it the driver decides alone
+     */
+    @FastNative
+    external fun setMaxFramesInFlight(frames: Int)
+
     @V8Function
     fun on(event: String, cb: JNIV8Function) {
         val list = when (event) {
@@ -59,22 +108,12 @@ open class BGJSGLView(engine: V8Engine, private var textureView: V8TextureView?)
         }
     }
 
+    /**
+     * Called from native code when the first animation frame callback for the next frame was requested
+     */
     @Suppress("unused")
-    fun requestAnimationFrame(cb: JNIV8Function): Int {
-            val id = nextAnimationRequestId.incrementAndGet()
-            queuedAnimationRequests.add(AnimationFrameRequest(cb, id))
-            textureView?.requestRender()
-            return id
-    }
-
-    @Suppress("unused")
-    fun cancelAnimationFrame(id: Int) {
-        for (animationRequest in queuedAnimationRequests) {
-            if (animationRequest.id == id) {
-                queuedAnimationRequests.remove(animationRequest)
-                return
-            }
-        }
+    fun requestRender() {
+        textureView?.requestRender()
     }
 
     private fun executeCallbacks(callbacks: ArrayList<JNIV8Function>, vararg args: Any) {
@@ -107,7 +146,7 @@ open class BGJSGLView(engine: V8Engine, private var textureView: V8TextureView?)
             if (DEBUG) {
                 Log.d(TAG, "onClose")
             }
-            queuedAnimationRequests.clear()
+            clearFrameCallbacks()
             callbacksResize.clear()
             callbacksEvent.clear()
             executeCallbacks(callbacksClose)
@@ -116,25 +155,12 @@ open class BGJSGLView(engine: V8Engine, private var textureView: V8TextureView?)
         textureView = null
     }
 
-    fun onRedraw():Boolean {
-        if (queuedAnimationRequests.isEmpty()) {
-            return false
-        }
-
-        // Clone and empty both lists of callbacks in a v8::Locker so JS cannot add event listeners
-        // while we execute them
-        v8Engine.runLocked {
-            val callbacksForRedraw = ArrayList<JNIV8Function>(queuedAnimationRequests.size)
-            queuedAnimationRequests.forEach { callbacksForRedraw.add(it.cb) }
-            queuedAnimationRequests.clear()
-
-                prepareRedraw()
-                for (cb in callbacksForRedraw) {
-                    cb.callAsV8Function()
-                }
-                endRedraw()
-        }
-        return true
+    /**
+     * Runs the animation frame callbacks for the vsync at frameTimeNanos, in System.nanoTime
+     */
+    fun onRedraw(frameTimeNanos: Long, frameBudgetNanos: Long):Boolean {
+        // All animation frame callbacks are kept and run in native code, including prepareRedraw and endRedraw
+        return runFrameCallbacks(frameTimeNanos, frameBudgetNanos)
     }
 
     fun onResize() {
@@ -151,7 +177,58 @@ open class BGJSGLView(engine: V8Engine, private var textureView: V8TextureView?)
         val DEBUG = false && BuildConfig.DEBUG
         val TAG = BGJSGLView::class.java.simpleName!!
 
+
         @JvmStatic
         external fun Create(engine: V8Engine): BGJSGLView
+
+        /**
+         * Makes bitmap the image of path, so canvases draw it when a script sets the src of an Image to path instead
+         * of decoding the file again. Hardware bitmaps are sampled by textures where they are; the pixels of all
+         * others are copied once, so bitmap may be recycled afterwards
+         */
+        @JvmStatic
+        fun registerImage(path: String, bitmap: Bitmap) {
+            if (registerBitmap(path, bitmap)) {
+                return
+            }
+            val copy = bitmap.copy(Bitmap.Config.ARGB_8888, false)
+                ?: throw IllegalArgumentException("bitmap of $path can not be converted to ARGB_8888")
+            if (!registerBitmap(path, copy)) {
+                throw IllegalArgumentException("bitmap of $path can not be read")
+            }
+            copy.recycle()
+        }
+
+        @JvmStatic
+        private external fun registerBitmap(path: String, bitmap: Bitmap): Boolean
+
+        /**
+         * Makes the RGBA_8888 pixels of buffer the image of path without copying them; the buffer is retained until
+         * the image is unregistered and no canvas uses it anymore. Returns false for other formats
+         */
+        @RequiresApi(26)
+        @JvmStatic
+        external fun registerHardwareBuffer(path: String, buffer: HardwareBuffer, premultiplied: Boolean): Boolean
+
+        /**
+         * Makes the GL_TEXTURE_EXTERNAL_OES texture textureId of a SurfaceTexture the image of path, so canvases draw
+         * its latest frame; must be called on the gl thread of the view that made the texture, whose canvases are the
+         * only ones that can draw it. See V8SurfaceTextureSource
+         */
+        @JvmStatic
+        external fun registerSurfaceTexture(path: String, textureId: Int, width: Int, height: Int): Boolean
+
+        /**
+         * Passes the transform of the frame the SurfaceTexture of path latched last, from getTransformMatrix
+         */
+        @JvmStatic
+        external fun updateSurfaceTexture(path: String, transform: FloatArray)
+
+        /**
+         * Removes the image of path registered with registerImage, registerHardwareBuffer or registerSurfaceTexture;
+         * images that scripts already loaded keep it, those of SurfaceTextures draw nothing anymore
+         */
+        @JvmStatic
+        external fun unregisterImage(path: String)
     }
 }
\ No newline at end of file
@@ -11,10 +11,9 @@ import android.content.res.AssetManager;
 
 public class ClientAndroid {
     // BGJSV8Engine
-    public static native void timeoutCB(V8Engine engine, long jsCb, long thisObj, boolean cleanup, boolean runCallback);
-
     public static native void initialize(AssetManager am, V8Engine engine, String locale, String lang, String timezone,
-                                         float density, final String deviceClass, final boolean debug, final boolean isStoreBuild, final int maxHeapSizeInMb);
+                                         float density, final String deviceClass, final boolean debug, final boolean isStoreBuild, final int maxHeapSizeInMb,
+                                         final String codeCachePath, final String snapshotPath);
 
     // BGJSGLModule
     public static native int cssColorToInt(String color);
@@ -0,0 +1,96 @@
+package ag.boersego.bgjs;
+
+import android.graphics.Bitmap;
+import android.graphics.Canvas;
+import android.graphics.Paint;
+import android.graphics.Rect;
+import android.graphics.Typeface;
+import android.support.annotation.Keep;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Renders glyphs of canvas text; called from native code when a glyph is drawn for the first time
+ *
+ * Fonts are described by css font strings, e.g. "italic bold 12px Arial, sans-serif". Style and family are taken
+ * from the string, the size is passed separately. Families that are not installed fall back to the default font.
+ */
+@Keep
+final class GlyphRasterizer {
+    // transparent border around every glyph, so it can be sampled with bilinear filtering
+    private static final int PADDING = 1;
+
+    private GlyphRasterizer() {}
+
+    /**
+     * returns a paint for drawing the font at the specified size in pixels
+     * metrics receives ascender, descender (negative) and line height
+     */
+    @Keep
+    static Paint createPaint(final String font, final float size, final float[] metrics) {
+        int style = Typeface.NORMAL;
+        String family = null;
+        for (String token : font.split("\\s+")) {
+            if (family != null) {
+                family += " " + token;
+            } else if (token.equals("bold") || token.equals("bolder") || token.matches("[6-9]00")) {
+                style |= Typeface.BOLD;
+            } else if (token.equals("italic") || token.equals("oblique")) {
+                style |= Typeface.ITALIC;
+            } else if (token.isEmpty() || token.equals("normal") || token.equals("lighter") || token.matches("[1-5]00") || Character.isDigit(token.charAt(0))) {
+                // sizes and weights without a typeface of their own
+            } else {
+                family = token;
+            }
+        }
+        if (family != null) {
+            family = family.split(",")[0].replace("\"", "").replace("'", "").trim();
+        }
+
+        final Paint paint = new Paint(Paint.ANTI_ALIAS_FLAG);
+        paint.setTypeface(Typeface.create(family, style));
+        paint.setTextSize(size);
+
+        final Paint.FontMetrics fontMetrics = paint.getFontMetrics();
+        metrics[0] = -fontMetrics.ascent;
+        metrics[1] = -fontMetrics.descent;
+        metrics[2] = fontMetrics.descent - fontMetrics.ascent + fontMetrics.leading;
+        return paint;
+    }
+
+    /**
+     * renders a glyph as 8 bit alpha values into pixels and returns its advance
+     * bounds receives width, height, bytes per row, and the offset of the bitmap from the pen (left, and top measured upwards)
+     * glyphs without pixels, or that do not fit into the buffer, are returned with a width of 0
+     */
+    @Keep
+    static float rasterize(final Paint paint, final int codepoint, final ByteBuffer pixels, final int[] bounds) {
+        final String text = new String(Character.toChars(codepoint));
+        final float advance = paint.measureText(text);
+
+        final Rect rect = new Rect();
+        paint.getTextBounds(text, 0, text.length(), rect);
+        bounds[0] = bounds[1] = bounds[2] = 0;
+        bounds[3] = rect.left - PADDING;
+        bounds[4] = -rect.top + PADDING;
+        if (rect.isEmpty()) {
+            return advance;
+        }
+
+        final int width = rect.width() + 2 * PADDING;
+        final int height = rect.height() + 2 * PADDING;
+        final Bitmap bitmap = Bitmap.createBitmap(width, height, Bitmap.Config.ALPHA_8);
+        if (bitmap.getRowBytes() * height <= pixels.capacity()) {
+            final Canvas canvas = new Canvas(bitmap);
+            canvas.drawText(text, PADDING - rect.left, PADDING - rect.top, paint);
+            pixels.rewind();
+            bitmap.copyPixelsToBuffer(pixels);
+
+            bounds[0] = width;
+            bounds[1] = height;
+            bounds[2] = bitmap.getRowBytes();
+        }
+        bitmap.recycle();
+        return advance;
+    }
+}
@@ -0,0 +1,17 @@
+package ag.boersego.bgjs;
+
+/**
+ * Receives what a V8TextureView sent to gl in every frame, on its render thread
+ */
+public interface IV8GLViewOnFrameStats {
+    /**
+     * @param gpuTimeNanos gpu time of the latest frame that was measured, a few frames before this one; -1 where
+     *                     GL_EXT_disjoint_timer_query is missing
+     * @param queueDepth frames that were still on the gpu when this one was swapped; 0 where EGL_KHR_fence_sync is
+     *                   missing
+     * @param presentLatencyNanos time from the swap of the latest frame the gpu finished until that was noticed, at
+     *                            most a frame later than it happened; -1 until one finished
+     */
+    public void frameStats(V8TextureView instance, int drawCalls, int vertices, int textureBinds, int stencilPasses,
+                           int flushes, long gpuTimeNanos, int queueDepth, long presentLatencyNanos);
+}
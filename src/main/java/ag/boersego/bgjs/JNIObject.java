@@ -39,6 +39,23 @@ abstract public class JNIObject {
     }
     static private native void RegisterClass(String derivedClass, String baseClass);
 
+    /**
+     * Deletes the strong references native code kept to java objects it no longer retains, once they were not
+     * retained again for a grace period. Called by the finalizing daemon only.
+     *
+     * @return the time in ms until it should be called again
+     */
+    static native long ReleasePendingGlobalRefs();
+
+    /**
+     * Fills stats with the global references held by native objects: strong references, weak references, objects
+     * waiting for their strong reference to be deleted, and the strong references created, deleted and reused
+     * (retained again within the grace period) so far
+     *
+     * @param stats array of up to six values
+     */
+    static public native void GetGlobalRefStats(long[] stats);
+
     /**
      * default constructor; will always initialize the jni side of the object automatically
      */
@@ -4,12 +4,19 @@ import android.util.Log;
 
 import java.lang.ref.Reference;
 import java.lang.ref.ReferenceQueue;
+import java.util.Arrays;
 
 /**
  * Running in the FinalizingDaemon thread (managed by JNIObject) to free native objects.
+ * It also releases the global references native objects kept after they were released from native code.
  */
 final class JNIObjectFinalizerRunnable implements Runnable {
+    // thousands of objects are often collected at once, e.g. after a screen was closed; they are freed in batches
+    private static final int BATCH_SIZE = 256;
+
     private ReferenceQueue<JNIObject> referenceQueue;
+    private final JNIObjectReference[] batch = new JNIObjectReference[BATCH_SIZE];
+    private final long[] nativeHandles = new long[BATCH_SIZE];
 
     JNIObjectFinalizerRunnable(ReferenceQueue<JNIObject> referenceQueue) {
         this.referenceQueue = referenceQueue;
@@ -19,9 +26,21 @@ final class JNIObjectFinalizerRunnable implements Runnable {
     public void run() {
         while (true) {
             try {
-                JNIObjectReference reference = (JNIObjectReference) referenceQueue.remove();
-                if(!reference.cleanup()) {
-                    Log.e("JNIObject", "GCd JNIObject failed to free native resources");
+                long timeout = JNIObject.ReleasePendingGlobalRefs();
+                JNIObjectReference reference = (JNIObjectReference) referenceQueue.remove(timeout);
+                if (reference == null) {
+                    continue;
+                }
+
+                int count = 0;
+                do {
+                    batch[count++] = reference;
+                } while (count < BATCH_SIZE && (reference = (JNIObjectReference) referenceQueue.poll()) != null);
+
+                final int failed = JNIObjectReference.cleanup(batch, nativeHandles, count);
+                Arrays.fill(batch, 0, count, null);
+                if (failed > 0) {
+                    Log.e("JNIObject", failed + " GCd JNIObjects failed to free native resources");
                 }
             } catch (InterruptedException e) {
                 // Restores the interrupted status.
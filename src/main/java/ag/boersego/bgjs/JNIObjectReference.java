@@ -49,6 +49,14 @@ final class JNIObjectReference extends PhantomReference<JNIObject> {
             }
             length--;
         }
+
+        synchronized void removeAll(JNIObjectReference[] refs, int count) {
+            for (int i = 0; i < count; i++) {
+                if (refs[i] != null) {
+                    remove(refs[i]);
+                }
+            }
+        }
     }
 
     public JNIObjectReference next, prev;
@@ -58,6 +66,11 @@ final class JNIObjectReference extends PhantomReference<JNIObject> {
 
     protected static native boolean disposeNative(long nativeHandle);
 
+    /**
+     * Frees the native objects of a batch of references; handles of objects that were freed are set to 0
+     */
+    private static native void disposeNatives(long[] nativeHandles, int count);
+
     public JNIObjectReference(JNIObject obj, long nativeHandle, ReferenceQueue<JNIObject> referenceQueue) {
         super(obj, referenceQueue);
         this.nativeHandle = nativeHandle;
@@ -75,4 +88,34 @@ final class JNIObjectReference extends PhantomReference<JNIObject> {
         }
         return true;
     }
+
+    /**
+     * Frees the native objects of count GCd references with a single JNI call
+     *
+     * @param references the references; entries whose native object could not be freed are set to null
+     * @param nativeHandles storage for at least count handles
+     * @return the number of native objects that could not be freed
+     */
+    static int cleanup(JNIObjectReference[] references, long[] nativeHandles, int count) {
+        for (int i = 0; i < count; i++) {
+            nativeHandles[i] = references[i].nativeHandle;
+        }
+        disposeNatives(nativeHandles, count);
+
+        int failed = 0;
+        for (int i = 0; i < count; i++) {
+            if (nativeHandles[i] != 0) {
+                references[i] = null;
+                failed++;
+            } else {
+                references[i].clear();
+            }
+        }
+        referencePool.removeAll(references, count);
+
+        if(referencePool.length == 0) {
+            Log.d("JNIObject", "reference pool was completely drained!");
+        }
+        return failed;
+    }
 };
@@ -5,6 +5,7 @@ import android.support.annotation.NonNull;
 import android.support.annotation.Nullable;
 
 import java.util.Arrays;
+import java.util.List;
 import java.util.NoSuchElementException;
 
 import ag.boersego.v8annotations.V8Flags;
@@ -17,6 +18,24 @@ final public class JNIV8Array extends JNIV8Object implements Iterable<Object> {
     public static native JNIV8Array Create(V8Engine engine);
     public static native JNIV8Array CreateWithLength(V8Engine engine, int length);
     public static native JNIV8Array CreateWithArray(V8Engine engine, Object[] elements);
+    public static native JNIV8Array CreateWithDoubles(V8Engine engine, double[] elements);
+    public static native JNIV8Array CreateWithInts(V8Engine engine, int[] elements);
+
+    /**
+     * Creates an array of plain objects with one property for every instance field of recordClass, which should be
+     * annotated with {@link ag.boersego.v8annotations.V8Record}.
+     * All records are converted in one native call; the objects share one shape, so code iterating over them stays
+     * monomorphic. Null elements become null.
+     *
+     * @throws IllegalArgumentException if an element is not an instance of recordClass
+     */
+    public static native JNIV8Array CreateWithRecords(V8Engine engine, @NonNull Class<?> recordClass,
+                                                      @NonNull Object[] records);
+
+    public static JNIV8Array CreateWithRecords(V8Engine engine, @NonNull Class<?> recordClass,
+                                               @NonNull List<?> records) {
+        return CreateWithRecords(engine, recordClass, records.toArray());
+    }
     public static JNIV8Array CreateWithElements(V8Engine engine, Object... elements) {
         return CreateWithArray(engine, elements);
     }
@@ -62,6 +81,37 @@ final public class JNIV8Array extends JNIV8Object implements Iterable<Object> {
         return (T[]) _getV8Elements(V8Flags.Default, returnType.hashCode(), returnType, from, to);
     }
 
+    /**
+     * Returns all elements converted to unboxed primitives
+     * the conversion happens natively and the result is copied in one go, so no boxed values are created
+     */
+    public @NonNull double[] getV8ElementsAsDoubles() {
+        return _getV8Doubles(V8Flags.Default, 0, Integer.MAX_VALUE);
+    }
+
+    public @NonNull double[] getV8ElementsAsDoubles(int flags) {
+        return _getV8Doubles(flags, 0, Integer.MAX_VALUE);
+    }
+
+    public @NonNull int[] getV8ElementsAsInts() {
+        return _getV8Ints(V8Flags.Default, 0, Integer.MAX_VALUE);
+    }
+
+    public @NonNull int[] getV8ElementsAsInts(int flags) {
+        return _getV8Ints(flags, 0, Integer.MAX_VALUE);
+    }
+
+    /**
+     * Returns all elements from a specified range inside of the array converted to unboxed primitives
+     */
+    public @NonNull double[] getV8ElementsAsDoubles(int from, int to) {
+        return _getV8Doubles(V8Flags.Default, from, to);
+    }
+
+    public @NonNull int[] getV8ElementsAsInts(int from, int to) {
+        return _getV8Ints(V8Flags.Default, from, to);
+    }
+
     /**
      * Returns the object at the specified index
      * if index is out of bounds, returns JNIV8Undefined
@@ -79,6 +129,29 @@ final public class JNIV8Array extends JNIV8Object implements Iterable<Object> {
         return (T) _getV8Element(V8Flags.Default, returnType.hashCode(), returnType, index);
     }
 
+    /**
+     * Receives the elements of an array passed to forEach
+     */
+    public interface ElementCallback {
+        void onElement(int index, @Nullable Object element);
+    }
+
+    /**
+     * Passes all elements of the array to the callback in order
+     * unlike iterating with getV8Element, the array is only looked up once for all elements
+     */
+    public void forEach(@NonNull ElementCallback callback) {
+        _forEach(0, 0, Object.class, callback);
+    }
+
+    public void forEachTyped(int flags, @NonNull Class<?> returnType, @NonNull ElementCallback callback) {
+        _forEach(flags, returnType.hashCode(), returnType, callback);
+    }
+
+    public void forEachTyped(@NonNull Class<?> returnType, @NonNull ElementCallback callback) {
+        _forEach(V8Flags.Default, returnType.hashCode(), returnType, callback);
+    }
+
     /**
      * releases the JS array
      * when working with a lot of objects, calling this manually might improve memory usage
@@ -94,6 +167,9 @@ final public class JNIV8Array extends JNIV8Object implements Iterable<Object> {
     // internal fields & methods
     private native Object _getV8Element(int flags, int type, Class returnType, int index);
     private native Object[] _getV8Elements(int flags, int type, Class returnType, int from, int to);
+    private native double[] _getV8Doubles(int flags, int from, int to);
+    private native int[] _getV8Ints(int flags, int from, int to);
+    private native void _forEach(int flags, int type, Class returnType, ElementCallback callback);
 
     @Keep
     protected JNIV8Array(V8Engine engine, long jsObjPtr, Object[] arguments) {
@@ -106,21 +182,35 @@ final public class JNIV8Array extends JNIV8Object implements Iterable<Object> {
         return new Iterator();
     }
 
+    /**
+     * Iterates over the array in batches of elements, so a loop does not need two native calls per element
+     * changes to the array show up once the next batch is fetched
+     */
     public class Iterator implements java.util.Iterator<Object> {
+        private static final int BATCH_SIZE = 64;
 
         private int index = 0;
+        private int batchStart = 0;
+        private Object[] batch = null;
 
         @Override
         public boolean hasNext() {
+            if (batch != null && index < batchStart + batch.length) {
+                return true;
+            }
             return index < getV8Length();
         }
 
         @Override
         public Object next() {
-            if (index >= getV8Length()) {
-                throw new NoSuchElementException();
+            if (batch == null || index >= batchStart + batch.length) {
+                batchStart = index;
+                batch = getV8Elements(index, index + BATCH_SIZE - 1);
+                if (batch.length == 0) {
+                    throw new NoSuchElementException();
+                }
             }
-            return getV8Element(index++);
+            return batch[index++ - batchStart];
         }
     }
 
@@ -0,0 +1,105 @@
+package ag.boersego.bgjs;
+
+import android.support.annotation.Keep;
+import android.support.annotation.NonNull;
+import android.util.Log;
+
+import java.lang.ref.PhantomReference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.WeakReference;
+import java.nio.ByteBuffer;
+import java.util.HashSet;
+
+/**
+ * Wrapper for JavaScript ArrayBuffers
+ *
+ * Buffers created from a direct ByteBuffer share its memory with JavaScript; no data is copied.
+ * The ByteBuffer is kept alive until the ArrayBuffer has been collected by v8.
+ * Direct ByteBuffers passed to JavaScript as arguments or return values are converted the same way.
+ */
+final public class JNIV8ArrayBuffer extends JNIV8Object {
+    public static native JNIV8ArrayBuffer Create(V8Engine engine, @NonNull ByteBuffer buffer);
+    public static native JNIV8ArrayBuffer CreateWithLength(V8Engine engine, int length);
+
+    private WeakReference<ByteBuffer> mByteBuffer;
+
+    /**
+     * returns the length of the buffer in bytes
+     */
+    public native int getV8ByteLength();
+
+    /**
+     * Returns a direct ByteBuffer referencing the contents of the ArrayBuffer
+     * The buffer keeps this object and with it the memory alive until it has been collected itself, or until dispose
+     */
+    public @NonNull ByteBuffer getByteBuffer() {
+        ByteBuffer buffer = mByteBuffer != null ? mByteBuffer.get() : null;
+        if (buffer == null) {
+            buffer = _getByteBuffer();
+            new ByteBufferReference(buffer, this);
+            mByteBuffer = new WeakReference<>(buffer);
+        }
+        return buffer;
+    }
+
+    /**
+     * releases the JS array buffer
+     *
+     * NOTE: object and the buffer returned by getByteBuffer must not be used anymore after calling this method
+     */
+    public void dispose() throws RuntimeException {
+        mByteBuffer = null;
+        super.dispose();
+    }
+
+    //------------------------------------------------------------------------
+    // internal fields & methods
+    private native ByteBuffer _getByteBuffer();
+
+    /**
+     * The memory of the ByteBuffers returned by _getByteBuffer belongs to the ArrayBuffer, which v8 frees once no
+     * wrapper references it anymore; java does not know about that, so the wrapper is referenced from here until the
+     * ByteBuffer is phantom reachable. The wrapper only references the ByteBuffer weakly, or it would never be.
+     */
+    private static final class ByteBufferReference extends PhantomReference<ByteBuffer> {
+        private static final ReferenceQueue<ByteBuffer> sQueue = new ReferenceQueue<>();
+        private static final HashSet<ByteBufferReference> sReferences = new HashSet<>();
+
+        static {
+            final Thread thread = new Thread(() -> {
+                while (true) {
+                    try {
+                        final ByteBufferReference reference = (ByteBufferReference) sQueue.remove();
+                        synchronized (sReferences) {
+                            sReferences.remove(reference);
+                        }
+                    } catch (InterruptedException e) {
+                        Thread.currentThread().interrupt();
+                        Log.e("JNIV8ArrayBuffer", "The ByteBuffer daemon has been interrupted." +
+                                " ArrayBuffers of ByteBuffers cannot be freed anymore");
+                        break;
+                    }
+                }
+            });
+            thread.setName("EjectaV8ByteBufferDaemon");
+            thread.setDaemon(true);
+            thread.start();
+        }
+
+        @SuppressWarnings({"unused", "FieldCanBeLocal"})
+        private final JNIV8ArrayBuffer mArrayBuffer;
+
+        ByteBufferReference(final ByteBuffer buffer, final JNIV8ArrayBuffer arrayBuffer) {
+            super(buffer, sQueue);
+            mArrayBuffer = arrayBuffer;
+            synchronized (sReferences) {
+                sReferences.add(this);
+            }
+        }
+    }
+
+    @Keep
+    protected JNIV8ArrayBuffer(V8Engine engine, long jsObjPtr, Object[] arguments) {
+        super(engine, jsObjPtr, arguments);
+    }
+}
@@ -97,6 +97,67 @@ final public class JNIV8Function extends JNIV8Object {
         return (T) _callAsV8Function(false, V8Flags.Default, returnType.hashCode(), returnType, receiver, arguments);
     }
 
+    //------------------------------------------------------------------------
+    // calls without an array of arguments; the void variants skip converting the result
+    // numbers are passed without boxing them by the variants taking doubles, e.g. for ticks pushed to JS
+
+    public @Nullable
+    Object call() {
+        return _call(false, 0, null, null, null, null);
+    }
+
+    public @Nullable
+    Object call(@Nullable Object arg0) {
+        return _call(false, 1, arg0, null, null, null);
+    }
+
+    public @Nullable
+    Object call(@Nullable Object arg0, @Nullable Object arg1) {
+        return _call(false, 2, arg0, arg1, null, null);
+    }
+
+    public @Nullable
+    Object call(@Nullable Object arg0, @Nullable Object arg1, @Nullable Object arg2) {
+        return _call(false, 3, arg0, arg1, arg2, null);
+    }
+
+    public @Nullable
+    Object call(@Nullable Object arg0, @Nullable Object arg1, @Nullable Object arg2, @Nullable Object arg3) {
+        return _call(false, 4, arg0, arg1, arg2, arg3);
+    }
+
+    public void callVoid() {
+        _call(true, 0, null, null, null, null);
+    }
+
+    public void callVoid(@Nullable Object arg0) {
+        _call(true, 1, arg0, null, null, null);
+    }
+
+    public void callVoid(@Nullable Object arg0, @Nullable Object arg1) {
+        _call(true, 2, arg0, arg1, null, null);
+    }
+
+    public void callVoid(@Nullable Object arg0, @Nullable Object arg1, @Nullable Object arg2) {
+        _call(true, 3, arg0, arg1, arg2, null);
+    }
+
+    public void callVoid(@Nullable Object arg0, @Nullable Object arg1, @Nullable Object arg2, @Nullable Object arg3) {
+        _call(true, 4, arg0, arg1, arg2, arg3);
+    }
+
+    /**
+     * Calls the function with all numbers of the array as arguments; the array can be reused for the next call
+     */
+    public @Nullable
+    Object callAsV8FunctionWithDoubles(@NonNull double[] arguments) {
+        return _callWithDoubles(false, arguments);
+    }
+
+    public void callVoidWithDoubles(@NonNull double[] arguments) {
+        _callWithDoubles(true, arguments);
+    }
+
     @Override
     public void dispose() throws RuntimeException {
         super.dispose();
@@ -105,6 +166,8 @@ final public class JNIV8Function extends JNIV8Object {
     //------------------------------------------------------------------------
     // internal fields & methods
     private native Object _callAsV8Function(boolean asConstructor, int flags, int type, Class returnType, Object receiver, Object... arguments);
+    private native Object _call(boolean discardResult, int numArgs, Object arg0, Object arg1, Object arg2, Object arg3);
+    private native Object _callWithDoubles(boolean discardResult, double[] arguments);
 
     @Keep
     protected JNIV8Function(V8Engine engine, long jsObjPtr, Object[] arguments) {
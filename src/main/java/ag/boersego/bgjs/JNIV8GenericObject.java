@@ -2,6 +2,7 @@ package ag.boersego.bgjs;
 
 import android.support.annotation.Keep;
 import android.support.annotation.NonNull;
+import android.support.annotation.Nullable;
 
 import java.util.Map;
 import java.util.Set;
@@ -16,6 +17,25 @@ final public class JNIV8GenericObject extends JNIV8Object {
 
     public static native JNIV8GenericObject Create(V8Engine engine);
 
+    /**
+     * Create typed arrays from java primitive arrays; the values are copied into the backing buffer in one go
+     */
+    public static native JNIV8GenericObject CreateFloat64Array(V8Engine engine, @NonNull double[] elements);
+    public static native JNIV8GenericObject CreateInt32Array(V8Engine engine, @NonNull int[] elements);
+
+    /**
+     * Copy the contents of a wrapped Float64Array/Int32Array into a java primitive array
+     * throws a ClassCastException if the object is not of the matching type
+     */
+    public native @NonNull double[] toDoubleArray();
+    public native @NonNull int[] toIntArray();
+
+    /**
+     * Copy the bytes a wrapped typed array or DataView covers of its buffer into a java array
+     * @return null if the object is neither
+     */
+    public native @Nullable byte[] toByteArray();
+
     public void dispose() throws RuntimeException {
         super.dispose();
     }
@@ -35,6 +35,19 @@ abstract public class JNIV8Object extends JNIObject {
 
     static private native void RegisterV8Class(String derivedClass, String baseClass);
 
+    /**
+     * Creates count objects of a registered class, including their js objects, with a single native call
+     * The objects are constructed like objects created from javascript without arguments, so the class needs the
+     * (V8Engine, long, Object[]) constructor.
+     */
+    @SuppressWarnings({"unchecked"})
+    static public @NonNull <T extends JNIV8Object> T[] createMany(@NonNull V8Engine engine, @NonNull Class<T> cls,
+                                                                  int count) {
+        return (T[]) CreateMany(engine, cls.getCanonicalName(), count);
+    }
+
+    static private native JNIV8Object[] CreateMany(V8Engine engine, String canonicalName, int count);
+
     public native double toNumber();
     public native String toString();
     public native String toJSON();
@@ -82,6 +95,68 @@ abstract public class JNIV8Object extends JNIObject {
     }
     private native Object _getV8Field(String name, int flags, int type, Class returnType);
 
+    // unboxed variants for primitive results; values are coerced like primitive arguments of bound java methods
+    public double callV8MethodDouble(@NonNull String name, @Nullable Object... arguments) {
+        return _applyV8MethodDouble(name, V8Flags.Default, arguments);
+    }
+    public int callV8MethodInt(@NonNull String name, @Nullable Object... arguments) {
+        return _applyV8MethodInt(name, V8Flags.Default, arguments);
+    }
+    public boolean callV8MethodBoolean(@NonNull String name, @Nullable Object... arguments) {
+        return _applyV8MethodBoolean(name, V8Flags.Default, arguments);
+    }
+    public double getV8FieldDouble(@NonNull String name) {
+        return _getV8FieldDouble(name, V8Flags.Default);
+    }
+    public int getV8FieldInt(@NonNull String name) {
+        return _getV8FieldInt(name, V8Flags.Default);
+    }
+    public boolean getV8FieldBoolean(@NonNull String name) {
+        return _getV8FieldBoolean(name, V8Flags.Default);
+    }
+    private native double _applyV8MethodDouble(@NonNull String name, int flags, Object[] arguments);
+    private native int _applyV8MethodInt(@NonNull String name, int flags, Object[] arguments);
+    private native boolean _applyV8MethodBoolean(@NonNull String name, int flags, Object[] arguments);
+    private native double _getV8FieldDouble(String name, int flags);
+    private native int _getV8FieldInt(String name, int flags);
+    private native boolean _getV8FieldBoolean(String name, int flags);
+
+    // variants taking a property key instead of a name; see V8PropertyKey
+    public @Nullable Object getV8Field(@NonNull V8PropertyKey key) {
+        return _getV8FieldWithKey(checkKey(key), 0, 0, Object.class);
+    }
+    @SuppressWarnings({"unchecked"})
+    public @Nullable <T> T getV8FieldTyped(@NonNull V8PropertyKey key, int flags, @NonNull Class<T> returnType) {
+        return (T) _getV8FieldWithKey(checkKey(key), flags, returnType.hashCode(), returnType);
+    }
+    @SuppressWarnings({"unchecked"})
+    public @Nullable <T> T getV8FieldTyped(@NonNull V8PropertyKey key, @NonNull Class<T> returnType) {
+        return (T) _getV8FieldWithKey(checkKey(key), V8Flags.Default, returnType.hashCode(), returnType);
+    }
+    public void setV8Field(@NonNull V8PropertyKey key, @Nullable Object value) {
+        _setV8FieldWithKey(checkKey(key), value);
+    }
+    public @Nullable Object callV8Method(@NonNull V8PropertyKey key, Object... arguments) {
+        return _applyV8MethodWithKey(checkKey(key), 0, 0, Object.class, arguments);
+    }
+    @SuppressWarnings({"unchecked"})
+    public @Nullable <T> T callV8MethodTyped(@NonNull V8PropertyKey key, @NonNull Class<T> returnType, @Nullable Object... arguments) {
+        return (T) _applyV8MethodWithKey(checkKey(key), V8Flags.Default, returnType.hashCode(), returnType, arguments);
+    }
+    public boolean hasV8Field(@NonNull V8PropertyKey key) {
+        return _hasV8FieldWithKey(checkKey(key), false);
+    }
+    private int checkKey(@NonNull V8PropertyKey key) {
+        if (key.getV8Engine() != _engine) {
+            throw new IllegalArgumentException("property key '" + key + "' belongs to a different engine");
+        }
+        return key.key;
+    }
+    private native Object _getV8FieldWithKey(int key, int flags, int type, Class returnType);
+    private native void _setV8FieldWithKey(int key, Object value);
+    private native Object _applyV8MethodWithKey(int key, int flags, int type, Class returnType, Object[] arguments);
+    private native boolean _hasV8FieldWithKey(int key, boolean ownOnly);
+
     public boolean hasV8Field(@NonNull String name) {
         return hasV8Field(name, false);
     }
@@ -104,6 +179,23 @@ abstract public class JNIV8Object extends JNIObject {
         return (Map<String, T>)getV8Fields(false, V8Flags.Default, returnType.hashCode(), returnType);
     }
 
+    /**
+     * Returns the values of the specified fields in the order of their names
+     * all fields are read in a single native call
+     */
+    public @NonNull Object[] getV8Fields(@NonNull String[] names) {
+        return _getV8FieldsByName(names, 0, 0, Object.class);
+    }
+    @SuppressWarnings({"unchecked"})
+    public @NonNull <T> T[] getV8FieldsTyped(@NonNull String[] names, int flags, @NonNull Class<T> returnType) {
+        return (T[]) _getV8FieldsByName(names, flags, returnType.hashCode(), returnType);
+    }
+    @SuppressWarnings({"unchecked"})
+    public @NonNull <T> T[] getV8FieldsTyped(@NonNull String[] names, @NonNull Class<T> returnType) {
+        return (T[]) _getV8FieldsByName(names, V8Flags.Default, returnType.hashCode(), returnType);
+    }
+    private native Object[] _getV8FieldsByName(String[] names, int flags, int type, Class returnType);
+
     public @NonNull String[] getV8OwnKeys() {
         return getV8Keys(true);
     }
@@ -2,20 +2,26 @@ package ag.boersego.bgjs;
 
 import android.annotation.SuppressLint;
 import android.app.Application;
+import android.content.ComponentCallbacks2;
+import android.content.res.Configuration;
 import android.content.res.AssetManager;
 import android.content.res.Resources;
 import android.os.Handler;
 import android.os.Looper;
 import android.os.Message;
+import android.os.MessageQueue;
 import android.support.annotation.NonNull;
 import android.support.annotation.Nullable;
 import android.util.Log;
-import android.util.SparseArray;
+
+import dalvik.annotation.optimization.CriticalNative;
 
 import java.io.File;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.Charset;
 import java.util.ArrayList;
 import java.util.HashMap;
-import java.util.HashSet;
 import java.util.Locale;
 import java.util.TimeZone;
 import java.util.concurrent.ThreadPoolExecutor;
@@ -46,13 +52,11 @@ public class V8Engine extends JNIObject implements Handler.Callback {
     protected static V8Engine mInstance;
     private final boolean mIsTablet;
     private final String mStoragePath;
+    private final String mCodeCachePath;
+    private final String mSnapshotPath;
     protected Handler mHandler;
     private boolean mReady;
     private ArrayList<V8EngineHandler> mHandlers = null;
-    private final SparseArray<V8Timeout> mTimeouts = new SparseArray<>(50);
-    private int mLastTimeoutId = 1;
-    private final HashSet<V8Timeout> mTimeoutsToGC = new HashSet<>();
-    private V8Timeout mRunningTO;
     private final String mLocale;
     private final String mLang;
     private final String mTimeZone;
@@ -96,7 +100,6 @@ public class V8Engine extends JNIObject implements Handler.Callback {
         }
     };
 
-    private ArrayList<V8Timeout> mTimeoutsToAddAfterPause = new ArrayList<>();
     private ArrayList<JNIV8Module> mModules = new ArrayList<>();
 
     public void doDebug(final boolean debug) {
@@ -109,8 +112,9 @@ public class V8Engine extends JNIObject implements Handler.Callback {
         }
         mPaused = false;
 
+        // Run timers that expired while we were paused and schedule the next ones
         if (mHandler != null) {
-            mHandler.sendMessageDelayed(mHandler.obtainMessage(MSG_CLEANUP), DELAY_CLEANUP);
+            mHandler.sendEmptyMessage(MSG_TIMERS);
         }
 
         for (final JNIV8Module module : mModules) {
@@ -119,18 +123,6 @@ public class V8Engine extends JNIObject implements Handler.Callback {
             }
         }
 
-        synchronized (mTimeouts) {
-            // Check if there timeouts that were requested after we went into pause state
-            for (final V8Timeout to : mTimeoutsToAddAfterPause) {
-                mTimeouts.append(to.id, to);
-                mHandler.postDelayed(to, to.timeout);
-                if (mDebug) {
-                    Log.d(TAG, "setTimeout unpaused added instance " + to + ", to " + to.timeout + ", id " + to.id + ", recurring " + to.recurring);
-                }
-            }
-            mTimeoutsToAddAfterPause.clear();
-        }
-
         // Check if we need to enqueue functions on a next tick, since these were not enqueued if the
         // engine was already paused.
         enqueueAndStartProcessing(null);
@@ -164,7 +156,7 @@ public class V8Engine extends JNIObject implements Handler.Callback {
     public void pause() {
         mPaused = true;
         if (mHandler != null) {
-            mHandler.removeMessages(MSG_CLEANUP);
+            mHandler.removeMessages(MSG_TIMERS);
         }
 
         for (final JNIV8Module module : mModules) {
@@ -176,6 +168,12 @@ public class V8Engine extends JNIObject implements Handler.Callback {
         if (mQueueWaitRunnable != null && mHandler != null) {
             mHandler.removeCallbacks(mQueueWaitRunnable);
         }
+
+        // objects java finalized while js ran are not left waiting for the resume
+        if (mHandler != null) {
+            mHandler.removeCallbacks(mDrainDisposals);
+            mHandler.post(mDrainDisposals);
+        }
     }
 
     /**
@@ -215,6 +213,30 @@ public class V8Engine extends JNIObject implements Handler.Callback {
         return enqueueOnNextTick(function::callAsV8Function);
     }
 
+    /**
+     * lanes of {@link #postTask(Runnable, int)}, the same as the priorities of scheduler.postTask in js
+     * user-blocking tasks run before the timers on every tick; user-visible, e.g. network callbacks, and background
+     * tasks run after them in short slices that end when the next frame of a view is due
+     */
+    public static final int TASK_PRIORITY_USER_BLOCKING = 0;
+    public static final int TASK_PRIORITY_USER_VISIBLE = 1;
+    public static final int TASK_PRIORITY_BACKGROUND = 2;
+
+    /**
+     * Runs runnable on the js thread with the engine locked, in the lane of priority
+     * Can be called from any thread; tasks posted while the engine is paused run once it resumes.
+     *
+     * @param priority one of the TASK_PRIORITY constants
+     */
+    public void postTask(@NonNull final Runnable runnable, final int priority) {
+        if (priority < TASK_PRIORITY_USER_BLOCKING || priority > TASK_PRIORITY_BACKGROUND) {
+            throw new IllegalArgumentException("Unknown task priority " + priority);
+        }
+        postTaskNative(runnable, priority);
+    }
+
+    private native void postTaskNative(Runnable runnable, int priority);
+
     public interface V8EngineHandler {
         void onReady();
     }
@@ -231,66 +253,6 @@ public class V8Engine extends JNIObject implements Handler.Callback {
         }
     }
 
-    private class V8Timeout implements Runnable {
-        final long jsCbPtr;
-        final long thisObjPtr;
-        final long timeout;
-        final boolean recurring;
-        private final int id;
-        private boolean dead;
-
-        V8Timeout(final long jsCbPtr, final long thisObjPtr, final long timeout, final boolean recurring, final int id) {
-            this.jsCbPtr = jsCbPtr;
-            this.thisObjPtr = thisObjPtr;
-            this.timeout = timeout;
-            this.recurring = recurring;
-            this.id = id;
-        }
-
-        void setAsDead() {
-            dead = true;
-        }
-
-        @Override
-        public void run() {
-            mRunningTO = this;
-            if (dead) {
-                mTimeoutsToGC.add(this);
-                if (!mHandler.hasMessages(MSG_CLEANUP)) {
-                    mHandler.sendMessageDelayed(mHandler.obtainMessage(MSG_CLEANUP), DELAY_CLEANUP);
-                }
-                return;
-            }
-            if (mDebug) {
-                Log.d(TAG, "timeout ready (id " + id + ") to " + timeout + ", now calling cb " + jsCbPtr);
-            }
-            // synchronized(BGJSPushHelper.getInstance(null)) {
-            ClientAndroid.timeoutCB(V8Engine.this, jsCbPtr, thisObjPtr, false, true);
-            // }
-            synchronized (mTimeouts) {
-                if (dead) {
-                    mTimeoutsToGC.add(this);
-                    if (!mHandler.hasMessages(MSG_CLEANUP)) {
-                        mHandler.sendMessageDelayed(mHandler.obtainMessage(MSG_CLEANUP), DELAY_CLEANUP);
-                    }
-                    return;
-                }
-                if (!recurring) {
-                    mTimeouts.remove(id);
-                    if (mDebug) {
-                        Log.d(TAG, "timeout deleted cb id " + id + ", " + jsCbPtr);
-                    }
-                    mTimeoutsToGC.add(this);
-                } else {
-                    mHandler.postDelayed(this, timeout);
-                    if (mDebug) {
-                        Log.d(TAG, "Re-posting recurring timer id " + id + ", " + jsCbPtr);
-                    }
-                }
-            }
-        }
-    }
-
     protected V8Engine(final Application application, final boolean isStoreBuild) {
         final AssetManager assetManager;
         if (application != null) {
@@ -309,6 +271,17 @@ public class V8Engine extends JNIObject implements Handler.Callback {
                 cacheDir = application.getCacheDir();
             }
             mStoragePath = cacheDir.toString();
+
+            // Compiled code is always kept in internal storage so it cannot be tampered with
+            final File codeCacheDir = new File(application.getCacheDir(), "v8codecache");
+            if (codeCacheDir.isDirectory() || codeCacheDir.mkdirs()) {
+                mCodeCachePath = codeCacheDir.toString();
+            } else {
+                mCodeCachePath = null;
+            }
+
+            final File snapshotFile = getSnapshotFile(application);
+            mSnapshotPath = snapshotFile.isFile() ? snapshotFile.toString() : null;
         } else {
             throw new RuntimeException("Application is null");
         }
@@ -328,12 +301,264 @@ public class V8Engine extends JNIObject implements Handler.Callback {
 
         // start thread
         initializeV8(assetManager, isStoreBuild);
+        application.registerComponentCallbacks(mComponentCallbacks);
 
         jsThread = new Thread(new V8EngineRunnable());
         jsThread.setName("EjectaV8JavaScriptContext");
         jsThread.start();
     }
 
+    /**
+     * Creates an engine without context; only used for serializing startup snapshots
+     */
+    private V8Engine() {
+        mIsTablet = false;
+        mStoragePath = null;
+        mCodeCachePath = null;
+        mSnapshotPath = null;
+        mLocale = null;
+        mLang = null;
+        mTimeZone = null;
+    }
+
+    /**
+     * Location of the startup snapshot that engines of this application deserialize their context from
+     */
+    public static File getSnapshotFile(final Application application) {
+        return new File(application.getFilesDir(), "v8snapshot.bin");
+    }
+
+    /**
+     * Bootstraps a fresh context, requires the specified modules and writes the result as startup snapshot.
+     * Engines created afterwards deserialize their context from the snapshot instead of bootstrapping it.
+     * Warm modules must be plain JavaScript: they must not require native or Java modules or schedule timers.
+     * Snapshots are bound to the v8 version they were created with and are ignored otherwise.
+     *
+     * @param application the application whose assets contain the modules
+     * @param warmModules modules to require before serializing the context
+     * @return true if the snapshot was written to {@link #getSnapshotFile(Application)}
+     */
+    public static boolean createStartupSnapshot(final Application application, final String[] warmModules) {
+        return new V8Engine().createSnapshot(application.getAssets(), getSnapshotFile(application).toString(), warmModules);
+    }
+
+    private native boolean createSnapshot(AssetManager assetManager, String path, String[] warmModules);
+
+    /**
+     * Prepares an isolate on a background thread for the next engine, which then starts without creating its heap and
+     * deserializing the startup snapshot. Engines call this once they are ready and their thread is idle; calling it
+     * again before resetting a session makes sure a spare is ready. Does nothing if there already is a spare.
+     */
+    public native void prepareSpareIsolate();
+
+    public static final int MEMORY_PRESSURE_NONE = 0;
+    public static final int MEMORY_PRESSURE_MODERATE = 1;
+    public static final int MEMORY_PRESSURE_CRITICAL = 2;
+
+    /**
+     * Tells v8 and the native caches that memory is running low; can be called on any thread, even while js runs.
+     * Engines receive the trim memory callbacks of their application already.
+     * v8 collects garbage accordingly and canvases free their image textures before they draw their next frame; under
+     * critical pressure they free their fonts as well.
+     *
+     * @param level one of the MEMORY_PRESSURE constants
+     */
+    public native void onMemoryPressure(int level);
+
+    private final ComponentCallbacks2 mComponentCallbacks = new ComponentCallbacks2() {
+        @Override
+        public void onTrimMemory(final int level) {
+            if (level >= TRIM_MEMORY_MODERATE || level == TRIM_MEMORY_RUNNING_CRITICAL) {
+                onMemoryPressure(MEMORY_PRESSURE_CRITICAL);
+            } else if (level >= TRIM_MEMORY_RUNNING_MODERATE) {
+                onMemoryPressure(MEMORY_PRESSURE_MODERATE);
+            }
+        }
+
+        @Override
+        public void onLowMemory() {
+            onMemoryPressure(MEMORY_PRESSURE_CRITICAL);
+        }
+
+        @Override
+        public void onConfigurationChanged(final Configuration newConfig) {
+        }
+    };
+
+    public interface NearHeapLimitListener {
+        /**
+         * Called on the js thread when the js heap came close to its limit, which was raised to heapLimit bytes so the
+         * app can drop what it holds on to. The limit is raised a few times at most, until v8 aborts the process.
+         */
+        void onNearHeapLimit(V8Engine engine, long heapLimit);
+    }
+
+    private NearHeapLimitListener mNearHeapLimitListener;
+
+    public void setNearHeapLimitListener(@Nullable final NearHeapLimitListener listener) {
+        mNearHeapLimitListener = listener;
+    }
+
+    /**
+     * Called from native code after the heap limit was raised
+     */
+    @SuppressWarnings("unused")
+    private void onNearHeapLimit(final long heapLimit) {
+        Log.w(TAG, "js heap is close to its limit, raised it to " + heapLimit + " bytes");
+        final NearHeapLimitListener listener = mNearHeapLimitListener;
+        if (listener != null) {
+            listener.onNearHeapLimit(this, heapLimit);
+        }
+    }
+
+    public interface LongTaskListener {
+        /**
+         * Called on the main thread when a task of the js thread ran longer than the threshold of the watchdog;
+         * stack holds the js frames it was running then, one per line, and blockedMs how long it had run by then
+         */
+        void onLongTask(V8Engine engine, String stack, long blockedMs);
+    }
+
+    private LongTaskListener mLongTaskListener;
+    // native watchdog while it runs, 0 otherwise
+    private volatile long mWatchdog;
+
+    public void setLongTaskListener(@Nullable final LongTaskListener listener) {
+        mLongTaskListener = listener;
+    }
+
+    /**
+     * Starts watching the tasks of the js thread: the js stack of a task that runs longer than thresholdMs is captured
+     * without stopping it and passed to the {@link LongTaskListener}. Tasks that run longer than terminateAfterMs are
+     * terminated as if they threw an exception no script can catch; 0 never terminates them. Tasks that wait for
+     * native or java code are only reported once they are back in js. May be called again to change the thresholds.
+     */
+    public void startWatchdog(final int thresholdMs, final int terminateAfterMs) {
+        mWatchdog = startWatchdogNative(thresholdMs, terminateAfterMs);
+    }
+
+    public void stopWatchdog() {
+        mWatchdog = 0;
+        stopWatchdogNative();
+    }
+
+    private native long startWatchdogNative(int thresholdMs, int terminateAfterMs);
+
+    private native void stopWatchdogNative();
+
+    @CriticalNative
+    private static native void beginWatchdogTask(long watchdogPtr);
+
+    @CriticalNative
+    private static native void endWatchdogTask(long watchdogPtr);
+
+    /**
+     * Called from native code on the js thread while a long task is still running
+     */
+    @SuppressWarnings("unused")
+    private void onLongTask(final String stack, final long blockedMs) {
+        final LongTaskListener listener = mLongTaskListener;
+        if (listener != null) {
+            new Handler(Looper.getMainLooper()).post(new Runnable() {
+                @Override
+                public void run() {
+                    listener.onLongTask(V8Engine.this, stack, blockedMs);
+                }
+            });
+        }
+    }
+
+    public interface HeapDumpListener {
+        /**
+         * Called on the main thread while the heap snapshot for path is taken
+         */
+        void onHeapDumpProgress(String path, int percent);
+
+        /**
+         * Called on the main thread once the heap snapshot or allocation profile at path was written, or failed to be
+         */
+        void onHeapDumpFinished(String path, boolean success);
+    }
+
+    private HeapDumpListener mHeapDumpListener;
+
+    public void setHeapDumpListener(@Nullable final HeapDumpListener listener) {
+        mHeapDumpListener = listener;
+    }
+
+    /**
+     * Called from native code on the js thread while a heap snapshot is taken
+     */
+    @SuppressWarnings("unused")
+    private void onHeapDumpProgress(final String path, final int percent) {
+        final HeapDumpListener listener = mHeapDumpListener;
+        if (listener != null) {
+            // the heap can not be touched until the snapshot is done, so listeners run elsewhere
+            new Handler(Looper.getMainLooper()).post(new Runnable() {
+                @Override
+                public void run() {
+                    listener.onHeapDumpProgress(path, percent);
+                }
+            });
+        }
+    }
+
+    /**
+     * Called from native code on the js thread once a heap dump file is complete
+     */
+    @SuppressWarnings("unused")
+    private void onHeapDumpFinished(final String path, final boolean success) {
+        if (!success) {
+            Log.w(TAG, "Failed to write heap dump " + path);
+        }
+        final HeapDumpListener listener = mHeapDumpListener;
+        if (listener != null) {
+            new Handler(Looper.getMainLooper()).post(new Runnable() {
+                @Override
+                public void run() {
+                    listener.onHeapDumpFinished(path, success);
+                }
+            });
+        }
+    }
+
+    public interface CpuProfileListener {
+        /**
+         * Called on the main thread once the cpu profile at path was written, or failed to be
+         */
+        void onCpuProfileWritten(String path, boolean success);
+    }
+
+    private CpuProfileListener mCpuProfileListener;
+
+    public void setCpuProfileListener(@Nullable final CpuProfileListener listener) {
+        mCpuProfileListener = listener;
+    }
+
+    /**
+     * Called from native code on the js thread once a cpu profile file is complete
+     */
+    @SuppressWarnings("unused")
+    private void onCpuProfileWritten(final String path, final boolean success) {
+        if (!success) {
+            Log.w(TAG, "Failed to write cpu profile " + path);
+        }
+        final CpuProfileListener listener = mCpuProfileListener;
+        if (listener != null) {
+            new Handler(Looper.getMainLooper()).post(new Runnable() {
+                @Override
+                public void run() {
+                    listener.onCpuProfileWritten(path, success);
+                }
+            });
+        }
+    }
+
+    /**
+     * Sets the cache that ajax responses are stored in
+     * A {@link ag.boersego.bgjs.data.V8ResponseCache} also answers GET requests from its entries and lets requests
+     * for a url that is already being fetched wait for that request.
+     */
     public void setUrlCache(final V8UrlCache cache) {
         BGJSModuleAjax.getInstance().setUrlCache(cache);
     }
@@ -378,7 +603,8 @@ public class V8Engine extends JNIObject implements Handler.Callback {
             Log.d(TAG, "Max heap size for v8 is " + maxHeapSizeForV8 + " MB");
         }
 
-        ClientAndroid.initialize(assetManager, this, mLocale, mLang, mTimeZone, mDensity, mIsTablet ? "tablet" : "phone", mDebug, isStoreBuild, maxHeapSizeForV8);
+        ClientAndroid.initialize(assetManager, this, mLocale, mLang, mTimeZone, mDensity, mIsTablet ? "tablet" : "phone", mDebug, isStoreBuild, maxHeapSizeForV8,
+                mCodeCachePath, mSnapshotPath);
     }
 
     private native void registerModuleNative(JNIV8Module module);
@@ -396,10 +622,152 @@ public class V8Engine extends JNIObject implements Handler.Callback {
 
     public native Object parseJSON(String json);
 
+    native int createPropertyKey(String name);
+
+    /**
+     * UTF-8 encoded JSON prepared for parsing by {@link #parseJSON(PreparedJSON)}
+     * Preparing can happen on any thread; it copies the source into native memory and checks whether it is pure ascii,
+     * so the js thread can create the source string without decoding it and without going through a java String.
+     */
+    public static final class PreparedJSON {
+        final ByteBuffer buffer;
+        final boolean isOneByte;
+
+        private PreparedJSON(final ByteBuffer buffer, final boolean isOneByte) {
+            this.buffer = buffer;
+            this.isOneByte = isOneByte;
+        }
+
+        public static PreparedJSON fromUTF8(@NonNull final byte[] utf8) {
+            boolean isOneByte = true;
+            for (final byte b : utf8) {
+                if (b < 0) {
+                    isOneByte = false;
+                    break;
+                }
+            }
+            final ByteBuffer buffer = ByteBuffer.allocateDirect(utf8.length);
+            buffer.put(utf8);
+            return new PreparedJSON(buffer, isOneByte);
+        }
+
+        public int length() {
+            return buffer.capacity();
+        }
+
+        /**
+         * decodes the source; only meant for error handling and debugging
+         */
+        @Override
+        public String toString() {
+            final ByteBuffer source = buffer.duplicate();
+            source.clear();
+            return Charset.forName("UTF-8").decode(source).toString();
+        }
+    }
+
+    public Object parseJSON(@NonNull final PreparedJSON json) {
+        return parseJSONBuffer(json.buffer, json.buffer.capacity(), json.isOneByte);
+    }
+
+    private native Object parseJSONBuffer(ByteBuffer buffer, int length, boolean isOneByte);
+
+    /**
+     * Serializes value with the structured clone algorithm of v8::ValueSerializer
+     * Large object graphs cross JNI in one call instead of one per field; the result can be read without the engine
+     * by {@link V8ValueReader}, or turned back into js values by {@link #deserialize(ByteBuffer)}.
+     *
+     * @throws V8JSException with a DataCloneError if value contains functions, symbols or other uncloneable values
+     */
+    public @NonNull ByteBuffer serialize(final Object value) {
+        return ByteBuffer.wrap(serializeToArray(value)).order(ByteOrder.LITTLE_ENDIAN);
+    }
+
+    private native byte[] serializeToArray(Object value);
+
+    /**
+     * JSON.stringify of value, encoded as UTF-8 into a direct buffer
+     * The JSON never becomes a java String, so large request bodies are neither copied to UTF-16 nor encoded again.
+     *
+     * @return the buffer with position 0 and the JSON up to its limit, or null if value has no JSON representation
+     * @throws V8JSException if stringifying throws, e.g. for circular objects
+     */
+    public native @Nullable ByteBuffer stringifyToUtf8(Object value);
+
+    /**
+     * Creates js values from the serialized data between position and limit of buffer, which is not modified
+     * The data can come from {@link #serialize(Object)} or {@link V8ValueWriter}; direct buffers are read in place.
+     */
+    public Object deserialize(@NonNull final ByteBuffer buffer) {
+        if (buffer.isDirect()) {
+            return deserializeBuffer(buffer, null, buffer.position(), buffer.remaining());
+        }
+        return deserializeBuffer(null, buffer.array(), buffer.arrayOffset() + buffer.position(), buffer.remaining());
+    }
+
+    private native Object deserializeBuffer(ByteBuffer buffer, byte[] array, int offset, int length);
+
+    /**
+     * Decodes the MessagePack value between position and limit of buffer into js values, which is not modified
+     * Binary payloads from the network skip the detour through a JSON string; direct buffers are read in place. Maps
+     * become objects, bin becomes a Uint8Array and timestamps become Dates, the same as require("msgpack").decode().
+     *
+     * @throws V8JSException with a TypeError if buffer does not hold exactly one valid value
+     */
+    public Object parseMessagePack(@NonNull final ByteBuffer buffer) {
+        if (buffer.isDirect()) {
+            return parseMessagePackBuffer(buffer, null, buffer.position(), buffer.remaining());
+        }
+        return parseMessagePackBuffer(null, buffer.array(), buffer.arrayOffset() + buffer.position(),
+                buffer.remaining());
+    }
+
+    private native Object parseMessagePackBuffer(ByteBuffer buffer, byte[] array, int offset, int length);
+
     public native Object runScript(String script, String name);
 
     public native Object require(String file);
 
+    /**
+     * Creates a context with a global, modules and timers of its own in the isolate of this engine, e.g. for an
+     * independent widget. It shares compiled code and the classes bridged to java with the main context, so it costs
+     * far less memory than another engine; scripts of one context can not reach the globals of another.
+     *
+     * @return id of the context for {@link #runScript(int, String, String)}, {@link #require(int, String)} and
+     * {@link #disposeIsolatedContext(int)}; the main context has id 0
+     */
+    public native int createIsolatedContext();
+
+    /**
+     * Cancels the timers of a context created by {@link #createIsolatedContext()} and drops its modules; its memory is
+     * freed once nothing holds on to its objects
+     *
+     * @return false if there is no context of contextId
+     */
+    public native boolean disposeIsolatedContext(int contextId);
+
+    /**
+     * Runs script in the context of contextId
+     *
+     * @throws IllegalArgumentException if the context does not exist
+     */
+    public Object runScript(final int contextId, final String script, final String name) {
+        return runScriptInContext(contextId, script, name);
+    }
+
+    /**
+     * Requires file in the context of contextId, which has a module cache of its own
+     *
+     * @throws IllegalArgumentException if the context does not exist
+     */
+    public Object require(final int contextId, final String file) {
+        return requireInContext(contextId, file);
+    }
+
+    private native Object runScriptInContext(int contextId, String script, String name);
+
+    private native Object requireInContext(int contextId, String file);
+
     /**
      * Dumps v8 heap to filen
      *
@@ -407,14 +775,189 @@ public class V8Engine extends JNIObject implements Handler.Callback {
      */
     private native String dumpHeap(String path);
 
+    /**
+     * Takes a snapshot of the v8 heap on the js thread and writes it to a file in the background. The
+     * {@link HeapDumpListener} learns when the file is complete.
+     *
+     * @return the path the file will be written to, or null if a snapshot is being taken already
+     */
     public String dumpV8Heap() {
         synchronized (this) {
             return dumpHeap(mStoragePath);
         }
     }
 
+    /**
+     * Starts sampling allocations on the js heap, which is cheap enough to leave running while the app is used
+     *
+     * @param sampleInterval average number of bytes between two samples
+     * @param stackDepth maximum number of stack frames recorded for a sample
+     * @return false if the profiler was running already
+     */
+    public native boolean startSamplingHeapProfiler(int sampleInterval, int stackDepth);
+
+    private native String stopSamplingHeapProfiler(String path);
+
+    /**
+     * Stops sampling allocations and writes the profile to a .heapprofile file in the background, which Chrome
+     * DevTools can load. The {@link HeapDumpListener} learns when the file is complete.
+     *
+     * @return the path the file will be written to, or null if the profiler was not running
+     */
+    public String stopSamplingHeapProfiler() {
+        synchronized (this) {
+            return stopSamplingHeapProfiler(mStoragePath);
+        }
+    }
+
+    /**
+     * Returns what loading every module so far took, in the order require started loading them, as a JSON array of
+     * objects with the keys
+     * <ul>
+     * <li>file: the asset the module was loaded from</li>
+     * <li>probes: number of assets looked for while resolving its name</li>
+     * <li>bytes: size of its source</li>
+     * <li>loadMs, compileMs, evalMs: milliseconds of resolving and opening it, compiling it (or parsing it for json)
+     * and running it; running includes the modules it requires</li>
+     * <li>codeCache: "none", "bundled", "hit", "miss" or "streamed" if it was compiled after require.preload</li>
+     * <li>heapDelta: bytes used on the js heap after running it minus before resolving it</li>
+     * </ul>
+     * Native modules and modules restored from the startup snapshot are not listed.
+     */
+    public native String getModuleStats();
+
+    private native String dumpModuleStats(String path);
+
+    /**
+     * Writes {@link #getModuleStats()} to a .json file, e.g. once the app has started
+     *
+     * @return the path of the file, or null if it could not be written
+     */
+    public String dumpModuleStats() {
+        synchronized (this) {
+            return dumpModuleStats(mStoragePath);
+        }
+    }
+
+    /**
+     * Returns the memory used by the backing stores of ArrayBuffers as a JSON object with the keys
+     * <ul>
+     * <li>liveBytes, peakBytes: bytes of the buffers this engine allocated that are alive, now and at most so far</li>
+     * <li>allocations: number of buffers this engine allocated</li>
+     * <li>poolHits: allocations that reused the memory of a freed buffer</li>
+     * <li>pooledBytes, poolLimit: bytes kept for reuse by the pool that all engines and workers share, and its limit</li>
+     * </ul>
+     * Buffers transferred to a worker stay counted by the engine that allocated them.
+     */
+    public native String getArrayBufferStats();
+
+    /**
+     * Sets how many bytes of freed ArrayBuffers are kept for reuse, 8 MB by default; 0 turns reusing them off.
+     * The pool shrinks on its own under memory pressure.
+     */
+    public static native void setArrayBufferPoolLimit(long bytes);
+
+    /**
+     * Returns counters of the native objects of every JNIObject class that had any, as a JSON object with the keys
+     * <ul>
+     * <li>classes: array of objects with the keys name, live and created (native objects alive and created so far),
+     * strongRefs (global references keeping their java objects alive), jsObjects (js objects linked to them) and
+     * externalMemory (bytes reported to v8 for them)</li>
+     * <li>sampleInterval: see {@link #setAllocationSampleInterval(int)}</li>
+     * <li>sites: the sampled allocation sites with the most live objects, as objects with the keys name, stack
+     * (the top js frames the objects were created from, or "&lt;java&gt;"), live and sampled</li>
+     * </ul>
+     * The counters are always on and cover all engines of the process; a class whose live count keeps growing leaks.
+     */
+    public static native String getObjectStats();
+
+    /**
+     * Makes every interval-th JNIV8Object record the js stack it was created from for {@link #getObjectStats()};
+     * 0, the default, turns sampling off. Sampling captures a stack trace, so small intervals slow down scripts
+     * that create many objects.
+     */
+    public static native void setAllocationSampleInterval(int interval);
+
+    /**
+     * Drops console messages of scripts below priority, one of the priorities of {@link android.util.Log}, before
+     * their arguments are converted to strings. {@link Log#DEBUG} by default, {@link Log#INFO} in store builds.
+     */
+    public native void setLogLevel(int priority);
+
+    /**
+     * Returns the latest console messages of all engines and workers, one per line and oldest first, e.g. to add them
+     * to crash reports. Messages are written to logcat by a background thread, so the last ones may not be there yet.
+     */
+    public static native String getLogBreadcrumbs();
+
+    /**
+     * Switches marking the hot paths of the engine and the trace events of v8, e.g. garbage collections, as sections
+     * in system traces on and off; off by default. Sections only show up while systrace or perfetto record the app.
+     */
+    public native void setTracingEnabled(boolean enabled);
+
+    /**
+     * Starts recording a cpu profile of the js thread. Calls into java and canvas calls show up as functions named
+     * after the method, and as sections in system traces if tracing is enabled. While the background profile runs,
+     * this one samples at its rate.
+     *
+     * @param name title of the profile
+     * @param samplingIntervalUs microseconds between two samples
+     * @return false if a profile is being recorded already
+     */
+    public native boolean startCpuProfile(String name, int samplingIntervalUs);
+
+    private native String stopCpuProfile(String path);
+
+    /**
+     * Stops the cpu profile and writes it to a .cpuprofile file in the background, which Chrome DevTools can load.
+     * The {@link CpuProfileListener} learns when the file is complete.
+     *
+     * @return the path the file will be written to, or null if no profile was being recorded
+     */
+    public String stopCpuProfile() {
+        synchronized (this) {
+            return stopCpuProfile(mStoragePath);
+        }
+    }
+
+    /**
+     * Keeps sampling the js thread at a low rate until stopped, so the time before e.g. a dropped frame can be
+     * attributed in production. Only the latest one to two windows are kept.
+     *
+     * @param samplingIntervalUs microseconds between two samples
+     * @param windowMs length of the windows that are kept
+     */
+    public native void startBackgroundCpuProfile(int samplingIntervalUs, int windowMs);
+
+    public native void stopBackgroundCpuProfile();
+
+    private native String dumpBackgroundCpuProfile(String path);
+
+    /**
+     * Writes what the background profile kept to a .cpuprofile file in the background
+     *
+     * @return the path the file will be written to, or null if the background profile does not run
+     */
+    public String dumpBackgroundCpuProfile() {
+        synchronized (this) {
+            return dumpBackgroundCpuProfile(mStoragePath);
+        }
+    }
+
     public native JNIV8GenericObject getGlobalObject();
 
+    /**
+     * Returns the global object of the context of contextId
+     *
+     * @throws IllegalArgumentException if the context does not exist
+     */
+    public JNIV8GenericObject getGlobalObject(final int contextId) {
+        return getGlobalObjectOfContext(contextId);
+    }
+
+    private native JNIV8GenericObject getGlobalObjectOfContext(int contextId);
+
     /**
      * Create a v8::Locker and return the pointer to the instance
      *
@@ -424,10 +967,13 @@ public class V8Engine extends JNIObject implements Handler.Callback {
 
     /**
      * Destroy / Leave a v8::Locker
+     * Leaving a locker never blocks, so this skips the JNI transition on Android O and newer. {@link #lock()} waits
+     * for the isolate and must stay a regular native method.
      *
      * @param lockerPtr the pointer to the Locker instance
      */
-    private native void unlock(long lockerPtr);
+    @CriticalNative
+    private static native void unlock(long lockerPtr);
 
     private Thread jsThread = null;
 
@@ -441,10 +987,28 @@ public class V8Engine extends JNIObject implements Handler.Callback {
         @Override
         public void run() {
             Looper.prepare();
-            mHandler = new Handler(V8Engine.this);
+            mHandler = new Handler(V8Engine.this) {
+                @Override
+                public void dispatchMessage(final Message msg) {
+                    // everything the js thread runs is a message of this handler, so the watchdog sees all its tasks
+                    final long watchdog = mWatchdog;
+                    if (watchdog == 0) {
+                        super.dispatchMessage(msg);
+                        return;
+                    }
+                    beginWatchdogTask(watchdog);
+                    try {
+                        super.dispatchMessage(msg);
+                    } finally {
+                        endWatchdogTask(watchdog);
+                    }
+                }
+            };
 
             mHandler.sendMessageAtFrontOfQueue(mHandler.obtainMessage(MSG_READY));
-            mHandler.sendMessageDelayed(mHandler.obtainMessage(MSG_CLEANUP), DELAY_CLEANUP);
+            // Timers might have been created while the context was initialized
+            mHandler.sendEmptyMessage(MSG_TIMERS);
+            Looper.myQueue().addIdleHandler(mIdleHandler);
             Looper.loop();
         }
     }
@@ -489,10 +1053,24 @@ public class V8Engine extends JNIObject implements Handler.Callback {
 
     @Override
     public boolean handleMessage(final Message msg) {
+        mIsIdleGCDone = msg.what == MSG_LONG_IDLE;
         switch (msg.what) {
-            case MSG_CLEANUP:
-                cleanup();
-                mHandler.sendMessageDelayed(mHandler.obtainMessage(MSG_CLEANUP), DELAY_CLEANUP);
+            case MSG_LONG_IDLE:
+                if (!mPaused) {
+                    longIdleNotification();
+                }
+                return true;
+            case MSG_TIMERS:
+                mHandler.removeMessages(MSG_TIMERS);
+                if (mPaused) {
+                    return true;
+                }
+                final long nextTimerDelay = runTimers();
+                if (nextTimerDelay >= 0) {
+                    // runTimers might have triggered scheduleTimers; make sure there is exactly one message
+                    mHandler.removeMessages(MSG_TIMERS);
+                    mHandler.sendEmptyMessageDelayed(MSG_TIMERS, nextTimerDelay);
+                }
                 return true;
             case MSG_QUIT:
                 final Looper looper = Looper.myLooper();
@@ -510,88 +1088,83 @@ public class V8Engine extends JNIObject implements Handler.Callback {
                     }
                     mHandlers.clear();
                 }
+                // the next engine gets a spare isolate once this one has nothing left to do
+                Looper.myQueue().addIdleHandler(new MessageQueue.IdleHandler() {
+                    @Override
+                    public boolean queueIdle() {
+                        prepareSpareIsolate();
+                        return false;
+                    }
+                });
                 return true;
         }
         return false;
     }
 
 
-    public void cleanup() {
-        V8Timeout[] timeOutCopy;
-        synchronized (mTimeouts) {
-            timeOutCopy = new V8Timeout[mTimeoutsToGC.size()];
-            timeOutCopy = mTimeoutsToGC.toArray(timeOutCopy);
-            mTimeoutsToGC.clear();
-        }
-        try {
-            final int count = mTimeoutsToGC.size();
-            for (final V8Timeout to : timeOutCopy) {
-                ClientAndroid.timeoutCB(this, to.jsCbPtr, to.thisObjPtr, true, false);
-            }
-            if (mDebug) {
-                Log.d(TAG, "Cleaned up " + count + " timeouts");
+    /**
+     * Gives the garbage collector the time until the next message whenever the js thread runs out of work, so it does
+     * not have to interrupt js later. After a long time without messages v8 is asked to free as much memory as it can.
+     */
+    private final MessageQueue.IdleHandler mIdleHandler = new MessageQueue.IdleHandler() {
+        @Override
+        public boolean queueIdle() {
+            // the queue also turns idle after the long idle notification, which would repeat it forever
+            if (mIsIdleGCDone || mPaused) {
+                return true;
             }
-        } catch (final Exception ex) {
-            Log.i(TAG, "Couldn't clear timeoutsGC", ex);
+            mIsIdleGCDone = true;
+            idleNotification(IDLE_TIME_MS);
+            mHandler.removeMessages(MSG_LONG_IDLE);
+            mHandler.sendEmptyMessageDelayed(MSG_LONG_IDLE, LONG_IDLE_DELAY_MS);
+            return true;
         }
-    }
+    };
 
-    public static int setTimeout(final long jsCbPtr, final long thisObjPtr, final long timeout, final boolean recurring) {
-        if (mInstance != null) {
-            return mInstance.setTimeoutInst(jsCbPtr, thisObjPtr, timeout, recurring);
-        } else {
-            Log.e(TAG, "Cannot do setTimeout when no instance of V8Engine there");
-        }
-        return -1;
-    }
+    private boolean mIsIdleGCDone;
 
-    private int setTimeoutInst(final long jsCbPtr, final long thisObjPtr, final long timeout, final boolean recurring) {
-        synchronized (mTimeouts) {
-            final int id = mLastTimeoutId++;
-            final V8Timeout to = new V8Timeout(jsCbPtr, thisObjPtr, timeout, recurring, id);
-            if (mPaused) {
-                mTimeoutsToAddAfterPause.add(to);
-            } else {
-                mTimeouts.append(id, to);
-                mHandler.postDelayed(to, timeout);
-                if (mDebug) {
-                    Log.d(TAG, "setTimeout added instance " + to + ", to " + timeout + ", id " + id + ", recurring " + recurring);
-                }
-            }
-            return id;
-        }
-    }
+    /**
+     * Lets v8 collect garbage for up to idleTime ms; does nothing while views render frames, which have the collector
+     * use the time left in each frame instead
+     */
+    private native void idleNotification(long idleTime);
 
-    public static void removeTimeout(final int id) {
-        if (mInstance != null) {
-            mInstance.removeTimeoutInst(id);
-        } else {
-            Log.e(TAG, "Cannot do removeTimeout when no instance of V8Engine there");
-        }
-    }
+    private native void longIdleNotification();
 
-    private void removeTimeoutInst(final int id) {
-        synchronized (mTimeouts) {
-            final V8Timeout to = mTimeouts.get(id);
-            if (to != null) {
-                to.setAsDead();
-                mHandler.removeCallbacks(to, null);
-                if (mDebug) {
-                    Log.d(TAG, "Removed timeout (clearTimeout) " + id);
-                }
-                mTimeoutsToAddAfterPause.remove(to);
-                mTimeouts.remove(id);
+    private final Runnable mDrainDisposals = this::drainDisposals;
 
-                if (mRunningTO != to) {
-                    mTimeoutsToGC.add(to);
-                }
-                if (!mHandler.hasMessages(MSG_CLEANUP)) {
-                    mHandler.sendMessageDelayed(mHandler.obtainMessage(MSG_CLEANUP), DELAY_CLEANUP);
-                }
-            } else {
-                Log.i(TAG, "Couldn't remove timeout (clearTimeout) " + id);
-            }
+    /**
+     * Deletes the native objects of finalized java objects that wait for the js thread
+     */
+    private native void drainDisposals();
+
+    /**
+     * Runs all expired JS timers
+     *
+     * @return the delay in ms until the next timer expires or -1 if there are no timers left
+     */
+    private native long runTimers();
+
+    /**
+     * Called from native code whenever a timer was created that expires before the next scheduled timer tick
+     *
+     * @param delay time in ms until the timers have to be run
+     */
+    @SuppressWarnings("unused")
+    private void scheduleTimers(final long delay) {
+        // the handler only exists once the thread was started; it will run the timers once it starts
+        final Handler handler = mHandler;
+        if (handler == null) {
+            return;
         }
+        if (mPaused) {
+            // timers and tasks wait for the resume, objects finalized by java meanwhile are deleted right away
+            handler.removeCallbacks(mDrainDisposals);
+            handler.post(mDrainDisposals);
+            return;
+        }
+        handler.removeMessages(MSG_TIMERS);
+        handler.sendEmptyMessageDelayed(MSG_TIMERS, delay);
     }
 
     public void setHttpClient(final OkHttpClient client) {
@@ -605,14 +1178,18 @@ public class V8Engine extends JNIObject implements Handler.Callback {
     }
 
     // public void loadURL(String URL)
-    private static final int MSG_CLEANUP = 1;
+    private static final int MSG_TIMERS = 1;
     private static final int MSG_QUIT = 2;
     private static final int MSG_LOAD = 3;
     private static final int MSG_READY = 5;
+    private static final int MSG_LONG_IDLE = 6;
+
+    // garbage collection on an idle js thread delays messages arriving in the meantime by up to this much
+    private static final long IDLE_TIME_MS = 10;
+    private static final long LONG_IDLE_DELAY_MS = 30000;
 
 
     public static final int TICK_SLEEP = 250;
-    private static final int DELAY_CLEANUP = 10 * 1000;
 
 
 }
@@ -1,5 +1,8 @@
 package ag.boersego.bgjs;
 
+import java.io.PrintStream;
+import java.io.PrintWriter;
+
 /**
  * Created by martin on 20.10.17.
  */
@@ -29,4 +32,24 @@ public class V8Exception extends RuntimeException {
         Throwable cause = this.getCause();
         return cause != null && cause.getCause() == null;
     }
+
+    // the stack trace of the js error is only read once it is needed; printing a cause does not ask for it
+    @Override
+    public void printStackTrace(PrintStream s) {
+        readJSError();
+        super.printStackTrace(s);
+    }
+
+    @Override
+    public void printStackTrace(PrintWriter s) {
+        readJSError();
+        super.printStackTrace(s);
+    }
+
+    private void readJSError() {
+        Throwable cause = getCause();
+        if (cause instanceof V8JSException) {
+            ((V8JSException) cause).readJSError();
+        }
+    }
 }
@@ -1,5 +1,8 @@
 package ag.boersego.bgjs;
 
+import java.io.PrintStream;
+import java.io.PrintWriter;
+
 import ag.boersego.bgjs.V8Exception;
 
 /**
@@ -9,9 +12,33 @@ import ag.boersego.bgjs.V8Exception;
 public class V8JSException extends RuntimeException {
     private Object v8Exception;
 
+    // exceptions made by native code for js errors read their message and stack trace from js once they are needed
+    private volatile boolean isLazy;
+    private String message;
+    private final String scriptName;
+    private final int lineNumber;
+
     public V8JSException(String message, Object v8Exception, Throwable cause) {
         super(message, cause);
         this.v8Exception = v8Exception;
+        this.message = message;
+        this.scriptName = null;
+        this.lineNumber = -1;
+    }
+
+    /**
+     * Used by native code for errors thrown in JS
+     *
+     * @param v8Exception the wrapped error
+     * @param scriptName the script the error was thrown in, if known
+     * @param lineNumber the line the error was thrown in, or -1
+     */
+    V8JSException(Object v8Exception, String scriptName, int lineNumber, Throwable cause) {
+        super(null, cause);
+        this.v8Exception = v8Exception;
+        this.scriptName = scriptName;
+        this.lineNumber = lineNumber;
+        isLazy = true;
     }
 
     /**
@@ -29,4 +56,43 @@ public class V8JSException extends RuntimeException {
     boolean wasCausedByJS() {
         return getCause() == null;
     }
+
+    @Override
+    public String getMessage() {
+        readJSError();
+        return message;
+    }
+
+    @Override
+    public StackTraceElement[] getStackTrace() {
+        readJSError();
+        return super.getStackTrace();
+    }
+
+    @Override
+    public void printStackTrace(PrintStream s) {
+        readJSError();
+        super.printStackTrace(s);
+    }
+
+    @Override
+    public void printStackTrace(PrintWriter s) {
+        readJSError();
+        super.printStackTrace(s);
+    }
+
+    /**
+     * Reads message and stack trace of the JS error, unless that happened already. This locks the engine.
+     * Exceptions that are printed as the cause of another one need to call this first, which V8Exception does.
+     * Not synchronized, since the JS thread might ask while holding the lock; racing threads just read it twice
+     */
+    void readJSError() {
+        if (!isLazy) {
+            return;
+        }
+        message = readJSError(v8Exception, scriptName, lineNumber);
+        isLazy = false;
+    }
+
+    private native String readJSError(Object v8Exception, String scriptName, int lineNumber);
 }
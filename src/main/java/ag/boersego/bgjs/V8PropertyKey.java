@@ -0,0 +1,36 @@
+package ag.boersego.bgjs;
+
+import android.support.annotation.NonNull;
+
+/**
+ * Handle for a property name that is accessed frequently
+ *
+ * The name is converted to an internalized v8 string once and kept by the engine for its whole lifetime,
+ * so accessing fields or methods via a key neither converts nor looks up the name again.
+ * Keys are meant to be created once and stored, e.g. in static fields; creating a key for the same name again
+ * returns the same engine slot.
+ */
+final public class V8PropertyKey {
+    private final V8Engine mEngine;
+    private final String mName;
+    final int key;
+
+    public V8PropertyKey(@NonNull final V8Engine engine, @NonNull final String name) {
+        mEngine = engine;
+        mName = name;
+        key = engine.createPropertyKey(name);
+    }
+
+    public @NonNull V8Engine getV8Engine() {
+        return mEngine;
+    }
+
+    public @NonNull String getName() {
+        return mName;
+    }
+
+    @Override
+    public String toString() {
+        return mName;
+    }
+}
@@ -0,0 +1,141 @@
+package ag.boersego.bgjs;
+
+import android.graphics.SurfaceTexture;
+import android.opengl.GLES11Ext;
+import android.opengl.GLES20;
+import android.os.Build;
+import android.os.Handler;
+import android.os.Looper;
+import android.view.Surface;
+
+import java.util.concurrent.atomic.AtomicBoolean;
+
+/**
+ * A Surface that a MediaPlayer, an ExoPlayer or a camera can draw into, whose latest frame canvases of a
+ * V8TextureView draw as the image of path, without copying it through a Bitmap
+ *
+ * The frames go into a GL_TEXTURE_EXTERNAL_OES texture of the gl context of the view, so the Surface only exists while
+ * the view has a render thread; the listener is told whenever it is created or destroyed, on the render thread.
+ * Frames are latched once per frame of the view, right before the animation frame callbacks, so a script shows them
+ * by drawing the image in requestAnimationFrame. It needs GLES2; canvases of GLES1 views draw nothing for the image.
+ */
+public class V8SurfaceTextureSource implements SurfaceTexture.OnFrameAvailableListener {
+
+    /**
+     * Learns about the Surface to hand to the producer of the frames
+     */
+    public interface Listener {
+        /**
+         * @param surface valid until onSurfaceDestroyed; producers have to stop drawing into it before that returns
+         */
+        void onSurfaceCreated(V8SurfaceTextureSource source, Surface surface);
+
+        void onSurfaceDestroyed(V8SurfaceTextureSource source);
+    }
+
+    private final String mPath;
+    private final int mWidth;
+    private final int mHeight;
+    private final Listener mListener;
+
+    private final float[] mTransform = new float[16];
+    private final AtomicBoolean mFrameAvailable = new AtomicBoolean();
+    private final int[] mTexture = new int[1];
+    private SurfaceTexture mSurfaceTexture;
+    private Surface mSurface;
+    private V8TextureView mView;
+
+    /**
+     * @param path   images with this src draw the frames, see BGJSGLView.registerImage
+     * @param width  size of the frames, which is also the size of the image
+     * @param height size of the frames, which is also the size of the image
+     */
+    public V8SurfaceTextureSource(final String path, final int width, final int height, final Listener listener) {
+        mPath = path;
+        mWidth = width;
+        mHeight = height;
+        mListener = listener;
+    }
+
+    public String getPath() {
+        return mPath;
+    }
+
+    /**
+     * @return the Surface frames go into, null while the view has no gl context
+     */
+    public Surface getSurface() {
+        return mSurface;
+    }
+
+    @Override
+    public void onFrameAvailable(final SurfaceTexture surfaceTexture) {
+        mFrameAvailable.set(true);
+        final V8TextureView view = mView;
+        if (view != null) {
+            view.requestRender();
+        }
+    }
+
+    /**
+     * Creates the texture and the Surface if there are none yet and latches the latest frame; on the render thread,
+     * with the gl context of view current
+     */
+    void update(final V8TextureView view) {
+        if (mSurfaceTexture == null && !attach(view)) {
+            return;
+        }
+        // the render thread has a Looper that never loops, so before 21 there is no thread to be told about frames on
+        if (Build.VERSION.SDK_INT >= 21 && !mFrameAvailable.getAndSet(false)) {
+            return;
+        }
+        mSurfaceTexture.updateTexImage();
+        mSurfaceTexture.getTransformMatrix(mTransform);
+        BGJSGLView.updateSurfaceTexture(mPath, mTransform);
+    }
+
+    private boolean attach(final V8TextureView view) {
+        GLES20.glGenTextures(1, mTexture, 0);
+        GLES20.glBindTexture(GLES11Ext.GL_TEXTURE_EXTERNAL_OES, mTexture[0]);
+        GLES20.glTexParameteri(GLES11Ext.GL_TEXTURE_EXTERNAL_OES, GLES20.GL_TEXTURE_MIN_FILTER, GLES20.GL_LINEAR);
+        GLES20.glTexParameteri(GLES11Ext.GL_TEXTURE_EXTERNAL_OES, GLES20.GL_TEXTURE_MAG_FILTER, GLES20.GL_LINEAR);
+        GLES20.glTexParameteri(GLES11Ext.GL_TEXTURE_EXTERNAL_OES, GLES20.GL_TEXTURE_WRAP_S, GLES20.GL_CLAMP_TO_EDGE);
+        GLES20.glTexParameteri(GLES11Ext.GL_TEXTURE_EXTERNAL_OES, GLES20.GL_TEXTURE_WRAP_T, GLES20.GL_CLAMP_TO_EDGE);
+        GLES20.glBindTexture(GLES11Ext.GL_TEXTURE_EXTERNAL_OES, 0);
+        if (!BGJSGLView.registerSurfaceTexture(mPath, mTexture[0], mWidth, mHeight)) {
+            GLES20.glDeleteTextures(1, mTexture, 0);
+            mTexture[0] = 0;
+            return false;
+        }
+
+        mView = view;
+        mSurfaceTexture = new SurfaceTexture(mTexture[0]);
+        mSurfaceTexture.setDefaultBufferSize(mWidth, mHeight);
+        if (Build.VERSION.SDK_INT >= 21) {
+            mSurfaceTexture.setOnFrameAvailableListener(this, new Handler(Looper.getMainLooper()));
+        }
+        mSurface = new Surface(mSurfaceTexture);
+        mListener.onSurfaceCreated(this, mSurface);
+        return true;
+    }
+
+    /**
+     * Removes the image and deletes the texture and the Surface, if there are any; on the render thread, with the gl
+     * context they were made in current. A later update creates new ones
+     */
+    void release() {
+        if (mSurfaceTexture == null) {
+            return;
+        }
+        mListener.onSurfaceDestroyed(this);
+        BGJSGLView.unregisterImage(mPath);
+        mSurface.release();
+        mSurfaceTexture.release();
+        GLES20.glDeleteTextures(1, mTexture, 0);
+        mSurface = null;
+        mSurfaceTexture = null;
+        mTexture[0] = 0;
+        mView = null;
+        mFrameAvailable.set(false);
+    }
+}
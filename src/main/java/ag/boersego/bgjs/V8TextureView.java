@@ -4,6 +4,7 @@ import android.annotation.SuppressLint;
 import android.annotation.TargetApi;
 import android.content.Context;
 import android.content.res.Resources;
+import android.graphics.PixelFormat;
 import android.graphics.Rect;
 import android.graphics.SurfaceTexture;
 import android.opengl.EGL14;
@@ -18,6 +19,9 @@ import android.view.MotionEvent;
 import android.view.MotionEvent.PointerCoords;
 import android.view.TextureView;
 import android.view.ViewParent;
+import android.view.WindowManager;
+
+import java.util.concurrent.CopyOnWriteArrayList;
 
 import javax.microedition.khronos.egl.EGL10;
 import javax.microedition.khronos.egl.EGLConfig;
@@ -49,6 +53,12 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
     private PointerCoords mTouchStart;
     private final float mTouchSlop;
     protected IV8GLViewOnRender mCallback;
+    private volatile IV8GLViewOnFrameStats mFrameStatsListener;
+    private volatile int mMaxFramesInFlight = 1;
+    private final CopyOnWriteArrayList<V8SurfaceTextureSource> mSurfaceTextureSources = new CopyOnWriteArrayList<>();
+    // removed sources whose textures the render thread has yet to delete
+    private final CopyOnWriteArrayList<V8SurfaceTextureSource> mRemovedSurfaceTextureSources =
+            new CopyOnWriteArrayList<>();
     private Rect mViewRect;
     private boolean mFinished = false;
 
@@ -58,11 +68,25 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
     private static final boolean LOG_FPS = false && BuildConfig.DEBUG;
     private static final int MAX_NUM_TOUCHES = 10;
     private static final int TOUCH_SLOP = 5;
+    private static final long VSYNC_NANOS_DEFAULT = 16_666_667L;
+    private static final int MAX_FRAME_INTERVAL = 4;
+    private static final int FRAMES_BEFORE_SPEEDUP = 30;
     private static final String TAG = "V8TextureView";
+
+    // root of the context group the views share textures in; it is never made current and lives as long as the process
+    private static final Object sShareLock = new Object();
+    private static EGLContext sShareContext;
+    private static EGLDisplay sShareDisplay;
+    private static int sShareGLESVersion;
     private int[] mEglVersion;
     private float mClearRed, mClearGreen, mClearBlue, mClearAlpha;
     private boolean mClearColorSet;
     protected boolean mDontClearOnFlip;
+    private int mGLESVersion = 1;
+    private boolean mShareContext = true;
+    private int mSamples;
+    private int mSurfaceFormat = PixelFormat.RGBA_8888;
+    private volatile boolean mSharesContext;
     private BGJSGLView mBGJSGLView;
     private int mSurfaceWidth;
     private int mSurfaceHeight;
@@ -342,6 +366,8 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
         touchEventObj.setV8Field("type", type);
         touchEventObj.setV8Field("scale", scale);
         touchEventObj.setV8Field("touches", touches);
+        // hit regions were tested natively in setTouchPosition
+        touchEventObj.setV8Field("region", jsGLView.getTouchRegion());
 
         // Just double check that it hasn't been removed since
         if (mBGJSGLView != null) {
@@ -397,6 +423,52 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
         mDontClearOnFlip = dontClear;
     }
 
+    /**
+     * Set the OpenGL ES version of the context the canvas is rendered with. Version 2 and up use the shader backend
+     * of the canvas, version 1 the fixed function pipeline. Has to be called before the surface becomes available.
+     *
+     * @param version major version of OpenGL ES, 1 by default
+     */
+    public void setGLESVersion(final int version) {
+        mGLESVersion = version;
+    }
+
+    /**
+     * Set if the gl context of this view shares textures with the contexts of other views of the same OpenGL ES version,
+     * so the canvases of one engine keep one copy of their images and glyphs. Has to be called before the surface becomes
+     * available.
+     *
+     * @param share true by default
+     */
+    public void setShareContext(final boolean share) {
+        mShareContext = share;
+    }
+
+    /**
+     * Set the number of samples per pixel the canvas is rendered with. Tiled gpus resolve the samples in tile memory,
+     * which antialiases edges at little cost. Devices without a multisampled config render without. Offscreen canvases
+     * use the same number of samples where the gl supports them. Has to be called before the surface becomes available.
+     *
+     * @param samples samples per pixel, 0 by default for no multisampling
+     */
+    public void setMultisampling(final int samples) {
+        mSamples = samples;
+    }
+
+    /**
+     * Set the pixel format of the surface the canvas is rendered to. RGB_565 halves the bandwidth of filling and composing
+     * the surface, which is what limits the frame rate of low-end devices; gradients are dithered to hide the banding.
+     * Devices without a 16 bit config render with 32 bits. Has to be called before the surface becomes available.
+     *
+     * @param format PixelFormat.RGBA_8888 by default, or PixelFormat.RGB_565
+     */
+    public void setSurfaceFormat(final int format) {
+        if (format != PixelFormat.RGBA_8888 && format != PixelFormat.RGB_565) {
+            throw new IllegalArgumentException("Unsupported surface format " + format);
+        }
+        mSurfaceFormat = format;
+    }
+
     public void shutdown() {
         mIsShuttingDown = true;
     }
@@ -407,8 +479,10 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
         private static final boolean DEBUG = false;
         private final int[] mEglVersion;
         private final boolean mDontTouchSwap;
+        private final int[] mConfigAttribs;
+        private final int mSamples;
 
-        public ConfigChooser(final int r, final int g, final int b, final int a, final int depth, final int stencil, final int[] version) {
+        public ConfigChooser(final int r, final int g, final int b, final int a, final int depth, final int stencil, final int[] version, final int glesVersion, final int samples) {
             mRedSize = r;
             mGreenSize = g;
             mBlueSize = b;
@@ -417,6 +491,8 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
             mStencilSize = stencil;
             mEglVersion = version;
             mDontTouchSwap = isEmulator();
+            mConfigAttribs = glesVersion >= 2 ? s_configAttribsES2 : s_configAttribs2;
+            mSamples = samples;
             if (DEBUG) {
                 Log.d(TAG, "EGL version " + version[0] + "." + version[1]);
             }
@@ -427,30 +503,56 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
          * use a minimum size of 4 bits for red/green/blue, but will perform
          * actual matching in chooseConfig() below.
          */
-        // private static int EGL_OPENGL_ES2_BIT = 4;
+        private static final int EGL_OPENGL_ES2_BIT = 4;
         private static final int[] s_configAttribs2 = {EGL10.EGL_RED_SIZE, 4, EGL10.EGL_GREEN_SIZE, 4, EGL10.EGL_BLUE_SIZE,
                 4, EGL10.EGL_NONE};
+        private static final int[] s_configAttribsES2 = {EGL10.EGL_RED_SIZE, 4, EGL10.EGL_GREEN_SIZE, 4, EGL10.EGL_BLUE_SIZE,
+                4, EGL10.EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT, EGL10.EGL_NONE};
 
         @Override
         public EGLConfig chooseConfig(final EGL10 egl, final EGLDisplay display) {
+            if (mSamples > 1) {
+                // the attribute list ends with EGL_NONE, the sample attributes go before it
+                final int length = mConfigAttribs.length - 1;
+                final int[] attribs = new int[length + 5];
+                System.arraycopy(mConfigAttribs, 0, attribs, 0, length);
+                attribs[length] = EGL10.EGL_SAMPLE_BUFFERS;
+                attribs[length + 1] = 1;
+                attribs[length + 2] = EGL10.EGL_SAMPLES;
+                attribs[length + 3] = mSamples;
+                attribs[length + 4] = EGL10.EGL_NONE;
+                final EGLConfig config = chooseConfig(egl, display, attribs);
+                if (config != null) {
+                    return config;
+                }
+                Log.i(TAG, "No config with " + mSamples + " samples, rendering without multisampling");
+            }
+            final EGLConfig config = chooseConfig(egl, display, mConfigAttribs);
+            if (config == null) {
+                throw new IllegalArgumentException("No configs match configSpec");
+            }
+            return config;
+        }
+
+        private EGLConfig chooseConfig(final EGL10 egl, final EGLDisplay display, final int[] configAttribs) {
 
             /*
              * Get the number of minimally matching EGL configurations
              */
             final int[] num_config = new int[1];
-            egl.eglChooseConfig(display, s_configAttribs2, null, 0, num_config);
+            egl.eglChooseConfig(display, configAttribs, null, 0, num_config);
 
             final int numConfigs = num_config[0];
 
             if (numConfigs <= 0) {
-                throw new IllegalArgumentException("No configs match configSpec");
+                return null;
             }
 
             /*
              * Allocate then read the array of minimally matching EGL configs
              */
             final EGLConfig[] configs = new EGLConfig[numConfigs];
-            egl.eglChooseConfig(display, s_configAttribs2, configs, numConfigs, num_config);
+            egl.eglChooseConfig(display, configAttribs, configs, numConfigs, num_config);
 
             if (DEBUG) {
                 printConfigs(egl, display, configs);
@@ -612,6 +714,45 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
         mCallback = listener;
     }
 
+    /**
+     * Collect frame stats and pass them to listener after every frame; null turns them off again. Collecting them costs
+     * a few counters and a gpu timer query per frame, so production builds can turn them on at runtime
+     *
+     * @param listener called on the render thread
+     */
+    public void setFrameStatsListener(final IV8GLViewOnFrameStats listener) {
+        mFrameStatsListener = listener;
+        requestRender();
+    }
+
+    /**
+     * Frames the gpu may still draw while the next one is recorded, 1 to 3. 1 keeps the latency from the frame
+     * callbacks to the screen lowest; more frames smooth out a gpu that sometimes takes longer than a frame
+     */
+    public void setMaxFramesInFlight(final int frames) {
+        mMaxFramesInFlight = frames;
+    }
+
+    /**
+     * Streams the frames of source into the image of its path; its Surface is created on the render thread once that
+     * has a gl context, and again after every new one
+     */
+    public void addSurfaceTextureSource(final V8SurfaceTextureSource source) {
+        mRemovedSurfaceTextureSources.remove(source);
+        mSurfaceTextureSources.addIfAbsent(source);
+        requestRender();
+    }
+
+    /**
+     * Stops streaming into the image of the path of source; its Surface is destroyed on the render thread
+     */
+    public void removeSurfaceTextureSource(final V8SurfaceTextureSource source) {
+        if (mSurfaceTextureSources.remove(source)) {
+            mRemovedSurfaceTextureSources.addIfAbsent(source);
+            requestRender();
+        }
+    }
+
     /**
      * Pause rendering. Will tell render thread to sleep.
      */
@@ -637,6 +778,7 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
      */
     protected BGJSGLView createGL() {
         final BGJSGLView glView = new BGJSGLView(mEngine, this);
+        glView.setSharesContext(mSharesContext);
         glView.setViewData(mScaling, mDontClearOnFlip, getMeasuredWidth(), getMeasuredHeight());
 
         return glView;
@@ -665,9 +807,21 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
         private long mLastRenderSec;    // Used to calculate FPS
         private int mRenderCnt;
 
+        // Frames start on vsync. A frame that overruns its vsyncs makes following frames wait for more of them, so a
+        // slow scene runs at an even fraction of the refresh rate instead of alternating between two
+        private final VsyncClock mVsync = VsyncClock.getInstance();
+        private long mVsyncNanos = VSYNC_NANOS_DEFAULT;
+        private long mLastFrame;        // vsync number of the last frame that was drawn
+        private int mFrameInterval = 1; // vsyncs per frame
+        private int mFramesInBudget;    // consecutive frames that would have fit into fewer vsyncs
+
         private boolean mRenderPending;
         private boolean mReinitPending;
 
+        private boolean mFrameStatsEnabled;
+        private final long[] mFrameStats = new long[8];
+        private int mAppliedMaxFramesInFlight = 1;
+
 
         private boolean mPaused;
         private int[] mEglVersion;
@@ -770,6 +924,7 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
 
             // Create a C instance of GLView and record the native ID
             mBGJSGLView = createGL();
+            mAppliedMaxFramesInFlight = 1;
 
             onGLCreated(mBGJSGLView);
 
@@ -778,6 +933,7 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
                 mCallback.renderStarted(V8TextureView.this);
             }
 
+            updateVsyncInterval();
             while (!mFinished) {
 
                 synchronized (this) {
@@ -804,25 +960,58 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
                 if (mFinished) {
                     break;
                 }
+                // Wait for the vsync the frame is due at; the first frame after a pause takes the next one
+                final long frameTimeNanos;
+                try {
+                    final long frame = Math.max(mLastFrame + mFrameInterval, mVsync.getFrameCount() + 1);
+                    frameTimeNanos = mVsync.awaitFrame(frame);
+                    mLastFrame = frame;
+                } catch (final InterruptedException e) {
+                    // the surface was destroyed
+                    break;
+                }
+                if (mFinished) {
+                    break;
+                }
                 checkCurrent();
 
                 // Draw here
-                final long startRender = System.currentTimeMillis();
-                final long now = startRender / 1000;
+                final long now = System.currentTimeMillis() / 1000;
                 if (now != mLastRenderSec) {
                     if (LOG_FPS) {
-                        Log.d(TAG, "FPS: " + mRenderCnt);
+                        Log.d(TAG, "FPS: " + mRenderCnt + ", vsyncs per frame " + mFrameInterval);
                     }
                     mRenderCnt = 0;
                     mLastRenderSec = now;
+                    // the refresh rate of a display can change at any time
+                    updateVsyncInterval();
                 }
                 if (DEBUG) {
                     Log.d(TAG, "Will now draw frame");
                 }
 
 
+                final IV8GLViewOnFrameStats statsListener = mFrameStatsListener;
+                if (mBGJSGLView != null && mFrameStatsEnabled != (statsListener != null)) {
+                    mFrameStatsEnabled = statsListener != null;
+                    mBGJSGLView.setFrameStatsEnabled(mFrameStatsEnabled);
+                }
+                final int maxFramesInFlight = mMaxFramesInFlight;
+                if (mBGJSGLView != null && maxFramesInFlight != mAppliedMaxFramesInFlight) {
+                    mAppliedMaxFramesInFlight = maxFramesInFlight;
+                    mBGJSGLView.setMaxFramesInFlight(maxFramesInFlight);
+                }
+                updateSurfaceTextureSources();
+                boolean didDraw = false;
                 if (mBGJSGLView != null) {
-                    mBGJSGLView.onRedraw();
+                    didDraw = mBGJSGLView.onRedraw(frameTimeNanos, mVsyncNanos * mFrameInterval);
+                }
+                adaptFrameInterval(System.nanoTime() - frameTimeNanos);
+                // only frames that ran animation frame callbacks drew anything
+                if (didDraw && statsListener != null && mBGJSGLView.getFrameStats(mFrameStats)) {
+                    statsListener.frameStats(V8TextureView.this, (int) mFrameStats[0], (int) mFrameStats[1],
+                            (int) mFrameStats[2], (int) mFrameStats[3], (int) mFrameStats[4], mFrameStats[5],
+                            (int) mFrameStats[6], mFrameStats[7]);
                 }
 
                 /* if (DEBUG) {
@@ -842,10 +1031,13 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
                     checkEglError("eglSwapBuffers");
                 } */
 
-                // Since we're double buffering, also clear the back buffer
-                if (mClearColorSet) {
+                // Since we're double buffering, also clear the back buffer, unless it is meant to keep the last frame
+                if (mClearColorSet && !mDontClearOnFlip) {
                     GLES10.glClearColor(mClearRed, mClearGreen, mClearBlue, mClearAlpha);
                     GLES10.glClear(GLES10.GL_COLOR_BUFFER_BIT);
+                    if (mBGJSGLView != null) {
+                        mBGJSGLView.backBufferCleared();
+                    }
                 }
 
                 synchronized (this) {
@@ -858,31 +1050,12 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
                             Log.d(TAG, "No work pending, sleeping");
                         }
                         try {
-
-                            wait(100000);
+                            wait();
                         } catch (final InterruptedException e) {
                             // End the loop
                             break;
                         }
                     }
-
-                    if (mFinished) {
-                        break;
-                    }
-
-                    final long renderDone = System.currentTimeMillis();
-
-                    // To achieve a max of 60 fps we will sleep a tad more if we didn't sleep just now
-                    if (renderDone - startRender < 16) {
-                        if (DEBUG) {
-                            Log.d(TAG, "Last frame was less than 16ms ago, sleeping for "
-                                    + (16 - (renderDone - startRender)));
-                        }
-                        try {
-                            Thread.sleep(16 - (renderDone - startRender));
-                        } catch (final InterruptedException ignored) {
-                        }
-                    }
                 }
                 if (mFinished) {
                     break;
@@ -920,6 +1093,9 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
 
             mBGJSGLView = null;
 
+            // the textures of the sources go with the context; the next render thread makes new ones
+            releaseSurfaceTextureSources(mRemovedSurfaceTextureSources);
+            releaseSurfaceTextureSources(mSurfaceTextureSources);
             finishGL();
             // Exit the Looper we started
             final Looper looper = Looper.myLooper();
@@ -935,6 +1111,54 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
             mRenderThread = null;
         }
 
+        private void updateSurfaceTextureSources() {
+            releaseSurfaceTextureSources(mRemovedSurfaceTextureSources);
+            if (mBGJSGLView == null) {
+                return;
+            }
+            for (final V8SurfaceTextureSource source : mSurfaceTextureSources) {
+                source.update(V8TextureView.this);
+            }
+        }
+
+        private void releaseSurfaceTextureSources(final CopyOnWriteArrayList<V8SurfaceTextureSource> sources) {
+            for (final V8SurfaceTextureSource source : sources) {
+                source.release();
+                // sources that were removed meanwhile stay for the next frame
+                if (sources == mRemovedSurfaceTextureSources) {
+                    sources.remove(source);
+                }
+            }
+        }
+
+        private void updateVsyncInterval() {
+            final WindowManager windowManager = (WindowManager) getContext().getSystemService(Context.WINDOW_SERVICE);
+            final float refreshRate = windowManager != null ? windowManager.getDefaultDisplay().getRefreshRate() : 0;
+            mVsyncNanos = refreshRate >= 10 ? (long) (1e9 / refreshRate) : VSYNC_NANOS_DEFAULT;
+        }
+
+        /**
+         * Takes as many vsyncs per frame as the last frame needed from its vsync until it was done. Once frames fit into
+         * fewer vsyncs for a while, the interval is lowered again
+         */
+        private void adaptFrameInterval(final long frameNanos) {
+            final int needed = (int) Math.min(MAX_FRAME_INTERVAL, Math.max(1, (frameNanos + mVsyncNanos - 1) / mVsyncNanos));
+            if (needed > mFrameInterval) {
+                if (DEBUG) {
+                    Log.d(TAG, "Frame took " + frameNanos / 1000 + "us, now drawing every " + needed + " vsyncs");
+                }
+                mFrameInterval = needed;
+                mFramesInBudget = 0;
+            } else if (needed < mFrameInterval) {
+                if (++mFramesInBudget >= FRAMES_BEFORE_SPEEDUP) {
+                    mFrameInterval--;
+                    mFramesInBudget = 0;
+                }
+            } else {
+                mFramesInBudget = 0;
+            }
+        }
+
         @SuppressWarnings("unused")
         private void checkEglError(final String prompt) {
             int error;
@@ -1000,8 +1224,17 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
             }
             mEglVersion = version;
 
-            final ConfigChooser chooser = new ConfigChooser(8, 8, 8, 0, 0, 8, version);
-            mEglConfig = chooser.chooseConfig(mEgl, mEglDisplay);
+            if (mSurfaceFormat == PixelFormat.RGB_565) {
+                try {
+                    mEglConfig = new ConfigChooser(5, 6, 5, 0, 0, 8, version, mGLESVersion, mSamples).chooseConfig(mEgl, mEglDisplay);
+                } catch (final IllegalArgumentException ex) {
+                    Log.i(TAG, "No 16 bit config, rendering with 32 bits");
+                }
+            }
+            if (mEglConfig == null) {
+                final ConfigChooser chooser = new ConfigChooser(8, 8, 8, 0, 0, 8, version, mGLESVersion, mSamples);
+                mEglConfig = chooser.chooseConfig(mEgl, mEglDisplay);
+            }
             if (mEglConfig == null) {
                 throw new RuntimeException("eglConfig not initialized");
             }
@@ -1037,7 +1270,28 @@ abstract public class V8TextureView extends TextureView implements TextureView.S
         }
 
         EGLContext createContext(final EGL10 egl, final EGLDisplay eglDisplay, final EGLConfig eglConfig) {
-            final int[] attrib_list = {EGL_CONTEXT_CLIENT_VERSION, 1, EGL10.EGL_NONE};
+            final int[] attrib_list = {EGL_CONTEXT_CLIENT_VERSION, mGLESVersion, EGL10.EGL_NONE};
+            mSharesContext = false;
+            if (mShareContext) {
+                synchronized (sShareLock) {
+                    if (sShareContext == null) {
+                        final EGLContext root = egl.eglCreateContext(eglDisplay, eglConfig, EGL10.EGL_NO_CONTEXT, attrib_list);
+                        if (root != null && root != EGL10.EGL_NO_CONTEXT) {
+                            sShareContext = root;
+                            sShareDisplay = eglDisplay;
+                            sShareGLESVersion = mGLESVersion;
+                        }
+                    }
+                    if (sShareContext != null && sShareDisplay.equals(eglDisplay) && sShareGLESVersion == mGLESVersion) {
+                        final EGLContext context = egl.eglCreateContext(eglDisplay, eglConfig, sShareContext, attrib_list);
+                        if (context != null && context != EGL10.EGL_NO_CONTEXT) {
+                            mSharesContext = true;
+                            return context;
+                        }
+                        Log.w(TAG, "Cannot share gl context: " + GLUtils.getEGLErrorString(egl.eglGetError()));
+                    }
+                }
+            }
             return egl.eglCreateContext(eglDisplay, eglConfig, EGL10.EGL_NO_CONTEXT, attrib_list);
         }
 
@@ -0,0 +1,60 @@
+package ag.boersego.bgjs;
+
+/**
+ * Tags of the wire format of v8::ValueSerializer, as read by {@link V8ValueReader} and written by {@link V8ValueWriter}
+ *
+ * Values start with a tag byte; integers are base-128 varints (int32 zigzag encoded), doubles are 8 bytes in little
+ * endian order. Objects, arrays, dates, maps, sets and array buffers are numbered in the order they appear, and later
+ * occurrences refer to that number.
+ */
+final class V8ValueFormat {
+    static final int VERSION = 13;
+
+    static final byte TAG_VERSION = (byte) 0xFF;
+    static final byte TAG_PADDING = '\0';
+    static final byte TAG_VERIFY_OBJECT_COUNT = '?';
+    static final byte TAG_THE_HOLE = '-';
+    static final byte TAG_UNDEFINED = '_';
+    static final byte TAG_NULL = '0';
+    static final byte TAG_TRUE = 'T';
+    static final byte TAG_FALSE = 'F';
+    static final byte TAG_INT32 = 'I';
+    static final byte TAG_UINT32 = 'U';
+    static final byte TAG_DOUBLE = 'N';
+    static final byte TAG_UTF8_STRING = 'S';
+    static final byte TAG_ONE_BYTE_STRING = '"';
+    static final byte TAG_TWO_BYTE_STRING = 'c';
+    static final byte TAG_OBJECT_REFERENCE = '^';
+    static final byte TAG_BEGIN_OBJECT = 'o';
+    static final byte TAG_END_OBJECT = '{';
+    static final byte TAG_BEGIN_SPARSE_ARRAY = 'a';
+    static final byte TAG_END_SPARSE_ARRAY = '@';
+    static final byte TAG_BEGIN_DENSE_ARRAY = 'A';
+    static final byte TAG_END_DENSE_ARRAY = '$';
+    static final byte TAG_DATE = 'D';
+    static final byte TAG_TRUE_OBJECT = 'y';
+    static final byte TAG_FALSE_OBJECT = 'x';
+    static final byte TAG_NUMBER_OBJECT = 'n';
+    static final byte TAG_STRING_OBJECT = 's';
+    static final byte TAG_BEGIN_MAP = ';';
+    static final byte TAG_END_MAP = ':';
+    static final byte TAG_BEGIN_SET = '\'';
+    static final byte TAG_END_SET = ',';
+    static final byte TAG_ARRAY_BUFFER = 'B';
+    static final byte TAG_ARRAY_BUFFER_VIEW = 'V';
+
+    // sub tags of array buffer views
+    static final byte VIEW_INT8 = 'b';
+    static final byte VIEW_UINT8 = 'B';
+    static final byte VIEW_UINT8_CLAMPED = 'C';
+    static final byte VIEW_INT16 = 'w';
+    static final byte VIEW_UINT16 = 'W';
+    static final byte VIEW_INT32 = 'd';
+    static final byte VIEW_UINT32 = 'D';
+    static final byte VIEW_FLOAT32 = 'f';
+    static final byte VIEW_FLOAT64 = 'F';
+    static final byte VIEW_DATA_VIEW = '?';
+
+    private V8ValueFormat() {
+    }
+}
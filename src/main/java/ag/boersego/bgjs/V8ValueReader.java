@@ -0,0 +1,285 @@
+package ag.boersego.bgjs;
+
+import android.support.annotation.NonNull;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.charset.Charset;
+import java.util.ArrayList;
+import java.util.Date;
+import java.util.LinkedHashMap;
+import java.util.LinkedHashSet;
+import java.util.Map;
+
+import static ag.boersego.bgjs.V8ValueFormat.*;
+
+/**
+ * Reads values serialized by {@link V8Engine#serialize(Object)} into plain java objects, without touching the engine
+ *
+ * Objects become maps with string keys, arrays become lists, with holes read as undefined. Numbers are read as
+ * Double, like the values of JNIV8Objects. Maps and sets are read as LinkedHashMap and LinkedHashSet, and dates as
+ * Date. Array buffers and typed arrays become little endian ByteBuffers sharing the memory of the source buffer.
+ * Objects that appear more than once are read as the same java object, so cyclic graphs are kept intact.
+ * Readers are not thread safe, but can be used on any thread.
+ */
+final public class V8ValueReader {
+    private static final Charset LATIN1 = Charset.forName("ISO-8859-1");
+    private static final Charset UTF8 = Charset.forName("UTF-8");
+    private static final Charset UTF16LE = Charset.forName("UTF-16LE");
+
+    private final ByteBuffer mBuffer;
+    private final ArrayList<Object> mObjects = new ArrayList<>();
+    private int mVersion;
+
+    /**
+     * @param buffer serialized value from its position to its limit; the buffer itself is not modified
+     */
+    public V8ValueReader(@NonNull final ByteBuffer buffer) {
+        mBuffer = buffer.slice().order(ByteOrder.LITTLE_ENDIAN);
+    }
+
+    /**
+     * reads the header and the value after it
+     *
+     * @throws IllegalArgumentException if the data is not a value in a supported version of the format
+     */
+    public Object read() {
+        if (readTag() != TAG_VERSION) {
+            throw new IllegalArgumentException("Serialized value has no header");
+        }
+        mVersion = (int) readVarint();
+        if (mVersion > VERSION) {
+            throw new IllegalArgumentException("Unsupported serialization format version " + mVersion);
+        }
+        return readValue();
+    }
+
+    private Object readValue() {
+        final Object value = readValueOfTag(readTag());
+        // views are written right after the buffer they are a view of
+        if (value instanceof ByteBuffer && peekTag() == TAG_ARRAY_BUFFER_VIEW) {
+            readTag();
+            return readView((ByteBuffer) value);
+        }
+        return value;
+    }
+
+    private Object readValueOfTag(final byte tag) {
+        switch (tag) {
+            case TAG_VERIFY_OBJECT_COUNT:
+                readVarint();
+                return readValue();
+            case TAG_UNDEFINED:
+                return JNIV8Undefined.GetInstance();
+            case TAG_NULL:
+                return null;
+            case TAG_TRUE:
+                return Boolean.TRUE;
+            case TAG_FALSE:
+                return Boolean.FALSE;
+            case TAG_INT32:
+                return (double) readZigZag();
+            case TAG_UINT32:
+                return (double) readVarint();
+            case TAG_DOUBLE:
+                return mBuffer.getDouble();
+            case TAG_UTF8_STRING:
+                return readString(UTF8);
+            case TAG_ONE_BYTE_STRING:
+                return readString(LATIN1);
+            case TAG_TWO_BYTE_STRING:
+                return readString(UTF16LE);
+            case TAG_OBJECT_REFERENCE: {
+                final long id = readVarint();
+                if (id >= mObjects.size()) {
+                    throw new IllegalArgumentException("Reference to unknown object " + id);
+                }
+                return mObjects.get((int) id);
+            }
+            case TAG_BEGIN_OBJECT: {
+                final LinkedHashMap<String, Object> object = new LinkedHashMap<>();
+                mObjects.add(object);
+                readProperties(object, null, TAG_END_OBJECT);
+                readVarint();
+                return object;
+            }
+            case TAG_BEGIN_DENSE_ARRAY: {
+                final int length = (int) readVarint();
+                final ArrayList<Object> array = new ArrayList<>(length);
+                mObjects.add(array);
+                for (int i = 0; i < length; i++) {
+                    if (peekTag() == TAG_THE_HOLE) {
+                        readTag();
+                        array.add(JNIV8Undefined.GetInstance());
+                    } else {
+                        array.add(readValue());
+                    }
+                }
+                // properties that are not elements are skipped
+                readProperties(null, null, TAG_END_DENSE_ARRAY);
+                readVarint();
+                readVarint();
+                return array;
+            }
+            case TAG_BEGIN_SPARSE_ARRAY: {
+                final int length = (int) readVarint();
+                final ArrayList<Object> array = new ArrayList<>(length);
+                for (int i = 0; i < length; i++) {
+                    array.add(JNIV8Undefined.GetInstance());
+                }
+                mObjects.add(array);
+                readProperties(null, array, TAG_END_SPARSE_ARRAY);
+                readVarint();
+                readVarint();
+                return array;
+            }
+            case TAG_DATE: {
+                final Date date = new Date((long) mBuffer.getDouble());
+                mObjects.add(date);
+                return date;
+            }
+            case TAG_TRUE_OBJECT:
+                mObjects.add(Boolean.TRUE);
+                return Boolean.TRUE;
+            case TAG_FALSE_OBJECT:
+                mObjects.add(Boolean.FALSE);
+                return Boolean.FALSE;
+            case TAG_NUMBER_OBJECT: {
+                final Double number = mBuffer.getDouble();
+                mObjects.add(number);
+                return number;
+            }
+            case TAG_STRING_OBJECT: {
+                // the id is taken before the string is read
+                final int id = mObjects.size();
+                mObjects.add(null);
+                final Object string = readValue();
+                mObjects.set(id, string);
+                return string;
+            }
+            case TAG_BEGIN_MAP: {
+                final LinkedHashMap<Object, Object> map = new LinkedHashMap<>();
+                mObjects.add(map);
+                while (peekTag() != TAG_END_MAP) {
+                    final Object key = readValue();
+                    map.put(key, readValue());
+                }
+                readTag();
+                readVarint();
+                return map;
+            }
+            case TAG_BEGIN_SET: {
+                final LinkedHashSet<Object> set = new LinkedHashSet<>();
+                mObjects.add(set);
+                while (peekTag() != TAG_END_SET) {
+                    set.add(readValue());
+                }
+                readTag();
+                readVarint();
+                return set;
+            }
+            case TAG_ARRAY_BUFFER: {
+                final int length = (int) readVarint();
+                final ByteBuffer buffer = slice(length);
+                mObjects.add(buffer);
+                return buffer;
+            }
+            default:
+                throw new IllegalArgumentException("Unsupported serialization tag '" + (char) tag + "' at " + (mBuffer.position() - 1));
+        }
+    }
+
+    // key value pairs up to the end tag, which is consumed; either object or the elements of array get them
+    private void readProperties(final Map<String, Object> object, final ArrayList<Object> array, final byte endTag) {
+        while (peekTag() != endTag) {
+            final Object key = readValue();
+            final Object value = readValue();
+            if (object != null) {
+                object.put(keyToString(key), value);
+            } else if (array != null && key instanceof Double) {
+                final double index = (Double) key;
+                if (index >= 0 && index < array.size() && index == Math.floor(index)) {
+                    array.set((int) index, value);
+                }
+            }
+        }
+        readTag();
+    }
+
+    private static String keyToString(final Object key) {
+        if (key instanceof Double) {
+            final double number = (Double) key;
+            if (number == Math.rint(number) && Math.abs(number) < 1e15) {
+                return Long.toString((long) number);
+            }
+        }
+        return String.valueOf(key);
+    }
+
+    private ByteBuffer readView(final ByteBuffer arrayBuffer) {
+        final byte subTag = mBuffer.get();
+        final int offset = (int) readVarint();
+        final int length = (int) readVarint();
+        if (subTag != VIEW_INT8 && subTag != VIEW_UINT8 && subTag != VIEW_UINT8_CLAMPED && subTag != VIEW_INT16 &&
+                subTag != VIEW_UINT16 && subTag != VIEW_INT32 && subTag != VIEW_UINT32 && subTag != VIEW_FLOAT32 &&
+                subTag != VIEW_FLOAT64 && subTag != VIEW_DATA_VIEW) {
+            throw new IllegalArgumentException("Unsupported array buffer view '" + (char) subTag + "'");
+        }
+        if (offset < 0 || length < 0 || offset + length > arrayBuffer.capacity()) {
+            throw new IllegalArgumentException("Array buffer view out of bounds");
+        }
+        final ByteBuffer view = arrayBuffer.duplicate();
+        view.position(offset).limit(offset + length);
+        final ByteBuffer slice = view.slice().order(ByteOrder.LITTLE_ENDIAN);
+        mObjects.add(slice);
+        return slice;
+    }
+
+    private String readString(final Charset charset) {
+        final int length = (int) readVarint();
+        return charset.decode(slice(length)).toString();
+    }
+
+    private ByteBuffer slice(final int length) {
+        if (length < 0 || length > mBuffer.remaining()) {
+            throw new IllegalArgumentException("Serialized value is truncated");
+        }
+        final ByteBuffer slice = mBuffer.slice();
+        slice.limit(length);
+        mBuffer.position(mBuffer.position() + length);
+        return slice.order(ByteOrder.LITTLE_ENDIAN);
+    }
+
+    private byte readTag() {
+        byte tag;
+        do {
+            tag = mBuffer.get();
+        } while (tag == TAG_PADDING);
+        return tag;
+    }
+
+    private byte peekTag() {
+        int position = mBuffer.position();
+        while (mBuffer.get(position) == TAG_PADDING) {
+            position++;
+        }
+        return mBuffer.get(position);
+    }
+
+    private long readVarint() {
+        long value = 0;
+        int shift = 0;
+        byte b;
+        do {
+            b = mBuffer.get();
+            value |= (long) (b & 0x7f) << shift;
+            shift += 7;
+        } while ((b & 0x80) != 0 && shift < 64);
+        return value;
+    }
+
+    private int readZigZag() {
+        final int value = (int) readVarint();
+        return (value >>> 1) ^ -(value & 1);
+    }
+}
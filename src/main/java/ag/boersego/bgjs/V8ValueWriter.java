@@ -0,0 +1,257 @@
+package ag.boersego.bgjs;
+
+import android.support.annotation.NonNull;
+
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+import java.util.Collection;
+import java.util.Date;
+import java.util.IdentityHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+import static ag.boersego.bgjs.V8ValueFormat.*;
+
+/**
+ * Writes plain java objects in the format of v8::ValueSerializer, for creating them in js with one call to
+ * {@link V8Engine#deserialize(ByteBuffer)}
+ *
+ * Maps become objects with the string form of their keys as property names, lists and Object[] become arrays, sets
+ * become Sets and dates Dates. Boxed numbers become numbers, booleans and strings stay what they are, and null and
+ * {@link JNIV8Undefined} become null and undefined. ByteBuffers become ArrayBuffers with their remaining bytes, byte[],
+ * int[], float[] and double[] become Uint8Array, Int32Array, Float32Array and Float64Array.
+ * Objects that are written more than once are written as references to the first, so graphs with cycles can be
+ * written. Writers are not thread safe, but can be used on any thread.
+ */
+final public class V8ValueWriter {
+    private byte[] mData = new byte[256];
+    private int mSize;
+    private final IdentityHashMap<Object, Integer> mIds = new IdentityHashMap<>();
+    private int mNextId;
+
+    public V8ValueWriter() {
+        writeByte(TAG_VERSION);
+        writeVarint(VERSION);
+    }
+
+    /**
+     * writes value; a writer holds a single value, which can be a container of many
+     *
+     * @throws IllegalArgumentException if value or one of the objects in it can not be written
+     */
+    public V8ValueWriter write(final Object value) {
+        writeValue(value);
+        return this;
+    }
+
+    /**
+     * the bytes written so far, for {@link V8Engine#deserialize(ByteBuffer)} or {@link V8ValueReader}
+     */
+    public @NonNull ByteBuffer toByteBuffer() {
+        return ByteBuffer.wrap(mData, 0, mSize);
+    }
+
+    private void writeValue(final Object value) {
+        if (value == null) {
+            writeByte(TAG_NULL);
+        } else if (value instanceof JNIV8Undefined) {
+            writeByte(TAG_UNDEFINED);
+        } else if (value instanceof Boolean) {
+            writeByte((Boolean) value ? TAG_TRUE : TAG_FALSE);
+        } else if (value instanceof Integer || value instanceof Short || value instanceof Byte) {
+            writeInt32(((Number) value).intValue());
+        } else if (value instanceof Number) {
+            final double number = ((Number) value).doubleValue();
+            if (number == (int) number && (number != 0 || 1 / number > 0)) {
+                writeInt32((int) number);
+            } else {
+                writeByte(TAG_DOUBLE);
+                writeDouble(number);
+            }
+        } else if (value instanceof CharSequence || value instanceof Character) {
+            writeString(value.toString());
+        } else {
+            final Integer id = mIds.get(value);
+            if (id != null) {
+                writeByte(TAG_OBJECT_REFERENCE);
+                writeVarint(id);
+                return;
+            }
+            writeObject(value);
+        }
+    }
+
+    private void writeObject(final Object value) {
+        if (value instanceof Map) {
+            mIds.put(value, mNextId++);
+            writeByte(TAG_BEGIN_OBJECT);
+            final Map<?, ?> map = (Map<?, ?>) value;
+            for (final Map.Entry<?, ?> entry : map.entrySet()) {
+                writeString(String.valueOf(entry.getKey()));
+                writeValue(entry.getValue());
+            }
+            writeByte(TAG_END_OBJECT);
+            writeVarint(map.size());
+        } else if (value instanceof List || value instanceof Object[]) {
+            mIds.put(value, mNextId++);
+            final Collection<?> list = value instanceof List ? (List<?>) value : Arrays.asList((Object[]) value);
+            writeByte(TAG_BEGIN_DENSE_ARRAY);
+            writeVarint(list.size());
+            for (final Object element : list) {
+                writeValue(element);
+            }
+            writeByte(TAG_END_DENSE_ARRAY);
+            writeVarint(0);
+            writeVarint(list.size());
+        } else if (value instanceof Set) {
+            mIds.put(value, mNextId++);
+            final Set<?> set = (Set<?>) value;
+            writeByte(TAG_BEGIN_SET);
+            for (final Object element : set) {
+                writeValue(element);
+            }
+            writeByte(TAG_END_SET);
+            writeVarint(set.size());
+        } else if (value instanceof Date) {
+            mIds.put(value, mNextId++);
+            writeByte(TAG_DATE);
+            writeDouble(((Date) value).getTime());
+        } else if (value instanceof ByteBuffer) {
+            mIds.put(value, mNextId++);
+            final ByteBuffer buffer = ((ByteBuffer) value).duplicate();
+            writeByte(TAG_ARRAY_BUFFER);
+            writeVarint(buffer.remaining());
+            ensureCapacity(buffer.remaining());
+            final int length = buffer.remaining();
+            buffer.get(mData, mSize, length);
+            mSize += length;
+        } else if (value instanceof byte[]) {
+            final byte[] array = (byte[]) value;
+            writeArrayBuffer(array.length);
+            System.arraycopy(array, 0, mData, mSize, array.length);
+            mSize += array.length;
+            writeView(value, VIEW_UINT8, array.length);
+        } else if (value instanceof int[]) {
+            final int[] array = (int[]) value;
+            writeArrayBuffer(array.length * 4);
+            for (final int element : array) {
+                writeFixed((long) element, 4);
+            }
+            writeView(value, VIEW_INT32, array.length * 4);
+        } else if (value instanceof float[]) {
+            final float[] array = (float[]) value;
+            writeArrayBuffer(array.length * 4);
+            for (final float element : array) {
+                writeFixed(Float.floatToRawIntBits(element), 4);
+            }
+            writeView(value, VIEW_FLOAT32, array.length * 4);
+        } else if (value instanceof double[]) {
+            final double[] array = (double[]) value;
+            writeArrayBuffer(array.length * 8);
+            for (final double element : array) {
+                writeDouble(element);
+            }
+            writeView(value, VIEW_FLOAT64, array.length * 8);
+        } else {
+            throw new IllegalArgumentException("Cannot serialize " + value.getClass().getName());
+        }
+    }
+
+    // the buffer of a typed array; the view follows its contents and gets the id after it
+    private void writeArrayBuffer(final int length) {
+        mNextId++;
+        writeByte(TAG_ARRAY_BUFFER);
+        writeVarint(length);
+        ensureCapacity(length);
+    }
+
+    private void writeView(final Object array, final byte subTag, final int length) {
+        mIds.put(array, mNextId++);
+        writeByte(TAG_ARRAY_BUFFER_VIEW);
+        writeByte(subTag);
+        writeVarint(0);
+        writeVarint(length);
+    }
+
+    private void writeInt32(final int value) {
+        writeByte(TAG_INT32);
+        writeVarint(((long) ((value << 1) ^ (value >> 31))) & 0xffffffffL);
+    }
+
+    private void writeString(final String string) {
+        final int length = string.length();
+        boolean isOneByte = true;
+        for (int i = 0; i < length; i++) {
+            if (string.charAt(i) > 0xff) {
+                isOneByte = false;
+                break;
+            }
+        }
+        if (isOneByte) {
+            writeByte(TAG_ONE_BYTE_STRING);
+            writeVarint(length);
+            ensureCapacity(length);
+            for (int i = 0; i < length; i++) {
+                mData[mSize++] = (byte) string.charAt(i);
+            }
+            return;
+        }
+        // v8 keeps the characters of two byte strings 2 byte aligned
+        final int byteLength = length * 2;
+        if (((mSize + 1 + varintSize(byteLength)) & 1) != 0) {
+            writeByte(TAG_PADDING);
+        }
+        writeByte(TAG_TWO_BYTE_STRING);
+        writeVarint(byteLength);
+        ensureCapacity(byteLength);
+        for (int i = 0; i < length; i++) {
+            final char c = string.charAt(i);
+            mData[mSize++] = (byte) c;
+            mData[mSize++] = (byte) (c >> 8);
+        }
+    }
+
+    private void writeDouble(final double value) {
+        writeFixed(Double.doubleToRawLongBits(value), 8);
+    }
+
+    // little endian
+    private void writeFixed(final long bits, final int bytes) {
+        ensureCapacity(bytes);
+        for (int i = 0; i < bytes; i++) {
+            mData[mSize++] = (byte) (bits >> (i * 8));
+        }
+    }
+
+    private void writeVarint(long value) {
+        ensureCapacity(10);
+        do {
+            byte b = (byte) (value & 0x7f);
+            value >>>= 7;
+            if (value != 0) {
+                b |= 0x80;
+            }
+            mData[mSize++] = b;
+        } while (value != 0);
+    }
+
+    private static int varintSize(long value) {
+        int size = 1;
+        while ((value >>>= 7) != 0) {
+            size++;
+        }
+        return size;
+    }
+
+    private void writeByte(final byte b) {
+        ensureCapacity(1);
+        mData[mSize++] = b;
+    }
+
+    private void ensureCapacity(final int bytes) {
+        if (mSize + bytes > mData.length) {
+            mData = Arrays.copyOf(mData, Math.max(mData.length * 2, mSize + bytes));
+        }
+    }
+}
@@ -0,0 +1,86 @@
+package ag.boersego.bgjs;
+
+import android.os.Handler;
+import android.os.HandlerThread;
+import android.view.Choreographer;
+
+/**
+ * Display vsync for render threads that block between frames
+ *
+ * Choreographer delivers frame callbacks through a looper, which render threads do not run while they draw, so the
+ * callbacks are received on a shared thread and handed over. Callbacks are posted from the first vsync a render thread
+ * waits for until KEEP_COUNTING vsyncs after the last one, so vsyncs that pass while a frame is drawn are counted and
+ * a view that renders continuously stays on its cadence, while idle views cause no wakeups.
+ */
+final class VsyncClock implements Choreographer.FrameCallback {
+    // more than the vsyncs a frame may be spread over, see V8TextureView.MAX_FRAME_INTERVAL
+    private static final int KEEP_COUNTING = 8;
+
+    private static VsyncClock sInstance;
+
+    private final Handler mHandler;
+    private Choreographer mChoreographer;
+    private long mFrameTimeNanos;
+    private long mFrameCount;
+    private long mAwaitedFrame;     // highest vsync number a render thread waited for
+    private boolean mCallbackPosted;
+
+    private final Runnable mPostCallback = new Runnable() {
+        @Override
+        public void run() {
+            // Choreographer is per thread and has to be created on the one that receives the callbacks
+            if (mChoreographer == null) {
+                mChoreographer = Choreographer.getInstance();
+            }
+            mChoreographer.postFrameCallback(VsyncClock.this);
+        }
+    };
+
+    private VsyncClock() {
+        final HandlerThread thread = new HandlerThread("V8Vsync");
+        thread.start();
+        mHandler = new Handler(thread.getLooper());
+    }
+
+    static synchronized VsyncClock getInstance() {
+        if (sInstance == null) {
+            sInstance = new VsyncClock();
+        }
+        return sInstance;
+    }
+
+    /**
+     * number of vsyncs that were delivered so far
+     */
+    synchronized long getFrameCount() {
+        return mFrameCount;
+    }
+
+    /**
+     * blocks until the vsync with the specified number was delivered and returns its time, in System.nanoTime
+     */
+    synchronized long awaitFrame(final long frame) throws InterruptedException {
+        mAwaitedFrame = Math.max(mAwaitedFrame, frame);
+        while (mFrameCount < frame) {
+            if (!mCallbackPosted) {
+                mCallbackPosted = true;
+                mHandler.post(mPostCallback);
+            }
+            wait();
+        }
+        return mFrameTimeNanos;
+    }
+
+    @Override
+    public synchronized void doFrame(final long frameTimeNanos) {
+        mFrameTimeNanos = frameTimeNanos;
+        mFrameCount++;
+        if (mFrameCount < mAwaitedFrame + KEEP_COUNTING) {
+            // called on the thread of the Choreographer
+            mChoreographer.postFrameCallback(this);
+        } else {
+            mCallbackPosted = false;
+        }
+        notifyAll();
+    }
+}
@@ -36,7 +36,7 @@ public class AjaxRequest implements Runnable {
     private OkHttpClient mHttpClient;
     private HashMap<String, String> mHeaders;
     private Headers mResponseHeaders;
-    private FormBody mFormBody;
+    private RequestBody mRequestBody;
 
     public void setHttpClient(OkHttpClient httpClient) {
         mHttpClient = httpClient;
@@ -47,7 +47,14 @@ public class AjaxRequest implements Runnable {
     }
 
     public void setFormBody(@NotNull FormBody formBody) {
-        mFormBody = formBody;
+        mRequestBody = formBody;
+    }
+
+    /**
+     * sets a body that is posted as it is, instead of the data the request was created with
+     */
+    public void setRequestBody(@NonNull RequestBody body) {
+        mRequestBody = body;
     }
 
     public interface AjaxListener {
@@ -278,9 +285,9 @@ public class AjaxRequest implements Runnable {
                 }
             }
 
-            if (mFormBody != null) {
+            if (mRequestBody != null) {
                 if ("POST".equals(mMethod)) {
-                    requestBuilder.post(mFormBody);
+                    requestBuilder.post(mRequestBody);
                 }
             } else {
                 if (mResultBuilder != null) {
@@ -370,12 +377,16 @@ public class AjaxRequest implements Runnable {
     }
 
 
+    protected boolean isCacheable(final Response connection) {
+        return connection != null && mCache != null && !connection.cacheControl().noStore() && connection.request().method().equals("GET");
+    }
+
     protected void storeCacheObject(final Response connection, final Object cachedObject, final long size) {
         if (connection == null) {
             return;
         }
         try {
-            if (!connection.cacheControl().noStore() && connection.request().method().equals("GET") && mCache != null) {
+            if (isCacheable(connection)) {
                 mCache.storeInCache(connection.request().url().toString(), cachedObject, connection.cacheControl().maxAgeSeconds(), size);
             }
         } catch (Exception ex) {
@@ -0,0 +1,48 @@
+package ag.boersego.bgjs.data;
+
+import android.support.annotation.NonNull;
+import android.support.annotation.Nullable;
+
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.channels.Channels;
+import java.nio.channels.WritableByteChannel;
+
+import okhttp3.MediaType;
+import okhttp3.RequestBody;
+import okio.BufferedSink;
+
+/**
+ * Request body of the bytes between position and limit of a buffer, e.g. JSON from
+ * {@link ag.boersego.bgjs.V8Engine#stringifyToUtf8(Object)}
+ *
+ * The buffer is written as it is and not modified, so retries of the request send it again.
+ */
+public class ByteBufferRequestBody extends RequestBody {
+    private final MediaType mContentType;
+    private final ByteBuffer mBuffer;
+
+    public ByteBufferRequestBody(@Nullable final MediaType contentType, @NonNull final ByteBuffer buffer) {
+        mContentType = contentType;
+        mBuffer = buffer;
+    }
+
+    @Override
+    public MediaType contentType() {
+        return mContentType;
+    }
+
+    @Override
+    public long contentLength() {
+        return mBuffer.remaining();
+    }
+
+    @Override
+    public void writeTo(@NonNull final BufferedSink sink) throws IOException {
+        final ByteBuffer source = mBuffer.duplicate();
+        final WritableByteChannel channel = Channels.newChannel(sink.outputStream());
+        while (source.hasRemaining()) {
+            channel.write(source);
+        }
+    }
+}
@@ -0,0 +1,202 @@
+package ag.boersego.bgjs.data;
+
+import android.os.SystemClock;
+import android.support.annotation.NonNull;
+import android.support.annotation.Nullable;
+
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.Map;
+
+import ag.boersego.bgjs.V8Engine;
+import okhttp3.Headers;
+
+/**
+ * In-memory cache of GET responses for the ajax module, set with {@link V8Engine#setUrlCache(V8UrlCache)}
+ *
+ * Responses are kept for their max-age and dropped least recently used first once they take up more than the given
+ * number of bytes. Requests for a url that is already being fetched wait for that request instead of sending their
+ * own. If {@link #setKeepsParsedValues(boolean)} is set, JSON responses are kept as the structured clone of their
+ * parsed value, so a hit is deserialized instead of parsed again.
+ * Entries are keyed by url only, so this cache is not suitable for responses that vary with the request headers.
+ * All methods are thread safe.
+ */
+public class V8ResponseCache implements V8UrlCache {
+
+    /**
+     * Cached response; exactly one of the bodies is set
+     */
+    public static final class Entry {
+        public final int code;
+        public final @Nullable Headers headers;
+        public final @Nullable String text;
+        public final @Nullable V8Engine.PreparedJSON json;
+        public final @Nullable ByteBuffer serialized;
+        final long expiresAt;
+        final long size;
+
+        /**
+         * @param maxAge seconds the response is fresh for; responses with a maxAge of 0 or less are not cached
+         */
+        public Entry(final int code, @Nullable final Headers headers, @Nullable final String text,
+                     @Nullable final V8Engine.PreparedJSON json, final int maxAge) {
+            this(code, headers, text, json, null, SystemClock.elapsedRealtime() + maxAge * 1000L);
+        }
+
+        private Entry(final int code, @Nullable final Headers headers, @Nullable final String text,
+                      @Nullable final V8Engine.PreparedJSON json, @Nullable final ByteBuffer serialized,
+                      final long expiresAt) {
+            this.code = code;
+            this.headers = headers;
+            this.text = text;
+            this.json = json;
+            this.serialized = serialized;
+            this.expiresAt = expiresAt;
+            if (text != null) {
+                size = text.length() * 2L;
+            } else if (json != null) {
+                size = json.length();
+            } else {
+                size = serialized != null ? serialized.remaining() : 0;
+            }
+        }
+    }
+
+    /**
+     * Called on the thread of the finished request
+     */
+    public interface Listener {
+        /**
+         * @param entry response of the request that was waited for, or null if it failed
+         */
+        void onResponse(@Nullable Entry entry);
+    }
+
+    private final LinkedHashMap<String, Entry> mEntries = new LinkedHashMap<>(16, 0.75f, true);
+    private final HashMap<String, ArrayList<Listener>> mWaiting = new HashMap<>();
+    private final long mMaxBytes;
+    private long mBytes;
+    private volatile boolean mKeepsParsedValues;
+
+    /**
+     * @param maxBytes the responses of the cache take up at most
+     */
+    public V8ResponseCache(final long maxBytes) {
+        mMaxBytes = maxBytes;
+    }
+
+    /**
+     * if set, JSON responses are stored as the structured clone of their parsed value. Serializing costs time once,
+     * but every later hit is deserialized faster than the JSON could be parsed.
+     */
+    public void setKeepsParsedValues(final boolean keepsParsedValues) {
+        mKeepsParsedValues = keepsParsedValues;
+    }
+
+    public boolean keepsParsedValues() {
+        return mKeepsParsedValues;
+    }
+
+    /**
+     * @return the fresh response for url, or null
+     */
+    public synchronized @Nullable Entry get(@NonNull final String url) {
+        final Entry entry = mEntries.get(url);
+        if (entry == null) {
+            return null;
+        }
+        if (entry.expiresAt <= SystemClock.elapsedRealtime()) {
+            remove(url);
+            return null;
+        }
+        return entry;
+    }
+
+    public synchronized void put(@NonNull final String url, @NonNull final Entry entry) {
+        remove(url);
+        if (entry.expiresAt <= SystemClock.elapsedRealtime() || entry.size > mMaxBytes) {
+            return;
+        }
+        mEntries.put(url, entry);
+        mBytes += entry.size;
+        trim();
+    }
+
+    /**
+     * replaces the JSON body of entry by the structured clone of its parsed value
+     * Does nothing if url has been stored again in the meantime.
+     */
+    public synchronized void putParsed(@NonNull final String url, @NonNull final Entry entry,
+                                       @NonNull final ByteBuffer serialized) {
+        if (mEntries.get(url) != entry) {
+            return;
+        }
+        put(url, new Entry(entry.code, entry.headers, null, null, serialized, entry.expiresAt));
+    }
+
+    @Override
+    public void storeInCache(final String url, final Object response, final int maxAge, final long size) {
+        if (response instanceof String) {
+            put(url, new Entry(200, null, (String) response, null, maxAge));
+        } else if (response instanceof V8Engine.PreparedJSON) {
+            put(url, new Entry(200, null, null, (V8Engine.PreparedJSON) response, maxAge));
+        }
+    }
+
+    /**
+     * starts fetching url, unless it is fetched already
+     *
+     * @return true if the caller has to fetch url and call {@link #complete(String, Entry)} afterwards; false if
+     * listener is called once the request that is already under way is complete
+     */
+    public synchronized boolean join(@NonNull final String url, @NonNull final Listener listener) {
+        final ArrayList<Listener> listeners = mWaiting.get(url);
+        if (listeners == null) {
+            mWaiting.put(url, new ArrayList<>());
+            return true;
+        }
+        listeners.add(listener);
+        return false;
+    }
+
+    /**
+     * ends fetching url and passes the response to the requests that waited for it
+     *
+     * @param entry the response, or null if the request failed; it is only cached if it is passed to
+     *              {@link #put(String, Entry)} as well
+     */
+    public void complete(@NonNull final String url, @Nullable final Entry entry) {
+        final ArrayList<Listener> listeners;
+        synchronized (this) {
+            listeners = mWaiting.remove(url);
+        }
+        if (listeners != null) {
+            for (final Listener listener : listeners) {
+                listener.onResponse(entry);
+            }
+        }
+    }
+
+    public synchronized void clear() {
+        mEntries.clear();
+        mBytes = 0;
+    }
+
+    private void remove(final String url) {
+        final Entry entry = mEntries.remove(url);
+        if (entry != null) {
+            mBytes -= entry.size;
+        }
+    }
+
+    private void trim() {
+        final Iterator<Map.Entry<String, Entry>> it = mEntries.entrySet().iterator();
+        while (mBytes > mMaxBytes && it.hasNext()) {
+            mBytes -= it.next().getValue().size;
+            it.remove();
+        }
+    }
+}
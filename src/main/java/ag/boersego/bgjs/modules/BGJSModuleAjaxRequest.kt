@@ -2,16 +2,23 @@ package ag.boersego.bgjs.modules
 
 import ag.boersego.bgjs.*
 import ag.boersego.bgjs.data.AjaxRequest
+import ag.boersego.bgjs.data.ByteBufferRequestBody
+import ag.boersego.bgjs.data.V8ResponseCache
 import ag.boersego.bgjs.data.V8UrlCache
 import ag.boersego.v8annotations.*
 import android.annotation.SuppressLint
 import android.util.Log
 import okhttp3.FormBody
 import okhttp3.Headers
+import okhttp3.MediaType
 import okhttp3.OkHttpClient
+import okhttp3.Response
+import java.io.ByteArrayOutputStream
 import java.net.SocketTimeoutException
 import java.net.URLEncoder
 import java.net.UnknownHostException
+import java.nio.ByteBuffer
+import java.nio.channels.Channels
 import java.util.*
 import java.util.concurrent.ThreadPoolExecutor
 
@@ -68,12 +75,39 @@ class BGJSModuleAjaxRequest(engine: V8Engine) : JNIV8Object(engine), Runnable {
         return this
     }
 
+    /**
+     * streams the response: cb is called with an ArrayBuffer for every chunk of the body as it arrives, and done gets
+     * no body. The next chunk is only read once the callbacks for the last one have run.
+     */
+    @V8Function
+    fun chunk(cb: JNIV8Function?): BGJSModuleAjaxRequest {
+        if (cb != null && requestNotFinal) {
+            streamCallbacks.add(Pair(CallbackType.CHUNK, cb))
+        }
+        return this
+    }
+
+    /**
+     * streams a response of newline delimited JSON: cb is called with an array of the records that arrived, parsed
+     * all at once, and done gets no body
+     */
+    @V8Function
+    fun records(cb: JNIV8Function?): BGJSModuleAjaxRequest {
+        if (cb != null && requestNotFinal) {
+            streamCallbacks.add(Pair(CallbackType.RECORDS, cb))
+        }
+        return this
+    }
+
     private var callbacks = ArrayList<Pair<CallbackType, JNIV8Function>>()
+    private var streamCallbacks = ArrayList<Pair<CallbackType, JNIV8Function>>()
 
     enum class CallbackType {
         DONE,
         FAIL,
-        ALWAYS
+        ALWAYS,
+        CHUNK,
+        RECORDS
     }
 
 
@@ -114,11 +148,130 @@ class BGJSModuleAjaxRequest(engine: V8Engine) : JNIV8Object(engine), Runnable {
     }
 
     override fun run() {
+        val responseCache = cache as? V8ResponseCache
+        if (responseCache == null || method != "GET" || !streamCallbacks.isEmpty()) {
+            send(null, false)
+            return
+        }
+        val entry = responseCache.get(url)
+        if (entry != null) {
+            requestNotFinal = false
+            deliverCached(entry)
+            return
+        }
+        val leads = responseCache.join(url) { response ->
+            if (response != null) {
+                requestNotFinal = false
+                deliverCached(response)
+            } else {
+                // the request this one waited for failed, so it tries on its own
+                send(responseCache, false)
+            }
+        }
+        if (leads) {
+            send(responseCache, true)
+        }
+    }
+
+    /**
+     * passes a response this request did not fetch itself to the callbacks
+     */
+    private fun deliverCached(entry: V8ResponseCache.Entry) {
+        if (aborted) {
+            return
+        }
+        v8Engine.runLocked {
+            if (aborted) {
+                return@runLocked
+            }
+            _responseIsJson = entry.json != null || entry.serialized != null
+            val details = HttpResponseDetails(v8Engine).setReturnData(entry.code, entry.headers)
+            val serialized = entry.serialized
+            val json = entry.json
+            if (serialized != null) {
+                callCallbacks(CallbackType.DONE, v8Engine.deserialize(serialized), null, details, entry.code)
+            } else if (json != null) {
+                val parsedResponse: Any?
+                try {
+                    parsedResponse = v8Engine.parseJSON(json)
+                } catch (e: Exception) {
+                    callCallbacks(CallbackType.FAIL, json.toString(), "parseerror", details, entry.code)
+                    return@runLocked
+                }
+                callCallbacks(CallbackType.DONE, parsedResponse, null, details, entry.code)
+            } else {
+                callCallbacks(CallbackType.DONE, entry.text, null, details, entry.code)
+            }
+        }
+    }
+
+    /**
+     * sends the request
+     *
+     * @param responseCache set if the response goes into the response cache instead of the url cache
+     * @param leads whether other requests for the same url wait for this one
+     */
+    private fun send(responseCache: V8ResponseCache?, leads: Boolean) {
         val request = object : AjaxRequest(url, body, null, method) {
+            // raw body of json responses, read and scanned on the request thread
+            private var successJson: V8Engine.PreparedJSON? = null
+            // max-age the response cache may keep the response for, -1 if it may not keep it
+            private var cacheMaxAge = -1
+
+            override fun storeCacheObject(connection: Response?, cachedObject: Any?, size: Long) {
+                if (responseCache == null) {
+                    super.storeCacheObject(connection, cachedObject, size)
+                } else if (connection != null && isCacheable(connection)) {
+                    cacheMaxAge = connection.cacheControl().maxAgeSeconds()
+                }
+            }
+
+            // whether the body went to the stream callbacks
+            private var streamed = false
+
+            override fun onInputStreamReady(connection: Response) {
+                if (!streamCallbacks.isEmpty()) {
+                    streamBody(connection)
+                    mSuccessData = ""
+                    streamed = true
+                    return
+                }
+                if (connection.header("content-type")?.startsWith("application/json") != true) {
+                    super.onInputStreamReady(connection)
+                    return
+                }
+                val bytes = connection.body()!!.bytes()
+                val json = V8Engine.PreparedJSON.fromUTF8(bytes)
+                successJson = json
+
+                // only decode to a java string if the response actually ends up in the cache
+                try {
+                    if (isCacheable(connection)) {
+                        storeCacheObject(connection, if (responseCache != null) json else json.toString(),
+                                bytes.size.toLong())
+                    }
+                } catch (e: Exception) {
+                    Log.i(TAG, "Cannot set cache info", e)
+                }
+            }
+
             @SuppressLint("LogNotTimber")
             override fun run() {
                 super.run()
 
+                val entry = if (responseCache != null && (mSuccessData != null || successJson != null)) {
+                    V8ResponseCache.Entry(mSuccessCode, responseHeaders, mSuccessData, successJson, cacheMaxAge)
+                } else null
+                val cachedEntry = if (cacheMaxAge > 0) entry else null
+                if (responseCache != null) {
+                    if (cachedEntry != null) {
+                        responseCache.put(url, cachedEntry)
+                    }
+                    if (leads) {
+                        responseCache.complete(url, entry)
+                    }
+                }
+
                 requestNotFinal = false
 
                 if (aborted) {
@@ -130,27 +283,33 @@ class BGJSModuleAjaxRequest(engine: V8Engine) : JNIV8Object(engine), Runnable {
                         val contentType = responseHeaders?.get("content-type")
                         _responseIsJson = contentType?.startsWith("application/json") ?: false
 
-                        if (mSuccessData != null) {
+                        val json = successJson
+                        if (mSuccessData != null || json != null) {
                             if (DEBUG) {
-                                Log.d(TAG, "ajax ${method} success response for ${url} with type $contentType and body $mSuccessData")
+                                Log.d(TAG, "ajax ${method} success response for ${url} with type $contentType and body ${mSuccessData ?: json}")
                             }
                             val details = HttpResponseDetails(v8Engine)
                             details.setReturnData(mSuccessCode, responseHeaders)
 
-                            if (_responseIsJson) {
+                            if (streamed) {
+                                callCallbacks(CallbackType.DONE, JNIV8Undefined.GetInstance(), null, details, mSuccessCode)
+                            } else if (_responseIsJson) {
                                 var parsedResponse: Any?
                                 try {
-                                    parsedResponse = v8Engine.parseJSON(mSuccessData)
+                                    parsedResponse = if (json != null) v8Engine.parseJSON(json) else v8Engine.parseJSON(mSuccessData)
                                 } catch (e: Exception) {
                                     // Call fail callback with parse errors
                                     val failDetails = HttpResponseDetails(v8Engine).setReturnData(mSuccessCode, responseHeaders)
-                                    callCallbacks(CallbackType.FAIL, mSuccessData, "parseerror", failDetails, mErrorCode)
+                                    callCallbacks(CallbackType.FAIL, mSuccessData ?: json.toString(), "parseerror", failDetails, mErrorCode)
                                     return@runLocked
                                 }
+                                if (cachedEntry != null && responseCache != null && responseCache.keepsParsedValues()) {
+                                    responseCache.putParsed(url, cachedEntry, v8Engine.serialize(parsedResponse))
+                                }
                                 callCallbacks(CallbackType.DONE, parsedResponse, null, details, mSuccessCode)
 
                             } else {
-                                callCallbacks(CallbackType.DONE, mSuccessData, null, details, mSuccessCode)
+                                callCallbacks(CallbackType.DONE, mSuccessData ?: json.toString(), null, details, mSuccessCode)
                             }
 
                         } else {
@@ -200,12 +359,143 @@ class BGJSModuleAjaxRequest(engine: V8Engine) : JNIV8Object(engine), Runnable {
         if (formBody != null) {
             request.setFormBody(formBody!!)
         }
+        jsonBody?.let {
+            request.setRequestBody(ByteBufferRequestBody(MediaType.parse(outputType!!), it))
+        }
         if (outputType != null) {
             request.setOutputType(outputType)
         }
         executor.execute(request)
     }
 
+    /**
+     * passes the body to the stream callbacks chunk by chunk, on the request thread
+     * Every chunk is a direct buffer that the ArrayBuffer shares, so the body is in memory only once; records are
+     * parsed per chunk from the complete lines, which need not end where a chunk ends.
+     */
+    private fun streamBody(connection: Response) {
+        val stream = connection.body()!!.byteStream()
+        val channel = Channels.newChannel(stream)
+        val wantsChunks = streamCallbacks.any { it.first == CallbackType.CHUNK }
+        val wantsRecords = streamCallbacks.any { it.first == CallbackType.RECORDS }
+        val lines = if (wantsRecords) RecordLines() else null
+        while (!aborted) {
+            val buffer = ByteBuffer.allocateDirect(STREAM_CHUNK_SIZE)
+            var read: Int
+            // fill the chunk with what has arrived already, but do not wait for more than one read
+            do {
+                read = channel.read(buffer)
+            } while (read > 0 && buffer.hasRemaining() && stream.available() > 0)
+            if (buffer.position() > 0) {
+                buffer.flip()
+                val chunk = buffer.slice()
+                val json = lines?.append(chunk)
+                if (!deliverChunk(if (wantsChunks) chunk else null, json, connection)) {
+                    return
+                }
+            }
+            if (read < 0) {
+                break
+            }
+        }
+        val json = lines?.finish()
+        if (json != null && !aborted) {
+            deliverChunk(null, json, connection)
+        }
+    }
+
+    /**
+     * @return false if streaming should stop
+     */
+    private fun deliverChunk(chunk: ByteBuffer?, records: V8Engine.PreparedJSON?, connection: Response): Boolean {
+        var goOn = true
+        v8Engine.runLocked {
+            if (aborted) {
+                goOn = false
+                return@runLocked
+            }
+            val arrayBuffer = if (chunk != null) JNIV8ArrayBuffer.Create(v8Engine, chunk) else null
+            val parsedRecords = if (records != null) {
+                try {
+                    v8Engine.parseJSON(records)
+                } catch (e: Exception) {
+                    val failDetails = HttpResponseDetails(v8Engine).setReturnData(connection.code(), connection.headers())
+                    callCallbacks(CallbackType.FAIL, records.toString(), "parseerror", failDetails, connection.code())
+                    aborted = true
+                    goOn = false
+                    return@runLocked
+                }
+            } else null
+            for (cb in streamCallbacks) {
+                val argument = if (cb.first == CallbackType.CHUNK) arrayBuffer else parsedRecords
+                if (argument == null) {
+                    continue
+                }
+                try {
+                    cb.second.callAsV8Function(argument)
+                } catch (e: Exception) {
+                    Log.e(TAG, "Exception thrown when calling ajax " + cb.first + " callback", e)
+                }
+            }
+        }
+        return goOn
+    }
+
+    /**
+     * collects the lines of newline delimited JSON as one JSON array per chunk
+     */
+    private class RecordLines {
+        private var pending = ByteArray(0)
+
+        /**
+         * @return the complete records up to the last newline in chunk, or null if there are none
+         */
+        fun append(chunk: ByteBuffer): V8Engine.PreparedJSON? {
+            val bytes = ByteArray(pending.size + chunk.remaining())
+            System.arraycopy(pending, 0, bytes, 0, pending.size)
+            chunk.duplicate().get(bytes, pending.size, chunk.remaining())
+            var end = bytes.size
+            while (end > 0 && bytes[end - 1] != '\n'.toByte()) {
+                end--
+            }
+            pending = bytes.copyOfRange(end, bytes.size)
+            return toArray(bytes, end)
+        }
+
+        fun finish(): V8Engine.PreparedJSON? {
+            val bytes = pending
+            pending = ByteArray(0)
+            return toArray(bytes, bytes.size)
+        }
+
+        private fun toArray(bytes: ByteArray, end: Int): V8Engine.PreparedJSON? {
+            val array = ByteArrayOutputStream(end + 2)
+            array.write('['.toInt())
+            var start = 0
+            var count = 0
+            while (start < end) {
+                var lineEnd = start
+                while (lineEnd < end && bytes[lineEnd] != '\n'.toByte()) {
+                    lineEnd++
+                }
+                // blank lines, e.g. keep-alives of long polls, are no records
+                if ((start until lineEnd).any { bytes[it] != ' '.toByte() && bytes[it] != '\r'.toByte() &&
+                                bytes[it] != '\t'.toByte() }) {
+                    if (count++ > 0) {
+                        array.write(','.toInt())
+                    }
+                    array.write(bytes, start, lineEnd - start)
+                }
+                start = lineEnd + 1
+            }
+            if (count == 0) {
+                return null
+            }
+            array.write(']'.toInt())
+            return V8Engine.PreparedJSON.fromUTF8(array.toByteArray())
+        }
+    }
+
     private fun callCallbacks(type: CallbackType, returnObject: Any?, info: String?, details: HttpResponseDetails?, errorCode: Int) {
         for (cb in callbacks) {
             try {
@@ -233,6 +523,9 @@ class BGJSModuleAjaxRequest(engine: V8Engine) : JNIV8Object(engine), Runnable {
 
     private var formBody: FormBody? = null
 
+    // body of json requests, stringified by v8 straight to UTF-8
+    private var jsonBody: ByteBuffer? = null
+
     private var timeoutMs: Int = -1
 
     fun setData(url: String, method: String, headerRaw: JNIV8GenericObject?, body: Any?,
@@ -273,7 +566,7 @@ class BGJSModuleAjaxRequest(engine: V8Engine) : JNIV8Object(engine), Runnable {
                     if (body == null) {
                         this.body = null
                     } else {
-                        this.body = v8Engine.getGlobalObject().getV8Field<JNIV8Object>("JSON", V8Flags.UndefinedIsNull).callV8Method("stringify", body) as String?
+                        this.jsonBody = v8Engine.stringifyToUtf8(body)
                     }
                 }
             } else {
@@ -335,7 +628,8 @@ class BGJSModuleAjaxRequest(engine: V8Engine) : JNIV8Object(engine), Runnable {
         }
 
         if (DEBUG) {
-            Log.d(TAG, "ajax ${this.method} request for ${this.url} with type $outputType and body ${this.body}")
+            val bodyText = this.body ?: jsonBody?.let { "${it.remaining()} bytes of json" }
+            Log.d(TAG, "ajax ${this.method} request for ${this.url} with type $outputType and body $bodyText")
         }
 
     }
@@ -344,6 +638,7 @@ class BGJSModuleAjaxRequest(engine: V8Engine) : JNIV8Object(engine), Runnable {
         private var httpAdditionalHeaders: HashMap<String, String>
         val TAG: String = BGJSModuleAjaxRequest::class.java.simpleName
         private val DEBUG = BuildConfig.DEBUG && true
+        private const val STREAM_CHUNK_SIZE = 65536
 
         init {
             JNIV8Object.RegisterV8Class(BGJSModuleAjaxRequest::class.java)
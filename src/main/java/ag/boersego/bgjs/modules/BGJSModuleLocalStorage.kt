@@ -3,48 +3,40 @@ package ag.boersego.bgjs.modules
 import ag.boersego.bgjs.*
 import android.content.Context
 import android.content.SharedPreferences
+import java.io.File
 
 /**
  * Created by Kevin Read <me@kevin-read.com> on 23.11.17 for myrmecophaga-2.0.
  * Copyright (c) 2017 BörseGo AG. All rights reserved.
  */
 
+/**
+ * localStorage with getItem, setItem, removeItem, clear, key and length
+ *
+ * The items are kept by a native store in a memory mapped file, so neither reading nor writing goes through java or
+ * waits for the disk. Items stored in SharedPreferences by earlier versions are moved into the store once.
+ */
 class BGJSModuleLocalStorage (applicationContext: Context) : JNIV8Module("localStorage") {
 
-    private var mPref: SharedPreferences
-
-    init {
-        mPref = applicationContext.getSharedPreferences(TAG, 0)
-    }
+    private val mPref: SharedPreferences = applicationContext.getSharedPreferences(TAG, 0)
+    private val mPath: String = File(applicationContext.filesDir, "localStorage.bgls").absolutePath
 
     override fun Require(engine: V8Engine, module: JNIV8GenericObject?) {
-        var exports = JNIV8GenericObject.Create(engine)
-
-        exports.setV8Field("getItem", JNIV8Function.Create(engine, { receiver, arguments ->
-            if (arguments.isEmpty() || !(arguments[0] is String)) {
-                throw IllegalArgumentException("getItem needs one parameter of type String")
-            }
-            val key = arguments[0] as String
-
-            mPref.getString(key, null)
-        }))
-
-        exports.setV8Field("setItem", JNIV8Function.Create(engine, { _, arguments ->
-            if (arguments.size < 2 || !(arguments[0] is String) || !(arguments[1] is String)) {
-                throw IllegalArgumentException("setItem needs two parameters of type String")
-            }
-            val key = arguments[0] as String
-            val value = arguments[1] as String
-            mPref.edit().putString(key, value).apply()
-
-            JNIV8Undefined.GetInstance()
-        }))
-
-        module?.setV8Field("exports", exports)
+        val items = mPref.all.filterValues { it is String }
+        if (items.isEmpty()) {
+            requireNative(engine, mPath, module, null, null)
+        } else {
+            requireNative(engine, mPath, module, items.keys.toTypedArray(),
+                    items.values.map { it as String }.toTypedArray())
+            mPref.edit().clear().apply()
+        }
     }
 
+    private external fun requireNative(engine: V8Engine, path: String, module: JNIV8GenericObject?,
+                                       importKeys: Array<String>?, importValues: Array<String>?)
+
     companion object {
         private val TAG = BGJSModuleLocalStorage::class.java.simpleName
     }
 
-}
\ No newline at end of file
+}
@@ -5,6 +5,8 @@ import ag.boersego.v8annotations.*
 import android.annotation.SuppressLint
 import android.util.Log
 import okhttp3.*
+import okio.ByteString
+import java.nio.ByteBuffer
 import java.util.*
 
 /**
@@ -63,17 +65,23 @@ class BGJSWebSocket : JNIV8Object, Runnable {
 
             override fun onMessage(webSocket: WebSocket, text: String) {
                 super.onMessage(webSocket, text)
-                v8Engine.runLocked {
-                    val data = JNIV8GenericObject.Create(v8Engine)
-                    data.setV8Field("data", text)
+                deliverMessage(text)
+            }
 
-                    onmessage?.callAsV8Function(data)
-                }
+            override fun onMessage(webSocket: WebSocket, bytes: ByteString) {
+                super.onMessage(webSocket, bytes)
+                // ByteStrings live on the java heap, so the frame is copied once into a direct buffer
+                // that is handed to JS as an ArrayBuffer without any further copies
+                val buffer = ByteBuffer.allocateDirect(bytes.size())
+                buffer.put(bytes.asByteBuffer())
+                deliverMessage(buffer)
             }
 
             override fun onClosed(webSocket: WebSocket, code: Int, reason: String) {
                 super.onClosed(webSocket, code, reason)
                 v8Engine.runLocked {
+                    // messages still waiting for the next tick have been received before the socket closed
+                    flushMessages.run()
 
                     if (onclose != null) {
                         val closeEvent = JNIV8GenericObject.Create(v8Engine)
@@ -96,6 +104,48 @@ class BGJSWebSocket : JNIV8Object, Runnable {
         })
     }
 
+    /**
+     * Messages are either delivered right away or, if coalescing, queued and handed to JS as one array by a user-visible
+     * task, which makes way for frames
+     * payloads are strings for text frames and direct ByteBuffers (which become ArrayBuffers) for binary frames
+     */
+    private fun deliverMessage(payload: Any) {
+        if (!coalesce) {
+            v8Engine.runLocked {
+                dispatchMessage(payload)
+            }
+            return
+        }
+
+        val scheduleFlush: Boolean
+        synchronized(pendingMessages) {
+            scheduleFlush = pendingMessages.isEmpty()
+            pendingMessages.add(payload)
+        }
+        if (scheduleFlush) {
+            v8Engine.postTask(flushMessages, V8Engine.TASK_PRIORITY_USER_VISIBLE)
+        }
+    }
+
+    private val flushMessages = Runnable {
+        val messages: Array<Any>
+        synchronized(pendingMessages) {
+            messages = pendingMessages.toTypedArray()
+            pendingMessages.clear()
+        }
+        if (messages.isEmpty()) {
+            return@Runnable
+        }
+        dispatchMessage(JNIV8Array.CreateWithArray(v8Engine, messages))
+    }
+
+    private fun dispatchMessage(payload: Any) {
+        val data = JNIV8GenericObject.Create(v8Engine)
+        data.setV8Field("data", payload)
+
+        onmessage?.callAsV8Function(data)
+    }
+
     @V8Function
     @JvmOverloads
     fun close(code: Int = 1000, @V8UndefinedIsNull reason: String? = null) {
@@ -103,14 +153,20 @@ class BGJSWebSocket : JNIV8Object, Runnable {
     }
 
     @V8Function
-    fun send(msg: String): Any? {
+    fun send(msg: Any): Any? {
         var success = false
         v8Engine.runLocked {
             if (_readyState != ReadyState.OPEN && _readyState != ReadyState.CLOSING) {
                 throw RuntimeException("INVALID_STATE_ERR")
             }
             if (socket != null) {
-                socket?.send(msg)
+                // typed arrays and DataViews go out as binary frames of the bytes they cover
+                val viewBytes = (msg as? JNIV8GenericObject)?.toByteArray()
+                when {
+                    msg is JNIV8ArrayBuffer -> socket?.send(ByteString.of(msg.byteBuffer.duplicate()))
+                    viewBytes != null -> socket?.send(ByteString.of(*viewBytes))
+                    else -> socket?.send(msg.toString())
+                }
                 success = true
             }
         }
@@ -131,6 +187,15 @@ class BGJSWebSocket : JNIV8Object, Runnable {
     var onopen: JNIV8Function? = null
         @V8Getter get
         @V8Setter set
+    /**
+     * if set, all messages received within one tick are delivered with a single call to onmessage; event.data is an array then
+     */
+    var coalesce: Boolean = false
+        @V8Getter get
+        @V8Setter set
+
+    private val pendingMessages = ArrayList<Any>()
+
     private var _readyState: ReadyState = ReadyState.CONNECTING
 
     @Suppress("unused")
@@ -0,0 +1,18 @@
+package dalvik.annotation.optimization;
+
+import java.lang.annotation.ElementType;
+import java.lang.annotation.Retention;
+import java.lang.annotation.RetentionPolicy;
+import java.lang.annotation.Target;
+
+/**
+ * Compile time copy of the platform annotation, which is not part of the public SDK.
+ * <p>
+ * Like {@link FastNative}, but for static methods that only take and return primitives: ART on Android O and newer
+ * calls them without a JNIEnv and jclass. They have to be registered with JNIClassInfo::registerCriticalNativeMethod,
+ * which picks the matching native function for the running version.
+ */
+@Retention(RetentionPolicy.CLASS)
+@Target(ElementType.METHOD)
+public @interface CriticalNative {
+}
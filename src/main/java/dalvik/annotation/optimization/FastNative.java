@@ -0,0 +1,18 @@
+package dalvik.annotation.optimization;
+
+import java.lang.annotation.ElementType;
+import java.lang.annotation.Retention;
+import java.lang.annotation.RetentionPolicy;
+import java.lang.annotation.Target;
+
+/**
+ * Compile time copy of the platform annotation, which is not part of the public SDK.
+ * <p>
+ * ART on Android O and newer calls native methods annotated with it without leaving the runnable state, which makes
+ * the transition several times cheaper. Such methods must return quickly and must never block (e.g. on a v8::Locker),
+ * since the garbage collector cannot suspend a thread while it is inside of them. Older versions ignore the annotation.
+ */
+@Retention(RetentionPolicy.CLASS)
+@Target(ElementType.METHOD)
+public @interface FastNative {
+}
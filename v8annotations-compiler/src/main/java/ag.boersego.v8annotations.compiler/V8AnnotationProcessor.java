@@ -176,11 +176,13 @@ public final class V8AnnotationProcessor extends AbstractProcessor {
             if(functionHolder.params != null) {
                 builder.append(", new V8FunctionInfo.V8FunctionArgumentInfo[] {");
 
+                final StringBuilder signature = new StringBuilder("(");
                 int paramIndex = 0;
                 for (final AnnotatedFunctionParamHolder paramHolder : functionHolder.params) {
                     if (paramIndex++ != 0) {
                         builder.append(",");
                     }
+                    signature.append(paramHolder.type);
                     builder.append("\n\t\t\t\tnew V8FunctionInfo.V8FunctionArgumentInfo(\"")
                             .append(paramHolder.type)
                             .append("\", ")
@@ -194,8 +196,12 @@ public final class V8AnnotationProcessor extends AbstractProcessor {
                     builder.append("\n\t\t\t");
                 }
                 builder.append("}");
+
+                // the native side looks up a specialized call for common signatures
+                signature.append(")").append(functionHolder.returnType);
+                builder.append(", \"").append(signature).append("\"");
             } else {
-                builder.append(", null");
+                builder.append(", null, null");
             }
 
             builder.append(")\n");
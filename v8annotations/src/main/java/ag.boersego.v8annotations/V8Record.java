@@ -0,0 +1,16 @@
+package ag.boersego.v8annotations;
+
+import java.lang.annotation.ElementType;
+import java.lang.annotation.Retention;
+import java.lang.annotation.RetentionPolicy;
+import java.lang.annotation.Target;
+
+/**
+ * Marks a data class whose instances are converted to plain js objects with JNIV8Array.CreateWithRecords.
+ * Every instance field that is neither static nor transient becomes a property of the same name, so the fields of
+ * annotated classes are kept unobfuscated.
+ */
+@Retention(RetentionPolicy.CLASS)
+@Target(ElementType.TYPE)
+public @interface V8Record {
+}
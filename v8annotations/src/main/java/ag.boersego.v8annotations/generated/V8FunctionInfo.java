@@ -10,13 +10,23 @@ public class V8FunctionInfo {
     public boolean isStatic;
     public String returnType;
     public V8FunctionArgumentInfo[] arguments;
+    /**
+     * JNI signature of the method, e.g. "(DD)D"; null for methods receiving their arguments as an Object[].
+     * Common signatures are called through specialized native code instead of the generic marshalling.
+     */
+    public String signature;
 
     public V8FunctionInfo(String property, String method, String returnType, boolean isStatic, V8FunctionArgumentInfo[] args) {
+        this(property, method, returnType, isStatic, args, null);
+    }
+
+    public V8FunctionInfo(String property, String method, String returnType, boolean isStatic, V8FunctionArgumentInfo[] args, String signature) {
         this.property = property;
         this.method = method;
         this.isStatic = isStatic;
         this.returnType = returnType;
         this.arguments = args;
+        this.signature = signature;
     }
 
     public static class V8FunctionArgumentInfo {